@@ -22,6 +22,14 @@ struct HasFinalizeGarbageCollectedObject<
     T, void_t<decltype(std::declval<T>().FinalizeGarbageCollectedObject())>>
     : std::true_type {};
 
+template <typename T, typename = void>
+struct IsConcurrentlyFinalizable : std::false_type {};
+
+template <typename T>
+struct IsConcurrentlyFinalizable<
+    T, void_t<typename T::IsConcurrentlyFinalizableTypeMarker>>
+    : std::true_type {};
+
 // The FinalizerTraitImpl specifies how to finalize objects.
 template <typename T, bool isFinalized>
 struct FinalizerTraitImpl;
@@ -79,11 +87,19 @@ struct FinalizerTrait {
   // The callback used to finalize an object of type T.
   static constexpr FinalizationCallback kCallback =
       kNonTrivialFinalizer ? Finalize : nullptr;
+
+  // Whether the callback may be invoked from the concurrent sweeper. See
+  // CPPGC_USING_CONCURRENT_FINALIZER().
+  static constexpr bool kConcurrentlyFinalizable =
+      kNonTrivialFinalizer && IsConcurrentlyFinalizable<T>::value;
 };
 
 template <typename T>
 constexpr FinalizationCallback FinalizerTrait<T>::kCallback;
 
+template <typename T>
+constexpr bool FinalizerTrait<T>::kConcurrentlyFinalizable;
+
 }  // namespace internal
 }  // namespace cppgc
 
@@ -21,7 +21,8 @@ class V8_EXPORT RegisteredGCInfoIndex final {
  public:
   RegisteredGCInfoIndex(FinalizationCallback finalization_callback,
                         TraceCallback trace_callback,
-                        NameCallback name_callback, bool has_v_table);
+                        NameCallback name_callback, bool has_v_table,
+                        bool concurrently_finalizable);
   GCInfoIndex GetIndex() const { return index_; }
 
  private:
@@ -36,7 +37,8 @@ struct GCInfoTrait {
     static_assert(sizeof(T), "T must be fully defined");
     static const RegisteredGCInfoIndex registered_index(
         FinalizerTrait<T>::kCallback, TraceTrait<T>::Trace,
-        NameTrait<T>::GetName, std::is_polymorphic<T>::value);
+        NameTrait<T>::GetName, std::is_polymorphic<T>::value,
+        FinalizerTrait<T>::kConcurrentlyFinalizable);
     return registered_index.GetIndex();
   }
 };
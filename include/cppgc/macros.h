@@ -19,6 +19,18 @@ namespace cppgc {
   void* operator new(size_t, void*) = delete;          \
   static_assert(true, "Force semicolon.")
 
+// Use if the finalizer of the object (destructor or
+// FinalizeGarbageCollectedObject()) only touches memory owned by the object
+// itself and may thus be invoked on a background thread as part of concurrent
+// sweeping. The marker is inherited by subclasses, which must uphold the same
+// guarantee.
+#define CPPGC_USING_CONCURRENT_FINALIZER()                      \
+ public:                                                        \
+  using IsConcurrentlyFinalizableTypeMarker CPPGC_UNUSED = int; \
+                                                                \
+ private:                                                       \
+  static_assert(true, "Force semicolon.")
+
 }  // namespace cppgc
 
 #endif  // INCLUDE_CPPGC_MACROS_H_
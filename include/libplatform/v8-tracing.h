@@ -25,6 +25,7 @@ namespace v8 {
 
 namespace base {
 class Mutex;
+class SharedMutex;
 }  // namespace base
 
 namespace platform {
@@ -316,6 +317,9 @@ class V8_PLATFORM_EXPORT TracingController
   std::unique_ptr<perfetto::TracingSession> tracing_session_;
 #else   // !defined(V8_USE_PERFETTO)
   std::unique_ptr<TraceBuffer> trace_buffer_;
+  // Held shared while a trace object is filled in and exclusively while the
+  // trace buffer is flushed, so that events don't serialize on each other.
+  std::unique_ptr<base::SharedMutex> trace_buffer_mutex_;
 #endif  // !defined(V8_USE_PERFETTO)
 
   // Disallow copy and assign
@@ -158,6 +158,8 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - const FastApiUint8Array&, the elements of a Uint8Array
+ *  - const FastOneByteString&, the characters of a one-byte string
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -169,6 +171,10 @@
  * We also differ from the specific NaN bit pattern that WebIDL prescribes
  * (https://heycam.github.io/webidl/#es-unrestricted-float) in that Blink
  * passes NaN values as-is, i.e. doesn't normalize them.
+ * Uint8Array and string arguments are passed without copying. Arguments that
+ * are not a Uint8Array on a non-detached buffer, or not a flat sequential
+ * one-byte string respectively, make the call take the slow path instead.
+ * The data pointers are only valid until the fast callback returns.
  *
  * To be supported types:
  *  - arrays of C types
@@ -197,6 +203,8 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kUint8Array,
+    kOneByteString,
   };
 
   enum class ArgFlags : uint8_t {
@@ -263,6 +271,19 @@ struct ApiObject {
   uintptr_t address;
 };
 
+// The elements of a Uint8Array argument of a fast API call.
+struct FastApiUint8Array {
+  uint8_t* data;
+  size_t length;
+};
+
+// The characters of a one-byte string argument of a fast API call. They are
+// Latin-1 encoded and not null-terminated.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 namespace internal {
 
 template <typename T>
@@ -280,16 +301,18 @@ struct GetCType {
     }                                                          \
   };
 
-#define SUPPORTED_C_TYPES(V) \
-  V(void, kVoid)             \
-  V(bool, kBool)             \
-  V(int32_t, kInt32)         \
-  V(uint32_t, kUint32)       \
-  V(int64_t, kInt64)         \
-  V(uint64_t, kUint64)       \
-  V(float, kFloat32)         \
-  V(double, kFloat64)        \
-  V(ApiObject, kV8Value)
+#define SUPPORTED_C_TYPES(V)                  \
+  V(void, kVoid)                              \
+  V(bool, kBool)                              \
+  V(int32_t, kInt32)                          \
+  V(uint32_t, kUint32)                        \
+  V(int64_t, kInt64)                          \
+  V(uint64_t, kUint64)                        \
+  V(float, kFloat32)                          \
+  V(double, kFloat64)                         \
+  V(ApiObject, kV8Value)                      \
+  V(const FastApiUint8Array&, kUint8Array)    \
+  V(const FastOneByteString&, kOneByteString)
 
 SUPPORTED_C_TYPES(SPECIALIZE_GET_C_TYPE_FOR)
 
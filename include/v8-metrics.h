@@ -5,11 +5,59 @@
 #ifndef V8_METRICS_H_
 #define V8_METRICS_H_
 
+#include <vector>
+
 #include "v8.h"  // NOLINT(build/include_directory)
 
 namespace v8 {
 namespace metrics {
 
+struct GarbageCollectionPhases {
+  int64_t compact_wall_clock_duration_in_us = -1;
+  int64_t mark_wall_clock_duration_in_us = -1;
+  int64_t sweep_wall_clock_duration_in_us = -1;
+  int64_t weak_wall_clock_duration_in_us = -1;
+};
+
+struct GarbageCollectionSizes {
+  int64_t bytes_before = -1;
+  int64_t bytes_after = -1;
+  int64_t bytes_freed = -1;
+};
+
+// A full (mark-compact) garbage collection cycle. |main_thread| covers both
+// the incremental steps and the atomic pause, |total| additionally includes
+// the work done by background threads up to the end of the atomic pause.
+struct GarbageCollectionFullCycle {
+  int reason = -1;
+  GarbageCollectionPhases total;
+  GarbageCollectionPhases main_thread;
+  GarbageCollectionPhases main_thread_atomic;
+  int64_t main_thread_incremental_wall_clock_duration_in_us = -1;
+  GarbageCollectionSizes objects;
+  GarbageCollectionSizes memory;
+};
+
+struct GarbageCollectionFullMainThreadIncrementalMark {
+  int64_t wall_clock_duration_in_us = -1;
+};
+
+// Incremental marking steps are reported in batches, which are flushed when
+// full and at the end of every full garbage collection cycle.
+struct GarbageCollectionFullMainThreadBatchedIncrementalMark {
+  std::vector<GarbageCollectionFullMainThreadIncrementalMark> events;
+};
+
+// A young generation (scavenge or minor mark-compact) garbage collection.
+struct GarbageCollectionYoungCycle {
+  int reason = -1;
+  int64_t total_wall_clock_duration_in_us = -1;
+  int64_t main_thread_wall_clock_duration_in_us = -1;
+  int64_t background_wall_clock_duration_in_us = -1;
+  GarbageCollectionSizes objects;
+  int64_t bytes_promoted = -1;
+};
+
 struct WasmModuleDecoded {
   bool async = false;
   bool streamed = false;
@@ -48,10 +96,13 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
-#define V8_MAIN_THREAD_METRICS_EVENTS(V) \
-  V(WasmModuleDecoded)                   \
-  V(WasmModuleCompiled)                  \
-  V(WasmModuleInstantiated)              \
+#define V8_MAIN_THREAD_METRICS_EVENTS(V)                   \
+  V(GarbageCollectionFullCycle)                            \
+  V(GarbageCollectionFullMainThreadBatchedIncrementalMark) \
+  V(GarbageCollectionYoungCycle)                           \
+  V(WasmModuleDecoded)                                     \
+  V(WasmModuleCompiled)                                    \
+  V(WasmModuleInstantiated)                                \
   V(WasmModuleTieredUp)
 
 #define V8_THREAD_SAFE_METRICS_EVENTS(V) V(WasmModulesPerIsolate)
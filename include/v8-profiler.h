@@ -19,6 +19,7 @@
 namespace v8 {
 
 class HeapGraphNode;
+class OutputStream;
 struct HeapStatsUpdate;
 
 using NativeObject = void*;
@@ -377,6 +378,28 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Starts continuous profiling, which is cheap enough to leave running.
+   * Instead of building a CpuProfile, samples taken at the interval set by
+   * SetSamplingInterval are aggregated by call stack into a table with room
+   * for |max_stacks| distinct stacks. Adding a sample does not allocate;
+   * samples whose stack does not fit are dropped and only counted. This can
+   * be combined with StartProfiling.
+   */
+  CpuProfilingStatus StartContinuousProfiling(size_t max_stacks = 16384);
+
+  /**
+   * Writes the samples aggregated since continuous profiling started, or
+   * since the previous call, to |stream| as an uncompressed pprof profile
+   * (profile.proto) and starts a new aggregation period.
+   */
+  void SerializeContinuousProfile(OutputStream* stream);
+
+  /**
+   * Stops continuous profiling and discards samples not yet serialized.
+   */
+  void StopContinuousProfiling();
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -514,7 +537,8 @@ class V8_EXPORT OutputStream {  // NOLINT
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // Ditto.
   };
 
   /** Returns the root node of the heap graph. */
@@ -564,6 +588,23 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format is cheaper to produce and can be written while the
+   * heap is being traversed. It starts with the four bytes "V8HS" and a
+   * format version, followed by records. Each record is a one-byte tag and
+   * a series of unsigned LEB128 integers:
+   *
+   *   1 string:   id, byte length, UTF-8 bytes
+   *   2 node:     index, type, name string id, id, self size,
+   *               trace node id, detachedness
+   *   3 edge:     type, from node index, to node index,
+   *               name string id or element index
+   *   4 location: node index, script id, line, column
+   *   0 end:      node count, edge count
+   *
+   * A string record precedes the first record that uses it. Edges may
+   * appear before the nodes they connect, and edges of one node are not
+   * necessarily adjacent.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -688,6 +729,12 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * Id of the native context the object was allocated in, as set by
+     * v8::debug::SetContextId, or 0 if the context has none.
+     */
+    int context_id;
   };
 
   /**
@@ -890,6 +937,19 @@ class V8_EXPORT HeapProfiler {
       ObjectNameResolver* global_object_name_resolver = nullptr,
       bool treat_global_objects_as_roots = true);
 
+  /**
+   * Takes a heap snapshot and writes it to |stream| in the
+   * HeapSnapshot::kBinary format while the heap is being traversed. Edges
+   * are not kept in memory, which makes this the preferred way to take
+   * snapshots of large heaps. Data is delivered through
+   * OutputStream::WriteAsciiChunk. The snapshot is not retained. Returns false
+   * if the snapshot was interrupted by |control| or the stream aborted.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream, ActivityControl* control = nullptr,
+      ObjectNameResolver* global_object_name_resolver = nullptr,
+      bool treat_global_objects_as_roots = true);
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
@@ -67,6 +67,7 @@ class NumberObject;
 class Object;
 class ObjectOperationDescriptor;
 class ObjectTemplate;
+class OutputStream;
 class Platform;
 class Primitive;
 class Promise;
@@ -128,6 +129,7 @@ namespace internal {
 enum class ArgumentsType;
 template <ArgumentsType>
 class Arguments;
+class BackgroundDeserializeTask;
 class BasicTracedReferenceExtractor;
 template <typename T>
 class CustomArguments;
@@ -1258,8 +1260,15 @@ class V8_EXPORT EscapableHandleScope : public HandleScope {
    */
   template <class T>
   V8_INLINE Local<T> Escape(Local<T> value) {
-    internal::Address* slot =
-        Escape(reinterpret_cast<internal::Address*>(*value));
+    internal::Address* escape_value =
+        reinterpret_cast<internal::Address*>(*value);
+    // The slot still holds the hole unless Escape was called before, which
+    // the out-of-line version reports.
+    if (V8_LIKELY(escape_value != nullptr && *escape_slot_ == *EscapeHole())) {
+      *escape_slot_ = *escape_value;
+      return Local<T>(reinterpret_cast<T*>(escape_slot_));
+    }
+    internal::Address* slot = Escape(escape_value);
     return Local<T>(reinterpret_cast<T*>(slot));
   }
 
@@ -1279,6 +1288,11 @@ class V8_EXPORT EscapableHandleScope : public HandleScope {
   void operator delete(void*, size_t);
   void operator delete[](void*, size_t);
 
+  V8_INLINE internal::Address* EscapeHole() const {
+    return internal::Internals::GetRoot(
+        GetIsolate(), internal::Internals::kTheHoleValueRootIndex);
+  }
+
   internal::Address* Escape(internal::Address* escape_value);
   internal::Address* escape_slot_;
 };
@@ -1738,6 +1752,8 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&) = delete;
   };
 
+  class ConsumeCodeCacheTask;
+
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
@@ -1746,6 +1762,11 @@ class V8_EXPORT ScriptCompiler {
     // Source takes ownership of CachedData.
     V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
                      CachedData* cached_data = nullptr);
+    // Source takes ownership of CachedData and ConsumeCodeCacheTask. The task
+    // must have been started for |cached_data|.
+    V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
+                     CachedData* cached_data,
+                     ConsumeCodeCacheTask* consume_cache_task);
     V8_INLINE Source(Local<String> source_string,
                      CachedData* cached_data = nullptr);
     V8_INLINE ~Source();
@@ -1778,6 +1799,7 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+    ConsumeCodeCacheTask* consume_cache_task = nullptr;
   };
 
   /**
@@ -1874,6 +1896,27 @@ class V8_EXPORT ScriptCompiler {
     internal::ScriptStreamingData* data_;
   };
 
+  /**
+   * A task which the embedder can run on a background thread to check a code
+   * cache before it is consumed. Compiling with kConsumeCodeCache then only
+   * deserializes the cache on the main thread. Returned by
+   * ScriptCompiler::StartConsumingCodeCache.
+   */
+  class V8_EXPORT ConsumeCodeCacheTask final {
+   public:
+    ~ConsumeCodeCacheTask();
+
+    void Run();
+
+   private:
+    friend class ScriptCompiler;
+
+    explicit ConsumeCodeCacheTask(
+        std::unique_ptr<internal::BackgroundDeserializeTask> impl);
+
+    std::unique_ptr<internal::BackgroundDeserializeTask> impl_;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache,
@@ -1953,6 +1996,14 @@ class V8_EXPORT ScriptCompiler {
   static ScriptStreamingTask* StartStreaming(Isolate* isolate,
                                              StreamedSource* source);
 
+  /**
+   * Returns a task which checks |cached_data| when run on a background
+   * thread. The task doesn't take ownership of |cached_data|, which has to
+   * stay alive until it is compiled from a Source holding both of them.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(
+      Isolate* isolate, const CachedData* cached_data);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -2037,6 +2088,25 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Creates and returns a cache of the preparse data of the functions of the
+   * specified unbound_script that haven't been compiled yet. Unlike a code
+   * cache it does not depend on V8 flags. The CachedData returned by this
+   * function should be owned by the caller.
+   */
+  static CachedData* CreatePreparseDataCache(
+      Local<UnboundScript> unbound_script);
+
+  /**
+   * Gives the functions of the specified unbound_script that were compiled
+   * without preparse data the data recorded for them in cached_data, which
+   * was produced by CreatePreparseDataCache for the same source. They then
+   * skip preparsing their inner functions when compiled. Returns false and
+   * sets cached_data->rejected if cached_data can't be used.
+   */
+  static bool ConsumePreparseDataCache(Local<UnboundScript> unbound_script,
+                                       CachedData* cached_data);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
@@ -2322,6 +2392,18 @@ struct JSEntryStubs {
  */
 class V8_EXPORT JSON {
  public:
+  /**
+   * Options for JSON::Parse.
+   */
+  struct ParseOptions {
+    /**
+     * The maximum number of worker threads that the elements of a large
+     * top-level array may be parsed on, or 0 to allow all of the platform's
+     * worker threads. Other inputs are always parsed on the calling thread.
+     */
+    int max_worker_threads = 0;
+  };
+
   /**
    * Tries to parse the string |json_string| and returns it as value if
    * successful.
@@ -2333,6 +2415,15 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Like Parse above, but in addition allows the elements of a large
+   * top-level array to be parsed in parallel on the platform's worker threads.
+   * The result is the same as without the options.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
+      Local<Context> context, Local<String> json_string,
+      const ParseOptions& options);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -2343,6 +2434,23 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Tries to stringify the JSON-serializable object |json_object| and writes
+   * the result as UTF-8 into |stream| while it is being produced, without
+   * materializing the whole string on the V8 heap. The UTF-8 data is passed
+   * to OutputStream::WriteAsciiChunk in chunks of at most
+   * OutputStream::GetChunkSize() bytes.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream receiving the result.
+   * \return Just(true) if the whole result was written and
+   *   OutputStream::EndOfStream was called, Just(false) if the stream aborted
+   *   writing, and Nothing if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 /**
@@ -2384,6 +2492,25 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
+
+    /**
+     * Called when the ValueSerializer is going to copy the contents of an
+     * ArrayBuffer that is neither shared nor marked with TransferArrayBuffer.
+     * The embedder can avoid the copy, e.g. for large buffers, by taking over
+     * the backing store and writing a transfer ID to |transfer_id|. The
+     * embedder is then responsible for detaching the ArrayBuffer once
+     * serialization is done, and for
+     * passing an ArrayBuffer with that backing store to
+     * ValueDeserializer::TransferArrayBuffer with the same ID.
+     *
+     * Returns Just(false) if the contents should be copied. If the object
+     * cannot be serialized, an exception should be thrown and Nothing<bool>()
+     * returned.
+     */
+    virtual Maybe<bool> GetArrayBufferTransferId(
+        Isolate* isolate, Local<ArrayBuffer> array_buffer,
+        uint32_t* transfer_id);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -3318,6 +3445,18 @@ class V8_EXPORT String : public Name {
   static Local<String> Concat(Isolate* isolate, Local<String> left,
                               Local<String> right);
 
+  /**
+   * Creates a string from the |length| characters of |string| starting at
+   * |start|. Unless the substring is very short, it shares the characters of
+   * |string| instead of copying them. This way many strings can be created
+   * over one external string, e.g. header values over the buffer of a whole
+   * request, with a single resource that is disposed once neither |string|
+   * nor any substring sharing its characters is alive. Returns an empty
+   * handle if the range is not within |string|.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewSubString(
+      Isolate* isolate, Local<String> string, int start, int length);
+
   /**
    * Creates a new external string using the data defined in the given
    * resource. When the external string is no longer live on V8's heap the
@@ -3817,6 +3956,31 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets the properties named |keys[0]| to |keys[count - 1]| and stores them
+   * in |values|, which must have room for |count| elements. The handles are
+   * created in the current HandleScope. Equivalent to calling Get() for each
+   * key in order, but own data properties of ordinary objects are read
+   * without a full property lookup. Internalized string keys are fastest.
+   * Returns Just(true) or Empty() if a getter threw, in which case the
+   * contents of |values| are unspecified.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetMultiple(Local<Context> context,
+                                                const Local<Name>* keys,
+                                                size_t count,
+                                                Local<Value>* values);
+
+  /**
+   * Sets the properties named |keys[0]| to |keys[count - 1]| to the
+   * corresponding |values|. Equivalent to calling Set() for each key in order,
+   * with the same fast path as GetMultiple() for writable own data
+   * properties. Returns Just(true) or Empty() if a setter threw.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> SetMultiple(Local<Context> context,
+                                                const Local<Name>* keys,
+                                                const Local<Value>* values,
+                                                size_t count);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -4615,6 +4779,13 @@ class V8_EXPORT Function : public Object {
    */
   int ScriptId() const;
 
+  /**
+   * Returns how many times optimized code of this function was thrown away
+   * after an eager or soft deoptimization. Saturates at 255. Returns 0 if the
+   * function has not collected feedback yet.
+   */
+  int GetDeoptimizationCount() const;
+
   /**
    * Returns the original function if this function is bound, else returns
    * v8::Undefined.
@@ -4723,6 +4894,34 @@ class V8_EXPORT Promise : public Object {
    */
   void MarkAsHandled();
 
+  /**
+   * Callback for OnSettled() and CallAsync(). |state| is kFulfilled or
+   * kRejected, and |result| the fulfillment value or rejection reason.
+   */
+  using SettledCallback = void (*)(Local<Context> context, PromiseState state,
+                                   Local<Value> result, void* data);
+
+  /**
+   * Registers |callback| to be called with |data| once the promise settles.
+   * Unlike Then(), no derived promise is created. If the promise is already
+   * settled, the callback is called synchronously instead of at the end of
+   * turn. Otherwise it runs as part of the promise's reaction jobs. Marks the
+   * promise as handled.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> OnSettled(Local<Context> context,
+                                              SettledCallback callback,
+                                              void* data);
+
+  /**
+   * Calls |function| like Function::Call() and registers |callback| with
+   * OnSettled() on the returned promise. A non-promise return value is passed
+   * to |callback| right away as fulfillment value. Returns Nothing if the call
+   * throws, in which case |callback| is not called.
+   */
+  V8_WARN_UNUSED_RESULT static Maybe<bool> CallAsync(
+      Local<Context> context, Local<Function> function, Local<Value> recv,
+      int argc, Local<Value> argv[], SettledCallback callback, void* data);
+
   V8_INLINE static Promise* Cast(Value* obj);
 
   static const int kEmbedderFieldCount = V8_PROMISE_INTERNAL_FIELD_COUNT;
@@ -5106,6 +5305,20 @@ class V8_EXPORT BackingStore : public v8::internal::BackingStoreBase {
       v8::Isolate* isolate, std::unique_ptr<BackingStore> backing_store,
       size_t byte_length);
 
+  /**
+   * Grows a backing store created by ArrayBuffer::NewGrowableBackingStore to
+   * byte_length bytes without moving it, so Data() does not change and the
+   * new bytes are zero. Returns false if byte_length is smaller than
+   * ByteLength() or larger than the maximum the backing store was created
+   * with, if memory cannot be committed, or if the backing store is not
+   * growable.
+   *
+   * ArrayBuffers created from the backing store keep the length they were
+   * created with. Pass the backing store to ArrayBuffer::New again to get an
+   * ArrayBuffer covering the new length.
+   */
+  bool GrowInPlace(size_t byte_length);
+
   /**
    * This callback is used only if the memory block for a BackingStore cannot be
    * allocated with an ArrayBuffer::Allocator. In such cases the destructor of
@@ -5330,6 +5543,18 @@ class V8_EXPORT ArrayBuffer : public Object {
       void* data, size_t byte_length, v8::BackingStore::DeleterCallback deleter,
       void* deleter_data);
 
+  /**
+   * Returns a new standalone BackingStore of byte_length zeroed bytes that
+   * can grow in place up to max_byte_length bytes with
+   * BackingStore::GrowInPlace. Address space for max_byte_length is reserved
+   * up front, and memory is only committed as the backing store grows. The
+   * result can be later passed to ArrayBuffer::New.
+   *
+   * Returns an empty unique_ptr if the address space cannot be reserved.
+   */
+  static std::unique_ptr<BackingStore> NewGrowableBackingStore(
+      Isolate* isolate, size_t byte_length, size_t max_byte_length);
+
   /**
    * Returns true if ArrayBuffer is externalized, that is, does not
    * own its memory block.
@@ -7512,6 +7737,20 @@ class V8_EXPORT MicrotaskQueue {
    */
   virtual void PerformCheckpoint(Isolate* isolate) = 0;
 
+  /**
+   * Like PerformCheckpoint, but stops once |max_count| microtasks ran or
+   * |deadline_in_seconds| has passed, whichever comes first. The deadline is
+   * compared against Platform::MonotonicallyIncreasingTime and is checked
+   * every few microtasks, so a single long-running microtask is not
+   * interrupted. Microtasks completed callbacks are only triggered once the
+   * queue is empty.
+   *
+   * Returns true if the queue is empty afterwards. Otherwise the embedder
+   * should call it again, e.g. after handling pending I/O.
+   */
+  virtual bool PerformBoundedCheckpoint(Isolate* isolate, int max_count,
+                                        double deadline_in_seconds) = 0;
+
   /**
    * Returns true if a microtask is running on this MicrotaskQueue instance.
    */
@@ -7688,6 +7927,16 @@ typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
                                         size_t initial_heap_limit);
 
+/**
+ * This callback is invoked when a context exceeds the allocation budget set
+ * with Isolate::SetContextAllocationBudget. |allocated_bytes| is the number of
+ * bytes allocated while the context was the current context since the budget
+ * was set.
+ */
+typedef void (*ContextAllocationBudgetCallback)(Local<Context> context,
+                                                size_t allocated_bytes,
+                                                void* data);
+
 /**
  * Collection of shared per-process V8 memory information.
  *
@@ -7804,12 +8053,79 @@ class V8_EXPORT HeapCodeStatistics {
   HeapCodeStatistics();
   size_t code_and_metadata_size() { return code_and_metadata_size_; }
   size_t bytecode_and_metadata_size() { return bytecode_and_metadata_size_; }
+  /**
+   * The size of the bytecodes alone, without their constant pools, handler
+   * tables and source position tables.
+   */
+  size_t bytecode_size() { return bytecode_size_; }
   size_t external_script_source_size() { return external_script_source_size_; }
+  size_t flushed_bytecode_size() { return flushed_bytecode_size_; }
+  size_t number_of_flushed_functions() { return number_of_flushed_functions_; }
+  size_t number_of_recompiled_flushed_functions() {
+    return number_of_recompiled_flushed_functions_;
+  }
 
  private:
   size_t code_and_metadata_size_;
   size_t bytecode_and_metadata_size_;
+  size_t bytecode_size_;
   size_t external_script_source_size_;
+  size_t flushed_bytecode_size_;
+  size_t number_of_flushed_functions_;
+  size_t number_of_recompiled_flushed_functions_;
+
+  friend class Isolate;
+};
+
+/**
+ * Statistics of the isolate's cache of compiled scripts, which is shared by
+ * all of its contexts.
+ *
+ * Instances of this class can be passed to
+ * v8::Isolate::GetCompilationCacheStatistics.
+ */
+class V8_EXPORT CompilationCacheStatistics {
+ public:
+  CompilationCacheStatistics();
+  size_t number_of_scripts() { return number_of_scripts_; }
+  size_t script_hits() { return script_hits_; }
+  size_t script_misses() { return script_misses_; }
+  size_t script_evictions() { return script_evictions_; }
+
+ private:
+  size_t number_of_scripts_;
+  size_t script_hits_;
+  size_t script_misses_;
+  size_t script_evictions_;
+
+  friend class Isolate;
+};
+
+/**
+ * Estimated pause times of upcoming garbage collection work in milliseconds,
+ * based on the speeds measured during previous garbage collections.
+ *
+ * Instances of this class can be passed to
+ * v8::Isolate::GetGarbageCollectionCostEstimate.
+ */
+class V8_EXPORT GarbageCollectionCostEstimate {
+ public:
+  GarbageCollectionCostEstimate();
+  // The next young generation garbage collection.
+  double scavenge_in_ms() { return scavenge_in_ms_; }
+  // The next incremental marking step. 0 if incremental marking is not
+  // running.
+  double incremental_marking_step_in_ms() {
+    return incremental_marking_step_in_ms_;
+  }
+  // The atomic pause finalizing incremental marking. 0 if incremental marking
+  // is not running.
+  double marking_finalization_in_ms() { return marking_finalization_in_ms_; }
+
+ private:
+  double scavenge_in_ms_;
+  double incremental_marking_step_in_ms_;
+  double marking_finalization_in_ms_;
 
   friend class Isolate;
 };
@@ -8827,6 +9143,54 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Limits the number of scripts kept in the compilation cache, which lets
+   * Script::Compile calls in any context of the isolate reuse the result of
+   * an earlier compilation of the same source and origin. When the cache is
+   * full, the script that has gone the longest without being run is evicted.
+   * A limit of 0, the default, means no limit.
+   *
+   * By default scripts are also evicted once their bytecode is old. If
+   * |evict_old_scripts| is false, only the limit evicts them.
+   */
+  void SetCompilationCacheLimits(int max_scripts,
+                                 bool evict_old_scripts = true);
+
+  /**
+   * Get statistics about the compilation cache of scripts.
+   */
+  void GetCompilationCacheStatistics(CompilationCacheStatistics* statistics);
+
+  /**
+   * Get the estimated cost of the next garbage collection operations, e.g.
+   * to schedule them in idle periods between tasks.
+   */
+  void GetGarbageCollectionCostEstimate(
+      GarbageCollectionCostEstimate* estimate);
+
+  /**
+   * Finalizes incremental marking with a full garbage collection if
+   * incremental marking is running and the estimated pause fits into
+   * |time_budget_in_ms|. Returns true if a garbage collection was performed.
+   */
+  bool FinalizeIncrementalMarkingIfFits(double time_budget_in_ms);
+
+  /**
+   * Enables or disables accounting of the thread CPU time this isolate's
+   * thread spends in each StateTag (JS execution, GC, parsing, compiling,
+   * etc.). Accounting is cheap but not free, since every VM state
+   * transition reads the thread CPU clock. Has no effect on platforms
+   * without a thread CPU clock.
+   */
+  void SetCpuTimeAccountingEnabled(bool enabled);
+
+  /**
+   * Returns the thread CPU time in microseconds spent in |state| while CPU
+   * time accounting was enabled, including the time spent in the current
+   * state so far. Concurrent work on background threads is not included.
+   */
+  int64_t GetCpuTimeInMicroseconds(StateTag state);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -9353,6 +9717,15 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Optional notification to tell V8 how to trade memory for fewer young
+   * generation garbage collections when the new space is sized dynamically
+   * (--dynamic-new-space-sizing). |trade_off| is clamped to [0, 1], where 0
+   * keeps the new space as small as possible and 1 targets scavenges twice
+   * as rarely as the default of 0.5.
+   */
+  void SetNewSpaceSizingTradeOff(double trade_off);
+
   /**
    * Optional notification to tell V8 the current isolate is used for debugging
    * and requires higher heap limit.
@@ -9464,6 +9837,21 @@ class V8_EXPORT Isolate {
    */
   void AddNearHeapLimitCallback(NearHeapLimitCallback callback, void* data);
 
+  /**
+   * Sets the allocation budget of |context|. V8 accounts the bytes allocated
+   * while |context| is the current context and invokes the callback set with
+   * SetContextAllocationBudgetCallback once at a safe point after the budget is
+   * exceeded, e.g. to terminate the tenant that owns the context. Setting a
+   * budget resets the accounted bytes. A budget of 0 stops the accounting.
+   */
+  void SetContextAllocationBudget(Local<Context> context, size_t budget);
+
+  /**
+   * Sets the callback to invoke when a context exceeds its allocation budget.
+   */
+  void SetContextAllocationBudgetCallback(
+      ContextAllocationBudgetCallback callback, void* data);
+
   /**
    * Remove the given callback and restore the heap limit to the
    * given limit. If the given limit is zero, then it is ignored.
@@ -11465,6 +11853,13 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       host_defined_options(origin.HostDefinedOptions()),
       cached_data(data) {}
 
+ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
+                               CachedData* data,
+                               ConsumeCodeCacheTask* consume_cache_task)
+    : Source(string, origin, data) {
+  this->consume_cache_task = consume_cache_task;
+}
+
 ScriptCompiler::Source::Source(Local<String> string,
                                CachedData* data)
     : source_string(string), cached_data(data) {}
@@ -11472,6 +11867,7 @@ ScriptCompiler::Source::Source(Local<String> string,
 
 ScriptCompiler::Source::~Source() {
   delete cached_data;
+  delete consume_cache_task;
 }
 
 
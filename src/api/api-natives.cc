@@ -355,6 +355,10 @@ void UncacheTemplateInstantiation(Isolate* isolate,
   }
 }
 
+// Cached instances of templates with at least this many properties are
+// configured in dictionary mode.
+const int kBulkInstallationThreshold = 8;
+
 bool IsSimpleInstantiation(Isolate* isolate, ObjectTemplateInfo info,
                            JSReceiver new_target) {
   DisallowHeapAllocation no_gc;
@@ -416,7 +420,19 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
       JSObject::New(constructor, new_target, Handle<AllocationSite>::null()),
       JSObject);
 
-  if (is_prototype) JSObject::OptimizeAsPrototype(object);
+  if (is_prototype) {
+    JSObject::OptimizeAsPrototype(object);
+  } else if (serial_number &&
+             serial_number <=
+                 TemplateInfo::kSlowTemplateInstantiationsCacheSize &&
+             info->number_of_properties() >= kBulkInstallationThreshold) {
+    // The instance is cached and copied below, so its properties can be
+    // added in dictionary mode and turned into a single fast map by
+    // MigrateSlowToFast, instead of creating a map transition per property.
+    JSObject::NormalizeProperties(isolate, object, KEEP_INOBJECT_PROPERTIES,
+                                  info->number_of_properties(),
+                                  "ApiNatives::InstantiateObject");
+  }
 
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, result, ConfigureInstance(isolate, object, info), JSObject);
@@ -8,6 +8,7 @@
 #include <cmath>      // For isnan.
 #include <limits>
 #include <string>
+#include <unordered_map>
 #include <utility>  // For move
 #include <vector>
 
@@ -20,12 +21,14 @@
 #include "src/api/api-natives.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/builtins/builtins-utils.h"
+#include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/cpu-features.h"
 #include "src/common/assert-scope.h"
@@ -35,6 +38,7 @@
 #include "src/date/date.h"
 #include "src/debug/debug-coverage.h"
 #include "src/debug/debug-evaluate.h"
+#include "src/debug/debug-inline-cache-stats.h"
 #include "src/debug/debug-type-profile.h"
 #include "src/debug/debug.h"
 #include "src/debug/liveedit.h"
@@ -57,6 +61,7 @@
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
+#include "src/json/json-parallel-parser.h"
 #include "src/json/json-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters.h"
@@ -65,8 +70,10 @@
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/contexts.h"
+#include "src/objects/descriptor-array-inl.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/frame-array-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
@@ -80,6 +87,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/oddball.h"
 #include "src/objects/ordered-hash-table-inl.h"
+#include "src/objects/promise-inl.h"
 #include "src/objects/property-descriptor.h"
 #include "src/objects/property-details.h"
 #include "src/objects/property.h"
@@ -93,6 +101,7 @@
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/pending-compilation-error-handler.h"
+#include "src/parsing/preparse-data-cache.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/profiler/cpu-profiler.h"
 #include "src/profiler/heap-profiler.h"
@@ -106,10 +115,13 @@
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
+#include "src/strings/string-builder-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/utils/allocation.h"
 #include "src/utils/detachable-vector.h"
 #include "src/utils/version.h"
 #include "src/wasm/streaming-decoder.h"
@@ -541,9 +553,30 @@ void V8::SetSnapshotDataBlob(StartupData* snapshot_blob) {
 
 namespace {
 
+// Allocations of at least kPageAllocationThreshold bytes are served from the
+// page allocator when --array-buffer-pool-size is set. Fresh pages come
+// zeroed from the OS, so they are only touched once they are used, and freed
+// pages are kept in a pool of that size to be handed out again.
 class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
  public:
+  ArrayBufferAllocator()
+      : pool_limit_(i::FLAG_array_buffer_pool_size * i::MB) {}
+
+  ~ArrayBufferAllocator() override {
+    for (auto& size_and_pages : pool_) {
+      for (void* data : size_and_pages.second) {
+        FreePages(data, size_and_pages.first);
+      }
+    }
+  }
+
   void* Allocate(size_t length) override {
+    if (IsPageAllocated(length)) {
+      void* data = TakeFromPool(length);
+      if (data == nullptr) return AllocatePages(length);
+      memset(data, 0, length);
+      return data;
+    }
 #if V8_OS_AIX && _LINUX_SOURCE_COMPAT
     // Work around for GCC bug on AIX
     // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=79839
@@ -555,6 +588,11 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
   }
 
   void* AllocateUninitialized(size_t length) override {
+    if (IsPageAllocated(length)) {
+      void* data = TakeFromPool(length);
+      if (data == nullptr) return AllocatePages(length);
+      return data;
+    }
 #if V8_OS_AIX && _LINUX_SOURCE_COMPAT
     // Work around for GCC bug on AIX
     // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=79839
@@ -565,9 +603,22 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
     return data;
   }
 
-  void Free(void* data, size_t) override { free(data); }
+  void Free(void* data, size_t length) override {
+    if (IsPageAllocated(length)) {
+      ReturnToPool(data, length);
+      return;
+    }
+    free(data);
+  }
 
   void* Reallocate(void* data, size_t old_length, size_t new_length) override {
+    if (IsPageAllocated(old_length) || IsPageAllocated(new_length)) {
+      void* new_data = Allocate(new_length);
+      if (new_data == nullptr) return nullptr;
+      memcpy(new_data, data, std::min(old_length, new_length));
+      Free(data, old_length);
+      return new_data;
+    }
 #if V8_OS_AIX && _LINUX_SOURCE_COMPAT
     // Work around for GCC bug on AIX
     // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=79839
@@ -581,6 +632,60 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
     }
     return new_data;
   }
+
+ private:
+  static constexpr size_t kPageAllocationThreshold = 64 * i::KB;
+
+  bool IsPageAllocated(size_t length) const {
+    return pool_limit_ > 0 && length >= kPageAllocationThreshold;
+  }
+
+  static size_t PageAllocatedSize(size_t length) {
+    return RoundUp(length, i::GetPlatformPageAllocator()->AllocatePageSize());
+  }
+
+  static void* AllocatePages(size_t length) {
+    v8::PageAllocator* page_allocator = i::GetPlatformPageAllocator();
+    return i::AllocatePages(page_allocator, nullptr, PageAllocatedSize(length),
+                            page_allocator->AllocatePageSize(),
+                            PageAllocator::kReadWrite);
+  }
+
+  static void FreePages(void* data, size_t size) {
+    CHECK(i::FreePages(i::GetPlatformPageAllocator(), data, size));
+  }
+
+  void* TakeFromPool(size_t length) {
+    size_t size = PageAllocatedSize(length);
+    base::MutexGuard guard(&pool_mutex_);
+    auto it = pool_.find(size);
+    if (it == pool_.end() || it->second.empty()) return nullptr;
+    void* data = it->second.back();
+    it->second.pop_back();
+    pooled_bytes_ -= size;
+    return data;
+  }
+
+  // Backing stores may be freed on a background thread, so the pool is
+  // guarded by a mutex.
+  void ReturnToPool(void* data, size_t length) {
+    size_t size = PageAllocatedSize(length);
+    {
+      base::MutexGuard guard(&pool_mutex_);
+      if (pooled_bytes_ + size <= pool_limit_) {
+        pool_[size].push_back(data);
+        pooled_bytes_ += size;
+        return;
+      }
+    }
+    FreePages(data, size);
+  }
+
+  const size_t pool_limit_;
+  base::Mutex pool_mutex_;
+  // Pooled allocations keyed by their size in pages.
+  std::unordered_map<size_t, std::vector<void*>> pool_;
+  size_t pooled_bytes_ = 0;
 };
 
 struct SnapshotCreatorData {
@@ -2453,9 +2558,18 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   i::ScriptData* script_data = nullptr;
   if (options == kConsumeCodeCache) {
     DCHECK(source->cached_data);
-    // ScriptData takes care of pointer-aligning the data.
-    script_data = new i::ScriptData(source->cached_data->data,
-                                    source->cached_data->length);
+    if (source->consume_cache_task) {
+      // The task has checked the cached data on a background thread if it
+      // ran.
+      DCHECK_EQ(source->consume_cache_task->impl_->data(),
+                source->cached_data->data);
+      script_data = source->consume_cache_task->impl_->ReleaseScriptData();
+    }
+    if (script_data == nullptr) {
+      // ScriptData takes care of pointer-aligning the data.
+      script_data = new i::ScriptData(source->cached_data->data,
+                                      source->cached_data->length);
+    }
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -2631,6 +2745,21 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
 
 void ScriptCompiler::ScriptStreamingTask::Run() { data_->task->Run(); }
 
+ScriptCompiler::ConsumeCodeCacheTask::ConsumeCodeCacheTask(
+    std::unique_ptr<i::BackgroundDeserializeTask> impl)
+    : impl_(std::move(impl)) {}
+
+ScriptCompiler::ConsumeCodeCacheTask::~ConsumeCodeCacheTask() = default;
+
+void ScriptCompiler::ConsumeCodeCacheTask::Run() { impl_->Run(); }
+
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    Isolate* v8_isolate, const CachedData* cached_data) {
+  return new ScriptCompiler::ConsumeCodeCacheTask(
+      std::make_unique<i::BackgroundDeserializeTask>(cached_data->data,
+                                                     cached_data->length));
+}
+
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
     Isolate* v8_isolate, StreamedSource* source, CompileOptions options) {
   // We don't support other compile options on streaming background compiles.
@@ -2718,6 +2847,29 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
   return i::CodeSerializer::Serialize(shared);
 }
 
+ScriptCompiler::CachedData* ScriptCompiler::CreatePreparseDataCache(
+    Local<UnboundScript> unbound_script) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  DCHECK(shared->is_toplevel());
+  i::Isolate* isolate = shared->GetIsolate();
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  return i::PreparseDataCache::Serialize(isolate, script);
+}
+
+bool ScriptCompiler::ConsumePreparseDataCache(
+    Local<UnboundScript> unbound_script, CachedData* cached_data) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  DCHECK(shared->is_toplevel());
+  i::Isolate* isolate = shared->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  return i::PreparseDataCache::Deserialize(isolate, script, cached_data);
+}
+
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
                                    ScriptOrigin* origin) {
   if (origin) {
@@ -3115,6 +3267,28 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+MaybeLocal<Value> JSON::Parse(Local<Context> context,
+                              Local<String> json_string,
+                              const ParseOptions& options) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  i::Handle<i::String> string = Utils::OpenHandle(*json_string);
+  i::Handle<i::Object> result;
+  if (i::JsonParallelParser::TryParse(isolate, string,
+                                      options.max_worker_threads)
+          .ToHandle(&result)) {
+    RETURN_ESCAPED(Utils::ToLocal(result));
+  }
+  // Also reports the syntax errors the parallel parser found.
+  i::Handle<i::String> source = i::String::Flatten(isolate, string);
+  i::Handle<i::Object> undefined = isolate->factory()->undefined_value();
+  auto maybe = source->IsOneByteRepresentation()
+                   ? i::JsonParser<uint8_t>::Parse(isolate, source, undefined)
+                   : i::JsonParser<uint16_t>::Parse(isolate, source, undefined);
+  has_pending_exception = !maybe.ToHandle(&result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(Utils::ToLocal(result));
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3135,6 +3309,126 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+
+// Encodes the parts produced by the JSON stringifier as UTF-8 and forwards
+// them to an embedder-provided OutputStream in chunks.
+class OutputStreamJsonSink final : public i::IncrementalStringBuilderSink {
+ public:
+  OutputStreamJsonSink(i::Isolate* isolate, OutputStream* stream)
+      : isolate_(isolate),
+        stream_(stream),
+        chunk_size_(std::max(stream->GetChunkSize(),
+                             static_cast<int>(unibrow::Utf8::kMaxEncodedSize))),
+        chunk_(new char[chunk_size_]) {}
+
+  void WritePart(i::Handle<i::String> part) override {
+    if (aborted_) return;
+    part = i::String::Flatten(isolate_, part);
+    i::DisallowHeapAllocation no_gc;
+    i::String::FlatContent content = part->GetFlatContent(no_gc);
+    if (content.IsOneByte()) {
+      WriteChars(content.ToOneByteVector());
+    } else {
+      WriteChars(content.ToUC16Vector());
+    }
+  }
+
+  // Returns false if the stream aborted writing.
+  bool Finish() {
+    if (!aborted_ && lead_surrogate_ != kNoLeadSurrogate) {
+      EncodeCodeUnit(lead_surrogate_);
+      lead_surrogate_ = kNoLeadSurrogate;
+    }
+    if (!aborted_ && position_ > 0) Flush();
+    if (aborted_) return false;
+    stream_->EndOfStream();
+    return true;
+  }
+
+ private:
+  static const int kNoLeadSurrogate = -1;
+
+  template <typename Char>
+  void WriteChars(i::Vector<const Char> chars) {
+    for (Char c : chars) {
+      if (aborted_) return;
+      if (sizeof(Char) == 1) {
+        EncodeCodeUnit(c);
+        continue;
+      }
+      // Surrogate pairs may be split across parts.
+      if (lead_surrogate_ != kNoLeadSurrogate) {
+        int lead = lead_surrogate_;
+        lead_surrogate_ = kNoLeadSurrogate;
+        if (unibrow::Utf16::IsTrailSurrogate(c)) {
+          EncodeCodeUnit(unibrow::Utf16::CombineSurrogatePair(lead, c));
+          continue;
+        }
+        EncodeCodeUnit(lead);
+      }
+      if (unibrow::Utf16::IsLeadSurrogate(c)) {
+        lead_surrogate_ = c;
+      } else {
+        EncodeCodeUnit(c);
+      }
+    }
+  }
+
+  void EncodeCodeUnit(unibrow::uchar c) {
+    if (chunk_size_ - position_ <
+        static_cast<int>(unibrow::Utf8::kMaxEncodedSize)) {
+      Flush();
+      if (aborted_) return;
+    }
+    position_ += unibrow::Utf8::Encode(chunk_.get() + position_, c,
+                                       unibrow::Utf16::kNoPreviousCharacter,
+                                       false);
+  }
+
+  void Flush() {
+    if (stream_->WriteAsciiChunk(chunk_.get(), position_) ==
+        OutputStream::kAbort) {
+      aborted_ = true;
+    }
+    position_ = 0;
+  }
+
+  i::Isolate* const isolate_;
+  OutputStream* const stream_;
+  const int chunk_size_;
+  std::unique_ptr<char[]> chunk_;
+  int position_ = 0;
+  int lead_surrogate_ = kNoLeadSurrogate;
+  bool aborted_ = false;
+};
+
+}  // namespace
+
+Maybe<bool> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                            OutputStream* stream, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, Stringify, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  OutputStreamJsonSink sink(isolate, stream);
+  i::Handle<i::Object> maybe;
+  has_pending_exception =
+      !i::JsonStringifyToSink(isolate, object, replacer, gap_string, &sink)
+           .ToHandle(&maybe);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  if (maybe->IsUndefined(isolate)) {
+    // Match the string returning version, which stringifies the undefined
+    // result.
+    sink.WritePart(isolate->factory()->undefined_string());
+  }
+  return Just(sink.Finish());
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3160,6 +3454,12 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<bool> ValueSerializer::Delegate::GetArrayBufferTransferId(
+    Isolate* v8_isolate, Local<ArrayBuffer> array_buffer,
+    uint32_t* transfer_id) {
+  return Just(false);
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3835,6 +4135,12 @@ std::unique_ptr<v8::BackingStore> v8::BackingStore::Reallocate(
   return backing_store;
 }
 
+bool v8::BackingStore::GrowInPlace(size_t byte_length) {
+  i::BackingStore* i_backing_store = reinterpret_cast<i::BackingStore*>(this);
+  if (!i_backing_store->is_growable()) return false;
+  return i_backing_store->GrowInPlace(byte_length);
+}
+
 // static
 void v8::BackingStore::EmptyDeleter(void* data, size_t length,
                                     void* deleter_data) {
@@ -4325,6 +4631,105 @@ MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
   RETURN_ESCAPED(Utils::ToLocal(result));
 }
 
+namespace {
+
+// Used with ENTER_V8 by API methods that return handles in the caller's
+// HandleScope.
+class NoHandleScope {
+ public:
+  explicit NoHandleScope(i::Isolate*) {}
+};
+
+// Looks up |name| among the own fast properties of an ordinary object and
+// returns true if it is stored in a field. The lookup goes through the
+// isolate's DescriptorLookupCache, so batches on objects of the same shape
+// don't search the descriptors again.
+bool FindOwnDataField(i::Isolate* isolate, i::JSReceiver receiver,
+                      i::Name name, i::InternalIndex* descriptor,
+                      i::PropertyDetails* details) {
+  if (!name.IsUniqueName()) return false;
+  i::Map map = receiver.map();
+  if (!map.IsJSObjectMap() || map.IsSpecialReceiverMap() ||
+      map.is_dictionary_map()) {
+    return false;
+  }
+  i::DescriptorArray descriptors = map.instance_descriptors(kRelaxedLoad);
+  *descriptor = descriptors.SearchWithCache(isolate, name, map);
+  if (descriptor->is_not_found()) return false;
+  *details = descriptors.GetDetails(*descriptor);
+  return details->location() == i::kField && details->kind() == i::kData;
+}
+
+// Whether |value| can be written to the field without a map transition.
+bool CanStoreToField(i::Map map, i::PropertyDetails details, i::Object value) {
+  if (map.is_deprecated() || details.IsReadOnly() ||
+      details.constness() != i::PropertyConstness::kMutable) {
+    return false;
+  }
+  i::Representation representation = details.representation();
+  return representation.IsTagged() ||
+         (representation.IsSmi() && value.IsSmi()) ||
+         (representation.IsDouble() && value.IsNumber());
+}
+
+}  // namespace
+
+Maybe<bool> v8::Object::GetMultiple(Local<Context> context,
+                                    const Local<Name>* keys, size_t count,
+                                    Local<Value>* values) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Object, GetMultiple, Nothing<bool>(),
+           NoHandleScope);
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < count; i++) {
+    i::Handle<i::Name> key_obj = Utils::OpenHandle(*keys[i]);
+    i::InternalIndex descriptor = i::InternalIndex::NotFound();
+    i::PropertyDetails details = i::PropertyDetails::Empty();
+    if (FindOwnDataField(isolate, *self, *key_obj, &descriptor, &details)) {
+      values[i] = Utils::ToLocal(i::JSObject::FastPropertyAt(
+          i::Handle<i::JSObject>::cast(self), details.representation(),
+          i::FieldIndex::ForDescriptor(self->map(), descriptor)));
+      continue;
+    }
+    i::HandleScope scope(isolate);
+    i::Handle<i::Object> result;
+    has_pending_exception =
+        !i::Runtime::GetObjectProperty(isolate, self, key_obj)
+             .ToHandle(&result);
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    values[i] = Utils::ToLocal(scope.CloseAndEscape(result));
+  }
+  return Just(true);
+}
+
+Maybe<bool> v8::Object::SetMultiple(Local<Context> context,
+                                    const Local<Name>* keys,
+                                    const Local<Value>* values, size_t count) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Object, SetMultiple, Nothing<bool>(),
+           i::HandleScope);
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < count; i++) {
+    i::Handle<i::Name> key_obj = Utils::OpenHandle(*keys[i]);
+    i::Handle<i::Object> value_obj = Utils::OpenHandle(*values[i]);
+    i::InternalIndex descriptor = i::InternalIndex::NotFound();
+    i::PropertyDetails details = i::PropertyDetails::Empty();
+    if (FindOwnDataField(isolate, *self, *key_obj, &descriptor, &details) &&
+        CanStoreToField(self->map(), details, *value_obj)) {
+      i::JSObject::cast(*self).WriteToField(descriptor, details, *value_obj);
+      continue;
+    }
+    i::HandleScope scope(isolate);
+    has_pending_exception =
+        i::Runtime::SetObjectProperty(isolate, self, key_obj, value_obj,
+                                      i::StoreOrigin::kNamed,
+                                      Just(i::ShouldThrow::kDontThrow))
+            .is_null();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  }
+  return Just(true);
+}
+
 MaybeLocal<Value> v8::Object::GetPrivate(Local<Context> context,
                                          Local<Private> key) {
   return Get(context, Local<Value>(reinterpret_cast<Value*>(*key)));
@@ -5115,6 +5520,14 @@ int Function::ScriptId() const {
   return script->id();
 }
 
+int Function::GetDeoptimizationCount() const {
+  auto self = Utils::OpenHandle(this);
+  if (!self->IsJSFunction()) return 0;
+  auto func = i::Handle<i::JSFunction>::cast(self);
+  if (!func->has_feedback_vector()) return 0;
+  return func->feedback_vector().deopt_count();
+}
+
 Local<v8::Value> Function::GetBoundFunction() const {
   auto self = Utils::OpenHandle(this);
   if (self->IsJSBoundFunction()) {
@@ -5330,21 +5743,25 @@ static int WriteUtf8Impl(i::Vector<const Char> string, char* write_start,
     }
     // Write the characters to the stream.
     if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
+      while (read_index < up_to) {
+        // Simply memcpy runs of ASCII characters, which are found a word at a
+        // time. The run may end early at a word containing non-ASCII.
+        int copy_length = i::NonAsciiStart(
+            reinterpret_cast<const uint8_t*>(read_start + read_index),
+            up_to - read_index);
         memcpy(current_write, read_start + read_index, copy_length);
         current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
+        read_index += copy_length;
+        if (read_index == up_to) break;
+        // Encode at least one character, and all non-ASCII ones following it.
+        do {
           current_write += unibrow::Utf8::EncodeOneByte(
               current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
-        }
+          read_index++;
+        } while (read_index < up_to &&
+                 read_start[read_index] > unibrow::Utf8::kMaxOneByteChar);
+        DCHECK(write_capacity == -1 ||
+               (current_write - write_start) <= write_capacity);
       }
     } else {
       for (; read_index < up_to; read_index++) {
@@ -5863,7 +6280,22 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
       bytecode_and_metadata_size_(0),
-      external_script_source_size_(0) {}
+      bytecode_size_(0),
+      external_script_source_size_(0),
+      flushed_bytecode_size_(0),
+      number_of_flushed_functions_(0),
+      number_of_recompiled_flushed_functions_(0) {}
+
+CompilationCacheStatistics::CompilationCacheStatistics()
+    : number_of_scripts_(0),
+      script_hits_(0),
+      script_misses_(0),
+      script_evictions_(0) {}
+
+GarbageCollectionCostEstimate::GarbageCollectionCostEstimate()
+    : scavenge_in_ms_(0),
+      incremental_marking_step_in_ms_(0),
+      marking_finalization_in_ms_(0) {}
 
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
@@ -6482,6 +6914,21 @@ Local<String> v8::String::Concat(Isolate* v8_isolate, Local<String> left,
   return Utils::ToLocal(result);
 }
 
+MaybeLocal<String> v8::String::NewSubString(Isolate* v8_isolate,
+                                            Local<String> string, int start,
+                                            int length) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::Handle<i::String> str = Utils::OpenHandle(*string);
+  if (start < 0 || length < 0 || start > str->length() - length) {
+    return MaybeLocal<String>();
+  }
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  LOG_API(isolate, String, NewSubString);
+  i::Handle<i::String> result =
+      isolate->factory()->NewSubString(str, start, start + length);
+  return Utils::ToLocal(result);
+}
+
 MaybeLocal<String> v8::String::NewExternalTwoByte(
     Isolate* isolate, v8::String::ExternalStringResource* resource) {
   CHECK(resource && resource->data());
@@ -7285,6 +7732,90 @@ void Promise::MarkAsHandled() {
   js_promise->set_has_handler(true);
 }
 
+namespace {
+
+// Reaction handler for Promise::OnSettled, used for both outcomes. Its data is
+// an array holding the callback, the callback data and the promise, whose
+// state tells the outcome.
+void PromiseSettledHandler(const FunctionCallbackInfo<Value>& info) {
+  Local<Context> context = info.GetIsolate()->GetCurrentContext();
+  Local<Array> data = info.Data().As<Array>();
+  auto callback = reinterpret_cast<Promise::SettledCallback>(
+      data->Get(context, 0).ToLocalChecked().As<External>()->Value());
+  void* callback_data =
+      data->Get(context, 1).ToLocalChecked().As<External>()->Value();
+  Local<Promise> promise = data->Get(context, 2).ToLocalChecked().As<Promise>();
+  callback(context, promise->State(), info[0], callback_data);
+}
+
+}  // namespace
+
+Maybe<bool> Promise::OnSettled(Local<Context> context,
+                               SettledCallback callback, void* data) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Promise, OnSettled, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::JSPromise> promise = Utils::OpenHandle(this);
+
+  if (promise->status() != kPending) {
+    // Skip the microtask round trip for settled promises.
+    if (promise->status() == kRejected && !promise->has_handler()) {
+      isolate->ReportPromiseReject(promise, i::Handle<i::Object>(),
+                                   v8::kPromiseHandlerAddedAfterReject);
+    }
+    promise->set_has_handler(true);
+    i::Handle<i::Object> result(promise->result(), isolate);
+    callback(context, promise->status(), Utils::ToLocal(result), data);
+    return Just(true);
+  }
+
+  v8::Isolate* v8_isolate = context->GetIsolate();
+  Local<Value> elements[] = {
+      External::New(v8_isolate, reinterpret_cast<void*>(callback)),
+      External::New(v8_isolate, data), Utils::PromiseToLocal(promise)};
+  Local<Function> handler;
+  has_pending_exception =
+      !Function::New(context, PromiseSettledHandler,
+                     Array::New(v8_isolate, elements, arraysize(elements)), 1,
+                     ConstructorBehavior::kThrow)
+           .ToLocal(&handler);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+
+  // Record the reaction directly, like await does, so that no derived promise
+  // is allocated.
+  i::Handle<i::PromiseReaction> reaction =
+      i::Handle<i::PromiseReaction>::cast(
+          isolate->factory()->NewStruct(i::PROMISE_REACTION_TYPE));
+  i::Handle<i::JSReceiver> handler_obj = Utils::OpenHandle(*handler);
+  reaction->set_next(promise->reactions());
+  reaction->set_fulfill_handler(*handler_obj);
+  reaction->set_reject_handler(*handler_obj);
+  reaction->set_promise_or_capability(
+      i::ReadOnlyRoots(isolate).undefined_value());
+  reaction->set_continuation_preserved_embedder_data(
+      isolate->native_context()->continuation_preserved_embedder_data());
+  promise->set_reactions_or_result(*reaction);
+  promise->set_has_handler(true);
+  return Just(true);
+}
+
+Maybe<bool> Promise::CallAsync(Local<Context> context,
+                               Local<Function> function, Local<Value> recv,
+                               int argc, Local<Value> argv[],
+                               SettledCallback callback, void* data) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  LOG_API(isolate, Promise, CallAsync);
+  Local<Value> result;
+  if (!function->Call(context, recv, argc, argv).ToLocal(&result)) {
+    return Nothing<bool>();
+  }
+  if (result->IsPromise()) {
+    return result.As<Promise>()->OnSettled(context, callback, data);
+  }
+  callback(context, kFulfilled, result, data);
+  return Just(true);
+}
+
 Local<Value> Proxy::GetTarget() {
   i::Handle<i::JSProxy> self = Utils::OpenHandle(this);
   i::Handle<i::Object> target(self->target(), self->GetIsolate());
@@ -7660,6 +8191,19 @@ std::unique_ptr<v8::BackingStore> v8::ArrayBuffer::NewBackingStore(
       static_cast<v8::BackingStore*>(backing_store.release()));
 }
 
+std::unique_ptr<v8::BackingStore> v8::ArrayBuffer::NewGrowableBackingStore(
+    Isolate* isolate, size_t byte_length, size_t max_byte_length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, ArrayBuffer, NewGrowableBackingStore);
+  CHECK_LE(byte_length, max_byte_length);
+  CHECK_LE(max_byte_length, i::JSArrayBuffer::kMaxByteLength);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  std::unique_ptr<i::BackingStoreBase> backing_store =
+      i::BackingStore::AllocateGrowable(byte_length, max_byte_length);
+  return std::unique_ptr<v8::BackingStore>(
+      static_cast<v8::BackingStore*>(backing_store.release()));
+}
+
 Local<ArrayBuffer> v8::ArrayBufferView::Buffer() {
   i::Handle<i::JSArrayBufferView> obj = Utils::OpenHandle(this);
   i::Handle<i::JSArrayBuffer> buffer;
@@ -8694,11 +9238,64 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   code_statistics->code_and_metadata_size_ = isolate->code_and_metadata_size();
   code_statistics->bytecode_and_metadata_size_ =
       isolate->bytecode_and_metadata_size();
+  code_statistics->bytecode_size_ = isolate->bytecode_size();
   code_statistics->external_script_source_size_ =
       isolate->external_script_source_size();
+  code_statistics->flushed_bytecode_size_ =
+      isolate->heap()->flushed_bytecode_size();
+  code_statistics->number_of_flushed_functions_ =
+      isolate->heap()->flushed_functions();
+  code_statistics->number_of_recompiled_flushed_functions_ =
+      isolate->heap()->recompiled_flushed_functions();
   return true;
 }
 
+void Isolate::SetCompilationCacheLimits(int max_scripts,
+                                        bool evict_old_scripts) {
+  Utils::ApiCheck(max_scripts >= 0, "v8::Isolate::SetCompilationCacheLimits",
+                  "max_scripts must not be negative");
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  isolate->compilation_cache()->SetScriptLimits(max_scripts, evict_old_scripts);
+}
+
+void Isolate::GetCompilationCacheStatistics(
+    CompilationCacheStatistics* statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::CompilationCache* cache = isolate->compilation_cache();
+  statistics->number_of_scripts_ = cache->NumberOfScripts();
+  statistics->script_hits_ = cache->script_hits();
+  statistics->script_misses_ = cache->script_misses();
+  statistics->script_evictions_ = cache->script_evictions();
+}
+
+void Isolate::GetGarbageCollectionCostEstimate(
+    GarbageCollectionCostEstimate* estimate) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = isolate->heap();
+  estimate->scavenge_in_ms_ = heap->EstimateScavengeTime();
+  estimate->incremental_marking_step_in_ms_ =
+      heap->EstimateIncrementalMarkingStepTime();
+  estimate->marking_finalization_in_ms_ =
+      heap->EstimateMarkingFinalizationTime();
+}
+
+bool Isolate::FinalizeIncrementalMarkingIfFits(double time_budget_in_ms) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->heap()->FinalizeIncrementalMarkingIfFits(time_budget_in_ms);
+}
+
+void Isolate::SetCpuTimeAccountingEnabled(bool enabled) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->SetCpuTimeAccountingEnabled(enabled);
+}
+
+int64_t Isolate::GetCpuTimeInMicroseconds(StateTag state) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->GetCpuTimeForVMState(state).InMicroseconds();
+}
+
 v8::MaybeLocal<v8::Promise> Isolate::MeasureMemory(
     v8::Local<v8::Context> context, MeasureMemoryMode mode) {
   return v8::MaybeLocal<v8::Promise>();
@@ -8977,6 +9574,11 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetNewSpaceSizingTradeOff(double trade_off) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetNewSpaceSizingTradeOff(trade_off);
+}
+
 void Isolate::IncreaseHeapLimitForDebugging() {
   // No-op.
 }
@@ -9099,6 +9701,21 @@ void Isolate::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   isolate->heap()->AddNearHeapLimitCallback(callback, data);
 }
 
+void Isolate::SetContextAllocationBudget(Local<Context> context,
+                                         size_t budget) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Handle<i::NativeContext> native_context =
+      handle(Utils::OpenHandle(*context)->native_context(), isolate);
+  isolate->heap()->context_allocation_tracker()->SetBudget(native_context,
+                                                           budget);
+}
+
+void Isolate::SetContextAllocationBudgetCallback(
+    ContextAllocationBudgetCallback callback, void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->context_allocation_tracker()->SetCallback(callback, data);
+}
+
 void Isolate::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
                                           size_t heap_limit) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10454,6 +11071,90 @@ debug::TypeProfile::ScriptData debug::TypeProfile::GetScriptData(
   return ScriptData(i, type_profile_);
 }
 
+int debug::InlineCacheStats::FunctionData::StartOffset() const {
+  return function_->info->StartPosition();
+}
+
+int debug::InlineCacheStats::FunctionData::EndOffset() const {
+  return function_->info->EndPosition();
+}
+
+MaybeLocal<String> debug::InlineCacheStats::FunctionData::Name() const {
+  i::Isolate* isolate = function_->info->GetIsolate();
+  return ToApiHandle<String>(
+      i::handle(function_->info->DebugName(), isolate));
+}
+
+int debug::InlineCacheStats::FunctionData::InvocationCount() const {
+  return function_->invocation_count;
+}
+
+const debug::InlineCacheStats::Counts&
+debug::InlineCacheStats::FunctionData::GetCounts() const {
+  return function_->counts;
+}
+
+debug::InlineCacheStats::ScriptData::ScriptData(
+    size_t index, std::shared_ptr<i::InlineCacheStats> stats)
+    : script_(&stats->scripts.at(index)), stats_(std::move(stats)) {}
+
+Local<debug::Script> debug::InlineCacheStats::ScriptData::GetScript() const {
+  return ToApiHandle<debug::Script>(script_->script);
+}
+
+size_t debug::InlineCacheStats::ScriptData::FunctionCount() const {
+  return script_->functions.size();
+}
+
+debug::InlineCacheStats::FunctionData
+debug::InlineCacheStats::ScriptData::GetFunctionData(size_t i) const {
+  return FunctionData(&script_->functions.at(i), stats_);
+}
+
+Local<debug::Script> debug::InlineCacheStats::Site::GetScript() const {
+  return ToApiHandle<debug::Script>(
+      stats_->scripts.at(site_->script_index).script);
+}
+
+debug::InlineCacheStats::FunctionData
+debug::InlineCacheStats::Site::GetFunctionData() const {
+  return FunctionData(&stats_->scripts.at(site_->script_index)
+                           .functions.at(site_->function_index),
+                      stats_);
+}
+
+int debug::InlineCacheStats::Site::SlotIndex() const {
+  return site_->slot.ToInt();
+}
+
+const char* debug::InlineCacheStats::Site::Kind() const {
+  return i::FeedbackMetadata::Kind2String(site_->kind);
+}
+
+debug::InlineCacheStats debug::InlineCacheStats::Collect(
+    Isolate* isolate, size_t max_megamorphic_sites) {
+  return InlineCacheStats(i::InlineCacheStats::Collect(
+      reinterpret_cast<i::Isolate*>(isolate), max_megamorphic_sites));
+}
+
+size_t debug::InlineCacheStats::ScriptCount() const {
+  return stats_->scripts.size();
+}
+
+debug::InlineCacheStats::ScriptData debug::InlineCacheStats::GetScriptData(
+    size_t i) const {
+  return ScriptData(i, stats_);
+}
+
+size_t debug::InlineCacheStats::MegamorphicSiteCount() const {
+  return stats_->megamorphic_sites.size();
+}
+
+debug::InlineCacheStats::Site debug::InlineCacheStats::GetMegamorphicSite(
+    size_t i) const {
+  return Site(&stats_->megamorphic_sites.at(i), stats_);
+}
+
 v8::MaybeLocal<v8::Value> debug::WeakMap::Get(v8::Local<v8::Context> context,
                                               v8::Local<v8::Value> key) {
   PREPARE_FOR_EXECUTION(context, WeakMap, Get, Value);
@@ -10768,6 +11469,24 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenHandle(*title)));
 }
 
+CpuProfilingStatus CpuProfiler::StartContinuousProfiling(size_t max_stacks) {
+  Utils::ApiCheck(max_stacks > 0, "v8::CpuProfiler::StartContinuousProfiling",
+                  "max_stacks must be positive");
+  return reinterpret_cast<i::CpuProfiler*>(this)->StartContinuousProfiling(
+      max_stacks);
+}
+
+void CpuProfiler::SerializeContinuousProfile(OutputStream* stream) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0,
+                  "v8::CpuProfiler::SerializeContinuousProfile",
+                  "Invalid stream chunk size");
+  reinterpret_cast<i::CpuProfiler*>(this)->SerializeContinuousProfile(stream);
+}
+
+void CpuProfiler::StopContinuousProfiling() {
+  reinterpret_cast<i::CpuProfiler*>(this)->StopContinuousProfiling();
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* isolate) {
   reinterpret_cast<i::Isolate*>(isolate)
       ->set_detailed_source_positions_for_profiling(true);
@@ -10955,10 +11674,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(stream);
+    serializer.Serialize(ToInternal(this));
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11004,6 +11729,16 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
           control, resolver, treat_global_objects_as_roots));
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(
+    OutputStream* stream, ActivityControl* control,
+    ObjectNameResolver* resolver, bool treat_global_objects_as_roots) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0,
+                  "v8::HeapProfiler::TakeHeapSnapshotToStream",
+                  "Invalid stream chunk size");
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      stream, control, resolver, treat_global_objects_as_roots);
+}
+
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
       track_allocations);
@@ -11205,7 +11940,16 @@ const size_t HandleScopeImplementer::kEnteredContextsOffset =
 const size_t HandleScopeImplementer::kIsMicrotaskContextOffset =
     offsetof(HandleScopeImplementer, is_microtask_context_);
 
-void HandleScopeImplementer::FreeThreadResources() { Free(); }
+void HandleScopeImplementer::FreeThreadResources() {
+  DCHECK(blocks_.empty());
+  DCHECK(entered_contexts_.empty());
+  DCHECK(is_microtask_context_.empty());
+  DCHECK(saved_contexts_.empty());
+  DCHECK(isolate_->thread_local_top()->CallDepthIsZero());
+  // The spare blocks and the backing stores aren't tied to the thread, so keep
+  // them for the next thread that locks the isolate. This makes handing the
+  // isolate over between top-level Lockers allocation-free.
+}
 
 char* HandleScopeImplementer::ArchiveThread(char* storage) {
   HandleScopeData* current = isolate_->handle_scope_data();
@@ -11223,6 +11967,9 @@ int HandleScopeImplementer::ArchiveSpacePerThread() {
 }
 
 char* HandleScopeImplementer::RestoreThread(char* storage) {
+  // Drop whatever the previous thread left behind in FreeThreadResources; the
+  // archived state brings its own.
+  Free();
   MemCopy(this, storage, sizeof(*this));
   *isolate_->handle_scope_data() = handle_scope_data_;
   return storage + ArchiveSpacePerThread();
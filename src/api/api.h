@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/heap/factory.h"
 #include "src/objects/bigint.h"
 #include "src/objects/contexts.h"
@@ -332,11 +333,9 @@ class HandleScopeImplementer {
   };
 
   explicit HandleScopeImplementer(Isolate* isolate)
-      : isolate_(isolate),
-        spare_(nullptr),
-        last_handle_before_deferred_block_(nullptr) {}
+      : isolate_(isolate), last_handle_before_deferred_block_(nullptr) {}
 
-  ~HandleScopeImplementer() { DeleteArray(spare_); }
+  ~HandleScopeImplementer() { DeleteSpareBlocks(); }
 
   // Threading support for handle data.
   static int ArchiveSpacePerThread();
@@ -371,11 +370,10 @@ class HandleScopeImplementer {
   inline DetachableVector<Address*>* blocks() { return &blocks_; }
   Isolate* isolate() const { return isolate_; }
 
-  void ReturnBlock(Address* block) {
-    DCHECK_NOT_NULL(block);
-    if (spare_ != nullptr) DeleteArray(spare_);
-    spare_ = block;
-  }
+  // Keeps |block| for reuse, unless --handle-block-retention blocks are
+  // already kept.
+  inline void ReturnBlock(Address* block);
+  size_t spare_block_count() const { return spare_blocks_.size(); }
 
   static const size_t kEnteredContextsOffset;
   static const size_t kIsMicrotaskContextOffset;
@@ -386,7 +384,7 @@ class HandleScopeImplementer {
     entered_contexts_.detach();
     is_microtask_context_.detach();
     saved_contexts_.detach();
-    spare_ = nullptr;
+    spare_blocks_.detach();
     last_handle_before_deferred_block_ = nullptr;
   }
 
@@ -400,11 +398,15 @@ class HandleScopeImplementer {
     entered_contexts_.free();
     is_microtask_context_.free();
     saved_contexts_.free();
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-      spare_ = nullptr;
+    DeleteSpareBlocks();
+    spare_blocks_.free();
+  }
+
+  void DeleteSpareBlocks() {
+    while (!spare_blocks_.empty()) {
+      DeleteArray(spare_blocks_.back());
+      spare_blocks_.pop_back();
     }
-    DCHECK(isolate_->thread_local_top()->CallDepthIsZero());
   }
 
   void BeginDeferredScope();
@@ -423,7 +425,9 @@ class HandleScopeImplementer {
 
   // Used as a stack to keep track of saved contexts.
   DetachableVector<Context> saved_contexts_;
-  Address* spare_;
+  // Unused blocks, kept so that scopes repeatedly growing past a block
+  // boundary don't allocate.
+  DetachableVector<Address*> spare_blocks_;
   Address* last_handle_before_deferred_block_;
   // This is only used for threading support.
   HandleScopeData handle_scope_data_;
@@ -479,13 +483,23 @@ void HandleScopeImplementer::EnterMicrotaskContext(Context context) {
 
 // If there's a spare block, use it for growing the current scope.
 internal::Address* HandleScopeImplementer::GetSpareOrNewBlock() {
-  internal::Address* block =
-      (spare_ != nullptr) ? spare_
-                          : NewArray<internal::Address>(kHandleBlockSize);
-  spare_ = nullptr;
+  if (spare_blocks_.empty()) {
+    return NewArray<internal::Address>(kHandleBlockSize);
+  }
+  internal::Address* block = spare_blocks_.back();
+  spare_blocks_.pop_back();
   return block;
 }
 
+void HandleScopeImplementer::ReturnBlock(internal::Address* block) {
+  DCHECK_NOT_NULL(block);
+  if (static_cast<int>(spare_blocks_.size()) >= FLAG_handle_block_retention) {
+    DeleteArray(block);
+    return;
+  }
+  spare_blocks_.push_back(block);
+}
+
 void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
   while (!blocks_.empty()) {
     internal::Address* block_start = blocks_.back();
@@ -508,10 +522,7 @@ void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
 #ifdef ENABLE_HANDLE_ZAPPING
     internal::HandleScope::ZapRange(block_start, block_limit);
 #endif
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-    }
-    spare_ = block_start;
+    ReturnBlock(block_start);
   }
   DCHECK((blocks_.empty() && prev_limit == nullptr) ||
          (!blocks_.empty() && prev_limit != nullptr));
@@ -425,6 +425,7 @@ CPU::CPU()
       is_atom_(false),
       has_osxsave_(false),
       has_avx_(false),
+      has_avx2_(false),
       has_fma3_(false),
       has_bmi1_(false),
       has_bmi2_(false),
@@ -437,6 +438,7 @@ CPU::CPU()
       has_vfp3_(false),
       has_vfp3_d32_(false),
       has_jscvt_(false),
+      has_lse_(false),
       is_fp64_mode_(false),
       has_non_stop_time_stamp_counter_(false),
       has_msa_(false) {
@@ -508,6 +510,7 @@ CPU::CPU()
   if (num_ids >= 7) {
     __cpuid(cpu_info, 7);
     has_bmi1_ = (cpu_info[1] & 0x00000008) != 0;
+    has_avx2_ = (cpu_info[1] & 0x00000020) != 0;
     has_bmi2_ = (cpu_info[1] & 0x00000100) != 0;
   }
 
@@ -718,17 +721,42 @@ CPU::CPU()
   has_non_stop_time_stamp_counter_ = true;
 
 #elif V8_OS_LINUX
+  CPUInfo cpu_info;
+
   // Try to extract the list of CPU features from ELF hwcaps.
   uint32_t hwcaps = ReadELFHWCaps();
   if (hwcaps != 0) {
     has_jscvt_ = (hwcaps & HWCAP_JSCVT) != 0;
+    has_lse_ = (hwcaps & HWCAP_ATOMICS) != 0;
   } else {
     // Try to fallback to "Features" CPUInfo field
-    CPUInfo cpu_info;
     char* features = cpu_info.ExtractField("Features");
     has_jscvt_ = HasListItem(features, "jscvt");
+    has_lse_ = HasListItem(features, "atomics");
     delete[] features;
   }
+
+  // Extract implementer and part number of the first core, which is enough
+  // to pick a latency model for the code generator.
+  char* implementer = cpu_info.ExtractField("CPU implementer");
+  if (implementer != nullptr) {
+    char* end;
+    implementer_ = strtol(implementer, &end, 0);
+    if (end == implementer) {
+      implementer_ = 0;
+    }
+    delete[] implementer;
+  }
+
+  char* part = cpu_info.ExtractField("CPU part");
+  if (part != nullptr) {
+    char* end;
+    part_ = strtol(part, &end, 0);
+    if (end == part) {
+      part_ = 0;
+    }
+    delete[] part;
+  }
 #endif  // V8_OS_WIN
 
 #elif V8_HOST_ARCH_PPC || V8_HOST_ARCH_PPC64
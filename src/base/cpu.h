@@ -59,6 +59,8 @@ class V8_BASE_EXPORT CPU final {
   static const int ARM_CORTEX_A9 = 0xc09;
   static const int ARM_CORTEX_A12 = 0xc0c;
   static const int ARM_CORTEX_A15 = 0xc0f;
+  static const int ARM_CORTEX_A53 = 0xd03;
+  static const int ARM_CORTEX_A55 = 0xd05;
 
   // Denver-specific part code
   static const int NVIDIA_DENVER_V10 = 0x002;
@@ -93,6 +95,7 @@ class V8_BASE_EXPORT CPU final {
   bool has_sse42() const { return has_sse42_; }
   bool has_osxsave() const { return has_osxsave_; }
   bool has_avx() const { return has_avx_; }
+  bool has_avx2() const { return has_avx2_; }
   bool has_fma3() const { return has_fma3_; }
   bool has_bmi1() const { return has_bmi1_; }
   bool has_bmi2() const { return has_bmi2_; }
@@ -111,6 +114,7 @@ class V8_BASE_EXPORT CPU final {
   bool has_vfp3() const { return has_vfp3_; }
   bool has_vfp3_d32() const { return has_vfp3_d32_; }
   bool has_jscvt() const { return has_jscvt_; }
+  bool has_lse() const { return has_lse_; }
 
   // mips features
   bool is_fp64_mode() const { return is_fp64_mode_; }
@@ -143,6 +147,7 @@ class V8_BASE_EXPORT CPU final {
   bool is_atom_;
   bool has_osxsave_;
   bool has_avx_;
+  bool has_avx2_;
   bool has_fma3_;
   bool has_bmi1_;
   bool has_bmi2_;
@@ -155,6 +160,7 @@ class V8_BASE_EXPORT CPU final {
   bool has_vfp3_;
   bool has_vfp3_d32_;
   bool has_jscvt_;
+  bool has_lse_;
   bool is_fp64_mode_;
   bool has_non_stop_time_stamp_counter_;
   bool has_msa_;
@@ -495,5 +495,7 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 }  // namespace base
 }  // namespace v8
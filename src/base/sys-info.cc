@@ -18,6 +18,8 @@
 #include <sys/sysctl.h>
 #endif
 
+#include <stdio.h>
+
 #include <limits>
 
 #include "src/base/logging.h"
@@ -29,6 +31,31 @@
 namespace v8 {
 namespace base {
 
+namespace {
+
+#if V8_OS_LINUX
+// Returns the memory limit of the cgroup the process runs in, or 0 if there is
+// none. Containers usually mount their own cgroup at /sys/fs/cgroup, with the
+// unified hierarchy (cgroup v2) or a separate memory controller (cgroup v1).
+int64_t CgroupMemoryLimit() {
+  static const char* const kLimitFiles[] = {
+      "/sys/fs/cgroup/memory.max",
+      "/sys/fs/cgroup/memory/memory.limit_in_bytes"};
+  for (const char* path : kLimitFiles) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) continue;
+    long long limit = 0;  // NOLINT(runtime/int)
+    // cgroup v2 reports "max" if there is no limit, which doesn't parse.
+    int matched = fscanf(file, "%lld", &limit);
+    fclose(file);
+    return matched == 1 && limit > 0 ? static_cast<int64_t>(limit) : 0;
+  }
+  return 0;
+}
+#endif
+
+}  // namespace
+
 // static
 int SysInfo::NumberOfProcessors() {
 #if V8_OS_OPENBSD
@@ -96,7 +123,14 @@ int64_t SysInfo::AmountOfPhysicalMemory() {
   if (pages == -1 || page_size == -1) {
     return 0;
   }
-  return static_cast<int64_t>(pages) * page_size;
+  int64_t result = static_cast<int64_t>(pages) * page_size;
+#if V8_OS_LINUX
+  // cgroup v1 reports a huge number if there is no limit, so only ever lower
+  // the result.
+  int64_t cgroup_limit = CgroupMemoryLimit();
+  if (cgroup_limit > 0 && cgroup_limit < result) result = cgroup_limit;
+#endif
+  return result;
 #endif
 }
 
@@ -18,7 +18,9 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
-  // Returns the number of bytes of physical memory on the current machine.
+  // Returns the number of bytes of physical memory on the current machine. On
+  // Linux, this is capped by the memory limit of the process's cgroup, so that
+  // heap limits derived from it fit into the container.
   static int64_t AmountOfPhysicalMemory();
 
   // Returns the number of bytes of virtual memory of this process. A return
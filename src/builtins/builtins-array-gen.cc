@@ -447,6 +447,30 @@ TF_BUILTIN(ExtractFastJSArray, ArrayBuiltinsAssembler) {
   Return(ExtractFastJSArray(context, array, begin, count));
 }
 
+void ArrayBuiltinsAssembler::MakeElementsCopyOnWriteForClone(
+    TNode<JSArray> array, bool packed_only) {
+  Label done(this);
+  TNode<Int32T> kind = LoadElementsKind(array);
+  if (packed_only) {
+    // Holes get converted to undefined, which copies the elements anyway.
+    GotoIfNot(IsElementsKindLessThanOrEqual(kind, PACKED_ELEMENTS), &done);
+    GotoIf(IsHoleyFastElementsKind(kind), &done);
+  } else {
+    GotoIfNot(IsElementsKindLessThanOrEqual(kind, HOLEY_ELEMENTS), &done);
+  }
+  TNode<FixedArrayBase> elements = LoadElements(array);
+  GotoIfNot(IsFixedArrayMap(LoadMap(elements)), &done);
+  GotoIf(IntPtrLessThan(LoadAndUntagFixedArrayBaseLength(elements),
+                        IntPtrConstant(JSArray::kMinCopyOnWriteCloneLength)),
+         &done);
+  // Both maps describe the same layout, and every store to Smi or object
+  // elements checks for the copy-on-write map first.
+  StoreMapNoWriteBarrier(elements, RootIndex::kFixedCOWArrayMap);
+  Goto(&done);
+
+  BIND(&done);
+}
+
 TF_BUILTIN(CloneFastJSArray, ArrayBuiltinsAssembler) {
   auto context = Parameter<Context>(Descriptor::kContext);
   auto array = Parameter<JSArray>(Descriptor::kSource);
@@ -456,6 +480,7 @@ TF_BUILTIN(CloneFastJSArray, ArrayBuiltinsAssembler) {
                           LoadElementsKind(array))),
                       Word32BinaryNot(IsNoElementsProtectorCellInvalid())));
 
+  MakeElementsCopyOnWriteForClone(array, false);
   Return(CloneFastJSArray(context, array));
 }
 
@@ -475,6 +500,7 @@ TF_BUILTIN(CloneFastJSArrayFillingHoles, ArrayBuiltinsAssembler) {
                           LoadElementsKind(array))),
                       Word32BinaryNot(IsNoElementsProtectorCellInvalid())));
 
+  MakeElementsCopyOnWriteForClone(array, true);
   Return(CloneFastJSArray(context, array, base::nullopt,
                           HoleConversionMode::kConvertToUndefined));
 }
@@ -585,6 +611,43 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
     Return(value);
     BIND(&done);
   }
+
+  // Searches with fewer remaining elements than this stay in generated code,
+  // longer ones call into the vectorized C++ searches in src/objects/simd.h.
+  static constexpr int kVectorizedSearchThreshold = 16;
+
+  void GotoIfShortSearch(TNode<IntPtrT> array_length, TNode<IntPtrT> from_index,
+                         Label* if_short) {
+    GotoIf(IntPtrLessThan(IntPtrSub(array_length, from_index),
+                          IntPtrConstant(kVectorizedSearchThreshold)),
+           if_short);
+  }
+
+  // Calls {search_function} and converts the index it returns to the result
+  // of {variant}.
+  TNode<Object> CallVectorizedSearch(SearchVariant variant,
+                                     ExternalReference search_function,
+                                     TNode<FixedArrayBase> elements,
+                                     TNode<IntPtrT> array_length,
+                                     TNode<IntPtrT> from_index,
+                                     TNode<Object> search_element) {
+    STATIC_ASSERT(FixedArray::kHeaderSize == FixedDoubleArray::kHeaderSize);
+    TNode<RawPtrT> elements_start =
+        RawPtrAdd(ReinterpretCast<RawPtrT>(BitcastTaggedToWord(elements)),
+                  IntPtrConstant(FixedArray::kHeaderSize - kHeapObjectTag));
+    TNode<IntPtrT> result = UncheckedCast<IntPtrT>(CallCFunction(
+        ExternalConstant(search_function), MachineType::IntPtr(),
+        std::make_pair(MachineType::Pointer(), elements_start),
+        std::make_pair(MachineType::UintPtr(), array_length),
+        std::make_pair(MachineType::UintPtr(), from_index),
+        std::make_pair(MachineType::IntPtr(),
+                       BitcastTaggedToWord(search_element))));
+    if (variant == kIncludes) {
+      return SelectBooleanConstant(
+          IntPtrGreaterThanOrEqual(result, IntPtrConstant(0)));
+    }
+    return SmiTag(result);
+  }
 };
 
 void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
@@ -655,7 +718,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   GotoIf(IntPtrGreaterThanOrEqual(index_var.value(), array_length_untagged),
          &return_not_found);
 
-  Label if_smiorobjects(this), if_packed_doubles(this), if_holey_doubles(this);
+  Label if_smis(this), if_smiorobjects(this), if_packed_doubles(this),
+      if_holey_doubles(this);
 
   TNode<Int32T> elements_kind = LoadElementsKind(array);
   TNode<FixedArrayBase> elements = LoadElements(array);
@@ -663,6 +727,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   STATIC_ASSERT(HOLEY_SMI_ELEMENTS == 1);
   STATIC_ASSERT(PACKED_ELEMENTS == 2);
   STATIC_ASSERT(HOLEY_ELEMENTS == 3);
+  GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_SMI_ELEMENTS),
+         &if_smis);
   GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_ELEMENTS),
          &if_smiorobjects);
   GotoIf(
@@ -675,6 +741,19 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
          &if_smiorobjects);
   Goto(&return_not_found);
 
+  BIND(&if_smis);
+  {
+    // Smi arrays contain only Smis and holes, so a Smi is found by comparing
+    // tagged values. Searching for anything else, or searching only a few
+    // elements, is left to the generic loop.
+    GotoIfNot(TaggedIsSmi(search_element), &if_smiorobjects);
+    GotoIfShortSearch(array_length_untagged, index_var.value(),
+                      &if_smiorobjects);
+    args.PopAndReturn(CallVectorizedSearch(
+        variant, ExternalReference::array_indexof_includes_smi_or_object(),
+        elements, array_length_untagged, index_var.value(), search_element));
+  }
+
   BIND(&if_smiorobjects);
   {
     Callable callable =
@@ -913,22 +992,40 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      hole_loop(this, &index_var), search_notnan(this), search(this),
+      return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&search);
 
   BIND(&search_notnan);
   GotoIfNot(IsHeapNumber(CAST(search_element)), &return_not_found);
 
   search_num = LoadHeapNumberValue(CAST(search_element));
 
-  Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  // Array.p.indexOf uses strict equality, where NaN is never found.
+  if (variant == kIndexOf) {
+    BranchIfFloat64IsNaN(search_num.value(), &return_not_found, &search);
+  } else {
+    Goto(&search);
+  }
+
+  BIND(&search);
+  {
+    Label scalar_search(this);
+    GotoIfShortSearch(array_length_untagged, index_var.value(),
+                      &scalar_search);
+    Return(CallVectorizedSearch(
+        variant, ExternalReference::array_indexof_includes_double(), elements,
+        array_length_untagged, index_var.value(), search_element));
+
+    BIND(&scalar_search);
+    Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
+    BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  }
 
   BIND(&not_nan_loop);
   {
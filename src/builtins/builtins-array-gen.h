@@ -96,6 +96,12 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
                                           AllocationSiteOverrideMode mode);
   void GenerateArraySingleArgumentConstructor(ElementsKind kind,
                                               AllocationSiteOverrideMode mode);
+  // Turns the backing store of a large Smi or object {array} into a
+  // copy-on-write FixedArray, so that cloning it shares the backing store and
+  // the first write to either array copies it.
+  void MakeElementsCopyOnWriteForClone(TNode<JSArray> array,
+                                       bool packed_only);
+
   void GenerateArrayNArgumentsConstructor(
       TNode<Context> context, TNode<JSFunction> target,
       TNode<Object> new_target, TNode<Int32T> argc,
@@ -187,6 +187,50 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOptimized(
                      on_resolve, on_reject, var_throwaway.value());
 }
 
+TNode<Object> AsyncBuiltinsAssembler::AwaitPrimitive(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<Object> value, TNode<SharedFunctionInfo> on_resolve_sfi) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+
+  static const int kResolveClosureOffset =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  static const int kTotalSize =
+      kResolveClosureOffset + JSFunction::kSizeWithoutPrototype;
+
+  // 2. Let promise be ? PromiseResolve(« promise »).
+  // We skip this step, because {value} is not a thenable, so the promise
+  // would be fulfilled with {value} right away and nothing observes it.
+  // The reject closure is skipped as well, since it would never be called.
+
+  TNode<HeapObject> base = AllocateInNewSpace(kTotalSize);
+  TNode<Context> closure_context = UncheckedCast<Context>(base);
+  {
+    // Initialize the await context, storing the {generator} as extension.
+    TNode<Map> map = CAST(
+        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+    StoreMapNoWriteBarrier(closure_context, map);
+    StoreObjectFieldNoWriteBarrier(
+        closure_context, Context::kLengthOffset,
+        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+    const TNode<Object> empty_scope_info =
+        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+    StoreContextElementNoWriteBarrier(
+        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
+    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                      native_context);
+    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                      generator);
+  }
+
+  // Initialize resolve handler
+  TNode<HeapObject> on_resolve = InnerAllocate(base, kResolveClosureOffset);
+  InitializeNativeClosure(closure_context, native_context, on_resolve,
+                          on_resolve_sfi);
+
+  return CallBuiltin(Builtins::kPerformPromiseThenOnFulfilledValue,
+                     native_context, value, on_resolve);
+}
+
 TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<Context> context, TNode<JSGeneratorObject> generator,
     TNode<Object> value, TNode<JSPromise> outer_promise,
@@ -194,17 +238,20 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Oddball> is_predicted_as_caught) {
   TVARIABLE(Object, result);
-  Label if_old(this), if_new(this), done(this),
+  Label if_old(this), if_new(this), if_primitive(this), done(this),
       if_slow_constructor(this, Label::kDeferred);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
   // intrinsics %Promise% constructor as its "constructor", we don't need
   // to allocate the wrapper promise and can just use the `AwaitOptimized`
-  // logic.
-  GotoIf(TaggedIsSmi(value), &if_old);
+  // logic. If {value} is not an object, it can't be a thenable and the
+  // wrapper promise would only pass it on, so `AwaitPrimitive` doesn't
+  // allocate one either.
+  GotoIf(TaggedIsSmi(value), &if_primitive);
   TNode<HeapObject> value_object = CAST(value);
   const TNode<Map> value_map = LoadMap(value_object);
+  GotoIfNot(IsJSReceiverMap(value_map), &if_primitive);
   GotoIfNot(IsJSPromiseMap(value_map), &if_old);
   // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
   // is the (initial) Promise.prototype and the @@species protector is
@@ -229,6 +276,15 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     Branch(TaggedEqual(value_constructor, promise_function), &if_new, &if_old);
   }
 
+  BIND(&if_primitive);
+  {
+    // PromiseHooks and debug support need the wrapper promise.
+    GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+           &if_old);
+    result = AwaitPrimitive(context, generator, value, on_resolve_sfi);
+    Goto(&done);
+  }
+
   BIND(&if_old);
   result = AwaitOld(context, generator, value, outer_promise, on_resolve_sfi,
                     on_reject_sfi, is_predicted_as_caught);
@@ -19,7 +19,8 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
   // Perform steps to resume generator after `value` is resolved.
   // `on_reject` is the SharedFunctioninfo instance used to create the reject
   // closure. `on_resolve` is the SharedFunctioninfo instance used to create the
-  // resolve closure. Returns the Promise-wrapped `value`.
+  // resolve closure. Returns the Promise-wrapped `value`, or undefined if
+  // `value` is not an object and no wrapper was needed.
   TNode<Object> Await(TNode<Context> context,
                       TNode<JSGeneratorObject> generator, TNode<Object> value,
                       TNode<JSPromise> outer_promise,
@@ -55,6 +56,10 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                          TNode<SharedFunctionInfo> on_resolve_sfi,
                          TNode<SharedFunctionInfo> on_reject_sfi,
                          TNode<Oddball> is_predicted_as_caught);
+  TNode<Object> AwaitPrimitive(TNode<Context> context,
+                               TNode<JSGeneratorObject> generator,
+                               TNode<Object> value,
+                               TNode<SharedFunctionInfo> on_resolve_sfi);
   TNode<Object> AwaitOptimized(TNode<Context> context,
                                TNode<JSGeneratorObject> generator,
                                TNode<JSPromise> promise,
@@ -311,20 +311,15 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructDoubleVarargs(
 void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
     TNode<Object> target, base::Optional<TNode<Object>> new_target,
     TNode<Object> spread, TNode<Int32T> args_count, TNode<Context> context) {
-  Label if_smiorobject(this), if_double(this),
+  Label if_smiorobject(this), if_double(this), if_arguments(this),
       if_generic(this, Label::kDeferred);
 
-  TVARIABLE(JSArray, var_js_array);
   TVARIABLE(FixedArrayBase, var_elements);
   TVARIABLE(Int32T, var_elements_kind);
+  TVARIABLE(Int32T, var_length);
 
   GotoIf(TaggedIsSmi(spread), &if_generic);
   TNode<Map> spread_map = LoadMap(CAST(spread));
-  GotoIfNot(IsJSArrayMap(spread_map), &if_generic);
-  TNode<JSArray> spread_array = CAST(spread);
-
-  // Check that we have the original Array.prototype.
-  GotoIfNot(IsPrototypeInitialArrayPrototype(context, spread_map), &if_generic);
 
   // Check that there are no elements on the Array.prototype chain.
   GotoIf(IsNoElementsProtectorCellInvalid(), &if_generic);
@@ -336,12 +331,30 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
       TaggedEqual(LoadObjectField(protector_cell, PropertyCell::kValueOffset),
                   SmiConstant(Protectors::kProtectorInvalid)),
       &if_generic);
+
+  // Check if {spread} is an (unmodified) arguments object.
+  TNode<NativeContext> native_context = LoadNativeContext(context);
+  GotoIf(TaggedEqual(spread_map,
+                     LoadContextElement(native_context,
+                                        Context::STRICT_ARGUMENTS_MAP_INDEX)),
+         &if_arguments);
+  GotoIf(TaggedEqual(spread_map,
+                     LoadContextElement(native_context,
+                                        Context::SLOPPY_ARGUMENTS_MAP_INDEX)),
+         &if_arguments);
+
+  GotoIfNot(IsJSArrayMap(spread_map), &if_generic);
+  TNode<JSArray> spread_array = CAST(spread);
+
+  // Check that we have the original Array.prototype.
+  GotoIfNot(IsPrototypeInitialArrayPrototype(context, spread_map), &if_generic);
   {
     // The fast-path accesses the {spread} elements directly.
     TNode<Int32T> spread_kind = LoadMapElementsKind(spread_map);
-    var_js_array = spread_array;
     var_elements_kind = spread_kind;
     var_elements = LoadElements(spread_array);
+    var_length =
+        LoadAndUntagToWord32ObjectField(spread_array, JSArray::kLengthOffset);
 
     // Check elements kind of {spread}.
     GotoIf(IsElementsKindLessThanOrEqual(spread_kind, HOLEY_ELEMENTS),
@@ -353,6 +366,23 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
            &if_smiorobject, &if_generic);
   }
 
+  BIND(&if_arguments);
+  {
+    // Arguments objects with their initial map iterate with the initial
+    // %ArrayProto_values% (see Accessors::ArgumentsIteratorGetter), so like
+    // for `fn.apply(this, arguments)` their elements can be passed on
+    // directly, without creating a list first. Holes read as undefined, since
+    // there are no elements on the prototype chain.
+    TNode<JSArgumentsObject> js_arguments = CAST(spread);
+    TNode<Object> length = LoadJSArgumentsObjectLength(context, js_arguments);
+    TNode<FixedArrayBase> elements = LoadElements(js_arguments);
+    GotoIfNot(TaggedEqual(length, LoadFixedArrayBaseLength(elements)),
+              &if_generic);
+    var_elements = elements;
+    var_length = SmiToInt32(CAST(length));
+    Goto(&if_smiorobject);
+  }
+
   BIND(&if_generic);
   {
     Label if_iterator_fn_not_callable(this, Label::kDeferred),
@@ -369,9 +399,9 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
         CAST(CallBuiltin(Builtins::kIterableToListMayPreserveHoles, context,
                          spread, iterator_fn));
 
-    var_js_array = list;
     var_elements = LoadElements(list);
     var_elements_kind = LoadElementsKind(list);
+    var_length = LoadAndUntagToWord32ObjectField(list, JSArray::kLengthOffset);
     Branch(Int32LessThan(var_elements_kind.value(),
                          Int32Constant(PACKED_DOUBLE_ELEMENTS)),
            &if_smiorobject, &if_double);
@@ -394,8 +424,7 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
 
   BIND(&if_smiorobject);
   {
-    TNode<Int32T> length = LoadAndUntagToWord32ObjectField(
-        var_js_array.value(), JSArray::kLengthOffset);
+    TNode<Int32T> length = var_length.value();
     TNode<FixedArrayBase> elements = var_elements.value();
     CSA_ASSERT(this, Int32LessThanOrEqual(
                          length, Int32Constant(FixedArray::kMaxLength)));
@@ -412,8 +441,7 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
 
   BIND(&if_double);
   {
-    TNode<Int32T> length = LoadAndUntagToWord32ObjectField(
-        var_js_array.value(), JSArray::kLengthOffset);
+    TNode<Int32T> length = var_length.value();
     GotoIf(Word32Equal(length, Int32Constant(0)), &if_smiorobject);
     CallOrConstructDoubleVarargs(target, new_target, CAST(var_elements.value()),
                                  length, args_count, context,
@@ -142,7 +142,8 @@ void HandlerBuiltinsAssembler::Generate_ElementsTransitionAndStore(
 
   Label miss(this);
 
-  if (FLAG_trace_elements_transitions) {
+  if (FLAG_trace_elements_transitions ||
+      FLAG_trace_elements_transition_stats) {
     // Tracing elements transitions is the job of the runtime.
     Goto(&miss);
   } else {
@@ -1053,6 +1053,42 @@ TF_BUILTIN(SetPropertyInLiteral, CodeStubAssembler) {
                                                    key, value);
 }
 
+// ES #sec-createdataproperty, with a fast path for adding a new named
+// property to an ordinary extensible object. Without an existing own property
+// this just adds a writable, enumerable and configurable data property, which
+// is what stores in literals do. Public class fields are defined this way.
+TF_BUILTIN(CreateDataProperty, CodeStubAssembler) {
+  auto context = Parameter<Context>(Descriptor::kContext);
+  auto receiver = Parameter<JSReceiver>(Descriptor::kReceiver);
+  auto key = Parameter<Object>(Descriptor::kKey);
+  auto value = Parameter<Object>(Descriptor::kValue);
+
+  TVARIABLE(IntPtrT, var_index);
+  TVARIABLE(Name, var_unique);
+  Label if_unique_name(this), if_not_found(this),
+      call_runtime(this, Label::kDeferred);
+
+  TryToName(key, &call_runtime, &var_index, &if_unique_name, &var_unique,
+            &call_runtime);
+
+  BIND(&if_unique_name);
+  {
+    TNode<Map> map = LoadMap(receiver);
+    TNode<Uint16T> instance_type = LoadMapInstanceType(map);
+    GotoIfNot(InstanceTypeEqual(instance_type, JS_OBJECT_TYPE), &call_runtime);
+    GotoIfNot(IsExtensibleMap(map), &call_runtime);
+    TryHasOwnProperty(receiver, map, instance_type, var_unique.value(),
+                      &call_runtime, &if_not_found, &call_runtime);
+  }
+
+  BIND(&if_not_found);
+  TailCallBuiltin(Builtins::kSetPropertyInLiteral, context, receiver,
+                  var_unique.value(), value);
+
+  BIND(&call_runtime);
+  TailCallRuntime(Runtime::kCreateDataProperty, context, receiver, key, value);
+}
+
 TF_BUILTIN(InstantiateAsmJs, CodeStubAssembler) {
   Label tailcall_to_function(this);
   auto context = Parameter<Context>(Descriptor::kContext);
@@ -47,7 +47,7 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   void RewindEnteredContext(TNode<IntPtrT> saved_entered_context_count);
 
   void RunPromiseHook(Runtime::FunctionId id, TNode<Context> context,
-                      TNode<HeapObject> promise_or_capability);
+                      TNode<Object> promise_or_capability);
 };
 
 TNode<RawPtrT> MicrotaskQueueBuiltinsAssembler::GetMicrotaskQueue(
@@ -228,8 +228,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
     const TNode<Object> job_handler =
         LoadObjectField(microtask, PromiseReactionJobTask::kHandlerOffset);
-    const TNode<HeapObject> promise_or_capability = CAST(LoadObjectField(
-        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset));
+    const TNode<Object> promise_or_capability = LoadObjectField(
+        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
 
     TNode<Object> preserved_embedder_data = LoadObjectField(
         microtask,
@@ -281,8 +281,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
     const TNode<Object> job_handler =
         LoadObjectField(microtask, PromiseReactionJobTask::kHandlerOffset);
-    const TNode<HeapObject> promise_or_capability = CAST(LoadObjectField(
-        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset));
+    const TNode<Object> promise_or_capability = LoadObjectField(
+        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
 
     TNode<Object> preserved_embedder_data = LoadObjectField(
         microtask,
@@ -467,21 +467,26 @@ void MicrotaskQueueBuiltinsAssembler::RewindEnteredContext(
 
 void MicrotaskQueueBuiltinsAssembler::RunPromiseHook(
     Runtime::FunctionId id, TNode<Context> context,
-    TNode<HeapObject> promise_or_capability) {
+    TNode<Object> promise_or_capability) {
   Label hook(this, Label::kDeferred), done_hook(this);
   Branch(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(), &hook,
          &done_hook);
   BIND(&hook);
   {
+    // The promise combinators store the element index instead of a promise.
+    GotoIf(TaggedIsSmi(promise_or_capability), &done_hook);
+    TNode<HeapObject> promise_or_capability_object =
+        CAST(promise_or_capability);
+
     // Get to the underlying JSPromise instance.
     TNode<HeapObject> promise = Select<HeapObject>(
-        IsPromiseCapability(promise_or_capability),
+        IsPromiseCapability(promise_or_capability_object),
         [=] {
-          return CAST(LoadObjectField(promise_or_capability,
+          return CAST(LoadObjectField(promise_or_capability_object,
                                       PromiseCapability::kPromiseOffset));
         },
 
-        [=] { return promise_or_capability; });
+        [=] { return promise_or_capability_object; });
     GotoIf(IsUndefined(promise), &done_hook);
     CallRuntime(id, context, promise);
     Goto(&done_hook);
@@ -554,6 +559,16 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   // Exit if the queue is empty.
   GotoIf(WordEqual(size, IntPtrConstant(0)), &done);
 
+  // Exit if the caller asked for a bounded run and the limit is reached.
+  TNode<IntPtrT> finished_count = Load<IntPtrT>(
+      microtask_queue,
+      IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskCountOffset));
+  TNode<IntPtrT> finished_count_limit = Load<IntPtrT>(
+      microtask_queue,
+      IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskCountLimitOffset));
+  GotoIf(IntPtrGreaterThanOrEqual(finished_count, finished_count_limit),
+         &done);
+
   TNode<RawPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
   TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
   TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
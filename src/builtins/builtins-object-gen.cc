@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/builtins/builtins-constructor-gen.h"
 #include "src/builtins/builtins-utils-gen.h"
 #include "src/builtins/builtins.h"
 #include "src/codegen/code-stub-assembler.h"
@@ -49,6 +50,13 @@ class ObjectBuiltinsAssembler : public CodeStubAssembler {
                                           TNode<BoolT> configurable);
   TNode<HeapObject> GetAccessorOrUndefined(TNode<HeapObject> accessor,
                                            Label* if_bailout);
+  // Copies the properties of {source} into {target} by switching {target}
+  // to the map of {source}, if {target} is an empty object literal and the
+  // map of {source} was reached from the same empty map by adding plain data
+  // properties. Jumps to {if_bailout} otherwise, leaving {target} untouched.
+  void AssignToEmptyObjectByMap(TNode<Context> context,
+                                TNode<JSReceiver> target,
+                                TNode<Object> source, Label* if_bailout);
 };
 
 class ObjectEntriesValuesBuiltinsAssembler : public ObjectBuiltinsAssembler {
@@ -81,6 +89,15 @@ class ObjectEntriesValuesBuiltinsAssembler : public ObjectBuiltinsAssembler {
   TNode<JSArray> FinalizeValuesOrEntriesJSArray(
       TNode<Context> context, TNode<FixedArray> values_or_entries,
       TNode<IntPtrT> size, TNode<Map> array_map, Label* if_empty);
+
+  // Loads the field of {object} described by an entry of the enum cache
+  // indices, see FieldIndex::GetLoadByFieldIndex.
+  TNode<Object> LoadFieldByEnumIndex(TNode<JSObject> object,
+                                     TNode<Smi> field_index);
+
+  // Returns CreateArrayFromList(« key, value »).
+  TNode<JSArray> AllocateEntry(TNode<Map> array_map, TNode<Object> key,
+                               TNode<Object> value);
 };
 
 void ObjectBuiltinsAssembler::ReturnToStringFormat(TNode<Context> context,
@@ -248,6 +265,42 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
     TNode<FixedArray> values_or_entries = CAST(AllocateFixedArray(
         PACKED_ELEMENTS, object_enum_length, kAllowLargeObjectAllocation));
 
+    // If the enum cache also has field indices, all enumerable properties
+    // are data fields and the values can be loaded without walking the
+    // descriptors.
+    TNode<DescriptorArray> descriptors = LoadMapDescriptors(map);
+    TNode<EnumCache> enum_cache = LoadObjectField<EnumCache>(
+        descriptors, DescriptorArray::kEnumCacheOffset);
+    TNode<FixedArray> enum_keys =
+        LoadObjectField<FixedArray>(enum_cache, EnumCache::kKeysOffset);
+    TNode<FixedArray> enum_indices =
+        LoadObjectField<FixedArray>(enum_cache, EnumCache::kIndicesOffset);
+    TVARIABLE(IntPtrT, var_result_index, IntPtrConstant(0));
+    Label if_has_enum_indices(this), if_no_enum_indices(this),
+        after_loop(this, &var_result_index);
+    Branch(IntPtrEqual(LoadAndUntagFixedArrayBaseLength(enum_indices),
+                       IntPtrConstant(0)),
+           &if_no_enum_indices, &if_has_enum_indices);
+
+    BIND(&if_has_enum_indices);
+    {
+      BuildFastLoop<IntPtrT>(
+          IntPtrConstant(0), object_enum_length,
+          [&](TNode<IntPtrT> index) {
+            TNode<Object> value = LoadFieldByEnumIndex(
+                object, CAST(LoadFixedArrayElement(enum_indices, index)));
+            if (collect_type == CollectType::kEntries) {
+              TNode<Object> key = LoadFixedArrayElement(enum_keys, index);
+              value = AllocateEntry(array_map, key, value);
+            }
+            StoreFixedArrayElement(values_or_entries, index, value);
+          },
+          1, IndexAdvanceMode::kPost);
+      var_result_index = object_enum_length;
+      Goto(&after_loop);
+    }
+
+    BIND(&if_no_enum_indices);
     // If in case we have enum_cache,
     // we can't detect accessor of object until loop through descriptors.
     // So if object might have accessor,
@@ -258,12 +311,10 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
                             IntPtrConstant(0), object_enum_length,
                             RootIndex::kTheHoleValue);
 
-    TVARIABLE(IntPtrT, var_result_index, IntPtrConstant(0));
     TVARIABLE(IntPtrT, var_descriptor_number, IntPtrConstant(0));
     // Let desc be ? O.[[GetOwnProperty]](key).
-    TNode<DescriptorArray> descriptors = LoadMapDescriptors(map);
     Label loop(this, {&var_descriptor_number, &var_result_index}),
-        after_loop(this), next_descriptor(this);
+        next_descriptor(this);
     Branch(IntPtrEqual(var_descriptor_number.value(), object_enum_length),
            &after_loop, &loop);
 
@@ -309,14 +360,7 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
 
       if (collect_type == CollectType::kEntries) {
         // Let entry be CreateArrayFromList(« key, value »).
-        TNode<JSArray> array;
-        TNode<FixedArrayBase> elements;
-        std::tie(array, elements) = AllocateUninitializedJSArrayWithElements(
-            PACKED_ELEMENTS, array_map, SmiConstant(2), base::nullopt,
-            IntPtrConstant(2));
-        StoreFixedArrayElement(CAST(elements), 0, next_key, SKIP_WRITE_BARRIER);
-        StoreFixedArrayElement(CAST(elements), 1, value, SKIP_WRITE_BARRIER);
-        value = TNode<JSArray>::UncheckedCast(array);
+        value = AllocateEntry(array_map, next_key, value);
       }
 
       StoreFixedArrayElement(values_or_entries, var_result_index.value(),
@@ -349,6 +393,61 @@ ObjectEntriesValuesBuiltinsAssembler::FinalizeValuesOrEntriesJSArray(
   return TNode<JSArray>::UncheckedCast(array);
 }
 
+TNode<Object> ObjectEntriesValuesBuiltinsAssembler::LoadFieldByEnumIndex(
+    TNode<JSObject> object, TNode<Smi> field_index) {
+  // The lowest bit marks mutable double boxes, the rest is the index of an
+  // in-object field or, if negative, -index - 1 into the property array.
+  TNode<IntPtrT> encoded_index = SmiUntag(field_index);
+  TNode<IntPtrT> index = WordSar(encoded_index, IntPtrConstant(1));
+  TVARIABLE(Object, var_value);
+  Label if_inobject(this), if_outofobject(this), done(this, &var_value);
+  Branch(IntPtrLessThan(index, IntPtrConstant(0)), &if_outofobject,
+         &if_inobject);
+
+  BIND(&if_inobject);
+  {
+    TNode<IntPtrT> offset = IntPtrAdd(TimesTaggedSize(index),
+                                      IntPtrConstant(JSObject::kHeaderSize));
+    var_value = LoadObjectField(object, offset);
+    Goto(&done);
+  }
+
+  BIND(&if_outofobject);
+  {
+    TNode<PropertyArray> properties = CAST(LoadFastProperties(object));
+    var_value = LoadPropertyArrayElement(
+        properties, IntPtrSub(IntPtrConstant(-1), index));
+    Goto(&done);
+  }
+
+  BIND(&done);
+  Label if_double(this), if_tagged(this);
+  Branch(IsSetWord(encoded_index, 1), &if_double, &if_tagged);
+
+  BIND(&if_double);
+  {
+    // Don't leak the mutable box.
+    var_value = AllocateHeapNumberWithValue(
+        LoadHeapNumberValue(CAST(var_value.value())));
+    Goto(&if_tagged);
+  }
+
+  BIND(&if_tagged);
+  return var_value.value();
+}
+
+TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::AllocateEntry(
+    TNode<Map> array_map, TNode<Object> key, TNode<Object> value) {
+  TNode<JSArray> array;
+  TNode<FixedArrayBase> elements;
+  std::tie(array, elements) = AllocateUninitializedJSArrayWithElements(
+      PACKED_ELEMENTS, array_map, SmiConstant(2), base::nullopt,
+      IntPtrConstant(2));
+  StoreFixedArrayElement(CAST(elements), 0, key, SKIP_WRITE_BARRIER);
+  StoreFixedArrayElement(CAST(elements), 1, value, SKIP_WRITE_BARRIER);
+  return array;
+}
+
 TF_BUILTIN(ObjectPrototypeHasOwnProperty, ObjectBuiltinsAssembler) {
   auto object = Parameter<Object>(Descriptor::kReceiver);
   auto key = Parameter<Object>(Descriptor::kKey);
@@ -418,6 +517,114 @@ TF_BUILTIN(ObjectPrototypeHasOwnProperty, ObjectBuiltinsAssembler) {
   Return(CallRuntime(Runtime::kObjectHasOwnProperty, context, object, key));
 }
 
+void ObjectBuiltinsAssembler::AssignToEmptyObjectByMap(
+    TNode<Context> context, TNode<JSReceiver> target, TNode<Object> source,
+    Label* if_bailout) {
+  TNode<NativeContext> native_context = LoadNativeContext(context);
+  TNode<Map> empty_map = LoadObjectFunctionInitialMap(native_context);
+
+  // {target} must not have any properties, elements or identity hash yet.
+  GotoIfNot(TaggedEqual(LoadMap(target), empty_map), if_bailout);
+  GotoIfNot(IsEmptyFixedArray(LoadElements(CAST(target))), if_bailout);
+  GotoIfNot(TaggedEqual(
+                LoadObjectField(target, JSObject::kPropertiesOrHashOffset),
+                EmptyFixedArrayConstant()),
+            if_bailout);
+
+  GotoIf(TaggedIsSmi(source), if_bailout);
+  TNode<Map> source_map = LoadMap(CAST(source));
+  GotoIf(TaggedEqual(source_map, empty_map), if_bailout);
+  GotoIf(IsDictionaryMap(source_map), if_bailout);
+  GotoIf(IsDeprecatedMap(source_map), if_bailout);
+  GotoIfNot(IsExtensibleMap(source_map), if_bailout);
+  GotoIfNot(Word32Equal(LoadMapElementsKind(source_map),
+                        LoadMapElementsKind(empty_map)),
+            if_bailout);
+  GotoIfNot(TaggedEqual(LoadMapPrototype(source_map),
+                        LoadMapPrototype(empty_map)),
+            if_bailout);
+
+  // The transition tree of {empty_map} must lead to {source_map}, which then
+  // has the same instance type and size.
+  {
+    TVARIABLE(Map, var_map, source_map);
+    Label loop(this, &var_map), found_root(this);
+    Goto(&loop);
+    BIND(&loop);
+    {
+      TNode<Object> back_pointer = LoadMapBackPointer(var_map.value());
+      GotoIf(IsUndefined(back_pointer), &found_root);
+      var_map = CAST(back_pointer);
+      Goto(&loop);
+    }
+    BIND(&found_root);
+    GotoIfNot(TaggedEqual(var_map.value(), empty_map), if_bailout);
+  }
+  GotoIfNot(IsEmptyFixedArray(LoadElements(CAST(source))), if_bailout);
+
+  // Only writable, enumerable and configurable data fields would be created
+  // the same way by [[Set]] on {target}.
+  TNode<DescriptorArray> descriptors = LoadMapDescriptors(source_map);
+  const uint32_t kMask = PropertyDetails::KindField::kMask |
+                         PropertyDetails::LocationField::kMask |
+                         PropertyDetails::AttributesField::kMask;
+  const uint32_t kPlainDataField =
+      PropertyDetails::KindField::encode(kData) |
+      PropertyDetails::LocationField::encode(kField) |
+      PropertyDetails::AttributesField::encode(NONE);
+  BuildFastLoop<IntPtrT>(
+      IntPtrConstant(0),
+      ChangeInt32ToIntPtr(LoadNumberOfOwnDescriptors(source_map)),
+      [&](TNode<IntPtrT> descriptor) {
+        TNode<Uint32T> details =
+            LoadDetailsByDescriptorEntry(descriptors, descriptor);
+        GotoIfNot(Word32Equal(Word32And(details, Int32Constant(kMask)),
+                              Int32Constant(kPlainDataField)),
+                  if_bailout);
+      },
+      1, IndexAdvanceMode::kPost);
+
+  // Copy the out-of-object properties first, while {target} is untouched.
+  TVARIABLE(HeapObject, var_properties, EmptyFixedArrayConstant());
+  Label copy_inobject_properties(this);
+  TNode<Object> source_properties =
+      LoadObjectField(CAST(source), JSObject::kPropertiesOrHashOffset);
+  GotoIf(TaggedIsSmi(source_properties), &copy_inobject_properties);
+  GotoIf(IsEmptyFixedArray(source_properties), &copy_inobject_properties);
+  {
+    TNode<PropertyArray> source_property_array = CAST(source_properties);
+    TNode<IntPtrT> length = LoadPropertyArrayLength(source_property_array);
+    GotoIf(IntPtrEqual(length, IntPtrConstant(0)), &copy_inobject_properties);
+    TNode<PropertyArray> property_array = AllocatePropertyArray(length);
+    FillPropertyArrayWithUndefined(property_array, IntPtrConstant(0), length);
+    CopyPropertyArrayValues(source_property_array, property_array, length,
+                            SKIP_WRITE_BARRIER, DestroySource::kNo);
+    var_properties = property_array;
+    Goto(&copy_inobject_properties);
+  }
+
+  // Copy the in-object fields as raw data and switch the map, without
+  // allocating in between.
+  BIND(&copy_inobject_properties);
+  TNode<IntPtrT> start_offset =
+      TimesTaggedSize(LoadMapInobjectPropertiesStartInWords(source_map));
+  TNode<IntPtrT> end_offset =
+      TimesTaggedSize(LoadMapInstanceSizeInWords(source_map));
+  BuildFastLoop<IntPtrT>(
+      start_offset, end_offset,
+      [=](TNode<IntPtrT> offset) {
+        StoreObjectField(target, offset, LoadObjectField(CAST(source), offset));
+      },
+      kTaggedSize, IndexAdvanceMode::kPost);
+  StoreObjectField(target, JSObject::kPropertiesOrHashOffset,
+                   var_properties.value());
+  StoreMap(target, source_map);
+
+  // Don't share mutable HeapNumbers with {source}.
+  ConstructorBuiltinsAssembler(state()).CopyMutableHeapNumbersInObject(
+      target, start_offset, end_offset);
+}
+
 // ES #sec-object.assign
 TF_BUILTIN(ObjectAssign, ObjectBuiltinsAssembler) {
   TNode<IntPtrT> argc = ChangeInt32ToIntPtr(
@@ -437,11 +644,20 @@ TF_BUILTIN(ObjectAssign, ObjectBuiltinsAssembler) {
   // 3. Let sources be the List of argument values starting with the
   //    second argument.
   // 4. For each element nextSource of sources, in ascending index order,
+  Label assign_first_source(this), assign_other_sources(this);
+  AssignToEmptyObjectByMap(context, to, args.AtIndex(1), &assign_first_source);
+  Goto(&assign_other_sources);
+
+  BIND(&assign_first_source);
+  CallBuiltin(Builtins::kSetDataProperties, context, to, args.AtIndex(1));
+  Goto(&assign_other_sources);
+
+  BIND(&assign_other_sources);
   args.ForEach(
       [=](TNode<Object> next_source) {
         CallBuiltin(Builtins::kSetDataProperties, context, to, next_source);
       },
-      IntPtrConstant(1));
+      IntPtrConstant(2));
   Goto(&done);
 
   // 5. Return to.
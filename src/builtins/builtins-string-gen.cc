@@ -378,13 +378,85 @@ TNode<String> StringBuiltinsAssembler::StringAdd(
     TVARIABLE(String, var_right, right);
     Label non_cons(this, {&var_left, &var_right});
     Label slow(this, Label::kDeferred);
+    Label short_cons(this), builder(this);
     GotoIf(Uint32LessThan(new_length, Uint32Constant(ConsString::kMinLength)),
            &non_cons);
+    GotoIf(Uint32LessThan(new_length,
+                          Uint32Constant(SlicedString::kBuilderMinLength)),
+           &short_cons);
+
+    // Long concatenations remember their result, so that appending to it
+    // again turns it into a string builder (see Runtime_StringAdd).
+    GotoIf(TaggedEqual(left, LoadRoot(RootIndex::kStringBuilderTail)),
+           &builder);
+    result =
+        AllocateConsString(new_length, var_left.value(), var_right.value());
+    StoreRoot(RootIndex::kStringBuilderTail, result.value());
+    Goto(&done_native);
 
+    BIND(&short_cons);
     result =
         AllocateConsString(new_length, var_left.value(), var_right.value());
     Goto(&done_native);
 
+    BIND(&builder);
+    {
+      // Append {right} in place if {left} is a string builder, that is a
+      // slice from the start of a sequential string with enough spare
+      // capacity. Everything else is left to the runtime.
+      TNode<Int32T> left_instance_type = LoadInstanceType(left);
+      GotoIfNot(Word32Equal(Word32And(left_instance_type,
+                                      Int32Constant(kStringRepresentationMask)),
+                            Int32Constant(kSlicedStringTag)),
+                &runtime);
+      GotoIfNot(TaggedEqual(LoadObjectField(left, SlicedString::kOffsetOffset),
+                            SmiConstant(0)),
+                &runtime);
+      TNode<String> parent =
+          LoadObjectField<String>(left, SlicedString::kParentOffset);
+      TNode<Int32T> parent_instance_type = LoadInstanceType(parent);
+      GotoIfNot(IsSequentialStringInstanceType(parent_instance_type),
+                &runtime);
+      GotoIf(Uint32LessThan(LoadStringLengthAsWord32(parent), new_length),
+             &runtime);
+      TNode<Int32T> right_instance_type = LoadInstanceType(right);
+      GotoIfNot(IsSequentialStringInstanceType(right_instance_type),
+                &runtime);
+
+      TNode<IntPtrT> word_left_length = Signed(ChangeUint32ToWord(left_length));
+      TNode<IntPtrT> word_right_length =
+          Signed(ChangeUint32ToWord(right_length));
+      Label one_byte_parent(this), one_byte_right(this), two_byte_done(this);
+      GotoIf(IsOneByteStringInstanceType(parent_instance_type),
+             &one_byte_parent);
+      GotoIf(IsOneByteStringInstanceType(right_instance_type),
+             &one_byte_right);
+      CopyStringCharacters(right, parent, IntPtrConstant(0), word_left_length,
+                           word_right_length, String::TWO_BYTE_ENCODING,
+                           String::TWO_BYTE_ENCODING);
+      Goto(&two_byte_done);
+
+      BIND(&one_byte_right);
+      CopyStringCharacters(right, parent, IntPtrConstant(0), word_left_length,
+                           word_right_length, String::ONE_BYTE_ENCODING,
+                           String::TWO_BYTE_ENCODING);
+      Goto(&two_byte_done);
+
+      BIND(&two_byte_done);
+      result = AllocateSlicedTwoByteString(new_length, parent, SmiConstant(0));
+      StoreRoot(RootIndex::kStringBuilderTail, result.value());
+      Goto(&done_native);
+
+      BIND(&one_byte_parent);
+      GotoIfNot(IsOneByteStringInstanceType(right_instance_type), &runtime);
+      CopyStringCharacters(right, parent, IntPtrConstant(0), word_left_length,
+                           word_right_length, String::ONE_BYTE_ENCODING,
+                           String::ONE_BYTE_ENCODING);
+      result = AllocateSlicedOneByteString(new_length, parent, SmiConstant(0));
+      StoreRoot(RootIndex::kStringBuilderTail, result.value());
+      Goto(&done_native);
+    }
+
     BIND(&non_cons);
 
     Comment("Full string concatenate");
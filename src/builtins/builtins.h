@@ -5,6 +5,8 @@
 #ifndef V8_BUILTINS_BUILTINS_H_
 #define V8_BUILTINS_BUILTINS_H_
 
+#include <vector>
+
 #include "src/base/flags.h"
 #include "src/builtins/builtins-definitions.h"
 #include "src/common/globals.h"
@@ -208,6 +210,23 @@ class Builtins {
     js_entry_handler_offset_ = offset;
   }
 
+  // How often the given builtin was entered according to
+  // --turbo-profiling-log-file, or 0 if it wasn't profiled (mksnapshot-only).
+  uint32_t profiled_entry_count(int builtin_index) const {
+    DCHECK(IsBuiltinId(builtin_index));
+    return profiled_entry_counts_.empty()
+               ? 0
+               : profiled_entry_counts_[builtin_index];
+  }
+
+  void SetProfiledEntryCount(int builtin_index, uint32_t count) {
+    DCHECK(IsBuiltinId(builtin_index));
+    if (profiled_entry_counts_.empty()) {
+      profiled_entry_counts_.resize(builtin_count);
+    }
+    profiled_entry_counts_[builtin_index] = count;
+  }
+
  private:
   static void Generate_CallFunction(MacroAssembler* masm,
                                     ConvertReceiverMode mode);
@@ -249,6 +268,9 @@ class Builtins {
   // during codegen (mksnapshot-only).
   int js_entry_handler_offset_ = 0;
 
+  // Indexed by builtin index. Empty unless a profile was loaded.
+  std::vector<uint32_t> profiled_entry_counts_;
+
   friend class SetupIsolateDelegate;
 
   DISALLOW_COPY_AND_ASSIGN(Builtins);
@@ -350,6 +350,16 @@ void SetupIsolateDelegate::SetupBuiltinsInternal(Isolate* isolate) {
   BUILTIN_EXCEPTION_CAUGHT_PREDICTION_LIST(SET_EXCEPTION_CAUGHT_PREDICTION)
 #undef SET_EXCEPTION_CAUGHT_PREDICTION
 
+  // Block 0 is the start block, so its counter is the number of entries.
+  if (FLAG_turbo_profiling_log_file != nullptr) {
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      const ProfileDataFromFile* profile_data =
+          ProfileDataFromFile::TryRead(Builtins::name(i));
+      if (profile_data == nullptr) continue;
+      builtins->SetProfiledEntryCount(i, profile_data->GetCounter(0));
+    }
+  }
+
   builtins->MarkInitialized();
 }
 
@@ -49,7 +49,8 @@ static unsigned SimulatorFeaturesFromCommandLine() {
     return 0;
   }
   if (strcmp(FLAG_sim_arm64_optional_features, "all") == 0) {
-    return (1u << NUMBER_OF_CPU_FEATURES) - 1;
+    // The simulator does not implement the LSE atomics.
+    return ((1u << NUMBER_OF_CPU_FEATURES) - 1) & ~(1u << LSE);
   }
   fprintf(
       stderr,
@@ -66,6 +67,9 @@ static constexpr unsigned CpuFeaturesFromCompiler() {
   unsigned features = 0;
 #if defined(__ARM_FEATURE_JCVT)
   features |= 1u << JSCVT;
+#endif
+#if defined(__ARM_FEATURE_ATOMICS)
+  features |= 1u << LSE;
 #endif
   return features;
 }
@@ -95,6 +99,9 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   if (cpu.has_jscvt()) {
     runtime |= 1u << JSCVT;
   }
+  if (cpu.has_lse()) {
+    runtime |= 1u << LSE;
+  }
 
   // Use the best of the features found by CPU detection and those inferred from
   // the build system.
@@ -1414,6 +1421,58 @@ void Assembler::stlxrh(const Register& rs, const Register& rt,
   Emit(STLXR_h | Rs(rs) | Rt2(x31) | RnSP(rn) | Rt(rt));
 }
 
+void Assembler::casal(const Register& rs, const Register& rt,
+                      const Register& rn) {
+  DCHECK(rs.IsSameSizeAndType(rt));
+  DCHECK(rn.Is64Bits());
+  Emit((rt.Is64Bits() ? CASAL_x : CASAL_w) | Rs(rs) | RnSP(rn) | Rt(rt));
+}
+
+void Assembler::casalb(const Register& rs, const Register& rt,
+                       const Register& rn) {
+  DCHECK(rs.Is32Bits());
+  DCHECK(rt.Is32Bits());
+  DCHECK(rn.Is64Bits());
+  Emit(CASAL_b | Rs(rs) | RnSP(rn) | Rt(rt));
+}
+
+void Assembler::casalh(const Register& rs, const Register& rt,
+                       const Register& rn) {
+  DCHECK(rs.Is32Bits());
+  DCHECK(rt.Is32Bits());
+  DCHECK(rn.Is64Bits());
+  Emit(CASAL_h | Rs(rs) | RnSP(rn) | Rt(rt));
+}
+
+#define DEFINE_ATOMIC_MEMORY_OP(op, OP)                          \
+  void Assembler::op(const Register& rs, const Register& rt,     \
+                     const Register& rn) {                       \
+    DCHECK(rs.IsSameSizeAndType(rt));                            \
+    DCHECK(rn.Is64Bits());                                       \
+    Emit((rt.Is64Bits() ? OP##_x : OP##_w) | Rs(rs) | RnSP(rn) | \
+         Rt(rt));                                                \
+  }                                                              \
+  void Assembler::op##b(const Register& rs, const Register& rt,  \
+                        const Register& rn) {                    \
+    DCHECK(rs.Is32Bits());                                       \
+    DCHECK(rt.Is32Bits());                                       \
+    DCHECK(rn.Is64Bits());                                       \
+    Emit(OP##_b | Rs(rs) | RnSP(rn) | Rt(rt));                   \
+  }                                                              \
+  void Assembler::op##h(const Register& rs, const Register& rt,  \
+                        const Register& rn) {                    \
+    DCHECK(rs.Is32Bits());                                       \
+    DCHECK(rt.Is32Bits());                                       \
+    DCHECK(rn.Is64Bits());                                       \
+    Emit(OP##_h | Rs(rs) | RnSP(rn) | Rt(rt));                   \
+  }
+DEFINE_ATOMIC_MEMORY_OP(ldaddal, LDADDAL)
+DEFINE_ATOMIC_MEMORY_OP(ldclral, LDCLRAL)
+DEFINE_ATOMIC_MEMORY_OP(ldeoral, LDEORAL)
+DEFINE_ATOMIC_MEMORY_OP(ldsetal, LDSETAL)
+DEFINE_ATOMIC_MEMORY_OP(swpal, SWPAL)
+#undef DEFINE_ATOMIC_MEMORY_OP
+
 void Assembler::NEON3DifferentL(const VRegister& vd, const VRegister& vn,
                                 const VRegister& vm, NEON3DifferentOp vop) {
   DCHECK(AreSameFormat(vn, vm));
@@ -879,6 +879,31 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
   // Store-release exclusive half-word.
   void stlxrh(const Register& rs, const Register& rt, const Register& rn);
 
+  // Large System Extensions (LSE) atomics, with acquire and release
+  // semantics. Only usable if CpuFeatures::IsSupported(LSE).
+
+  // Compare and swap word or doubleword.
+  void casal(const Register& rs, const Register& rt, const Register& rn);
+
+  // Compare and swap byte.
+  void casalb(const Register& rs, const Register& rt, const Register& rn);
+
+  // Compare and swap half-word.
+  void casalh(const Register& rs, const Register& rt, const Register& rn);
+
+#define DECLARE_ATOMIC_MEMORY_OP(op)                                      \
+  void op(const Register& rs, const Register& rt, const Register& rn);    \
+  void op##b(const Register& rs, const Register& rt, const Register& rn); \
+  void op##h(const Register& rs, const Register& rt, const Register& rn);
+  // Atomic add, bit clear, exclusive or and bit set, returning the old value.
+  DECLARE_ATOMIC_MEMORY_OP(ldaddal)
+  DECLARE_ATOMIC_MEMORY_OP(ldclral)
+  DECLARE_ATOMIC_MEMORY_OP(ldeoral)
+  DECLARE_ATOMIC_MEMORY_OP(ldsetal)
+  // Atomic swap.
+  DECLARE_ATOMIC_MEMORY_OP(swpal)
+#undef DECLARE_ATOMIC_MEMORY_OP
+
   // Move instructions. The default shift of -1 indicates that the move
   // instruction will calculate an appropriate 16-bit immediate and left shift
   // that is equal to the 64-bit immediate argument. If an explicit left shift
@@ -988,6 +988,44 @@ enum LoadStoreAcquireReleaseOp : uint32_t {
   LDAR_x = LoadStoreAcquireReleaseFixed | 0xC0C08000,
 };
 
+// Atomic memory operations (LSE), with acquire and release semantics.
+enum AtomicMemoryOp : uint32_t {
+  AtomicMemoryFixed = 0x38200000,
+  AtomicMemoryFMask = 0x3B200C00,
+  AtomicMemoryMask = 0xFFE0FC00,
+  LDADDAL_b = AtomicMemoryFixed | 0x00C00000,
+  LDCLRAL_b = AtomicMemoryFixed | 0x00C01000,
+  LDEORAL_b = AtomicMemoryFixed | 0x00C02000,
+  LDSETAL_b = AtomicMemoryFixed | 0x00C03000,
+  SWPAL_b = AtomicMemoryFixed | 0x00C08000,
+  LDADDAL_h = AtomicMemoryFixed | 0x40C00000,
+  LDCLRAL_h = AtomicMemoryFixed | 0x40C01000,
+  LDEORAL_h = AtomicMemoryFixed | 0x40C02000,
+  LDSETAL_h = AtomicMemoryFixed | 0x40C03000,
+  SWPAL_h = AtomicMemoryFixed | 0x40C08000,
+  LDADDAL_w = AtomicMemoryFixed | 0x80C00000,
+  LDCLRAL_w = AtomicMemoryFixed | 0x80C01000,
+  LDEORAL_w = AtomicMemoryFixed | 0x80C02000,
+  LDSETAL_w = AtomicMemoryFixed | 0x80C03000,
+  SWPAL_w = AtomicMemoryFixed | 0x80C08000,
+  LDADDAL_x = AtomicMemoryFixed | 0xC0C00000,
+  LDCLRAL_x = AtomicMemoryFixed | 0xC0C01000,
+  LDEORAL_x = AtomicMemoryFixed | 0xC0C02000,
+  LDSETAL_x = AtomicMemoryFixed | 0xC0C03000,
+  SWPAL_x = AtomicMemoryFixed | 0xC0C08000,
+};
+
+// Compare and swap (LSE), with acquire and release semantics.
+enum CompareAndSwapOp : uint32_t {
+  CompareAndSwapFixed = 0x08A07C00,
+  CompareAndSwapFMask = 0x3FA07C00,
+  CompareAndSwapMask = 0xFFE0FC00,
+  CASAL_b = CompareAndSwapFixed | 0x00408000,
+  CASAL_h = CompareAndSwapFixed | 0x40408000,
+  CASAL_w = CompareAndSwapFixed | 0x80408000,
+  CASAL_x = CompareAndSwapFixed | 0xC0408000,
+};
+
 // Conditional compare.
 enum ConditionalCompareOp : uint32_t {
   ConditionalCompareMask = 0x60000000,
@@ -6737,12 +6737,15 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input,
     // Try normalizing the HeapNumber.
     TryHeapNumberToSmi(heap_number_input, &smi_input, &if_smi);
 
-    // Make a hash from the two 32-bit values of the double.
+    // Make a hash from the two 32-bit values of the double, see
+    // NumberToStringCacheHash in factory.cc.
     TNode<Int32T> low =
         LoadObjectField<Int32T>(heap_number_input, HeapNumber::kValueOffset);
     TNode<Int32T> high = LoadObjectField<Int32T>(
         heap_number_input, HeapNumber::kValueOffset + kIntSize);
-    TNode<Word32T> hash = Word32And(Word32Xor(low, high), mask);
+    TNode<Word32T> folded = Word32Xor(low, high);
+    folded = Word32Xor(folded, Word32Shr(folded, 16));
+    TNode<Word32T> hash = Word32And(folded, mask);
     TNode<IntPtrT> entry_index =
         Signed(ChangeUint32ToWord(Int32Add(hash, hash)));
 
@@ -12953,6 +12956,15 @@ TNode<BoolT> CodeStubAssembler::IsDebugActive() {
   return Word32NotEqual(is_debug_active, Int32Constant(0));
 }
 
+TNode<BoolT> CodeStubAssembler::IsBlockBinaryCodeCoverage() {
+  STATIC_ASSERT(sizeof(debug::CoverageMode) == kInt32Size);
+  TNode<Int32T> mode = Load<Int32T>(ExternalConstant(
+      ExternalReference::code_coverage_mode_address(isolate())));
+  return Word32Equal(
+      mode,
+      Int32Constant(static_cast<int>(debug::CoverageMode::kBlockBinary)));
+}
+
 TNode<BoolT> CodeStubAssembler::IsPromiseHookEnabled() {
   const TNode<RawPtrT> promise_hook = Load<RawPtrT>(
       ExternalConstant(ExternalReference::promise_hook_address(isolate())));
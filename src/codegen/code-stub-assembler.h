@@ -67,16 +67,34 @@ enum class PrimitiveType { kBoolean, kNumber, kString, kSymbol };
   V(MapIteratorProtector, map_iterator_protector, MapIteratorProtector)        \
   V(NoElementsProtector, no_elements_protector, NoElementsProtector)           \
   V(NumberStringCache, number_string_cache, NumberStringCache)                 \
+  V(PromiseAllRejectElementIndexedSharedFun,                                   \
+    promise_all_reject_element_indexed_shared_fun,                             \
+    PromiseAllRejectElementIndexedSharedFun)                                   \
+  V(PromiseAllResolveElementIndexedSharedFun,                                  \
+    promise_all_resolve_element_indexed_shared_fun,                            \
+    PromiseAllResolveElementIndexedSharedFun)                                  \
   V(PromiseAllResolveElementSharedFun, promise_all_resolve_element_shared_fun, \
     PromiseAllResolveElementSharedFun)                                         \
+  V(PromiseAllSettledRejectElementIndexedSharedFun,                            \
+    promise_all_settled_reject_element_indexed_shared_fun,                     \
+    PromiseAllSettledRejectElementIndexedSharedFun)                            \
   V(PromiseAllSettledRejectElementSharedFun,                                   \
     promise_all_settled_reject_element_shared_fun,                             \
     PromiseAllSettledRejectElementSharedFun)                                   \
+  V(PromiseAllSettledResolveElementIndexedSharedFun,                           \
+    promise_all_settled_resolve_element_indexed_shared_fun,                    \
+    PromiseAllSettledResolveElementIndexedSharedFun)                           \
   V(PromiseAllSettledResolveElementSharedFun,                                  \
     promise_all_settled_resolve_element_shared_fun,                            \
     PromiseAllSettledResolveElementSharedFun)                                  \
+  V(PromiseAnyRejectElementIndexedSharedFun,                                   \
+    promise_any_reject_element_indexed_shared_fun,                             \
+    PromiseAnyRejectElementIndexedSharedFun)                                   \
   V(PromiseAnyRejectElementSharedFun, promise_any_reject_element_shared_fun,   \
     PromiseAnyRejectElementSharedFun)                                          \
+  V(PromiseAnyResolveElementIndexedSharedFun,                                  \
+    promise_any_resolve_element_indexed_shared_fun,                            \
+    PromiseAnyResolveElementIndexedSharedFun)                                  \
   V(PromiseCapabilityDefaultRejectSharedFun,                                   \
     promise_capability_default_reject_shared_fun,                              \
     PromiseCapabilityDefaultRejectSharedFun)                                   \
@@ -3387,6 +3405,7 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
 
   // Debug helpers
   TNode<BoolT> IsDebugActive();
+  TNode<BoolT> IsBlockBinaryCodeCoverage();
 
   // JSArrayBuffer helpers
   TNode<RawPtrT> LoadJSArrayBufferBackingStorePtr(
@@ -73,7 +73,7 @@ void CompilationSubCache::AgeCustom(CompilationSubCache* c) {
 }
 
 void CompilationCacheScript::Age() {
-  if (FLAG_isolate_script_cache_ageing) AgeCustom(this);
+  if (FLAG_isolate_script_cache_ageing && age_scripts_) AgeCustom(this);
 }
 void CompilationCacheEval::Age() { AgeCustom(this); }
 void CompilationCacheRegExp::Age() { AgeByGeneration(this); }
@@ -183,8 +183,10 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
 #endif
     isolate()->counters()->compilation_cache_hits()->Increment();
     LOG(isolate(), CompilationCacheEvent("hit", "script", *function_info));
+    hits_++;
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    misses_++;
   }
   return result;
 }
@@ -195,10 +197,34 @@ void CompilationCacheScript::Put(Handle<String> source,
                                  Handle<SharedFunctionInfo> function_info) {
   HandleScope scope(isolate());
   Handle<CompilationCacheTable> table = GetFirstTable();
+  if (max_scripts_ > 0) {
+    while (table->NumberOfElements() >= max_scripts_ &&
+           table->RemoveOldestScript()) {
+      evictions_++;
+    }
+  }
   SetFirstTable(CompilationCacheTable::PutScript(table, source, native_context,
                                                  language_mode, function_info));
 }
 
+void CompilationCacheScript::SetLimits(int max_scripts, bool age_scripts) {
+  DCHECK_LE(0, max_scripts);
+  max_scripts_ = max_scripts;
+  age_scripts_ = age_scripts;
+  if (max_scripts_ == 0) return;
+  HandleScope scope(isolate());
+  Handle<CompilationCacheTable> table = GetFirstTable();
+  while (table->NumberOfElements() > max_scripts_ &&
+         table->RemoveOldestScript()) {
+    evictions_++;
+  }
+}
+
+int CompilationCacheScript::NumberOfScripts() {
+  HandleScope scope(isolate());
+  return GetFirstTable()->NumberOfElements();
+}
+
 InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
                                           Handle<SharedFunctionInfo> outer_info,
                                           Handle<Context> native_context,
@@ -94,11 +94,27 @@ class CompilationCacheScript : public CompilationSubCache {
 
   void Age() override;
 
+  // Limits the number of cached scripts to {max_scripts}, or doesn't limit it
+  // if {max_scripts} is 0. Unless {age_scripts} is set, only the limit
+  // evicts scripts, not ageing.
+  void SetLimits(int max_scripts, bool age_scripts);
+
+  int NumberOfScripts();
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+  size_t evictions() const { return evictions_; }
+
  private:
   bool HasOrigin(Handle<SharedFunctionInfo> function_info,
                  MaybeHandle<Object> name, int line_offset, int column_offset,
                  ScriptOriginOptions resource_options);
 
+  int max_scripts_ = 0;
+  bool age_scripts_ = true;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+  size_t evictions_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheScript);
 };
 
@@ -227,6 +243,17 @@ class V8_EXPORT_PRIVATE CompilationCache {
 
   void PutCode(Handle<SharedFunctionInfo> shared, Handle<Code> code);
 
+  // Limits the script cache, see CompilationCacheScript::SetLimits.
+  void SetScriptLimits(int max_scripts, bool age_scripts) {
+    script_.SetLimits(max_scripts, age_scripts);
+  }
+
+  // Statistics of the script cache, which is shared by all native contexts.
+  int NumberOfScripts() { return script_.NumberOfScripts(); }
+  size_t script_hits() const { return script_.hits(); }
+  size_t script_misses() const { return script_.misses(); }
+  size_t script_evictions() const { return script_.evictions(); }
+
   // Clear the cache - also used to initialize the cache at startup.
   void Clear();
 
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
@@ -31,6 +32,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/runtime-profiler.h"
+#include "src/execution/tiering-profile.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/maybe-handles.h"
 #include "src/heap/heap-inl.h"
@@ -52,6 +54,7 @@
 #include "src/parsing/pending-compilation-error-handler.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/snapshot/process-wide-code-cache.h"
 #include "src/utils/ostreams.h"
 #include "src/zone/zone-list-inl.h"  // crbug.com/v8/8816
 
@@ -190,6 +193,12 @@ struct ScopedTimer {
 
 namespace {
 
+bool IsLoggingFunctionCompilation(Isolate* isolate) {
+  return isolate->logger()->is_listening_to_code_events() ||
+         isolate->is_profiling() || FLAG_log_function_events ||
+         isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+}
+
 void LogFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
                             Handle<SharedFunctionInfo> shared,
                             Handle<Script> script,
@@ -201,11 +210,7 @@ void LogFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
   // Log the code generation. If source information is available include
   // script name and line number. Check explicitly whether logging is
   // enabled as finding the line number is not free.
-  if (!isolate->logger()->is_listening_to_code_events() &&
-      !isolate->is_profiling() && !FLAG_log_function_events &&
-      !isolate->code_event_dispatcher()->IsListeningToCodeEvents()) {
-    return;
-  }
+  if (!IsLoggingFunctionCompilation(isolate)) return;
 
   int line_num = Script::GetLineNumber(script, shared->StartPosition()) + 1;
   int column_num = Script::GetColumnNumber(script, shared->StartPosition()) + 1;
@@ -884,6 +889,14 @@ void InsertCodeIntoOptimizedCodeCache(
   Handle<Code> code = compilation_info->code();
   Handle<JSFunction> function = compilation_info->closure();
   Handle<SharedFunctionInfo> shared(function->shared(), function->GetIsolate());
+  // Remembered in code caches created from now on, see
+  // --code-cache-optimization-hints.
+  shared->set_has_optimized_at_least_once(true);
+  shared->set_has_optimization_hint_from_code_cache(false);
+  if (TieringProfile* profile =
+          function->GetIsolate()->runtime_profiler()->tiering_profile()) {
+    profile->RecordOptimized(*shared);
+  }
   Handle<NativeContext> native_context(function->context().native_context(),
                                        function->GetIsolate());
   if (compilation_info->osr_offset().IsNone()) {
@@ -1195,6 +1208,102 @@ bool FailWithPendingException(Isolate* isolate, Handle<Script> script,
                                           parse_info->pending_error_handler());
 }
 
+// Constant pools that only hold Smis, strings, heap numbers and oddballs can
+// be hashed by value and shared, everything else is unique to its function
+// anyway. Returns false for other constant pools.
+bool HashConstantPool(FixedArray constant_pool, size_t* hash) {
+  size_t result = base::hash_value(constant_pool.length());
+  for (int i = 0; i < constant_pool.length(); i++) {
+    Object entry = constant_pool.get(i);
+    size_t entry_hash;
+    if (entry.IsSmi()) {
+      entry_hash = base::hash_value(Smi::ToInt(entry));
+    } else if (entry.IsHeapNumber()) {
+      entry_hash =
+          base::hash_value(HeapNumber::cast(entry).value_as_bits());
+    } else if (entry.IsString()) {
+      entry_hash = String::cast(entry).Hash();
+    } else if (entry.IsOddball()) {
+      entry_hash = base::hash_value(Oddball::cast(entry).kind());
+    } else {
+      return false;
+    }
+    result = base::hash_combine(result, entry_hash);
+  }
+  *hash = result;
+  return true;
+}
+
+bool ConstantPoolsAreEqual(FixedArray a, FixedArray b) {
+  if (a.length() != b.length()) return false;
+  for (int i = 0; i < a.length(); i++) {
+    Object a_entry = a.get(i);
+    Object b_entry = b.get(i);
+    if (a_entry == b_entry) continue;
+    // Heap numbers are allocated per function.
+    if (!a_entry.IsHeapNumber() || !b_entry.IsHeapNumber() ||
+        HeapNumber::cast(a_entry).value_as_bits() !=
+            HeapNumber::cast(b_entry).value_as_bits()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ByteArraysAreEqual(ByteArray a, ByteArray b) {
+  return a.length() == b.length() &&
+         memcmp(a.GetDataStartAddress(), b.GetDataStartAddress(),
+                a.length()) == 0;
+}
+
+// With --ignition-dedupe-bytecode-metadata, lets the functions that were
+// compiled together share identical constant pools and handler tables, which
+// are never written to once the BytecodeArray has been created.
+void DeduplicateBytecodeMetadata(
+    Isolate* isolate, const FinalizeUnoptimizedCompilationDataList&
+                          finalize_unoptimized_compilation_data_list) {
+  DisallowHeapAllocation no_gc;
+  std::unordered_multimap<size_t, FixedArray> constant_pools;
+  std::unordered_multimap<size_t, ByteArray> handler_tables;
+  ReadOnlyRoots roots(isolate);
+  for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
+    SharedFunctionInfo shared_info = *finalize_data.function_handle();
+    if (!shared_info.HasBytecodeArray()) continue;
+    BytecodeArray bytecode = shared_info.GetBytecodeArray();
+
+    FixedArray constant_pool = bytecode.constant_pool();
+    size_t hash;
+    if (constant_pool != roots.empty_fixed_array() &&
+        HashConstantPool(constant_pool, &hash)) {
+      auto range = constant_pools.equal_range(hash);
+      auto it = std::find_if(range.first, range.second, [=](auto& entry) {
+        return ConstantPoolsAreEqual(entry.second, constant_pool);
+      });
+      if (it == range.second) {
+        constant_pools.emplace(hash, constant_pool);
+      } else {
+        bytecode.set_constant_pool(it->second);
+      }
+    }
+
+    ByteArray handler_table = bytecode.handler_table();
+    if (handler_table.length() != 0) {
+      size_t table_hash = base::hash_range(
+          handler_table.GetDataStartAddress(),
+          handler_table.GetDataStartAddress() + handler_table.length());
+      auto range = handler_tables.equal_range(table_hash);
+      auto it = std::find_if(range.first, range.second, [=](auto& entry) {
+        return ByteArraysAreEqual(entry.second, handler_table);
+      });
+      if (it == range.second) {
+        handler_tables.emplace(table_hash, handler_table);
+      } else {
+        bytecode.set_handler_table(it->second);
+      }
+    }
+  }
+}
+
 void FinalizeUnoptimizedCompilation(
     Isolate* isolate, Handle<Script> script,
     const UnoptimizedCompileFlags& flags,
@@ -1205,10 +1314,28 @@ void FinalizeUnoptimizedCompilation(
     compile_state->pending_error_handler()->ReportWarnings(isolate, script);
   }
 
+  if (FLAG_ignition_dedupe_bytecode_metadata) {
+    DeduplicateBytecodeMetadata(isolate,
+                                finalize_unoptimized_compilation_data_list);
+  }
+
   bool need_source_positions = FLAG_stress_lazy_source_positions ||
                                (!flags.collect_source_positions() &&
                                 isolate->NeedsSourcePositionsForProfiling());
 
+  // The functions have already been fully set up, possibly on a background
+  // thread. Unless something observes each of them, don't touch them again
+  // here, so that finalizing a script that was finalized off-thread does not
+  // scale with its number of functions.
+  Counters* counters = isolate->counters();
+  if (!need_source_positions && !FLAG_interpreted_frames_native_stack &&
+      !flags.block_coverage_enabled() &&
+      !IsLoggingFunctionCompilation(isolate) &&
+      !counters->total_baseline_code_size()->Enabled() &&
+      !counters->total_baseline_compile_count()->Enabled()) {
+    return;
+  }
+
   for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
     Handle<SharedFunctionInfo> shared_info = finalize_data.function_handle();
     // It's unlikely, but possible, that the bytecode was flushed between being
@@ -1753,6 +1880,11 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
 
   Handle<Script> script(Script::cast(shared_info->script()), isolate);
 
+  if (shared_info->has_flushed_bytecode()) {
+    isolate->heap()->RecordRecompiledFlushedFunction();
+    shared_info->set_has_flushed_bytecode(false);
+  }
+
   // Set up parse info.
   UnoptimizedCompileFlags flags =
       UnoptimizedCompileFlags::ForFunctionCompile(isolate, *shared_info);
@@ -2622,6 +2754,15 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnBothBackgroundAndMainThread(
   return maybe_result;
 }
 
+bool UseProcessWideCodeCache(ScriptCompiler::CompileOptions compile_options,
+                             NativesFlag natives) {
+  // Embedder-provided code caches take precedence, and eager compiles are
+  // expected to produce fully compiled results.
+  return FLAG_process_wide_code_cache &&
+         compile_options == ScriptCompiler::kNoCompileOptions &&
+         natives == NOT_NATIVES_CODE;
+}
+
 }  // namespace
 
 // static
@@ -2668,6 +2809,23 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
         language_mode);
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
+    } else if (UseProcessWideCodeCache(compile_options, natives)) {
+      // Then check whether another isolate already compiled this script.
+      HistogramTimerScope timer(isolate->counters()->compile_deserialize());
+      RuntimeCallTimerScope runtimeTimer(
+          isolate, RuntimeCallCounterId::kCompileDeserialize);
+      Handle<SharedFunctionInfo> inner_result;
+      if (ProcessWideCodeCache::Get()
+              ->Lookup(isolate, source, script_details.name_obj,
+                       script_details.line_offset, script_details.column_offset,
+                       origin_options)
+              .ToHandle(&inner_result)) {
+        is_compiled_scope = inner_result->is_compiled_scope(isolate);
+        DCHECK(is_compiled_scope.is_compiled());
+        compilation_cache->PutScript(source, isolate->native_context(),
+                                     language_mode, inner_result);
+        maybe_result = inner_result;
+      }
     } else if (can_consume_code_cache) {
       compile_timer.set_consuming_code_cache();
       // Then check cached code provided by embedder.
@@ -2724,6 +2882,12 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, isolate->native_context(),
                                    language_mode, result);
+      if (UseProcessWideCodeCache(compile_options, natives)) {
+        ProcessWideCodeCache::Get()->Put(
+            isolate, source, script_details.name_obj,
+            script_details.line_offset, script_details.column_offset,
+            origin_options, result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -3016,6 +3180,20 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
 }
 
 // static
+namespace {
+
+// Break points can be set while a concurrent job is running. Code compiled
+// from a function that has break info now must not be installed.
+bool InlinesFunctionWithBreakInfo(OptimizedCompilationInfo* compilation_info) {
+  if (compilation_info->shared_info()->HasBreakInfo()) return true;
+  for (const auto& inlined : compilation_info->inlined_functions()) {
+    if (inlined.shared_info->HasBreakInfo()) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
                                                Isolate* isolate) {
   VMState<COMPILER> state(isolate);
@@ -3039,16 +3217,17 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
     compilation_info->closure()->feedback_vector().set_profiler_ticks(0);
   }
 
-  DCHECK(!shared->HasBreakInfo());
-
   // 1) Optimization on the concurrent thread may have failed.
   // 2) The function may have already been optimized by OSR.  Simply continue.
   //    Except when OSR already disabled optimization for some reason.
   // 3) The code may have already been invalidated due to dependency change.
-  // 4) Code generation may have failed.
+  // 4) Break points may have been set in the function or its inlinees.
+  // 5) Code generation may have failed.
   if (job->state() == CompilationJob::State::kReadyToFinalize) {
     if (shared->optimization_disabled()) {
       job->RetryOptimization(BailoutReason::kOptimizationDisabled);
+    } else if (InlinesFunctionWithBreakInfo(compilation_info)) {
+      job->RetryOptimization(BailoutReason::kFunctionBeingDebugged);
     } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
       job->RecordCompilationStats(OptimizedCompilationJob::kConcurrent,
                                   isolate);
@@ -831,6 +831,7 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
   // Unconditional jump to L
   void jmp(Label* L, Label::Distance distance = Label::kFar);
   void jmp(Handle<Code> target, RelocInfo::Mode rmode);
+  void jmp(Address entry, RelocInfo::Mode rmode);
 
   // Jump near absolute indirect (r64)
   void jmp(Register adr);
@@ -1295,6 +1296,14 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
   void vmovddup(XMMRegister dst, Operand src);
   void vbroadcastss(XMMRegister dst, Operand src);
 
+  // AVX2 instruction
+  void vpbroadcastb(XMMRegister dst, XMMRegister src);
+  void vpbroadcastb(XMMRegister dst, Operand src);
+  void vpbroadcastw(XMMRegister dst, XMMRegister src);
+  void vpbroadcastw(XMMRegister dst, Operand src);
+  void vpbroadcastd(XMMRegister dst, XMMRegister src);
+  void vpbroadcastd(XMMRegister dst, Operand src);
+
   void fma_instr(byte op, XMMRegister dst, XMMRegister src1, XMMRegister src2,
                  VectorLength l, SIMDPrefix pp, LeadingOpcode m, VexW w);
   void fma_instr(byte op, XMMRegister dst, XMMRegister src1, Operand src2,
@@ -1549,8 +1549,12 @@ void TurboAssembler::Jump(Handle<Code> code_object, RelocInfo::Mode rmode,
       CHECK_NE(builtin_index, Builtins::kNoBuiltinId);
       EmbeddedData d = EmbeddedData::FromBlob();
       Address entry = d.InstructionStartOfBuiltin(builtin_index);
-      Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
-      jmp(kScratchRegister);
+      if (options().short_builtin_calls) {
+        jmp(entry, RelocInfo::RUNTIME_ENTRY);
+      } else {
+        Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
+        jmp(kScratchRegister);
+      }
       bind(&skip);
       return;
     }
@@ -1631,8 +1635,15 @@ void TurboAssembler::CallBuiltin(int builtin_index) {
   CHECK_NE(builtin_index, Builtins::kNoBuiltinId);
   EmbeddedData d = EmbeddedData::FromBlob();
   Address entry = d.InstructionStartOfBuiltin(builtin_index);
-  Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
-  call(kScratchRegister);
+  if (options().short_builtin_calls) {
+    // The embedded blob is within reach of the whole code range, so the
+    // call can be pc-relative. It is a runtime entry so that the offset is
+    // updated when the code object moves.
+    call(entry, RelocInfo::RUNTIME_ENTRY);
+  } else {
+    Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
+    call(kScratchRegister);
+  }
 }
 
 void TurboAssembler::LoadCodeObjectEntry(Register destination,
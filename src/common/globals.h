@@ -246,6 +246,10 @@ constexpr size_t kMinExpectedOSPageSize = 4 * KB;  // OS page.
 constexpr size_t kReservedCodeRangePages = 0;
 #endif
 
+// Size of a transparent huge page on the platforms that support them. Heap
+// reservations are aligned to it when --huge-pages is enabled.
+constexpr size_t kHugePageSize = 2 * MB;
+
 STATIC_ASSERT(kSystemPointerSize == (1 << kSystemPointerSizeLog2));
 
 #ifdef V8_COMPRESS_ZONES
@@ -258,6 +262,10 @@ STATIC_ASSERT(kSystemPointerSize == (1 << kSystemPointerSizeLog2));
 // TurboFan graphs or not.
 static constexpr bool kCompressGraphZone = COMPRESS_ZONES_BOOL;
 
+// The flag controls whether zones pointer compression should be enabled for
+// TurboFan instruction sequences or not.
+static constexpr bool kCompressInstructionZone = COMPRESS_ZONES_BOOL;
+
 #ifdef V8_COMPRESS_POINTERS
 static_assert(
     kSystemPointerSize == kInt64Size,
@@ -235,11 +235,25 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  // Large functions take by far the longest to compile. Starting them first
+  // gets them out of the interpreter sooner and shortens the time until the
+  // whole queue is drained, as the small jobs fill up the other workers.
+  OptimizedCompilationInfo* info = job->compilation_info();
+  const bool is_large =
+      info->has_bytecode_array() &&
+      info->bytecode_array()->length() >=
+          FLAG_concurrent_recompilation_large_bytecode_size;
   {
-    // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    if (is_large) {
+      // Add job to the front of the input queue.
+      input_queue_shift_ = InputQueueIndex(input_queue_capacity_ - 1);
+      input_queue_[InputQueueIndex(0)] = job;
+    } else {
+      // Add job to the back of the input queue.
+      input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    }
     input_queue_length_++;
   }
   if (FLAG_block_concurrent_recompilation) {
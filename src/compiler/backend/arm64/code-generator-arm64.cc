@@ -457,40 +457,73 @@ void EmitFpOrNeonUnop(TurboAssembler* tasm, Fn fn, Instruction* instr,
     __ asm_instr(i.Input##reg(2), i.TempRegister(0));                  \
   } while (0)
 
-#define ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(load_instr, store_instr, reg)       \
-  do {                                                                       \
-    Label exchange;                                                          \
-    __ Add(i.TempRegister(0), i.InputRegister(0), i.InputRegister(1));       \
-    __ Bind(&exchange);                                                      \
-    __ load_instr(i.Output##reg(), i.TempRegister(0));                       \
-    __ store_instr(i.TempRegister32(1), i.Input##reg(2), i.TempRegister(0)); \
-    __ Cbnz(i.TempRegister32(1), &exchange);                                 \
+// The atomic read-modify-write operations use the single-instruction LSE
+// forms when available, and exclusive load/store loops otherwise.
+#define ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(load_instr, store_instr, lse_instr,  \
+                                         reg)                                 \
+  do {                                                                        \
+    __ Add(i.TempRegister(0), i.InputRegister(0), i.InputRegister(1));        \
+    if (CpuFeatures::IsSupported(LSE)) {                                      \
+      __ lse_instr(i.Input##reg(2), i.Output##reg(), i.TempRegister(0));      \
+    } else {                                                                  \
+      Label exchange;                                                         \
+      __ Bind(&exchange);                                                     \
+      __ load_instr(i.Output##reg(), i.TempRegister(0));                      \
+      __ store_instr(i.TempRegister32(1), i.Input##reg(2),                    \
+                     i.TempRegister(0));                                      \
+      __ Cbnz(i.TempRegister32(1), &exchange);                                \
+    }                                                                         \
   } while (0)
 
-#define ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(load_instr, store_instr, ext, \
-                                                 reg)                          \
-  do {                                                                         \
-    Label compareExchange;                                                     \
-    Label exit;                                                                \
-    __ Add(i.TempRegister(0), i.InputRegister(0), i.InputRegister(1));         \
-    __ Bind(&compareExchange);                                                 \
-    __ load_instr(i.Output##reg(), i.TempRegister(0));                         \
-    __ Cmp(i.Output##reg(), Operand(i.Input##reg(2), ext));                    \
-    __ B(ne, &exit);                                                           \
-    __ store_instr(i.TempRegister32(1), i.Input##reg(3), i.TempRegister(0));   \
-    __ Cbnz(i.TempRegister32(1), &compareExchange);                            \
-    __ Bind(&exit);                                                            \
+#define ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(load_instr, store_instr,     \
+                                                 lse_instr, ext, reg)         \
+  do {                                                                        \
+    __ Add(i.TempRegister(0), i.InputRegister(0), i.InputRegister(1));        \
+    if (CpuFeatures::IsSupported(LSE)) {                                      \
+      /* Only the low bits of the expected value are compared. */             \
+      __ Mov(i.Output##reg(), i.Input##reg(2));                               \
+      __ lse_instr(i.Output##reg(), i.Input##reg(3), i.TempRegister(0));      \
+    } else {                                                                  \
+      Label compareExchange;                                                  \
+      Label exit;                                                             \
+      __ Bind(&compareExchange);                                              \
+      __ load_instr(i.Output##reg(), i.TempRegister(0));                      \
+      __ Cmp(i.Output##reg(), Operand(i.Input##reg(2), ext));                 \
+      __ B(ne, &exit);                                                        \
+      __ store_instr(i.TempRegister32(1), i.Input##reg(3),                    \
+                     i.TempRegister(0));                                      \
+      __ Cbnz(i.TempRegister32(1), &compareExchange);                         \
+      __ Bind(&exit);                                                         \
+    }                                                                         \
   } while (0)
 
-#define ASSEMBLE_ATOMIC_BINOP(load_instr, store_instr, bin_instr, reg)       \
-  do {                                                                       \
-    Label binop;                                                             \
-    __ Add(i.TempRegister(0), i.InputRegister(0), i.InputRegister(1));       \
-    __ Bind(&binop);                                                         \
-    __ load_instr(i.Output##reg(), i.TempRegister(0));                       \
-    __ bin_instr(i.Temp##reg(1), i.Output##reg(), Operand(i.Input##reg(2))); \
-    __ store_instr(i.TempRegister32(2), i.Temp##reg(1), i.TempRegister(0));  \
-    __ Cbnz(i.TempRegister32(2), &binop);                                    \
+// LSE has no atomic subtract or and; they are done as an add of the negated
+// value and a bit clear of the inverted value.
+#define LSE_OPERAND(value, temp)
+#define LSE_OPERAND_NEG(value, temp) \
+  __ Neg(temp, value);               \
+  value = temp;
+#define LSE_OPERAND_MVN(value, temp) \
+  __ Mvn(temp, value);               \
+  value = temp;
+
+#define ASSEMBLE_ATOMIC_BINOP(load_instr, store_instr, bin_instr, lse_instr,  \
+                              lse_operand, reg)                               \
+  do {                                                                        \
+    __ Add(i.TempRegister(0), i.InputRegister(0), i.InputRegister(1));        \
+    if (CpuFeatures::IsSupported(LSE)) {                                      \
+      Register value = i.Input##reg(2);                                       \
+      lse_operand(value, i.Temp##reg(1));                                     \
+      __ lse_instr(value, i.Output##reg(), i.TempRegister(0));                \
+    } else {                                                                  \
+      Label binop;                                                            \
+      __ Bind(&binop);                                                        \
+      __ load_instr(i.Output##reg(), i.TempRegister(0));                      \
+      __ bin_instr(i.Temp##reg(1), i.Output##reg(),                           \
+                   Operand(i.Input##reg(2)));                                 \
+      __ store_instr(i.TempRegister32(2), i.Temp##reg(1), i.TempRegister(0)); \
+      __ Cbnz(i.TempRegister32(2), &binop);                                   \
+    }                                                                         \
   } while (0)
 
 #define ASSEMBLE_IEEE754_BINOP(name)                                        \
@@ -1824,85 +1857,96 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       ASSEMBLE_ATOMIC_STORE_INTEGER(Stlr, Register);
       break;
     case kWord32AtomicExchangeInt8:
-      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrb, stlxrb, Register32);
+      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrb, stlxrb, swpalb, Register32);
       __ Sxtb(i.OutputRegister(0), i.OutputRegister(0));
       break;
     case kWord32AtomicExchangeUint8:
     case kArm64Word64AtomicExchangeUint8:
-      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrb, stlxrb, Register32);
+      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrb, stlxrb, swpalb, Register32);
       break;
     case kWord32AtomicExchangeInt16:
-      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrh, stlxrh, Register32);
+      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrh, stlxrh, swpalh, Register32);
       __ Sxth(i.OutputRegister(0), i.OutputRegister(0));
       break;
     case kWord32AtomicExchangeUint16:
     case kArm64Word64AtomicExchangeUint16:
-      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrh, stlxrh, Register32);
+      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxrh, stlxrh, swpalh, Register32);
       break;
     case kWord32AtomicExchangeWord32:
     case kArm64Word64AtomicExchangeUint32:
-      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxr, stlxr, Register32);
+      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxr, stlxr, swpal, Register32);
       break;
     case kArm64Word64AtomicExchangeUint64:
-      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxr, stlxr, Register);
+      ASSEMBLE_ATOMIC_EXCHANGE_INTEGER(ldaxr, stlxr, swpal, Register);
       break;
     case kWord32AtomicCompareExchangeInt8:
-      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrb, stlxrb, UXTB,
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrb, stlxrb, casalb, UXTB,
                                                Register32);
       __ Sxtb(i.OutputRegister(0), i.OutputRegister(0));
       break;
     case kWord32AtomicCompareExchangeUint8:
     case kArm64Word64AtomicCompareExchangeUint8:
-      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrb, stlxrb, UXTB,
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrb, stlxrb, casalb, UXTB,
                                                Register32);
       break;
     case kWord32AtomicCompareExchangeInt16:
-      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrh, stlxrh, UXTH,
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrh, stlxrh, casalh, UXTH,
                                                Register32);
       __ Sxth(i.OutputRegister(0), i.OutputRegister(0));
       break;
     case kWord32AtomicCompareExchangeUint16:
     case kArm64Word64AtomicCompareExchangeUint16:
-      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrh, stlxrh, UXTH,
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxrh, stlxrh, casalh, UXTH,
                                                Register32);
       break;
     case kWord32AtomicCompareExchangeWord32:
     case kArm64Word64AtomicCompareExchangeUint32:
-      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxr, stlxr, UXTW, Register32);
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxr, stlxr, casal, UXTW,
+                                               Register32);
       break;
     case kArm64Word64AtomicCompareExchangeUint64:
-      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxr, stlxr, UXTX, Register);
-      break;
-#define ATOMIC_BINOP_CASE(op, inst)                          \
-  case kWord32Atomic##op##Int8:                              \
-    ASSEMBLE_ATOMIC_BINOP(ldaxrb, stlxrb, inst, Register32); \
-    __ Sxtb(i.OutputRegister(0), i.OutputRegister(0));       \
-    break;                                                   \
-  case kWord32Atomic##op##Uint8:                             \
-  case kArm64Word64Atomic##op##Uint8:                        \
-    ASSEMBLE_ATOMIC_BINOP(ldaxrb, stlxrb, inst, Register32); \
-    break;                                                   \
-  case kWord32Atomic##op##Int16:                             \
-    ASSEMBLE_ATOMIC_BINOP(ldaxrh, stlxrh, inst, Register32); \
-    __ Sxth(i.OutputRegister(0), i.OutputRegister(0));       \
-    break;                                                   \
-  case kWord32Atomic##op##Uint16:                            \
-  case kArm64Word64Atomic##op##Uint16:                       \
-    ASSEMBLE_ATOMIC_BINOP(ldaxrh, stlxrh, inst, Register32); \
-    break;                                                   \
-  case kWord32Atomic##op##Word32:                            \
-  case kArm64Word64Atomic##op##Uint32:                       \
-    ASSEMBLE_ATOMIC_BINOP(ldaxr, stlxr, inst, Register32);   \
-    break;                                                   \
-  case kArm64Word64Atomic##op##Uint64:                       \
-    ASSEMBLE_ATOMIC_BINOP(ldaxr, stlxr, inst, Register);     \
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_INTEGER(ldaxr, stlxr, casal, UXTX,
+                                               Register);
+      break;
+#define ATOMIC_BINOP_CASE(op, inst, lse_instr, lse_operand)                \
+  case kWord32Atomic##op##Int8:                                            \
+    ASSEMBLE_ATOMIC_BINOP(ldaxrb, stlxrb, inst, lse_instr##b, lse_operand, \
+                          Register32);                                     \
+    __ Sxtb(i.OutputRegister(0), i.OutputRegister(0));                     \
+    break;                                                                 \
+  case kWord32Atomic##op##Uint8:                                           \
+  case kArm64Word64Atomic##op##Uint8:                                      \
+    ASSEMBLE_ATOMIC_BINOP(ldaxrb, stlxrb, inst, lse_instr##b, lse_operand, \
+                          Register32);                                     \
+    break;                                                                 \
+  case kWord32Atomic##op##Int16:                                           \
+    ASSEMBLE_ATOMIC_BINOP(ldaxrh, stlxrh, inst, lse_instr##h, lse_operand, \
+                          Register32);                                     \
+    __ Sxth(i.OutputRegister(0), i.OutputRegister(0));                     \
+    break;                                                                 \
+  case kWord32Atomic##op##Uint16:                                          \
+  case kArm64Word64Atomic##op##Uint16:                                     \
+    ASSEMBLE_ATOMIC_BINOP(ldaxrh, stlxrh, inst, lse_instr##h, lse_operand, \
+                          Register32);                                     \
+    break;                                                                 \
+  case kWord32Atomic##op##Word32:                                          \
+  case kArm64Word64Atomic##op##Uint32:                                     \
+    ASSEMBLE_ATOMIC_BINOP(ldaxr, stlxr, inst, lse_instr, lse_operand,      \
+                          Register32);                                     \
+    break;                                                                 \
+  case kArm64Word64Atomic##op##Uint64:                                     \
+    ASSEMBLE_ATOMIC_BINOP(ldaxr, stlxr, inst, lse_instr, lse_operand,      \
+                          Register);                                       \
     break;
-      ATOMIC_BINOP_CASE(Add, Add)
-      ATOMIC_BINOP_CASE(Sub, Sub)
-      ATOMIC_BINOP_CASE(And, And)
-      ATOMIC_BINOP_CASE(Or, Orr)
-      ATOMIC_BINOP_CASE(Xor, Eor)
+      ATOMIC_BINOP_CASE(Add, Add, ldaddal, LSE_OPERAND)
+      ATOMIC_BINOP_CASE(Sub, Sub, ldaddal, LSE_OPERAND_NEG)
+      ATOMIC_BINOP_CASE(And, And, ldclral, LSE_OPERAND_MVN)
+      ATOMIC_BINOP_CASE(Or, Orr, ldsetal, LSE_OPERAND)
+      ATOMIC_BINOP_CASE(Xor, Eor, ldeoral, LSE_OPERAND)
 #undef ATOMIC_BINOP_CASE
+#undef LSE_OPERAND
+#undef LSE_OPERAND_NEG
+#undef LSE_OPERAND_MVN
 #undef ASSEMBLE_SHIFT
 #undef ASSEMBLE_ATOMIC_LOAD_INTEGER
 #undef ASSEMBLE_ATOMIC_STORE_INTEGER
@@ -2,14 +2,40 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Cortex-A53 and Cortex-A55 are in-order: an instruction waiting for its
+// operands stalls the pipeline instead of being overtaken by independent ones,
+// so they benefit the most from scheduling.
+bool IsInOrderCore() {
+#ifdef USE_SIMULATOR
+  return false;
+#else
+  static const bool in_order = [] {
+    base::CPU cpu;
+    return cpu.implementer() == base::CPU::ARM &&
+           (cpu.part() == base::CPU::ARM_CORTEX_A53 ||
+            cpu.part() == base::CPU::ARM_CORTEX_A55);
+  }();
+  return in_order;
+#endif
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+bool InstructionScheduler::SchedulerEnabledByDefault() {
+  return IsInOrderCore();
+}
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   switch (instr->arch_opcode()) {
@@ -432,7 +458,9 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+namespace {
+
+int GetGenericInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for arm64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -584,6 +612,69 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   }
 }
 
+// Latencies of the Cortex-A55, following its Software Optimization Guide.
+// They are close to the Cortex-A53 ones. Out-of-order cores hide the load
+// latency much better, which the generic model accounts for.
+int GetInOrderInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrh:
+    case kArm64Ldrsb:
+    case kArm64Ldrsh:
+    case kArm64Ldrsw:
+      return 3;
+
+    case kArm64LdrDecompressTaggedSigned:
+    case kArm64LdrDecompressTaggedPointer:
+    case kArm64LdrDecompressAnyTagged:
+    case kArm64LdrD:
+    case kArm64LdrS:
+      return 4;
+
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+      return 4;
+
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+      return 4;
+
+    case kArm64Float32Div:
+      return 13;
+
+    case kArm64Float64Div:
+    case kArm64Float64Sqrt:
+      return 22;
+
+    case kArm64Float32RoundDown:
+    case kArm64Float32RoundTiesEven:
+    case kArm64Float32RoundTruncate:
+    case kArm64Float32RoundUp:
+    case kArm64Float64RoundDown:
+    case kArm64Float64RoundTiesAway:
+    case kArm64Float64RoundTiesEven:
+    case kArm64Float64RoundTruncate:
+    case kArm64Float64RoundUp:
+      return 4;
+
+    default:
+      return GetGenericInstructionLatency(instr);
+  }
+}
+
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (IsInOrderCore()) return GetInOrderInstructionLatency(instr);
+  return GetGenericInstructionLatency(instr);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
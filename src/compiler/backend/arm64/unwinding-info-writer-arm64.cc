@@ -30,6 +30,7 @@ void UnwindingInfoWriter::BeginInstructionBlock(int pc_offset,
       eh_frame_writer_.RecordRegisterSavedToStack(fp, 0);
     } else {
       eh_frame_writer_.RecordRegisterFollowsInitialRule(lr);
+      eh_frame_writer_.RecordRegisterNotModified(fp);
     }
     saved_lr_ = initial_state->saved_lr_;
   }
@@ -80,9 +81,11 @@ void UnwindingInfoWriter::MarkFrameConstructed(int at_pc) {
 void UnwindingInfoWriter::MarkFrameDeconstructed(int at_pc) {
   if (!enabled()) return;
 
-  // The lr is restored by the last operation in LeaveFrame().
+  // The lr is restored by the last operation in LeaveFrame(), together with
+  // the caller's fp.
   eh_frame_writer_.AdvanceLocation(at_pc);
   eh_frame_writer_.RecordRegisterFollowsInitialRule(lr);
+  eh_frame_writer_.RecordRegisterNotModified(fp);
   saved_lr_ = false;
 }
 
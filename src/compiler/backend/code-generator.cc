@@ -42,6 +42,24 @@ class CodeGenerator::JumpTable final : public ZoneObject {
   size_t const target_count_;
 };
 
+namespace {
+
+SourcePositionTableBuilder::RecordingMode SourcePositionRecordingMode(
+    OptimizedCompilationInfo* info) {
+  // Stack traces of optimized JavaScript code are computed from the
+  // deoptimization data, so the source position table is only needed by
+  // profilers, which ask for detailed positions (see
+  // Isolate::NeedsDetailedOptimizedCodeLineInfo) and deoptimize code that
+  // lacks them.
+  if (FLAG_lazy_optimized_source_positions && info->IsOptimizing() &&
+      !info->source_positions()) {
+    return SourcePositionTableBuilder::LAZY_SOURCE_POSITIONS;
+  }
+  return SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
+}
+
+}  // namespace
+
 CodeGenerator::CodeGenerator(
     Zone* codegen_zone, Frame* frame, Linkage* linkage,
     InstructionSequence* instructions, OptimizedCompilationInfo* info,
@@ -78,8 +96,8 @@ CodeGenerator::CodeGenerator(
       osr_helper_(std::move(osr_helper)),
       osr_pc_offset_(-1),
       optimized_out_literal_id_(-1),
-      source_position_table_builder_(
-          codegen_zone, SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS),
+      source_position_table_builder_(codegen_zone,
+                                     SourcePositionRecordingMode(info)),
       protected_instructions_(codegen_zone),
       result_(kSuccess),
       poisoning_level_(poisoning_level),
@@ -921,6 +939,10 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
 
   Handle<ByteArray> translation_array =
       translations_.CreateByteArray(isolate()->factory());
+  isolate()->counters()->deopt_translation_size()->Increment(
+      translation_array->length());
+  isolate()->counters()->deopt_translation_size_saved()->Increment(
+      translations_.deduplicated_size());
 
   data->SetTranslationByteArray(*translation_array);
   data->SetInlinedFunctionCount(
@@ -968,6 +990,8 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
     data->SetTranslationIndex(
         i, Smi::FromInt(deoptimization_exit->translation_id()));
     data->SetPc(i, Smi::FromInt(deoptimization_exit->pc_offset()));
+    data->SetDeoptReasonRaw(
+        i, Smi::FromInt(static_cast<int>(deoptimization_exit->reason())));
   }
 
   return data;
@@ -1163,9 +1187,12 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   InstructionOperandIterator iter(instr, frame_state_offset);
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, &translation,
                                           state_combine);
+  // Deopt points with the same frame state and operand locations, e.g.
+  // the checks of one lowered operation, can share their translation.
+  int translation_index = translations_.Deduplicate(translation.index());
 
   DeoptimizationExit* const exit = zone()->New<DeoptimizationExit>(
-      current_source_position_, descriptor->bailout_id(), translation.index(),
+      current_source_position_, descriptor->bailout_id(), translation_index,
       pc_offset, entry.kind(), entry.reason());
 
   if (!Deoptimizer::kSupportsFixedDeoptExitSizes) {
@@ -4,9 +4,12 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <algorithm>
+
 #include "src/base/iterator.h"
 #include "src/base/optional.h"
 #include "src/base/utils/random-number-generator.h"
+#include "src/codegen/register-configuration.h"
 
 namespace v8 {
 namespace internal {
@@ -27,12 +30,23 @@ void InstructionScheduler::SchedulingQueueBase::AddNode(
 InstructionScheduler::ScheduleGraphNode*
 InstructionScheduler::CriticalPathFirstQueue::PopBestCandidate(int cycle) {
   DCHECK(!IsEmpty());
+  const bool high_register_pressure = scheduler_->HasHighRegisterPressure();
   auto candidate = nodes_.end();
+  int candidate_delta = 0;
   for (auto iterator = nodes_.begin(); iterator != nodes_.end(); ++iterator) {
     // We only consider instructions that have all their operands ready.
     if (cycle >= (*iterator)->start_cycle()) {
-      candidate = iterator;
-      break;
+      if (!high_register_pressure) {
+        candidate = iterator;
+        break;
+      }
+      // Among the ready nodes, pick the one reducing the number of live
+      // values the most. Ties go to the one with the highest total latency.
+      int delta = (*iterator)->LiveValuesDelta();
+      if (candidate == nodes_.end() || delta < candidate_delta) {
+        candidate = iterator;
+        candidate_delta = delta;
+      }
     }
   }
 
@@ -61,7 +75,9 @@ InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
                                                            Instruction* instr)
     : instr_(instr),
       successors_(zone),
+      operand_definitions_(zone),
       unscheduled_predecessors_count_(0),
+      unscheduled_uses_(0),
       latency_(GetInstructionLatency(instr)),
       total_latency_(-1),
       start_cycle_(-1) {}
@@ -72,6 +88,24 @@ void InstructionScheduler::ScheduleGraphNode::AddSuccessor(
   node->unscheduled_predecessors_count_++;
 }
 
+void InstructionScheduler::ScheduleGraphNode::AddOperandDefinition(
+    ScheduleGraphNode* node) {
+  if (std::find(operand_definitions_.begin(), operand_definitions_.end(),
+                node) != operand_definitions_.end()) {
+    return;
+  }
+  operand_definitions_.push_back(node);
+  node->unscheduled_uses_++;
+}
+
+int InstructionScheduler::ScheduleGraphNode::LiveValuesDelta() const {
+  int delta = unscheduled_uses_ > 0 ? 1 : 0;
+  for (ScheduleGraphNode* definition : operand_definitions_) {
+    if (definition->unscheduled_uses() == 1) delta--;
+  }
+  return delta;
+}
+
 InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
@@ -81,7 +115,10 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
       last_deopt_or_trap_(nullptr),
-      operands_map_(zone) {
+      operands_map_(zone),
+      live_values_(0),
+      register_pressure_limit_(RegisterConfiguration::Default()
+                                   ->num_allocatable_general_registers()) {
   if (FLAG_turbo_stress_instruction_scheduling) {
     random_number_generator_ =
         base::Optional<base::RandomNumberGenerator>(FLAG_random_seed);
@@ -185,6 +222,7 @@ void InstructionScheduler::AddInstruction(Instruction* instr) {
         auto it = operands_map_.find(vreg);
         if (it != operands_map_.end()) {
           it->second->AddSuccessor(new_node);
+          new_node->AddOperandDefinition(it->second);
         }
       }
     }
@@ -226,6 +264,7 @@ void InstructionScheduler::Schedule() {
 
     if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
+      UpdateLiveValues(candidate);
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
         successor->DropUnscheduledPredecessor();
@@ -242,6 +281,7 @@ void InstructionScheduler::Schedule() {
   }
 
   // Reset own state.
+  DCHECK_EQ(0, live_values_);
   graph_.clear();
   operands_map_.clear();
   pending_loads_.clear();
@@ -250,6 +290,14 @@ void InstructionScheduler::Schedule() {
   last_side_effect_instr_ = nullptr;
 }
 
+void InstructionScheduler::UpdateLiveValues(ScheduleGraphNode* node) {
+  for (ScheduleGraphNode* definition : node->operand_definitions()) {
+    definition->DropUnscheduledUse();
+    if (definition->unscheduled_uses() == 0) live_values_--;
+  }
+  if (node->unscheduled_uses() > 0) live_values_++;
+}
+
 int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
   switch (instr->arch_opcode()) {
     case kArchNop:
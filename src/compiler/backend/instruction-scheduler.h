@@ -48,6 +48,11 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Whether the target CPU benefits enough from scheduling to enable it
+  // without --turbo-instruction-scheduling, see
+  // --turbo-instruction-scheduling-by-cpu.
+  static bool SchedulerEnabledByDefault();
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
@@ -81,13 +86,35 @@ class InstructionScheduler final : public ZoneObject {
     int start_cycle() const { return start_cycle_; }
     void set_start_cycle(int start_cycle) { start_cycle_ = start_cycle; }
 
+    // Record that this instruction uses a value defined by 'node' in the same
+    // block.
+    void AddOperandDefinition(ScheduleGraphNode* node);
+    ZoneDeque<ScheduleGraphNode*>& operand_definitions() {
+      return operand_definitions_;
+    }
+
+    // Number of unscheduled instructions in the block using the values
+    // defined by this instruction.
+    int unscheduled_uses() const { return unscheduled_uses_; }
+    void DropUnscheduledUse() {
+      DCHECK_LT(0, unscheduled_uses_);
+      unscheduled_uses_--;
+    }
+
+    // The change in the number of values live within the block when this
+    // instruction is scheduled next.
+    int LiveValuesDelta() const;
+
    private:
     Instruction* instr_;
     ZoneDeque<ScheduleGraphNode*> successors_;
+    ZoneDeque<ScheduleGraphNode*> operand_definitions_;
 
     // Number of unscheduled predecessors for this node.
     int unscheduled_predecessors_count_;
 
+    int unscheduled_uses_;
+
     // Estimate of the instruction latency (the number of cycles it takes for
     // instruction to complete).
     int latency_;
@@ -123,7 +150,9 @@ class InstructionScheduler final : public ZoneObject {
 
   // A scheduling queue which prioritize nodes on the critical path (we look
   // for the instruction with the highest latency on the path to reach the end
-  // of the graph).
+  // of the graph). When the number of values live within the block reaches
+  // the number of allocatable registers, it instead picks the ready node
+  // ending the most live ranges, to avoid causing spills.
   class CriticalPathFirstQueue : public SchedulingQueueBase {
    public:
     explicit CriticalPathFirstQueue(InstructionScheduler* scheduler)
@@ -206,6 +235,13 @@ class InstructionScheduler final : public ZoneObject {
 
   static int GetInstructionLatency(const Instruction* instr);
 
+  // Track the number of values defined in the current block which are still
+  // used by unscheduled instructions.
+  void UpdateLiveValues(ScheduleGraphNode* node);
+  bool HasHighRegisterPressure() const {
+    return live_values_ >= register_pressure_limit_;
+  }
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   base::RandomNumberGenerator* random_number_generator() {
@@ -241,6 +277,12 @@ class InstructionScheduler final : public ZoneObject {
   // record operand dependencies in the scheduling graph.
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
 
+  // Number of values live within the block at the current point of the
+  // schedule, and the number above which the register allocator would have to
+  // spill.
+  int live_values_;
+  const int register_pressure_limit_;
+
   base::Optional<base::RandomNumberGenerator> random_number_generator_;
 };
 
@@ -22,6 +22,7 @@
 #include "src/compiler/opcodes.h"
 #include "src/numbers/double.h"
 #include "src/zone/zone-allocator.h"
+#include "src/zone/zone-type-traits.h"
 
 namespace v8 {
 namespace internal {
@@ -899,7 +900,7 @@ class V8_EXPORT_PRIVATE Instruction final {
 
   void set_reference_map(ReferenceMap* map) {
     DCHECK(NeedsReferenceMap());
-    DCHECK(!reference_map_);
+    DCHECK(reference_map_ == nullptr);
     reference_map_ = map;
   }
 
@@ -1004,11 +1005,15 @@ class V8_EXPORT_PRIVATE Instruction final {
 
   using IsCallField = base::BitField<bool, 30, 1>;
 
+  // Reference maps and blocks are allocated in the instruction zone, so the
+  // pointers to them may be compressed.
+  using ZoneTraits = ZoneTypeTraits<kCompressInstructionZone>;
+
   InstructionCode opcode_;
   uint32_t bit_field_;
   ParallelMove* parallel_moves_[2];
-  ReferenceMap* reference_map_;
-  InstructionBlock* block_;
+  ZoneTraits::Ptr<ReferenceMap> reference_map_;
+  ZoneTraits::Ptr<InstructionBlock> block_;
   InstructionOperand operands_[1];
 };
 
@@ -11,6 +11,8 @@ namespace compiler {
 
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+bool InstructionScheduler::SchedulerEnabledByDefault() { return false; }
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   switch (instr->arch_opcode()) {
@@ -221,6 +221,9 @@ class BytecodeGraphBuilder {
     kOwn,
   };
   void BuildNamedStore(StoreMode store_mode);
+  // Builds the load of LdaNamedProperty, whose operands start at
+  // |first_operand_index|.
+  void BuildNamedLoad(int first_operand_index);
   void BuildLdaLookupSlot(TypeofMode typeof_mode);
   void BuildLdaLookupContextSlot(TypeofMode typeof_mode);
   void BuildLdaLookupGlobalSlot(TypeofMode typeof_mode);
@@ -2010,12 +2013,23 @@ void BytecodeGraphBuilder::VisitStaLookupSlot() {
 
 void BytecodeGraphBuilder::VisitLdaNamedProperty() {
   PrepareEagerCheckpoint();
-  Node* object =
-      environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
-  NameRef name(broker(),
-               bytecode_iterator().GetConstantForIndexOperand(1, isolate()));
-  FeedbackSource feedback =
-      CreateFeedbackSource(bytecode_iterator().GetIndexOperand(2));
+  BuildNamedLoad(0);
+}
+
+void BytecodeGraphBuilder::VisitStarLdaNamedProperty() {
+  // An eager deopt reexecutes the Star too, which doesn't matter.
+  PrepareEagerCheckpoint();
+  VisitStar();
+  BuildNamedLoad(1);
+}
+
+void BytecodeGraphBuilder::BuildNamedLoad(int first_operand_index) {
+  Node* object = environment()->LookupRegister(
+      bytecode_iterator().GetRegisterOperand(first_operand_index));
+  NameRef name(broker(), bytecode_iterator().GetConstantForIndexOperand(
+                             first_operand_index + 1, isolate()));
+  FeedbackSource feedback = CreateFeedbackSource(
+      bytecode_iterator().GetIndexOperand(first_operand_index + 2));
   const Operator* op = javascript()->LoadNamed(name.object(), feedback);
 
   JSTypeHintLowering::LoweringResult lowering =
@@ -24,6 +24,7 @@
 #include "src/execution/frames.h"
 #include "src/heap/factory-inl.h"
 #include "src/objects/heap-number.h"
+#include "src/objects/js-array-buffer.h"
 #include "src/objects/oddball.h"
 #include "src/objects/ordered-hash-table.h"
 
@@ -246,6 +247,10 @@ class EffectControlLinearizer {
   Node* IsElementsKindGreaterThan(Node* kind, ElementsKind reference_kind);
 
   Node* BuildTypedArrayDataPointer(Node* base, Node* external);
+  Node* AdaptFastCallUint8ArrayArgument(Node* value,
+                                        GraphAssemblerLabel<0>* if_error);
+  Node* AdaptFastCallOneByteStringArgument(Node* value,
+                                           GraphAssemblerLabel<0>* if_error);
 
   template <typename... Args>
   Node* CallBuiltin(Builtins::Name builtin, Operator::Properties properties,
@@ -5039,9 +5044,95 @@ static MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::Float64();
     case CTypeInfo::Type::kV8Value:
       return MachineType::AnyTagged();
+    case CTypeInfo::Type::kUint8Array:
+    case CTypeInfo::Type::kOneByteString:
+      return MachineType::Pointer();
   }
 }
 
+// Passes the elements of a Uint8Array {value} to a fast API call as a
+// v8::FastApiUint8Array in a stack slot, or jumps to {if_error} if {value}
+// is something else or its buffer was detached.
+Node* EffectControlLinearizer::AdaptFastCallUint8ArrayArgument(
+    Node* value, GraphAssemblerLabel<0>* if_error) {
+  __ GotoIf(ObjectIsSmi(value), if_error);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  __ GotoIfNot(__ Word32Equal(value_instance_type,
+                              __ Int32Constant(JS_TYPED_ARRAY_TYPE)),
+               if_error);
+  Node* bit_field2 = __ LoadField(AccessBuilder::ForMapBitField2(), value_map);
+  Node* kind = __ Word32Shr(
+      __ Word32And(bit_field2,
+                   __ Int32Constant(Map::Bits2::ElementsKindBits::kMask)),
+      __ Int32Constant(Map::Bits2::ElementsKindBits::kShift));
+  __ GotoIfNot(__ Word32Equal(kind, __ Int32Constant(UINT8_ELEMENTS)),
+               if_error);
+  Node* buffer =
+      __ LoadField(AccessBuilder::ForJSArrayBufferViewBuffer(), value);
+  Node* buffer_bit_field =
+      __ LoadField(AccessBuilder::ForJSArrayBufferBitField(), buffer);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(buffer_bit_field,
+                       __ Int32Constant(JSArrayBuffer::WasDetachedBit::kMask)),
+          __ Int32Constant(0)),
+      if_error);
+
+  Node* base =
+      __ LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), value);
+  Node* external =
+      __ LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), value);
+  Node* data = BuildTypedArrayDataPointer(base, external);
+  Node* length = __ LoadField(AccessBuilder::ForJSTypedArrayLength(), value);
+
+  // The {data} of on-heap typed arrays points into the JavaScript heap, which
+  // is fine since fast API calls must not trigger GC.
+  Node* stack_slot = __ StackSlot(sizeof(v8::FastApiUint8Array),
+                                  alignof(v8::FastApiUint8Array));
+  StoreRepresentation rep(MachineType::PointerRepresentation(),
+                          kNoWriteBarrier);
+  __ Store(rep, stack_slot, offsetof(v8::FastApiUint8Array, data), data);
+  __ Store(rep, stack_slot, offsetof(v8::FastApiUint8Array, length), length);
+  return stack_slot;
+}
+
+// Passes the characters of a sequential one-byte string {value} to a fast
+// API call as a v8::FastOneByteString in a stack slot, or jumps to
+// {if_error} if {value} is something else. Flattening cons strings would
+// allocate, so those take the slow path too.
+Node* EffectControlLinearizer::AdaptFastCallOneByteStringArgument(
+    Node* value, GraphAssemblerLabel<0>* if_error) {
+  __ GotoIf(ObjectIsSmi(value), if_error);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(value_instance_type,
+                       __ Int32Constant(kIsNotStringMask |
+                                        kStringRepresentationMask |
+                                        kStringEncodingMask)),
+          __ Int32Constant(kStringTag | kSeqStringTag | kOneByteStringTag)),
+      if_error);
+
+  Node* data = __ IntPtrAdd(
+      __ BitcastTaggedToWord(value),
+      __ IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), value);
+
+  Node* stack_slot = __ StackSlot(sizeof(v8::FastOneByteString),
+                                  alignof(v8::FastOneByteString));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, offsetof(v8::FastOneByteString, data), data);
+  __ Store(StoreRepresentation(MachineRepresentation::kWord32,
+                               kNoWriteBarrier),
+           stack_slot, offsetof(v8::FastOneByteString, length), length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   FastApiCallNode n(node);
   FastApiCallParameters const& params = n.Parameters();
@@ -5085,17 +5176,28 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
 
   call_descriptor->SetCFunctionInfo(c_signature);
 
+  // Arguments that can't be passed to the fast call jump to the slow call.
+  auto if_error = __ MakeDeferredLabel();
+
   Node** const inputs = graph()->zone()->NewArray<Node*>(
       c_arg_count + FastApiCallNode::kFastCallExtraInputCount);
   inputs[0] = NodeProperties::GetValueInput(node, 0);  // the target
   for (int i = FastApiCallNode::kFastTargetInputCount;
        i < c_arg_count + FastApiCallNode::kFastTargetInputCount; ++i) {
-    if (c_signature->ArgumentInfo(i - 1).GetType() ==
-        CTypeInfo::Type::kFloat32) {
-      inputs[i] =
-          __ TruncateFloat64ToFloat32(NodeProperties::GetValueInput(node, i));
-    } else {
-      inputs[i] = NodeProperties::GetValueInput(node, i);
+    Node* value = NodeProperties::GetValueInput(node, i);
+    switch (c_signature->ArgumentInfo(i - 1).GetType()) {
+      case CTypeInfo::Type::kFloat32:
+        inputs[i] = __ TruncateFloat64ToFloat32(value);
+        break;
+      case CTypeInfo::Type::kUint8Array:
+        inputs[i] = AdaptFastCallUint8ArrayArgument(value, &if_error);
+        break;
+      case CTypeInfo::Type::kOneByteString:
+        inputs[i] = AdaptFastCallOneByteStringArgument(value, &if_error);
+        break;
+      default:
+        inputs[i] = value;
+        break;
     }
   }
   inputs[c_arg_count + 1] = fast_api_call_stack_slot_;
@@ -5112,7 +5214,6 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       TNode<Boolean>::UncheckedCast(__ Word32Equal(load, __ Int32Constant(0)));
   // Hint to true.
   auto if_success = __ MakeLabel();
-  auto if_error = __ MakeDeferredLabel();
   auto merge = __ MakeLabel(MachineRepresentation::kTagged);
   __ Branch(cond, &if_success, &if_error);
 
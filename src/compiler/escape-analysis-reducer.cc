@@ -32,6 +32,7 @@ EscapeAnalysisReducer::EscapeAnalysisReducer(
       object_id_cache_(zone),
       node_cache_(jsgraph->graph(), zone),
       arguments_elements_(zone),
+      removed_allocations_(zone),
       zone_(zone) {}
 
 Reduction EscapeAnalysisReducer::ReplaceNode(Node* original,
@@ -93,6 +94,9 @@ Reduction EscapeAnalysisReducer::Reduce(Node* node) {
     case IrOpcode::kTypeGuard: {
       const VirtualObject* vobject = analysis_result().GetVirtualObject(node);
       if (vobject && !vobject->HasEscaped()) {
+        if (node->opcode() == IrOpcode::kAllocate) {
+          removed_allocations_.insert(node);
+        }
         RelaxEffectsAndControls(node);
       }
       return NoChange();
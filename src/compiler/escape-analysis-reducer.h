@@ -96,6 +96,9 @@ class V8_EXPORT_PRIVATE EscapeAnalysisReducer final
   // after this reducer has been applied.
   void VerifyReplacement() const;
 
+  // The number of allocations that were replaced by their fields.
+  size_t removed_allocations() const { return removed_allocations_.size(); }
+
  private:
   void ReduceFrameStateInputs(Node* node);
   Node* ReduceDeoptState(Node* node, Node* effect, Deduplicator* deduplicator);
@@ -112,6 +115,7 @@ class V8_EXPORT_PRIVATE EscapeAnalysisReducer final
   ZoneVector<Node*> object_id_cache_;
   NodeHashCache node_cache_;
   ZoneSet<Node*> arguments_elements_;
+  ZoneSet<Node*> removed_allocations_;
   Zone* const zone_;
 };
 
@@ -224,6 +224,9 @@ class EscapeAnalysisTracker : public ZoneObject {
       return tracker_->ResolveReplacement(
           NodeProperties::GetContextInput(current_node()));
     }
+    // Whether {node} is an input of the current node that has not been
+    // reduced yet, which happens only for loop backedges.
+    bool IsPending(Node* node) { return reducer_->IsOnStack(node); }
 
     void SetReplacement(Node* replacement) {
       replacement_ = replacement;
@@ -328,8 +331,14 @@ void EffectGraphReducer::ReduceFrom(Node* node) {
         Node* use = edge.from();
         if (NodeProperties::IsEffectEdge(edge)) {
           if (reduction.effect_changed()) Revisit(use);
-        } else {
-          if (reduction.value_changed()) Revisit(use);
+        } else if (reduction.value_changed()) {
+          Revisit(use);
+        } else if (use->opcode() == IrOpcode::kPhi &&
+                   NodeProperties::GetControlInput(use)->opcode() ==
+                       IrOpcode::kLoop) {
+          // Loop phis are reduced before their backedge inputs and make
+          // optimistic assumptions about them, see {ReduceNode}.
+          Revisit(use);
         }
       }
       state_.Set(current, State::kVisited);
@@ -795,6 +804,36 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       }
       break;
     }
+    case IrOpcode::kPhi: {
+      // A phi that only ever sees one non-escaping object, for example a loop
+      // phi of an object that the loop passes on unchanged, is that object.
+      // Backedge inputs that have not been reduced yet are assumed to agree;
+      // the phi is revisited when they are reduced.
+      int value_input_count = op->ValueInputCount();
+      Node* object = nullptr;
+      const VirtualObject* vobject = nullptr;
+      bool same_object = true;
+      for (int i = 0; i < value_input_count; ++i) {
+        Node* input = current->ValueInput(i);
+        if (current->IsPending(input)) continue;
+        const VirtualObject* input_object = current->GetVirtualObject(input);
+        if (input_object == nullptr || input_object->HasEscaped() ||
+            (vobject != nullptr && vobject != input_object)) {
+          same_object = false;
+          break;
+        }
+        object = input;
+        vobject = input_object;
+      }
+      if (same_object && vobject != nullptr) {
+        current->SetVirtualObject(object);
+        break;
+      }
+      for (int i = 0; i < value_input_count; ++i) {
+        current->SetEscaped(current->ValueInput(i));
+      }
+      break;
+    }
     case IrOpcode::kStateValues:
     case IrOpcode::kFrameState:
       // These uses are always safe.
@@ -60,6 +60,10 @@ class EffectGraphReducer {
 
   bool Complete() { return stack_.empty() && revisit_.empty(); }
 
+  // Whether {node} is on the DFS stack, that is it is an input of the node
+  // being reduced only through a loop backedge, and has not been reduced yet.
+  bool IsOnStack(Node* node) { return state_.Get(node) == State::kOnStack; }
+
   TickCounter* tick_counter() const { return tick_counter_; }
 
  private:
@@ -4,6 +4,7 @@
 
 #include "src/compiler/graph-reducer.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 
@@ -36,6 +37,7 @@ GraphReducer::GraphReducer(Zone* zone, Graph* graph, TickCounter* tick_counter,
       reducers_(zone),
       revisit_(zone),
       stack_(zone),
+      killed_(zone),
       tick_counter_(tick_counter),
       broker_(broker) {
   if (dead != nullptr) {
@@ -81,7 +83,22 @@ void GraphReducer::ReduceNode(Node* node) {
 }
 
 
-void GraphReducer::ReduceGraph() { ReduceNode(graph()->end()); }
+void GraphReducer::ReduceGraph() {
+  ReduceNode(graph()->end());
+  RecycleKilledNodes();
+}
+
+void GraphReducer::RecycleKilledNodes() {
+  if (FLAG_turbo_recycle_dead_nodes) {
+    // All reductions are finished at this point, so neither the node stack
+    // nor the revisit queue can refer to killed nodes anymore. A node may
+    // have been killed more than once, but must only be recycled once.
+    std::sort(killed_.begin(), killed_.end());
+    killed_.erase(std::unique(killed_.begin(), killed_.end()), killed_.end());
+    for (Node* const node : killed_) graph()->RecycleNode(node);
+  }
+  killed_.clear();
+}
 
 
 Reduction GraphReducer::Reduce(Node* const node) {
@@ -214,7 +231,7 @@ void GraphReducer::Replace(Node* node, Node* replacement, NodeId max_id) {
       // Don't revisit this node if it refers to itself.
       if (user != node) Revisit(user);
     }
-    node->Kill();
+    Kill(node);
   } else {
     // Replace all old uses of {node} with {replacement}, but allow new nodes
     // created by this reduction to use {node}.
@@ -227,7 +244,7 @@ void GraphReducer::Replace(Node* node, Node* replacement, NodeId max_id) {
       }
     }
     // Unlink {node} if it's no longer used.
-    if (node->uses().empty()) node->Kill();
+    if (node->uses().empty()) Kill(node);
 
     // If there was a replacement, reduce it after popping {node}.
     Recurse(replacement);
@@ -235,6 +252,12 @@ void GraphReducer::Replace(Node* node, Node* replacement, NodeId max_id) {
 }
 
 
+void GraphReducer::Kill(Node* node) {
+  node->Kill();
+  if (FLAG_turbo_recycle_dead_nodes) killed_.push_back(node);
+}
+
+
 void GraphReducer::ReplaceWithValue(Node* node, Node* value, Node* effect,
                                     Node* control) {
   if (effect == nullptr && node->op()->EffectInputCount() > 0) {
@@ -177,6 +177,11 @@ class V8_EXPORT_PRIVATE GraphReducer
   // id is less than or equal to {max_id} with the {replacement}.
   void Replace(Node* node, Node* replacement, NodeId max_id);
 
+  // Kill {node} and remember it for recycling once the reduction is done.
+  void Kill(Node* node);
+  // Hand the storage of nodes killed during ReduceGraph back to the graph.
+  void RecycleKilledNodes();
+
   // Node stack operations.
   void Pop();
   void Push(Node* node);
@@ -191,6 +196,7 @@ class V8_EXPORT_PRIVATE GraphReducer
   ZoneVector<Reducer*> reducers_;
   ZoneQueue<Node*> revisit_;
   ZoneStack<NodeState> stack_;
+  ZoneVector<Node*> killed_;
   TickCounter* const tick_counter_;
   JSHeapBroker* const broker_;
 };
@@ -22,13 +22,25 @@ Graph::Graph(Zone* zone)
       end_(nullptr),
       mark_max_(0),
       next_node_id_(0),
-      decorators_(zone) {
+      decorators_(zone),
+      recycled_nodes_(zone),
+      recycled_node_count_(0) {
   // Nodes use compressed pointers, so zone must support pointer compression.
   // If the check fails, ensure the zone is created with kCompressGraphZone
   // flag.
   CHECK_IMPLIES(kCompressGraphZone, zone->supports_compression());
 }
 
+void Graph::RecycleNode(Node* node) {
+  int const capacity = node->RecyclableCapacity();
+  if (capacity == 0) return;
+  if (recycled_nodes_.size() <= static_cast<size_t>(capacity)) {
+    recycled_nodes_.resize(capacity + 1, ZoneVector<Node*>(zone()));
+  }
+  recycled_nodes_[capacity].push_back(node);
+  recycled_node_count_++;
+}
+
 void Graph::Decorate(Node* node) {
   for (GraphDecorator* const decorator : decorators_) {
     decorator->Decorate(node);
@@ -56,8 +68,17 @@ Node* Graph::NewNode(const Operator* op, int input_count, Node* const* inputs,
 
 Node* Graph::NewNodeUnchecked(const Operator* op, int input_count,
                               Node* const* inputs, bool incomplete) {
-  Node* const node =
-      Node::New(zone(), NextNodeId(), op, input_count, inputs, incomplete);
+  Node* node = nullptr;
+  int const capacity = Node::InlineCapacityFor(input_count, incomplete);
+  if (capacity > 0 && static_cast<size_t>(capacity) < recycled_nodes_.size() &&
+      !recycled_nodes_[capacity].empty()) {
+    Node* const dead = recycled_nodes_[capacity].back();
+    recycled_nodes_[capacity].pop_back();
+    node = Node::NewInPlace(zone(), dead, NextNodeId(), op, input_count,
+                            inputs, incomplete);
+  } else {
+    node = Node::New(zone(), NextNodeId(), op, input_count, inputs, incomplete);
+  }
   Decorate(node);
   return node;
 }
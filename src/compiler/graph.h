@@ -89,6 +89,14 @@ class V8_EXPORT_PRIVATE Graph final : public NON_EXPORTED_BASE(ZoneObject) {
 
   size_t NodeCount() const { return next_node_id_; }
 
+  // Hands the storage of the killed {node} back to the graph, so that it can
+  // be reused by nodes created later on. The caller must ensure that {node}
+  // is no longer referenced by anyone, e.g. reducer side tables.
+  void RecycleNode(Node* node);
+
+  // Number of killed nodes whose storage was handed back via RecycleNode.
+  size_t RecycledNodeCount() const { return recycled_node_count_; }
+
   void Decorate(Node* node);
   void AddDecorator(GraphDecorator* decorator);
   void RemoveDecorator(GraphDecorator* decorator);
@@ -107,6 +115,9 @@ class V8_EXPORT_PRIVATE Graph final : public NON_EXPORTED_BASE(ZoneObject) {
   Mark mark_max_;
   NodeId next_node_id_;
   ZoneVector<GraphDecorator*> decorators_;
+  // Storage of killed nodes available for reuse, indexed by inline capacity.
+  ZoneVector<ZoneVector<Node*>> recycled_nodes_;
+  size_t recycled_node_count_;
 };
 
 
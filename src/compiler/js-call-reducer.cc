@@ -5613,8 +5613,8 @@ Reduction JSCallReducer::ReduceArrayPrototypeSlice(Node* node) {
       callable.descriptor().GetStackParameterCount(), CallDescriptor::kNoFlags,
       Operator::kNoThrow | Operator::kNoDeopt);
 
-  // Calls to Builtins::kCloneFastJSArray produce COW arrays
-  // if the original array is COW
+  // Calls to Builtins::kCloneFastJSArray produce COW arrays if the original
+  // array is COW or large enough to be turned into one.
   Node* clone = effect = graph()->NewNode(
       common()->Call(call_descriptor), jsgraph()->HeapConstant(callable.code()),
       receiver, context, effect, control);
@@ -17,6 +17,8 @@
 #include "src/compiler/operator-properties.h"
 #include "src/compiler/processed-feedback.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/ic/handler-configuration-inl.h"
+#include "src/ic/stub-cache.h"
 #include "src/objects/feedback-cell.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/scope-info.h"
@@ -287,12 +289,186 @@ void JSGenericLowering::LowerJSLoadProperty(Node* node) {
   }
 }
 
+void JSGenericLowering::InlineLoadStubCacheProbe(Node* node) {
+  JSLoadNamedNode n(node);
+  NamedAccess const& p = n.Parameters();
+  StubCache* stub_cache = isolate()->load_stub_cache();
+  Node* receiver = n.object();
+  Node* name = jsgraph()->HeapConstant(p.name());
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Every failed check leads to {node}, the megamorphic LoadIC call.
+  ZoneVector<Node*> slow_controls(zone());
+  ZoneVector<Node*> slow_effects(zone());
+  auto check = [&](Node* condition) {
+    Node* branch =
+        graph()->NewNode(common()->Branch(BranchHint::kTrue), condition,
+                         control);
+    slow_controls.push_back(graph()->NewNode(common()->IfFalse(), branch));
+    slow_effects.push_back(effect);
+    control = graph()->NewNode(common()->IfTrue(), branch);
+  };
+  auto load = [&](MachineType type, Node* base, Node* offset) {
+    return effect = graph()->NewNode(machine()->Load(type), base, offset,
+                                     effect, control);
+  };
+  auto load_field = [&](MachineType type, Node* object, int offset) {
+    return load(type, object,
+                jsgraph()->IntPtrConstant(offset - kHeapObjectTag));
+  };
+  auto word = [&](Node* tagged) {
+    return graph()->NewNode(machine()->BitcastMaybeObjectToWord(), tagged);
+  };
+  auto tag_bits_equal = [&](Node* value, intptr_t mask, intptr_t tag) {
+    return graph()->NewNode(
+        machine()->WordEqual(),
+        graph()->NewNode(machine()->WordAnd(), word(value),
+                         jsgraph()->IntPtrConstant(mask)),
+        jsgraph()->IntPtrConstant(tag));
+  };
+  auto equal = [&](Node* a, Node* b) {
+    return graph()->NewNode(machine()->WordEqual(), word(a), word(b));
+  };
+
+  check(tag_bits_equal(receiver, kSmiTagMask, kHeapObjectTag));
+  Node* map = load_field(MachineType::TaggedPointer(), receiver,
+                         HeapObject::kMapOffset);
+
+  // See StubCache::PrimaryOffset().
+  Node* hash_field =
+      load_field(MachineType::Uint32(), name, Name::kHashFieldOffset);
+  Node* map_bits = graph()->NewNode(
+      machine()->WordXor(), word(map),
+      graph()->NewNode(machine()->WordShr(), word(map),
+                       jsgraph()->IntPtrConstant(StubCache::kMapKeyShift)));
+  if (machine()->Is64()) {
+    map_bits = graph()->NewNode(machine()->TruncateInt64ToInt32(), map_bits);
+  }
+  Node* mask = load(MachineType::Uint32(),
+                    jsgraph()->ExternalConstant(ExternalReference::Create(
+                        stub_cache->mask_reference(StubCache::kPrimary))),
+                    jsgraph()->IntPtrConstant(0));
+  Node* index = graph()->NewNode(
+      machine()->Word32And(),
+      graph()->NewNode(machine()->Int32Add(), hash_field, map_bits), mask);
+  if (machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+  Node* entry = graph()->NewNode(
+      machine()->IntMul(), index,
+      jsgraph()->IntPtrConstant(sizeof(StubCache::Entry) >>
+                                StubCache::kCacheIndexShift));
+  Node* table = jsgraph()->ExternalConstant(ExternalReference::Create(
+      stub_cache->key_reference(StubCache::kPrimary)));
+  auto entry_field = [&](MachineType type, size_t offset) {
+    return load(type, table,
+                graph()->NewNode(machine()->IntAdd(), entry,
+                                 jsgraph()->IntPtrConstant(offset)));
+  };
+  check(equal(entry_field(MachineType::TaggedPointer(),
+                          offsetof(StubCache::Entry, key)),
+              name));
+  check(equal(entry_field(MachineType::TaggedPointer(),
+                          offsetof(StubCache::Entry, map)),
+              map));
+  Node* handler =
+      entry_field(MachineType::AnyTagged(), offsetof(StubCache::Entry, value));
+
+  // Only a LoadHandler for a constant found on the prototype chain, without
+  // lookup or access check on the receiver, qualifies.
+  check(tag_bits_equal(handler, kHeapObjectTagMask, kHeapObjectTag));
+  check(equal(
+      load_field(MachineType::TaggedPointer(), handler, HeapObject::kMapOffset),
+      jsgraph()->HeapConstant(isolate()->factory()->load_handler1_map())));
+  const int kSmiHandlerMask =
+      LoadHandler::KindBits::kMask |
+      LoadHandler::DoAccessCheckOnLookupStartObjectBits::kMask |
+      LoadHandler::LookupOnLookupStartObjectBits::kMask;
+  check(tag_bits_equal(
+      load_field(MachineType::AnyTagged(), handler,
+                 DataHandler::kSmiHandlerOffset),
+      Smi::FromInt(kSmiHandlerMask).ptr() | kSmiTagMask,
+      Smi::FromInt(LoadHandler::KindBits::encode(
+                       LoadHandler::kConstantFromPrototype))
+          .ptr()));
+
+  // The prototype chain must still be valid.
+  Node* validity_cell = load_field(MachineType::AnyTagged(), handler,
+                                   DataHandler::kValidityCellOffset);
+  check(tag_bits_equal(validity_cell, kSmiTagMask, kHeapObjectTag));
+  STATIC_ASSERT(Map::kPrototypeChainValid == 0);
+  check(tag_bits_equal(
+      load_field(MachineType::AnyTagged(), validity_cell, Cell::kValueOffset),
+      ~intptr_t{0}, Smi::FromInt(Map::kPrototypeChainValid).ptr()));
+
+  // Heap object constants are held weakly.
+  Node* constant =
+      load_field(MachineType::AnyTagged(), handler, DataHandler::kData1Offset);
+  check(tag_bits_equal(constant, kHeapObjectTagMask, kWeakHeapObjectTag));
+  Node* constant_bits = word(constant);
+  Node* constant_lower32 =
+      machine()->Is64()
+          ? graph()->NewNode(machine()->TruncateInt64ToInt32(), constant_bits)
+          : constant_bits;
+  check(graph()->NewNode(
+      machine()->Word32Equal(),
+      graph()->NewNode(machine()->Word32Equal(), constant_lower32,
+                       jsgraph()->Int32Constant(kClearedWeakHeapObjectLower32)),
+      jsgraph()->Int32Constant(0)));
+  Node* value = graph()->NewNode(
+      machine()->BitcastWordToTagged(),
+      graph()->NewNode(machine()->WordAnd(), constant_bits,
+                       jsgraph()->IntPtrConstant(
+                           ~static_cast<intptr_t>(kWeakHeapObjectMask))));
+
+  // Route the failed checks to {node}.
+  int slow_count = static_cast<int>(slow_controls.size());
+  Node* if_false = graph()->NewNode(common()->Merge(slow_count), slow_count,
+                                    slow_controls.data());
+  slow_effects.push_back(if_false);
+  Node* efalse = graph()->NewNode(common()->EffectPhi(slow_count),
+                                  slow_count + 1, slow_effects.data());
+  NodeProperties::ReplaceControlInput(node, if_false);
+  NodeProperties::ReplaceEffectInput(node, efalse);
+
+  Node* merge = graph()->NewNode(common()->Merge(2), control, node);
+  Node* ephi = graph()->NewNode(common()->EffectPhi(2), effect, node, merge);
+  Node* phi = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), value, node, merge);
+
+  // Wire the new diamond into the graph, {node} can still throw.
+  NodeProperties::ReplaceUses(node, phi, ephi, merge, merge);
+  NodeProperties::ReplaceControlInput(merge, node, 1);
+  NodeProperties::ReplaceEffectInput(ephi, node, 1);
+  phi->ReplaceInput(1, node);
+
+  // Move potential {IfSuccess} or {IfException} projections of {node} back
+  // onto it, see LowerJSStackCheck.
+  for (Edge edge : merge->use_edges()) {
+    if (!NodeProperties::IsControlEdge(edge)) continue;
+    if (edge.from()->opcode() == IrOpcode::kIfSuccess) {
+      NodeProperties::ReplaceUses(edge.from(), nullptr, nullptr, merge);
+      NodeProperties::ReplaceControlInput(merge, edge.from(), 1);
+      edge.UpdateTo(node);
+    }
+    if (edge.from()->opcode() == IrOpcode::kIfException) {
+      NodeProperties::ReplaceEffectInput(edge.from(), node);
+      edge.UpdateTo(node);
+    }
+  }
+}
+
 void JSGenericLowering::LowerJSLoadNamed(Node* node) {
   JSLoadNamedNode n(node);
   NamedAccess const& p = n.Parameters();
   FrameState frame_state = n.frame_state();
   FrameState outer_state = frame_state.outer_frame_state();
   STATIC_ASSERT(n.FeedbackVectorIndex() == 1);
+  if (FLAG_turbo_inline_stub_cache_probe && p.feedback().IsValid() &&
+      ShouldUseMegamorphicLoadBuiltin(p.feedback(), broker())) {
+    InlineLoadStubCacheProbe(node);
+  }
   if (!p.feedback().IsValid()) {
     n->RemoveInput(n.FeedbackVectorIndex());
     node->InsertInput(zone(), 1, jsgraph()->HeapConstant(p.name()));
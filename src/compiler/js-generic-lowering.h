@@ -52,6 +52,10 @@ class JSGenericLowering final : public AdvancedReducer {
                                       Builtins::Name builtin_without_feedback,
                                       Builtins::Name builtin_with_feedback);
 
+  // Handles stub cache hits for megamorphic named loads of constants from
+  // the prototype chain inline, in front of the call that {node} becomes.
+  void InlineLoadStubCacheProbe(Node* node);
+
   Zone* zone() const;
   Isolate* isolate() const;
   JSGraph* jsgraph() const { return jsgraph_; }
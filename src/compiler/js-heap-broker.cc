@@ -3108,6 +3108,13 @@ FieldIndex MapRef::GetFieldIndexFor(InternalIndex descriptor_index) const {
                                                             broker()->mode());
     return FieldIndex::ForDescriptor(*object(), descriptor_index);
   }
+  if (FLAG_turbo_direct_heap_access) {
+    PropertyDetails details = GetPropertyDetails(descriptor_index);
+    AllowHandleDereferenceIfNeeded allow_handle_dereference(
+        data()->kind(), broker()->mode(), FLAG_turbo_direct_heap_access);
+    return FieldIndex::ForPropertyIndex(*object(), details.field_index(),
+                                        details.representation());
+  }
   DescriptorArrayData* descriptors = data()->AsMap()->instance_descriptors();
   return descriptors->contents().at(descriptor_index.as_int()).field_index;
 }
@@ -3130,19 +3137,31 @@ PropertyDetails MapRef::GetPropertyDetails(
         ->instance_descriptors(kRelaxedLoad)
         .GetDetails(descriptor_index);
   }
+  if (FLAG_turbo_direct_heap_access) {
+    // The details may be generalized in place by the main thread; the
+    // dependencies recorded on them are rechecked when the code is committed.
+    AllowHandleDereferenceIfNeeded allow_handle_dereference(
+        data()->kind(), broker()->mode(), FLAG_turbo_direct_heap_access);
+    base::SharedMutexGuard<base::kShared> mutex_guard(
+        broker()->isolate()->map_updater_access());
+    return object()
+        ->instance_descriptors(kAcquireLoad)
+        .GetDetails(descriptor_index);
+  }
   DescriptorArrayData* descriptors = data()->AsMap()->instance_descriptors();
   return descriptors->contents().at(descriptor_index.as_int()).details;
 }
 
 NameRef MapRef::GetPropertyKey(InternalIndex descriptor_index) const {
-  if (data_->should_access_heap()) {
-    AllowHandleAllocationIfNeeded allow_handle_allocation(data()->kind(),
-                                                          broker()->mode());
-    AllowHandleDereferenceIfNeeded allow_handle_dereference(data()->kind(),
-                                                            broker()->mode());
+  if (data_->should_access_heap() || FLAG_turbo_direct_heap_access) {
+    // Keys are never replaced in place, so no locking is needed here.
+    AllowHandleAllocationIfNeeded allow_handle_allocation(
+        data()->kind(), broker()->mode(), FLAG_turbo_direct_heap_access);
+    AllowHandleDereferenceIfNeeded allow_handle_dereference(
+        data()->kind(), broker()->mode(), FLAG_turbo_direct_heap_access);
     return NameRef(broker(), broker()->CanonicalPersistentHandle(
                                  object()
-                                     ->instance_descriptors(kRelaxedLoad)
+                                     ->instance_descriptors(kAcquireLoad)
                                      .GetKey(descriptor_index)));
   }
   DescriptorArrayData* descriptors = data()->AsMap()->instance_descriptors();
@@ -3202,6 +3221,12 @@ bool MapRef::IsUnboxedDoubleField(InternalIndex descriptor_index) const {
     return object()->IsUnboxedDoubleField(
         FieldIndex::ForDescriptor(*object(), descriptor_index));
   }
+  if (FLAG_turbo_direct_heap_access) {
+    FieldIndex field_index = GetFieldIndexFor(descriptor_index);
+    AllowHandleDereferenceIfNeeded allow_handle_dereference(
+        data()->kind(), broker()->mode(), FLAG_turbo_direct_heap_access);
+    return object()->IsUnboxedDoubleField(field_index);
+  }
   DescriptorArrayData* descriptors = data()->AsMap()->instance_descriptors();
   return descriptors->contents()
       .at(descriptor_index.as_int())
@@ -3393,6 +3418,11 @@ int BytecodeArrayRef::handler_table_size() const {
     IF_ACCESS_FROM_HEAP_WITH_FLAG_C(name);                 \
     return ObjectRef::data()->As##holder()->name();        \
   }
+#define BIMODAL_ACCESSOR_WITH_FLAG_B(holder, field, name, BitField)    \
+  typename BitField::FieldType holder##Ref::name() const {             \
+    IF_ACCESS_FROM_HEAP_WITH_FLAG_C(name);                             \
+    return BitField::decode(ObjectRef::data()->As##holder()->field()); \
+  }
 
 BIMODAL_ACCESSOR(AllocationSite, Object, nested_site)
 BIMODAL_ACCESSOR_C(AllocationSite, bool, CanInlineCall)
@@ -3442,14 +3472,18 @@ BIMODAL_ACCESSOR_C(JSTypedArray, size_t, length)
 BIMODAL_ACCESSOR(JSTypedArray, HeapObject, buffer)
 
 BIMODAL_ACCESSOR_B(Map, bit_field2, elements_kind, Map::Bits2::ElementsKindBits)
-BIMODAL_ACCESSOR_B(Map, bit_field3, is_dictionary_map,
-                   Map::Bits3::IsDictionaryMapBit)
-BIMODAL_ACCESSOR_B(Map, bit_field3, is_deprecated, Map::Bits3::IsDeprecatedBit)
-BIMODAL_ACCESSOR_B(Map, bit_field3, NumberOfOwnDescriptors,
-                   Map::Bits3::NumberOfOwnDescriptorsBits)
-BIMODAL_ACCESSOR_B(Map, bit_field3, is_migration_target,
-                   Map::Bits3::IsMigrationTargetBit)
-BIMODAL_ACCESSOR_B(Map, bit_field3, is_extensible, Map::Bits3::IsExtensibleBit)
+// bit_field3 is read with relaxed loads, so these are safe to read from the
+// background thread.
+BIMODAL_ACCESSOR_WITH_FLAG_B(Map, bit_field3, is_dictionary_map,
+                             Map::Bits3::IsDictionaryMapBit)
+BIMODAL_ACCESSOR_WITH_FLAG_B(Map, bit_field3, is_deprecated,
+                             Map::Bits3::IsDeprecatedBit)
+BIMODAL_ACCESSOR_WITH_FLAG_B(Map, bit_field3, NumberOfOwnDescriptors,
+                             Map::Bits3::NumberOfOwnDescriptorsBits)
+BIMODAL_ACCESSOR_WITH_FLAG_B(Map, bit_field3, is_migration_target,
+                             Map::Bits3::IsMigrationTargetBit)
+BIMODAL_ACCESSOR_WITH_FLAG_B(Map, bit_field3, is_extensible,
+                             Map::Bits3::IsExtensibleBit)
 BIMODAL_ACCESSOR_B(Map, bit_field, has_prototype_slot,
                    Map::Bits1::HasPrototypeSlotBit)
 BIMODAL_ACCESSOR_B(Map, bit_field, is_access_check_needed,
@@ -3670,7 +3704,7 @@ int MapRef::constructor_function_index() const {
 }
 
 bool MapRef::is_stable() const {
-  IF_ACCESS_FROM_HEAP_C(is_stable);
+  IF_ACCESS_FROM_HEAP_WITH_FLAG_C(is_stable);
   return !Map::Bits3::IsUnstableBit::decode(data()->AsMap()->bit_field3());
 }
 
@@ -5416,6 +5450,7 @@ Smi OffHeapBytecodeArray::GetConstantAtIndexAsSmi(int index) const {
 #undef BIMODAL_ACCESSOR
 #undef BIMODAL_ACCESSOR_B
 #undef BIMODAL_ACCESSOR_C
+#undef BIMODAL_ACCESSOR_WITH_FLAG_B
 #undef IF_ACCESS_FROM_HEAP
 #undef IF_ACCESS_FROM_HEAP_C
 #undef TRACE
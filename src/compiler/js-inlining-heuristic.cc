@@ -4,6 +4,8 @@
 
 #include "src/compiler/js-inlining-heuristic.h"
 
+#include <algorithm>
+
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
@@ -88,24 +90,49 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
   }
   if (m.IsPhi()) {
     int const value_input_count = m.node()->op()->ValueInputCount();
-    if (value_input_count > functions_size) {
+    bool all_known = value_input_count <= functions_size;
+    for (int n = 0; all_known && n < value_input_count; ++n) {
+      HeapObjectMatcher m(callee->InputAt(n));
+      all_known = m.HasResolvedValue() && m.Ref(broker()).IsJSFunction();
+    }
+    if (all_known) {
+      for (int n = 0; n < value_input_count; ++n) {
+        HeapObjectMatcher m(callee->InputAt(n));
+        out.functions[n] = m.Ref(broker()).AsJSFunction();
+        JSFunctionRef function = out.functions[n].value();
+        if (CanConsiderForInlining(broker(), function)) {
+          out.bytecode[n] = function.shared().GetBytecodeArray();
+        }
+      }
+      out.num_functions = value_input_count;
+      return out;
+    }
+    if (!FLAG_polymorphic_inlining_fallback) {
       out.num_functions = 0;
       return out;
     }
-    for (int n = 0; n < value_input_count; ++n) {
-      HeapObjectMatcher m(callee->InputAt(n));
-      if (!m.HasResolvedValue() || !m.Ref(broker()).IsJSFunction()) {
-        out.num_functions = 0;
-        return out;
-      }
 
-      out.functions[n] = m.Ref(broker()).AsJSFunction();
-      JSFunctionRef function = out.functions[n].value();
-      if (CanConsiderForInlining(broker(), function)) {
-        out.bytecode[n] = function.shared().GetBytecodeArray();
+    // Pick the first {functions_size} distinct targets that can be inlined
+    // and call everything else generically. Call feedback doesn't count the
+    // calls of the individual targets, so the order of the phi inputs, which
+    // follows the property access feedback, is the best guess we have.
+    int num_functions = 0;
+    for (int n = 0; n < value_input_count && num_functions < functions_size;
+         ++n) {
+      HeapObjectMatcher m(callee->InputAt(n));
+      if (!m.HasResolvedValue() || !m.Ref(broker()).IsJSFunction()) continue;
+      JSFunctionRef function = m.Ref(broker()).AsJSFunction();
+      bool seen = false;
+      for (int i = 0; i < num_functions; ++i) {
+        seen = seen || out.functions[i]->equals(function);
       }
+      if (seen || !CanConsiderForInlining(broker(), function)) continue;
+      out.functions[num_functions] = function;
+      out.bytecode[num_functions] = function.shared().GetBytecodeArray();
+      num_functions++;
     }
-    out.num_functions = value_input_count;
+    out.num_functions = num_functions;
+    out.has_fallback = num_functions > 0;
     return out;
   }
   if (m.IsCheckClosure()) {
@@ -155,10 +182,13 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   seen_.insert(node->id());
 
   // Check if the {node} is an appropriate candidate for inlining.
-  Candidate candidate = CollectFunctions(node, kMaxCallPolymorphism);
+  int const max_functions = std::max(
+      1, std::min(FLAG_max_inlined_call_polymorphism, kMaxCallPolymorphism));
+  Candidate candidate = CollectFunctions(node, max_functions);
   if (candidate.num_functions == 0) {
     return NoChange();
-  } else if (candidate.num_functions > 1 && !FLAG_polymorphic_inlining) {
+  } else if ((candidate.num_functions > 1 || candidate.has_fallback) &&
+             !FLAG_polymorphic_inlining) {
     TRACE("Not considering call site #"
           << node->id() << ":" << node->op()->mnemonic()
           << ", because polymorphic inlining is disabled");
@@ -624,7 +654,8 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
                                                 int input_count) {
   SourcePositionTable::Scope position(
       source_positions_, source_positions_->GetSourcePosition(node));
-  if (TryReuseDispatch(node, callee, if_successes, calls, inputs,
+  if (!candidate.has_fallback &&
+      TryReuseDispatch(node, callee, if_successes, calls, inputs,
                        input_count)) {
     return;
   }
@@ -632,14 +663,14 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
   STATIC_ASSERT(JSCallOrConstructNode::kHaveIdenticalLayouts);
 
   Node* fallthrough_control = NodeProperties::GetControlInput(node);
-  int const num_calls = candidate.num_functions;
+  int const num_functions = candidate.num_functions;
 
   // Create the appropriate control flow to dispatch to the cloned calls.
-  for (int i = 0; i < num_calls; ++i) {
+  for (int i = 0; i < num_functions; ++i) {
     // TODO(2206): Make comparison be based on underlying SharedFunctionInfo
     // instead of the target JSFunction reference directly.
     Node* target = jsgraph()->Constant(candidate.functions[i].value());
-    if (i != (num_calls - 1)) {
+    if (i != (num_functions - 1) || candidate.has_fallback) {
       Node* check =
           graph()->NewNode(simplified()->ReferenceEqual(), callee, target);
       Node* branch =
@@ -668,11 +699,22 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
     calls[i] = if_successes[i] =
         graph()->NewNode(node->op(), input_count, inputs);
   }
+
+  // Any other target is called with the original inputs.
+  if (candidate.has_fallback) {
+    for (int i = 0; i < input_count - 1; ++i) {
+      inputs[i] = node->InputAt(i);
+    }
+    inputs[input_count - 1] = fallthrough_control;
+    calls[num_functions] = if_successes[num_functions] =
+        graph()->NewNode(node->op(), input_count, inputs);
+  }
 }
 
 Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
                                                bool small_function) {
-  int const num_calls = candidate.num_functions;
+  int const num_calls =
+      candidate.num_functions + (candidate.has_fallback ? 1 : 0);
   Node* const node = candidate.node;
   if (num_calls == 1) {
     Reduction const reduction = inliner_.ReduceJSCall(node);
@@ -685,8 +727,8 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   // Expand the JSCall/JSConstruct node to a subgraph first if
   // we have multiple known target functions.
   DCHECK_LT(1, num_calls);
-  Node* calls[kMaxCallPolymorphism + 1];
-  Node* if_successes[kMaxCallPolymorphism];
+  Node* calls[kMaxCallPolymorphism + 2];
+  Node* if_successes[kMaxCallPolymorphism + 1];
   Node* callee = NodeProperties::GetValueInput(node, 0);
 
   // Setup the inputs for the cloned call nodes.
@@ -703,7 +745,7 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   // Check if we have an exception projection for the call {node}.
   Node* if_exception = nullptr;
   if (NodeProperties::IsExceptionalCall(node, &if_exception)) {
-    Node* if_exceptions[kMaxCallPolymorphism + 1];
+    Node* if_exceptions[kMaxCallPolymorphism + 2];
     for (int i = 0; i < num_calls; ++i) {
       if_successes[i] = graph()->NewNode(common()->IfSuccess(), calls[i]);
       if_exceptions[i] =
@@ -735,8 +777,9 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   ReplaceWithValue(node, value, effect, control);
 
   // Inline the individual, cloned call sites.
-  for (int i = 0; i < num_calls && total_inlined_bytecode_size_ <
-                                       FLAG_max_inlined_bytecode_size_absolute;
+  for (int i = 0;
+       i < candidate.num_functions &&
+       total_inlined_bytecode_size_ < FLAG_max_inlined_bytecode_size_absolute;
        ++i) {
     if (candidate.can_inline_function[i] &&
         (small_function || total_inlined_bytecode_size_ <
@@ -782,7 +825,9 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
        << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << ", " << candidate.num_functions << " target(s)"
+       << (candidate.has_fallback ? " and a generic call" : "") << ":"
+       << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared = candidate.functions[i].has_value()
                                          ? candidate.functions[i]->shared()
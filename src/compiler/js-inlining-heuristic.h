@@ -38,9 +38,10 @@ class JSInliningHeuristic final : public AdvancedReducer {
   }
 
  private:
-  // This limit currently matches what the old compiler did. We may want to
-  // re-evaluate and come up with a proper limit for TurboFan.
-  static const int kMaxCallPolymorphism = 4;
+  // The most targets that are inlined at a polymorphic call site. The actual
+  // limit is --max-inlined-call-polymorphism, which defaults to what the old
+  // compiler did.
+  static const int kMaxCallPolymorphism = 8;
 
   struct Candidate {
     base::Optional<JSFunctionRef> functions[kMaxCallPolymorphism];
@@ -56,6 +57,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     // we use {num_functions == 1 && functions[0].is_null()} as an indicator.
     base::Optional<SharedFunctionInfoRef> shared_info;
     int num_functions;
+    // Whether the call site may call targets other than {functions}, which
+    // the dispatch then calls generically.
+    bool has_fallback = false;
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
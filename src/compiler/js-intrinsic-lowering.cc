@@ -42,6 +42,8 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
   switch (f->function_id) {
     case Runtime::kInlineCopyDataProperties:
       return ReduceCopyDataProperties(node);
+    case Runtime::kInlineCreateDataProperty:
+      return ReduceCreateDataProperty(node);
     case Runtime::kInlineCreateIterResultObject:
       return ReduceCreateIterResultObject(node);
     case Runtime::kInlineDeoptimizeNow:
@@ -101,6 +103,11 @@ Reduction JSIntrinsicLowering::ReduceCopyDataProperties(Node* node) {
       node, Builtins::CallableFor(isolate(), Builtins::kCopyDataProperties), 0);
 }
 
+Reduction JSIntrinsicLowering::ReduceCreateDataProperty(Node* node) {
+  return Change(
+      node, Builtins::CallableFor(isolate(), Builtins::kCreateDataProperty), 0);
+}
+
 Reduction JSIntrinsicLowering::ReduceCreateIterResultObject(Node* node) {
   Node* const value = NodeProperties::GetValueInput(node, 0);
   Node* const done = NodeProperties::GetValueInput(node, 1);
@@ -1141,6 +1141,13 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  if (access_mode == AccessMode::kLoad &&
+      node->opcode() == IrOpcode::kJSLoadNamed) {
+    Reduction reduction =
+        ReduceNamedLoadFromProxy(node, feedback.name(), receiver_maps);
+    if (reduction.Changed()) return reduction;
+  }
+
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
@@ -1384,6 +1391,46 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceNamedLoadFromProxy(
+    Node* node, NameRef const& name,
+    ZoneVector<Handle<Map>> const& receiver_maps) {
+  JSLoadNamedNode n(node);
+  // Proxies have no property access infos, so loads from them would stay
+  // generic and dispatch through the LoadIC. If all receiver maps are proxy
+  // maps, check the maps and call the ProxyGetProperty builtin directly, the
+  // same as the LoadIC's proxy handler does. Private symbols don't go through
+  // proxy traps, so only string names are handled here.
+  if (receiver_maps.empty() || !name.IsString()) return NoChange();
+  for (Handle<Map> map_handle : receiver_maps) {
+    MapRef map(broker(), map_handle);
+    if (!map.IsJSProxyMap()) return NoChange();
+  }
+
+  Node* receiver = n.object();
+  Effect effect = n.effect();
+  Control control = n.control();
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  access_builder.BuildCheckMaps(receiver, &effect, control, receiver_maps);
+  NodeProperties::ReplaceEffectInput(node, effect);
+
+  Callable callable =
+      Builtins::CallableFor(isolate(), Builtins::kProxyGetProperty);
+  CallInterfaceDescriptor descriptor = callable.descriptor();
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), descriptor, descriptor.GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState);
+  node->RemoveInput(JSLoadNamedNode::FeedbackVectorIndex());
+  node->InsertInput(graph()->zone(), 0,
+                    jsgraph()->HeapConstant(callable.code()));
+  node->InsertInput(graph()->zone(), 2, jsgraph()->Constant(name));
+  node->InsertInput(graph()->zone(), 3, receiver);
+  Node* on_nonexistent = jsgraph()->SmiConstant(
+      static_cast<int>(OnNonExistent::kReturnUndefined));
+  node->InsertInput(graph()->zone(), 4, on_nonexistent);
+  NodeProperties::ChangeOp(node, common()->Call(call_descriptor));
+  return Changed(node);
+}
+
 Reduction JSNativeContextSpecialization::ReduceJSLoadNamed(Node* node) {
   JSLoadNamedNode n(node);
   NamedAccess const& p = n.Parameters();
@@ -104,6 +104,9 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   Reduction ReduceNamedAccess(Node* node, Node* value,
                               NamedAccessFeedback const& processed,
                               AccessMode access_mode, Node* key = nullptr);
+  Reduction ReduceNamedLoadFromProxy(
+      Node* node, NameRef const& name,
+      ZoneVector<Handle<Map>> const& receiver_maps);
   Reduction ReduceMinimorphicPropertyAccess(
       Node* node, Node* value,
       MinimorphicLoadPropertyAccessFeedback const& feedback,
@@ -105,6 +105,14 @@ class JSBinopReduction final {
     DCHECK(OneInputIs(Type::String()));
     if (BothInputsAre(Type::String()) ||
         GetBinaryOperationHint(node_) == BinaryOperationHint::kString) {
+      // Leave accumulators like `s += x` in loops to the StringAdd builtin,
+      // which can append to long results in place instead of building ropes.
+      Node* const left_input = left();
+      if (left_input->opcode() == IrOpcode::kPhi &&
+          NodeProperties::GetControlInput(left_input)->opcode() ==
+              IrOpcode::kLoop) {
+        return false;
+      }
       HeapObjectBinopMatcher m(node_);
       JSHeapBroker* broker = lowering_->broker();
       if (m.right().HasResolvedValue() && m.right().Ref(broker).IsString()) {
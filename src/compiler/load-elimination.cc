@@ -627,6 +627,51 @@ LoadElimination::AbstractState::KillFields(Node* object, MaybeHandle<Name> name,
   }
 }
 
+LoadElimination::AbstractState const*
+LoadElimination::AbstractState::AddFieldPhis(
+    Node* merge, ZoneVector<AbstractState const*> const& input_states,
+    Zone* zone) const {
+  DCHECK_EQ(IrOpcode::kMerge, merge->opcode());
+  DCHECK_EQ(merge->InputCount(), static_cast<int>(input_states.size()));
+  AbstractState const* state = this;
+  AbstractState const* const first = input_states.front();
+  for (size_t index = 0; index < kMaxTrackedFields; ++index) {
+    AbstractField const* first_field = first->fields_[index];
+    if (first_field == nullptr) continue;
+    IndexRange index_range(static_cast<int>(index), 1);
+    first_field->ForEach([&](Node* object, FieldInfo const& info) {
+      if (object->IsDead()) return;
+      // Values that agree on all paths were kept by the merge already.
+      if (state->LookupField(object, index_range, ConstFieldInfo::None())) {
+        return;
+      }
+      for (Node* use : merge->uses()) {
+        if (use->opcode() != IrOpcode::kPhi ||
+            !IsCompatible(PhiRepresentationOf(use->op()),
+                          info.representation)) {
+          continue;
+        }
+        bool matches = true;
+        for (size_t i = 0; matches && i < input_states.size(); ++i) {
+          FieldInfo const* input_info = input_states[i]->LookupField(
+              object, index_range, ConstFieldInfo::None());
+          matches = input_info != nullptr &&
+                    input_info->representation == info.representation &&
+                    input_info->name.address() == info.name.address() &&
+                    input_info->value == use->InputAt(static_cast<int>(i));
+        }
+        if (matches) {
+          state = state->AddField(
+              object, index_range,
+              FieldInfo(use, info.representation, info.name), zone);
+          return;
+        }
+      }
+    });
+  }
+  return state;
+}
+
 LoadElimination::AbstractState const* LoadElimination::AbstractState::KillAll(
     Zone* zone) const {
   // Kill everything except for const fields
@@ -1197,10 +1242,24 @@ Reduction LoadElimination::ReduceEffectPhi(Node* node) {
   // For each phi, try to compute the new state for the phi from
   // the inputs.
   AbstractState const* state_with_phis = state;
+  bool has_phis = false;
   for (Node* use : control->uses()) {
     if (use->opcode() == IrOpcode::kPhi) {
       state_with_phis = UpdateStateForPhi(state_with_phis, node, use);
+      has_phis = true;
+    }
+  }
+
+  // Fields that were stored with different values on the incoming paths are
+  // known to hold the phi of those values.
+  if (has_phis) {
+    ZoneVector<AbstractState const*> input_states(zone());
+    for (int i = 0; i < input_count; ++i) {
+      input_states.push_back(
+          node_states_.Get(NodeProperties::GetEffectInput(node, i)));
     }
+    state_with_phis =
+        state_with_phis->AddFieldPhis(control, input_states, zone());
   }
 
   return UpdateState(node, state_with_phis);
@@ -41,7 +41,7 @@ class V8_EXPORT_PRIVATE LoadElimination final
   Reduction Reduce(Node* node) final;
 
  private:
-  static const size_t kMaxTrackedElements = 8;
+  static const size_t kMaxTrackedElements = 16;
 
   // Abstract state to approximate the current state of an element along the
   // effect paths through the graph.
@@ -142,6 +142,10 @@ class V8_EXPORT_PRIVATE LoadElimination final
       return that;
     }
     FieldInfo const* Lookup(Node* object) const;
+    template <typename Callback>
+    void ForEach(Callback callback) const {
+      for (auto const& it : info_for_node_) callback(it.first, it.second);
+    }
     AbstractField const* KillConst(Node* object, Zone* zone) const;
     AbstractField const* Kill(const AliasStateInfo& alias_info,
                               MaybeHandle<Name> name, Zone* zone) const;
@@ -170,7 +174,7 @@ class V8_EXPORT_PRIVATE LoadElimination final
     ZoneMap<Node*, FieldInfo> info_for_node_;
   };
 
-  static size_t const kMaxTrackedFields = 32;
+  static size_t const kMaxTrackedFields = 48;
 
   // Abstract state to approximate the current map of an object along the
   // effect paths through the graph.
@@ -254,6 +258,11 @@ class V8_EXPORT_PRIVATE LoadElimination final
     AbstractState const* KillAll(Zone* zone) const;
     FieldInfo const* LookupField(Node* object, IndexRange index,
                                  ConstFieldInfo const_field_info) const;
+    // Adds the fields that hold different values on the incoming paths of
+    // {merge}, if a value phi at {merge} merges exactly those values.
+    AbstractState const* AddFieldPhis(
+        Node* merge, ZoneVector<AbstractState const*> const& input_states,
+        Zone* zone) const;
 
     AbstractState const* AddElement(Node* object, Node* index, Node* value,
                                     MachineRepresentation representation,
@@ -3,10 +3,14 @@
 // found in the LICENSE file.
 
 #include "src/compiler/loop-peeling.h"
+
+#include <cmath>
+
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-origin-table.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
@@ -210,70 +214,100 @@ bool LoopPeeler::CanPeel(LoopTree::Loop* loop) {
   return true;
 }
 
-PeeledIteration* LoopPeeler::Peel(LoopTree::Loop* loop) {
+PeeledIteration* LoopPeeler::Peel(LoopTree::Loop* loop, int iterations) {
+  DCHECK_LE(1, iterations);
   if (!CanPeel(loop)) return nullptr;
 
   //============================================================================
-  // Construct the peeled iteration.
+  // Construct the peeled iterations.
   //============================================================================
   PeeledIterationImpl* iter = tmp_zone_->New<PeeledIterationImpl>(tmp_zone_);
-  size_t estimated_peeled_size = 5 + (loop->TotalSize()) * 2;
-  Peeling peeling(graph_, estimated_peeled_size, &iter->node_pairs_);
+  size_t estimated_peeled_size = 5 + (loop->TotalSize()) * 2 * iterations;
 
   Node* dead = graph_->NewNode(common_->Dead());
-
-  // Map the loop header nodes to their entry values.
-  for (Node* node : loop_tree_->HeaderNodes(loop)) {
-    peeling.Insert(node, node->InputAt(kAssumedLoopEntryIndex));
-  }
-
-  // Copy all the nodes of loop body for the peeled iteration.
-  peeling.CopyNodes(graph_, tmp_zone_, dead, loop_tree_->BodyNodes(loop),
-                    source_positions_, node_origins_);
-
-  //============================================================================
-  // Replace the entry to the loop with the output of the peeled iteration.
-  //============================================================================
   Node* loop_node = loop_tree_->GetLoopControl(loop);
-  Node* new_entry;
   int backedges = loop_node->InputCount() - 1;
-  if (backedges > 1) {
-    // Multiple backedges from original loop, therefore multiple output edges
-    // from the peeled iteration.
-    NodeVector inputs(tmp_zone_);
-    for (int i = 1; i < loop_node->InputCount(); i++) {
-      inputs.push_back(peeling.map(loop_node->InputAt(i)));
-    }
-    Node* merge =
-        graph_->NewNode(common_->Merge(backedges), backedges, &inputs[0]);
 
-    // Merge values from the multiple output edges of the peeled iteration.
+  for (int peeled = 0; peeled < iterations; peeled++) {
+    Peeling peeling(graph_, estimated_peeled_size, &iter->node_pairs_);
+
+    // Map the loop header nodes to their entry values, which are the outputs
+    // of the previously peeled iteration from the second iteration on.
     for (Node* node : loop_tree_->HeaderNodes(loop)) {
-      if (node->opcode() == IrOpcode::kLoop) continue;  // already done.
-      inputs.clear();
-      for (int i = 0; i < backedges; i++) {
-        inputs.push_back(peeling.map(node->InputAt(1 + i)));
+      peeling.Insert(node, node->InputAt(kAssumedLoopEntryIndex));
+    }
+
+    // Copy all the nodes of loop body for the peeled iteration.
+    peeling.CopyNodes(graph_, tmp_zone_, dead, loop_tree_->BodyNodes(loop),
+                      source_positions_, node_origins_);
+
+    //==========================================================================
+    // Replace the entry to the loop with the output of the peeled iteration.
+    //==========================================================================
+    Node* new_entry;
+    if (backedges > 1) {
+      // Multiple backedges from original loop, therefore multiple output
+      // edges from the peeled iteration.
+      NodeVector inputs(tmp_zone_);
+      for (int i = 1; i < loop_node->InputCount(); i++) {
+        inputs.push_back(peeling.map(loop_node->InputAt(i)));
       }
-      for (Node* input : inputs) {
-        if (input != inputs[0]) {  // Non-redundant phi.
-          inputs.push_back(merge);
-          const Operator* op = common_->ResizeMergeOrPhi(node->op(), backedges);
-          Node* phi = graph_->NewNode(op, backedges + 1, &inputs[0]);
-          node->ReplaceInput(0, phi);
-          break;
+      Node* merge =
+          graph_->NewNode(common_->Merge(backedges), backedges, &inputs[0]);
+
+      // Merge values from the multiple output edges of the peeled iteration.
+      for (Node* node : loop_tree_->HeaderNodes(loop)) {
+        if (node->opcode() == IrOpcode::kLoop) continue;  // already done.
+        inputs.clear();
+        for (int i = 0; i < backedges; i++) {
+          inputs.push_back(peeling.map(node->InputAt(1 + i)));
+        }
+        for (Node* input : inputs) {
+          if (input != inputs[0]) {  // Non-redundant phi.
+            inputs.push_back(merge);
+            const Operator* op =
+                common_->ResizeMergeOrPhi(node->op(), backedges);
+            Node* phi = graph_->NewNode(op, backedges + 1, &inputs[0]);
+            node->ReplaceInput(0, phi);
+            break;
+          }
         }
       }
+      new_entry = merge;
+    } else {
+      // Only one backedge, simply replace the input to loop with output of
+      // peeling.
+      for (Node* node : loop_tree_->HeaderNodes(loop)) {
+        node->ReplaceInput(0, peeling.map(node->InputAt(1)));
+      }
+      new_entry = peeling.map(loop_node->InputAt(1));
     }
-    new_entry = merge;
-  } else {
-    // Only one backedge, simply replace the input to loop with output of
-    // peeling.
-    for (Node* node : loop_tree_->HeaderNodes(loop)) {
-      node->ReplaceInput(0, peeling.map(node->InputAt(1)));
+    loop_node->ReplaceInput(0, new_entry);
+
+    //==========================================================================
+    // Add the exits of the peeled iteration to the exit markers. They keep
+    // their operators until all iterations are peeled, so that their inputs
+    // still map into the loop body.
+    //==========================================================================
+    for (Node* exit : loop_tree_->ExitNodes(loop)) {
+      switch (exit->opcode()) {
+        case IrOpcode::kLoopExit:
+          if (peeled == 0) {
+            exit->ReplaceInput(1, peeling.map(exit->InputAt(0)));
+          } else {
+            exit->AppendInput(graph_->zone(), peeling.map(exit->InputAt(0)));
+          }
+          break;
+        case IrOpcode::kLoopExitValue:
+        case IrOpcode::kLoopExitEffect:
+          exit->InsertInput(graph_->zone(), 1 + peeled,
+                            peeling.map(exit->InputAt(0)));
+          break;
+        default:
+          break;
+      }
     }
-    new_entry = peeling.map(loop_node->InputAt(1));
   }
-  loop_node->ReplaceInput(0, new_entry);
 
   //============================================================================
   // Change the exit and exit markers to merge/phi/effect-phi.
@@ -282,19 +316,16 @@ PeeledIteration* LoopPeeler::Peel(LoopTree::Loop* loop) {
     switch (exit->opcode()) {
       case IrOpcode::kLoopExit:
         // Change the loop exit node to a merge node.
-        exit->ReplaceInput(1, peeling.map(exit->InputAt(0)));
-        NodeProperties::ChangeOp(exit, common_->Merge(2));
+        NodeProperties::ChangeOp(exit, common_->Merge(1 + iterations));
         break;
       case IrOpcode::kLoopExitValue:
         // Change exit marker to phi.
-        exit->InsertInput(graph_->zone(), 1, peeling.map(exit->InputAt(0)));
         NodeProperties::ChangeOp(
-            exit, common_->Phi(MachineRepresentation::kTagged, 2));
+            exit, common_->Phi(MachineRepresentation::kTagged, 1 + iterations));
         break;
       case IrOpcode::kLoopExitEffect:
         // Change effect exit marker to effect phi.
-        exit->InsertInput(graph_->zone(), 1, peeling.map(exit->InputAt(0)));
-        NodeProperties::ChangeOp(exit, common_->EffectPhi(2));
+        NodeProperties::ChangeOp(exit, common_->EffectPhi(1 + iterations));
         break;
       default:
         break;
@@ -313,15 +344,117 @@ void LoopPeeler::PeelInnerLoops(LoopTree::Loop* loop) {
   }
   // Only peel small-enough loops.
   if (loop->TotalSize() > LoopPeeler::kMaxPeeledNodes) return;
+
+  // Loops that run only a few times are unrolled completely by peeling off
+  // every iteration. The branch that leaves the last peeled iteration folds
+  // to a constant once its inputs are constants, and the remaining loop
+  // becomes dead.
+  int iterations = 1;
+  if (FLAG_turbo_loop_unrolling) {
+    int trip_count = SmallTripCount(loop);
+    if (trip_count > 1 &&
+        loop->TotalSize() * static_cast<size_t>(trip_count) <=
+            LoopPeeler::kMaxPeeledNodes) {
+      iterations = trip_count;
+    }
+  }
   if (FLAG_trace_turbo_loop) {
-    PrintF("Peeling loop with header: ");
+    if (iterations > 1) {
+      PrintF("Unrolling %i iterations of loop with header: ", iterations);
+    } else {
+      PrintF("Peeling loop with header: ");
+    }
     for (Node* node : loop_tree_->HeaderNodes(loop)) {
       PrintF("%i ", node->id());
     }
     PrintF("\n");
   }
 
-  Peel(loop);
+  Peel(loop, iterations);
+}
+
+namespace {
+
+bool IsIntegerConstant(Node* node, int64_t* value) {
+  Int32Matcher int32(node);
+  if (int32.HasResolvedValue()) {
+    *value = int32.ResolvedValue();
+    return true;
+  }
+  NumberMatcher number(node);
+  if (number.HasResolvedValue() && number.IsInteger() &&
+      std::abs(number.ResolvedValue()) <= kMaxInt) {
+    *value = static_cast<int64_t>(number.ResolvedValue());
+    return true;
+  }
+  return false;
+}
+
+bool IsAddition(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kInt32Add:
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+    case IrOpcode::kSpeculativeSafeIntegerAdd:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+int LoopPeeler::SmallTripCount(LoopTree::Loop* loop) {
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return 0;
+
+  // Look for an exit on the false branch of {phi < end} or {phi <= end},
+  // where {phi} starts at a constant and grows by a constant step. The exit
+  // need not be taken on every iteration, so the result is an estimate, but
+  // peeling off any number of iterations is correct.
+  int result = 0;
+  for (Node* exit : loop_tree_->ExitNodes(loop)) {
+    if (exit->opcode() != IrOpcode::kLoopExit) continue;
+    Node* if_false = NodeProperties::GetControlInput(exit);
+    if (if_false->opcode() != IrOpcode::kIfFalse) continue;
+    Node* condition = NodeProperties::GetControlInput(if_false)->InputAt(0);
+    bool inclusive;
+    switch (condition->opcode()) {
+      case IrOpcode::kInt32LessThan:
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kSpeculativeNumberLessThan:
+        inclusive = false;
+        break;
+      case IrOpcode::kInt32LessThanOrEqual:
+      case IrOpcode::kNumberLessThanOrEqual:
+      case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+        inclusive = true;
+        break;
+      default:
+        continue;
+    }
+    Node* phi = condition->InputAt(0);
+    if (phi->opcode() != IrOpcode::kPhi ||
+        NodeProperties::GetControlInput(phi) != loop_node) {
+      continue;
+    }
+    Node* increment = phi->InputAt(1);
+    int64_t start, step, end;
+    if (!IsIntegerConstant(phi->InputAt(0), &start) ||
+        !IsAddition(increment) || increment->InputAt(0) != phi ||
+        !IsIntegerConstant(increment->InputAt(1), &step) || step <= 0 ||
+        !IsIntegerConstant(condition->InputAt(1), &end)) {
+      continue;
+    }
+    if (inclusive) end++;
+    // The header runs once more than the body, to find that the loop is done.
+    int64_t trip_count = end <= start ? 1 : (end - start + step - 1) / step + 1;
+    if (trip_count > kMaxUnrolledIterations) continue;
+    if (result == 0 || trip_count < result) {
+      result = static_cast<int>(trip_count);
+    }
+  }
+  return result;
 }
 
 namespace {
@@ -44,11 +44,19 @@ class V8_EXPORT_PRIVATE LoopPeeler {
         source_positions_(source_positions),
         node_origins_(node_origins) {}
   bool CanPeel(LoopTree::Loop* loop);
-  PeeledIteration* Peel(LoopTree::Loop* loop);
+  // Peels the first {iterations} iterations off {loop}. The returned mapping
+  // refers to the copies of the first peeled iteration.
+  PeeledIteration* Peel(LoopTree::Loop* loop, int iterations = 1);
   void PeelInnerLoopsOfTree();
 
+  // Returns how often the header of {loop} runs if {loop} counts from a
+  // constant to a constant bound in constant steps, and that is at most
+  // {kMaxUnrolledIterations}. Returns 0 otherwise.
+  int SmallTripCount(LoopTree::Loop* loop);
+
   static void EliminateLoopExits(Graph* graph, Zone* tmp_zone);
   static const size_t kMaxPeeledNodes = 1000;
+  static const int kMaxUnrolledIterations = 8;
 
  private:
   Graph* const graph_;
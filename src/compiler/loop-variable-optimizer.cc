@@ -220,6 +220,19 @@ const InductionVariable* LoopVariableOptimizer::FindInductionVariable(
   return nullptr;
 }
 
+namespace {
+
+Node* SkipToNumber(Node* node) {
+  if (node->opcode() == IrOpcode::kSpeculativeToNumber ||
+      node->opcode() == IrOpcode::kJSToNumber ||
+      node->opcode() == IrOpcode::kJSToNumberConvertBigInt) {
+    return node->InputAt(0);
+  }
+  return node;
+}
+
+}  // namespace
+
 InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   DCHECK_EQ(2, phi->op()->ValueInputCount());
   Node* loop = NodeProperties::GetControlInput(phi);
@@ -241,14 +254,16 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
     return nullptr;
   }
 
-  // TODO(jarin) Support both sides.
-  Node* input = arith->InputAt(0);
-  if (input->opcode() == IrOpcode::kSpeculativeToNumber ||
-      input->opcode() == IrOpcode::kJSToNumber ||
-      input->opcode() == IrOpcode::kJSToNumberConvertBigInt) {
-    input = input->InputAt(0);
+  // The phi may appear on either side of an addition; for subtraction it
+  // has to be the left operand.
+  int phi_index = 0;
+  if (SkipToNumber(arith->InputAt(0)) != phi) {
+    if (arithmeticType != InductionVariable::ArithmeticType::kAddition ||
+        SkipToNumber(arith->InputAt(1)) != phi) {
+      return nullptr;
+    }
+    phi_index = 1;
   }
-  if (input != phi) return nullptr;
 
   Node* effect_phi = nullptr;
   for (Node* use : loop->uses()) {
@@ -259,7 +274,7 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   }
   if (!effect_phi) return nullptr;
 
-  Node* incr = arith->InputAt(1);
+  Node* incr = arith->InputAt(1 - phi_index);
   return zone()->New<InductionVariable>(phi, effect_phi, arith, incr, initial,
                                         zone(), arithmeticType);
 }
@@ -37,6 +37,8 @@ class MemoryLowering::AllocationGroup final : public ZoneObject {
   Node* size() const { return size_; }
 
  private:
+  bool ContainsAllocation(Node* object) const;
+
   ZoneSet<NodeId> node_ids_;
   AllocationType const allocation_;
   Node* const size_;
@@ -503,6 +505,11 @@ WriteBarrierKind MemoryLowering::ComputeWriteBarrierKind(
   if (!ValueNeedsWriteBarrier(value, isolate())) {
     write_barrier_kind = kNoWriteBarrier;
   }
+  // An object pointing to itself needs neither a remembered set entry nor
+  // marking: if it is already marked, so is the value.
+  if (value == object) {
+    write_barrier_kind = kNoWriteBarrier;
+  }
   if (write_barrier_kind == WriteBarrierKind::kAssertNoWriteBarrier) {
     write_barrier_assert_failed_(node, object, function_debug_name_, zone());
   }
@@ -543,6 +550,20 @@ void MemoryLowering::AllocationGroup::Add(Node* node) {
 }
 
 bool MemoryLowering::AllocationGroup::Contains(Node* node) const {
+  // A Phi of objects in this group, e.g. of allocations folded into the group
+  // on different branches, is in the group as well.
+  if (node->opcode() == IrOpcode::kPhi) {
+    for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+      if (!ContainsAllocation(NodeProperties::GetValueInput(node, i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return ContainsAllocation(node);
+}
+
+bool MemoryLowering::AllocationGroup::ContainsAllocation(Node* node) const {
   // Additions should stay within the same allocated object, so it's safe to
   // ignore them.
   while (node_ids_.find(node->id()) == node_ids_.end()) {
@@ -54,9 +54,24 @@ void Node::OutOfLineInputs::ExtractFrom(Use* old_use_ptr,
 struct NodeWithOutOfLineInputs {};
 struct NodeWithInLineInputs {};
 
+// static
+int Node::InlineCapacityFor(int input_count, bool has_extensible_inputs) {
+  DCHECK_GE(input_count, 0);
+  if (input_count > kMaxInlineCapacity) return 0;
+  // Capacity must be at least 1 so that an OutOfLineInputs pointer can be
+  // stored when inputs are added later.
+  int capacity = std::max(1, input_count);
+  if (has_extensible_inputs) {
+    const int max = kMaxInlineCapacity;
+    capacity = std::min(input_count + 3, max);
+  }
+  return capacity;
+}
+
 template <typename NodePtrT>
-Node* Node::NewImpl(Zone* zone, NodeId id, const Operator* op, int input_count,
-                    NodePtrT const* inputs, bool has_extensible_inputs) {
+Node* Node::NewImpl(Zone* zone, Node* dead, NodeId id, const Operator* op,
+                    int input_count, NodePtrT const* inputs,
+                    bool has_extensible_inputs) {
   // Node uses compressed pointers, so zone must support pointer compression.
   DCHECK_IMPLIES(kCompressGraphZone, zone->supports_compression());
   DCHECK_GE(input_count, 0);
@@ -75,6 +90,7 @@ Node* Node::NewImpl(Zone* zone, NodeId id, const Operator* op, int input_count,
   }
 
   if (input_count > kMaxInlineCapacity) {
+    DCHECK_NULL(dead);
     // Allocate out-of-line inputs.
     int capacity =
         has_extensible_inputs ? input_count + kMaxInlineCapacity : input_count;
@@ -93,20 +109,21 @@ Node* Node::NewImpl(Zone* zone, NodeId id, const Operator* op, int input_count,
     use_ptr = reinterpret_cast<Use*>(outline);
     is_inline = false;
   } else {
-    // Allocate node with inline inputs. Capacity must be at least 1 so that
-    // an OutOfLineInputs pointer can be stored when inputs are added later.
-    int capacity = std::max(1, input_count);
-    if (has_extensible_inputs) {
-      const int max = kMaxInlineCapacity;
-      capacity = std::min(input_count + 3, max);
+    // Allocate node with inline inputs, or reuse the storage of {dead}.
+    int capacity = InlineCapacityFor(input_count, has_extensible_inputs);
+    void* node_buffer;
+    if (dead != nullptr) {
+      DCHECK_EQ(capacity, dead->RecyclableCapacity());
+      node_buffer = dead;
+    } else {
+      size_t size =
+          sizeof(Node) + capacity * (sizeof(ZoneNodePtr) + sizeof(Use));
+      intptr_t raw_buffer = reinterpret_cast<intptr_t>(
+          zone->Allocate<NodeWithInLineInputs>(size));
+      node_buffer =
+          reinterpret_cast<void*>(raw_buffer + capacity * sizeof(Use));
     }
 
-    size_t size = sizeof(Node) + capacity * (sizeof(ZoneNodePtr) + sizeof(Use));
-    intptr_t raw_buffer =
-        reinterpret_cast<intptr_t>(zone->Allocate<NodeWithInLineInputs>(size));
-    void* node_buffer =
-        reinterpret_cast<void*>(raw_buffer + capacity * sizeof(Use));
-
     node = new (node_buffer) Node(id, op, input_count, capacity);
     input_ptr = node->inline_inputs();
     use_ptr = reinterpret_cast<Use*>(node);
@@ -130,7 +147,16 @@ Node* Node::NewImpl(Zone* zone, NodeId id, const Operator* op, int input_count,
 
 Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
                 Node* const* inputs, bool has_extensible_inputs) {
-  return NewImpl(zone, id, op, input_count, inputs, has_extensible_inputs);
+  return NewImpl(zone, nullptr, id, op, input_count, inputs,
+                 has_extensible_inputs);
+}
+
+Node* Node::NewInPlace(Zone* zone, Node* dead, NodeId id, const Operator* op,
+                       int input_count, Node* const* inputs,
+                       bool has_extensible_inputs) {
+  DCHECK_NOT_NULL(dead);
+  return NewImpl(zone, dead, id, op, input_count, inputs,
+                 has_extensible_inputs);
 }
 
 Node* Node::Clone(Zone* zone, NodeId id, const Node* node) {
@@ -138,7 +164,8 @@ Node* Node::Clone(Zone* zone, NodeId id, const Node* node) {
   ZoneNodePtr const* const inputs = node->has_inline_inputs()
                                         ? node->inline_inputs()
                                         : node->outline_inputs()->inputs();
-  Node* const clone = NewImpl(zone, id, node->op(), input_count, inputs, false);
+  Node* const clone =
+      NewImpl(zone, nullptr, id, node->op(), input_count, inputs, false);
   clone->set_type(node->type());
   return clone;
 }
@@ -150,6 +177,11 @@ void Node::Kill() {
   DCHECK(uses().empty());
 }
 
+int Node::RecyclableCapacity() const {
+  if (!IsDead() || first_use_ != nullptr || !has_inline_inputs()) return 0;
+  return InlineCapacityField::decode(bit_field_);
+}
+
 
 void Node::AppendInput(Zone* zone, Node* new_to) {
   DCHECK_NOT_NULL(zone);
@@ -45,9 +45,24 @@ class V8_EXPORT_PRIVATE Node final {
                    Node* const* inputs, bool has_extensible_inputs);
   static Node* Clone(Zone* zone, NodeId id, const Node* node);
 
+  // Like New, but constructs the node in the storage of the killed node
+  // {dead}. The inline capacity of {dead} must match the one that New would
+  // reserve, see InlineCapacityFor.
+  static Node* NewInPlace(Zone* zone, Node* dead, NodeId id,
+                          const Operator* op, int input_count,
+                          Node* const* inputs, bool has_extensible_inputs);
+
+  // Returns the inline input capacity that New reserves for a node with
+  // {input_count} inputs, or 0 if the inputs are stored out-of-line.
+  static int InlineCapacityFor(int input_count, bool has_extensible_inputs);
+
   inline bool IsDead() const;
   void Kill();
 
+  // Returns the inline input capacity of a killed node, or 0 if its storage
+  // cannot be reused by NewInPlace.
+  int RecyclableCapacity() const;
+
   const Operator* op() const { return op_; }
 
   IrOpcode::Value opcode() const {
@@ -154,8 +169,9 @@ class V8_EXPORT_PRIVATE Node final {
 
  private:
   template <typename NodePtrT>
-  inline static Node* NewImpl(Zone* zone, NodeId id, const Operator* op,
-                              int input_count, NodePtrT const* inputs,
+  inline static Node* NewImpl(Zone* zone, Node* dead, NodeId id,
+                              const Operator* op, int input_count,
+                              NodePtrT const* inputs,
                               bool has_extensible_inputs);
 
   struct Use;
@@ -95,6 +95,11 @@ void PipelineStatistics::EndPhaseKind() {
   TRACE_EVENT_END0(kTraceCategory, phase_kind_name_);
 }
 
+void PipelineStatistics::RecordCounter(const char* counter_name,
+                                       size_t value) {
+  compilation_stats_->RecordCounter(counter_name, value);
+}
+
 void PipelineStatistics::BeginPhase(const char* phase_name) {
   TRACE_EVENT_BEGIN0(kTraceCategory, phase_name);
   DCHECK(InPhaseKind());
@@ -19,6 +19,7 @@
 #include "src/compiler/add-type-assertions-reducer.h"
 #include "src/compiler/backend/code-generator.h"
 #include "src/compiler/backend/frame-elider.h"
+#include "src/compiler/backend/instruction-scheduler.h"
 #include "src/compiler/backend/instruction-selector.h"
 #include "src/compiler/backend/instruction.h"
 #include "src/compiler/backend/jump-threading.h"
@@ -80,12 +81,15 @@
 #include "src/compiler/verifier.h"
 #include "src/compiler/wasm-compiler.h"
 #include "src/compiler/zone-stats.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/diagnostics/disassembler.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/init/bootstrapper.h"
 #include "src/logging/counters.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/parsing/parse-info.h"
 #include "src/tracing/trace-event.h"
@@ -127,6 +131,29 @@ Maybe<OuterContext> GetModuleContext(Handle<JSFunction> closure) {
   return Nothing<OuterContext>();
 }
 
+// Basic block counts from earlier instrumented compilations of a JS function,
+// used like the counts read from --turbo-profiling-log-file for builtins.
+class ProfileDataFromProfiler final : public ProfileDataFromFile {
+ public:
+  static std::unique_ptr<ProfileDataFromProfiler> TryCollect(
+      const char* function_name, int hash) {
+    std::unique_ptr<ProfileDataFromProfiler> data(new ProfileDataFromProfiler);
+    if (!BasicBlockProfiler::Get()->CollectCounts(
+            function_name, hash, &data->block_counts_by_id_)) {
+      return nullptr;
+    }
+    data->hash_ = hash;
+    return data;
+  }
+
+ private:
+  ProfileDataFromProfiler() = default;
+};
+
+// Compute a hash of the graph, to match profiling data with the graph it was
+// collected for.
+int HashGraphForPGO(Graph* graph);
+
 }  // anonymous namespace
 
 class PipelineData {
@@ -148,7 +175,8 @@ class PipelineData {
             !isolate->IsGeneratingEmbeddedBuiltins()),
         graph_zone_scope_(zone_stats_, kGraphZoneName, kCompressGraphZone),
         graph_zone_(graph_zone_scope_.zone()),
-        instruction_zone_scope_(zone_stats_, kInstructionZoneName),
+        instruction_zone_scope_(zone_stats_, kInstructionZoneName,
+                                kCompressInstructionZone),
         instruction_zone_(instruction_zone_scope_.zone()),
         codegen_zone_scope_(zone_stats_, kCodegenZoneName),
         codegen_zone_(codegen_zone_scope_.zone()),
@@ -201,7 +229,8 @@ class PipelineData {
         machine_(mcgraph->machine()),
         common_(mcgraph->common()),
         mcgraph_(mcgraph),
-        instruction_zone_scope_(zone_stats_, kInstructionZoneName),
+        instruction_zone_scope_(zone_stats_, kInstructionZoneName,
+                                kCompressInstructionZone),
         instruction_zone_(instruction_zone_scope_.zone()),
         codegen_zone_scope_(zone_stats_, kCodegenZoneName),
         codegen_zone_(codegen_zone_scope_.zone()),
@@ -230,7 +259,8 @@ class PipelineData {
         source_positions_(source_positions),
         node_origins_(node_origins),
         schedule_(schedule),
-        instruction_zone_scope_(zone_stats_, kInstructionZoneName),
+        instruction_zone_scope_(zone_stats_, kInstructionZoneName,
+                                kCompressInstructionZone),
         instruction_zone_(instruction_zone_scope_.zone()),
         codegen_zone_scope_(zone_stats_, kCodegenZoneName),
         codegen_zone_(codegen_zone_scope_.zone()),
@@ -268,7 +298,8 @@ class PipelineData {
         debug_name_(info_->GetDebugName()),
         zone_stats_(zone_stats),
         graph_zone_scope_(zone_stats_, kGraphZoneName, kCompressGraphZone),
-        instruction_zone_scope_(zone_stats_, kInstructionZoneName),
+        instruction_zone_scope_(zone_stats_, kInstructionZoneName,
+                                kCompressInstructionZone),
         instruction_zone_(sequence->zone()),
         sequence_(sequence),
         codegen_zone_scope_(zone_stats_, kCodegenZoneName),
@@ -556,6 +587,10 @@ class PipelineData {
   void set_profile_data(const ProfileDataFromFile* profile_data) {
     profile_data_ = profile_data;
   }
+  void set_profile_data(std::unique_ptr<ProfileDataFromProfiler> profile_data) {
+    profile_data_ = profile_data.get();
+    profile_data_from_profiler_ = std::move(profile_data);
+  }
 
   // RuntimeCallStats that is only available during job execution but not
   // finalization.
@@ -639,6 +674,7 @@ class PipelineData {
 
   RuntimeCallStats* runtime_call_stats_ = nullptr;
   const ProfileDataFromFile* profile_data_ = nullptr;
+  std::unique_ptr<ProfileDataFromProfiler> profile_data_from_profiler_;
 };
 
 class PipelineImpl final {
@@ -1100,6 +1136,21 @@ class PipelineJobScope {
 };
 }  // namespace
 
+namespace {
+
+// Previous versions of {function} deopted over and over because they bailed
+// out on feedback that was still uninitialized. Compile generic code for such
+// sites instead of speculating again.
+bool KeepsDeoptingOnUninitializedFeedback(Handle<JSFunction> function) {
+  if (!function->has_feedback_vector()) return false;
+  FeedbackVector vector = function->feedback_vector();
+  return vector.repeated_deopt_count() >=
+             FLAG_max_repeated_uninitialized_deopts &&
+         IsInsufficientTypeFeedbackReason(vector.last_deopt_reason());
+}
+
+}  // namespace
+
 PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
     Isolate* isolate) {
   // Ensure that the RuntimeCallStats table of main thread is available for
@@ -1111,7 +1162,8 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
     return AbortOptimization(BailoutReason::kFunctionTooBig);
   }
 
-  if (!FLAG_always_opt && !compilation_info()->IsNativeContextIndependent()) {
+  if (!FLAG_always_opt && !compilation_info()->IsNativeContextIndependent() &&
+      !KeepsDeoptingOnUninitializedFeedback(compilation_info()->closure())) {
     compilation_info()->set_bailout_on_uninitialized();
   }
   if (FLAG_turbo_loop_peeling) {
@@ -1652,6 +1704,11 @@ struct EscapeAnalysisPhase {
     reducer.ReduceGraph();
     // TODO(tebbi): Turn this into a debug mode check once we have confidence.
     escape_reducer.VerifyReplacement();
+    if (FLAG_trace_turbo_escape) {
+      PrintF("Escape analysis removed %zu allocations from %s\n",
+             escape_reducer.removed_allocations(),
+             data->info()->GetDebugName().get());
+    }
   }
 };
 
@@ -1682,6 +1739,13 @@ struct SimplifiedLoweringPhase {
     UnparkedScopeIfNeeded scope(data->broker());
 
     lowering.LowerAllNodes();
+
+    if (data->pipeline_statistics() != nullptr) {
+      data->pipeline_statistics()->RecordCounter(
+          "eliminated_overflow_checks", lowering.eliminated_overflow_checks());
+      data->pipeline_statistics()->RecordCounter(
+          "remaining_overflow_checks", lowering.remaining_overflow_checks());
+    }
   }
 };
 
@@ -2128,6 +2192,19 @@ std::ostream& operator<<(std::ostream& out, const InstructionRangesAsJSON& s) {
   return out;
 }
 
+namespace {
+
+// Builtins are only scheduled on request, so that the snapshot doesn't depend
+// on the CPU of the machine building it.
+bool ShouldScheduleInstructions(OptimizedCompilationInfo* info) {
+  if (FLAG_turbo_instruction_scheduling) return true;
+  return FLAG_turbo_instruction_scheduling_by_cpu &&
+         (info->IsOptimizing() || info->IsWasm()) &&
+         InstructionScheduler::SchedulerEnabledByDefault();
+}
+
+}  // namespace
+
 struct InstructionSelectionPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(SelectInstructions)
 
@@ -2145,7 +2222,7 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
+        ShouldScheduleInstructions(data->info())
             ? InstructionSelector::kEnableScheduling
             : InstructionSelector::kDisableScheduling,
         data->roots_relative_addressing_enabled()
@@ -2630,9 +2707,24 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     data->node_origins()->RemoveDecorator();
   }
 
+  int graph_hash_before_scheduling = 0;
+  if (FLAG_turbo_profiling) {
+    graph_hash_before_scheduling = HashGraphForPGO(data->graph());
+    if (FLAG_turbo_profiling_guided_layout) {
+      // Defer the blocks which earlier instrumented versions of this code
+      // rarely entered.
+      data->set_profile_data(ProfileDataFromProfiler::TryCollect(
+          data->debug_name(), graph_hash_before_scheduling));
+    }
+  }
+
   ComputeScheduledGraph();
 
-  return SelectInstructions(linkage);
+  if (!SelectInstructions(linkage)) return false;
+  if (FLAG_turbo_profiling) {
+    data->info()->profiler_data()->SetHash(graph_hash_before_scheduling);
+  }
+  return true;
 }
 
 bool PipelineImpl::OptimizeGraphForMidTier(Linkage* linkage) {
@@ -3361,7 +3453,30 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   data->DeleteGraphZone();
 
-  data->BeginPhaseKind("V8.TFRegisterAllocation");
+  // The mid-tier allocator is linear in the size of the function, whereas
+  // building and splitting live ranges in the top-tier allocator can take
+  // disproportionately long for very large functions. Trade some code
+  // quality for a bounded compile time in that case. The two choices are
+  // reported as separate phase kinds in --turbo-stats.
+  bool use_mid_tier_register_allocator =
+      data->info()->IsTurboprop() && FLAG_turboprop_mid_tier_reg_alloc;
+  if (!use_mid_tier_register_allocator) {
+    InstructionSequence* sequence = data->sequence();
+    const int instruction_threshold =
+        FLAG_turbo_mid_tier_regalloc_instruction_threshold;
+    const int virtual_register_threshold =
+        FLAG_turbo_mid_tier_regalloc_virtual_register_threshold;
+    use_mid_tier_register_allocator =
+        (instruction_threshold > 0 &&
+         static_cast<int>(sequence->instructions().size()) >=
+             instruction_threshold) ||
+        (virtual_register_threshold > 0 &&
+         sequence->VirtualRegisterCount() >= virtual_register_threshold);
+  }
+
+  data->BeginPhaseKind(use_mid_tier_register_allocator
+                           ? "V8.TFMidTierRegisterAllocation"
+                           : "V8.TFRegisterAllocation");
 
   bool run_verifier = FLAG_turbo_verify_allocation;
 
@@ -3385,7 +3500,7 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
       config = RegisterConfiguration::Default();
     }
 
-    if (data->info()->IsTurboprop() && FLAG_turboprop_mid_tier_reg_alloc) {
+    if (use_mid_tier_register_allocator) {
       AllocateRegistersForMidTier(config, call_descriptor, run_verifier);
     } else {
       AllocateRegistersForTopTier(config, call_descriptor, run_verifier);
@@ -88,9 +88,10 @@ bool RedundancyElimination::EffectPathChecks::Equals(
 }
 
 void RedundancyElimination::EffectPathChecks::Merge(
-    EffectPathChecks const* that) {
+    EffectPathChecks const* that, Zone* zone) {
   // Change the current check list to a longest common tail of this check
   // list and the other list.
+  Check* const this_head = head_;
 
   // First, we throw away the prefix of the longer list, so that
   // we have lists of the same length.
@@ -114,6 +115,17 @@ void RedundancyElimination::EffectPathChecks::Merge(
     head_ = head_->next;
     that_head = that_head->next;
   }
+
+  // Checks without value outputs (i.e. CheckIf) don't need to dominate the
+  // checks they make redundant, so keep the ones that were done on both
+  // paths, even if by different nodes.
+  Check* const tail = head_;
+  for (Check* check = this_head; check != tail; check = check->next) {
+    if (check->node->op()->ValueOutputCount() != 0) continue;
+    if (that->LookupCheck(check->node) == nullptr) continue;
+    head_ = zone->New<Check>(check->node, head_);
+    size_++;
+  }
 }
 
 RedundancyElimination::EffectPathChecks const*
@@ -299,7 +311,7 @@ Reduction RedundancyElimination::ReduceEffectPhi(Node* node) {
       zone(), node_checks_.Get(NodeProperties::GetEffectInput(node, 0)));
   for (int i = 1; i < input_count; ++i) {
     Node* const input = NodeProperties::GetEffectInput(node, i);
-    checks->Merge(node_checks_.Get(input));
+    checks->Merge(node_checks_.Get(input), zone());
   }
   return UpdateChecks(node, checks);
 }
@@ -34,7 +34,7 @@ class V8_EXPORT_PRIVATE RedundancyElimination final : public AdvancedReducer {
     static EffectPathChecks* Copy(Zone* zone, EffectPathChecks const* checks);
     static EffectPathChecks const* Empty(Zone* zone);
     bool Equals(EffectPathChecks const* that) const;
-    void Merge(EffectPathChecks const* that);
+    void Merge(EffectPathChecks const* that, Zone* zone);
 
     EffectPathChecks const* AddCheck(Zone* zone, Node* node) const;
     Node* LookupCheck(Node* node) const;
@@ -224,6 +224,7 @@ namespace compiler {
   V(StaNamedProperty)                 \
   V(StaNamedPropertyNoFeedback)       \
   V(Star)                             \
+  V(StarLdaNamedProperty)             \
   V(SwitchOnGeneratorState)           \
   V(SwitchOnSmiNoFeedback)            \
   V(TestIn)                           \
@@ -3264,6 +3265,16 @@ void SerializerForBackgroundCompilation::VisitLdaNamedProperty(
   ProcessNamedPropertyAccess(receiver, name, slot, AccessMode::kLoad);
 }
 
+void SerializerForBackgroundCompilation::VisitStarLdaNamedProperty(
+    BytecodeArrayIterator* iterator) {
+  VisitStar(iterator);
+  Hints* receiver = &register_hints(iterator->GetRegisterOperand(1));
+  NameRef name(broker(),
+               iterator->GetConstantForIndexOperand(2, broker()->isolate()));
+  FeedbackSlot slot = iterator->GetSlotOperand(3);
+  ProcessNamedPropertyAccess(receiver, name, slot, AccessMode::kLoad);
+}
+
 void SerializerForBackgroundCompilation::VisitLdaNamedPropertyFromSuper(
     BytecodeArrayIterator* iterator) {
   NameRef(broker(),
@@ -1441,7 +1441,10 @@ class RepresentationSelector {
           truncation.IsUsedAsWord32()) {
         // => Int32Add/Sub
         VisitWord32TruncatingBinop<T>(node);
-        if (lower<T>()) ChangeToPureOp(node, Int32Op(node));
+        if (lower<T>()) {
+          ChangeToPureOp(node, Int32Op(node));
+          lowering->eliminated_overflow_checks_++;
+        }
         return;
       }
     }
@@ -1494,9 +1497,10 @@ class RepresentationSelector {
                                right_feedback_type, type_cache_,
                                graph_zone())) {
         ChangeToPureOp(node, Int32Op(node));
-
+        lowering->eliminated_overflow_checks_++;
       } else {
         ChangeToInt32OverflowOp(node);
+        lowering->remaining_overflow_checks_++;
       }
     }
     return;
@@ -1734,6 +1738,9 @@ class RepresentationSelector {
         return MachineType::Float64();
       case CTypeInfo::Type::kV8Value:
         return MachineType::AnyTagged();
+      case CTypeInfo::Type::kUint8Array:
+      case CTypeInfo::Type::kOneByteString:
+        return MachineType::Pointer();
     }
   }
 
@@ -1756,6 +1763,10 @@ class RepresentationSelector {
       case CTypeInfo::Type::kFloat64:
         return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
       case CTypeInfo::Type::kV8Value:
+      // Typed arrays and strings are checked and unpacked in
+      // EffectControlLinearizer::LowerFastApiCall.
+      case CTypeInfo::Type::kUint8Array:
+      case CTypeInfo::Type::kOneByteString:
         return UseInfo::AnyTagged();
     }
   }
@@ -49,6 +49,15 @@ class V8_EXPORT_PRIVATE SimplifiedLowering final {
   void DoSigned32ToUint8Clamped(Node* node);
   void DoUnsigned32ToUint8Clamped(Node* node);
 
+  // Number of speculative integer additions/subtractions that were lowered
+  // without (respectively with) an overflow check.
+  size_t eliminated_overflow_checks() const {
+    return eliminated_overflow_checks_;
+  }
+  size_t remaining_overflow_checks() const {
+    return remaining_overflow_checks_;
+  }
+
  private:
   JSGraph* const jsgraph_;
   JSHeapBroker* broker_;
@@ -74,6 +83,9 @@ class V8_EXPORT_PRIVATE SimplifiedLowering final {
   TickCounter* const tick_counter_;
   Linkage* const linkage_;
 
+  size_t eliminated_overflow_checks_ = 0;
+  size_t remaining_overflow_checks_ = 0;
+
   Node* Float64Round(Node* const node);
   Node* Float64Sign(Node* const node);
   Node* Int32Abs(Node* const node);
@@ -4,6 +4,7 @@
 
 #include "src/compiler/typer.h"
 
+#include <cmath>
 #include <iomanip>
 
 #include "src/base/flags.h"
@@ -165,6 +166,29 @@ class Typer::Visitor : public Reducer {
     return TypeOrNone(operand_node);
   }
 
+  // Type of an induction variable bound with NaN removed, since a comparison
+  // against NaN never holds and thus never lets the loop continue.
+  Type OrderedBoundType(Node* bound) {
+    Type type = TypeOrNone(bound);
+    if (!type.Is(Type::Number())) return type;
+    return Type::Intersect(type, Type::OrderedNumber(), zone());
+  }
+
+  // Largest (resp. smallest) integer that satisfies the comparison against
+  // a bound of type {bound_type}; the bound itself need not be integral.
+  static double IntegerUpperBound(Type bound_type,
+                                  InductionVariable::ConstraintKind kind) {
+    double max = bound_type.Max();
+    return kind == InductionVariable::kStrict ? std::ceil(max) - 1
+                                              : std::floor(max);
+  }
+  static double IntegerLowerBound(Type bound_type,
+                                  InductionVariable::ConstraintKind kind) {
+    double min = bound_type.Min();
+    return kind == InductionVariable::kStrict ? std::floor(min) + 1
+                                              : std::ceil(min);
+  }
+
   Type Weaken(Node* node, Type current_type, Type previous_type);
 
   Zone* zone() { return typer_->zone(); }
@@ -819,18 +843,15 @@ Type Typer::Visitor::TypeInductionVariablePhi(Node* node) {
     // Increasing sequence.
     min = initial_type.Min();
     for (auto bound : induction_var->upper_bounds()) {
-      Type bound_type = TypeOrNone(bound.bound);
-      // If the type is not an integer, just skip the bound.
-      if (!bound_type.Is(typer_->cache_->kInteger)) continue;
+      Type bound_type = OrderedBoundType(bound.bound);
+      // If the type is not a number, just skip the bound.
+      if (!bound_type.Is(Type::Number())) continue;
       // If the type is not inhabited, then we can take the initial value.
       if (bound_type.IsNone()) {
         max = initial_type.Max();
         break;
       }
-      double bound_max = bound_type.Max();
-      if (bound.kind == InductionVariable::kStrict) {
-        bound_max -= 1;
-      }
+      double bound_max = IntegerUpperBound(bound_type, bound.kind);
       max = std::min(max, bound_max + increment_max);
     }
     // The upper bound must be at least the initial value's upper bound.
@@ -839,18 +860,15 @@ Type Typer::Visitor::TypeInductionVariablePhi(Node* node) {
     // Decreasing sequence.
     max = initial_type.Max();
     for (auto bound : induction_var->lower_bounds()) {
-      Type bound_type = TypeOrNone(bound.bound);
-      // If the type is not an integer, just skip the bound.
-      if (!bound_type.Is(typer_->cache_->kInteger)) continue;
+      Type bound_type = OrderedBoundType(bound.bound);
+      // If the type is not a number, just skip the bound.
+      if (!bound_type.Is(Type::Number())) continue;
       // If the type is not inhabited, then we can take the initial value.
       if (bound_type.IsNone()) {
         min = initial_type.Min();
         break;
       }
-      double bound_min = bound_type.Min();
-      if (bound.kind == InductionVariable::kStrict) {
-        bound_min += 1;
-      }
+      double bound_min = IntegerLowerBound(bound_type, bound.kind);
       min = std::max(min, bound_min + increment_min);
     }
     // The lower bound must be at most the initial value's lower bound.
@@ -889,23 +907,22 @@ bool Typer::Visitor::InductionVariablePhiTypeIsPrefixedPoint(
 
   // Intersect {type} with useful bounds.
   for (auto bound : induction_var->upper_bounds()) {
-    Type bound_type = TypeOrNone(bound.bound);
-    if (!bound_type.Is(typer_->cache_->kInteger)) continue;
+    Type bound_type = OrderedBoundType(bound.bound);
+    if (!bound_type.Is(Type::Number())) continue;
     if (!bound_type.IsNone()) {
-      bound_type = Type::Range(
-          -V8_INFINITY,
-          bound_type.Max() - (bound.kind == InductionVariable::kStrict),
-          zone());
+      bound_type =
+          Type::Range(-V8_INFINITY, IntegerUpperBound(bound_type, bound.kind),
+                      zone());
     }
     type = Type::Intersect(type, bound_type, typer_->zone());
   }
   for (auto bound : induction_var->lower_bounds()) {
-    Type bound_type = TypeOrNone(bound.bound);
-    if (!bound_type.Is(typer_->cache_->kInteger)) continue;
+    Type bound_type = OrderedBoundType(bound.bound);
+    if (!bound_type.Is(Type::Number())) continue;
     if (!bound_type.IsNone()) {
-      bound_type = Type::Range(
-          bound_type.Min() + (bound.kind == InductionVariable::kStrict),
-          +V8_INFINITY, typer_->zone());
+      bound_type =
+          Type::Range(IntegerLowerBound(bound_type, bound.kind), +V8_INFINITY,
+                      typer_->zone());
     }
     type = Type::Intersect(type, bound_type, typer_->zone());
   }
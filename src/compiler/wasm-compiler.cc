@@ -3674,6 +3674,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
                                        wasm::WasmCodePosition position,
                                        EnforceBoundsCheck enforce_check) {
   DCHECK_LE(1, access_size);
+  Node* const wasm_index = index;
   index = Uint32ToUintptr(index);
   if (!FLAG_wasm_bounds_checks) return index;
 
@@ -3703,6 +3704,21 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   //    - checking that {index < effective_size}.
 
   Node* mem_size = instance_cache_->mem_size;
+  // If the check emitted last for this {index} immediately precedes this
+  // access on the control chain and covered at least {end_offset}, then
+  // {index + end_offset < mem_size} is already known to hold.
+  if (FLAG_wasm_bounds_check_elimination &&
+      last_bounds_check_.control == control() &&
+      last_bounds_check_.index == wasm_index &&
+      last_bounds_check_.mem_size == mem_size &&
+      end_offset <= last_bounds_check_.end_offset) {
+    ++num_eliminated_bounds_checks_;
+    if (untrusted_code_mitigations_) {
+      index = gasm_->WordAnd(index, instance_cache_->mem_mask);
+    }
+    return index;
+  }
+
   if (end_offset >= env_->min_memory_size) {
     // The end offset is larger than the smallest memory.
     // Dynamically check the end offset against the dynamic memory size.
@@ -3727,7 +3743,8 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
 
   // Introduce the actual bounds check.
   Node* cond = gasm_->UintLessThan(index, effective_size);
-  TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  Node* trap = TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  last_bounds_check_ = {trap, wasm_index, mem_size, end_offset};
 
   if (untrusted_code_mitigations_) {
     // In the fallthrough case, condition the index with the memory mask.
@@ -6102,6 +6119,27 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
   }
 
   Node* BuildChangeTaggedToFloat64(Node* value, Node* context) {
+    // As for int32, most values at runtime are Smis or HeapNumbers, so handle
+    // those inline and only call the builtin for everything else.
+    auto heap_number = gasm_->MakeLabel();
+    auto builtin = gasm_->MakeDeferredLabel();
+    auto done = gasm_->MakeLabel(MachineRepresentation::kFloat64);
+
+    gasm_->GotoIfNot(IsSmi(value), &heap_number);
+    gasm_->Goto(&done, SmiToFloat64(value));
+
+    gasm_->Bind(&heap_number);
+    Node* map =
+        gasm_->Load(MachineType::TaggedPointer(), value,
+                    wasm::ObjectAccess::ToTagged(HeapObject::kMapOffset));
+    Node* heap_number_map = LOAD_FULL_POINTER(
+        BuildLoadIsolateRoot(),
+        IsolateData::root_slot_offset(RootIndex::kHeapNumberMap));
+    gasm_->GotoIfNot(gasm_->WordEqual(heap_number_map, map), &builtin);
+    gasm_->Goto(&done, HeapNumberToFloat64(value));
+
+    // Otherwise, call builtin which changes the value to Float64.
+    gasm_->Bind(&builtin);
     CommonOperatorBuilder* common = mcgraph()->common();
     Node* target = GetTargetForBuiltinCall(wasm::WasmCode::kWasmTaggedToFloat64,
                                            Builtins::kWasmTaggedToFloat64);
@@ -6114,7 +6152,10 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     Node* call =
         gasm_->Call(tagged_to_float64_operator_.get(), target, value, context);
     SetSourcePosition(call, 1);
-    return call;
+    gasm_->Goto(&done, call);
+
+    gasm_->Bind(&done);
+    return done.PhiAt(0);
   }
 
   int AddArgumentNodes(Vector<Node*> args, int pos, int param_count,
@@ -7731,7 +7772,8 @@ bool BuildGraphForWasmFunction(AccountingAllocator* allocator,
                                int func_index, wasm::WasmFeatures* detected,
                                MachineGraph* mcgraph,
                                NodeOriginTable* node_origins,
-                               SourcePositionTable* source_positions) {
+                               SourcePositionTable* source_positions,
+                               Counters* counters) {
   // Create a TF graph during decoding.
   WasmGraphBuilder builder(env, mcgraph->zone(), mcgraph, func_body.sig,
                            source_positions);
@@ -7747,6 +7789,11 @@ bool BuildGraphForWasmFunction(AccountingAllocator* allocator,
     return false;
   }
 
+  if (counters && builder.num_eliminated_bounds_checks() > 0) {
+    counters->wasm_eliminated_bounds_checks()->Increment(
+        builder.num_eliminated_bounds_checks());
+  }
+
   // Lower SIMD first, i64x2 nodes will be lowered to int64 nodes, then int64
   // lowering will take care of them.
   auto sig = CreateMachineSignature(mcgraph->zone(), func_body.sig,
@@ -7846,7 +7893,7 @@ wasm::WasmCompilationResult ExecuteTurbofanWasmCompilation(
       mcgraph->zone()->New<SourcePositionTable>(mcgraph->graph());
   if (!BuildGraphForWasmFunction(wasm_engine->allocator(), env, func_body,
                                  func_index, detected, mcgraph, node_origins,
-                                 source_positions)) {
+                                 source_positions, counters)) {
     return wasm::WasmCompilationResult{};
   }
 
@@ -443,6 +443,10 @@ class WasmGraphBuilder {
 
   bool has_simd() const { return has_simd_; }
 
+  int num_eliminated_bounds_checks() const {
+    return num_eliminated_bounds_checks_;
+  }
+
   wasm::UseTrapHandler use_trap_handler() const {
     return env_ ? env_->use_trap_handler : wasm::kNoTrapHandler;
   }
@@ -659,6 +663,19 @@ class WasmGraphBuilder {
   SetOncePointer<Node> isolate_root_node_;
   SetOncePointer<const Operator> stack_check_call_operator_;
 
+  // The most recently emitted memory bounds check. A later access through the
+  // same (32-bit) {index} with no intervening control flow (so that {control} is still
+  // the check's trap node) and the same {mem_size} is already covered if its
+  // end offset does not exceed {end_offset}.
+  struct BoundsCheckCacheEntry {
+    Node* control = nullptr;
+    Node* index = nullptr;
+    Node* mem_size = nullptr;
+    uintptr_t end_offset = 0;
+  };
+  BoundsCheckCacheEntry last_bounds_check_;
+  int num_eliminated_bounds_checks_ = 0;
+
   bool has_simd_ = false;
   bool needs_stack_check_ = false;
   const bool untrusted_code_mitigations_ = true;
@@ -0,0 +1,130 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/debug/debug-inline-cache-stats.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "src/execution/isolate.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Slots that only record type hints or literal boilerplates don't belong to
+// inline caches.
+bool IsInlineCacheKind(FeedbackSlotKind kind) {
+  switch (kind) {
+    case FeedbackSlotKind::kBinaryOp:
+    case FeedbackSlotKind::kCompareOp:
+    case FeedbackSlotKind::kForIn:
+    case FeedbackSlotKind::kLiteral:
+    case FeedbackSlotKind::kTypeProfile:
+      return false;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<InlineCacheStats> InlineCacheStats::Collect(
+    Isolate* isolate, size_t max_megamorphic_sites) {
+  std::unique_ptr<InlineCacheStats> result(new InlineCacheStats());
+
+  std::vector<Handle<FeedbackVector>> vectors;
+  {
+    HeapObjectIterator heap_iterator(isolate->heap());
+    for (HeapObject current_obj = heap_iterator.Next(); !current_obj.is_null();
+         current_obj = heap_iterator.Next()) {
+      if (!current_obj.IsFeedbackVector()) continue;
+      FeedbackVector vector = FeedbackVector::cast(current_obj);
+      // Only report user JavaScript.
+      if (!vector.shared_function_info().IsSubjectToDebugging()) continue;
+      vectors.emplace_back(vector, isolate);
+    }
+  }
+
+  // Nothing below allocates, so addresses identify scripts and functions.
+  DisallowHeapAllocation no_gc;
+  std::unordered_map<Address, size_t> script_indices;
+  std::unordered_map<Address, size_t> function_indices;
+  for (Handle<FeedbackVector> vector : vectors) {
+    SharedFunctionInfo info = vector->shared_function_info();
+    Script script = Script::cast(info.script());
+
+    auto script_it = script_indices.find(script.ptr());
+    if (script_it == script_indices.end()) {
+      script_it =
+          script_indices.emplace(script.ptr(), result->scripts.size()).first;
+      result->scripts.emplace_back(handle(script, isolate));
+    }
+    size_t script_index = script_it->second;
+    std::vector<InlineCacheStatsFunction>* functions =
+        &result->scripts[script_index].functions;
+
+    auto function_it = function_indices.find(info.ptr());
+    if (function_it == function_indices.end()) {
+      function_it =
+          function_indices.emplace(info.ptr(), functions->size()).first;
+      functions->emplace_back(handle(info, isolate));
+    }
+    size_t function_index = function_it->second;
+    InlineCacheStatsFunction* function = &functions->at(function_index);
+    function->invocation_count += vector->invocation_count();
+
+    FeedbackMetadataIterator iter(vector->metadata());
+    while (iter.HasNext()) {
+      FeedbackSlot slot = iter.Next();
+      FeedbackSlotKind kind = iter.kind();
+      if (!IsInlineCacheKind(kind)) continue;
+      FeedbackNexus nexus(vector, slot);
+      switch (nexus.ic_state()) {
+        case NO_FEEDBACK:
+        case UNINITIALIZED:
+          function->counts.uninitialized++;
+          break;
+        case MONOMORPHIC:
+        case RECOMPUTE_HANDLER:
+          function->counts.monomorphic++;
+          break;
+        case POLYMORPHIC:
+          function->counts.polymorphic++;
+          break;
+        case MEGAMORPHIC:
+        case GENERIC:
+          function->counts.megamorphic++;
+          result->megamorphic_sites.emplace_back(script_index, function_index,
+                                                 vector->invocation_count(),
+                                                 slot, kind);
+          break;
+      }
+    }
+  }
+
+  // Keep the sites in the most frequently invoked functions.
+  std::vector<InlineCacheStatsSite>* sites = &result->megamorphic_sites;
+  auto by_invocation_count = [](const InlineCacheStatsSite& a,
+                                const InlineCacheStatsSite& b) {
+    return a.invocation_count > b.invocation_count;
+  };
+  if (sites->size() > max_megamorphic_sites) {
+    std::partial_sort(sites->begin(), sites->begin() + max_megamorphic_sites,
+                      sites->end(), by_invocation_count);
+    sites->erase(sites->begin() + max_megamorphic_sites, sites->end());
+  } else {
+    std::sort(sites->begin(), sites->end(), by_invocation_count);
+  }
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
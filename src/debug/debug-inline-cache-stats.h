@@ -0,0 +1,67 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEBUG_DEBUG_INLINE_CACHE_STATS_H_
+#define V8_DEBUG_DEBUG_INLINE_CACHE_STATS_H_
+
+#include <memory>
+#include <vector>
+
+#include "src/debug/debug-interface.h"
+#include "src/handles/handles.h"
+#include "src/objects/feedback-vector.h"
+#include "src/objects/objects.h"
+
+namespace v8 {
+namespace internal {
+
+// Forward declaration.
+class Isolate;
+
+struct InlineCacheStatsFunction {
+  explicit InlineCacheStatsFunction(Handle<SharedFunctionInfo> i)
+      : info(i), invocation_count(0) {}
+  Handle<SharedFunctionInfo> info;
+  int invocation_count;
+  debug::InlineCacheStats::Counts counts;
+};
+
+struct InlineCacheStatsScript {
+  explicit InlineCacheStatsScript(Handle<Script> s) : script(s) {}
+  Handle<Script> script;
+  std::vector<InlineCacheStatsFunction> functions;
+};
+
+struct InlineCacheStatsSite {
+  InlineCacheStatsSite(size_t script, size_t function, int invocations,
+                       FeedbackSlot s, FeedbackSlotKind k)
+      : script_index(script),
+        function_index(function),
+        invocation_count(invocations),
+        slot(s),
+        kind(k) {}
+  size_t script_index;
+  size_t function_index;
+  // Of the feedback vector the site was found in.
+  int invocation_count;
+  FeedbackSlot slot;
+  FeedbackSlotKind kind;
+};
+
+class InlineCacheStats {
+ public:
+  static std::unique_ptr<InlineCacheStats> Collect(
+      Isolate* isolate, size_t max_megamorphic_sites);
+
+  std::vector<InlineCacheStatsScript> scripts;
+  std::vector<InlineCacheStatsSite> megamorphic_sites;
+
+ private:
+  InlineCacheStats() = default;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEBUG_DEBUG_INLINE_CACHE_STATS_H_
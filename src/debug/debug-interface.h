@@ -21,10 +21,14 @@ namespace internal {
 struct CoverageBlock;
 struct CoverageFunction;
 struct CoverageScript;
+struct InlineCacheStatsFunction;
+struct InlineCacheStatsScript;
+struct InlineCacheStatsSite;
 struct TypeProfileEntry;
 struct TypeProfileScript;
 class Coverage;
 class DisableBreak;
+class InlineCacheStats;
 class PostponeInterruptsScope;
 class Script;
 class TypeProfile;
@@ -414,6 +418,104 @@ class V8_EXPORT_PRIVATE TypeProfile {
   std::shared_ptr<i::TypeProfile> type_profile_;
 };
 
+/*
+ * Provide API layer for querying the state of inline caches. Collecting walks
+ * the heap for feedback vectors; nothing is recorded while code runs.
+ */
+class V8_EXPORT_PRIVATE InlineCacheStats {
+ public:
+  MOVE_ONLY_NO_DEFAULT_CONSTRUCTOR(InlineCacheStats);
+
+  // Number of inline cache sites per state. Sites waiting for their handler
+  // to be recomputed count as monomorphic, generic ones as megamorphic.
+  struct Counts {
+    size_t uninitialized = 0;
+    size_t monomorphic = 0;
+    size_t polymorphic = 0;
+    size_t megamorphic = 0;
+  };
+
+  class V8_EXPORT_PRIVATE FunctionData {
+   public:
+    MOVE_ONLY_NO_DEFAULT_CONSTRUCTOR(FunctionData);
+
+    int StartOffset() const;
+    int EndOffset() const;
+    MaybeLocal<String> Name() const;
+    // Summed over all feedback vectors of the function.
+    int InvocationCount() const;
+    const Counts& GetCounts() const;
+
+   private:
+    explicit FunctionData(const i::InlineCacheStatsFunction* function,
+                          std::shared_ptr<i::InlineCacheStats> stats)
+        : function_(function), stats_(std::move(stats)) {}
+
+    const i::InlineCacheStatsFunction* function_;
+    std::shared_ptr<i::InlineCacheStats> stats_;
+
+    friend class v8::debug::InlineCacheStats;
+  };
+
+  class V8_EXPORT_PRIVATE ScriptData {
+   public:
+    MOVE_ONLY_NO_DEFAULT_CONSTRUCTOR(ScriptData);
+
+    Local<debug::Script> GetScript() const;
+    size_t FunctionCount() const;
+    FunctionData GetFunctionData(size_t i) const;
+
+   private:
+    explicit ScriptData(size_t index,
+                        std::shared_ptr<i::InlineCacheStats> stats);
+
+    i::InlineCacheStatsScript* script_;
+    std::shared_ptr<i::InlineCacheStats> stats_;
+
+    friend class v8::debug::InlineCacheStats;
+  };
+
+  // A megamorphic inline cache site.
+  class V8_EXPORT_PRIVATE Site {
+   public:
+    MOVE_ONLY_NO_DEFAULT_CONSTRUCTOR(Site);
+
+    Local<debug::Script> GetScript() const;
+    FunctionData GetFunctionData() const;
+    int SlotIndex() const;
+    // The kind of the feedback slot, e.g. "LoadProperty" or "Call".
+    const char* Kind() const;
+
+   private:
+    explicit Site(const i::InlineCacheStatsSite* site,
+                  std::shared_ptr<i::InlineCacheStats> stats)
+        : site_(site), stats_(std::move(stats)) {}
+
+    const i::InlineCacheStatsSite* site_;
+    std::shared_ptr<i::InlineCacheStats> stats_;
+
+    friend class v8::debug::InlineCacheStats;
+  };
+
+  // Returns the states of the inline caches of all user JavaScript functions
+  // that have feedback, grouped by script. Also returns up to
+  // |max_megamorphic_sites| megamorphic sites, those in the most frequently
+  // invoked functions first.
+  static InlineCacheStats Collect(Isolate* isolate,
+                                  size_t max_megamorphic_sites);
+
+  size_t ScriptCount() const;
+  ScriptData GetScriptData(size_t i) const;
+  size_t MegamorphicSiteCount() const;
+  Site GetMegamorphicSite(size_t i) const;
+
+ private:
+  explicit InlineCacheStats(std::shared_ptr<i::InlineCacheStats> stats)
+      : stats_(std::move(stats)) {}
+
+  std::shared_ptr<i::InlineCacheStats> stats_;
+};
+
 class V8_EXPORT_PRIVATE ScopeIterator {
  public:
   static std::unique_ptr<ScopeIterator> CreateForFunction(
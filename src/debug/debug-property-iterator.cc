@@ -88,8 +88,12 @@ Handle<Name> DebugPropertyIterator::raw_name() const {
   if (stage_ == kExoticIndices) {
     return isolate_->factory()->SizeToString(current_key_index_);
   } else {
-    return Handle<Name>::cast(FixedArray::get(
-        *keys_, static_cast<int>(current_key_index_), isolate_));
+    // Element indices are kept as numbers, see
+    // FillKeysForCurrentPrototypeAndStage.
+    Handle<Object> key = FixedArray::get(
+        *keys_, static_cast<int>(current_key_index_), isolate_);
+    if (key->IsNumber()) return isolate_->factory()->NumberToString(key);
+    return Handle<Name>::cast(key);
   }
 }
 
@@ -134,8 +138,10 @@ bool DebugPropertyIterator::is_own() { return is_own_; }
 
 bool DebugPropertyIterator::is_array_index() {
   if (stage_ == kExoticIndices) return true;
+  Object key = keys_->get(static_cast<int>(current_key_index_));
+  if (key.IsNumber()) return true;
   uint32_t index = 0;
-  return raw_name()->AsArrayIndex(&index);
+  return Name::cast(key).AsArrayIndex(&index);
 }
 
 void DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
@@ -155,8 +161,11 @@ void DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
   bool skip_indices = has_exotic_indices;
   PropertyFilter filter =
       stage_ == kEnumerableStrings ? ENUMERABLE_STRINGS : ALL_PROPERTIES;
+  // Converting every element index up front makes iterating a large array
+  // allocate a string per element, even though callers like the inspector's
+  // object previews stop after a handful of properties.
   if (!KeyAccumulator::GetKeys(receiver, KeyCollectionMode::kOwnOnly, filter,
-                               GetKeysConversion::kConvertToString, false,
+                               GetKeysConversion::kKeepNumbers, false,
                                skip_indices)
            .ToHandle(&keys_)) {
     keys_ = Handle<FixedArray>::null();
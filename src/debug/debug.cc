@@ -1219,8 +1219,8 @@ void Debug::ClearOneShot() {
 
 void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   // Deoptimize all code compiled from this shared function info including
-  // inlining.
-  isolate_->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  // inlining. Concurrent jobs are left running; code that inlines a function
+  // with break info is discarded when the job is finalized.
 
   bool found_something = false;
   Code::OptimizedCodeIterator iterator(isolate_);
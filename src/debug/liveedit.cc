@@ -1116,6 +1116,9 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
     return;
   }
 
+  // Jobs in flight may have been compiled from the old source.
+  isolate->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+
   std::map<int, int> start_position_to_unchanged_id;
   for (const auto& mapping : unchanged) {
     FunctionData* data = nullptr;
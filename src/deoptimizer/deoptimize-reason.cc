@@ -33,5 +33,21 @@ char const* DeoptimizeReasonToString(DeoptimizeReason reason) {
   return kDeoptimizeReasonStrings[index];
 }
 
+bool IsInsufficientTypeFeedbackReason(DeoptimizeReason reason) {
+  switch (reason) {
+    case DeoptimizeReason::kInsufficientTypeFeedbackForCall:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForConstruct:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForForIn:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForBinaryOperation:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForCompareOperation:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForGenericNamedAccess:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForGenericKeyedAccess:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForUnaryOperation:
+      return true;
+    default:
+      return false;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
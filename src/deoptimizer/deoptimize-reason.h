@@ -75,12 +75,22 @@ enum class DeoptimizeReason : uint8_t {
 #undef DEOPTIMIZE_REASON
 };
 
+constexpr int kDeoptimizeReasonCount = 0
+#define DEOPTIMIZE_REASON(Name, message) +1
+    DEOPTIMIZE_REASON_LIST(DEOPTIMIZE_REASON)
+#undef DEOPTIMIZE_REASON
+    ;
+
 V8_EXPORT_PRIVATE std::ostream& operator<<(std::ostream&, DeoptimizeReason);
 
 size_t hash_value(DeoptimizeReason reason);
 
 V8_EXPORT_PRIVATE char const* DeoptimizeReasonToString(DeoptimizeReason reason);
 
+// Whether {reason} is a soft deopt on feedback that was still uninitialized
+// when the code was compiled.
+bool IsInsufficientTypeFeedbackReason(DeoptimizeReason reason);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "src/ast/prettyprinter.h"
+#include "src/base/functional.h"
 #include "src/builtins/accessors.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
@@ -412,6 +413,35 @@ void Deoptimizer::DeoptimizeMarkedCode(Isolate* isolate) {
   }
 }
 
+void Deoptimizer::DeoptimizeCodeWithoutSourcePositions(Isolate* isolate) {
+  RuntimeCallTimerScope runtimeTimer(isolate,
+                                     RuntimeCallCounterId::kDeoptimizeCode);
+  TimerEventScope<TimerEventDeoptimizeCode> timer(isolate);
+  TRACE_EVENT0("v8", "V8.DeoptimizeCode");
+  // Jobs that are still running were started without source positions too.
+  isolate->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  DisallowHeapAllocation no_allocation;
+  Object context = isolate->heap()->native_contexts_list();
+  while (!context.IsUndefined(isolate)) {
+    NativeContext native_context = NativeContext::cast(context);
+    bool marked = false;
+    Object element = native_context.OptimizedCodeListHead();
+    while (!element.IsUndefined(isolate)) {
+      Code code = Code::cast(element);
+      if (code.SourcePositionTable().length() == 0) {
+        code.set_marked_for_deoptimization(true);
+        marked = true;
+      }
+      element = code.next_code_link();
+    }
+    if (marked) {
+      OSROptimizedCodeCache::Clear(native_context);
+      DeoptimizeMarkedCodeForContext(native_context);
+    }
+    context = native_context.next_context_link();
+  }
+}
+
 void Deoptimizer::MarkAllCodeForContext(NativeContext native_context) {
   Object element = native_context.OptimizedCodeListHead();
   Isolate* isolate = native_context.GetIsolate();
@@ -594,6 +624,14 @@ bool Deoptimizer::should_reuse_code() const {
          count < FLAG_reuse_opt_code_count;
 }
 
+DeoptimizeReason Deoptimizer::deopt_reason() const {
+  DeoptimizationData deopt_data =
+      DeoptimizationData::cast(compiled_code_.deoptimization_data());
+  if (deopt_data.length() == 0) return DeoptimizeReason::kUnknown;
+  return static_cast<DeoptimizeReason>(
+      deopt_data.DeoptReasonRaw(bailout_id_).value());
+}
+
 Deoptimizer::~Deoptimizer() {
   DCHECK(input_ == nullptr && output_ == nullptr);
   DCHECK_NULL(disallow_garbage_collection_);
@@ -2065,12 +2103,43 @@ void TranslationBuffer::Add(int32_t value) {
   } while (bits != 0);
 }
 
+int TranslationBuffer::Deduplicate(int start) {
+  const int length = CurrentIndex() - start;
+  DCHECK_LT(0, length);
+  size_t hash = 0;
+  for (auto it = contents_.Find(start); it != contents_.end(); ++it) {
+    hash = base::hash_combine(hash, *it);
+  }
+  auto result = ranges_.insert({hash, {start, length}});
+  if (result.second) return start;
+
+  const int existing_start = result.first->second.first;
+  if (result.first->second.second != length) return start;
+  auto existing = contents_.Find(existing_start);
+  for (auto it = contents_.Find(start); it != contents_.end(); ++it) {
+    if (*it != *existing) return start;
+    ++existing;
+  }
+  contents_.Rewind(start);
+  deduplicated_size_ += length;
+  return existing_start;
+}
+
 TranslationIterator::TranslationIterator(ByteArray buffer, int index)
     : buffer_(buffer), index_(index) {
   DCHECK(index >= 0 && index < buffer.length());
 }
 
 int32_t TranslationIterator::Next() {
+  DCHECK(HasNext());
+  // Most operands (opcodes, small indices and register codes) fit into a
+  // single byte, so decode those without entering the loop below.
+  uint8_t first = buffer_.get(index_);
+  if ((first & 1) == 0) {
+    index_++;
+    int32_t result = first >> 2;
+    return (first & 2) ? -result : result;
+  }
   // Run through the bytes until we reach one with a least significant
   // bit of zero (marks the end).
   uint32_t bits = 0;
@@ -2088,6 +2157,15 @@ int32_t TranslationIterator::Next() {
 
 bool TranslationIterator::HasNext() const { return index_ < buffer_.length(); }
 
+void TranslationIterator::Skip(int n) {
+  // Skipped operands don't need to be decoded; every operand ends with the
+  // first byte whose least significant bit is zero.
+  while (n > 0) {
+    DCHECK(HasNext());
+    if ((buffer_.get(index_++) & 1) == 0) n--;
+  }
+}
+
 Handle<ByteArray> TranslationBuffer::CreateByteArray(Factory* factory) {
   Handle<ByteArray> result =
       factory->NewByteArray(CurrentIndex(), AllocationType::kOld);
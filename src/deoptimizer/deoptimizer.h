@@ -25,6 +25,7 @@
 #include "src/utils/allocation.h"
 #include "src/utils/boxed-float.h"
 #include "src/zone/zone-chunk-list.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -462,6 +463,9 @@ class Deoptimizer : public Malloced {
 
   bool should_reuse_code() const;
 
+  // The reason recorded for the deoptimization exit that was taken.
+  DeoptimizeReason deopt_reason() const;
+
   static Deoptimizer* New(Address raw_function, DeoptimizeKind kind,
                           unsigned bailout_id, Address from, int fp_to_sp_delta,
                           Isolate* isolate);
@@ -487,6 +491,11 @@ class Deoptimizer : public Malloced {
   // refer to that code.
   static void DeoptimizeMarkedCode(Isolate* isolate);
 
+  // Deoptimize all optimized code that was compiled without source positions
+  // because of --lazy-optimized-source-positions, so that it gets reoptimized
+  // with them.
+  static void DeoptimizeCodeWithoutSourcePositions(Isolate* isolate);
+
   // Check the given address against a list of allowed addresses, to prevent a
   // potential attacker from using the frame creation process in the
   // deoptimizer, in particular the signing process, to gain control over the
@@ -824,15 +833,27 @@ class FrameDescription {
 
 class TranslationBuffer {
  public:
-  explicit TranslationBuffer(Zone* zone) : contents_(zone) {}
+  explicit TranslationBuffer(Zone* zone) : contents_(zone), ranges_(zone) {}
 
   int CurrentIndex() const { return static_cast<int>(contents_.size()); }
   void Add(int32_t value);
 
+  // If the contents added since |start| are identical to those of a range
+  // passed to this method before, removes them again and returns the start of
+  // that range, so that both translations share it. Otherwise returns |start|.
+  int Deduplicate(int start);
+
+  // The number of bytes removed by Deduplicate.
+  int deduplicated_size() const { return deduplicated_size_; }
+
   Handle<ByteArray> CreateByteArray(Factory* factory);
 
  private:
   ZoneChunkList<uint8_t> contents_;
+  // The start and length of the ranges passed to Deduplicate, by the hash of
+  // their contents. Ranges colliding with an earlier one are not recorded.
+  ZoneUnorderedMap<size_t, std::pair<int, int>> ranges_;
+  int deduplicated_size_ = 0;
 };
 
 class TranslationIterator {
@@ -843,9 +864,7 @@ class TranslationIterator {
 
   bool HasNext() const;
 
-  void Skip(int n) {
-    for (int i = 0; i < n; i++) Next();
-  }
+  void Skip(int n);
 
  private:
   ByteArray buffer_;
@@ -18,7 +18,7 @@ namespace internal {
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(BasicBlockProfiler, BasicBlockProfiler::Get)
 
 BasicBlockProfilerData::BasicBlockProfilerData(size_t n_blocks)
-    : block_ids_(n_blocks), counts_(n_blocks, 0) {}
+    : block_ids_(n_blocks), counts_(n_blocks, 0), hash_(0) {}
 
 void BasicBlockProfilerData::SetCode(const std::ostringstream& os) {
   code_ = os.str();
@@ -180,6 +180,23 @@ std::vector<bool> BasicBlockProfiler::GetCoverageBitmap(Isolate* isolate) {
   return out;
 }
 
+bool BasicBlockProfiler::CollectCounts(const std::string& function_name,
+                                       int hash,
+                                       std::vector<uint32_t>* counts_by_id) {
+  base::MutexGuard lock(&data_list_mutex_);
+  bool found = false;
+  for (const std::unique_ptr<BasicBlockProfilerData>& data : data_list_) {
+    if (data->hash_ != hash || data->function_name_ != function_name) continue;
+    found = true;
+    for (size_t i = 0; i < data->n_blocks(); ++i) {
+      size_t id = static_cast<size_t>(data->block_ids_[i]);
+      if (counts_by_id->size() <= id) counts_by_id->resize(id + 1);
+      (*counts_by_id)[id] += data->counts_[i];
+    }
+  }
+  return found;
+}
+
 void BasicBlockProfilerData::Log(Isolate* isolate) {
   bool any_nonzero_counter = false;
   for (size_t i = 0; i < n_blocks(); ++i) {
@@ -83,6 +83,12 @@ class BasicBlockProfiler {
   // snapshot.
   V8_EXPORT_PRIVATE std::vector<bool> GetCoverageBitmap(Isolate* isolate);
 
+  // Sums up the counters of all off-heap data for the given function and
+  // graph hash, indexed by block ID. Returns false if there is no such data.
+  V8_EXPORT_PRIVATE bool CollectCounts(const std::string& function_name,
+                                       int hash,
+                                       std::vector<uint32_t>* counts_by_id);
+
   const DataList* data_list() { return &data_list_; }
 
  private:
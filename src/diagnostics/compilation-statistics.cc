@@ -45,6 +45,12 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.Accumulate(stats);
 }
 
+void CompilationStatistics::RecordCounter(const char* counter_name,
+                                          size_t value) {
+  base::MutexGuard guard(&record_mutex_);
+  counter_map_[std::string(counter_name)] += value;
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -147,6 +153,24 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  if (!s.counter_map_.empty()) {
+    if (!ps.machine_output) {
+      os << std::endl;
+      WriteFullLine(os);
+    }
+    for (const auto& counter : s.counter_map_) {
+      if (ps.machine_output) {
+        os << std::endl
+           << "\"" << counter.first << "\"=" << counter.second;
+      } else {
+        char buffer[128];
+        base::OS::SNPrintF(buffer, sizeof(buffer), "%34s %10zu",
+                           counter.first.c_str(), counter.second);
+        os << buffer << std::endl;
+      }
+    }
+  }
+
   return os;
 }
 
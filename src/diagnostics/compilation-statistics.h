@@ -50,6 +50,10 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Accumulates an optimization counter (e.g. the number of eliminated
+  // checks) that is printed after the phase table.
+  void RecordCounter(const char* counter_name, size_t value);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -76,10 +80,12 @@ class CompilationStatistics final : public Malloced {
   using PhaseKindStats = OrderedStats;
   using PhaseKindMap = std::map<std::string, PhaseKindStats>;
   using PhaseMap = std::map<std::string, PhaseStats>;
+  using CounterMap = std::map<std::string, size_t>;
 
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  CounterMap counter_map_;
   base::Mutex record_mutex_;
 
   DISALLOW_COPY_AND_ASSIGN(CompilationStatistics);
@@ -34,6 +34,7 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #include <memory>
+#include <unordered_map>
 
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
@@ -84,6 +85,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -114,6 +125,7 @@ base::LazyRecursiveMutex PerfJitLogger::file_mutex_;
 uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
+std::unordered_map<Address, uint64_t>* PerfJitLogger::code_ids_ = nullptr;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
@@ -141,12 +153,15 @@ void PerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  code_ids_ = new std::unordered_map<Address, uint64_t>();
 }
 
 void PerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
   fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
+  delete code_ids_;
+  code_ids_ = nullptr;
 }
 
 void* PerfJitLogger::OpenMarkerFile(int fd) {
@@ -222,7 +237,7 @@ void PerfJitLogger::LogRecordedBuffer(
 
   // Debug info has to be emitted first.
   Handle<SharedFunctionInfo> shared;
-  if (FLAG_perf_prof && !maybe_shared.ToHandle(&shared)) {
+  if (FLAG_perf_prof && maybe_shared.ToHandle(&shared)) {
     // TODO(herhut): This currently breaks for js2wasm/wasm2js functions.
     if (code->kind() != CodeKind::JS_TO_WASM_FUNCTION &&
         code->kind() != CodeKind::WASM_TO_JS_FUNCTION) {
@@ -236,8 +251,13 @@ void PerfJitLogger::LogRecordedBuffer(
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(*code);
 
-  WriteJitCodeLoadEntry(code_pointer, code->InstructionSize(), code_name,
-                        length);
+  uint64_t code_id = WriteJitCodeLoadEntry(
+      code_pointer, code->InstructionSize(), code_name, length);
+  // Remember the id so that moves of this code can refer to it. Off-heap
+  // instructions never move.
+  if (!code->is_off_heap_trampoline()) {
+    (*code_ids_)[code->InstructionStart()] = code_id;
+  }
 }
 
 void PerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
@@ -250,13 +270,20 @@ void PerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
     LogWriteDebugInfo(code);
   }
 
+  // Wasm code carries no unwinding info, the empty one makes perf fall back
+  // to frame pointers.
+  if (FLAG_perf_prof_unwinding_info) {
+    LogWriteUnwindingInfo(Vector<const byte>());
+  }
+
   WriteJitCodeLoadEntry(code->instructions().begin(),
                         code->instructions().length(), name, length);
 }
 
-void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
-                                          uint32_t code_size, const char* name,
-                                          int name_length) {
+uint64_t PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
+                                              uint32_t code_size,
+                                              const char* name,
+                                              int name_length) {
   static const char string_terminator[] = "\0";
 
   PerfJitCodeLoad code_load;
@@ -277,6 +304,7 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(name, name_length);
   LogWriteBytes(string_terminator, 1);
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
+  return code_load.code_id_;
 }
 
 namespace {
@@ -460,13 +488,23 @@ void PerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
 }
 
 void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
+  if (code.has_unwinding_info()) {
+    LogWriteUnwindingInfo(Vector<const byte>(
+        reinterpret_cast<const byte*>(code.unwinding_info_start()),
+        static_cast<size_t>(code.unwinding_info_size())));
+  } else {
+    LogWriteUnwindingInfo(Vector<const byte>());
+  }
+}
+
+void PerfJitLogger::LogWriteUnwindingInfo(Vector<const byte> unwinding_info) {
   PerfJitCodeUnwindingInfo unwinding_info_header;
   unwinding_info_header.event_ = PerfJitCodeLoad::kUnwindingInfo;
   unwinding_info_header.time_stamp_ = GetTimestamp();
   unwinding_info_header.eh_frame_hdr_size_ = EhFrameConstants::kEhFrameHdrSize;
 
-  if (code.has_unwinding_info()) {
-    unwinding_info_header.unwinding_size_ = code.unwinding_info_size();
+  if (!unwinding_info.empty()) {
+    unwinding_info_header.unwinding_size_ = unwinding_info.size();
     unwinding_info_header.mapped_size_ = unwinding_info_header.unwinding_size_;
   } else {
     unwinding_info_header.unwinding_size_ = EhFrameConstants::kEhFrameHdrSize;
@@ -481,9 +519,9 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
   LogWriteBytes(reinterpret_cast<const char*>(&unwinding_info_header),
                 sizeof(unwinding_info_header));
 
-  if (code.has_unwinding_info()) {
-    LogWriteBytes(reinterpret_cast<const char*>(code.unwinding_info_start()),
-                  code.unwinding_info_size());
+  if (!unwinding_info.empty()) {
+    LogWriteBytes(reinterpret_cast<const char*>(unwinding_info.begin()),
+                  static_cast<int>(unwinding_info.size()));
   } else {
     OFStream perf_output_stream(perf_output_handle_);
     EhFrameWriter::WriteEmptyEhFrame(perf_output_stream);
@@ -495,9 +533,37 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from.IsBytecodeArray());
+  // Bytecode arrays aren't logged, and off-heap instructions don't move.
+  if (!to.IsCode() || Code::cast(to).is_off_heap_trampoline()) return;
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Moves are reported after copying, while the old copy is still intact.
+  Address from_start = from.InstructionStart();
+  Address to_start = to.InstructionStart();
+  auto it = code_ids_->find(from_start);
+  // Code that was never logged, e.g. created before the logger.
+  if (it == code_ids_->end()) return;
+  uint64_t code_id = it->second;
+  code_ids_->erase(it);
+  (*code_ids_)[to_start] = code_id;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeLoad::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = to_start;
+  code_move.old_code_address_ = from_start;
+  code_move.new_code_address_ = to_start;
+  code_move.code_size_ = to.InstructionSize();
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -33,6 +33,8 @@
 // {PerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -69,14 +71,18 @@ class PerfJitLogger : public CodeEventLogger {
   // minimize the associated overhead.
   static const int kLogBufferSize = 2 * MB;
 
-  void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
-                             const char* name, int name_length);
+  // Returns the id of the logged code.
+  uint64_t WriteJitCodeLoadEntry(const uint8_t* code_pointer,
+                                 uint32_t code_size, const char* name,
+                                 int name_length);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
   void LogWriteDebugInfo(Handle<Code> code, Handle<SharedFunctionInfo> shared);
   void LogWriteDebugInfo(const wasm::WasmCode* code);
   void LogWriteUnwindingInfo(Code code);
+  // An empty |unwinding_info| makes perf fall back to frame pointers.
+  void LogWriteUnwindingInfo(Vector<const byte> unwinding_info);
 
   static const uint32_t kElfMachIA32 = 3;
   static const uint32_t kElfMachX64 = 62;
@@ -125,6 +131,9 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  // Ids of the logged on-heap code objects by instruction start, for
+  // reporting code moves.
+  static std::unordered_map<Address, uint64_t>* code_ids_;
 };
 
 }  // namespace internal
@@ -4,7 +4,9 @@
 
 #include "src/execution/futex-emulation.h"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -58,7 +60,7 @@ class FutexWaitList {
     auto node = *head;
     while (node != nullptr) {
       if (node->isolate_for_async_waiters_ == isolate) {
-        node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
+        node->timeout_queue_key_ = base::TimeTicks();
         node = DeleteAsyncWaiterNode(node);
       } else {
         if (new_head == nullptr) {
@@ -72,7 +74,8 @@ class FutexWaitList {
     *tail = new_tail;
   }
 
-  // For checking the internal consistency of the FutexWaitList.
+  // For checking the internal consistency of the FutexWaitList. The caller
+  // must hold all mutexes of the list.
   void Verify();
   // Verifies the local consistency of |node|. If it's the first node of its
   // list, it must be |head|, and if it's the last node, it must be |tail|.
@@ -82,55 +85,136 @@ class FutexWaitList {
   static bool NodeIsOnList(FutexWaitListNode* node, FutexWaitListNode* head);
 
  private:
+  friend class AtomicsWaitWakeHandle;
   friend class FutexEmulation;
+  friend class FutexWaitListNode;
 
   struct HeadAndTail {
     FutexWaitListNode* head;
     FutexWaitListNode* tail;
   };
-  // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+
+  // Wait locations are distributed over a fixed number of shards, each with
+  // its own mutex, so that waiting on and waking unrelated locations does not
+  // contend on a single lock. A shard's `mutex` protects its `location_lists`
+  // (i.e. no nodes may be added to or removed from them without holding it),
+  // as well as the `waiting_` and `interrupted_` fields of the nodes on them.
+  // It is the mutex used together with the `cond_` condition variable of
+  // such nodes.
+  static constexpr size_t kNumShards = 32;
+  struct Shard {
+    base::Mutex mutex;
+    // Location inside a shared buffer -> linked list of Nodes waiting on that
+    // location.
+    std::map<int8_t*, HeadAndTail> location_lists;
+  };
+
+  Shard* ShardFor(const int8_t* wait_location) {
+    // Wait locations are at least 4-byte aligned.
+    uintptr_t key = reinterpret_cast<uintptr_t>(wait_location) >> 2;
+    return &shards_[key % kNumShards];
+  }
+
+  // Checks the consistency of a single shard. The caller must hold its mutex.
+  void VerifyShard(Shard* shard);
+
+  // Locks all shards, in a fixed order to avoid deadlocks. Used for
+  // operations which are not tied to a single location, like interrupting a
+  // waiting thread or tearing down an Isolate's waiters.
+  class AllShardsGuard {
+   public:
+    explicit AllShardsGuard(FutexWaitList* wait_list) : wait_list_(wait_list) {
+      for (Shard& shard : wait_list_->shards_) shard.mutex.Lock();
+    }
+    ~AllShardsGuard() {
+      for (size_t i = kNumShards; i > 0; --i) {
+        wait_list_->shards_[i - 1].mutex.Unlock();
+      }
+    }
+
+   private:
+    FutexWaitList* const wait_list_;
+    DisallowHeapAllocation no_gc_;
+
+    DISALLOW_COPY_AND_ASSIGN(AllShardsGuard);
+  };
+
+  Shard shards_[kNumShards];
+
+  // Protects `isolate_promises_to_resolve_`. Can be locked while holding a
+  // shard mutex, but not the other way round.
+  base::Mutex promises_mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
   std::map<Isolate*, HeadAndTail> isolate_promises_to_resolve_;
 
+  // The async waiters with a timeout of an Isolate, ordered by deadline. A
+  // single delayed AsyncWaiterTimeoutTask per Isolate handles the earliest
+  // deadline and reschedules itself for the next one, so that waiters don't
+  // need a delayed task each.
+  struct TimeoutQueue {
+    std::multimap<base::TimeTicks, FutexWaitListNode*> nodes;
+    // The earliest time a posted AsyncWaiterTimeoutTask will run at, or
+    // base::TimeTicks() if none is pending.
+    base::TimeTicks next_task_time;
+  };
+
+  // Adds |node| to its Isolate's timeout queue and makes sure a task runs at
+  // |deadline|. The caller must hold `promises_mutex_`.
+  void AddToTimeoutQueue(FutexWaitListNode* node, base::TimeTicks deadline);
+  // Posts a task for the earliest deadline in |queue| unless one will run
+  // before it. The caller must hold `promises_mutex_`.
+  void ScheduleTimeoutTask(Isolate* isolate, TimeoutQueue* queue);
+
+  // Isolate* -> its timeout queue. Protected by `promises_mutex_`.
+  std::map<Isolate*, TimeoutQueue> isolate_timeout_queues_;
+
   DISALLOW_COPY_AND_ASSIGN(FutexWaitList);
 };
 
 namespace {
-// `g_mutex` protects the composition of `g_wait_list` (i.e. no elements may be
-// added or removed without holding this mutex), as well as the `waiting_`
-// and `interrupted_` fields for each individual list node that is currently
-// part of the list. It must be the mutex used together with the `cond_`
-// condition variable of such nodes.
-base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
 }  // namespace
 
 FutexWaitListNode::~FutexWaitListNode() {
-  // Assert that the timeout task was cancelled.
-  DCHECK_EQ(CancelableTaskManager::kInvalidTaskId, timeout_task_id_);
+  // Assert that the node was taken off the timeout queue.
+  DCHECK_EQ(base::TimeTicks(), timeout_queue_key_);
+  DCHECK(!timeout_firing_);
 }
 
-bool FutexWaitListNode::CancelTimeoutTask() {
-  if (timeout_task_id_ != CancelableTaskManager::kInvalidTaskId) {
-    auto return_value = cancelable_task_manager_->TryAbort(timeout_task_id_);
-    timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
-    return return_value != TryAbortResult::kTaskRunning;
+bool FutexWaitListNode::RemoveFromTimeoutQueue() {
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  NoHeapAllocationMutexGuard promises_guard(&wait_list->promises_mutex_);
+  if (timeout_firing_) return false;
+  if (timeout_queue_key_ == base::TimeTicks()) return true;
+  auto queue_it =
+      wait_list->isolate_timeout_queues_.find(isolate_for_async_waiters_);
+  DCHECK_NE(wait_list->isolate_timeout_queues_.end(), queue_it);
+  auto& nodes = queue_it->second.nodes;
+  auto range = nodes.equal_range(timeout_queue_key_);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == this) {
+      nodes.erase(it);
+      break;
+    }
   }
+  timeout_queue_key_ = base::TimeTicks();
+  // The pending task, if any, stays; it finds nothing to do if it was only
+  // scheduled for this node.
   return true;
 }
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+  // Lock the FutexWaitList mutexes before notifying. We don't know which
+  // location this node is (or will be) waiting on, so lock all shards. We know
+  // that the shard's mutex will have been unlocked if we are currently waiting
+  // on the condition variable. The mutex will not be locked if
+  // FutexEmulation::Wait hasn't locked it yet. In that case, we set the
+  // interrupted_ flag to true, which will be tested after the mutex locked by
+  // a future wait.
+  FutexWaitList::AllShardsGuard lock_guard(g_wait_list.Pointer());
 
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
@@ -154,32 +238,63 @@ class ResolveAsyncWaiterPromisesTask : public CancelableTask {
 class AsyncWaiterTimeoutTask : public CancelableTask {
  public:
   AsyncWaiterTimeoutTask(CancelableTaskManager* cancelable_task_manager,
-                         FutexWaitListNode* node)
-      : CancelableTask(cancelable_task_manager), node_(node) {}
+                         Isolate* isolate)
+      : CancelableTask(cancelable_task_manager), isolate_(isolate) {}
 
   void RunInternal() override {
-    FutexEmulation::HandleAsyncWaiterTimeout(node_);
+    FutexEmulation::HandleAsyncWaiterTimeouts(isolate_);
   }
 
  private:
-  FutexWaitListNode* node_;
+  Isolate* isolate_;
 };
 
+void FutexWaitList::AddToTimeoutQueue(FutexWaitListNode* node,
+                                      base::TimeTicks deadline) {
+  promises_mutex_.AssertHeld();
+  DCHECK_EQ(base::TimeTicks(), node->timeout_queue_key_);
+  Isolate* isolate = node->isolate_for_async_waiters_;
+  TimeoutQueue* queue = &isolate_timeout_queues_[isolate];
+  queue->nodes.insert(std::make_pair(deadline, node));
+  node->timeout_queue_key_ = deadline;
+  ScheduleTimeoutTask(isolate, queue);
+}
+
+void FutexWaitList::ScheduleTimeoutTask(Isolate* isolate, TimeoutQueue* queue) {
+  promises_mutex_.AssertHeld();
+  if (queue->nodes.empty()) return;
+  base::TimeTicks deadline = queue->nodes.begin()->first;
+  if (queue->next_task_time != base::TimeTicks() &&
+      queue->next_task_time <= deadline) {
+    return;
+  }
+  FutexWaitListNode* node = queue->nodes.begin()->second;
+  auto task = std::make_unique<AsyncWaiterTimeoutTask>(
+      node->cancelable_task_manager_, isolate);
+  base::TimeDelta delay =
+      std::max(deadline - base::TimeTicks::Now(), base::TimeDelta());
+  node->task_runner_->PostNonNestableDelayedTask(std::move(task),
+                                                 delay.InSecondsF());
+  queue->next_task_time = deadline;
+}
+
 void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // This function can run in any thread.
 
-  g_mutex.Pointer()->AssertHeld();
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  wait_list->ShardFor(node->wait_location_)->mutex.AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_timeout_time_ = base::TimeTicks();
 
-  g_wait_list.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  NoHeapAllocationMutexGuard promises_guard(&wait_list->promises_mutex_);
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->isolate_for_async_waiters_);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -199,9 +314,12 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
-  auto it = location_lists_.find(node->wait_location_);
-  if (it == location_lists_.end()) {
-    location_lists_.insert(
+  Shard* shard = ShardFor(node->wait_location_);
+  shard->mutex.AssertHeld();
+  auto& location_lists = shard->location_lists;
+  auto it = location_lists.find(node->wait_location_);
+  if (it == location_lists.end()) {
+    location_lists.insert(
         std::make_pair(node->wait_location_, HeadAndTail{node, node}));
   } else {
     it->second.tail->next_ = node;
@@ -209,12 +327,15 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
     it->second.tail = node;
   }
 
-  Verify();
+  VerifyShard(shard);
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
-  auto it = location_lists_.find(node->wait_location_);
-  DCHECK_NE(location_lists_.end(), it);
+  Shard* shard = ShardFor(node->wait_location_);
+  shard->mutex.AssertHeld();
+  auto& location_lists = shard->location_lists;
+  auto it = location_lists.find(node->wait_location_);
+  DCHECK_NE(location_lists.end(), it);
   DCHECK(NodeIsOnList(node, it->second.head));
 
   if (node->prev_) {
@@ -233,12 +354,12 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 
   // If the node was the last one on its list, delete the whole list.
   if (node->prev_ == nullptr && node->next_ == nullptr) {
-    location_lists_.erase(it);
+    location_lists.erase(it);
   }
 
   node->prev_ = node->next_ = nullptr;
 
-  Verify();
+  VerifyShard(shard);
 }
 
 void AtomicsWaitWakeHandle::Wake() {
@@ -247,7 +368,7 @@ void AtomicsWaitWakeHandle::Wake() {
   // The split lock by itself isn’t an issue, as long as the caller properly
   // synchronizes this with the closing `AtomicsWaitCallback`.
   {
-    NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList::AllShardsGuard lock_guard(g_wait_list.Pointer());
     stopped_ = true;
   }
   isolate_->futex_wait_list_node()->NotifyWake();
@@ -380,16 +501,18 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
   do {  // Not really a loop, just makes it easier to break out early.
-    NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
     DCHECK(backing_store);
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    base::Mutex* mutex = &wait_list->ShardFor(wait_location)->mutex;
+    NoHeapAllocationMutexGuard lock_guard(mutex);
+
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
-    auto wait_location =
-        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->wait_location_ = wait_location;
     node->waiting_ = true;
 
@@ -412,7 +535,7 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
       timeout_time = current_time + rel_timeout;
     }
 
-    g_wait_list.Pointer()->AddNode(node);
+    wait_list->AddNode(node);
 
     while (true) {
       bool interrupted = node->interrupted_;
@@ -473,16 +596,16 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
         bool wait_for_result =
-            node->cond_.WaitFor(g_mutex.Pointer(), time_until_timeout);
+            node->cond_.WaitFor(mutex, time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(g_mutex.Pointer());
+        node->cond_.Wait(mutex);
       }
 
       // Spurious wakeup, interrupt or timeout.
     }
 
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   } while (false);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
@@ -586,16 +709,15 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
       new FutexWaitListNode(backing_store, addr, promise_capability, isolate);
 
   {
-    NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
-    g_wait_list.Pointer()->AddNode(node);
-  }
-  if (use_timeout) {
-    node->async_timeout_time_ = base::TimeTicks::Now() + rel_timeout;
-    auto task = std::make_unique<AsyncWaiterTimeoutTask>(
-        node->cancelable_task_manager_, node);
-    node->timeout_task_id_ = task->id();
-    node->task_runner_->PostNonNestableDelayedTask(std::move(task),
-                                                   rel_timeout.InSecondsF());
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoHeapAllocationMutexGuard lock_guard(
+        &wait_list->ShardFor(node->wait_location_)->mutex);
+    wait_list->AddNode(node);
+    if (use_timeout) {
+      node->async_timeout_time_ = base::TimeTicks::Now() + rel_timeout;
+      NoHeapAllocationMutexGuard promises_guard(&wait_list->promises_mutex_);
+      wait_list->AddToTimeoutQueue(node, node->async_timeout_time_);
+    }
   }
 
   // 26. Perform ! CreateDataPropertyOrThrow(resultObject, "async", true).
@@ -619,9 +741,11 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
 
-  NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  FutexWaitList::Shard* shard = wait_list->ShardFor(wait_location);
+  NoHeapAllocationMutexGuard lock_guard(&shard->mutex);
 
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  auto& location_lists = shard->location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -663,36 +787,30 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
     if (node->async_timeout_time_ == base::TimeTicks()) {
       // Backing store has been deleted and the node is still waiting, and
       // there's no timeout. It's never going to be woken up, so we can clean
-      // it up now. We don't need to cancel the timeout task, because there is
-      // none.
+      // it up now. It isn't on the timeout queue, because it has no timeout.
 
       // This cleanup code is not very efficient, since it only kicks in when
       // a new BackingStore has been created in the same memory area where the
       // deleted BackingStore was.
       DCHECK(node->IsAsync());
-      DCHECK_EQ(CancelableTaskManager::kInvalidTaskId, node->timeout_task_id_);
+      DCHECK_EQ(base::TimeTicks(), node->timeout_queue_key_);
       delete_this_node = true;
     }
     if (node->IsAsync() && node->native_context_.IsEmpty()) {
       // The NativeContext related to the async waiter has been deleted.
       // Ditto, clean up now.
-
-      // Using the CancelableTaskManager here is OK since the Isolate is
-      // guaranteed to be alive - FutexEmulation::IsolateDeinit removes all
-      // FutexWaitListNodes owned by an Isolate which is going to die.
-      if (node->CancelTimeoutTask()) {
+      if (node->RemoveFromTimeoutQueue()) {
         delete_this_node = true;
       }
-      // If cancelling the timeout task failed, the timeout task is already
-      // running and will clean up the node.
+      // Otherwise the timeout handler has already taken the node and will
+      // clean it up.
     }
 
     if (delete_this_node) {
       auto old_node = node;
       node = node->next_;
-      g_wait_list.Pointer()->RemoveNode(old_node);
-      DCHECK_EQ(CancelableTaskManager::kInvalidTaskId,
-                old_node->timeout_task_id_);
+      wait_list->RemoveNode(old_node);
+      DCHECK_EQ(base::TimeTicks(), old_node->timeout_queue_key_);
       delete old_node;
     } else {
       node = node->next_;
@@ -704,7 +822,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding g_mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any of the
+  // FutexWaitList mutexes.
 
   DCHECK(FLAG_harmony_atomics_waitasync);
   DCHECK(node->IsAsync());
@@ -742,14 +861,10 @@ void FutexEmulation::ResolveAsyncWaiterPromise(FutexWaitListNode* node) {
   auto v8_isolate =
       reinterpret_cast<v8::Isolate*>(node->isolate_for_async_waiters_);
 
-  // Try to cancel the timeout task (if one exists). If the timeout task exists,
-  // cancelling it will always succeed. It's not possible for the timeout task
-  // to be running, since it's scheduled to run in the same thread as this task.
-
-  // Using the CancelableTaskManager here is OK since the Isolate is guaranteed
-  // to be alive - FutexEmulation::IsolateDeinit removes all FutexWaitListNodes
-  // owned by an Isolate which is going to die.
-  bool success = node->CancelTimeoutTask();
+  // Take the node off the timeout queue (if it's on it). The timeout handler
+  // runs in the same thread as this function, so it can't be holding the
+  // node.
+  bool success = node->RemoveFromTimeoutQueue();
   DCHECK(success);
   USE(success);
 
@@ -783,9 +898,10 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
 
   FutexWaitListNode* node;
   {
-    NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoHeapAllocationMutexGuard lock_guard(&wait_list->promises_mutex_);
 
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -803,29 +919,73 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
     DCHECK(!node->waiting_);
     ResolveAsyncWaiterPromise(node);
     CleanupAsyncWaiterPromise(node);
-    // We've already tried to cancel the timeout task for the node; since we're
-    // now in the same thread the timeout task is supposed to run, we know the
-    // timeout task will never happen, and it's safe to delete the node here.
-    DCHECK_EQ(CancelableTaskManager::kInvalidTaskId, node->timeout_task_id_);
+    // The node has been taken off the timeout queue, and the timeout handler
+    // runs in this thread too, so it's safe to delete the node here.
+    DCHECK_EQ(base::TimeTicks(), node->timeout_queue_key_);
     node = FutexWaitList::DeleteAsyncWaiterNode(node);
   }
 }
 
+void FutexEmulation::HandleAsyncWaiterTimeouts(Isolate* isolate) {
+  // This function must run in the main thread of isolate.
+  DCHECK(FLAG_harmony_atomics_waitasync);
+
+  std::vector<FutexWaitListNode*> timed_out;
+  {
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoHeapAllocationMutexGuard promises_guard(&wait_list->promises_mutex_);
+    auto queue_it = wait_list->isolate_timeout_queues_.find(isolate);
+    if (queue_it == wait_list->isolate_timeout_queues_.end()) return;
+    FutexWaitList::TimeoutQueue* queue = &queue_it->second;
+
+    // Always schedule a new task for the remaining nodes. This might duplicate
+    // a pending task, but never leaves the queue without one if this task ran
+    // slightly before the deadline it was posted for.
+    queue->next_task_time = base::TimeTicks();
+    base::TimeTicks now = base::TimeTicks::Now();
+    auto& nodes = queue->nodes;
+    while (!nodes.empty() && nodes.begin()->first <= now) {
+      FutexWaitListNode* node = nodes.begin()->second;
+      nodes.erase(nodes.begin());
+      node->timeout_queue_key_ = base::TimeTicks();
+      node->timeout_firing_ = true;
+      timed_out.push_back(node);
+    }
+    if (nodes.empty()) {
+      // Tasks which are still pending find no queue and do nothing.
+      wait_list->isolate_timeout_queues_.erase(queue_it);
+    } else {
+      wait_list->ScheduleTimeoutTask(isolate, queue);
+    }
+  }
+
+  // The nodes are handled without holding the promises mutex, since resolving
+  // their Promises may allocate memory.
+  for (FutexWaitListNode* node : timed_out) {
+    HandleAsyncWaiterTimeout(node);
+  }
+}
+
 void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate.
   DCHECK(FLAG_harmony_atomics_waitasync);
   DCHECK(node->IsAsync());
 
   {
-    NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
-
-    node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoHeapAllocationMutexGuard lock_guard(
+        &wait_list->ShardFor(node->wait_location_)->mutex);
+    {
+      NoHeapAllocationMutexGuard promises_guard(&wait_list->promises_mutex_);
+      DCHECK(node->timeout_firing_);
+      node->timeout_firing_ = false;
+    }
     if (!node->waiting_) {
       // If the Node is not waiting, it's already scheduled to have its Promise
       // resolved. Ignore the timeout.
       return;
     }
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   }
 
   // "node" has been taken out of the lists, so it's ok to access it without
@@ -838,14 +998,17 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  FutexWaitList::AllShardsGuard lock_guard(wait_list);
+  base::MutexGuard promises_guard(&wait_list->promises_mutex_);
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
-  // NativeContext. Also we don't need to cancel the timeout tasks, since they
+  // NativeContext. Also we don't need to cancel the timeout task, since it
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  wait_list->isolate_timeout_queues_.erase(isolate);
+  for (FutexWaitList::Shard& shard : wait_list->shards_) {
+    auto& location_lists = shard.location_lists;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
@@ -862,20 +1025,20 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
   }
 
   {
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       auto node = it->second.head;
       while (node) {
         DCHECK_EQ(isolate, node->isolate_for_async_waiters_);
-        node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
+        node->timeout_queue_key_ = base::TimeTicks();
         node = FutexWaitList::DeleteAsyncWaiterNode(node);
       }
       isolate_map.erase(it);
     }
   }
 
-  g_wait_list.Pointer()->Verify();
+  wait_list->Verify();
 }
 
 Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
@@ -883,10 +1046,11 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
-
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  FutexWaitList::Shard* shard = g_wait_list.Pointer()->ShardFor(wait_location);
+  NoHeapAllocationMutexGuard lock_guard(&shard->mutex);
+
+  auto& location_lists = shard->location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -907,16 +1071,19 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
 }
 
 Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
-  NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  FutexWaitList::AllShardsGuard lock_guard(wait_list);
 
   int waiters = 0;
-  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
-    FutexWaitListNode* node = it.second.head;
-    while (node != nullptr) {
-      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-        waiters++;
+  for (const FutexWaitList::Shard& shard : wait_list->shards_) {
+    for (const auto& it : shard.location_lists) {
+      FutexWaitListNode* node = it.second.head;
+      while (node != nullptr) {
+        if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+          waiters++;
+        }
+        node = node->next_;
       }
-      node = node->next_;
     }
   }
 
@@ -928,10 +1095,11 @@ Object FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoHeapAllocationMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  NoHeapAllocationMutexGuard lock_guard(&wait_list->promises_mutex_);
 
   int waiters = 0;
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -974,15 +1142,22 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 #endif  // DEBUG
 }
 
-void FutexWaitList::Verify() {
+void FutexWaitList::VerifyShard(Shard* shard) {
 #ifdef DEBUG
-  for (const auto& it : location_lists_) {
+  for (const auto& it : shard->location_lists) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
+      DCHECK_EQ(shard, ShardFor(node->wait_location_));
       VerifyNode(node, it.second.head, it.second.tail);
       node = node->next_;
     }
   }
+#endif  // DEBUG
+}
+
+void FutexWaitList::Verify() {
+#ifdef DEBUG
+  for (Shard& shard : shards_) VerifyShard(&shard);
 
   for (const auto& it : isolate_promises_to_resolve_) {
     auto node = it.second.head;
@@ -70,8 +70,10 @@ class FutexWaitListNode {
 
   bool IsAsync() const { return isolate_for_async_waiters_ != nullptr; }
 
-  // Returns false if the cancelling failed, true otherwise.
-  bool CancelTimeoutTask();
+  // Takes the node off its Isolate's timeout queue. Returns false if the
+  // timeout handler has already taken it, in which case the handler is
+  // responsible for the node.
+  bool RemoveFromTimeoutQueue();
 
   class ResetWaitingOnScopeExit {
    public:
@@ -94,7 +96,9 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList shard
+  // which wait_location_ maps to (or, for nodes waiting for their Promises to
+  // be resolved, by the FutexWaitList's promises mutex).
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -111,9 +115,10 @@ class FutexWaitListNode {
   // update the head and tail of the list).
   int8_t* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ and interrupted_ are protected by the mutex of the
+  // FutexWaitList shard which wait_location_ maps to, if this node is
+  // currently contained in the FutexWaitList or an AtomicsWaitWakeHandle has
+  // access to it.
   bool waiting_ = false;
   bool interrupted_ = false;
 
@@ -130,8 +135,13 @@ class FutexWaitListNode {
   // waiters with an active timeout.
   base::TimeTicks async_timeout_time_;
 
-  CancelableTaskManager::Id timeout_task_id_ =
-      CancelableTaskManager::kInvalidTaskId;
+  // Only for async FutexWaitListNodes with a timeout. The key of the node in
+  // its Isolate's timeout queue, or base::TimeTicks() if it isn't on it.
+  // timeout_firing_ is set while the timeout handler has taken the node off
+  // the queue but not processed it yet. Both are protected by the
+  // FutexWaitList's promises mutex.
+  base::TimeTicks timeout_queue_key_;
+  bool timeout_firing_ = false;
 
   DISALLOW_COPY_AND_ASSIGN(FutexWaitListNode);
 };
@@ -229,6 +239,9 @@ class FutexEmulation : public AllStatic {
 
   static void ResolveAsyncWaiterPromise(FutexWaitListNode* node);
 
+  // Handle the async waiters of |isolate| whose timeout has expired.
+  static void HandleAsyncWaiterTimeouts(Isolate* isolate);
+
   static void HandleAsyncWaiterTimeout(FutexWaitListNode* node);
 
   static void NotifyAsyncWaiter(FutexWaitListNode* node);
@@ -6,8 +6,10 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <fstream>  // NOLINT(readability/streams)
+#include <iomanip>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -667,8 +669,7 @@ class FrameArrayBuilder {
                                           offset, flags, parameters);
   }
 
-  void AppendPromiseCombinatorFrame(Handle<JSFunction> element_function,
-                                    Handle<JSFunction> combinator,
+  void AppendPromiseCombinatorFrame(int offset, Handle<JSFunction> combinator,
                                     FrameArray::Flag combinator_flag,
                                     Handle<Context> context) {
     if (full()) return;
@@ -683,11 +684,6 @@ class FrameArrayBuilder {
     // TODO(mmarchini) save Promises list from the Promise combinator
     Handle<FixedArray> parameters = isolate_->factory()->empty_fixed_array();
 
-    // We store the offset of the promise into the element function's
-    // hash field for element callbacks.
-    int const offset =
-        Smi::ToInt(Smi::cast(element_function->GetIdentityHash())) - 1;
-
     elements_ = FrameArray::AppendJSFrame(elements_, receiver, combinator, code,
                                           offset, flags, parameters);
   }
@@ -778,21 +774,6 @@ class FrameArrayBuilder {
     return elements_;
   }
 
-  // Creates a StackTraceFrame object for each frame in the FrameArray.
-  Handle<FixedArray> GetElementsAsStackTraceFrameArray() {
-    elements_->ShrinkToFit(isolate_);
-    const int frame_count = elements_->FrameCount();
-    Handle<FixedArray> stack_trace =
-        isolate_->factory()->NewFixedArray(frame_count);
-
-    for (int i = 0; i < frame_count; ++i) {
-      Handle<StackTraceFrame> frame =
-          isolate_->factory()->NewStackTraceFrame(elements_, i);
-      stack_trace->set(i, *frame);
-    }
-    return stack_trace;
-  }
-
  private:
   // Poison stack frames below the first strict mode frame.
   // The stack trace API should not expose receivers and function
@@ -896,6 +877,17 @@ bool IsBuiltinFunction(Isolate* isolate, HeapObject object,
   return function.code() == isolate->builtins()->builtin(builtin_index);
 }
 
+// Returns the offset of the promise that a Promise.all or Promise.any
+// element function was registered for. It's either stored on the {reaction}
+// (for the shared element functions of the fast path) or in the element
+// function's hash field.
+int PromiseCombinatorElementOffset(Handle<PromiseReaction> reaction,
+                                   Handle<JSFunction> element_function) {
+  Object index = reaction->promise_or_capability();
+  if (index.IsSmi()) return Smi::ToInt(index) - 1;
+  return Smi::ToInt(Smi::cast(element_function->GetIdentityHash())) - 1;
+}
+
 void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
                             FrameArrayBuilder* builder) {
   while (!builder->full()) {
@@ -943,14 +935,17 @@ void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
                          isolate);
       }
     } else if (IsBuiltinFunction(isolate, reaction->fulfill_handler(),
-                                 Builtins::kPromiseAllResolveElementClosure)) {
+                                 Builtins::kPromiseAllResolveElementClosure) ||
+               IsBuiltinFunction(isolate, reaction->fulfill_handler(),
+                                 Builtins::kPromiseAllResolveElementIndexed)) {
       Handle<JSFunction> function(JSFunction::cast(reaction->fulfill_handler()),
                                   isolate);
       Handle<Context> context(function->context(), isolate);
       Handle<JSFunction> combinator(context->native_context().promise_all(),
                                     isolate);
-      builder->AppendPromiseCombinatorFrame(function, combinator,
-                                            FrameArray::kIsPromiseAll, context);
+      builder->AppendPromiseCombinatorFrame(
+          PromiseCombinatorElementOffset(reaction, function), combinator,
+          FrameArray::kIsPromiseAll, context);
 
       // Now peak into the Promise.all() resolve element context to
       // find the promise capability that's being resolved when all
@@ -962,14 +957,17 @@ void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
       if (!capability->promise().IsJSPromise()) return;
       promise = handle(JSPromise::cast(capability->promise()), isolate);
     } else if (IsBuiltinFunction(isolate, reaction->reject_handler(),
-                                 Builtins::kPromiseAnyRejectElementClosure)) {
+                                 Builtins::kPromiseAnyRejectElementClosure) ||
+               IsBuiltinFunction(isolate, reaction->reject_handler(),
+                                 Builtins::kPromiseAnyRejectElementIndexed)) {
       Handle<JSFunction> function(JSFunction::cast(reaction->reject_handler()),
                                   isolate);
       Handle<Context> context(function->context(), isolate);
       Handle<JSFunction> combinator(context->native_context().promise_any(),
                                     isolate);
-      builder->AppendPromiseCombinatorFrame(function, combinator,
-                                            FrameArray::kIsPromiseAny, context);
+      builder->AppendPromiseCombinatorFrame(
+          PromiseCombinatorElementOffset(reaction, function), combinator,
+          FrameArray::kIsPromiseAny, context);
 
       // Now peak into the Promise.any() reject element context to
       // find the promise capability that's being resolved when any of
@@ -991,8 +989,8 @@ void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
       // We have some generic promise chain here, so try to
       // continue with the chained promise on the reaction
       // (only works for native promise chains).
-      Handle<HeapObject> promise_or_capability(
-          reaction->promise_or_capability(), isolate);
+      Handle<Object> promise_or_capability(reaction->promise_or_capability(),
+                                           isolate);
       if (promise_or_capability->IsJSPromise()) {
         promise = Handle<JSPromise>::cast(promise_or_capability);
       } else if (promise_or_capability->IsPromiseCapability()) {
@@ -1001,8 +999,10 @@ void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
         if (!capability->promise().IsJSPromise()) return;
         promise = handle(JSPromise::cast(capability->promise()), isolate);
       } else {
-        // Otherwise the {promise_or_capability} must be undefined here.
-        CHECK(promise_or_capability->IsUndefined(isolate));
+        // Otherwise the {promise_or_capability} must be undefined or the
+        // element index of a promise combinator here.
+        CHECK(promise_or_capability->IsUndefined(isolate) ||
+              promise_or_capability->IsSmi());
         return;
       }
     }
@@ -1024,8 +1024,8 @@ struct CaptureStackTraceOptions {
   bool async_stack_trace;
 };
 
-Handle<Object> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
-                                 CaptureStackTraceOptions options) {
+Handle<FrameArray> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
+                                     CaptureStackTraceOptions options) {
   DisallowJavascriptExecution no_js(isolate);
 
   TRACE_EVENT_BEGIN1(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"),
@@ -1141,7 +1141,7 @@ Handle<Object> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
         // yield inside an async generator), but we might still be able to
         // find an async frame if we follow along the chain of promises on
         // the {promise_reaction_job_task}.
-        Handle<HeapObject> promise_or_capability(
+        Handle<Object> promise_or_capability(
             promise_reaction_job_task->promise_or_capability(), isolate);
         if (promise_or_capability->IsJSPromise()) {
           Handle<JSPromise> promise =
@@ -1152,9 +1152,9 @@ Handle<Object> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
     }
   }
 
-  Handle<FixedArray> stack_trace = builder.GetElementsAsStackTraceFrameArray();
+  Handle<FrameArray> stack_trace = builder.GetElements();
   TRACE_EVENT_END1(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"),
-                   "CaptureStackTrace", "frameCount", stack_trace->length());
+                   "CaptureStackTrace", "frameCount", stack_trace->FrameCount());
   return stack_trace;
 }
 
@@ -1174,6 +1174,8 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
   options.filter_mode = FrameArrayBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = false;
 
+  // Only the raw frames are kept; StackTraceFrame objects and positions are
+  // only created if the stack trace is formatted.
   return CaptureStackTrace(this, caller, options);
 }
 
@@ -1269,8 +1271,8 @@ Handle<FixedArray> Isolate::CaptureCurrentStackTrace(
           : FrameArrayBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = true;
 
-  return Handle<FixedArray>::cast(
-      CaptureStackTrace(this, factory()->undefined_value(), options));
+  return GetStackTraceFramesFromFrameArray(
+      this, CaptureStackTrace(this, factory()->undefined_value(), options));
 }
 
 void Isolate::PrintStack(FILE* out, PrintStackMode mode) {
@@ -1562,6 +1564,68 @@ void ReportBootstrappingException(Handle<Object> exception,
 #endif
 }
 
+// Returns true if the innermost handler for an exception thrown now is a
+// catch block in JavaScript. Such an exception never reaches a message
+// listener with the message created for this throw: the catch block drops
+// the pending message, and rethrowing from it is a new throw. Handlers of
+// finally blocks, builtins and Wasm are treated conservatively.
+bool IsCaughtByJavaScriptCatchBlock(Isolate* isolate) {
+  for (StackFrameIterator it(isolate); !it.done(); it.Advance()) {
+    StackFrame* frame = it.frame();
+    switch (frame->type()) {
+      case StackFrame::INTERPRETED: {
+        HandlerTable::CatchPrediction prediction;
+        if (JavaScriptFrame::cast(frame)->LookupExceptionHandlerInTable(
+                nullptr, &prediction) <= 0) {
+          break;
+        }
+        return prediction == HandlerTable::CAUGHT;
+      }
+      case StackFrame::OPTIMIZED: {
+        JavaScriptFrame* js_frame = JavaScriptFrame::cast(frame);
+        if (js_frame->LookupExceptionHandlerInTable(nullptr, nullptr) <= 0) {
+          break;
+        }
+        // Optimized code has no predictions, so look at the handler tables
+        // of the bytecode, starting with the innermost inlined function.
+        std::vector<FrameSummary> summaries;
+        js_frame->Summarize(&summaries);
+        for (size_t i = summaries.size(); i != 0; i--) {
+          const FrameSummary& summary = summaries[i - 1];
+          Handle<AbstractCode> code = summary.AsJavaScript().abstract_code();
+          if (code->kind() != CodeKind::INTERPRETED_FUNCTION) return false;
+          HandlerTable::CatchPrediction prediction;
+          HandlerTable table(code->GetBytecodeArray());
+          if (table.LookupRange(summary.code_offset(), nullptr, &prediction) <=
+              0) {
+            continue;
+          }
+          return prediction == HandlerTable::CAUGHT;
+        }
+        return false;
+      }
+      case StackFrame::STUB: {
+        Code code = frame->LookupCode();
+        if (code.kind() == CodeKind::BUILTIN && code.has_handler_table() &&
+            code.is_turbofanned()) {
+          return false;
+        }
+        break;
+      }
+      case StackFrame::EXIT:
+      case StackFrame::BUILTIN_EXIT:
+      case StackFrame::ARGUMENTS_ADAPTOR:
+      case StackFrame::CONSTRUCT:
+      case StackFrame::INTERNAL:
+        // These frames never handle exceptions.
+        break;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
 }  // anonymous namespace
 
 Handle<JSMessageObject> Isolate::CreateMessageOrAbort(
@@ -1642,9 +1706,15 @@ Object Isolate::ThrowInternal(Object raw_exception, MessageLocation* location) {
   //    captures messages or is verbose (which reports despite the catch).
   // 3) ReThrow from v8::TryCatch: The message from a previous throw still
   //    exists and we preserve it instead of creating a new message.
+  // 4) JavaScript catch block on top: The message is dropped when the
+  //    exception is caught, so there is no need to create it.
   bool requires_message = try_catch_handler() == nullptr ||
                           try_catch_handler()->is_verbose_ ||
                           try_catch_handler()->capture_message_;
+  if (requires_message && IsJavaScriptHandlerOnTop(raw_exception) &&
+      IsCaughtByJavaScriptCatchBlock(this)) {
+    requires_message = false;
+  }
   bool rethrowing_message = thread_local_top()->rethrowing_message_;
 
   thread_local_top()->rethrowing_message_ = false;
@@ -2110,12 +2180,12 @@ void Isolate::PrintCurrentStackTrace(FILE* out) {
   options.filter_mode = FrameArrayBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = false;
 
-  Handle<FixedArray> frames = Handle<FixedArray>::cast(
-      CaptureStackTrace(this, this->factory()->undefined_value(), options));
+  Handle<FrameArray> frames =
+      CaptureStackTrace(this, this->factory()->undefined_value(), options);
 
   IncrementalStringBuilder builder(this);
-  for (int i = 0; i < frames->length(); ++i) {
-    Handle<StackTraceFrame> frame(StackTraceFrame::cast(frames->get(i)), this);
+  for (int i = 0; i < frames->FrameCount(); ++i) {
+    Handle<StackTraceFrame> frame = factory()->NewStackTraceFrame(frames, i);
 
     SerializeStackTraceFrame(this, frame, &builder);
   }
@@ -2188,10 +2258,9 @@ bool Isolate::ComputeLocationFromStackTrace(MessageLocation* target,
   Handle<Name> key = factory()->stack_trace_symbol();
   Handle<Object> property =
       JSReceiver::GetDataProperty(Handle<JSObject>::cast(exception), key);
-  if (!property->IsFixedArray()) return false;
+  if (!property->IsFrameArray()) return false;
 
-  Handle<FrameArray> elements =
-      GetFrameArrayFromStackTrace(this, Handle<FixedArray>::cast(property));
+  Handle<FrameArray> elements = Handle<FrameArray>::cast(property);
 
   const int frame_count = elements->FrameCount();
   for (int i = 0; i < frame_count; i++) {
@@ -2459,9 +2528,10 @@ bool PromiseHasUserDefinedRejectHandlerInternal(Isolate* isolate,
   Handle<Object> current(promise->reactions(), isolate);
   while (!current->IsSmi()) {
     Handle<PromiseReaction> reaction = Handle<PromiseReaction>::cast(current);
-    Handle<HeapObject> promise_or_capability(reaction->promise_or_capability(),
-                                             isolate);
-    if (!promise_or_capability->IsUndefined(isolate)) {
+    Handle<Object> promise_or_capability(reaction->promise_or_capability(),
+                                         isolate);
+    if (!promise_or_capability->IsUndefined(isolate) &&
+        !promise_or_capability->IsSmi()) {
       if (!promise_or_capability->IsJSPromise()) {
         promise_or_capability = handle(
             Handle<PromiseCapability>::cast(promise_or_capability)->promise(),
@@ -2858,7 +2928,9 @@ class TracingAccountingAllocator : public AccountingAllocator {
     }
     out << "\"allocated\": " << total_segment_bytes_allocated << ", "
         << "\"used\": " << total_zone_allocation_size << ", "
-        << "\"freed\": " << total_zone_freed_size << "}";
+        << "\"freed\": " << total_zone_freed_size << ", "
+        << "\"pooled\": " << GetCurrentPoolSize() << ", "
+        << "\"reused\": " << GetReusedSegmentBytes() << "}";
   }
 
   Isolate* const isolate_;
@@ -3602,6 +3674,19 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   // embedded blob setup).
   init_memcopy_functions();
 
+  if (FLAG_short_builtin_calls && embedded_blob_code() != nullptr) {
+    const base::AddressRegion& code_range = heap()->code_range();
+    Address blob_start = reinterpret_cast<Address>(embedded_blob_code());
+    Address blob_end = blob_start + embedded_blob_code_size();
+    // All pc-relative offsets between the code range and the embedded blob
+    // fit into 32 bits if both are within a 2GB region.
+    is_short_builtin_calls_enabled_ =
+        !code_range.is_empty() &&
+        std::max(blob_end, code_range.end()) -
+                std::min(blob_start, code_range.begin()) <=
+            static_cast<Address>(kMaxInt);
+  }
+
   if (FLAG_log_internal_timer_events) {
     set_event_logger(Logger::DefaultEventLoggerSentinel);
   }
@@ -3804,6 +3889,23 @@ void Isolate::DumpAndResetStats() {
       stack_access_count_map = nullptr;
     }
   }
+  if (elements_transition_stats_) {
+    std::vector<std::pair<std::string, uint64_t>> transitions(
+        elements_transition_stats_->begin(), elements_transition_stats_->end());
+    std::sort(transitions.begin(), transitions.end(),
+              [](const std::pair<std::string, uint64_t>& a,
+                 const std::pair<std::string, uint64_t>& b) {
+                return a.second > b.second ||
+                       (a.second == b.second && a.first < b.first);
+              });
+    StdoutStream os;
+    os << "=== Elements transitions ===" << std::endl;
+    for (const auto& transition : transitions) {
+      os << std::setw(10) << transition.second << "  " << transition.first
+         << std::endl;
+    }
+    elements_transition_stats_.reset();
+  }
   if (turbo_statistics() != nullptr) {
     DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp);
     StdoutStream os;
@@ -3823,8 +3925,9 @@ void Isolate::DumpAndResetStats() {
   if (FLAG_turbo_stats_wasm) {
     wasm_engine()->DumpAndResetTurboStatistics();
   }
-  if (V8_UNLIKELY(TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
-                  v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
+  if (V8_UNLIKELY(FLAG_runtime_call_stats_sampling ||
+                  TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
+                      v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
     counters()->worker_thread_runtime_call_stats()->AddToMainTable(
         counters()->runtime_call_stats());
     counters()->runtime_call_stats()->Print();
@@ -3837,6 +3940,40 @@ void Isolate::DumpAndResetStats() {
   }
 }
 
+void Isolate::CountElementsTransition(ElementsKind from_kind,
+                                      ElementsKind to_kind) {
+  DCHECK(FLAG_trace_elements_transition_stats);
+  std::ostringstream key;
+  key << ElementsKindToString(from_kind) << " -> "
+      << ElementsKindToString(to_kind) << " in ";
+  {
+    DisallowHeapAllocation no_gc;
+    JavaScriptFrameIterator it(this);
+    if (it.done()) {
+      key << "<no JavaScript frame>";
+    } else {
+      JavaScriptFrame* frame = it.frame();
+      SharedFunctionInfo shared = frame->function().shared();
+      key << shared.DebugName().ToCString().get();
+      Object maybe_script = shared.script();
+      if (maybe_script.IsScript()) {
+        Script script = Script::cast(maybe_script);
+        Object script_name = script.name();
+        key << " at "
+            << (script_name.IsString()
+                    ? String::cast(script_name).ToCString().get()
+                    : std::string("<unknown>"))
+            << ":" << script.GetLineNumber(frame->position()) + 1;
+      }
+    }
+  }
+  if (!elements_transition_stats_) {
+    elements_transition_stats_ =
+        std::make_unique<std::unordered_map<std::string, uint64_t>>();
+  }
+  (*elements_transition_stats_)[key.str()]++;
+}
+
 void Isolate::AbortConcurrentOptimization(BlockingBehavior behavior) {
   if (concurrent_recompilation_enabled()) {
     DisallowHeapAllocation no_recursive_gc;
@@ -4510,6 +4647,40 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   }
 }
 
+void Isolate::SetCpuTimeAccountingEnabled(bool enabled) {
+  if (enabled == cpu_time_accounting_enabled_) return;
+  if (enabled && !base::ThreadTicks::IsSupported()) return;
+  if (enabled) {
+    cpu_time_last_transition_ = base::ThreadTicks::Now();
+    cpu_time_last_transition_thread_ = ThreadId::Current();
+  } else {
+    AccountCpuTimeForVMState(current_vm_state());
+  }
+  cpu_time_accounting_enabled_ = enabled;
+}
+
+void Isolate::AccountCpuTimeForVMState(StateTag state) {
+  DCHECK_LT(state, kNumberOfVMStates);
+  base::ThreadTicks now = base::ThreadTicks::Now();
+  ThreadId thread = ThreadId::Current();
+  // Thread CPU time of different threads cannot be compared, so a transition
+  // after the isolate moved to another thread only restarts the measurement.
+  if (thread == cpu_time_last_transition_thread_) {
+    cpu_time_per_vm_state_[state] += now - cpu_time_last_transition_;
+  }
+  cpu_time_last_transition_ = now;
+  cpu_time_last_transition_thread_ = thread;
+}
+
+base::TimeDelta Isolate::GetCpuTimeForVMState(StateTag state) {
+  DCHECK_LT(state, kNumberOfVMStates);
+  // Include the time spent in the current state so far.
+  if (cpu_time_accounting_enabled_) {
+    AccountCpuTimeForVMState(current_vm_state());
+  }
+  return cpu_time_per_vm_state_[state];
+}
+
 void Isolate::IsolateInBackgroundNotification() {
   is_isolate_in_background_ = true;
   heap()->ActivateMemoryReducerIfNeeded();
@@ -4561,13 +4732,51 @@ void Isolate::CollectSourcePositionsForAllBytecodeArrays() {
 }
 
 #ifdef V8_INTL_SUPPORT
-icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type) {
-  return icu_object_cache_[cache_type].get();
+namespace {
+
+bool GetICUObjectCacheKey(Handle<Object> locales, std::string* key) {
+  if (locales->IsUndefined()) {
+    key->clear();
+    return true;
+  }
+  if (!locales->IsString() || String::cast(*locales).length() == 0) {
+    return false;
+  }
+  *key = String::cast(*locales).ToCString().get();
+  return true;
+}
+
+}  // namespace
+
+icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
+                                             Handle<Object> locales) {
+  std::string key;
+  if (!GetICUObjectCacheKey(locales, &key)) return nullptr;
+  std::vector<ICUObjectCacheEntry>& entries = icu_object_cache_[cache_type];
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (it->locales != key) continue;
+    // Move the entry to the front, so the least recently used is evicted.
+    std::rotate(entries.begin(), it, it + 1);
+    return entries.front().obj.get();
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                                      Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[cache_type] = obj;
+  std::string key;
+  if (!GetICUObjectCacheKey(locales, &key)) return;
+  std::vector<ICUObjectCacheEntry>& entries = icu_object_cache_[cache_type];
+  auto it = std::find_if(
+      entries.begin(), entries.end(),
+      [&key](const ICUObjectCacheEntry& entry) { return entry.locales == key; });
+  if (it != entries.end()) {
+    entries.erase(it);
+  } else if (entries.size() >= kICUObjectCacheSize) {
+    entries.pop_back();
+  }
+  entries.insert(entries.begin(), {std::move(key), std::move(obj)});
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
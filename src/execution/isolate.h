@@ -10,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <queue>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -19,6 +20,7 @@
 #include "include/v8.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/builtins/builtins.h"
 #include "src/common/globals.h"
 #include "src/debug/interface-types.h"
@@ -36,6 +38,7 @@
 #include "src/objects/code.h"
 #include "src/objects/contexts.h"
 #include "src/objects/debug-objects.h"
+#include "src/objects/elements-kind.h"
 #include "src/runtime/runtime.h"
 #include "src/strings/unicode.h"
 #include "src/utils/allocation.h"
@@ -447,6 +450,8 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(const v8::StartupData*, snapshot_blob, nullptr)                            \
   V(int, code_and_metadata_size, 0)                                            \
   V(int, bytecode_and_metadata_size, 0)                                        \
+  V(int, bytecode_size, 0)                                                     \
+  V(int, optimized_code_source_positions_size, 0)                              \
   V(int, external_script_source_size, 0)                                       \
   /* Number of CPU profilers running on the isolate. */                        \
   V(size_t, num_cpu_profilers, 0)                                              \
@@ -639,6 +644,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return &transition_array_access_;
   }
 
+  // Shared mutex for allowing concurrent reads of DescriptorArrays that the
+  // main thread may update in place (e.g. field generalization).
+  base::SharedMutex* map_updater_access() { return &map_updater_access_; }
+
   // The isolate's string table.
   StringTable* string_table() { return string_table_.get(); }
 
@@ -1161,6 +1170,16 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   THREAD_LOCAL_TOP_ACCESSOR(StateTag, current_vm_state)
 
+  // Accounting of thread CPU time per VM state. When enabled, every VMState
+  // transition charges the CPU time since the previous transition to the
+  // state being left.
+  bool cpu_time_accounting_enabled() const {
+    return cpu_time_accounting_enabled_;
+  }
+  void SetCpuTimeAccountingEnabled(bool enabled);
+  void AccountCpuTimeForVMState(StateTag state);
+  base::TimeDelta GetCpuTimeForVMState(StateTag state);
+
   void SetData(uint32_t slot, void* data) {
     DCHECK_LT(slot, Internals::kNumIsolateDataSlots);
     isolate_data_.embedder_data_[slot] = data;
@@ -1217,6 +1236,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return is_precise_binary_code_coverage() || is_block_binary_code_coverage();
   }
 
+  debug::CoverageMode* code_coverage_mode_address() {
+    return &code_coverage_mode_;
+  }
+
   bool is_count_code_coverage() const {
     return is_precise_count_code_coverage() || is_block_count_code_coverage();
   }
@@ -1258,8 +1281,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       kDefaultCollator, kDefaultNumberFormat, kDefaultSimpleDateFormat,
       kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate};
 
-  icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type);
+  // The cache holds objects created for undefined or string {locales}
+  // (and undefined options), keyed by the locales string.
+  icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type,
+                                      Handle<Object> locales);
   void set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                               Handle<Object> locales,
                                std::shared_ptr<icu::UMemory> obj);
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
   void ClearCachedIcuObjects();
@@ -1319,6 +1346,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void DumpAndResetStats();
 
+  // Records an elements kind transition at the current JavaScript location for
+  // --trace-elements-transition-stats.
+  void CountElementsTransition(ElementsKind from_kind, ElementsKind to_kind);
+
   void* stress_deopt_count_address() { return &stress_deopt_count_; }
 
   void set_force_slow_path(bool v) { force_slow_path_ = v; }
@@ -1609,6 +1640,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   bool RequiresCodeRange() const;
 
+  // Whether generated code can call and jump to embedded builtins with
+  // pc-relative instructions, i.e. the code range and the embedded blob are
+  // close enough to each other.
+  bool is_short_builtin_calls_enabled() const {
+    return is_short_builtin_calls_enabled_;
+  }
+
   static Address load_from_stack_count_address(const char* function_name);
   static Address store_to_stack_count_address(const char* function_name);
 
@@ -1758,6 +1796,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   base::SharedMutex feedback_vector_access_;
   base::SharedMutex string_access_;
   base::SharedMutex transition_array_access_;
+  base::SharedMutex map_updater_access_;
   Logger* logger_ = nullptr;
   StubCache* load_stub_cache_ = nullptr;
   StubCache* store_stub_cache_ = nullptr;
@@ -1813,7 +1852,16 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       return static_cast<std::size_t>(a);
     }
   };
-  std::unordered_map<ICUObjectCacheType, std::shared_ptr<icu::UMemory>,
+  // Maximum number of cached objects per cache type.
+  static const size_t kICUObjectCacheSize = 8;
+  struct ICUObjectCacheEntry {
+    // Empty for undefined locales, which can't clash since an empty locales
+    // string is never cached.
+    std::string locales;
+    std::shared_ptr<icu::UMemory> obj;
+  };
+  // Entries for each cache type, most recently used first.
+  std::unordered_map<ICUObjectCacheType, std::vector<ICUObjectCacheEntry>,
                      ICUObjectCacheTypeHash>
       icu_object_cache_;
 
@@ -1846,6 +1894,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // Time stamp at initialization.
   double time_millis_at_init_ = 0;
 
+  // See AccountCpuTimeForVMState.
+  static constexpr int kNumberOfVMStates = IDLE + 1;
+  bool cpu_time_accounting_enabled_ = false;
+  base::ThreadTicks cpu_time_last_transition_;
+  ThreadId cpu_time_last_transition_thread_ = ThreadId::Invalid();
+  base::TimeDelta cpu_time_per_vm_state_[kNumberOfVMStates];
+
 #ifdef DEBUG
   static std::atomic<size_t> non_disposed_isolates_;
 
@@ -1893,6 +1948,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<PersistentHandlesList> persistent_handles_list_;
 
+  // Elements transitions by kinds and source location, only allocated with
+  // --trace-elements-transition-stats.
+  std::unique_ptr<std::unordered_map<std::string, uint64_t>>
+      elements_transition_stats_;
+
   // Counts deopt points if deopt_every_n_times is enabled.
   unsigned int stress_deopt_count_ = 0;
 
@@ -1937,6 +1997,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   const uint8_t* embedded_blob_code_ = nullptr;
   uint32_t embedded_blob_code_size_ = 0;
+  bool is_short_builtin_calls_enabled_ = false;
   const uint8_t* embedded_blob_data_ = nullptr;
   uint32_t embedded_blob_data_size_ = 0;
 
@@ -704,7 +704,8 @@ StackFrameBase* FrameArrayIterator::Frame() {
 namespace {
 
 MaybeHandle<Object> ConstructCallSite(Isolate* isolate,
-                                      Handle<StackTraceFrame> frame) {
+                                      Handle<FrameArray> frame_array,
+                                      int frame_index) {
   Handle<JSFunction> target =
       handle(isolate->native_context()->callsite_function(), isolate);
 
@@ -717,10 +718,6 @@ MaybeHandle<Object> ConstructCallSite(Isolate* isolate,
   //               it to the StackTraceFrame. The CallSite API builtins can then
   //               be implemented using StackFrameInfo objects.
 
-  Handle<FrameArray> frame_array(FrameArray::cast(frame->frame_array()),
-                                 isolate);
-  int frame_index = frame->frame_index();
-
   Handle<Symbol> key = isolate->factory()->call_site_frame_array_symbol();
   RETURN_ON_EXCEPTION(isolate,
                       JSObject::SetOwnPropertyIgnoreAttributes(
@@ -740,16 +737,14 @@ MaybeHandle<Object> ConstructCallSite(Isolate* isolate,
 // Convert the raw frames as written by Isolate::CaptureSimpleStackTrace into
 // a JSArray of JSCallSite objects.
 MaybeHandle<JSArray> GetStackFrames(Isolate* isolate,
-                                    Handle<FixedArray> elems) {
-  const int frame_count = elems->length();
+                                    Handle<FrameArray> elems) {
+  const int frame_count = elems->FrameCount();
 
   Handle<FixedArray> frames = isolate->factory()->NewFixedArray(frame_count);
   for (int i = 0; i < frame_count; i++) {
     Handle<Object> site;
-    Handle<StackTraceFrame> frame(StackTraceFrame::cast(elems->get(i)),
-                                  isolate);
-    ASSIGN_RETURN_ON_EXCEPTION(isolate, site, ConstructCallSite(isolate, frame),
-                               JSArray);
+    ASSIGN_RETURN_ON_EXCEPTION(isolate, site,
+                               ConstructCallSite(isolate, elems, i), JSArray);
     frames->set(i, *site);
   }
 
@@ -811,8 +806,8 @@ class PrepareStackTraceScope {
 MaybeHandle<Object> ErrorUtils::FormatStackTrace(Isolate* isolate,
                                                  Handle<JSObject> error,
                                                  Handle<Object> raw_stack) {
-  DCHECK(raw_stack->IsFixedArray());
-  Handle<FixedArray> elems = Handle<FixedArray>::cast(raw_stack);
+  DCHECK(raw_stack->IsFrameArray());
+  Handle<FrameArray> elems = Handle<FrameArray>::cast(raw_stack);
 
   const bool in_recursion = isolate->formatting_stack_trace();
   if (!in_recursion) {
@@ -881,11 +876,11 @@ MaybeHandle<Object> ErrorUtils::FormatStackTrace(Isolate* isolate,
 
   wasm::WasmCodeRefScope wasm_code_ref_scope;
 
-  for (int i = 0; i < elems->length(); ++i) {
+  for (int i = 0; i < elems->FrameCount(); ++i) {
     builder.AppendCString("\n    at ");
 
-    Handle<StackTraceFrame> frame(StackTraceFrame::cast(elems->get(i)),
-                                  isolate);
+    Handle<StackTraceFrame> frame =
+        isolate->factory()->NewStackTraceFrame(elems, i);
     SerializeStackTraceFrame(isolate, frame, &builder);
 
     if (isolate->has_pending_exception()) {
@@ -11,6 +11,7 @@
 #include "src/base/logging.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
+#include "src/init/v8.h"
 #include "src/objects/microtask-inl.h"
 #include "src/objects/visitors.h"
 #include "src/roots/roots-inl.h"
@@ -27,6 +28,8 @@ const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
 const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
 const size_t MicrotaskQueue::kFinishedMicrotaskCountOffset =
     OFFSET_OF(MicrotaskQueue, finished_microtask_count_);
+const size_t MicrotaskQueue::kFinishedMicrotaskCountLimitOffset =
+    OFFSET_OF(MicrotaskQueue, finished_microtask_count_limit_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
 
@@ -119,6 +122,29 @@ void MicrotaskQueue::PerformCheckpoint(v8::Isolate* v8_isolate) {
   }
 }
 
+bool MicrotaskQueue::PerformBoundedCheckpoint(v8::Isolate* v8_isolate,
+                                              int max_count,
+                                              double deadline_in_seconds) {
+  if (max_count <= 0 || IsRunningMicrotasks() || GetMicrotasksScopeDepth() ||
+      HasMicrotasksSuppressions()) {
+    return size() == 0;
+  }
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  // The deadline is only checked in between batches, so that the builtin is
+  // not re-entered for every single microtask.
+  static constexpr int kBatchSize = 32;
+  int remaining = max_count;
+  do {
+    int processed = RunMicrotasks(isolate, std::min(remaining, kBatchSize));
+    if (processed < 0) break;
+    remaining -= processed;
+  } while (size() && remaining > 0 &&
+           V8::GetCurrentPlatform()->MonotonicallyIncreasingTime() <
+               deadline_in_seconds);
+  isolate->ClearKeptObjects();
+  return size() == 0;
+}
+
 namespace {
 
 class SetIsRunningMicrotasks {
@@ -139,11 +165,12 @@ class SetIsRunningMicrotasks {
 
 }  // namespace
 
-int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
+int MicrotaskQueue::RunMicrotasks(Isolate* isolate, intptr_t max_count) {
   if (!size()) {
     OnCompleted(isolate);
     return 0;
   }
+  DCHECK_LT(0, max_count);
 
   intptr_t base_count = finished_microtask_count_;
 
@@ -162,8 +189,12 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     TRACE_EVENT_BEGIN0("v8.execute", "RunMicrotasks");
     {
       TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.RunMicrotasks");
+      finished_microtask_count_limit_ =
+          max_count < kNoMicrotaskLimit - base_count ? base_count + max_count
+                                                     : kNoMicrotaskLimit;
       maybe_result = Execution::TryRunMicrotasks(isolate, this,
                                                  &maybe_exception);
+      finished_microtask_count_limit_ = kNoMicrotaskLimit;
       processed_microtask_count =
           static_cast<int>(finished_microtask_count_ - base_count);
     }
@@ -183,8 +214,8 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     OnCompleted(isolate);
     return -1;
   }
-  DCHECK_EQ(0, size());
-  OnCompleted(isolate);
+  DCHECK_IMPLIES(size(), processed_microtask_count == max_count);
+  if (!size()) OnCompleted(isolate);
 
   return processed_microtask_count;
 }
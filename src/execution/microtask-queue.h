@@ -6,6 +6,7 @@
 #define V8_EXECUTION_MICROTASK_QUEUE_H_
 
 #include <stdint.h>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -41,6 +42,8 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   void EnqueueMicrotask(v8::Isolate* isolate, v8::MicrotaskCallback callback,
                         void* data) override;
   void PerformCheckpoint(v8::Isolate* isolate) override;
+  bool PerformBoundedCheckpoint(v8::Isolate* isolate, int max_count,
+                                double deadline_in_seconds) override;
 
   void EnqueueMicrotask(Microtask microtask);
   void AddMicrotasksCompletedCallback(
@@ -49,10 +52,12 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
       MicrotasksCompletedCallbackWithData callback, void* data) override;
   bool IsRunningMicrotasks() const override { return is_running_microtasks_; }
 
-  // Runs all queued Microtasks.
+  // Runs queued Microtasks until the queue is empty or {max_count} of them
+  // ran, whichever comes first. Microtasks completed callbacks only fire once
+  // the queue is empty.
   // Returns -1 if the execution is terminating, otherwise, returns the number
   // of microtasks that ran in this round.
-  int RunMicrotasks(Isolate* isolate);
+  int RunMicrotasks(Isolate* isolate, intptr_t max_count = kNoMicrotaskLimit);
 
   // Iterate all pending Microtasks in this queue as strong roots, so that
   // builtins can update the queue directly without the write barrier.
@@ -103,8 +108,11 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
   static const size_t kFinishedMicrotaskCountOffset;
+  static const size_t kFinishedMicrotaskCountLimitOffset;
 
   static const intptr_t kMinimumCapacity;
+  static constexpr intptr_t kNoMicrotaskLimit =
+      std::numeric_limits<intptr_t>::max();
 
  private:
   void OnCompleted(Isolate* isolate);
@@ -123,6 +131,10 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // The RunMicrotasks builtin stops once |finished_microtask_count_| reaches
+  // this value.
+  intptr_t finished_microtask_count_limit_ = kNoMicrotaskLimit;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
@@ -12,9 +12,12 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/tiering-profile.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
+#include "src/objects/contexts-inl.h"
+#include "src/objects/osr-optimized-code-cache.h"
 #include "src/tracing/trace-event.h"
 
 namespace v8 {
@@ -46,9 +49,17 @@ static const int kMaxBytecodeSizeForEarlyOpt = 90;
 // additional tick to mark it for OSR) and hence this is set to 3 * 10.
 static const int kProfilerTicksForTurboPropOSR = 3 * 10;
 
-#define OPTIMIZATION_REASON_LIST(V)   \
-  V(DoNotOptimize, "do not optimize") \
-  V(HotAndStable, "hot and stable")   \
+// Number of times a function has to be seen on the stack before it is
+// optimized, if it had been optimized when the code cache it was deserialized
+// from was created, or if it is listed in the loaded tiering profile.
+static const int kProfilerTicksBeforeOptimizationWithHint = 1;
+
+#define OPTIMIZATION_REASON_LIST(V)                \
+  V(DoNotOptimize, "do not optimize")              \
+  V(HotAndStable, "hot and stable")                \
+  V(WarmForMidTier, "warm for midtier")            \
+  V(HotInCodeCache, "hot in code cache")           \
+  V(HotInTieringProfile, "hot in tiering profile") \
   V(SmallFunction, "small function")
 
 enum class OptimizationReason : uint8_t {
@@ -116,10 +127,23 @@ void TraceRecompile(JSFunction function, OptimizationReason reason,
   }
 }
 
+bool HasMidTier() {
+  return FLAG_turboprop_as_midtier || FLAG_turbo_nci_as_midtier;
+}
+
 }  // namespace
 
 RuntimeProfiler::RuntimeProfiler(Isolate* isolate)
-    : isolate_(isolate), any_ic_changed_(false) {}
+    : isolate_(isolate),
+      any_ic_changed_(false),
+      tiering_profile_(TieringProfile::MaybeCreateFromFlags()) {}
+
+RuntimeProfiler::~RuntimeProfiler() {
+  if (tiering_profile_ && FLAG_tiering_profile_out != nullptr &&
+      !tiering_profile_->WriteToFile(FLAG_tiering_profile_out)) {
+    PrintF("Cannot write tiering profile to '%s'\n", FLAG_tiering_profile_out);
+  }
+}
 
 void RuntimeProfiler::Optimize(JSFunction function, OptimizationReason reason,
                                CodeKind code_kind) {
@@ -205,6 +229,15 @@ bool RuntimeProfiler::MaybeOSR(JSFunction function, InterpretedFrame* frame) {
     return false;
   }
 
+  // If an earlier execution already compiled OSR code for some loop of this
+  // function, arm the back edges right away so that this execution enters the
+  // cached code instead of waiting for the bytecode size allowance to grow.
+  if (function.native_context().GetOSROptimizedCodeCache().HasOptimizedCode(
+          function.shared())) {
+    AttemptOnStackReplacement(frame);
+    return true;
+  }
+
   if (function.IsMarkedForOptimization() ||
       function.IsMarkedForConcurrentOptimization() ||
       function.HasAvailableOptimizedCode()) {
@@ -233,16 +266,48 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
     return OptimizationReason::kDoNotOptimize;
   }
   int ticks = function.feedback_vector().profiler_ticks();
-  int scale_factor = function.ActiveTierIsMidtierTurboprop()
-                         ? FLAG_ticks_scale_factor_for_top_tier
-                         : 1;
+  if (HasMidTier() && function.ActiveTierIsIgnition() &&
+      function.NextTier() != CodeKindForTopTier()) {
+    // Tiering up to the midtier is cheap, so warm functions are compiled
+    // with fewer ticks and a more generous bytecode size allowance than the
+    // ones required for the top tier.
+    int ticks_for_midtier =
+        FLAG_ticks_before_midtier_optimization +
+        (bytecode.length() / FLAG_midtier_bytecode_size_allowance_per_tick);
+    if (ticks >= ticks_for_midtier) {
+      return OptimizationReason::kWarmForMidTier;
+    }
+  }
+  if (function.shared().has_optimization_hint_from_code_cache() &&
+      ticks >= kProfilerTicksBeforeOptimizationWithHint) {
+    return OptimizationReason::kHotInCodeCache;
+  }
+  // Only look the function up in the tiering profile once per feedback
+  // vector, on the tick that would also trigger an optimization hint.
+  if (tiering_profile_ && tiering_profile_->has_loaded_functions() &&
+      ticks == kProfilerTicksBeforeOptimizationWithHint &&
+      tiering_profile_->IsHot(function.shared())) {
+    return OptimizationReason::kHotInTieringProfile;
+  }
+  // Turboprop's interrupt budget is smaller, so ticks towards TurboFan are
+  // scaled both from mid-tier code and for functions skipping the mid tier.
+  int scale_factor =
+      FLAG_turboprop_as_midtier && function.NextTier() == CodeKind::TURBOFAN
+          ? FLAG_ticks_scale_factor_for_top_tier
+          : 1;
   int ticks_for_optimization =
       kProfilerTicksBeforeOptimization +
       (bytecode.length() / kBytecodeSizeAllowancePerTick);
   ticks_for_optimization *= scale_factor;
+  // Back off exponentially from functions that keep deopting for the same
+  // reason, so that a deopt loop does not keep the compiler busy.
+  int repeated_deopts = FLAG_reoptimization_backoff
+                            ? function.feedback_vector().repeated_deopt_count()
+                            : 0;
+  ticks_for_optimization <<= repeated_deopts;
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
-  } else if (!any_ic_changed_ &&
+  } else if (!any_ic_changed_ && repeated_deopts == 0 &&
              bytecode.length() < kMaxBytecodeSizeForEarlyOpt) {
     // TODO(turboprop, mythria): Do we need to support small function
     // optimization for TP->TF tier up. If so, do we want to scale the bytecode
@@ -5,6 +5,8 @@
 #ifndef V8_EXECUTION_RUNTIME_PROFILER_H_
 #define V8_EXECUTION_RUNTIME_PROFILER_H_
 
+#include <memory>
+
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/utils/allocation.h"
@@ -17,12 +19,14 @@ class Isolate;
 class InterpretedFrame;
 class JavaScriptFrame;
 class JSFunction;
+class TieringProfile;
 enum class CodeKind;
 enum class OptimizationReason : uint8_t;
 
 class RuntimeProfiler {
  public:
   explicit RuntimeProfiler(Isolate* isolate);
+  ~RuntimeProfiler();
 
   // Called from the interpreter when the bytecode interrupt has been exhausted.
   void MarkCandidatesForOptimizationFromBytecode();
@@ -34,6 +38,9 @@ class RuntimeProfiler {
   void AttemptOnStackReplacement(InterpretedFrame* frame,
                                  int nesting_levels = 1);
 
+  // The profile from --tiering-profile-in/--tiering-profile-out, or nullptr.
+  TieringProfile* tiering_profile() const { return tiering_profile_.get(); }
+
  private:
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
@@ -62,6 +69,7 @@ class RuntimeProfiler {
 
   Isolate* isolate_;
   bool any_ic_changed_;
+  std::unique_ptr<TieringProfile> tiering_profile_;
 };
 
 }  // namespace internal
@@ -0,0 +1,110 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <sstream>
+
+#include "src/base/functional.h"
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+std::unique_ptr<TieringProfile> TieringProfile::MaybeCreateFromFlags() {
+  if (FLAG_tiering_profile_in == nullptr &&
+      FLAG_tiering_profile_out == nullptr) {
+    return nullptr;
+  }
+  std::unique_ptr<TieringProfile> profile(new TieringProfile());
+  if (FLAG_tiering_profile_in != nullptr &&
+      !profile->ReadFromFile(FLAG_tiering_profile_in)) {
+    PrintF("Cannot read tiering profile from '%s'\n", FLAG_tiering_profile_in);
+  }
+  return profile;
+}
+
+TieringProfile::TieringProfile() = default;
+
+TieringProfile::~TieringProfile() = default;
+
+size_t TieringProfile::KeyHash::operator()(const Key& key) const {
+  return base::hash_combine(key.start_position, key.end_position,
+                            base::hash_range(key.script_name.begin(),
+                                             key.script_name.end()));
+}
+
+// static
+bool TieringProfile::KeyFor(SharedFunctionInfo shared, Key* key) {
+  if (!shared.script().IsScript()) return false;
+  Object name = Script::cast(shared.script()).name();
+  if (!name.IsString() || String::cast(name).length() == 0) return false;
+  key->script_name = String::cast(name).ToCString().get();
+  // Names spanning several lines cannot be represented in the file format.
+  if (key->script_name.find('\n') != std::string::npos) return false;
+  key->start_position = shared.StartPosition();
+  key->end_position = shared.EndPosition();
+  return true;
+}
+
+bool TieringProfile::ReadFromFile(const char* path) {
+  bool exists = false;
+  std::string contents = ReadFile(path, &exists, false);
+  if (!exists) return false;
+  ReadFromString(contents);
+  return true;
+}
+
+void TieringProfile::ReadFromString(const std::string& contents) {
+  std::istringstream lines(contents);
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    Key key;
+    if (!(fields >> key.start_position >> key.end_position)) continue;
+    fields.get();  // Skip the separator.
+    std::getline(fields, key.script_name);
+    if (key.script_name.empty()) continue;
+    loaded_.insert(std::move(key));
+  }
+}
+
+bool TieringProfile::WriteToFile(const char* path) const {
+  FILE* file = base::OS::FOpen(path, "w");
+  if (file == nullptr) return false;
+  std::string contents = WriteToString();
+  size_t written = fwrite(contents.data(), 1, contents.size(), file);
+  fclose(file);
+  return written == contents.size();
+}
+
+std::string TieringProfile::WriteToString() const {
+  std::ostringstream out;
+  for (const Key& key : recorded_) {
+    out << key.start_position << " " << key.end_position << " "
+        << key.script_name << "\n";
+  }
+  return out.str();
+}
+
+bool TieringProfile::IsHot(SharedFunctionInfo shared) const {
+  if (loaded_.empty()) return false;
+  Key key;
+  if (!KeyFor(shared, &key)) return false;
+  return loaded_.count(key) != 0;
+}
+
+void TieringProfile::RecordOptimized(SharedFunctionInfo shared) {
+  Key key;
+  if (KeyFor(shared, &key)) recorded_.insert(std::move(key));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,81 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+
+// A tiering profile lists the functions that got optimized during a run,
+// identified by script name and source range. With --tiering-profile-out the
+// functions optimized in an isolate are written to a file when the isolate is
+// torn down; with --tiering-profile-in such a file is loaded on startup and
+// the listed functions are optimized as soon as they get their first profiler
+// tick.
+//
+// The file has one function per line: "<start> <end> <script name>".
+class V8_EXPORT_PRIVATE TieringProfile final {
+ public:
+  // Returns nullptr if neither --tiering-profile-in nor --tiering-profile-out
+  // is given.
+  static std::unique_ptr<TieringProfile> MaybeCreateFromFlags();
+
+  TieringProfile();
+  ~TieringProfile();
+
+  // Loads the functions listed in the file at {path}. Returns false if the
+  // file cannot be read; malformed lines are skipped.
+  bool ReadFromFile(const char* path);
+  void ReadFromString(const std::string& contents);
+  // Writes the functions recorded with RecordOptimized to {path}.
+  bool WriteToFile(const char* path) const;
+  std::string WriteToString() const;
+
+  // Whether {shared} was listed in a loaded profile.
+  bool IsHot(SharedFunctionInfo shared) const;
+  // Records that {shared} got optimized in this run.
+  void RecordOptimized(SharedFunctionInfo shared);
+
+  bool has_loaded_functions() const { return !loaded_.empty(); }
+  size_t recorded_functions() const { return recorded_.size(); }
+
+ private:
+  struct Key {
+    std::string script_name;
+    int start_position;
+    int end_position;
+
+    bool operator==(const Key& other) const {
+      return start_position == other.start_position &&
+             end_position == other.end_position &&
+             script_name == other.script_name;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  // Returns false if {shared} has no named script.
+  static bool KeyFor(SharedFunctionInfo shared, Key* key);
+
+  std::unordered_set<Key, KeyHash> loaded_;
+  std::unordered_set<Key, KeyHash> recorded_;
+
+  DISALLOW_COPY_AND_ASSIGN(TieringProfile);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
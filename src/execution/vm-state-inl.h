@@ -43,11 +43,17 @@ inline const char* StateToString(StateTag state) {
 template <StateTag Tag>
 VMState<Tag>::VMState(Isolate* isolate)
     : isolate_(isolate), previous_tag_(isolate->current_vm_state()) {
+  if (V8_UNLIKELY(isolate_->cpu_time_accounting_enabled())) {
+    isolate_->AccountCpuTimeForVMState(previous_tag_);
+  }
   isolate_->set_current_vm_state(Tag);
 }
 
 template <StateTag Tag>
 VMState<Tag>::~VMState() {
+  if (V8_UNLIKELY(isolate_->cpu_time_accounting_enabled())) {
+    isolate_->AccountCpuTimeForVMState(Tag);
+  }
   isolate_->set_current_vm_state(previous_tag_);
 }
 
@@ -455,6 +455,12 @@ DEFINE_IMPLICATION(trace_code_dependencies, trace_deopt_verbose)
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(eager_allocation_site_pretenuring, false,
+            "pretenure allocation sites that reached the pretenuring ratio in "
+            "two consecutive GCs, even if the new space is not at its maximum "
+            "capacity")
+DEFINE_IMPLICATION(eager_allocation_site_pretenuring,
+                   allocation_site_pretenuring)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_BOOL_READONLY(always_promote_young_mc, true,
                      "always promote young objects during mark-compact")
@@ -496,12 +502,21 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
+DEFINE_BOOL(json_slice_strings, false,
+            "let long strings from JSON.parse share the characters of the "
+            "source text instead of copying them")
 
 DEFINE_INT(interrupt_budget, 144 * KB,
            "interrupt budget which should be used for the profiler counter")
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the number of entries in the primary table of each "
+           "megamorphic stub cache (between 4 and 16)")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the number of entries in the secondary table of each "
+           "megamorphic stub cache (between 4 and 16)")
 DEFINE_INT(budget_for_feedback_vector_allocation, 1 * KB,
            "The budget in amount of bytecode executed by a function before we "
            "decide to allocate feedback vectors")
@@ -511,11 +526,20 @@ DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse common sequences of bytecodes into superinstructions")
+DEFINE_BOOL(ignition_reo_across_jumps, false,
+            "keep register equivalences across forward jumps")
+DEFINE_BOOL(trace_ignition_reo, false,
+            "print statistics of the ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_dedupe_bytecode_metadata, false,
+            "share identical constant pools and handler tables between "
+            "functions that are compiled together")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
@@ -523,6 +547,9 @@ DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
             "regenerate when actually required")
 DEFINE_BOOL(stress_lazy_source_positions, false,
             "collect lazy source positions immediately after lazy compile")
+DEFINE_BOOL(lazy_optimized_source_positions, false,
+            "skip source positions of optimized code unless a profiler needs "
+            "them, and deoptimize such code when a profiler starts")
 DEFINE_STRING(print_bytecode_filter, "*",
               "filter for selecting which functions to print bytecode")
 #ifdef V8_TRACE_IGNITION
@@ -559,6 +586,9 @@ DEFINE_BOOL(turboprop_dynamic_map_checks, false,
 DEFINE_BOOL(turboprop_as_midtier, false,
             "enable experimental turboprop mid-tier compiler")
 DEFINE_IMPLICATION(turboprop_as_midtier, turboprop)
+DEFINE_INT(max_midtier_deopts, 2,
+           "number of deopts of mid-tier code after which a function skips "
+           "the mid tier (at most 7)")
 DEFINE_IMPLICATION(turboprop, concurrent_inlining)
 DEFINE_VALUE_IMPLICATION(turboprop, interrupt_budget, 15 * KB)
 DEFINE_VALUE_IMPLICATION(turboprop, reuse_opt_code_count, 2)
@@ -569,6 +599,20 @@ DEFINE_UINT_READONLY(max_minimorphic_map_checks, 4,
 // The default of 10 is approximately the ration of TP to TF interrupt budget.
 DEFINE_INT(ticks_scale_factor_for_top_tier, 10,
            "scale factor for profiler ticks when tiering up from midtier")
+// The mid-tier compilers are cheap enough that warm functions which never get
+// hot enough for Turbofan should still leave the interpreter.
+DEFINE_INT(ticks_before_midtier_optimization, 1,
+           "number of profiler ticks before tiering up from Ignition to the "
+           "midtier")
+DEFINE_INT(midtier_bytecode_size_allowance_per_tick, 4800,
+           "bytecode size that requires one extra profiler tick before tiering "
+           "up from Ignition to the midtier")
+DEFINE_STRING(tiering_profile_in, nullptr,
+              "file listing functions to optimize on their first profiler "
+              "tick, as written by --tiering-profile-out")
+DEFINE_STRING(tiering_profile_out, nullptr,
+              "file to write the functions optimized in an isolate to when "
+              "the isolate is torn down")
 
 // Flags for concurrent recompilation.
 DEFINE_BOOL(concurrent_recompilation, true,
@@ -579,6 +623,9 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_INT(concurrent_recompilation_large_bytecode_size, 16 * KB,
+           "functions with at least this much bytecode are put in front of "
+           "the concurrent compilation queue")
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
 DEFINE_BOOL(concurrent_inlining, false,
@@ -660,6 +707,8 @@ DEFINE_BOOL(turbo_stats_nvp, false,
 DEFINE_BOOL(turbo_stats_wasm, false,
             "print TurboFan statistics of wasm compilations")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
+DEFINE_BOOL(turbo_recycle_dead_nodes, false,
+            "reuse the storage of nodes killed during graph reduction")
 DEFINE_BOOL(function_context_specialization, false,
             "enable function context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
@@ -679,6 +728,12 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_INT(max_inlined_call_polymorphism, 4,
+           "maximum number of targets inlined at a polymorphic call site "
+           "(at most 8)")
+DEFINE_BOOL(polymorphic_inlining_fallback, false,
+            "inline some targets of call sites with too many or unknown "
+            "targets, and call the others generically")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -705,14 +760,27 @@ DEFINE_BOOL(turbo_profiling_verbose, false,
             "enable basic block profiling in TurboFan, and include each "
             "function's schedule and disassembly in the output")
 DEFINE_IMPLICATION(turbo_profiling_verbose, turbo_profiling)
+DEFINE_BOOL(turbo_profiling_guided_layout, false,
+            "when optimizing a function again, defer the blocks which earlier "
+            "instrumented versions of its code rarely entered")
+DEFINE_IMPLICATION(turbo_profiling_guided_layout, turbo_profiling)
 DEFINE_BOOL(turbo_profiling_log_builtins, false,
             "emit data about basic block usage in builtins to v8.log (requires "
             "that V8 was built with v8_enable_builtins_profiling=true)")
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
+DEFINE_INT(turbo_mid_tier_regalloc_instruction_threshold, 64 * KB,
+           "use the mid-tier register allocator for functions with at least "
+           "this many instructions (0 means never)")
+DEFINE_INT(turbo_mid_tier_regalloc_virtual_register_threshold, 32 * KB,
+           "use the mid-tier register allocator for functions with at least "
+           "this many virtual registers (0 means never)")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
+DEFINE_BOOL(turbo_loop_unrolling, false,
+            "Turbofan unrolling of loops with a small constant trip count")
+DEFINE_IMPLICATION(turbo_loop_unrolling, turbo_loop_peeling)
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
@@ -720,6 +788,9 @@ DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(turbo_instruction_scheduling_by_cpu, true,
+            "enable instruction scheduling for optimized code on CPUs that "
+            "benefit from it (in-order arm64 cores)")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
@@ -735,6 +806,13 @@ DEFINE_BOOL(
 DEFINE_BOOL(turbo_fast_api_calls, false, "enable fast API calls from TurboFan")
 DEFINE_INT(reuse_opt_code_count, 0,
            "don't discard optimized code for the specified number of deopts.")
+DEFINE_BOOL(reoptimization_backoff, true,
+            "double the ticks needed to reoptimize a function for each repeated "
+            "deopt with the same reason")
+DEFINE_INT(max_repeated_uninitialized_deopts, 2,
+           "number of repeated deopts on insufficient type feedback after which "
+           "a function is optimized without bailing out on uninitialized "
+           "feedback")
 
 // Native context independent (NCI) code.
 DEFINE_BOOL(turbo_nci, false,
@@ -748,6 +826,9 @@ DEFINE_BOOL(print_nci_code, false, "print native context independent code.")
 DEFINE_BOOL(trace_turbo_nci, false, "trace native context independent code.")
 DEFINE_BOOL(turbo_collect_feedback_in_generic_lowering, true,
             "enable experimental feedback collection in generic lowering.")
+DEFINE_BOOL(turbo_inline_stub_cache_probe, true,
+            "probe the load stub cache inline for megamorphic named loads of "
+            "prototype constants in TurboFan")
 // TODO(jgruber,v8:8888): Remove this flag once we've settled on a codegen
 // strategy.
 DEFINE_BOOL(turbo_nci_delayed_codegen, true,
@@ -780,6 +861,8 @@ DEFINE_BOOL(untrusted_code_mitigations, V8_DEFAULT_UNTRUSTED_CODE_MITIGATIONS,
 DEFINE_BOOL(wasm_generic_wrapper, false,
             "use generic js-to-wasm wrapper instead of per-signature wrappers")
 DEFINE_BOOL(expose_wasm, true, "expose wasm interface to JavaScript")
+DEFINE_BOOL(wasm_lazy_js_api, false,
+            "set up the WebAssembly JS API of a context on first use")
 DEFINE_INT(wasm_num_compilation_tasks, 128,
            "maximum number of parallel compilation tasks for wasm")
 DEFINE_DEBUG_BOOL(trace_wasm_native_heap, false,
@@ -803,6 +886,17 @@ DEFINE_BOOL(wasm_tier_up, true,
             "have an effect)")
 DEFINE_BOOL(wasm_dynamic_tiering, false,
             "enable dynamic tier up to the optimizing compiler")
+// With dynamic tiering, only functions that are actually hot get compiled
+// with TurboFan; eager background tier-up of all functions is disabled.
+DEFINE_NEG_IMPLICATION(wasm_dynamic_tiering, wasm_tier_up)
+DEFINE_UINT(wasm_tiering_call_threshold, 64,
+            "number of calls of a Liftoff function before it is tiered up "
+            "with --wasm-dynamic-tiering (rounded up to a power of two)")
+DEFINE_SIZE_T(wasm_native_module_cache_budget, 0,
+              "keep the most recently used native modules (and their tiered "
+              "up code) alive in the engine-wide cache after their last "
+              "isolate dies, up to this amount of code and wire bytes (in MB, "
+              "0 to disable)")
 DEFINE_DEBUG_BOOL(trace_wasm_decoder, false, "trace decoding of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_compiler, false, "trace compiling of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_interpreter, false,
@@ -816,6 +910,9 @@ DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(experimental_liftoff_extern_ref, false,
             "enable support for externref in Liftoff")
+DEFINE_BOOL(liftoff_loop_registers, false,
+            "keep locals which are written in a loop in registers across the "
+            "loop header in Liftoff")
 // We can't tier up (from Liftoff to TurboFan) in single-threaded mode, hence
 // disable Liftoff in that configuration for now. The alternative is disabling
 // TurboFan, which would reduce peak performance considerably.
@@ -871,6 +968,9 @@ DEFINE_BOOL(wasm_opt, true, "enable wasm optimization")
 DEFINE_BOOL(
     wasm_bounds_checks, true,
     "enable bounds checks (disable for performance testing only)")
+DEFINE_BOOL(wasm_bounds_check_elimination, true,
+            "omit explicit memory bounds checks that are covered by a "
+            "preceding check of the same index")
 DEFINE_BOOL(wasm_stack_checks, true,
             "enable stack checks (disable for performance testing only)")
 DEFINE_BOOL(wasm_math_intrinsics, true,
@@ -889,12 +989,20 @@ DEFINE_BOOL(print_wasm_stub_code, false, "print WebAssembly stub code")
 DEFINE_BOOL(asm_wasm_lazy_compilation, false,
             "enable lazy compilation for asm-wasm modules")
 DEFINE_IMPLICATION(validate_asm, asm_wasm_lazy_compilation)
+DEFINE_BOOL(asm_wasm_background_compilation, false,
+            "compile lazy asm-wasm modules on background threads")
 DEFINE_BOOL(wasm_lazy_compilation, false,
             "enable lazy compilation for all wasm modules")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_background_lazy_validation, false,
+            "validate lazily compiled wasm functions on background threads "
+            "while streaming")
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "copy and relocate deserialized wasm functions only on their "
+            "first call")
 
 DEFINE_BOOL(wasm_grow_shared_memory, true,
             "allow growing shared WebAssembly memory objects")
@@ -905,6 +1013,8 @@ DEFINE_IMPLICATION(wasm_simd_post_mvp, experimental_wasm_simd)
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
+DEFINE_BOOL(wasm_reuse_freed_code_space, false,
+            "allocate new wasm code in pages decommitted by wasm code GC")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
@@ -929,6 +1039,12 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(dynamic_new_space_sizing, false,
+            "size the new space from the allocation throughput and survival "
+            "rate instead of growing it by a fixed factor")
+DEFINE_INT(new_space_target_scavenge_interval, 100,
+           "target time between scavenges (in ms) for dynamic new space "
+           "sizing")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -994,6 +1110,10 @@ DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_FLOAT(incremental_marking_target_mutator_utilization, 0.0,
+             "limit incremental marking steps on allocation such that the "
+             "mutator gets at least this fraction of each time window "
+             "(0 disables the limit)")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -1036,10 +1156,17 @@ DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_BOOL(marking_work_sharing, true,
+            "publish local marking work and split large arrays in smaller "
+            "chunks when other markers run out of work")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_INT(compaction_pause_target_ms, 0,
+           "bound the bytes evacuated by compaction so that evacuation takes "
+           "at most this many ms at the traced compaction speed (0 = fixed "
+           "evacuation quota)")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -1060,6 +1187,8 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 1 * MB,
+              "maximum size of returned zone segments that are kept for reuse")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1070,6 +1199,10 @@ DEFINE_BOOL(track_retaining_path, false,
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
 DEFINE_BOOL(concurrent_array_buffer_freeing, true,
             "free array buffer allocations on a background thread")
+DEFINE_SIZE_T(array_buffer_pool_size, 0,
+              "size in MB of freed pages kept for reuse by the default "
+              "ArrayBuffer allocator, which then allocates large backing "
+              "stores as pages (0 means malloc for all sizes)")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_GENERIC_IMPLICATION(
@@ -1096,6 +1229,15 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(huge_pages, false,
+            "advise the OS to back the pointer compression cage and the code "
+            "range with transparent huge pages (Linux only)")
+DEFINE_BOOL(short_builtin_calls, V8_TARGET_ARCH_X64,
+            "reserve the code range near the embedded builtins so that "
+            "generated code can call them with pc-relative calls")
+DEFINE_INT(cached_isolate_reservations, 4,
+           "number of pointer compression cages of disposed isolates to keep "
+           "reserved for new isolates")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(heap_growing_percent, 0,
@@ -1109,7 +1251,13 @@ DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
+DEFINE_BOOL(adaptive_bytecode_flushing, false,
+            "flush bytecode sooner when the heap is short of memory and "
+            "later when it has plenty")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
+DEFINE_BOOL(flush_optimized_code_on_memory_pressure, false,
+            "discard all optimized code on critical memory pressure")
+DEFINE_BOOL(trace_flush_optimized_code, false, "trace optimized code flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -1184,6 +1332,7 @@ DEFINE_BOOL(enable_sse4_2, true,
 DEFINE_BOOL(enable_sahf, true,
             "enable use of SAHF instruction if available (X64 only)")
 DEFINE_BOOL(enable_avx, true, "enable use of AVX instructions if available")
+DEFINE_BOOL(enable_avx2, true, "enable use of AVX2 instructions if available")
 DEFINE_BOOL(enable_fma3, true, "enable use of FMA3 instructions if available")
 DEFINE_BOOL(enable_bmi1, true, "enable use of BMI1 instructions if available")
 DEFINE_BOOL(enable_bmi2, true, "enable use of BMI2 instructions if available")
@@ -1222,12 +1371,22 @@ DEFINE_BOOL(enable_regexp_unaligned_accesses, true,
 DEFINE_BOOL(script_streaming, true, "enable parsing on background")
 DEFINE_BOOL(stress_background_compile, false,
             "stress test parsing on background")
+DEFINE_BOOL(process_wide_code_cache, false,
+            "share code caches of top-level scripts between all isolates of "
+            "the process")
+DEFINE_INT(process_wide_code_cache_size, 64 * KB,
+           "maximum size of the process-wide code cache (in kBytes)")
+DEFINE_BOOL(code_cache_optimization_hints, false,
+            "optimize functions early if they had been optimized when the "
+            "code cache they are deserialized from was created")
 DEFINE_BOOL(
     finalize_streaming_on_background, false,
     "perform the script streaming finalization on the background thread")
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
+DEFINE_INT(handle_block_retention, 4,
+           "number of unused handle blocks each isolate keeps for reuse")
 
 // bootstrapper.cc
 DEFINE_BOOL(expose_gc, false, "expose gc extension")
@@ -1299,12 +1458,19 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
+            "also compile lazy top-level functions on parallel compile tasks "
+            "ahead of their first call")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_BOOL(cpu_profiler_incremental_logging, false,
+            "log the code that predates a CPU profiler in slices instead of "
+            "all at once, holding back ticks until it has been logged")
 
 // debugger
 DEFINE_BOOL(
@@ -1337,6 +1503,8 @@ DEFINE_BOOL(heap_profiler_trace_objects, false,
             "Dump heap object allocations/movements/size_updates")
 DEFINE_BOOL(heap_profiler_use_embedder_graph, true,
             "Use the new EmbedderGraph API to get embedder nodes")
+DEFINE_BOOL(heap_snapshot_parallel, true,
+            "extract hidden heap snapshot references on worker threads")
 DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
 
@@ -1371,6 +1539,9 @@ DEFINE_BOOL(thin_strings, true, "Enable ThinString support")
 DEFINE_BOOL(trace_prototype_users, false,
             "Trace updates to prototype user tracking")
 DEFINE_BOOL(trace_for_in_enumerate, false, "Trace for-in enumerate slow-paths")
+DEFINE_BOOL(canonical_slow_to_fast_maps, false,
+            "reuse maps from the constructor's transition tree when "
+            "migrating dictionary mode objects back to fast mode")
 DEFINE_BOOL(trace_maps, false, "trace map creation")
 DEFINE_BOOL(trace_maps_details, true, "also log map details")
 DEFINE_IMPLICATION(trace_maps, log_code)
@@ -1459,6 +1630,13 @@ DEFINE_GENERIC_IMPLICATION(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "report runtime call counts and times sampled by the cpu profiler, "
+            "instead of timing every call")
+DEFINE_GENERIC_IMPLICATION(
+    runtime_call_stats_sampling,
+    TracingFlags::runtime_stats.store(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
 
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
@@ -1469,6 +1647,15 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(concurrent_snapshot_decompression, true,
+            "decompress large compressed snapshots on worker threads")
+DEFINE_BOOL(verify_snapshot_checksum, true,
+            "Verify the checksum of a startup snapshot the first time an "
+            "isolate is created from it.")
+// startup-data-util.cc
+DEFINE_BOOL(map_startup_data, true,
+            "Map the external startup snapshot file read-only instead of "
+            "copying it onto the heap.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
@@ -1494,6 +1681,10 @@ DEFINE_BOOL(trace_regexp_assembler, false,
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
 
+DEFINE_INT(regexp_results_cache_size, 1024,
+           "maximum number of entries in each of the caches for the results "
+           "of String.prototype.split and of global regexp replacements")
+
 DEFINE_BOOL(enable_experimental_regexp_engine, false,
             "recognize regexps with 'l' flag, run them on experimental engine")
 DEFINE_BOOL(default_to_experimental_regexp_engine, false,
@@ -1502,6 +1693,9 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, false,
+            "build a DFA lazily while matching with the experimental regexp "
+            "engine, for regexps without capture groups or assertions")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, true,
             "fall back to a breadth-first regexp engine on excessive "
@@ -1550,6 +1744,10 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_BOOL(reorder_builtins, false,
+            "Lay out the embedded blob so that the builtins entered most "
+            "often according to --turbo-profiling-log-file come first. "
+            "(mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
@@ -1565,6 +1763,9 @@ DEFINE_BOOL(minor_mc_parallel_marking, true,
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_INT(minor_mc_page_promotion_threshold, 70,
+           "min percentage of live bytes on a page to move it as a whole "
+           "during young generation mark compact GCs")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -1773,7 +1974,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
 DEFINE_NEG_IMPLICATION(perf_prof, wasm_write_protect_code_memory)
@@ -1839,6 +2039,9 @@ DEFINE_BOOL(interpreted_frames_native_stack, false,
 
 // elements.cc
 DEFINE_BOOL(trace_elements_transitions, false, "trace elements transitions")
+DEFINE_BOOL(trace_elements_transition_stats, false,
+            "print elements transitions by kinds and source location when "
+            "the isolate is disposed")
 
 DEFINE_BOOL(trace_creation_allocation_sites, false,
             "trace the creation of allocation sites")
@@ -34,9 +34,18 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(HeapObject object,
     if (abstract_code.IsCode()) {
       size += isolate->code_and_metadata_size();
       isolate->set_code_and_metadata_size(size);
+      Code code = abstract_code.GetCode();
+      if (CodeKindIsOptimizedJSFunction(code.kind())) {
+        // Tables that --lazy-optimized-source-positions leaves out.
+        isolate->set_optimized_code_source_positions_size(
+            isolate->optimized_code_source_positions_size() +
+            code.SourcePositionTable().Size());
+      }
     } else {
       size += isolate->bytecode_and_metadata_size();
       isolate->set_bytecode_and_metadata_size(size);
+      int bytecode_size = abstract_code.GetBytecodeArray().BytecodeArraySize();
+      isolate->set_bytecode_size(isolate->bytecode_size() + bytecode_size);
     }
 
 #ifdef DEBUG
@@ -51,6 +60,8 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(HeapObject object,
 void CodeStatistics::ResetCodeAndMetadataStatistics(Isolate* isolate) {
   isolate->set_code_and_metadata_size(0);
   isolate->set_bytecode_and_metadata_size(0);
+  isolate->set_bytecode_size(0);
+  isolate->set_optimized_code_source_positions_size(0);
   isolate->set_external_script_source_size(0);
 #ifdef DEBUG
   ResetCodeStatistics(isolate);
@@ -99,10 +110,14 @@ void CodeStatistics::ReportCodeStatistics(Isolate* isolate) {
   if (isolate->code_and_metadata_size() > 0) {
     PrintF("Code size including metadata    : %10d bytes\n",
            isolate->code_and_metadata_size());
+    PrintF("Optimized code source positions : %10d bytes\n",
+           isolate->optimized_code_source_positions_size());
   }
   if (isolate->bytecode_and_metadata_size() > 0) {
     PrintF("Bytecode size including metadata: %10d bytes\n",
            isolate->bytecode_and_metadata_size());
+    PrintF("Bytecode size                   : %10d bytes\n",
+           isolate->bytecode_size());
   }
 
   // Report code comment statistics
@@ -467,6 +467,11 @@ void ConcurrentMarking::Run(JobDelegate* delegate, unsigned mark_compact_epoch,
       marked_bytes += current_marked_bytes;
       base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes,
                                                 marked_bytes);
+      if (FLAG_marking_work_sharing) {
+        // Make locally buffered objects available to idle markers, which
+        // would otherwise see them only once a segment fills up.
+        local_marking_worklists.ShareWork();
+      }
       if (delegate->ShouldYield()) {
         TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
                      "ConcurrentMarking::Run Preempted");
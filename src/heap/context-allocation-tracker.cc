@@ -0,0 +1,146 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/context-allocation-tracker.h"
+
+#include <algorithm>
+
+#include "src/api/api-inl.h"
+#include "src/execution/isolate-inl.h"
+#include "src/handles/global-handles.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+ContextAllocationTracker::ContextAllocationTracker(Heap* heap)
+    : heap_(heap), observer_(this) {}
+
+ContextAllocationTracker::~ContextAllocationTracker() {
+  StopObserving();
+  for (auto& entry : entries_) {
+    if (entry->location != nullptr) GlobalHandles::Destroy(entry->location);
+  }
+}
+
+void ContextAllocationTracker::SetBudget(Handle<NativeContext> context,
+                                         size_t budget) {
+  RemoveDeadEntries();
+  auto it = std::find_if(entries_.begin(), entries_.end(),
+                         [&context](const std::unique_ptr<Entry>& entry) {
+                           return *entry->location == context->ptr();
+                         });
+  if (budget == 0) {
+    if (it != entries_.end()) {
+      GlobalHandles::Destroy((*it)->location);
+      entries_.erase(it);
+    }
+    if (entries_.empty()) StopObserving();
+    return;
+  }
+  if (it == entries_.end()) {
+    Handle<Object> global =
+        heap_->isolate()->global_handles()->Create(*context);
+    entries_.push_back(
+        std::make_unique<Entry>(Entry{global.location(), 0, 0, false, false}));
+    GlobalHandles::MakeWeak(&entries_.back()->location);
+    it = entries_.end() - 1;
+  }
+  Entry* entry = it->get();
+  entry->budget = budget;
+  entry->allocated = 0;
+  entry->exceeded = false;
+  entry->pending = false;
+  StartObserving();
+}
+
+void ContextAllocationTracker::SetCallback(
+    v8::ContextAllocationBudgetCallback callback, void* data) {
+  callback_ = callback;
+  callback_data_ = data;
+}
+
+size_t ContextAllocationTracker::AllocatedBytes(NativeContext context) const {
+  for (auto& entry : entries_) {
+    if (entry->location != nullptr && *entry->location == context.ptr()) {
+      return entry->allocated;
+    }
+  }
+  return 0;
+}
+
+void ContextAllocationTracker::Step(int bytes_allocated) {
+  Isolate* isolate = heap_->isolate();
+  Context context = isolate->context();
+  if (context.is_null()) return;
+  const Address native_context = context.native_context().ptr();
+  for (auto& entry : entries_) {
+    if (entry->location == nullptr || *entry->location != native_context) {
+      continue;
+    }
+    entry->allocated += bytes_allocated;
+    if (!entry->exceeded && entry->allocated > entry->budget) {
+      entry->exceeded = true;
+      entry->pending = true;
+      // The embedder may run arbitrary code in the callback, which is not
+      // possible during allocation.
+      if (callback_ != nullptr && !interrupt_requested_) {
+        interrupt_requested_ = true;
+        isolate->RequestInterrupt(&InvokeCallback, this);
+      }
+    }
+    return;
+  }
+}
+
+void ContextAllocationTracker::StartObserving() {
+  if (observing_) return;
+  heap_->AddAllocationObserversToAllSpaces(&observer_, &observer_);
+  observing_ = true;
+}
+
+void ContextAllocationTracker::StopObserving() {
+  if (!observing_) return;
+  heap_->RemoveAllocationObserversFromAllSpaces(&observer_, &observer_);
+  observing_ = false;
+}
+
+void ContextAllocationTracker::RemoveDeadEntries() {
+  entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                [](const std::unique_ptr<Entry>& entry) {
+                                  return entry->location == nullptr;
+                                }),
+                 entries_.end());
+}
+
+// static
+void ContextAllocationTracker::InvokeCallback(v8::Isolate* isolate,
+                                              void* data) {
+  reinterpret_cast<ContextAllocationTracker*>(data)->NotifyExceededBudgets();
+}
+
+void ContextAllocationTracker::NotifyExceededBudgets() {
+  interrupt_requested_ = false;
+  RemoveDeadEntries();
+  if (entries_.empty()) StopObserving();
+  if (callback_ == nullptr) return;
+  Isolate* isolate = heap_->isolate();
+  HandleScope scope(isolate);
+  // The callback may change budgets, so collect the contexts first.
+  std::vector<std::pair<Handle<NativeContext>, size_t>> exceeded;
+  for (auto& entry : entries_) {
+    if (!entry->pending) continue;
+    entry->pending = false;
+    exceeded.emplace_back(handle(NativeContext::cast(Object(*entry->location)),
+                                 isolate),
+                          entry->allocated);
+  }
+  for (auto& context_and_bytes : exceeded) {
+    callback_(Utils::ToLocal(Handle<Context>::cast(context_and_bytes.first)),
+              context_and_bytes.second, callback_data_);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,91 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
+#define V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
+
+#include <memory>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/common/globals.h"
+#include "src/heap/allocation-observer.h"
+#include "src/objects/contexts.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Accounts the bytes allocated while a native context with an allocation
+// budget is the current context and notifies the embedder once a context
+// exceeds its budget. Allocations are attributed at the granularity of
+// allocation observer steps, i.e. when linear allocation areas are refilled.
+class ContextAllocationTracker {
+ public:
+  explicit ContextAllocationTracker(Heap* heap);
+  ~ContextAllocationTracker();
+
+  // Sets the budget of |context| and resets its accounted bytes. A budget of
+  // 0 stops tracking |context|.
+  void SetBudget(Handle<NativeContext> context, size_t budget);
+
+  void SetCallback(v8::ContextAllocationBudgetCallback callback, void* data);
+
+  // Returns the accounted bytes of |context| or 0 if it is not tracked.
+  size_t AllocatedBytes(NativeContext context) const;
+
+ private:
+  static const intptr_t kStepSize = 64 * KB;
+
+  class Observer final : public AllocationObserver {
+   public:
+    explicit Observer(ContextAllocationTracker* tracker)
+        : AllocationObserver(kStepSize), tracker_(tracker) {}
+
+    void Step(int bytes_allocated, Address, size_t) override {
+      tracker_->Step(bytes_allocated);
+    }
+
+   private:
+    ContextAllocationTracker* const tracker_;
+  };
+
+  struct Entry {
+    // Weak global handle that is reset when the context dies.
+    Address* location;
+    size_t budget;
+    size_t allocated;
+    // Set once the budget was exceeded, until the budget is set again.
+    bool exceeded;
+    // Set while the callback for the exceeded budget is outstanding.
+    bool pending;
+  };
+
+  void Step(int bytes_allocated);
+  void StartObserving();
+  void StopObserving();
+  // Removes entries of contexts that died.
+  void RemoveDeadEntries();
+
+  static void InvokeCallback(v8::Isolate* isolate, void* data);
+  void NotifyExceededBudgets();
+
+  Heap* const heap_;
+  Observer observer_;
+  bool observing_ = false;
+  bool interrupt_requested_ = false;
+  v8::ContextAllocationBudgetCallback callback_ = nullptr;
+  void* callback_data_ = nullptr;
+  // Entries are heap allocated as the global handles refer to their
+  // |location| field.
+  std::vector<std::unique_ptr<Entry>> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(ContextAllocationTracker);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
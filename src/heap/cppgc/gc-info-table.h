@@ -25,6 +25,8 @@ struct GCInfo final {
   TraceCallback trace;
   NameCallback name;
   bool has_v_table;
+  // Whether |finalize| may be invoked on a background thread.
+  bool concurrently_finalizable;
 };
 
 class V8_EXPORT GCInfoTable final {
@@ -11,10 +11,11 @@ namespace internal {
 
 RegisteredGCInfoIndex::RegisteredGCInfoIndex(
     FinalizationCallback finalization_callback, TraceCallback trace_callback,
-    NameCallback name_callback, bool has_v_table)
+    NameCallback name_callback, bool has_v_table,
+    bool concurrently_finalizable)
     : index_(GlobalGCInfoTable::GetMutable().RegisterNewGCInfo(
-          {finalization_callback, trace_callback, name_callback,
-           has_v_table})) {}
+          {finalization_callback, trace_callback, name_callback, has_v_table,
+           concurrently_finalizable})) {}
 
 }  // namespace internal
 }  // namespace cppgc
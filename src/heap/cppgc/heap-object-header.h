@@ -93,6 +93,8 @@ class HeapObjectHeader {
   bool IsFree() const;
 
   inline bool IsFinalizable() const;
+  // Returns whether the finalizer may run on the concurrent sweeper.
+  inline bool IsConcurrentlyFinalizable() const;
   void Finalize();
 
   V8_EXPORT_PRIVATE HeapObjectName GetName() const;
@@ -257,6 +259,11 @@ bool HeapObjectHeader::IsFinalizable() const {
   return gc_info.finalize;
 }
 
+bool HeapObjectHeader::IsConcurrentlyFinalizable() const {
+  const GCInfo& gc_info = GlobalGCInfoTable::GCInfoFromIndex(GetGCInfoIndex());
+  return gc_info.concurrently_finalizable;
+}
+
 template <AccessMode mode, HeapObjectHeader::EncodedHalf part,
           std::memory_order memory_order>
 uint16_t HeapObjectHeader::LoadEncoded() const {
@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "include/cppgc/internal/pointer-policies.h"
 #include "include/cppgc/internal/process-heap.h"
 #include "include/cppgc/platform.h"
 #include "src/heap/cppgc/heap-object-header.h"
@@ -67,9 +68,11 @@ void VisitRememberedSlots(HeapBase& heap,
     // top level (with the guarantee that no objects are currently being in
     // construction). This can be ensured by running young GCs from safe points
     // or by reintroducing nested allocation scopes that avoid finalization.
-    DCHECK(!header.IsInConstruction<AccessMode::kNonAtomic>());
+    DCHECK(!slot_header.IsInConstruction<AccessMode::kNonAtomic>());
 
     void* value = *reinterpret_cast<void**>(slot);
+    // The slot may have been cleared after the barrier recorded it.
+    if (!value || value == kSentinelPointer) continue;
     mutator_marking_state.DynamicallyMarkAddress(static_cast<Address>(value));
   }
 #endif
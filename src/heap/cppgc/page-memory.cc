@@ -165,6 +165,34 @@ std::pair<NormalPageMemoryRegion*, Address> NormalPageMemoryPool::Take(
   return pair;
 }
 
+// static
+constexpr size_t LargePageMemoryPool::kMaxPooledSize;
+// static
+constexpr size_t LargePageMemoryPool::kNumSizeClasses;
+// static
+constexpr size_t LargePageMemoryPool::kMaxRegionsPerSizeClass;
+// static
+constexpr size_t LargePageMemoryPool::kNotPooled;
+
+LargePageMemoryPool::LargePageMemoryPool() = default;
+
+LargePageMemoryPool::~LargePageMemoryPool() = default;
+
+bool LargePageMemoryPool::Add(size_t size_class, LargePageMemoryRegion* pmr) {
+  DCHECK_LT(size_class, kNumSizeClasses);
+  if (pool_[size_class].size() >= kMaxRegionsPerSizeClass) return false;
+  pool_[size_class].push_back(pmr);
+  return true;
+}
+
+LargePageMemoryRegion* LargePageMemoryPool::Take(size_t size_class) {
+  DCHECK_LT(size_class, kNumSizeClasses);
+  if (pool_[size_class].empty()) return nullptr;
+  LargePageMemoryRegion* pmr = pool_[size_class].back();
+  pool_[size_class].pop_back();
+  return pmr;
+}
+
 PageBackend::PageBackend(PageAllocator* allocator) : allocator_(allocator) {}
 
 PageBackend::~PageBackend() = default;
@@ -193,6 +221,17 @@ void PageBackend::FreeNormalPageMemory(size_t bucket, Address writeable_base) {
 }
 
 Address PageBackend::AllocateLargePageMemory(size_t size) {
+  const size_t size_class = LargePageMemoryPool::SizeClass(size);
+  if (size_class != LargePageMemoryPool::kNotPooled) {
+    if (LargePageMemoryRegion* pooled = large_page_pool_.Take(size_class)) {
+      const PageMemory pm = pooled->GetPageMemory();
+      Unprotect(allocator_, pm);
+      page_memory_region_tree_.Add(pooled);
+      return pm.writeable_region().base();
+    }
+    // Reserve the full size class to allow reuse for any size in the class.
+    size = LargePageMemoryPool::SizeClassSize(size_class);
+  }
   auto pmr = std::make_unique<LargePageMemoryRegion>(allocator_, size);
   const PageMemory pm = pmr->GetPageMemory();
   Unprotect(allocator_, pm);
@@ -202,8 +241,19 @@ Address PageBackend::AllocateLargePageMemory(size_t size) {
 }
 
 void PageBackend::FreeLargePageMemory(Address writeable_base) {
-  PageMemoryRegion* pmr = page_memory_region_tree_.Lookup(writeable_base);
+  auto* pmr = static_cast<LargePageMemoryRegion*>(
+      page_memory_region_tree_.Lookup(writeable_base));
   page_memory_region_tree_.Remove(pmr);
+  const PageMemory pm = pmr->GetPageMemory();
+  const size_t size_class =
+      LargePageMemoryPool::SizeClassForRegion(pm.writeable_region().size());
+  // Pooled regions are protected which also discards their memory. They are
+  // removed from the region tree to avoid conservative lookups finding them.
+  if (size_class != LargePageMemoryPool::kNotPooled &&
+      large_page_pool_.Add(size_class, pmr)) {
+    Protect(allocator_, pm);
+    return;
+  }
   auto size = large_page_memory_regions_.erase(pmr);
   USE(size);
   DCHECK_EQ(1u, size);
@@ -187,6 +187,50 @@ class V8_EXPORT_PRIVATE NormalPageMemoryPool final {
   std::vector<Result> pool_[kNumPoolBuckets];
 };
 
+// A pool of LargePageMemoryRegions that are currently not in use. Regions are
+// binned by size classes of kPageSize granularity, which allows reusing the
+// reservation for medium-sized large objects instead of mapping and unmapping
+// memory for each of them.
+//
+// The pool does not keep its elements alive but merely provides pooling
+// capabilities.
+class V8_EXPORT_PRIVATE LargePageMemoryPool final {
+ public:
+  // Largest object payload (including the page header) that is pooled.
+  static constexpr size_t kMaxPooledSize = 1 * kMB;
+  static constexpr size_t kNumSizeClasses = kMaxPooledSize / kPageSize;
+  static constexpr size_t kMaxRegionsPerSizeClass = 4;
+  static constexpr size_t kNotPooled = kNumSizeClasses;
+
+  // Returns the size class for a large page of |size| bytes or kNotPooled.
+  static size_t SizeClass(size_t size) {
+    if (size > kMaxPooledSize) return kNotPooled;
+    return (RoundUp(size, kPageSize) >> kPageSizeLog2) - 1;
+  }
+  // Returns the size class that a region with |writeable_size| bytes can
+  // serve or kNotPooled.
+  static size_t SizeClassForRegion(size_t writeable_size) {
+    if (writeable_size < kPageSize) return kNotPooled;
+    const size_t size_class = (writeable_size >> kPageSizeLog2) - 1;
+    return size_class < kNumSizeClasses ? size_class : kNotPooled;
+  }
+  // Returns the size of memory that is provided for |size_class|.
+  static size_t SizeClassSize(size_t size_class) {
+    DCHECK_LT(size_class, kNumSizeClasses);
+    return (size_class + 1) * kPageSize;
+  }
+
+  LargePageMemoryPool();
+  ~LargePageMemoryPool();
+
+  // Returns false if the size class is already at capacity.
+  bool Add(size_t, LargePageMemoryRegion*);
+  LargePageMemoryRegion* Take(size_t);
+
+ private:
+  std::vector<LargePageMemoryRegion*> pool_[kNumSizeClasses];
+};
+
 // A backend that is used for allocating and freeing normal and large pages.
 //
 // Internally maintaints a set of PageMemoryRegions. The backend keeps its used
@@ -225,6 +269,7 @@ class V8_EXPORT_PRIVATE PageBackend final {
  private:
   PageAllocator* allocator_;
   NormalPageMemoryPool page_pool_;
+  LargePageMemoryPool large_page_pool_;
   PageMemoryRegionTree page_memory_region_tree_;
   std::vector<std::unique_ptr<PageMemoryRegion>> normal_page_memory_regions_;
   std::unordered_map<PageMemoryRegion*, std::unique_ptr<PageMemoryRegion>>
@@ -109,6 +109,11 @@ const StatsCollector::Event& StatsCollector::NotifySweepingCompleted() {
   return previous_;
 }
 
+void StatsCollector::AddMainThreadSweepingTime(v8::base::TimeDelta time) {
+  DCHECK_EQ(GarbageCollectionState::kSweeping, gc_state_);
+  current_.main_thread_sweeping_time += time;
+}
+
 size_t StatsCollector::allocated_object_size() const {
   // During sweeping we refer to the current Event as that already holds the
   // correct marking information. In all other phases, the previous event holds
@@ -26,6 +26,9 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   struct Event final {
     // Marked bytes collected during marking.
     size_t marked_bytes = 0;
+    // Time spent on the mutator thread for sweeping and finalization. Does not
+    // include time spent by the concurrent sweeper.
+    v8::base::TimeDelta main_thread_sweeping_time;
   };
 
   // Observer for allocated object size. May be used to implement heap growing
@@ -75,6 +78,8 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Indicates the end of a garbage collection cycle. This means that sweeping
   // is finished at this point.
   const Event& NotifySweepingCompleted();
+  // Accounts time spent sweeping on the mutator thread to the current cycle.
+  void AddMainThreadSweepingTime(v8::base::TimeDelta);
 
   // Size of live objects in bytes  on the heap. Based on the most recent marked
   // bytes and the bytes allocated since last marking.
@@ -149,11 +149,16 @@ class DeferredFinalizationBuilder final {
   explicit DeferredFinalizationBuilder(BasePage* page) { result_.page = page; }
 
   void AddFinalizer(HeapObjectHeader* header, size_t size) {
-    if (header->IsFinalizable()) {
+    if (!header->IsFinalizable()) {
+      SET_MEMORY_INACCESSIBLE(header, size);
+    } else if (header->IsConcurrentlyFinalizable()) {
+      // Objects with concurrency-safe finalizers are finalized right away,
+      // which keeps their memory in the cached free list.
+      header->Finalize();
+      SET_MEMORY_INACCESSIBLE(header, size);
+    } else {
       result_.unfinalized_objects.push_back({header});
       found_finalizer_ = true;
-    } else {
-      SET_MEMORY_INACCESSIBLE(header, size);
     }
   }
 
@@ -425,7 +430,8 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
       page->space()->AddPage(page);
       return true;
     }
-    if (!header->IsFinalizable()) {
+    if (!header->IsFinalizable() || header->IsConcurrentlyFinalizable()) {
+      header->Finalize();
       LargePage::Destroy(page);
       return true;
     }
@@ -527,6 +533,7 @@ class Sweeper::SweeperImpl final {
 
   void Finish() {
     DCHECK(is_in_progress_);
+    const v8::base::TimeTicks start = v8::base::TimeTicks::Now();
 
     // First, call finalizers on the mutator thread.
     SweepFinalizer finalizer(platform_);
@@ -541,6 +548,8 @@ class Sweeper::SweeperImpl final {
 
     is_in_progress_ = false;
 
+    stats_collector_->AddMainThreadSweepingTime(v8::base::TimeTicks::Now() -
+                                                start);
     stats_collector_->NotifySweepingCompleted();
   }
 
@@ -567,6 +576,7 @@ class Sweeper::SweeperImpl final {
     void Run(double deadline_in_seconds) override {
       if (handle_.IsCanceled() || !sweeper_->is_in_progress_) return;
 
+      const v8::base::TimeTicks start = v8::base::TimeTicks::Now();
       MutatorThreadSweeper sweeper(&sweeper_->space_states_,
                                    sweeper_->platform_);
       const bool sweep_complete =
@@ -577,6 +587,8 @@ class Sweeper::SweeperImpl final {
       } else {
         sweeper_->ScheduleIncrementalSweeping();
       }
+      sweeper_->stats_collector_->AddMainThreadSweepingTime(
+          v8::base::TimeTicks::Now() - start);
     }
 
     Handle GetHandle() const { return handle_; }
@@ -2904,8 +2904,14 @@ V8_INLINE int NumberToStringCacheHash(Handle<FixedArray> cache, Smi number) {
 
 V8_INLINE int NumberToStringCacheHash(Handle<FixedArray> cache, double number) {
   int mask = (cache->length() >> 1) - 1;
-  int64_t bits = bit_cast<int64_t>(number);
-  return (static_cast<int>(bits) ^ static_cast<int>(bits >> 32)) & mask;
+  uint64_t bits = bit_cast<uint64_t>(number);
+  uint32_t hash =
+      static_cast<uint32_t>(bits) ^ static_cast<uint32_t>(bits >> 32);
+  // Fold in the exponent and the upper significand bits, otherwise doubles
+  // with short binary fractions (like 1.5, 2.5, ...) all share an entry.
+  // Keep in sync with CodeStubAssembler::NumberToString.
+  hash ^= hash >> 16;
+  return static_cast<int>(hash) & mask;
 }
 
 V8_INLINE Handle<String> CharToString(Factory* factory, const char* string,
@@ -35,13 +35,8 @@ void FinalizationRegistryCleanupTask::SlowAssertNoActiveJavaScript() {
 #endif  // ENABLE_SLOW_DCHECKS
 }
 
-void FinalizationRegistryCleanupTask::RunInternal() {
+bool FinalizationRegistryCleanupTask::CleanupOneFinalizationRegistry() {
   Isolate* isolate = heap_->isolate();
-  SlowAssertNoActiveJavaScript();
-
-  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
-                                "V8.FinalizationRegistryCleanupTask");
-
   HandleScope handle_scope(isolate);
   Handle<JSFinalizationRegistry> finalization_registry;
   // There could be no dirty FinalizationRegistries. When a context is disposed
@@ -49,7 +44,7 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // list.
   if (!heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
           &finalization_registry)) {
-    return;
+    return false;
   }
   finalization_registry->set_scheduled_for_cleanup(false);
 
@@ -70,8 +65,6 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // after an exception so the host can perform a microtask checkpoint. In case
   // of exception, check if the FinalizationRegistry still needs cleanup
   // and should be requeued.
-  //
-  // TODO(syg): Implement better scheduling for finalizers.
   InvokeFinalizationRegistryCleanupFromTask(context, finalization_registry,
                                             callback);
   if (finalization_registry->NeedsCleanup() &&
@@ -79,6 +72,24 @@ void FinalizationRegistryCleanupTask::RunInternal() {
     auto nop = [](HeapObject, ObjectSlot, Object) {};
     heap_->EnqueueDirtyJSFinalizationRegistry(*finalization_registry, nop);
   }
+  return !catcher.HasCaught() && !catcher.HasTerminated() &&
+         !isolate->has_scheduled_exception();
+}
+
+void FinalizationRegistryCleanupTask::RunInternal() {
+  Isolate* isolate = heap_->isolate();
+  SlowAssertNoActiveJavaScript();
+
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
+                                "V8.FinalizationRegistryCleanupTask");
+
+  // Clean up dirty FinalizationRegistries until the list is empty or the time
+  // budget is used up, instead of paying for one task per registry.
+  const double deadline_in_ms =
+      heap_->MonotonicallyIncreasingTimeInMs() + kTimeBudgetInMs;
+  while (CleanupOneFinalizationRegistry() &&
+         heap_->MonotonicallyIncreasingTimeInMs() < deadline_in_ms) {
+  }
 
   // Repost if there are remaining dirty FinalizationRegistries.
   heap_->set_is_finalization_registry_cleanup_task_posted(false);
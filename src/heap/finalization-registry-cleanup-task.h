@@ -12,8 +12,10 @@ namespace v8 {
 namespace internal {
 
 // The GC schedules a cleanup task when the dirty FinalizationRegistry list is
-// non-empty. The task processes a single FinalizationRegistry and posts another
-// cleanup task if there are remaining dirty FinalizationRegistries on the list.
+// non-empty. The task processes dirty FinalizationRegistries until the list is
+// empty, a cleanup callback throws, or its time budget runs out, and posts
+// another cleanup task if there are remaining dirty FinalizationRegistries on
+// the list.
 class FinalizationRegistryCleanupTask : public CancelableTask {
  public:
   explicit FinalizationRegistryCleanupTask(Heap* heap);
@@ -23,8 +25,12 @@ class FinalizationRegistryCleanupTask : public CancelableTask {
   void operator=(const FinalizationRegistryCleanupTask&) = delete;
 
  private:
+  static constexpr double kTimeBudgetInMs = 1.0;
+
   void RunInternal() override;
   void SlowAssertNoActiveJavaScript();
+  // Returns whether the task may go on with the next dirty registry.
+  bool CleanupOneFinalizationRegistry();
 
   Heap* heap_;
 };
@@ -38,6 +38,19 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
   // Maximum marking step size returned by EstimateMarkingStepSize.
   static const size_t kMaximumMarkingStepSize = 700 * MB;
 
+  // If we haven't recorded any final incremental mark-compact events yet, we
+  // use a conservative lower bound for the final mark-compact speed.
+  static const size_t kInitialConservativeFinalIncrementalMarkCompactSpeed =
+      2 * MB;
+
+  // Maximum final incremental mark-compact time returned by
+  // EstimateFinalIncrementalMarkCompactTime.
+  static const size_t kMaxFinalIncrementalMarkCompactTimeInMs = 1000;
+
+  // If we haven't recorded any scavenger events yet, we use a conservative
+  // lower bound for the scavenger speed.
+  static const size_t kInitialConservativeScavengeSpeed = 100 * KB;
+
   // We have to make sure that we finish the IdleNotification before
   // idle_time_in_ms. Hence, we conservatively prune our workload estimate.
   static const double kConservativeTimeRatio;
@@ -64,6 +77,9 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
   static double EstimateFinalIncrementalMarkCompactTime(
       size_t size_of_objects, double mark_compact_speed_in_bytes_per_ms);
 
+  static double EstimateScavengeTime(size_t new_space_size,
+                                     double scavenge_speed_in_bytes_per_ms);
+
   static bool ShouldDoContextDisposalMarkCompact(int context_disposed,
                                                  double contexts_disposal_rate,
                                                  size_t size_of_objects);
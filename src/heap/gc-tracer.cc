@@ -12,6 +12,7 @@
 #include "src/heap/incremental-marking.h"
 #include "src/heap/spaces.h"
 #include "src/logging/counters-inl.h"
+#include "src/logging/metrics.h"
 
 namespace v8 {
 namespace internal {
@@ -26,6 +27,33 @@ static size_t CountTotalHolesSize(Heap* heap) {
   }
   return holes_size;
 }
+
+namespace {
+
+// Incremental marking steps are reported once this many have accumulated.
+const size_t kMaxBatchedIncrementalMarkEvents = 16;
+
+int64_t MillisecondsToMicroseconds(double ms) {
+  return static_cast<int64_t>(ms * base::Time::kMicrosecondsPerMillisecond);
+}
+
+v8::metrics::Recorder::ContextId GetContextId(Isolate* isolate) {
+  if (isolate->context().is_null()) {
+    return v8::metrics::Recorder::ContextId::Empty();
+  }
+  HandleScope scope(isolate);
+  return isolate->GetOrRegisterRecorderContextId(isolate->native_context());
+}
+
+v8::metrics::GarbageCollectionSizes MakeSizes(size_t before, size_t after) {
+  v8::metrics::GarbageCollectionSizes sizes;
+  sizes.bytes_before = static_cast<int64_t>(before);
+  sizes.bytes_after = static_cast<int64_t>(after);
+  sizes.bytes_freed = sizes.bytes_before - sizes.bytes_after;
+  return sizes;
+}
+
+}  // namespace
 WorkerThreadRuntimeCallStats* GCTracer::worker_thread_runtime_call_stats() {
   return heap_->isolate()->counters()->worker_thread_runtime_call_stats();
 }
@@ -126,7 +154,8 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
       young_object_size(0),
       survived_young_object_size(0),
       incremental_marking_bytes(0),
-      incremental_marking_duration(0.0) {
+      incremental_marking_duration(0.0),
+      concurrent_marking_bytes(0) {
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
@@ -186,6 +215,7 @@ void GCTracer::ResetForTesting() {
   current_.end_time = heap_->MonotonicallyIncreasingTimeInMs();
   previous_ = current_;
   ResetIncrementalMarkingCounters();
+  incremental_mark_batched_events_.events.clear();
   allocation_time_ms_ = 0.0;
   new_space_allocation_counter_bytes_ = 0.0;
   old_generation_allocation_counter_bytes_ = 0.0;
@@ -198,6 +228,7 @@ void GCTracer::ResetForTesting() {
   recorded_compactions_.Reset();
   recorded_mark_compacts_.Reset();
   recorded_incremental_mark_compacts_.Reset();
+  recorded_concurrent_marking_.Reset();
   recorded_new_generation_allocations_.Reset();
   recorded_old_generation_allocations_.Reset();
   recorded_embedder_generation_allocations_.Reset();
@@ -221,6 +252,12 @@ void GCTracer::NotifyYoungGenerationHandling(
       static_cast<int>(young_generation_handling));
 }
 
+void GCTracer::NotifyYoungGenerationPageStats(
+    const YoungGenerationPageStats& stats) {
+  DCHECK_EQ(Event::MINOR_MARK_COMPACTOR, current_.type);
+  current_.young_page_stats = stats;
+}
+
 void GCTracer::Start(GarbageCollector collector,
                      GarbageCollectionReason gc_reason,
                      const char* collector_reason) {
@@ -355,6 +392,9 @@ void GCTracer::Stop(GarbageCollector collector) {
       ResetIncrementalMarkingCounters();
       combined_mark_compact_speed_cache_ = 0.0;
       FetchBackgroundMarkCompactCounters();
+      RecordConcurrentMarkingSpeed(
+          current_.concurrent_marking_bytes,
+          current_.scopes[Scope::MC_BACKGROUND_MARKING]);
       break;
     case Event::MARK_COMPACTOR:
       DCHECK_EQ(0u, current_.incremental_marking_bytes);
@@ -367,12 +407,22 @@ void GCTracer::Stop(GarbageCollector collector) {
       ResetIncrementalMarkingCounters();
       combined_mark_compact_speed_cache_ = 0.0;
       FetchBackgroundMarkCompactCounters();
+      RecordConcurrentMarkingSpeed(
+          current_.concurrent_marking_bytes,
+          current_.scopes[Scope::MC_BACKGROUND_MARKING]);
       break;
     case Event::START:
       UNREACHABLE();
   }
   FetchBackgroundGeneralCounters();
 
+  if (current_.type == Event::SCAVENGER ||
+      current_.type == Event::MINOR_MARK_COMPACTOR) {
+    ReportYoungCycleToRecorder();
+  } else {
+    ReportFullCycleToRecorder();
+  }
+
   heap_->UpdateTotalGCTime(duration);
 
   if ((current_.type == Event::SCAVENGER ||
@@ -486,6 +536,18 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
     incremental_marking_bytes_ += bytes;
     incremental_marking_duration_ += duration;
   }
+  if (!heap_->isolate()->metrics_recorder()->HasEmbedderRecorder()) return;
+  v8::metrics::GarbageCollectionFullMainThreadIncrementalMark event;
+  event.wall_clock_duration_in_us = MillisecondsToMicroseconds(duration);
+  incremental_mark_batched_events_.events.push_back(event);
+  if (incremental_mark_batched_events_.events.size() >=
+      kMaxBatchedIncrementalMarkEvents) {
+    FlushBatchedIncrementalEvents();
+  }
+}
+
+void GCTracer::AddConcurrentMarkingBytes(size_t bytes) {
+  current_.concurrent_marking_bytes += bytes;
 }
 
 void GCTracer::Output(const char* format, ...) const {
@@ -678,7 +740,13 @@ void GCTracer::PrintNVP() const {
           "background.store_buffer=%.2f "
           "background.unmapper=%.2f "
           "update_marking_deque=%.2f "
-          "reset_liveness=%.2f\n",
+          "reset_liveness=%.2f "
+          "pages_promoted=%zu "
+          "pages_moved=%zu "
+          "pages_evacuated=%zu "
+          "promoted_in_place=%zu "
+          "moved_in_place=%zu "
+          "evacuated=%zu\n",
           duration, spent_in_mutator, "mmc", current_.reduce_memory,
           current_.scopes[Scope::MINOR_MC],
           current_.scopes[Scope::MINOR_MC_SWEEPING],
@@ -704,7 +772,13 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::BACKGROUND_STORE_BUFFER],
           current_.scopes[Scope::BACKGROUND_UNMAPPER],
           current_.scopes[Scope::MINOR_MC_MARKING_DEQUE],
-          current_.scopes[Scope::MINOR_MC_RESET_LIVENESS]);
+          current_.scopes[Scope::MINOR_MC_RESET_LIVENESS],
+          current_.young_page_stats.promoted_pages,
+          current_.young_page_stats.moved_pages,
+          current_.young_page_stats.evacuated_pages,
+          current_.young_page_stats.promoted_bytes,
+          current_.young_page_stats.moved_bytes,
+          current_.young_page_stats.evacuated_bytes);
       break;
     case Event::MARK_COMPACTOR:
     case Event::INCREMENTAL_MARK_COMPACTOR:
@@ -782,6 +856,7 @@ void GCTracer::PrintNVP() const {
           "incremental_steps_count=%d "
           "incremental_marking_throughput=%.f "
           "incremental_walltime_duration=%.f "
+          "concurrent_marking_throughput=%.f "
           "background.mark=%.1f "
           "background.sweep=%.1f "
           "background.evacuate.copy=%.1f "
@@ -884,6 +959,7 @@ void GCTracer::PrintNVP() const {
           current_.incremental_marking_scopes[Scope::MC_INCREMENTAL].steps,
           IncrementalMarkingSpeedInBytesPerMillisecond(),
           incremental_walltime_duration,
+          ConcurrentMarkingSpeedInBytesPerMillisecond(),
           current_.scopes[Scope::MC_BACKGROUND_MARKING],
           current_.scopes[Scope::MC_BACKGROUND_SWEEPING],
           current_.scopes[Scope::MC_BACKGROUND_EVACUATE_COPY],
@@ -935,6 +1011,11 @@ double GCTracer::AverageSpeed(
   return AverageSpeed(buffer, MakeBytesAndDuration(0, 0), 0);
 }
 
+void GCTracer::RecordConcurrentMarkingSpeed(size_t bytes, double duration) {
+  if (duration == 0 || bytes == 0) return;
+  recorded_concurrent_marking_.Push(MakeBytesAndDuration(bytes, duration));
+}
+
 void GCTracer::RecordIncrementalMarkingSpeed(size_t bytes, double duration) {
   if (duration == 0 || bytes == 0) return;
   double current_speed = bytes / duration;
@@ -1031,6 +1112,10 @@ double GCTracer::ScavengeSpeedInBytesPerMillisecond(
   }
 }
 
+double GCTracer::ConcurrentMarkingSpeedInBytesPerMillisecond() const {
+  return AverageSpeed(recorded_concurrent_marking_);
+}
+
 double GCTracer::CompactionSpeedInBytesPerMillisecond() const {
   return AverageSpeed(recorded_compactions_);
 }
@@ -1178,6 +1263,103 @@ void GCTracer::FetchBackgroundGeneralCounters() {
                           BackgroundScope::LAST_GENERAL_BACKGROUND_SCOPE);
 }
 
+void GCTracer::FlushBatchedIncrementalEvents() {
+  if (incremental_mark_batched_events_.events.empty()) return;
+  Isolate* isolate = heap_->isolate();
+  isolate->metrics_recorder()->AddMainThreadEvent(
+      incremental_mark_batched_events_, GetContextId(isolate));
+  incremental_mark_batched_events_.events.clear();
+}
+
+void GCTracer::ReportFullCycleToRecorder() {
+  Isolate* isolate = heap_->isolate();
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  FlushBatchedIncrementalEvents();
+
+  v8::metrics::GarbageCollectionFullCycle event;
+  event.reason = static_cast<int>(current_.gc_reason);
+
+  // Atomic pause.
+  event.main_thread_atomic.mark_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(current_.scopes[Scope::MC_MARK]);
+  event.main_thread_atomic.weak_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(current_.scopes[Scope::MC_CLEAR]);
+  event.main_thread_atomic.compact_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(current_.scopes[Scope::MC_EVACUATE]);
+  event.main_thread_atomic.sweep_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(current_.scopes[Scope::MC_SWEEP]);
+
+  // Incremental work on the main thread. The incremental scopes are only
+  // populated for incremental cycles and are zero otherwise.
+  const double incremental_marking =
+      current_.scopes[Scope::MC_INCREMENTAL_LAYOUT_CHANGE] +
+      current_.scopes[Scope::MC_INCREMENTAL_START] +
+      current_.incremental_marking_duration +
+      current_.scopes[Scope::MC_INCREMENTAL_FINALIZE];
+  const double incremental_sweeping =
+      current_.scopes[Scope::MC_INCREMENTAL_SWEEPING];
+  event.main_thread_incremental_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(incremental_marking + incremental_sweeping);
+
+  const double main_thread_mark =
+      current_.scopes[Scope::MC_MARK] + incremental_marking;
+  const double main_thread_sweep =
+      current_.scopes[Scope::MC_SWEEP] + incremental_sweeping;
+  event.main_thread = event.main_thread_atomic;
+  event.main_thread.mark_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(main_thread_mark);
+  event.main_thread.sweep_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(main_thread_sweep);
+
+  // Background work. Concurrent sweeping that outlives the atomic pause is
+  // accounted to the next cycle.
+  event.total = event.main_thread;
+  event.total.mark_wall_clock_duration_in_us = MillisecondsToMicroseconds(
+      main_thread_mark + current_.scopes[Scope::MC_BACKGROUND_MARKING]);
+  event.total.compact_wall_clock_duration_in_us = MillisecondsToMicroseconds(
+      current_.scopes[Scope::MC_EVACUATE] +
+      current_.scopes[Scope::MC_BACKGROUND_EVACUATE_COPY] +
+      current_.scopes[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS]);
+  event.total.sweep_wall_clock_duration_in_us = MillisecondsToMicroseconds(
+      main_thread_sweep + current_.scopes[Scope::MC_BACKGROUND_SWEEPING]);
+
+  event.objects =
+      MakeSizes(current_.start_object_size, current_.end_object_size);
+  event.memory =
+      MakeSizes(current_.start_memory_size, current_.end_memory_size);
+
+  recorder->AddMainThreadEvent(event, GetContextId(isolate));
+}
+
+void GCTracer::ReportYoungCycleToRecorder() {
+  Isolate* isolate = heap_->isolate();
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+
+  v8::metrics::GarbageCollectionYoungCycle event;
+  event.reason = static_cast<int>(current_.gc_reason);
+  const double main_thread = current_.end_time - current_.start_time;
+  const double background =
+      current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL] +
+      current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_COPY] +
+      current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS] +
+      current_.scopes[Scope::MINOR_MC_BACKGROUND_MARKING];
+  event.main_thread_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(main_thread);
+  event.background_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(background);
+  event.total_wall_clock_duration_in_us =
+      MillisecondsToMicroseconds(main_thread + background);
+  event.objects = MakeSizes(current_.young_object_size,
+                            current_.survived_young_object_size);
+  event.bytes_promoted = static_cast<int64_t>(heap_->promoted_objects_size());
+
+  recorder->AddMainThreadEvent(event, GetContextId(isolate));
+}
+
 void GCTracer::FetchBackgroundCounters(int first_global_scope,
                                        int last_global_scope,
                                        int first_background_scope,
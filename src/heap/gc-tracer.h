@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include "include/v8-metrics.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
@@ -133,6 +134,19 @@ class V8_EXPORT_PRIVATE GCTracer {
     DISALLOW_COPY_AND_ASSIGN(BackgroundScope);
   };
 
+  // Page handling decisions of the young generation mark-compactor.
+  struct YoungGenerationPageStats {
+    // Pages moved to old space as a whole.
+    size_t promoted_pages = 0;
+    size_t promoted_bytes = 0;
+    // Pages moved within new space as a whole.
+    size_t moved_pages = 0;
+    size_t moved_bytes = 0;
+    // Pages whose live objects were copied.
+    size_t evacuated_pages = 0;
+    size_t evacuated_bytes = 0;
+  };
+
   class Event {
    public:
     enum Type {
@@ -190,12 +204,19 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Size of survived young objects in destructor.
     size_t survived_young_object_size;
 
+    // Page handling for MINOR_MARK_COMPACTOR.
+    YoungGenerationPageStats young_page_stats;
+
     // Bytes marked incrementally for INCREMENTAL_MARK_COMPACTOR
     size_t incremental_marking_bytes;
 
     // Duration of incremental marking steps for INCREMENTAL_MARK_COMPACTOR.
     double incremental_marking_duration;
 
+    // Bytes marked by concurrent marking tasks for MARK_COMPACTOR and
+    // INCREMENTAL_MARK_COMPACTOR.
+    size_t concurrent_marking_bytes;
+
     // Amounts of time spent in different scopes during GC.
     double scopes[Scope::NUMBER_OF_SCOPES];
 
@@ -230,6 +251,8 @@ class V8_EXPORT_PRIVATE GCTracer {
   void NotifyYoungGenerationHandling(
       YoungGenerationHandling young_generation_handling);
 
+  void NotifyYoungGenerationPageStats(const YoungGenerationPageStats& stats);
+
   // Sample and accumulate bytes allocated since the last GC.
   void SampleAllocation(double current_ms, size_t new_space_counter_bytes,
                         size_t old_generation_counter_bytes,
@@ -247,10 +270,18 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
+  // Log the bytes marked by concurrent marking tasks in the current cycle.
+  void AddConcurrentMarkingBytes(size_t bytes);
+
   // Compute the average incremental marking speed in bytes/millisecond.
   // Returns a conservative value if no events have been recorded.
   double IncrementalMarkingSpeedInBytesPerMillisecond() const;
 
+  // Compute the average speed of a single concurrent marking task in
+  // bytes/millisecond.
+  // Returns 0 if no events have been recorded.
+  double ConcurrentMarkingSpeedInBytesPerMillisecond() const;
+
   // Compute the average embedder speed in bytes/millisecond.
   // Returns a conservative value if no events have been recorded.
   double EmbedderSpeedInBytesPerMillisecond() const;
@@ -369,6 +400,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, BackgroundScavengerScope);
   FRIEND_TEST(GCTracerTest, BackgroundMinorMCScope);
   FRIEND_TEST(GCTracerTest, BackgroundMajorMCScope);
+  FRIEND_TEST(GCTracerTest, ConcurrentMarkingSpeed);
   FRIEND_TEST(GCTracerTest, EmbedderAllocationThroughput);
   FRIEND_TEST(GCTracerTest, MultithreadedBackgroundScope);
   FRIEND_TEST(GCTracerTest, NewSpaceAllocationThroughput);
@@ -382,6 +414,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, RecordMetrics);
 
   struct BackgroundCounter {
     double total_duration_ms;
@@ -397,6 +430,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ResetForTesting();
   void ResetIncrementalMarkingCounters();
   void RecordIncrementalMarkingSpeed(size_t bytes, double duration);
+  void RecordConcurrentMarkingSpeed(size_t bytes, double duration);
   void RecordMutatorUtilization(double mark_compactor_end_time,
                                 double mark_compactor_duration);
 
@@ -432,6 +466,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   void FetchBackgroundMarkCompactCounters();
   void FetchBackgroundGeneralCounters();
 
+  // Report the current cycle to the embedder's v8::metrics::Recorder, if any.
+  // Must be called after the background counters have been fetched.
+  void ReportFullCycleToRecorder();
+  void ReportYoungCycleToRecorder();
+  void FlushBatchedIncrementalEvents();
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -463,6 +503,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   IncrementalMarkingInfos
       incremental_marking_scopes_[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
 
+  // Incremental marking steps not yet reported to the metrics recorder.
+  v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalMark
+      incremental_mark_batched_events_;
 
   // Timestamp and allocation counter at the last sampled allocation event.
   double allocation_time_ms_;
@@ -492,6 +535,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::RingBuffer<BytesAndDuration> recorded_compactions_;
   base::RingBuffer<BytesAndDuration> recorded_incremental_mark_compacts_;
   base::RingBuffer<BytesAndDuration> recorded_mark_compacts_;
+  base::RingBuffer<BytesAndDuration> recorded_concurrent_marking_;
   base::RingBuffer<BytesAndDuration> recorded_new_generation_allocations_;
   base::RingBuffer<BytesAndDuration> recorded_old_generation_allocations_;
   base::RingBuffer<BytesAndDuration> recorded_embedder_generation_allocations_;
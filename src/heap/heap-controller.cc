@@ -175,5 +175,26 @@ template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 const char* V8HeapTrait::kName = "HeapController";
 const char* GlobalMemoryTrait::kName = "GlobalMemoryController";
 
+// static
+size_t NewSpaceController::CalculateCapacity(double allocation_throughput,
+                                             double survival_ratio,
+                                             double target_interval_ms,
+                                             size_t min_capacity,
+                                             size_t max_capacity) {
+  DCHECK_LE(min_capacity, max_capacity);
+  // Without allocation throughput measurements keep the new space small.
+  if (allocation_throughput <= 0 || target_interval_ms <= 0) {
+    return min_capacity;
+  }
+  double capacity = allocation_throughput * target_interval_ms;
+  if (survival_ratio > kHighSurvivalRatio) {
+    capacity *= 1 + Min(survival_ratio, 100.0) / 100;
+  }
+  if (capacity >= static_cast<double>(max_capacity)) return max_capacity;
+  const size_t rounded_capacity =
+      ::RoundUp(static_cast<size_t>(capacity), Page::kPageSize);
+  return Max(min_capacity, Min(max_capacity, rounded_capacity));
+}
+
 }  // namespace internal
 }  // namespace v8
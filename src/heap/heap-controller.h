@@ -56,6 +56,22 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Sizes the semi-spaces of the young generation.
+class V8_EXPORT_PRIVATE NewSpaceController : public AllStatic {
+ public:
+  // Survival ratios (in percent) above this value make the controller grow
+  // the new space further to give objects more time to die.
+  static constexpr double kHighSurvivalRatio = 20.0;
+
+  // Computes the page aligned semi-space capacity that results in one
+  // scavenge per |target_interval_ms| at the given allocation throughput
+  // (in bytes/ms). High survival ratios (in percent) increase the capacity.
+  static size_t CalculateCapacity(double allocation_throughput,
+                                  double survival_ratio,
+                                  double target_interval_ms,
+                                  size_t min_capacity, size_t max_capacity);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -118,6 +118,11 @@ void Heap::SetMessageListeners(TemplateList value) {
   roots_table()[RootIndex::kMessageListeners] = value.ptr();
 }
 
+void Heap::SetStringBuilderTail(HeapObject value) {
+  DCHECK(value.IsString() || value.IsUndefined(isolate()));
+  roots_table()[RootIndex::kStringBuilderTail] = value.ptr();
+}
+
 void Heap::SetPendingOptimizeForTestBytecode(Object hash_table) {
   DCHECK(hash_table.IsObjectHashTable() || hash_table.IsUndefined(isolate()));
   roots_table()[RootIndex::kPendingOptimizeForTestBytecode] = hash_table.ptr();
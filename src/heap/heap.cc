@@ -39,6 +39,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/concurrent-allocator.h"
 #include "src/heap/concurrent-marking.h"
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/finalization-registry-cleanup-task.h"
 #include "src/heap/gc-idle-time-handler.h"
@@ -91,6 +92,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -943,8 +945,12 @@ inline bool MakePretenureDecision(
        current_decision == AllocationSite::kMaybeTenure)) {
     if (ratio >= AllocationSite::kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
-      // maximum capacity.
-      if (maximum_size_scavenge) {
+      // maximum capacity, or eagerly when the site already was a maybe
+      // tenure site in the previous GC. Otherwise objects of long-lived sites
+      // are copied within the new space until it is fully grown.
+      if (maximum_size_scavenge ||
+          (FLAG_eager_allocation_site_pretenuring &&
+           current_decision == AllocationSite::kMaybeTenure)) {
         site.set_deopt_dependent_code(true);
         site.set_pretenure_decision(AllocationSite::kTenure);
         // Currently we just need to deopt when we make a state transition to
@@ -2208,18 +2214,34 @@ void Heap::MarkCompactEpilogue() {
 void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->descriptor_lookup_cache()->Clear();
-  RegExpResultsCache::Clear(string_split_cache());
-  RegExpResultsCache::Clear(regexp_multiple_cache());
+  if (ShouldReduceMemory()) {
+    // Drop the regexp results caches, they are reallocated at their initial
+    // size when the next result is entered.
+    set_string_split_cache(ReadOnlyRoots(this).empty_fixed_array());
+    set_regexp_multiple_cache(ReadOnlyRoots(this).empty_fixed_array());
+  } else {
+    RegExpResultsCache::Clear(string_split_cache());
+    RegExpResultsCache::Clear(regexp_multiple_cache());
+  }
 
   isolate_->compilation_cache()->MarkCompactPrologue();
 
+  // Don't keep the spare capacity of a string builder alive across GCs.
+  set_string_builder_tail(ReadOnlyRoots(this).undefined_value());
+
   FlushNumberStringCache();
 }
 
 
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
-      survived_since_last_expansion_ > new_space_->TotalCapacity()) {
+  if (FLAG_dynamic_new_space_sizing) {
+    const size_t capacity = DynamicNewSpaceCapacity();
+    if (capacity > new_space_->TotalCapacity()) {
+      new_space_->Grow(capacity);
+      survived_since_last_expansion_ = 0;
+    }
+  } else if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
+             survived_since_last_expansion_ > new_space_->TotalCapacity()) {
     // Grow the size of new space if there is room to grow, and enough data
     // has survived scavenge since the last expansion.
     new_space_->Grow();
@@ -3328,6 +3350,21 @@ bool Heap::ShouldOptimizeForMemoryUsage() {
          !CanExpandOldGeneration(kOldGenerationSlack);
 }
 
+void Heap::UpdateOldBytecodeAge() {
+  int age = BytecodeArray::kIsOldBytecodeAge;
+  if (FLAG_adaptive_bytecode_flushing) {
+    if (ShouldOptimizeForMemoryUsage()) {
+      age = BytecodeArray::kQuinquagenarianBytecodeAge;
+    } else if (OldGenerationSizeOfObjects() < max_old_generation_size() / 4) {
+      age = BytecodeArray::kLastBytecodeAge;
+    }
+  }
+  old_bytecode_age_.store(age, std::memory_order_relaxed);
+  if (FLAG_trace_flush_bytecode && age != BytecodeArray::kIsOldBytecodeAge) {
+    PrintIsolate(isolate(), "Flushing bytecode of age %d and older\n", age);
+  }
+}
+
 void Heap::ActivateMemoryReducerIfNeeded() {
   // Activate memory reducer when switching to background if
   // - there was no mark compact since the start.
@@ -3352,6 +3389,16 @@ void Heap::ReduceNewSpaceSize() {
 
   if (FLAG_predictable) return;
 
+  if (FLAG_dynamic_new_space_sizing && !ShouldReduceMemory()) {
+    const size_t capacity = DynamicNewSpaceCapacity();
+    if (capacity < new_space_->TotalCapacity()) {
+      new_space_->Shrink(capacity);
+      new_lo_space_->SetCapacity(new_space_->Capacity());
+      UncommitFromSpace();
+    }
+    return;
+  }
+
   if (ShouldReduceMemory() ||
       ((allocation_throughput != 0) &&
        (allocation_throughput < kLowAllocationThroughput))) {
@@ -3361,6 +3408,28 @@ void Heap::ReduceNewSpaceSize() {
   }
 }
 
+size_t Heap::DynamicNewSpaceCapacity() {
+  const double target_interval_ms = 2 * new_space_sizing_trade_off_ *
+                                    FLAG_new_space_target_scavenge_interval;
+  const size_t capacity = NewSpaceController::CalculateCapacity(
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond(
+          GCTracer::kThroughputTimeFrameMs),
+      tracer()->AverageSurvivalRatio(), target_interval_ms,
+      new_space_->InitialTotalCapacity(), new_space_->MaximumCapacity());
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "[NewSpaceController] capacity %zu KB (current %zu KB) based on "
+        "trade_off=%.2f, target_interval=%.f ms\n",
+        capacity / KB, new_space_->TotalCapacity() / KB,
+        new_space_sizing_trade_off_, target_interval_ms);
+  }
+  return capacity;
+}
+
+void Heap::SetNewSpaceSizingTradeOff(double trade_off) {
+  new_space_sizing_trade_off_ = Min(1.0, Max(0.0, trade_off));
+}
+
 void Heap::FinalizeIncrementalMarkingIfComplete(
     GarbageCollectionReason gc_reason) {
   if (incremental_marking()->IsMarking() &&
@@ -3641,6 +3710,39 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
 }
 
 
+double Heap::EstimateScavengeTime() {
+  return GCIdleTimeHandler::EstimateScavengeTime(
+      new_space()->Size(), tracer()->ScavengeSpeedInBytesPerMillisecond());
+}
+
+double Heap::EstimateIncrementalMarkingStepTime() {
+  if (!incremental_marking()->IsMarking()) return 0;
+  // Marking steps are bounded by time rather than by the amount of work.
+  return IncrementalMarking::kStepSizeInMs;
+}
+
+double Heap::EstimateMarkingFinalizationTime() {
+  if (!incremental_marking()->IsMarking()) return 0;
+  return GCIdleTimeHandler::EstimateFinalIncrementalMarkCompactTime(
+      static_cast<size_t>(SizeOfObjects()),
+      tracer()->FinalIncrementalMarkCompactSpeedInBytesPerMillisecond());
+}
+
+bool Heap::FinalizeIncrementalMarkingIfFits(double time_budget_in_ms) {
+  if (!incremental_marking()->IsMarking()) return false;
+  const double estimate = EstimateMarkingFinalizationTime();
+  if (FLAG_trace_idle_notification) {
+    isolate()->PrintWithTimestamp(
+        "Finalize incremental marking: estimate=%.1f ms budget=%.1f ms\n",
+        estimate, time_budget_in_ms);
+  }
+  if (estimate > time_budget_in_ms) return false;
+  CollectAllGarbage(current_gc_flags_,
+                    GarbageCollectionReason::kFinalizeMarkingViaTask,
+                    current_gc_callback_flags_);
+  return true;
+}
+
 bool Heap::RecentIdleNotificationHappened() {
   return (last_idle_notification_time_ +
           GCIdleTimeHandler::kMaxScheduledIdleTime) >
@@ -3674,6 +3776,10 @@ void Heap::CheckMemoryPressure() {
       MemoryPressureLevel::kNone, std::memory_order_relaxed);
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
+#ifdef V8_INTL_SUPPORT
+    // The cached ICU formatters are only there for speed.
+    isolate()->ClearCachedIcuObjects();
+#endif  // V8_INTL_SUPPORT
     CollectGarbageOnMemoryPressure();
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
@@ -3691,6 +3797,7 @@ void Heap::CollectGarbageOnMemoryPressure() {
   const double kMaxMemoryPressurePauseMs = 100;
 
   double start = MonotonicallyIncreasingTimeInMs();
+  if (FLAG_flush_optimized_code_on_memory_pressure) FlushOptimizedCode();
   CollectAllGarbage(kReduceMemoryFootprintMask,
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
@@ -3720,10 +3827,51 @@ void Heap::CollectGarbageOnMemoryPressure() {
   }
 }
 
+void Heap::FlushOptimizedCode() {
+  size_t code_size = 0;
+  int code_count = 0;
+  for (Object context = native_contexts_list(); !context.IsUndefined(isolate());
+       context = NativeContext::cast(context).next_context_link()) {
+    Object element = NativeContext::cast(context).OptimizedCodeListHead();
+    while (!element.IsUndefined(isolate())) {
+      Code code = Code::cast(element);
+      code_size += code.Size();
+      code_count++;
+      element = code.next_code_link();
+    }
+  }
+  if (code_count == 0) return;
+
+  Deoptimizer::DeoptimizeAll(isolate());
+
+  // Functions keep their deoptimized code until they are called again. Reset
+  // them to CompileLazy right away, the same as CompileLazyDeoptimizedCode
+  // would, so that the code becomes unreachable. Activations on the stack
+  // keep their code alive until they return.
+  Code compile_lazy = isolate()->builtins()->builtin(Builtins::kCompileLazy);
+  HeapObjectIterator iterator(this);
+  for (HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!obj.IsJSFunction()) continue;
+    JSFunction function = JSFunction::cast(obj);
+    Code code = function.code();
+    if (CodeKindIsOptimizedJSFunction(code.kind()) &&
+        code.marked_for_deoptimization()) {
+      function.set_code(compile_lazy);
+    }
+  }
+
+  if (FLAG_trace_flush_optimized_code) {
+    PrintIsolate(isolate_, "Flushed %d optimized code objects (%zu KB)\n",
+                 code_count, code_size / KB);
+  }
+}
+
 void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
   TRACE_EVENT1("devtools.timeline,v8", "V8.MemoryPressureNotification", "level",
                static_cast<int>(level));
+  isolate()->allocator()->MemoryPressureNotification(level);
   MemoryPressureLevel previous =
       memory_pressure_level_.exchange(level, std::memory_order_relaxed);
   if ((previous != MemoryPressureLevel::kCritical &&
@@ -5154,6 +5302,7 @@ void Heap::SetUpSpaces() {
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
+  context_allocation_tracker_.reset(new ContextAllocationTracker(this));
   memory_reducer_.reset(new MemoryReducer(this));
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
@@ -5374,6 +5523,7 @@ void Heap::TearDown() {
 
   new_space()->RemoveAllocationObserver(scavenge_task_observer_.get());
   scavenge_task_observer_.reset();
+  context_allocation_tracker_.reset();
   scavenge_job_.reset();
 
   if (need_to_remove_stress_concurrent_allocation_observer_) {
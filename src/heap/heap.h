@@ -68,6 +68,7 @@ class BasicMemoryChunk;
 class CodeLargeObjectSpace;
 class CollectionBarrier;
 class ConcurrentMarking;
+class ContextAllocationTracker;
 class GCIdleTimeHandler;
 class GCIdleTimeHeapState;
 class GCTracer;
@@ -451,6 +452,30 @@ class Heap {
     return BytecodeFlushMode::kDoNotFlushBytecode;
   }
 
+  // The bytecode age from which bytecode is flushed by the current
+  // mark-compact. Set on the main thread when marking starts, and read by the
+  // marking visitors.
+  int old_bytecode_age() const {
+    return old_bytecode_age_.load(std::memory_order_relaxed);
+  }
+
+  // Picks the old bytecode age for the next mark-compact. With
+  // --adaptive-bytecode-flushing, bytecode gets old sooner when the heap
+  // should optimize for memory usage, and later when the old generation is
+  // far from its limit.
+  void UpdateOldBytecodeAge();
+
+  void RecordFlushedBytecode(int size) {
+    flushed_bytecode_size_ += size;
+    flushed_functions_++;
+  }
+  void RecordRecompiledFlushedFunction() { recompiled_flushed_functions_++; }
+  size_t flushed_bytecode_size() const { return flushed_bytecode_size_; }
+  size_t flushed_functions() const { return flushed_functions_; }
+  size_t recompiled_flushed_functions() const {
+    return recompiled_flushed_functions_;
+  }
+
   static uintptr_t ZapValue() {
     return FLAG_clear_free_memory ? kClearedFreeMemoryValue : kZapValue;
   }
@@ -682,6 +707,16 @@ class Heap {
   bool IdleNotification(double deadline_in_seconds);
   bool IdleNotification(int idle_time_in_ms);
 
+  // Estimated pause times in milliseconds for the corresponding V8 API
+  // function. Incremental marking estimates are 0 if marking is not running.
+  double EstimateScavengeTime();
+  double EstimateIncrementalMarkingStepTime();
+  double EstimateMarkingFinalizationTime();
+
+  // Implements the corresponding V8 API function.
+  V8_EXPORT_PRIVATE bool FinalizeIncrementalMarkingIfFits(
+      double time_budget_in_ms);
+
   V8_EXPORT_PRIVATE void MemoryPressureNotification(MemoryPressureLevel level,
                                                     bool is_isolate_locked);
   void CheckMemoryPressure();
@@ -714,6 +749,9 @@ class Heap {
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
 
+  // Implements the corresponding V8 API function.
+  V8_EXPORT_PRIVATE void SetNewSpaceSizingTradeOff(double trade_off);
+
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
   // An object should be promoted if the object has survived a
@@ -884,6 +922,7 @@ class Heap {
   V8_INLINE void SetRootScriptList(Object value);
   V8_INLINE void SetRootNoScriptSharedFunctionInfos(Object value);
   V8_INLINE void SetMessageListeners(TemplateList value);
+  V8_INLINE void SetStringBuilderTail(HeapObject value);
   V8_INLINE void SetPendingOptimizeForTestBytecode(Object bytecode);
 
   StrongRootsEntry* RegisterStrongRoots(FullObjectSlot start,
@@ -1736,6 +1775,9 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Returns the semi-space capacity that dynamic new space sizing aims for.
+  size_t DynamicNewSpaceCapacity();
+
   GCIdleTimeHeapState ComputeHeapState();
 
   bool PerformIdleTimeAction(GCIdleTimeAction action,
@@ -1763,6 +1805,10 @@ class Heap {
 
   void CollectGarbageOnMemoryPressure();
 
+  // Deoptimizes all optimized code and unlinks it from the functions that
+  // aren't running it, so that the next full GC can reclaim it.
+  void FlushOptimizedCode();
+
   void EagerlyFreeExternalMemory();
 
   bool InvokeNearHeapLimitCallback();
@@ -2017,6 +2063,10 @@ class Heap {
   std::vector<WeakArrayList> FindAllRetainedMaps();
   MemoryMeasurement* memory_measurement() { return memory_measurement_.get(); }
 
+  ContextAllocationTracker* context_allocation_tracker() {
+    return context_allocation_tracker_.get();
+  }
+
   // The amount of memory that has been freed concurrently.
   std::atomic<uintptr_t> external_memory_concurrently_freed_{0};
   ExternalMemoryAccounting external_memory_;
@@ -2055,6 +2105,10 @@ class Heap {
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
 
+  // Latency/memory trade-off for dynamic new space sizing in [0, 1]. Higher
+  // values result in a larger new space and fewer scavenges.
+  double new_space_sizing_trade_off_ = 0.5;
+
   // ... and since the last scavenge.
   size_t survived_last_scavenge_ = 0;
 
@@ -2066,6 +2120,13 @@ class Heap {
   // and reset by a mark-compact garbage collection.
   std::atomic<MemoryPressureLevel> memory_pressure_level_;
 
+  std::atomic<int> old_bytecode_age_{0};
+
+  // Statistics of bytecode flushing.
+  size_t flushed_bytecode_size_ = 0;
+  size_t flushed_functions_ = 0;
+  size_t recompiled_flushed_functions_ = 0;
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
@@ -2201,6 +2262,7 @@ class Heap {
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
+  std::unique_ptr<ContextAllocationTracker> context_allocation_tracker_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
@@ -2333,6 +2395,7 @@ class Heap {
   friend class Page;
   friend class PagedSpace;
   friend class ReadOnlyRoots;
+  friend class RegExpResultsCache;
   friend class Scavenger;
   friend class ScavengerCollector;
   friend class StressConcurrentAllocationObserver;
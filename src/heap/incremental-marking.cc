@@ -237,6 +237,10 @@ void IncrementalMarking::StartMarking() {
 
   SetState(MARKING);
 
+  mutator_utilization_schedule_.Start(
+      FLAG_incremental_marking_target_mutator_utilization,
+      heap_->MonotonicallyIncreasingTimeInMs());
+
   MarkingBarrier::ActivateAll(heap(), is_compacting_);
 
   heap_->isolate()->compilation_cache()->MarkCompactPrologue();
@@ -957,6 +961,27 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
           "[IncrementalMarking] Marking speed %.fKB/ms\n",
           heap()->tracer()->IncrementalMarkingSpeedInBytesPerMillisecond());
     }
+    if (step_origin == StepOrigin::kV8 &&
+        mutator_utilization_schedule_.IsEnabled()) {
+      size_t oom_slack = heap()->new_space()->Capacity() + 64 * MB;
+      if (heap()->CanExpandOldGeneration(oom_slack)) {
+        // Steps on allocation must not take more than the budget of the
+        // current window. The remaining work is left to concurrent marking.
+        max_step_size_in_ms = mutator_utilization_schedule_.AllowedStepTimeInMs(
+            start, max_step_size_in_ms);
+        if (max_step_size_in_ms == 0) {
+          if (FLAG_concurrent_marking) {
+            heap_->concurrent_marking()->RescheduleJobIfNeeded();
+          }
+          if (FLAG_trace_incremental_marking) {
+            heap_->isolate()->PrintWithTimestamp(
+                "[IncrementalMarking] Step skipped, mutator utilization "
+                "budget exhausted\n");
+          }
+          return StepResult::kMoreWorkRemaining;
+        }
+      }
+    }
     // The first step after Scavenge will see many allocated bytes.
     // Cap the step size to distribute the marking work more uniformly.
     const double marking_speed =
@@ -1011,6 +1036,9 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
     const double v8_duration =
         heap_->MonotonicallyIncreasingTimeInMs() - start - embedder_duration;
     heap_->tracer()->AddIncrementalMarkingStep(v8_duration, v8_bytes_processed);
+    mutator_utilization_schedule_.AddStepTime(
+        heap_->MonotonicallyIncreasingTimeInMs(),
+        v8_duration + embedder_duration);
   }
   if (FLAG_trace_incremental_marking) {
     heap_->isolate()->PrintWithTimestamp(
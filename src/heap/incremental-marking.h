@@ -9,6 +9,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking-job.h"
 #include "src/heap/mark-compact.h"
+#include "src/heap/mutator-utilization-schedule.h"
 #include "src/tasks/cancelable-task.h"
 
 namespace v8 {
@@ -295,6 +296,7 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   size_t bytes_marked_ = 0;
   size_t scheduled_bytes_to_mark_ = 0;
   double schedule_update_time_ms_ = 0.0;
+  MutatorUtilizationSchedule mutator_utilization_schedule_;
   // A sample of concurrent_marking()->TotalMarkedBytes() at the last
   // incremental marking step. It is used for updating
   // bytes_marked_ahead_of_schedule_ with contribution of concurrent marking.
@@ -494,6 +494,7 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   marking_worklists()->CreateContextWorklists(contexts);
+  heap()->UpdateOldBytecodeAge();
   local_marking_worklists_ =
       std::make_unique<MarkingWorklists::Local>(marking_worklists());
   marking_visitor_ = std::make_unique<MarkingVisitor>(
@@ -650,7 +651,16 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
     } else {
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
-    *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (FLAG_compaction_pause_target_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // Size the evacuation quota by the time budget instead of a fixed
+      // number of bytes, so that the pause does not grow with the live bytes
+      // on fragmented pages.
+      *max_evacuated_bytes = static_cast<size_t>(
+          estimated_compaction_speed * FLAG_compaction_pause_target_ms);
+    } else {
+      *max_evacuated_bytes = kMaxEvacuatedBytes;
+    }
   }
 }
 
@@ -885,6 +895,8 @@ void MarkCompactCollector::FinishConcurrentMarking() {
   // marking. It is safe to call this function when tasks are already finished.
   if (FLAG_parallel_marking || FLAG_concurrent_marking) {
     heap()->concurrent_marking()->Join();
+    heap()->tracer()->AddConcurrentMarkingBytes(
+        heap()->concurrent_marking()->TotalMarkedBytes());
     heap()->concurrent_marking()->FlushMemoryChunkData(
         non_atomic_marking_state());
     heap()->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
@@ -1741,24 +1753,32 @@ void MarkCompactCollector::ProcessEphemeronsLinear() {
 
     if (ephemeron_marking_.newly_discovered_overflowed) {
       // If newly_discovered was overflowed just visit all ephemerons in
-      // next_ephemerons.
-      weak_objects_.next_ephemerons.Iterate([&](Ephemeron ephemeron) {
-        if (non_atomic_marking_state()->IsBlackOrGrey(ephemeron.key) &&
-            non_atomic_marking_state()->WhiteToGrey(ephemeron.value)) {
-          local_marking_worklists()->Push(ephemeron.value);
+      // key_to_values. Unlike next_ephemerons it holds every pending
+      // ephemeron exactly once, and entries whose value got marked are
+      // dropped so that later iterations get cheaper.
+      for (auto it = key_to_values.begin(); it != key_to_values.end();) {
+        if (non_atomic_marking_state()->IsBlackOrGrey(it->first)) {
+          MarkObject(it->first, it->second);
+          it = key_to_values.erase(it);
+        } else if (!non_atomic_marking_state()->IsWhite(it->second)) {
+          it = key_to_values.erase(it);
+        } else {
+          ++it;
         }
-      });
+      }
 
     } else {
       // This is the good case: newly_discovered stores all discovered
       // objects. Now use key_to_values to see if discovered objects keep more
-      // objects alive due to ephemeron semantics.
+      // objects alive due to ephemeron semantics. The values of a discovered
+      // key are all marked, so its entries are not needed anymore.
       for (HeapObject object : ephemeron_marking_.newly_discovered) {
         auto range = key_to_values.equal_range(object);
         for (auto it = range.first; it != range.second; ++it) {
           HeapObject value = it->second;
           MarkObject(object, value);
         }
+        key_to_values.erase(range.first, range.second);
       }
     }
 
@@ -2177,6 +2197,7 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   HeapObject compiled_data = shared_info.GetBytecodeArray();
   Address compiled_data_start = compiled_data.address();
   int compiled_data_size = compiled_data.Size();
+  heap()->RecordFlushedBytecode(compiled_data_size);
   MemoryChunk* chunk = MemoryChunk::FromAddress(compiled_data_start);
 
   // Clear any recorded slots for the compiled data as being invalid.
@@ -2218,6 +2239,7 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // Use the raw function data setter to avoid validity checks, since we're
   // performing the unusual task of decompiling.
   shared_info.set_function_data(uncompiled_data, kReleaseStore);
+  shared_info.set_has_flushed_bytecode(true);
   DCHECK(!shared_info.is_compiled());
 }
 
@@ -2898,9 +2920,11 @@ class Evacuator : public Malloced {
 
   // NewSpacePages with more live bytes than this threshold qualify for fast
   // evacuation.
-  static intptr_t NewSpacePageEvacuationThreshold() {
+  // NewSpacePages with more live bytes than this threshold qualify for fast
+  // evacuation. |threshold_percent| is the minimum percentage of live bytes.
+  static intptr_t NewSpacePageEvacuationThreshold(int threshold_percent) {
     if (FLAG_page_promotion)
-      return FLAG_page_promotion_threshold *
+      return threshold_percent *
              MemoryChunkLayout::AllocatableMemoryInDataPage() / 100;
     return MemoryChunkLayout::AllocatableMemoryInDataPage() + kTaggedSize;
   }
@@ -3205,11 +3229,13 @@ void MarkCompactCollectorBase::CreateAndExecuteEvacuationTasks(
 }
 
 bool MarkCompactCollectorBase::ShouldMovePage(Page* p, intptr_t live_bytes,
+                                              int threshold_percent,
                                               bool always_promote_young) {
   const bool reduce_memory = heap()->ShouldReduceMemory();
   const Address age_mark = heap()->new_space()->age_mark();
   return !reduce_memory && !p->NeverEvacuate() &&
-         (live_bytes > Evacuator::NewSpacePageEvacuationThreshold()) &&
+         (live_bytes >
+          Evacuator::NewSpacePageEvacuationThreshold(threshold_percent)) &&
          (always_promote_young || !p->Contains(age_mark)) &&
          heap()->CanExpandOldGeneration(live_bytes);
 }
@@ -3225,6 +3251,7 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     if (live_bytes_on_page == 0) continue;
     live_bytes += live_bytes_on_page;
     if (ShouldMovePage(page, live_bytes_on_page,
+                       FLAG_page_promotion_threshold,
                        FLAG_always_promote_young_mc)) {
       if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK) ||
           FLAG_always_promote_young_mc) {
@@ -3594,6 +3621,30 @@ class ToSpaceUpdatingItem : public UpdatingItem {
   MarkingState* marking_state_;
 };
 
+// Shared by the updating items that process disjoint slot set bucket ranges
+// of the same chunk. The last item to finish releases the remembered sets of
+// the chunk.
+class SplitChunkUpdatingState {
+ public:
+  explicit SplitChunkUpdatingState(size_t items) : remaining_items_(items) {}
+
+  void AddOldToNewSlots(size_t slots) {
+    old_to_new_slots_.fetch_add(slots, std::memory_order_relaxed);
+  }
+  size_t old_to_new_slots() const {
+    return old_to_new_slots_.load(std::memory_order_relaxed);
+  }
+
+  // Returns true for the last item of the chunk.
+  bool ItemDone() {
+    return remaining_items_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+ private:
+  std::atomic<size_t> remaining_items_;
+  std::atomic<size_t> old_to_new_slots_{0};
+};
+
 template <typename MarkingState, GarbageCollector collector>
 class RememberedSetUpdatingItem : public UpdatingItem {
  public:
@@ -3603,12 +3654,32 @@ class RememberedSetUpdatingItem : public UpdatingItem {
       : heap_(heap),
         marking_state_(marking_state),
         chunk_(chunk),
-        updating_mode_(updating_mode) {}
+        updating_mode_(updating_mode),
+        start_bucket_(0),
+        end_bucket_(chunk->buckets()) {}
+  RememberedSetUpdatingItem(
+      Heap* heap, MarkingState* marking_state, MemoryChunk* chunk,
+      RememberedSetUpdatingMode updating_mode, size_t start_bucket,
+      size_t end_bucket, std::shared_ptr<SplitChunkUpdatingState> split_state)
+      : heap_(heap),
+        marking_state_(marking_state),
+        chunk_(chunk),
+        updating_mode_(updating_mode),
+        start_bucket_(start_bucket),
+        end_bucket_(end_bucket),
+        split_state_(std::move(split_state)) {
+    DCHECK_LT(start_bucket_, end_bucket_);
+    DCHECK_LE(end_bucket_, chunk->buckets());
+  }
   ~RememberedSetUpdatingItem() override = default;
 
   void Process() override {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
                  "RememberedSetUpdatingItem::Process");
+    if (split_state_) {
+      UpdateUntypedPointersInBucketRange();
+      return;
+    }
     base::MutexGuard guard(chunk_->mutex());
     CodePageMemoryModificationScope memory_modification_scope(chunk_);
     UpdateUntypedPointers();
@@ -3745,6 +3816,60 @@ class RememberedSetUpdatingItem : public UpdatingItem {
     }
   }
 
+  // Split chunks are large object pages that are not swept concurrently and
+  // only have untyped slots. The items of a chunk process disjoint buckets,
+  // so they do not need to hold the chunk mutex.
+  void UpdateUntypedPointersInBucketRange() {
+    DCHECK(chunk_->IsLargePage());
+    DCHECK_NULL(chunk_->sweeping_slot_set<AccessMode::NON_ATOMIC>());
+    DCHECK_NULL(chunk_->typed_slot_set<OLD_TO_NEW>());
+    DCHECK_NULL(chunk_->typed_slot_set<OLD_TO_OLD>());
+    SlotSet* old_to_new =
+        chunk_->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>();
+    if (old_to_new != nullptr) {
+      InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(chunk_);
+      size_t slots = old_to_new->Iterate(
+          chunk_->address(), start_bucket_, end_bucket_,
+          [this, &filter](MaybeObjectSlot slot) {
+            if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
+            return CheckAndUpdateOldToNewSlot(slot);
+          },
+          SlotSet::FREE_EMPTY_BUCKETS);
+      split_state_->AddOldToNewSlots(slots);
+    }
+
+    SlotSet* old_to_old =
+        chunk_->slot_set<OLD_TO_OLD, AccessMode::NON_ATOMIC>();
+    if ((updating_mode_ == RememberedSetUpdatingMode::ALL) &&
+        old_to_old != nullptr) {
+      InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToOld(chunk_);
+      IsolateRoot isolate = heap_->isolate();
+      old_to_old->Iterate(
+          chunk_->address(), start_bucket_, end_bucket_,
+          [&filter, isolate](MaybeObjectSlot slot) {
+            if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
+            return UpdateSlot<AccessMode::NON_ATOMIC>(isolate, slot);
+          },
+          SlotSet::FREE_EMPTY_BUCKETS);
+    }
+
+    if (!split_state_->ItemDone()) return;
+    // All buckets of the chunk are processed, release what the regular item
+    // would have released.
+    if (old_to_new != nullptr && split_state_->old_to_new_slots() == 0) {
+      chunk_->ReleaseSlotSet<OLD_TO_NEW>();
+    }
+    if (chunk_->invalidated_slots<OLD_TO_NEW>() != nullptr) {
+      chunk_->ReleaseInvalidatedSlots<OLD_TO_NEW>();
+    }
+    if (updating_mode_ == RememberedSetUpdatingMode::ALL) {
+      if (old_to_old != nullptr) chunk_->ReleaseSlotSet<OLD_TO_OLD>();
+      if (chunk_->invalidated_slots<OLD_TO_OLD>() != nullptr) {
+        chunk_->ReleaseInvalidatedSlots<OLD_TO_OLD>();
+      }
+    }
+  }
+
   void UpdateTypedPointers() {
     if (chunk_->typed_slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>() !=
         nullptr) {
@@ -3780,6 +3905,9 @@ class RememberedSetUpdatingItem : public UpdatingItem {
   MarkingState* marking_state_;
   MemoryChunk* chunk_;
   RememberedSetUpdatingMode updating_mode_;
+  const size_t start_bucket_;
+  const size_t end_bucket_;
+  std::shared_ptr<SplitChunkUpdatingState> split_state_;
 };
 
 std::unique_ptr<UpdatingItem> MarkCompactCollector::CreateToSpaceUpdatingItem(
@@ -3796,6 +3924,17 @@ MarkCompactCollector::CreateRememberedSetUpdatingItem(
       heap(), non_atomic_marking_state(), chunk, updating_mode);
 }
 
+std::unique_ptr<UpdatingItem>
+MarkCompactCollector::CreateRememberedSetUpdatingItem(
+    MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+    size_t start_bucket, size_t end_bucket,
+    std::shared_ptr<SplitChunkUpdatingState> split_state) {
+  return std::make_unique<
+      RememberedSetUpdatingItem<NonAtomicMarkingState, MARK_COMPACTOR>>(
+      heap(), non_atomic_marking_state(), chunk, updating_mode, start_bucket,
+      end_bucket, std::move(split_state));
+}
+
 int MarkCompactCollectorBase::CollectToSpaceUpdatingItems(
     std::vector<std::unique_ptr<UpdatingItem>>* items) {
   // Seed to space pages.
@@ -3838,7 +3977,26 @@ int MarkCompactCollectorBase::CollectRememberedSetUpdatingItems(
         contains_old_to_new_sweeping_slots ||
         contains_old_to_old_invalidated_slots ||
         contains_old_to_new_invalidated_slots) {
-      items->emplace_back(CreateRememberedSetUpdatingItem(chunk, mode));
+      // Split the slot sets of large non-code pages by buckets, so that a
+      // single large array does not keep one task busy.
+      const size_t kBucketsPerItem = SlotSet::BucketsForSize(Page::kPageSize);
+      const size_t buckets = chunk->buckets();
+      if (FLAG_parallel_pointer_update && chunk->IsLargePage() &&
+          !chunk->IsFlagSet(MemoryChunk::EXECUTABLE) &&
+          chunk->typed_slot_set<OLD_TO_NEW>() == nullptr &&
+          chunk->typed_slot_set<OLD_TO_OLD>() == nullptr &&
+          !contains_old_to_new_sweeping_slots && buckets > kBucketsPerItem) {
+        const size_t num_items =
+            (buckets + kBucketsPerItem - 1) / kBucketsPerItem;
+        auto split_state = std::make_shared<SplitChunkUpdatingState>(num_items);
+        for (size_t start = 0; start < buckets; start += kBucketsPerItem) {
+          items->emplace_back(CreateRememberedSetUpdatingItem(
+              chunk, mode, start, Min(buckets, start + kBucketsPerItem),
+              split_state));
+        }
+      } else {
+        items->emplace_back(CreateRememberedSetUpdatingItem(chunk, mode));
+      }
       pages++;
     }
   }
@@ -4720,6 +4878,17 @@ MinorMarkCompactCollector::CreateRememberedSetUpdatingItem(
       heap(), non_atomic_marking_state(), chunk, updating_mode);
 }
 
+std::unique_ptr<UpdatingItem>
+MinorMarkCompactCollector::CreateRememberedSetUpdatingItem(
+    MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+    size_t start_bucket, size_t end_bucket,
+    std::shared_ptr<SplitChunkUpdatingState> split_state) {
+  return std::make_unique<
+      RememberedSetUpdatingItem<NonAtomicMarkingState, MINOR_MARK_COMPACTOR>>(
+      heap(), non_atomic_marking_state(), chunk, updating_mode, start_bucket,
+      end_bucket, std::move(split_state));
+}
+
 class PageMarkingItem;
 class RootMarkingItem;
 class YoungGenerationMarkingTask;
@@ -5203,19 +5372,32 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
   std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> evacuation_items;
   intptr_t live_bytes = 0;
 
+  GCTracer::YoungGenerationPageStats page_stats;
+
+  // Dense pages are moved as a whole (promoted in place if they survived a
+  // GC before), only fragmented pages have their live objects copied.
   for (Page* page : new_space_evacuation_pages_) {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     if (live_bytes_on_page == 0) continue;
     live_bytes += live_bytes_on_page;
-    if (ShouldMovePage(page, live_bytes_on_page, false)) {
+    if (ShouldMovePage(page, live_bytes_on_page,
+                       FLAG_minor_mc_page_promotion_threshold, false)) {
       if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK)) {
         EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
+        page_stats.promoted_pages++;
+        page_stats.promoted_bytes += live_bytes_on_page;
       } else {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
+        page_stats.moved_pages++;
+        page_stats.moved_bytes += live_bytes_on_page;
       }
+    } else {
+      page_stats.evacuated_pages++;
+      page_stats.evacuated_bytes += live_bytes_on_page;
     }
     evacuation_items.emplace_back(ParallelWorkItem{}, page);
   }
+  heap()->tracer()->NotifyYoungGenerationPageStats(page_stats);
 
   // Promote young generation large objects.
   for (auto it = heap()->new_lo_space()->begin();
@@ -27,6 +27,7 @@ class ItemParallelJob;
 class MigrationObserver;
 class ReadOnlySpace;
 class RecordMigratedSlotVisitor;
+class SplitChunkUpdatingState;
 class UpdatingItem;
 class YoungGenerationMarkingVisitor;
 
@@ -219,6 +220,13 @@ class MarkCompactCollectorBase {
       MemoryChunk* chunk, Address start, Address end) = 0;
   virtual std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) = 0;
+  // Creates an item that only updates the untyped slots in the slot set
+  // buckets [start_bucket, end_bucket) of |chunk|. All items of a chunk share
+  // |split_state|.
+  virtual std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
+      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+      size_t start_bucket, size_t end_bucket,
+      std::shared_ptr<SplitChunkUpdatingState> split_state) = 0;
 
   template <class Evacuator, class Collector>
   void CreateAndExecuteEvacuationTasks(
@@ -227,7 +235,9 @@ class MarkCompactCollectorBase {
       MigrationObserver* migration_observer, const intptr_t live_bytes);
 
   // Returns whether this page should be moved according to heuristics.
-  bool ShouldMovePage(Page* p, intptr_t live_bytes, bool promote_young);
+  // |threshold_percent| is the minimum utilization of a page to be moved.
+  bool ShouldMovePage(Page* p, intptr_t live_bytes, int threshold_percent,
+                      bool promote_young);
 
   int CollectToSpaceUpdatingItems(
       std::vector<std::unique_ptr<UpdatingItem>>* items);
@@ -715,6 +725,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                                           Address end) override;
   std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) override;
+  std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
+      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+      size_t start_bucket, size_t end_bucket,
+      std::shared_ptr<SplitChunkUpdatingState> split_state) override;
 
   void ReleaseEvacuationCandidates();
   void PostProcessEvacuationCandidates();
@@ -857,6 +871,10 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
                                                           Address end) override;
   std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) override;
+  std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
+      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+      size_t start_bucket, size_t end_bucket,
+      std::shared_ptr<SplitChunkUpdatingState> split_state) override;
 
   void SweepArrayBufferExtensions();
 
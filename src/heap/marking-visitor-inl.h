@@ -149,7 +149,8 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitSharedFunctionInfo(
 
   // If the SharedFunctionInfo has old bytecode, mark it as flushable,
   // otherwise visit the function data field strongly.
-  if (shared_info.ShouldFlushBytecode(bytecode_flush_mode_)) {
+  if (shared_info.ShouldFlushBytecode(bytecode_flush_mode_,
+                                      old_bytecode_age_)) {
     weak_objects_->bytecode_flushing_candidates.Push(task_id_, shared_info);
   } else {
     VisitPointer(shared_info,
@@ -167,7 +168,9 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::
     VisitFixedArrayWithProgressBar(Map map, FixedArray object,
                                    MemoryChunk* chunk) {
   const int kProgressBarScanningChunk = kMaxRegularHeapObjectSize;
+  const int kSharedProgressBarScanningChunk = kMaxRegularHeapObjectSize / 8;
   STATIC_ASSERT(kMaxRegularHeapObjectSize % kTaggedSize == 0);
+  STATIC_ASSERT(kSharedProgressBarScanningChunk % kTaggedSize == 0);
   DCHECK(concrete_visitor()->marking_state()->IsBlackOrGrey(object));
   concrete_visitor()->marking_state()->GreyToBlack(object);
   int size = FixedArray::BodyDescriptor::SizeOf(map, object);
@@ -177,7 +180,12 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::
     this->VisitMapPointer(object);
     start = FixedArray::BodyDescriptor::kStartOffset;
   }
-  int end = Min(size, start + kProgressBarScanningChunk);
+  // If other markers ran out of work, scan the array in smaller chunks and
+  // publish the remainder so that an idle marker can continue with it.
+  const bool share_work = FLAG_marking_work_sharing &&
+                          local_marking_worklists_->IsGlobalPoolEmpty();
+  int end = Min(size, start + (share_work ? kSharedProgressBarScanningChunk
+                                          : kProgressBarScanningChunk));
   if (start < end) {
     VisitPointers(object, object.RawField(start), object.RawField(end));
     bool success = chunk->TrySetProgressBar(current_progress_bar, end);
@@ -186,6 +194,7 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::
       // The object can be pushed back onto the marking worklist only after
       // progress bar was updated.
       local_marking_worklists_->Push(object);
+      if (share_work) local_marking_worklists_->ShareWork();
     }
   }
   return end - start;
@@ -113,6 +113,7 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
         task_id_(task_id),
         mark_compact_epoch_(mark_compact_epoch),
         bytecode_flush_mode_(bytecode_flush_mode),
+        old_bytecode_age_(heap->old_bytecode_age()),
         is_embedder_tracing_enabled_(is_embedder_tracing_enabled),
         is_forced_gc_(is_forced_gc) {}
 
@@ -194,6 +195,7 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
   const int task_id_;
   const unsigned mark_compact_epoch_;
   const BytecodeFlushMode bytecode_flush_mode_;
+  const int old_bytecode_age_;
   const bool is_embedder_tracing_enabled_;
   const bool is_forced_gc_;
 };
@@ -155,6 +155,9 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local {
   void Publish();
   bool IsEmpty();
   bool IsEmbedderEmpty() const;
+  // Returns true if the global pool of the active worklist is empty, i.e.
+  // other markers have no work to steal from it.
+  bool IsGlobalPoolEmpty() const { return active_.IsGlobalEmpty(); }
   // Publishes the local active marking worklist if its global worklist is
   // empty. In the per-context marking mode it also publishes the shared
   // worklist.
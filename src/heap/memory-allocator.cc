@@ -23,10 +23,14 @@ namespace internal {
 static base::LazyInstance<CodeRangeAddressHint>::type code_range_address_hint =
     LAZY_INSTANCE_INITIALIZER;
 
-Address CodeRangeAddressHint::GetAddressHint(size_t code_range_size) {
+Address CodeRangeAddressHint::GetAddressHint(size_t code_range_size,
+                                             Address embedded_blob_code_start) {
   base::MutexGuard guard(&mutex_);
   auto it = recently_freed_.find(code_range_size);
   if (it == recently_freed_.end() || it->second.empty()) {
+    if (embedded_blob_code_start > code_range_size) {
+      return embedded_blob_code_start - code_range_size;
+    }
     return reinterpret_cast<Address>(GetRandomMmapAddr());
   }
   Address result = it->second.back();
@@ -84,12 +88,19 @@ void MemoryAllocator::InitializeCodePageAllocator(
   }
   DCHECK(!isolate_->RequiresCodeRange() || requested <= kMaximalCodeRangeSize);
 
-  Address hint =
-      RoundDown(code_range_address_hint.Pointer()->GetAddressHint(requested),
-                page_allocator->AllocatePageSize());
-  VirtualMemory reservation(
-      page_allocator, requested, reinterpret_cast<void*>(hint),
-      Max(kMinExpectedOSPageSize, page_allocator->AllocatePageSize()));
+  size_t alignment =
+      Max(kMinExpectedOSPageSize, page_allocator->AllocatePageSize());
+  if (FLAG_huge_pages) alignment = Max(alignment, kHugePageSize);
+  Address embedded_blob_code_start = kNullAddress;
+  if (FLAG_short_builtin_calls) {
+    embedded_blob_code_start =
+        reinterpret_cast<Address>(isolate_->embedded_blob_code());
+  }
+  Address hint = RoundDown(code_range_address_hint.Pointer()->GetAddressHint(
+                               requested, embedded_blob_code_start),
+                           alignment);
+  VirtualMemory reservation(page_allocator, requested,
+                            reinterpret_cast<void*>(hint), alignment);
   if (!reservation.IsReserved()) {
     V8::FatalProcessOutOfMemory(isolate_,
                                 "CodeRange setup: allocate virtual memory");
@@ -128,6 +139,11 @@ void MemoryAllocator::InitializeCodePageAllocator(
       page_allocator, aligned_base, size,
       static_cast<size_t>(MemoryChunk::kAlignment));
   code_page_allocator_ = code_page_allocator_instance_.get();
+
+  if (FLAG_huge_pages) {
+    USE(code_page_allocator_instance_->AdviseHugePages(
+        reinterpret_cast<void*>(aligned_base), size));
+  }
 }
 
 void MemoryAllocator::TearDown() {
@@ -285,11 +301,17 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   base::MutexGuard guard(&mutex_);
 
   size_t sum = 0;
-  // kPooled chunks are already uncommited. We only have to account for
+  // kPooled chunks are already uncommited unless they are kept committed for
+  // huge pages (see PerformFreeMemory). Otherwise we only have to account for
   // kRegular and kNonRegular chunks.
   for (auto& chunk : chunks_[kRegular]) {
     sum += chunk->size();
   }
+  if (FLAG_huge_pages) {
+    for (auto& chunk : chunks_[kPooled]) {
+      sum += chunk->size();
+    }
+  }
   for (auto& chunk : chunks_[kNonRegular]) {
     sum += chunk->size();
   }
@@ -583,7 +605,10 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
 
   VirtualMemory* reservation = chunk->reserved_memory();
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
-    UncommitMemory(reservation);
+    // Uncommitting discards the system pages of the chunk, which would break
+    // up the huge page backing it. Pooled chunks are reused soon, so they are
+    // kept committed in that case.
+    if (!FLAG_huge_pages) UncommitMemory(reservation);
   } else {
     DCHECK(reservation->IsReserved());
     reservation->Free();
@@ -36,8 +36,12 @@ class ReadOnlyPage;
 class CodeRangeAddressHint {
  public:
   // Returns the most recently freed code range start address for the given
-  // size. If there is no such entry, then a random address is returned.
-  V8_EXPORT_PRIVATE Address GetAddressHint(size_t code_range_size);
+  // size. If there is no such entry, then an address right below
+  // |embedded_blob_code_start| is returned if it is given, so that the code
+  // range can reach the embedded builtins with pc-relative calls, and a
+  // random address otherwise.
+  V8_EXPORT_PRIVATE Address GetAddressHint(
+      size_t code_range_size, Address embedded_blob_code_start = kNullAddress);
 
   V8_EXPORT_PRIVATE void NotifyFreedCodeRange(Address code_range_start,
                                               size_t code_range_size);
@@ -0,0 +1,50 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/mutator-utilization-schedule.h"
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+void MutatorUtilizationSchedule::Start(double target_mutator_utilization,
+                                       double now_ms) {
+  DCHECK_LE(0, target_mutator_utilization);
+  DCHECK_GT(1, target_mutator_utilization);
+  target_mutator_utilization_ = target_mutator_utilization;
+  window_start_ms_ = now_ms;
+  marking_time_in_window_ms_ = 0;
+}
+
+void MutatorUtilizationSchedule::AdvanceWindow(double now_ms) {
+  double elapsed_windows = (now_ms - window_start_ms_) / kWindowInMs;
+  if (elapsed_windows < 1) return;
+  // Steps that overshot the budget of the previous windows are paid back in
+  // the new window.
+  marking_time_in_window_ms_ = std::max(
+      0.0, marking_time_in_window_ms_ -
+               static_cast<int>(elapsed_windows) * BudgetPerWindowInMs());
+  window_start_ms_ = now_ms;
+}
+
+double MutatorUtilizationSchedule::AllowedStepTimeInMs(
+    double now_ms, double max_step_time_ms) {
+  if (!IsEnabled()) return max_step_time_ms;
+  AdvanceWindow(now_ms);
+  double remaining = BudgetPerWindowInMs() - marking_time_in_window_ms_;
+  return std::max(0.0, std::min(remaining, max_step_time_ms));
+}
+
+void MutatorUtilizationSchedule::AddStepTime(double now_ms,
+                                             double step_time_ms) {
+  if (!IsEnabled()) return;
+  AdvanceWindow(now_ms - step_time_ms);
+  marking_time_in_window_ms_ += step_time_ms;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,48 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_MUTATOR_UTILIZATION_SCHEDULE_H_
+#define V8_HEAP_MUTATOR_UTILIZATION_SCHEDULE_H_
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Limits the time the main thread spends in incremental marking steps to a
+// fraction of each time window, so that the mutator gets at least the target
+// utilization. Marking work that does not fit into the budget is left to
+// concurrent marking.
+class V8_EXPORT_PRIVATE MutatorUtilizationSchedule {
+ public:
+  static constexpr double kWindowInMs = 100;
+
+  // A target utilization of 0 disables the schedule.
+  void Start(double target_mutator_utilization, double now_ms);
+
+  bool IsEnabled() const { return target_mutator_utilization_ > 0; }
+
+  // Returns how long the main thread may mark at time |now_ms|. The result
+  // is at most |max_step_time_ms| and 0 if the budget of the current window
+  // is used up.
+  double AllowedStepTimeInMs(double now_ms, double max_step_time_ms);
+
+  // Accounts a marking step that ended at |now_ms|.
+  void AddStepTime(double now_ms, double step_time_ms);
+
+ private:
+  double BudgetPerWindowInMs() const {
+    return (1 - target_mutator_utilization_) * kWindowInMs;
+  }
+  void AdvanceWindow(double now_ms);
+
+  double target_mutator_utilization_ = 0;
+  double window_start_ms_ = 0;
+  double marking_time_in_window_ms_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_MUTATOR_UTILIZATION_SCHEDULE_H_
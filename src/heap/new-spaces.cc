@@ -418,12 +418,16 @@ void NewSpace::TearDown() {
 void NewSpace::Flip() { SemiSpace::Swap(&from_space_, &to_space_); }
 
 void NewSpace::Grow() {
-  DCHECK_IMPLIES(FLAG_local_heaps, heap()->safepoint()->IsActive());
   // Double the semispace size but only up to maximum capacity.
   DCHECK(TotalCapacity() < MaximumCapacity());
-  size_t new_capacity =
-      Min(MaximumCapacity(),
-          static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+  Grow(static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+}
+
+void NewSpace::Grow(size_t new_capacity) {
+  DCHECK_IMPLIES(FLAG_local_heaps, heap()->safepoint()->IsActive());
+  new_capacity =
+      Min(MaximumCapacity(), ::RoundUp(new_capacity, Page::kPageSize));
+  if (new_capacity <= TotalCapacity()) return;
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -439,8 +443,10 @@ void NewSpace::Grow() {
   DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
 }
 
-void NewSpace::Shrink() {
-  size_t new_capacity = Max(InitialTotalCapacity(), 2 * Size());
+void NewSpace::Shrink() { Shrink(InitialTotalCapacity()); }
+
+void NewSpace::Shrink(size_t min_capacity) {
+  size_t new_capacity = Max(min_capacity, 2 * Size());
   size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
   if (rounded_new_capacity < TotalCapacity() &&
       to_space_.ShrinkTo(rounded_new_capacity)) {
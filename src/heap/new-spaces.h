@@ -254,9 +254,15 @@ class V8_EXPORT_PRIVATE NewSpace
   // Grow the capacity of the semispaces.  Assumes that they are not at
   // their maximum capacity.
   void Grow();
+  // Grow the capacity of the semispaces to |new_capacity|, bounded by the
+  // maximum capacity.
+  void Grow(size_t new_capacity);
 
   // Shrink the capacity of the semispaces.
   void Shrink();
+  // Shrink the capacity of the semispaces, but not below |min_capacity| or
+  // twice the size of the live objects.
+  void Shrink(size_t min_capacity);
 
   // Return the allocated bytes in the active semispace.
   size_t Size() final {
@@ -853,6 +853,22 @@ bool ObjectStatsCollectorImpl::SameLiveness(HeapObject obj1, HeapObject obj2) {
          marking_state_->Color(obj1) == marking_state_->Color(obj2);
 }
 
+namespace {
+
+// Returns true for fast object maps that are not part of any transition tree,
+// e.g. the maps created when dictionary mode objects go back to fast mode.
+bool IsDetachedMap(Map map) {
+  if (map.is_prototype_map() || map.is_dictionary_map()) return false;
+  if (!map.IsJSObjectMap() || map.NumberOfOwnDescriptors() == 0) return false;
+  if (map.GetBackPointer().IsMap()) return false;
+  Object constructor = map.GetConstructor();
+  if (!constructor.IsJSFunction()) return true;
+  JSFunction function = JSFunction::cast(constructor);
+  return !function.has_initial_map() || function.initial_map() != map;
+}
+
+}  // namespace
+
 void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Map map) {
   // TODO(mlippautz): map->dependent_code(): DEPENDENT_CODE_TYPE.
 
@@ -877,6 +893,9 @@ void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Map map) {
   } else if (map.is_dictionary_map()) {
     RecordSimpleVirtualObjectStats(HeapObject(), map,
                                    ObjectStats::MAP_DICTIONARY_TYPE);
+  } else if (IsDetachedMap(map)) {
+    RecordSimpleVirtualObjectStats(HeapObject(), map,
+                                   ObjectStats::MAP_DETACHED_TYPE);
   } else if (map.is_stable()) {
     RecordSimpleVirtualObjectStats(HeapObject(), map,
                                    ObjectStats::MAP_STABLE_TYPE);
@@ -897,6 +916,9 @@ void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Map map) {
     } else if (map.is_deprecated()) {
       RecordSimpleVirtualObjectStats(
           map, array, ObjectStats::DEPRECATED_DESCRIPTOR_ARRAY_TYPE);
+    } else if (IsDetachedMap(map)) {
+      RecordSimpleVirtualObjectStats(
+          map, array, ObjectStats::DETACHED_DESCRIPTOR_ARRAY_TYPE);
     }
 
     EnumCache enum_cache = array.enum_cache();
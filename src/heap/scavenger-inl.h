@@ -50,6 +50,10 @@ bool Scavenger::PromotionList::View::ShouldEagerlyProcessPromotionList() {
   return promotion_list_->ShouldEagerlyProcessPromotionList(task_id_);
 }
 
+bool Scavenger::PromotionList::View::ShareWorkIfGlobalPoolIsEmpty() {
+  return promotion_list_->ShareWorkIfGlobalPoolIsEmpty(task_id_);
+}
+
 void Scavenger::PromotionList::PushRegularObject(int task_id, HeapObject object,
                                                  int size) {
   regular_object_promotion_list_.Push(task_id, ObjectAndSize(object, size));
@@ -87,6 +91,12 @@ void Scavenger::PromotionList::FlushToGlobal(int task_id) {
   large_object_promotion_list_.FlushToGlobal(task_id);
 }
 
+bool Scavenger::PromotionList::ShareWorkIfGlobalPoolIsEmpty(int task_id) {
+  // Large objects are few and already published in small segments, so only the
+  // regular object list is shared eagerly.
+  return regular_object_promotion_list_.ShareWorkIfGlobalPoolIsEmpty(task_id);
+}
+
 size_t Scavenger::PromotionList::GlobalPoolSize() const {
   return regular_object_promotion_list_.GlobalPoolSize() +
          large_object_promotion_list_.GlobalPoolSize();
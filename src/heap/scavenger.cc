@@ -210,9 +210,11 @@ void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
   }
   if (FLAG_trace_parallel_scavenge) {
     PrintIsolate(outer_->heap_->isolate(),
-                 "scavenge[%p]: time=%.2f copied=%zu promoted=%zu\n",
+                 "scavenge[%p]: time=%.2f copied=%zu promoted=%zu "
+                 "shared_segments=%zu\n",
                  static_cast<void*>(this), scavenging_time,
-                 scavenger->bytes_copied(), scavenger->bytes_promoted());
+                 scavenger->bytes_copied(), scavenger->bytes_promoted(),
+                 scavenger->segments_shared());
   }
 }
 
@@ -621,6 +623,9 @@ void Scavenger::Process(JobDelegate* delegate) {
       scavenge_visitor.Visit(object_and_size.first);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
+        // Long chains of copied objects stay in the private segments of a
+        // single task. Publish them when other tasks ran out of work.
+        if (copied_list_.ShareWorkIfGlobalPoolIsEmpty()) segments_shared_++;
         if (!copied_list_.IsGlobalPoolEmpty()) {
           delegate->NotifyConcurrencyIncrease();
         }
@@ -633,6 +638,7 @@ void Scavenger::Process(JobDelegate* delegate) {
       IterateAndScavengePromotedObject(target, entry.map, entry.size);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
+        if (promotion_list_.ShareWorkIfGlobalPoolIsEmpty()) segments_shared_++;
         if (!promotion_list_.IsGlobalPoolEmpty()) {
           delegate->NotifyConcurrencyIncrease();
         }
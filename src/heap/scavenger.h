@@ -60,6 +60,7 @@ class Scavenger {
       inline bool IsGlobalPoolEmpty();
       inline bool ShouldEagerlyProcessPromotionList();
       inline void FlushToGlobal();
+      inline bool ShareWorkIfGlobalPoolIsEmpty();
 
      private:
       PromotionList* promotion_list_;
@@ -80,6 +81,7 @@ class Scavenger {
     inline bool IsGlobalPoolEmpty();
     inline bool ShouldEagerlyProcessPromotionList(int task_id);
     inline void FlushToGlobal(int task_id);
+    inline bool ShareWorkIfGlobalPoolIsEmpty(int task_id);
 
    private:
     static const int kRegularObjectPromotionListSegmentSize = 256;
@@ -118,6 +120,7 @@ class Scavenger {
 
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
+  size_t segments_shared() const { return segments_shared_; }
 
  private:
   // Number of objects to process before interrupting for potentially waking
@@ -196,6 +199,7 @@ class Scavenger {
   Heap::PretenuringFeedbackMap local_pretenuring_feedback_;
   size_t copied_size_;
   size_t promoted_size_;
+  size_t segments_shared_ = 0;
   EvacuationAllocator allocator_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
 
@@ -690,6 +690,8 @@ void Heap::CreateInitialObjects() {
   // There's no "current microtask" in the beginning.
   set_current_microtask(roots.undefined_value());
 
+  set_string_builder_tail(roots.undefined_value());
+
   set_weak_refs_keep_during_job(roots.undefined_value());
 
   // Allocate cache for single character one byte strings.
@@ -1143,6 +1145,30 @@ void Heap::CreateInitialObjects() {
     info = CreateSharedFunctionInfo(
         isolate_, Builtins::kPromiseAnyRejectElementClosure, 1);
     set_promise_any_reject_element_shared_fun(*info);
+
+    info = CreateSharedFunctionInfo(
+        isolate_, Builtins::kPromiseAllResolveElementIndexed, 2);
+    set_promise_all_resolve_element_indexed_shared_fun(*info);
+
+    info = CreateSharedFunctionInfo(
+        isolate_, Builtins::kPromiseAllRejectElementIndexed, 2);
+    set_promise_all_reject_element_indexed_shared_fun(*info);
+
+    info = CreateSharedFunctionInfo(
+        isolate_, Builtins::kPromiseAllSettledResolveElementIndexed, 2);
+    set_promise_all_settled_resolve_element_indexed_shared_fun(*info);
+
+    info = CreateSharedFunctionInfo(
+        isolate_, Builtins::kPromiseAllSettledRejectElementIndexed, 2);
+    set_promise_all_settled_reject_element_indexed_shared_fun(*info);
+
+    info = CreateSharedFunctionInfo(
+        isolate_, Builtins::kPromiseAnyResolveElementIndexed, 2);
+    set_promise_any_resolve_element_indexed_shared_fun(*info);
+
+    info = CreateSharedFunctionInfo(
+        isolate_, Builtins::kPromiseAnyRejectElementIndexed, 2);
+    set_promise_any_reject_element_indexed_shared_fun(*info);
   }
 
   // ProxyRevoke:
@@ -458,8 +458,15 @@ void Sweeper::SweepSpaceFromTask(AllocationSpace identity) {
 }
 
 bool Sweeper::SweepSpaceIncrementallyFromTask(AllocationSpace identity) {
-  if (Page* page = GetSweepingPageSafe(identity)) {
+  // Code pages are swept on the main thread (see SweepSpaceFromTask). Sweep
+  // as many pages as fit into a short time budget per task instead of a
+  // single page, so that fewer pages are left for the finalization step of
+  // the next GC or allocation slow path.
+  const double deadline_in_ms = heap_->MonotonicallyIncreasingTimeInMs() +
+                                kMaxIncrementalSweepingStepInMs;
+  while (Page* page = GetSweepingPageSafe(identity)) {
     ParallelSweepPage(page, identity);
+    if (heap_->MonotonicallyIncreasingTimeInMs() >= deadline_in_ms) break;
   }
   return sweeping_list_[GetSweepSpaceIndex(identity)].empty();
 }
@@ -128,6 +128,8 @@ class Sweeper {
   static const int kNumberOfSweepingSpaces =
       LAST_GROWABLE_PAGED_SPACE - FIRST_GROWABLE_PAGED_SPACE + 1;
   static const int kMaxSweeperTasks = 3;
+  // Time budget of a single foreground task sweeping code pages.
+  static constexpr double kMaxIncrementalSweepingStepInMs = 0.5;
 
   template <typename Callback>
   void ForAllSweepingSpaces(Callback callback) const {
@@ -53,6 +53,10 @@ class Worklist {
 
     void FlushToGlobal() { worklist_->FlushToGlobal(task_id_); }
 
+    bool ShareWorkIfGlobalPoolIsEmpty() {
+      return worklist_->ShareWorkIfGlobalPoolIsEmpty(task_id_);
+    }
+
    private:
     Worklist<EntryType, SEGMENT_SIZE>* worklist_;
     int task_id_;
@@ -203,6 +207,16 @@ class Worklist {
     PublishPopSegmentToGlobal(task_id);
   }
 
+  // Publishes the private push segment of the given task if the global pool
+  // is empty, so that idle tasks have something to steal. Returns true if a
+  // segment was published.
+  bool ShareWorkIfGlobalPoolIsEmpty(int task_id) {
+    if (!global_pool_.IsEmpty()) return false;
+    if (private_push_segment(task_id)->IsEmpty()) return false;
+    PublishPushSegmentToGlobal(task_id);
+    return true;
+  }
+
   void MergeGlobalPool(Worklist* other) {
     global_pool_.Merge(&other->global_pool_);
   }
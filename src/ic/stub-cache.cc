@@ -4,8 +4,11 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -14,15 +17,34 @@
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+namespace {
+
+int TableSizeFromBits(int bits) {
+  bits = std::max(bits, StubCache::kMinTableBits);
+  bits = std::min(bits, StubCache::kMaxTableBits);
+  return 1 << bits;
+}
+
+}  // namespace
+
+StubCache::StubCache(Isolate* isolate)
+    : primary_table_size_(
+          TableSizeFromBits(FLAG_stub_cache_primary_table_bits)),
+      secondary_table_size_(
+          TableSizeFromBits(FLAG_stub_cache_secondary_table_bits)),
+      primary_mask_((primary_table_size_ - 1) << kCacheIndexShift),
+      secondary_mask_((secondary_table_size_ - 1) << kCacheIndexShift),
+      isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  primary_.reset(new Entry[primary_table_size_]);
+  secondary_.reset(new Entry[secondary_table_size_]);
 }
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size_));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size_));
   Clear();
 }
 
@@ -40,7 +62,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -50,7 +72,7 @@ int StubCache::SecondaryOffset(Name name, int seed) {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -84,7 +106,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_.get(), primary_offset);
   MaybeObject old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
@@ -99,7 +121,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
         old_map);
     int secondary_offset = SecondaryOffset(
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key)), seed);
-    Entry* secondary = entry(secondary_, secondary_offset);
+    Entry* secondary = entry(secondary_.get(), secondary_offset);
     *secondary = *primary;
   }
 
@@ -113,12 +135,12 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 MaybeObject StubCache::Get(Name name, Map map) {
   DCHECK(CommonStubCacheChecks(this, name, map, MaybeObject()));
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_.get(), primary_offset);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
   int secondary_offset = SecondaryOffset(name, primary_offset);
-  Entry* secondary = entry(secondary_, secondary_offset);
+  Entry* secondary = entry(secondary_.get(), secondary_offset);
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
@@ -129,12 +151,12 @@ void StubCache::Clear() {
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
@@ -5,6 +5,8 @@
 #ifndef V8_IC_STUB_CACHE_H_
 #define V8_IC_STUB_CACHE_H_
 
+#include <memory>
+
 #include "src/objects/name.h"
 #include "src/objects/tagged-value.h"
 
@@ -66,16 +68,25 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The uint32_t mask that turns a hash into an offset into {table}.
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
-        return StubCache::primary_;
+        return StubCache::primary_.get();
       case StubCache::kSecondary:
-        return StubCache::secondary_;
+        return StubCache::secondary_.get();
     }
     UNREACHABLE();
   }
 
+  int primary_table_size() const { return primary_table_size_; }
+  int secondary_table_size() const { return secondary_table_size_; }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::kHashShift is convenient because it
@@ -85,20 +96,22 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The table sizes are picked at isolate creation from
+  // --stub-cache-primary-table-bits and --stub-cache-secondary-table-bits,
+  // clamped to this range.
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 16;
 
   // We compute the hash code for a map as follows:
   //   <code> = <address> ^ (<address> >> kMapKeyShift)
-  static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
+  // This only mixes the bits and does not depend on the table sizes.
+  static const int kMapKeyShift = 11 + kCacheIndexShift;
 
   // Some magic number used in the secondary hash computation.
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, int seed);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, int seed);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
@@ -114,12 +127,12 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, int seed);
+  int SecondaryOffset(Name name, int seed);
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +149,15 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // The tables are allocated up front and never move, since generated code
+  // refers to them through the external reference table.
+  std::unique_ptr<Entry[]> primary_;
+  std::unique_ptr<Entry[]> secondary_;
+  int primary_table_size_;
+  int secondary_table_size_;
+  // (table size - 1) << kCacheIndexShift, loaded by generated code.
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -4845,7 +4845,11 @@ bool Genesis::InstallSpecialObjects(Isolate* isolate,
   Handle<Smi> stack_trace_limit(Smi::FromInt(FLAG_stack_trace_limit), isolate);
   JSObject::AddProperty(isolate, Error, name, stack_trace_limit, NONE);
 
-  if (FLAG_expose_wasm) {
+  if (FLAG_expose_wasm && FLAG_wasm_lazy_js_api) {
+    // Only expose a placeholder on the global object; the internal data
+    // structures are set up on first use.
+    WasmJs::InstallLazily(isolate);
+  } else if (FLAG_expose_wasm) {
     // Install the internal data structures into the isolate and expose on
     // the global object.
     WasmJs::Install(isolate, true);
@@ -3,7 +3,12 @@
 // found in the LICENSE file.
 
 #include "src/init/isolate-allocator.h"
+
+#include <vector>
+
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/ptr-compr.h"
 #include "src/execution/isolate.h"
 #include "src/utils/memcopy.h"
@@ -14,8 +19,8 @@ namespace internal {
 
 IsolateAllocator::IsolateAllocator() {
 #ifdef V8_COMPRESS_POINTERS
-  Address heap_reservation_address = InitReservation();
-  CommitPagesForIsolate(heap_reservation_address);
+  heap_reservation_address_ = InitReservation();
+  CommitPagesForIsolate(heap_reservation_address_);
 #else
   // Allocate Isolate in C++ heap.
   page_allocator_ = GetPlatformPageAllocator();
@@ -26,7 +31,11 @@ IsolateAllocator::IsolateAllocator() {
 
 IsolateAllocator::~IsolateAllocator() {
   if (reservation_.IsReserved()) {
-    // The actual memory will be freed when the |reservation_| will die.
+#ifdef V8_COMPRESS_POINTERS
+    CacheOrFreeReservation();
+#endif
+    // Otherwise, the actual memory will be freed when the |reservation_| will
+    // die.
     return;
   }
 
@@ -48,8 +57,61 @@ inline size_t GetIsolateRootBiasPageSize(
                  platform_page_allocator->AllocatePageSize());
 }
 
+// Reservations of disposed isolates. Finding a properly aligned region of
+// address space can take several attempts, so new isolates reuse these first.
+class ReservationCache {
+ public:
+  bool TryTake(VirtualMemory* reservation, Address* heap_reservation_address) {
+    base::MutexGuard guard(&mutex_);
+    if (entries_.empty()) return false;
+    *reservation = std::move(entries_.back().reservation);
+    *heap_reservation_address = entries_.back().heap_reservation_address;
+    entries_.pop_back();
+    return true;
+  }
+
+  bool TryPut(VirtualMemory* reservation, Address heap_reservation_address) {
+    base::MutexGuard guard(&mutex_);
+    if (static_cast<int>(entries_.size()) >= FLAG_cached_isolate_reservations) {
+      return false;
+    }
+    entries_.push_back({std::move(*reservation), heap_reservation_address});
+    return true;
+  }
+
+  void Clear() {
+    base::MutexGuard guard(&mutex_);
+    entries_.clear();
+  }
+
+ private:
+  struct Entry {
+    VirtualMemory reservation;
+    Address heap_reservation_address;
+  };
+
+  base::Mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ReservationCache, GetReservationCache)
+
 }  // namespace
 
+void IsolateAllocator::CacheOrFreeReservation() {
+  const size_t reservation_size =
+      kPtrComprHeapReservationSize +
+      GetIsolateRootBiasPageSize(GetPlatformPageAllocator());
+  // The heap has returned its pages by now. Discard the pages that held the
+  // Isolate as well, so that the next isolate starts from untouched memory.
+  if (!reservation_.SetPermissions(heap_reservation_address_,
+                                   reservation_size,
+                                   PageAllocator::kNoAccess)) {
+    return;
+  }
+  GetReservationCache()->TryPut(&reservation_, heap_reservation_address_);
+}
+
 Address IsolateAllocator::InitReservation() {
   v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
 
@@ -60,6 +122,11 @@ Address IsolateAllocator::InitReservation() {
   // resevation address plus |kIsolateRootBiasPageSize| is 4Gb aligned.
   const size_t reservation_size =
       kPtrComprHeapReservationSize + kIsolateRootBiasPageSize;
+
+  Address cached_address;
+  if (GetReservationCache()->TryTake(&reservation_, &cached_address)) {
+    return cached_address;
+  }
   const size_t base_alignment = kPtrComprIsolateRootAlignment;
 
   const int kMaxAttempts = 4;
@@ -153,6 +220,13 @@ void IsolateAllocator::CommitPagesForIsolate(Address heap_reservation_address) {
       page_size);
   page_allocator_ = page_allocator_instance_.get();
 
+  if (FLAG_huge_pages) {
+    // The advice is only a hint, so failures are ignored. Sub-ranges keep it
+    // when their permissions change as heap pages are committed.
+    USE(page_allocator_instance_->AdviseHugePages(
+        reinterpret_cast<void*>(isolate_root), kPtrComprHeapReservationSize));
+  }
+
   Address isolate_address = isolate_root - Isolate::isolate_root_bias();
   Address isolate_end = isolate_address + sizeof(Isolate);
 
@@ -190,5 +264,12 @@ void IsolateAllocator::CommitPagesForIsolate(Address heap_reservation_address) {
 }
 #endif  // V8_COMPRESS_POINTERS
 
+// static
+void IsolateAllocator::FreeCachedReservations() {
+#ifdef V8_COMPRESS_POINTERS
+  GetReservationCache()->Clear();
+#endif
+}
+
 }  // namespace internal
 }  // namespace v8
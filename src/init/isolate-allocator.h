@@ -42,15 +42,24 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
 
   v8::PageAllocator* page_allocator() const { return page_allocator_; }
 
+  // Releases the reservations kept for reuse by new isolates.
+  static void FreeCachedReservations();
+
  private:
   Address InitReservation();
   void CommitPagesForIsolate(Address heap_reservation_address);
+#ifdef V8_COMPRESS_POINTERS
+  void CacheOrFreeReservation();
+#endif
 
   // The allocated memory for Isolate instance.
   void* isolate_memory_ = nullptr;
   v8::PageAllocator* page_allocator_ = nullptr;
   std::unique_ptr<base::BoundedPageAllocator> page_allocator_instance_;
   VirtualMemory reservation_;
+#ifdef V8_COMPRESS_POINTERS
+  Address heap_reservation_address_ = kNullAddress;
+#endif
 
   DISALLOW_COPY_AND_ASSIGN(IsolateAllocator);
 };
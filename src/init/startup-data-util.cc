@@ -21,6 +21,7 @@ namespace internal {
 namespace {
 
 v8::StartupData g_snapshot;
+base::OS::MemoryMappedFile* g_snapshot_file = nullptr;
 
 void ClearStartupData(v8::StartupData* data) {
   data->data = nullptr;
@@ -28,7 +29,13 @@ void ClearStartupData(v8::StartupData* data) {
 }
 
 void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
+  if (g_snapshot_file != nullptr) {
+    // The data points into the mapping, which is released below.
+    delete g_snapshot_file;
+    g_snapshot_file = nullptr;
+  } else {
+    delete[] data->data;
+  }
   ClearStartupData(data);
 }
 
@@ -36,12 +43,35 @@ void FreeStartupData() {
   DeleteStartupData(&g_snapshot);
 }
 
+// Maps the blob read-only instead of copying it onto the heap, so that
+// processes loading the same snapshot share its (clean) pages through the
+// page cache.
+bool Map(const char* blob_file, v8::StartupData* startup_data) {
+  DCHECK_NULL(g_snapshot_file);
+  base::OS::MemoryMappedFile* file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (file == nullptr) return false;
+  if (file->size() == 0 || file->size() > static_cast<size_t>(kMaxInt)) {
+    delete file;
+    return false;
+  }
+  g_snapshot_file = file;
+  startup_data->data = static_cast<const char*>(file->memory());
+  startup_data->raw_size = static_cast<int>(file->size());
+  return true;
+}
+
 void Load(const char* blob_file, v8::StartupData* startup_data,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
+  if (FLAG_map_startup_data && Map(blob_file, startup_data)) {
+    (*setter_fn)(startup_data);
+    return;
+  }
+
   FILE* file = fopen(blob_file, "rb");
   if (!file) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
@@ -19,6 +19,7 @@
 #include "src/execution/runtime-profiler.h"
 #include "src/execution/simulator.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/isolate-allocator.h"
 #include "src/libsampler/sampler.h"
 #include "src/objects/elements.h"
 #include "src/objects/objects-inl.h"
@@ -52,6 +53,7 @@ void V8::TearDown() {
   CallDescriptors::TearDown();
   ElementsAccessor::TearDown();
   RegisteredExtension::UnregisterAll();
+  IsolateAllocator::FreeCachedReservations();
   FlagList::ResetAllFlags();  // Frees memory held by string arguments.
 }
 
@@ -93,6 +93,13 @@ Handle<BytecodeArray> BytecodeArrayBuilder::ToBytecodeArray(
   if (register_optimizer_) {
     register_optimizer_->Flush();
     register_count = register_optimizer_->maxiumum_register_index() + 1;
+    if (FLAG_trace_ignition_reo) {
+      PrintF("[ignition reo: emitted %d of %d register transfers, kept "
+             "equivalences at %d labels]\n",
+             register_optimizer_->emitted_transfers(),
+             register_optimizer_->requested_transfers(),
+             register_optimizer_->merged_labels());
+    }
   }
 
   Handle<ByteArray> handler_table =
@@ -175,6 +182,11 @@ void BytecodeArrayBuilder::Write(BytecodeNode* node) {
 void BytecodeArrayBuilder::WriteJump(BytecodeNode* node, BytecodeLabel* label) {
   AttachOrEmitDeferredSourceInfo(node);
   bytecode_array_writer_.WriteJump(node, label);
+  // Jumps in dead code are not emitted.
+  if (register_optimizer_ && FLAG_ignition_reo_across_jumps &&
+      label->has_referrer_jump()) {
+    register_optimizer_->RecordJumpState(label);
+  }
 }
 
 void BytecodeArrayBuilder::WriteJumpLoop(BytecodeNode* node,
@@ -1103,8 +1115,15 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::Bind(BytecodeLabel* label) {
   if (!label->has_referrer_jump()) return *this;
 
   // Flush the register optimizer when binding a label to ensure all
-  // expected registers are valid when jumping to this label.
-  if (register_optimizer_) register_optimizer_->Flush();
+  // expected registers are valid when jumping to this label. Only the
+  // equivalences that held at the jump need to be dropped though.
+  if (register_optimizer_) {
+    if (FLAG_ignition_reo_across_jumps) {
+      register_optimizer_->MergeJumpState(label);
+    } else {
+      register_optimizer_->Flush();
+    }
+  }
   bytecode_array_writer_.BindLabel(label);
   return *this;
 }
@@ -1130,7 +1149,11 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::Bind(BytecodeJumpTable* jump_table,
 BytecodeArrayBuilder& BytecodeArrayBuilder::MarkHandler(
     int handler_id, HandlerTable::CatchPrediction catch_prediction) {
   // The handler starts a new basic block, and any reasonable try block won't
-  // let control fall through into it.
+  // let control fall through into it. Jumps leave equivalence sets behind
+  // with --ignition-reo-across-jumps, which don't hold in the handler.
+  if (register_optimizer_ && FLAG_ignition_reo_across_jumps) {
+    register_optimizer_->Flush();
+  }
   DCHECK_IMPLIES(register_optimizer_,
                  register_optimizer_->EnsureAllRegistersAreFlushed());
   bytecode_array_writer_.BindHandlerTarget(handler_table_builder(), handler_id);
@@ -33,6 +33,8 @@ BytecodeArrayWriter::BytecodeArrayWriter(
       last_bytecode_offset_(0),
       last_bytecode_had_source_info_(false),
       elide_noneffectful_bytecodes_(FLAG_ignition_elide_noneffectful_bytecodes),
+      emit_superinstructions_(FLAG_ignition_superinstructions),
+      last_star_operand_(0),
       exit_seen_in_block_(false) {
   bytecodes_.reserve(512);  // Derived via experimentation.
 }
@@ -111,7 +113,11 @@ void BytecodeArrayWriter::Write(BytecodeNode* node) {
 
   if (exit_seen_in_block_) return;  // Don't emit dead code.
   UpdateExitSeenInBlock(node->bytecode());
+  if (MaybeFuseWithLastBytecode(node)) return;
   MaybeElideLastBytecode(node->bytecode(), node->source_info().is_valid());
+  if (node->bytecode() == Bytecode::kStar) {
+    last_star_operand_ = node->operand(0);
+  }
 
   UpdateSourcePositionTable(node);
   EmitBytecode(node);
@@ -266,6 +272,31 @@ void BytecodeArrayWriter::MaybeElideLastBytecode(Bytecode next_bytecode,
   last_bytecode_offset_ = bytecodes()->size();
 }
 
+bool BytecodeArrayWriter::MaybeFuseWithLastBytecode(
+    const BytecodeNode* const node) {
+  if (!emit_superinstructions_) return false;
+
+  // Replace a Star followed by a LdaNamedProperty in the same basic block by
+  // a StarLdaNamedProperty, which saves a dispatch. The source position of
+  // either of them is kept, but there's no room for both.
+  if (last_bytecode_ != Bytecode::kStar ||
+      node->bytecode() != Bytecode::kLdaNamedProperty ||
+      (last_bytecode_had_source_info_ && node->source_info().is_valid())) {
+    return false;
+  }
+  BytecodeNode fused = BytecodeNode::StarLdaNamedProperty(
+      node->source_info(), last_star_operand_, node->operand(0),
+      node->operand(1), node->operand(2));
+  DCHECK_GT(bytecodes()->size(), last_bytecode_offset_);
+  bytecodes()->resize(last_bytecode_offset_);
+  last_bytecode_ = fused.bytecode();
+  last_bytecode_had_source_info_ |= fused.source_info().is_valid();
+
+  UpdateSourcePositionTable(&fused);
+  EmitBytecode(&fused);
+  return true;
+}
+
 void BytecodeArrayWriter::InvalidateLastBytecode() {
   last_bytecode_ = Bytecode::kIllegal;
 }
@@ -101,6 +101,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
+  bool MaybeFuseWithLastBytecode(const BytecodeNode* const node);
   void InvalidateLastBytecode();
 
   void StartBasicBlock();
@@ -122,6 +123,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   size_t last_bytecode_offset_;
   bool last_bytecode_had_source_info_;
   bool elide_noneffectful_bytecodes_;
+  bool emit_superinstructions_;
+  // The register operand of the last bytecode if it is a Star.
+  uint32_t last_star_operand_;
 
   bool exit_seen_in_block_;
 
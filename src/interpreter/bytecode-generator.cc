@@ -2473,7 +2473,7 @@ void BytecodeGenerator::VisitInitializeClassMembersStatement(
     Runtime::FunctionId function_id =
         property->kind() == ClassLiteral::Property::FIELD &&
                 !property->is_private()
-            ? Runtime::kCreateDataProperty
+            ? Runtime::kInlineCreateDataProperty
             : Runtime::kAddPrivateField;
     builder()->CallRuntime(function_id, args);
   }
@@ -4,6 +4,11 @@
 
 #include "src/interpreter/bytecode-register-optimizer.h"
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
 namespace v8 {
 namespace internal {
 namespace interpreter {
@@ -224,6 +229,10 @@ BytecodeRegisterOptimizer::BytecodeRegisterOptimizer(
       register_info_table_(zone),
       registers_needing_flushed_(zone),
       equivalence_id_(0),
+      jump_states_(zone),
+      requested_transfers_(0),
+      emitted_transfers_(0),
+      merged_labels_(0),
       bytecode_writer_(bytecode_writer),
       flush_required_(false),
       zone_(zone) {
@@ -310,11 +319,117 @@ void BytecodeRegisterOptimizer::Flush() {
   flush_required_ = false;
 }
 
+void BytecodeRegisterOptimizer::MaterializeAllRegisters() {
+  if (!flush_required_) {
+    return;
+  }
+
+  // Like Flush(), but allocated registers stay in their equivalence sets, so
+  // they remain in registers_needing_flushed_ for the next Flush().
+  for (RegisterInfo* reg_info : registers_needing_flushed_) {
+    if (!reg_info->needs_flush()) continue;
+
+    RegisterInfo* materialized = GetMaterializedEquivalent(reg_info);
+    if (materialized == nullptr) {
+      DCHECK_NULL(reg_info->GetAllocatedEquivalent());
+      reg_info->set_needs_flush(false);
+      reg_info->MoveToNewEquivalenceSet(NextEquivalenceId(), false);
+      continue;
+    }
+
+    RegisterInfo* equivalent = materialized->GetEquivalent();
+    while (equivalent != materialized) {
+      RegisterInfo* next = equivalent->GetEquivalent();
+      if (!equivalent->allocated()) {
+        equivalent->set_needs_flush(false);
+        equivalent->MoveToNewEquivalenceSet(NextEquivalenceId(), true);
+      } else if (!equivalent->materialized()) {
+        OutputRegisterTransfer(materialized, equivalent);
+      }
+      equivalent = next;
+    }
+  }
+}
+
+void BytecodeRegisterOptimizer::RecordJumpState(const BytecodeLabel* label) {
+  DCHECK_EQ(jump_states_.count(label), 0u);
+  JumpState state(zone());
+  for (RegisterInfo* reg_info : registers_needing_flushed_) {
+    if (!reg_info->needs_flush() || reg_info->IsOnlyMemberOfEquivalenceSet()) {
+      continue;
+    }
+    RegisterInfo* visitor = reg_info;
+    do {
+      if (visitor->allocated()) {
+        state.push_back(
+            {GetRegisterInfoTableIndex(visitor->register_value()),
+             visitor->equivalence_id()});
+      }
+      visitor = visitor->GetEquivalent();
+    } while (visitor != reg_info);
+  }
+  // Sets with several members in registers_needing_flushed_ were visited more
+  // than once.
+  std::sort(state.begin(), state.end());
+  state.erase(std::unique(state.begin(), state.end()), state.end());
+  jump_states_.emplace(label, std::move(state));
+}
+
+void BytecodeRegisterOptimizer::MergeJumpState(const BytecodeLabel* label) {
+  auto it = jump_states_.find(label);
+  DCHECK(it != jump_states_.end());
+  JumpState state = std::move(it->second);
+  jump_states_.erase(it);
+
+  MaterializeAllRegisters();
+  if (!flush_required_) return;
+
+  // Collect the members of all equivalence sets with more than one member.
+  std::vector<RegisterInfo*> members;
+  std::set<uint32_t> visited_sets;
+  for (RegisterInfo* reg_info : registers_needing_flushed_) {
+    if (!reg_info->needs_flush() || reg_info->IsOnlyMemberOfEquivalenceSet() ||
+        !visited_sets.insert(reg_info->equivalence_id()).second) {
+      continue;
+    }
+    RegisterInfo* visitor = reg_info;
+    do {
+      members.push_back(visitor);
+      visitor = visitor->GetEquivalent();
+    } while (visitor != reg_info);
+  }
+
+  // Split the sets up by the equivalence ids at the jump. Registers that had
+  // no equivalent at the jump end up on their own.
+  std::map<std::pair<uint32_t, uint32_t>, RegisterInfo*> leaders;
+  for (RegisterInfo* member : members) {
+    uint32_t current_id = member->equivalence_id();
+    bool materialized = member->materialized();
+    member->MoveToNewEquivalenceSet(NextEquivalenceId(), materialized);
+
+    std::pair<size_t, uint32_t> key(
+        GetRegisterInfoTableIndex(member->register_value()), 0);
+    auto entry = std::lower_bound(state.begin(), state.end(), key);
+    if (!member->allocated() || entry == state.end() ||
+        entry->first != key.first) {
+      continue;
+    }
+    auto leader = leaders.emplace(std::make_pair(current_id, entry->second),
+                                  member);
+    if (leader.second) continue;
+    member->AddToEquivalenceSetOf(leader.first->second);
+    member->set_materialized(materialized);
+    PushToRegistersNeedingFlush(member);
+  }
+  merged_labels_++;
+}
+
 void BytecodeRegisterOptimizer::OutputRegisterTransfer(
     RegisterInfo* input_info, RegisterInfo* output_info) {
   Register input = input_info->register_value();
   Register output = output_info->register_value();
   DCHECK_NE(input.index(), output.index());
+  emitted_transfers_++;
 
   if (input == accumulator_) {
     bytecode_writer_->EmitStar(output);
@@ -379,6 +494,7 @@ void BytecodeRegisterOptimizer::AddToEquivalenceSet(
 
 void BytecodeRegisterOptimizer::RegisterTransfer(RegisterInfo* input_info,
                                                  RegisterInfo* output_info) {
+  requested_transfers_++;
   bool output_is_observable =
       RegisterIsObservable(output_info->register_value());
   bool in_same_equivalence_set =
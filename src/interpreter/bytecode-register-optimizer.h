@@ -7,12 +7,16 @@
 
 #include "src/base/compiler-specific.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/interpreter/bytecode-register-allocator.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
 namespace interpreter {
 
+class BytecodeLabel;
+
 // An optimization stage for eliminating unnecessary transfers between
 // registers. The bytecode generator uses temporary registers
 // liberally for correctness and convenience and this stage removes
@@ -62,6 +66,25 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   void Flush();
   bool EnsureAllRegistersAreFlushed() const;
 
+  // Materialize all live registers but keep the equivalence sets, which still
+  // hold once all of their members are materialized. Used for jumps with
+  // --ignition-reo-across-jumps.
+  void MaterializeAllRegisters();
+
+  // Records the equivalence sets at the jump to |label|, which has just been
+  // emitted.
+  void RecordJumpState(const BytecodeLabel* label);
+  // Reduces the equivalence sets to those that also held at the jump to
+  // |label|, which is about to be bound. Control reaches |label| either from
+  // that jump or by falling through, so the remaining equivalences hold on
+  // both paths.
+  void MergeJumpState(const BytecodeLabel* label);
+
+  // Statistics for --trace-ignition-reo.
+  int requested_transfers() const { return requested_transfers_; }
+  int emitted_transfers() const { return emitted_transfers_; }
+  int merged_labels() const { return merged_labels_; }
+
   // Prepares for |bytecode|.
   template <Bytecode bytecode, AccumulatorUse accumulator_use>
   V8_INLINE void PrepareForBytecode() {
@@ -77,7 +100,13 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
       // - a call to the debugger (as it can manipulate locals and parameters),
       // - a generator suspend (as this involves saving all registers).
       // - a generator register restore.
-      Flush();
+      // The equivalences still hold after a jump though, as only the
+      // registers need to be materialized.
+      if (FLAG_ignition_reo_across_jumps && Bytecodes::IsJump(bytecode)) {
+        MaterializeAllRegisters();
+      } else {
+        Flush();
+      }
     }
 
     // Materialize the accumulator if it is read by the bytecode. The
@@ -114,6 +143,11 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
   class RegisterInfo;
 
+  // The equivalence ids of the allocated registers that shared an
+  // equivalence set with another register at a jump, sorted by register info
+  // table index.
+  using JumpState = ZoneVector<std::pair<size_t, uint32_t>>;
+
   // BytecodeRegisterAllocator::Observer interface.
   void RegisterAllocateEvent(Register reg) override;
   void RegisterListAllocateEvent(RegisterList reg_list) override;
@@ -198,6 +232,12 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   // Counter for equivalence sets identifiers.
   int equivalence_id_;
 
+  ZoneMap<const BytecodeLabel*, JumpState> jump_states_;
+
+  int requested_transfers_;
+  int emitted_transfers_;
+  int merged_labels_;
+
   BytecodeWriter* bytecode_writer_;
   bool flush_required_;
   Zone* zone_;
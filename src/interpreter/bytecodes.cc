@@ -272,6 +272,7 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaUndefined:
       case Bytecode::kLdaGlobal:
       case Bytecode::kLdaNamedProperty:
+      case Bytecode::kStarLdaNamedProperty:
       case Bytecode::kLdaKeyedProperty:
       case Bytecode::kLdaContextSlot:
       case Bytecode::kLdaCurrentContextSlot:
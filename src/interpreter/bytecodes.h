@@ -105,6 +105,10 @@ namespace interpreter {
   V(LdaKeyedProperty, AccumulatorUse::kReadWrite, OperandType::kReg,           \
     OperandType::kIdx)                                                         \
                                                                                \
+  /* Superinstructions */                                                      \
+  V(StarLdaNamedProperty, AccumulatorUse::kReadWrite, OperandType::kRegOut,    \
+    OperandType::kReg, OperandType::kIdx, OperandType::kIdx)                   \
+                                                                               \
   /* Operations on module variables */                                         \
   V(LdaModuleVariable, AccumulatorUse::kWrite, OperandType::kImm,              \
     OperandType::kUImm)                                                        \
@@ -504,39 +504,62 @@ IGNITION_HANDLER(StaLookupSlot, InterpreterAssembler) {
   }
 }
 
-// LdaNamedProperty <object> <name_index> <slot>
-//
-// Calls the LoadIC at FeedBackVector slot <slot> for <object> and the name at
-// constant pool entry <name_index>.
-IGNITION_HANDLER(LdaNamedProperty, InterpreterAssembler) {
-  TNode<HeapObject> feedback_vector = LoadFeedbackVector();
+class InterpreterLoadNamedPropertyAssembler : public InterpreterAssembler {
+ public:
+  InterpreterLoadNamedPropertyAssembler(CodeAssemblerState* state,
+                                        Bytecode bytecode,
+                                        OperandScale operand_scale)
+      : InterpreterAssembler(state, bytecode, operand_scale) {}
 
-  // Load receiver.
-  TNode<Object> recv = LoadRegisterAtOperandIndex(0);
+  void LdaNamedProperty(int object_operand_index, int name_operand_index,
+                        int slot_operand_index) {
+    TNode<HeapObject> feedback_vector = LoadFeedbackVector();
 
-  // Load the name and context lazily.
-  LazyNode<TaggedIndex> lazy_slot = [=] {
-    return BytecodeOperandIdxTaggedIndex(2);
-  };
-  LazyNode<Name> lazy_name = [=] {
-    return CAST(LoadConstantPoolEntryAtOperandIndex(1));
-  };
-  LazyNode<Context> lazy_context = [=] { return GetContext(); };
+    // Load receiver.
+    TNode<Object> recv = LoadRegisterAtOperandIndex(object_operand_index);
 
-  Label done(this);
-  TVARIABLE(Object, var_result);
-  ExitPoint exit_point(this, &done, &var_result);
+    // Load the name and context lazily.
+    LazyNode<TaggedIndex> lazy_slot = [=] {
+      return BytecodeOperandIdxTaggedIndex(slot_operand_index);
+    };
+    LazyNode<Name> lazy_name = [=] {
+      return CAST(LoadConstantPoolEntryAtOperandIndex(name_operand_index));
+    };
+    LazyNode<Context> lazy_context = [=] { return GetContext(); };
+
+    Label done(this);
+    TVARIABLE(Object, var_result);
+    ExitPoint exit_point(this, &done, &var_result);
 
-  AccessorAssembler::LazyLoadICParameters params(lazy_context, recv, lazy_name,
-                                                 lazy_slot, feedback_vector);
-  AccessorAssembler accessor_asm(state());
-  accessor_asm.LoadIC_BytecodeHandler(&params, &exit_point);
+    AccessorAssembler::LazyLoadICParameters params(
+        lazy_context, recv, lazy_name, lazy_slot, feedback_vector);
+    AccessorAssembler accessor_asm(state());
+    accessor_asm.LoadIC_BytecodeHandler(&params, &exit_point);
 
-  BIND(&done);
-  {
-    SetAccumulator(var_result.value());
-    Dispatch();
+    BIND(&done);
+    {
+      SetAccumulator(var_result.value());
+      Dispatch();
+    }
   }
+};
+
+// LdaNamedProperty <object> <name_index> <slot>
+//
+// Calls the LoadIC at FeedBackVector slot <slot> for <object> and the name at
+// constant pool entry <name_index>.
+IGNITION_HANDLER(LdaNamedProperty, InterpreterLoadNamedPropertyAssembler) {
+  LdaNamedProperty(0, 1, 2);
+}
+
+// StarLdaNamedProperty <dst> <object> <name_index> <slot>
+//
+// Stores the accumulator in register <dst>, then does what LdaNamedProperty
+// does. Replaces a Star followed by a LdaNamedProperty, which is what chains
+// of property loads look like.
+IGNITION_HANDLER(StarLdaNamedProperty, InterpreterLoadNamedPropertyAssembler) {
+  StoreRegisterAtOperandIndex(GetAccumulator(), 0);
+  LdaNamedProperty(1, 2, 3);
 }
 
 // LdaNamedPropertyNoFeedback <object> <name_index>
@@ -200,6 +200,13 @@ TNode<Object> IntrinsicsGenerator::CopyDataProperties(
       Builtins::CallableFor(isolate(), Builtins::kCopyDataProperties));
 }
 
+TNode<Object> IntrinsicsGenerator::CreateDataProperty(
+    const InterpreterAssembler::RegListNodePair& args, TNode<Context> context) {
+  return IntrinsicAsStubCall(
+      args, context,
+      Builtins::CallableFor(isolate(), Builtins::kCreateDataProperty));
+}
+
 TNode<Object> IntrinsicsGenerator::CreateIterResultObject(
     const InterpreterAssembler::RegListNodePair& args, TNode<Context> context) {
   return IntrinsicAsStubCall(
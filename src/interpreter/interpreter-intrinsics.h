@@ -32,6 +32,7 @@ namespace interpreter {
   V(CopyDataProperties, copy_data_properties, 2)                     \
   V(CreateIterResultObject, create_iter_result_object, 2)            \
   V(CreateAsyncFromSyncIterator, create_async_from_sync_iterator, 1) \
+  V(CreateDataProperty, create_data_property, 3)                     \
   V(HasProperty, has_property, 2)                                    \
   V(IsArray, is_array, 1)                                            \
   V(IsJSReceiver, is_js_receiver, 1)                                 \
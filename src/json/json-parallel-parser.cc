@@ -0,0 +1,672 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-parallel-parser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/local-factory-inl.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/init/v8.h"
+#include "src/numbers/conversions.h"
+#include "src/objects/objects-inl.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/utils/memcopy.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The workers describe the values they parse in postfix order. Values are
+// pushed onto a stack when the entries are replayed on the main thread, and
+// the end of an array or object pops its elements or its key-value pairs.
+struct JsonTapeEntry {
+  enum Kind : uint8_t {
+    kSmi,
+    kHeapValue,
+    kNull,
+    kTrue,
+    kFalse,
+    kArrayEnd,
+    kObjectEnd,
+  };
+
+  Kind kind;
+  // The value of a Smi, or the number of elements or properties.
+  uint32_t payload;
+  // A persistent handle to a string or heap number.
+  Handle<Object> value;
+};
+
+// A range of top-level array elements, separated by commas.
+struct JsonChunk {
+  int start;
+  int end;
+  std::vector<JsonTapeEntry> tape;
+  // Owns the handles in {tape} once the worker is done with the chunk.
+  std::unique_ptr<PersistentHandles> handles;
+  uint32_t num_elements = 0;
+  bool success = false;
+};
+
+// State shared between the main thread and the workers.
+struct JsonParseState {
+  JsonParseState(Isolate* isolate, int num_chunks, size_t max_threads)
+      : isolate(isolate), chunks(num_chunks), max_threads(max_threads) {}
+
+  Isolate* const isolate;
+  std::vector<JsonChunk> chunks;
+  const size_t max_threads;
+  std::atomic<size_t> next_chunk{0};
+  std::atomic<size_t> chunks_done{0};
+  std::atomic<bool> failed{false};
+  base::Semaphore chunk_done{0};
+};
+
+template <typename Char>
+class JsonChunkParser {
+ public:
+  JsonChunkParser(LocalIsolate* isolate, const Char* chars, JsonChunk* chunk,
+                  const std::atomic<bool>* failed)
+      : isolate_(isolate),
+        chunk_(chunk),
+        failed_(failed),
+        cursor_(chars + chunk->start),
+        end_(chars + chunk->end) {}
+
+  // Parses a comma separated list of values up to the end of the chunk.
+  bool Parse() {
+    while (true) {
+      LocalHandleScope scope(isolate_);
+      if (!ParseValue()) return false;
+      chunk_->num_elements++;
+      SkipWhitespace();
+      if (cursor_ == end_) return true;
+      if (*cursor_ != ',') return false;
+      cursor_++;
+    }
+  }
+
+ private:
+  struct Container {
+    bool is_object;
+    uint32_t count;
+  };
+
+  // Values are parsed without recursion, deeply nested input only grows
+  // {containers_}.
+  bool ParseValue() {
+    DCHECK(containers_.empty());
+    while (true) {
+      if (++steps_ % kStepsPerSafepoint == 0) {
+        if (failed_->load(std::memory_order_relaxed)) return false;
+        isolate_->heap()->Safepoint();
+      }
+
+      SkipWhitespace();
+      if (cursor_ == end_) return false;
+      switch (*cursor_) {
+        case '{':
+          cursor_++;
+          SkipWhitespace();
+          if (cursor_ != end_ && *cursor_ == '}') {
+            cursor_++;
+            Emit(JsonTapeEntry::kObjectEnd, 0);
+            break;
+          }
+          containers_.push_back({true, 0});
+          if (!ParsePropertyKey()) return false;
+          continue;
+        case '[':
+          cursor_++;
+          SkipWhitespace();
+          if (cursor_ != end_ && *cursor_ == ']') {
+            cursor_++;
+            Emit(JsonTapeEntry::kArrayEnd, 0);
+            break;
+          }
+          containers_.push_back({false, 0});
+          continue;
+        case '"':
+          if (!ParseString(false)) return false;
+          break;
+        case 't':
+          if (!ScanLiteral("true")) return false;
+          Emit(JsonTapeEntry::kTrue, 0);
+          break;
+        case 'f':
+          if (!ScanLiteral("false")) return false;
+          Emit(JsonTapeEntry::kFalse, 0);
+          break;
+        case 'n':
+          if (!ScanLiteral("null")) return false;
+          Emit(JsonTapeEntry::kNull, 0);
+          break;
+        default:
+          if (!ParseNumber()) return false;
+          break;
+      }
+
+      // A value is complete, close the containers that end after it.
+      while (true) {
+        if (containers_.empty()) return true;
+        Container& container = containers_.back();
+        container.count++;
+        SkipWhitespace();
+        if (cursor_ == end_) return false;
+        Char c = *cursor_++;
+        if (c == ',') {
+          if (container.is_object && !ParsePropertyKey()) return false;
+          break;
+        }
+        if (c != (container.is_object ? '}' : ']')) return false;
+        Emit(container.is_object ? JsonTapeEntry::kObjectEnd
+                                 : JsonTapeEntry::kArrayEnd,
+             container.count);
+        containers_.pop_back();
+      }
+    }
+  }
+
+  bool ParsePropertyKey() {
+    SkipWhitespace();
+    if (cursor_ == end_ || *cursor_ != '"') return false;
+    if (!ParseString(true)) return false;
+    SkipWhitespace();
+    if (cursor_ == end_ || *cursor_ != ':') return false;
+    cursor_++;
+    return true;
+  }
+
+  bool ParseString(bool is_key) {
+    DCHECK_EQ('"', *cursor_);
+    cursor_++;
+    const Char* start = cursor_;
+    uc32 bits = 0;
+    while (true) {
+      if (cursor_ == end_) return false;
+      Char c = *cursor_;
+      if (c == '"') break;
+      if (c < 0x20) return false;
+      if (c == '\\') {
+        buffer_.assign(start, cursor_);
+        return ParseEscapedString(bits, is_key);
+      }
+      bits |= c;
+      cursor_++;
+    }
+    Vector<const Char> chars(start, static_cast<int>(cursor_ - start));
+    cursor_++;
+    EmitString(chars, bits <= unibrow::Latin1::kMaxChar, is_key);
+    return true;
+  }
+
+  // Continues ParseString at the first escape sequence, collecting the
+  // characters in {buffer_}.
+  bool ParseEscapedString(uc32 bits, bool is_key) {
+    while (true) {
+      if (cursor_ == end_) return false;
+      uc32 c = *cursor_++;
+      if (c == '"') break;
+      if (c < 0x20) return false;
+      if (c == '\\') {
+        if (cursor_ == end_) return false;
+        switch (*cursor_++) {
+          case '"':
+            c = '"';
+            break;
+          case '\\':
+            c = '\\';
+            break;
+          case '/':
+            c = '/';
+            break;
+          case 'b':
+            c = '\x08';
+            break;
+          case 'f':
+            c = '\x0C';
+            break;
+          case 'n':
+            c = '\x0A';
+            break;
+          case 'r':
+            c = '\x0D';
+            break;
+          case 't':
+            c = '\x09';
+            break;
+          case 'u':
+            c = 0;
+            for (int i = 0; i < 4; i++) {
+              if (cursor_ == end_) return false;
+              int digit = HexValue(*cursor_++);
+              if (digit < 0) return false;
+              c = c * 16 + digit;
+            }
+            break;
+          default:
+            return false;
+        }
+      }
+      bits |= c;
+      buffer_.push_back(static_cast<uc16>(c));
+    }
+    Vector<const uc16> chars(buffer_.data(), static_cast<int>(buffer_.size()));
+    EmitString(chars, bits <= unibrow::Latin1::kMaxChar, is_key);
+    return true;
+  }
+
+  bool ParseNumber() {
+    const Char* start = cursor_;
+    bool negative = *cursor_ == '-';
+    if (negative) cursor_++;
+    if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+    if (*cursor_ == '0') {
+      // A leading zero is only allowed if it is the only digit before a
+      // decimal point or exponent.
+      cursor_++;
+      if (cursor_ != end_ && IsDecimalDigit(*cursor_)) return false;
+    } else {
+      AdvanceToNonDecimal();
+    }
+    const Char* integer_end = cursor_;
+
+    bool is_integer = true;
+    if (cursor_ != end_ && *cursor_ == '.') {
+      is_integer = false;
+      cursor_++;
+      if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+      AdvanceToNonDecimal();
+    }
+    if (cursor_ != end_ && AsciiAlphaToLower(*cursor_) == 'e') {
+      is_integer = false;
+      cursor_++;
+      if (cursor_ != end_ && (*cursor_ == '-' || *cursor_ == '+')) cursor_++;
+      if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+      AdvanceToNonDecimal();
+    }
+
+    // Like JsonParser, handle integers of up to nine digits as Smis, except
+    // for -0.
+    const Char* digits = negative ? start + 1 : start;
+    STATIC_ASSERT(Smi::IsValid(-999999999));
+    STATIC_ASSERT(Smi::IsValid(999999999));
+    const int kMaxSmiLength = 9;
+    if (is_integer && integer_end - digits <= kMaxSmiLength &&
+        !(negative && *digits == '0')) {
+      int32_t value = 0;
+      for (const Char* p = digits; p != integer_end; p++) {
+        value = value * 10 + (*p - '0');
+      }
+      Emit(JsonTapeEntry::kSmi,
+           static_cast<uint32_t>(negative ? -value : value));
+      return true;
+    }
+
+    Vector<const Char> chars(start, static_cast<int>(cursor_ - start));
+    double number = StringToDouble(chars, NO_FLAGS,
+                                   std::numeric_limits<double>::quiet_NaN());
+    DCHECK(!std::isnan(number));
+    Handle<Object> value =
+        isolate_->factory()->NewNumber<AllocationType::kOld>(number);
+    if (value->IsSmi()) {
+      Emit(JsonTapeEntry::kSmi, static_cast<uint32_t>(Smi::ToInt(*value)));
+    } else {
+      EmitHeapValue(value);
+    }
+    return true;
+  }
+
+  bool ScanLiteral(const char* literal) {
+    for (const char* p = literal; *p != '\0'; p++) {
+      if (cursor_ == end_ || *cursor_ != *p) return false;
+      cursor_++;
+    }
+    return true;
+  }
+
+  void SkipWhitespace() {
+    while (cursor_ != end_ && (*cursor_ == ' ' || *cursor_ == '\t' ||
+                               *cursor_ == '\n' || *cursor_ == '\r')) {
+      cursor_++;
+    }
+  }
+
+  void AdvanceToNonDecimal() {
+    while (cursor_ != end_ && IsDecimalDigit(*cursor_)) cursor_++;
+  }
+
+  // Property names and short strings are internalized, like JsonParser does.
+  template <typename SrcChar>
+  void EmitString(Vector<const SrcChar> chars, bool is_one_byte, bool is_key) {
+    static const int kMaxInternalizedStringValueLength = 10;
+    LocalFactory* factory = isolate_->factory();
+    Handle<String> string;
+    if (is_key || chars.length() <= kMaxInternalizedStringValueLength) {
+      string = Internalize(chars);
+    } else if (is_one_byte) {
+      Handle<SeqOneByteString> result =
+          factory->NewRawOneByteString(chars.length(), AllocationType::kOld)
+              .ToHandleChecked();
+      DisallowHeapAllocation no_gc;
+      CopyChars(result->GetChars(no_gc), chars.begin(), chars.length());
+      string = result;
+    } else {
+      Handle<SeqTwoByteString> result =
+          factory->NewRawTwoByteString(chars.length(), AllocationType::kOld)
+              .ToHandleChecked();
+      DisallowHeapAllocation no_gc;
+      CopyChars(result->GetChars(no_gc), chars.begin(), chars.length());
+      string = result;
+    }
+    EmitHeapValue(string);
+  }
+
+  Handle<String> Internalize(Vector<const uint8_t> chars) {
+    return isolate_->factory()->InternalizeString(chars);
+  }
+
+  Handle<String> Internalize(Vector<const uint16_t> chars) {
+    return isolate_->factory()->InternalizeString(chars, true);
+  }
+
+  void Emit(JsonTapeEntry::Kind kind, uint32_t payload) {
+    chunk_->tape.push_back({kind, payload, Handle<Object>()});
+  }
+
+  void EmitHeapValue(Handle<Object> value) {
+    chunk_->tape.push_back({JsonTapeEntry::kHeapValue, 0,
+                            isolate_->heap()->NewPersistentHandle(value)});
+  }
+
+  static const int kStepsPerSafepoint = 1024;
+
+  LocalIsolate* const isolate_;
+  JsonChunk* const chunk_;
+  const std::atomic<bool>* const failed_;
+  const Char* cursor_;
+  const Char* const end_;
+  std::vector<Container> containers_;
+  std::vector<uc16> buffer_;
+  int steps_ = 0;
+};
+
+template <typename Char>
+class JsonParseJob final : public JobTask {
+ public:
+  JsonParseJob(JsonParseState* state, const Char* chars)
+      : state_(state), chars_(chars) {}
+
+  void Run(JobDelegate* delegate) override {
+    LocalIsolate local_isolate(state_->isolate, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(local_isolate.heap());
+    while (!delegate->ShouldYield()) {
+      size_t index = state_->next_chunk.fetch_add(1, std::memory_order_relaxed);
+      if (index >= state_->chunks.size()) break;
+      JsonChunk* chunk = &state_->chunks[index];
+      // Don't bother parsing the rest once any chunk turned out to be invalid.
+      if (!state_->failed.load(std::memory_order_relaxed)) {
+        JsonChunkParser<Char> parser(&local_isolate, chars_, chunk,
+                                     &state_->failed);
+        chunk->success = parser.Parse();
+        if (!chunk->success) {
+          state_->failed.store(true, std::memory_order_relaxed);
+        }
+      }
+      chunk->handles = local_isolate.heap()->DetachPersistentHandles();
+      state_->chunks_done.fetch_add(1, std::memory_order_release);
+      state_->chunk_done.Signal();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t num_chunks = state_->chunks.size();
+    size_t next = state_->next_chunk.load(std::memory_order_relaxed);
+    size_t remaining = num_chunks - std::min(next, num_chunks);
+    return std::min(state_->max_threads, worker_count + remaining);
+  }
+
+ private:
+  JsonParseState* const state_;
+  const Char* const chars_;
+};
+
+// Finds the top-level array and splits its elements into {num_chunks} ranges
+// of about the same length, at commas between top-level elements. This only
+// follows the nesting of brackets and strings, the workers check the rest of
+// the syntax.
+template <typename Char>
+bool SplitIntoChunks(const Char* chars, int length, int num_chunks,
+                     std::vector<int>* boundaries) {
+  const Char* const end = chars + length;
+  const Char* p = chars;
+  auto is_whitespace = [](Char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  };
+  while (p != end && is_whitespace(*p)) p++;
+  if (p == end || *p != '[') return false;
+  p++;
+  boundaries->push_back(static_cast<int>(p - chars));
+
+  const int chunk_length = length / num_chunks;
+  const Char* next_split = p + chunk_length;
+  int depth = 1;
+  while (true) {
+    if (p == end) return false;
+    Char c = *p++;
+    if (c == '"') {
+      while (true) {
+        if (p == end) return false;
+        Char string_char = *p++;
+        if (string_char == '"') break;
+        if (string_char == '\\') {
+          if (p == end) return false;
+          p++;
+        }
+      }
+    } else if (c == '[' || c == '{') {
+      depth++;
+    } else if (c == ']' || c == '}') {
+      if (--depth == 0) break;
+    } else if (c == ',' && depth == 1 && p > next_split) {
+      boundaries->push_back(static_cast<int>(p - chars));
+      next_split = p + chunk_length;
+    }
+  }
+  // {p} is just past the closing bracket, which ends the last chunk.
+  boundaries->push_back(static_cast<int>(p - chars));
+  while (p != end && is_whitespace(*p)) p++;
+  return p == end;
+}
+
+Handle<JSArray> BuildArray(Isolate* isolate, const Handle<Object>* elements,
+                           uint32_t length) {
+  Factory* factory = isolate->factory();
+  if (length == 0) return factory->NewJSArray(0, PACKED_SMI_ELEMENTS);
+  bool all_smis = true;
+  Handle<FixedArray> fixed_array = factory->NewFixedArray(length);
+  DisallowHeapAllocation no_gc;
+  WriteBarrierMode mode = fixed_array->GetWriteBarrierMode(no_gc);
+  for (uint32_t i = 0; i < length; i++) {
+    Object element = *elements[i];
+    all_smis &= element.IsSmi();
+    fixed_array->set(i, element, mode);
+  }
+  return factory->NewJSArrayWithElements(
+      fixed_array, all_smis ? PACKED_SMI_ELEMENTS : PACKED_ELEMENTS, length);
+}
+
+Handle<JSObject> BuildObject(Isolate* isolate, const Handle<Object>* pairs,
+                             uint32_t num_properties) {
+  Handle<JSObject> object =
+      isolate->factory()->NewJSObject(isolate->object_function());
+  for (uint32_t i = 0; i < num_properties; i++) {
+    Handle<Name> key = Handle<Name>::cast(pairs[2 * i]);
+    // Later duplicates replace the value but keep the original position,
+    // like CreateDataProperty.
+    JSObject::DefinePropertyOrElementIgnoreAttributes(object, key,
+                                                      pairs[2 * i + 1])
+        .Check();
+  }
+  return object;
+}
+
+// Replays the tapes of all chunks in order and builds the top-level array.
+Handle<JSArray> BuildResult(Isolate* isolate, JsonParseState* state) {
+  Factory* factory = isolate->factory();
+  std::vector<Handle<Object>> stack;
+  for (JsonChunk& chunk : state->chunks) {
+    for (const JsonTapeEntry& entry : chunk.tape) {
+      switch (entry.kind) {
+        case JsonTapeEntry::kSmi:
+          stack.push_back(handle(
+              Smi::FromInt(static_cast<int32_t>(entry.payload)), isolate));
+          break;
+        case JsonTapeEntry::kHeapValue:
+          stack.push_back(entry.value);
+          break;
+        case JsonTapeEntry::kNull:
+          stack.push_back(factory->null_value());
+          break;
+        case JsonTapeEntry::kTrue:
+          stack.push_back(factory->true_value());
+          break;
+        case JsonTapeEntry::kFalse:
+          stack.push_back(factory->false_value());
+          break;
+        case JsonTapeEntry::kArrayEnd: {
+          size_t first = stack.size() - entry.payload;
+          Handle<Object> array =
+              BuildArray(isolate, stack.data() + first, entry.payload);
+          stack.resize(first);
+          stack.push_back(array);
+          break;
+        }
+        case JsonTapeEntry::kObjectEnd: {
+          size_t first = stack.size() - 2 * size_t{entry.payload};
+          Handle<Object> object =
+              BuildObject(isolate, stack.data() + first, entry.payload);
+          stack.resize(first);
+          stack.push_back(object);
+          break;
+        }
+      }
+    }
+  }
+  return BuildArray(isolate, stack.data(), static_cast<uint32_t>(stack.size()));
+}
+
+template <typename Char>
+MaybeHandle<Object> ParseInParallel(Isolate* isolate, const Char* chars,
+                                    int length, int num_threads) {
+  // A few chunks per thread keep the threads busy if the elements don't all
+  // take the same time to parse.
+  const int kChunksPerThread = 4;
+  std::vector<int> boundaries;
+  if (!SplitIntoChunks(chars, length, num_threads * kChunksPerThread,
+                       &boundaries)) {
+    return MaybeHandle<Object>();
+  }
+  int num_chunks = static_cast<int>(boundaries.size()) - 1;
+  if (num_chunks < 2) return MaybeHandle<Object>();
+
+  // Chunks end at the comma or closing bracket after their last element.
+  JsonParseState state(isolate, num_chunks, num_threads);
+  for (int i = 0; i < num_chunks; i++) {
+    state.chunks[i].start = boundaries[i];
+    state.chunks[i].end = boundaries[i + 1] - 1;
+  }
+
+  std::unique_ptr<JobHandle> job = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking,
+      std::make_unique<JsonParseJob<Char>>(&state, chars));
+  // Workers that run out of space wait for the main thread to collect
+  // garbage, so keep serving their requests until all chunks are parsed.
+  while (state.chunks_done.load(std::memory_order_acquire) <
+         state.chunks.size()) {
+    state.chunk_done.WaitFor(base::TimeDelta::FromMilliseconds(1));
+    isolate->heap()->CheckCollectionRequested();
+  }
+  job->Join();
+
+  for (const JsonChunk& chunk : state.chunks) {
+    if (!chunk.success) return MaybeHandle<Object>();
+  }
+  return BuildResult(isolate, &state);
+}
+
+}  // namespace
+
+// static
+MaybeHandle<Object> JsonParallelParser::TryParse(Isolate* isolate,
+                                                 Handle<String> source,
+                                                 int max_threads) {
+  if (!FLAG_local_heaps || !FLAG_concurrent_allocation) {
+    return MaybeHandle<Object>();
+  }
+  if (source->length() < kMinParallelLength) return MaybeHandle<Object>();
+  int num_threads = V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  if (max_threads > 0) num_threads = std::min(num_threads, max_threads);
+  if (num_threads < 2) return MaybeHandle<Object>();
+
+  HandleScope scope(isolate);
+  source = String::Flatten(isolate, source);
+  int start = 0;
+  String string = *source;
+  if (string.IsSlicedString()) {
+    start = SlicedString::cast(string).offset();
+    string = SlicedString::cast(string).parent();
+  }
+  if (string.IsThinString()) string = ThinString::cast(string).actual();
+
+  // The workers read the characters without handles, so they must not move.
+  // That holds for external strings and strings in large object space.
+  if (!StringShape(string).IsExternal() && !Heap::IsLargeObject(string)) {
+    return MaybeHandle<Object>();
+  }
+
+  MaybeHandle<Object> result;
+  if (string.IsOneByteRepresentation()) {
+    const uint8_t* chars;
+    if (string.IsExternalString()) {
+      chars = ExternalOneByteString::cast(string).GetChars();
+    } else {
+      DisallowHeapAllocation no_gc;
+      chars = SeqOneByteString::cast(string).GetChars(no_gc);
+    }
+    result = ParseInParallel(isolate, chars + start, source->length(),
+                             num_threads);
+  } else {
+    const uint16_t* chars;
+    if (string.IsExternalString()) {
+      chars = ExternalTwoByteString::cast(string).GetChars();
+    } else {
+      DisallowHeapAllocation no_gc;
+      chars = SeqTwoByteString::cast(string).GetChars(no_gc);
+    }
+    result = ParseInParallel(isolate, chars + start, source->length(),
+                             num_threads);
+  }
+  Handle<Object> value;
+  if (!result.ToHandle(&value)) return MaybeHandle<Object>();
+  return scope.CloseAndEscape(value);
+}
+
+}  // namespace internal
+}  // namespace v8
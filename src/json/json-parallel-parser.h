@@ -0,0 +1,39 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_PARALLEL_PARSER_H_
+#define V8_JSON_JSON_PARALLEL_PARSER_H_
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class String;
+
+// Parses JSON text whose top-level value is a large array by splitting the
+// array elements into ranges that are parsed on worker threads. The workers
+// scan the text, internalize property names and allocate strings and heap
+// numbers on their own LocalHeaps. The main thread then builds the arrays and
+// objects from what the workers produced.
+class JsonParallelParser final {
+ public:
+  // Texts shorter than this are parsed faster by JsonParser alone.
+  static const int kMinParallelLength = 1 * MB;
+
+  // Returns the parsed value, or an empty handle if {source} can't be parsed
+  // in parallel or isn't valid JSON. Nothing is thrown in either case; the
+  // caller is expected to fall back to JsonParser, which also reports the
+  // syntax errors. {max_threads} limits the number of worker threads used, or
+  // is 0 to use as many as the platform provides.
+  static MaybeHandle<Object> TryParse(Isolate* isolate, Handle<String> source,
+                                      int max_threads);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_PARALLEL_PARSER_H_
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/numbers/conversions.h"
@@ -115,6 +116,60 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Word-at-a-time scanning of string contents. A word of characters can be
+// skipped as a whole if none of its characters may terminate a JSON string,
+// i.e. it contains no '"', no '\\' and no control character.
+template <typename Char>
+class JsonStringWordScanner {
+ public:
+  using Word = uintptr_t;
+  static constexpr int kCharsPerWord = sizeof(Word) / sizeof(Char);
+
+  // Returns the first position in [cursor, end) that is not part of a word
+  // without terminator candidates. The remaining characters have to be
+  // checked one at a time. Every character skipped is or'ed into |bits|.
+  static const Char* Skip(const Char* cursor, const Char* end, uc32* bits) {
+    Word all_chars = 0;
+    while (end - cursor >= kCharsPerWord) {
+      Word word =
+          base::ReadUnalignedValue<Word>(reinterpret_cast<Address>(cursor));
+      if (MayContainTerminator(word)) break;
+      all_chars |= word;
+      cursor += kCharsPerWord;
+    }
+    if (sizeof(Char) == 2) *bits |= FoldLanes(all_chars);
+    return cursor;
+  }
+
+ private:
+  static constexpr Word kLaneOnes =
+      ~Word{0} / ((Word{1} << (8 * sizeof(Char))) - 1);
+  static constexpr Word kLaneHighBits = kLaneOnes << (8 * sizeof(Char) - 1);
+
+  // Standard "has zero lane" / "has lane less than n" bit tricks. They may set
+  // spurious bits above the first matching lane, which is fine since we only
+  // test the whole word.
+  static constexpr Word HasLaneLessThan(Word word, Char n) {
+    return (word - kLaneOnes * n) & ~word & kLaneHighBits;
+  }
+  static constexpr Word HasLaneEqualTo(Word word, Char c) {
+    return HasLaneLessThan(word ^ (kLaneOnes * c), 1);
+  }
+
+  static constexpr bool MayContainTerminator(Word word) {
+    return (HasLaneLessThan(word, 0x20) | HasLaneEqualTo(word, '"') |
+            HasLaneEqualTo(word, '\\')) != 0;
+  }
+
+  static uc32 FoldLanes(Word word) {
+    uc32 result = 0;
+    for (int i = 0; i < kCharsPerWord; i++) {
+      result |= static_cast<Char>(word >> (i * 8 * sizeof(Char)));
+    }
+    return result;
+  }
+};
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -990,10 +1045,10 @@ bool Matches(const Vector<const Char>& chars, Handle<String> string) {
   DisallowHeapAllocation no_gc;
   if (string->IsOneByteRepresentation()) {
     const uint8_t* string_data = string->GetChars<uint8_t>(no_gc);
-    return CompareChars(chars.begin(), string_data, chars.length()) == 0;
+    return CompareCharsEqual(chars.begin(), string_data, chars.length());
   }
   const uint16_t* string_data = string->GetChars<uint16_t>(no_gc);
-  return CompareChars(chars.begin(), string_data, chars.length()) == 0;
+  return CompareCharsEqual(chars.begin(), string_data, chars.length());
 }
 
 }  // namespace
@@ -1042,6 +1097,16 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
     return factory()->InternalizeString(chars, string.needs_conversion());
   }
 
+  // Strings that are a plain copy of the source can be slices of it instead.
+  // Large responses are often parsed for a few fields only, but this keeps
+  // the whole source alive for as long as any of the slices.
+  if (FLAG_json_slice_strings && !string.has_escape() &&
+      !string.needs_conversion() &&
+      string.length() >= SlicedString::kMinLength) {
+    return factory()->NewProperSubString(source_, string.start(),
+                                         string.start() + string.length());
+  }
+
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
@@ -1127,6 +1192,9 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   uc32 bits = 0;
 
   while (true) {
+    // For two-byte strings this ors in all characters rather than only the
+    // non-Latin1 ones, which does not change whether |bits| is in Latin1 range.
+    cursor_ = JsonStringWordScanner<Char>::Skip(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -21,7 +21,8 @@ namespace internal {
 
 class JsonStringifier {
  public:
-  explicit JsonStringifier(Isolate* isolate);
+  explicit JsonStringifier(Isolate* isolate,
+                           IncrementalStringBuilderSink* sink = nullptr);
 
   ~JsonStringifier() { DeleteArray(gap_); }
 
@@ -143,6 +144,15 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+MaybeHandle<Object> JsonStringifyToSink(Isolate* isolate, Handle<Object> object,
+                                        Handle<Object> replacer,
+                                        Handle<Object> gap,
+                                        IncrementalStringBuilderSink* sink) {
+  DCHECK_NOT_NULL(sink);
+  JsonStringifier stringifier(isolate, sink);
+  return stringifier.Stringify(object, replacer, gap);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -211,13 +221,15 @@ const char* const JsonStringifier::JsonEscapeTable =
     "\xF8\0      \xF9\0      \xFA\0      \xFB\0      "
     "\xFC\0      \xFD\0      \xFE\0      \xFF\0      ";
 
-JsonStringifier::JsonStringifier(Isolate* isolate)
+JsonStringifier::JsonStringifier(Isolate* isolate,
+                                 IncrementalStringBuilderSink* sink)
     : isolate_(isolate),
       builder_(isolate),
       gap_(nullptr),
       indent_(0),
       stack_() {
   tojson_string_ = factory()->toJSON_string();
+  if (sink != nullptr) builder_.set_sink(sink);
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -10,10 +10,19 @@
 namespace v8 {
 namespace internal {
 
+class IncrementalStringBuilderSink;
+
 V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Like JsonStringify, but hands the serialized string to |sink| in parts as it
+// is produced instead of returning it. Returns the undefined value if the
+// object is not serializable and the empty string otherwise.
+V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringifyToSink(
+    Isolate* isolate, Handle<Object> object, Handle<Object> replacer,
+    Handle<Object> gap, IncrementalStringBuilderSink* sink);
 }  // namespace internal
 }  // namespace v8
 
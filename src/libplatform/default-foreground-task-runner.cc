@@ -4,6 +4,8 @@
 
 #include "src/libplatform/default-foreground-task-runner.h"
 
+#include <vector>
+
 #include "src/base/platform/mutex.h"
 #include "src/libplatform/default-platform.h"
 
@@ -32,7 +34,7 @@ void DefaultForegroundTaskRunner::Terminate() {
 
   // Drain the task queues.
   while (!task_queue_.empty()) task_queue_.pop_front();
-  while (!delayed_task_queue_.empty()) delayed_task_queue_.pop();
+  delayed_task_queue_.Clear();
   while (!idle_task_queue_.empty()) idle_task_queue_.pop();
 }
 
@@ -59,7 +61,8 @@ void DefaultForegroundTaskRunner::PostDelayedTaskLocked(
   DCHECK_GE(delay_in_seconds, 0.0);
   if (terminated_) return;
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
-  delayed_task_queue_.push({deadline, nestability, std::move(task)});
+  delayed_task_queue_.Insert(deadline,
+                             std::make_pair(nestability, std::move(task)));
   event_loop_control_.NotifyOne();
 }
 
@@ -106,12 +109,11 @@ bool DefaultForegroundTaskRunner::HasPoppableTaskInQueue() const {
 
 void DefaultForegroundTaskRunner::MoveExpiredDelayedTasks(
     const base::MutexGuard& guard) {
-  Nestability nestability;
-  std::unique_ptr<Task> task =
-      PopTaskFromDelayedQueueLocked(guard, &nestability);
-  while (task) {
-    PostTaskLocked(std::move(task), nestability, guard);
-    task = PopTaskFromDelayedQueueLocked(guard, &nestability);
+  std::vector<TaskQueueEntry> expired_tasks;
+  delayed_task_queue_.PopExpired(MonotonicallyIncreasingTime(),
+                                 &expired_tasks);
+  for (TaskQueueEntry& entry : expired_tasks) {
+    PostTaskLocked(std::move(entry.second), entry.first, guard);
   }
 }
 
@@ -139,26 +141,6 @@ std::unique_ptr<Task> DefaultForegroundTaskRunner::PopTaskFromQueue(
   return task;
 }
 
-std::unique_ptr<Task>
-DefaultForegroundTaskRunner::PopTaskFromDelayedQueueLocked(
-    const base::MutexGuard&, Nestability* nestability) {
-  if (delayed_task_queue_.empty()) return {};
-
-  double now = MonotonicallyIncreasingTime();
-  const DelayedEntry& entry = delayed_task_queue_.top();
-  if (entry.timeout_time > now) return {};
-  // The const_cast here is necessary because there does not exist a clean way
-  // to get a unique_ptr out of the priority queue. We provide the priority
-  // queue with a custom comparison operator to make sure that the priority
-  // queue does not access the unique_ptr. Therefore it should be safe to reset
-  // the unique_ptr in the priority queue here. Note that the DelayedEntry is
-  // removed from the priority_queue immediately afterwards.
-  std::unique_ptr<Task> task = std::move(const_cast<DelayedEntry&>(entry).task);
-  *nestability = entry.nestability;
-  delayed_task_queue_.pop();
-  return task;
-}
-
 std::unique_ptr<IdleTask> DefaultForegroundTaskRunner::PopTaskFromIdleQueue() {
   base::MutexGuard guard(&lock_);
   if (idle_task_queue_.empty()) return {};
@@ -172,8 +154,8 @@ std::unique_ptr<IdleTask> DefaultForegroundTaskRunner::PopTaskFromIdleQueue() {
 void DefaultForegroundTaskRunner::WaitForTaskLocked(const base::MutexGuard&) {
   if (!delayed_task_queue_.empty()) {
     double now = MonotonicallyIncreasingTime();
-    const DelayedEntry& entry = delayed_task_queue_.top();
-    double time_until_task = entry.timeout_time - now;
+    double time_until_task =
+        delayed_task_queue_.NextDeadlineLowerBound() - now;
     if (time_until_task > 0) {
       bool woken_up = event_loop_control_.WaitFor(
           &lock_,
@@ -12,6 +12,7 @@
 #include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/libplatform/timer-wheel.h"
 
 namespace v8 {
 namespace platform {
@@ -74,11 +75,6 @@ class V8_PLATFORM_EXPORT DefaultForegroundTaskRunner
                              double delay_in_seconds, Nestability nestability,
                              const base::MutexGuard&);
 
-  // A caller of this function has to hold {lock_}. The {guard} parameter should
-  // make sure that the caller is holding the lock.
-  std::unique_ptr<Task> PopTaskFromDelayedQueueLocked(const base::MutexGuard&,
-                                                      Nestability* nestability);
-
   // A non-nestable task is poppable only if the task runner is not nested,
   // i.e. if a task is not being run from within a task. A nestable task is
   // always poppable.
@@ -98,25 +94,7 @@ class V8_PLATFORM_EXPORT DefaultForegroundTaskRunner
   IdleTaskSupport idle_task_support_;
   std::queue<std::unique_ptr<IdleTask>> idle_task_queue_;
 
-  // Some helper constructs for the {delayed_task_queue_}.
-  struct DelayedEntry {
-    double timeout_time;
-    Nestability nestability;
-    std::unique_ptr<Task> task;
-  };
-
-  // Define a comparison operator for the delayed_task_queue_ to make sure
-  // that the unique_ptr in the DelayedEntry is not accessed in the priority
-  // queue. This is necessary because we have to reset the unique_ptr when we
-  // remove a DelayedEntry from the priority queue.
-  struct DelayedEntryCompare {
-    bool operator()(const DelayedEntry& left, const DelayedEntry& right) const {
-      return left.timeout_time > right.timeout_time;
-    }
-  };
-  std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
-                      DelayedEntryCompare>
-      delayed_task_queue_;
+  TimerWheel<TaskQueueEntry> delayed_task_queue_;
 
   TimeFunction time_function_;
 };
@@ -197,7 +197,22 @@ std::shared_ptr<TaskRunner> DefaultPlatform::GetForegroundTaskRunner(
 
 void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   EnsureBackgroundTaskRunnerInitialized();
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kUserVisible);
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kUserBlocking);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kBestEffort);
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
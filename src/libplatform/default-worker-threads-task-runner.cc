@@ -31,10 +31,15 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
   thread_pool_.clear();
 }
 
-void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task,
+                                              TaskPriority priority) {
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
-  queue_.Append(std::move(task));
+  queue_.Append(std::move(task), priority);
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+  PostTask(std::move(task), TaskPriority::kUserVisible);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
@@ -31,6 +31,9 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
+  // Posts a task that is run before any pending task of lower |priority|.
+  void PostTask(std::unique_ptr<Task> task, TaskPriority priority);
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -4,6 +4,8 @@
 
 #include "src/libplatform/delayed-task-queue.h"
 
+#include <vector>
+
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/platform/time.h"
@@ -17,17 +19,20 @@ DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
 DelayedTaskQueue::~DelayedTaskQueue() {
   base::MutexGuard guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+#ifdef DEBUG
+  for (const auto& task_queue : task_queues_) DCHECK(task_queue.empty());
+#endif
 }
 
 double DelayedTaskQueue::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
-void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
+void DelayedTaskQueue::Append(std::unique_ptr<Task> task,
+                              TaskPriority priority) {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  task_queues_[static_cast<size_t>(priority)].push(std::move(task));
   queues_condition_var_.NotifyOne();
 }
 
@@ -38,7 +43,7 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
   {
     base::MutexGuard guard(&lock_);
     DCHECK(!terminated_);
-    delayed_task_queue_.emplace(deadline, std::move(task));
+    delayed_task_queue_.Insert(deadline, std::move(task));
     queues_condition_var_.NotifyOne();
   }
 }
@@ -48,14 +53,18 @@ std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   for (;;) {
     // Move delayed tasks that have hit their deadline to the main queue.
     double now = MonotonicallyIncreasingTime();
-    std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-    while (task) {
-      task_queue_.push(std::move(task));
-      task = PopTaskFromDelayedQueue(now);
+    std::vector<std::unique_ptr<Task>> expired_tasks;
+    delayed_task_queue_.PopExpired(now, &expired_tasks);
+    for (std::unique_ptr<Task>& task : expired_tasks) {
+      task_queues_[static_cast<size_t>(TaskPriority::kUserVisible)].push(
+          std::move(task));
     }
-    if (!task_queue_.empty()) {
-      std::unique_ptr<Task> result = std::move(task_queue_.front());
-      task_queue_.pop();
+    // Drain the queues from the highest priority down.
+    for (size_t i = kNumPriorities; i-- > 0;) {
+      std::queue<std::unique_ptr<Task>>& task_queue = task_queues_[i];
+      if (task_queue.empty()) continue;
+      std::unique_ptr<Task> result = std::move(task_queue.front());
+      task_queue.pop();
       return result;
     }
 
@@ -64,9 +73,10 @@ std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
       return nullptr;
     }
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
+    if (!delayed_task_queue_.empty()) {
       // Wait for the next delayed task or a newly posted task.
-      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+      double wait_in_seconds =
+          delayed_task_queue_.NextDeadlineLowerBound() - now;
       base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
           base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
 
@@ -81,19 +91,6 @@ std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   }
 }
 
-// Gets the next task from the delayed queue for which the deadline has passed
-// according to |now|. Returns nullptr if no such task exists.
-std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromDelayedQueue(double now) {
-  if (delayed_task_queue_.empty()) return nullptr;
-
-  auto it = delayed_task_queue_.begin();
-  if (it->first > now) return nullptr;
-
-  std::unique_ptr<Task> result = std::move(it->second);
-  delayed_task_queue_.erase(it);
-  return result;
-}
-
 void DelayedTaskQueue::Terminate() {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
@@ -5,14 +5,15 @@
 #ifndef V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 
-#include <map>
 #include <memory>
 #include <queue>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/libplatform/timer-wheel.h"
 
 namespace v8 {
 
@@ -22,7 +23,8 @@ namespace platform {
 
 // DelayedTaskQueue provides queueing for immediate and delayed tasks. It does
 // not provide any guarantees about ordering of tasks, except that immediate
-// tasks will be run in the order that they are posted.
+// tasks of higher priority are returned first and immediate tasks of the same
+// priority will be run in the order that they are posted.
 class V8_PLATFORM_EXPORT DelayedTaskQueue {
  public:
   using TimeFunction = double (*)();
@@ -33,12 +35,15 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   double MonotonicallyIncreasingTime();
 
   // Appends an immediate task to the queue. The queue takes ownership of
-  // |task|. Tasks appended via this method will be run in order. Thread-safe.
-  void Append(std::unique_ptr<Task> task);
+  // |task|. Tasks appended via this method with the same |priority| will be
+  // run in order. Thread-safe.
+  void Append(std::unique_ptr<Task> task,
+              TaskPriority priority = TaskPriority::kUserVisible);
 
   // Appends a delayed task to the queue. There is no ordering guarantee
   // provided regarding delayed tasks, both with respect to other delayed tasks
-  // and non-delayed tasks that were appended using Append(). Thread-safe.
+  // and non-delayed tasks that were appended using Append(). Delayed tasks
+  // have kUserVisible priority once their deadline has passed. Thread-safe.
   void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
 
   // Returns the next task to process. Blocks if no task is available.
@@ -51,12 +56,14 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   void Terminate();
 
  private:
-  std::unique_ptr<Task> PopTaskFromDelayedQueue(double now);
+  static constexpr size_t kNumPriorities =
+      static_cast<size_t>(TaskPriority::kUserBlocking) + 1;
 
   base::ConditionVariable queues_condition_var_;
   base::Mutex lock_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
-  std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
+  // Immediate tasks, indexed by priority.
+  std::queue<std::unique_ptr<Task>> task_queues_[kNumPriorities];
+  TimerWheel<std::unique_ptr<Task>> delayed_task_queue_;
   bool terminated_ = false;
   TimeFunction time_function_;
 
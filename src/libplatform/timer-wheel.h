@@ -0,0 +1,207 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_TIMER_WHEEL_H_
+#define V8_LIBPLATFORM_TIMER_WHEEL_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace platform {
+
+// A hierarchical timing wheel holding values until their deadline. Deadlines
+// are in seconds, as returned by a task runner's time function, and are
+// bucketed into millisecond ticks. Level k has kSlots slots, each covering
+// kSlots^k ticks; entries move down a level whenever the wheel passes the
+// start of their slot, and are compared against their exact deadline only in
+// the last millisecond. Inserting is O(1) and expiring is proportional to the
+// number of expired entries plus the elapsed time in units of kSlots ticks.
+// Not thread-safe.
+template <typename T>
+class TimerWheel {
+ public:
+  TimerWheel() = default;
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  void Insert(double deadline, T value) {
+    uint64_t tick = ToTick(deadline);
+    // Ticks before the first entry are never looked at again, so an empty
+    // wheel can start at the new entry.
+    if (wheel_size_ == 0 && tick > current_tick_) current_tick_ = tick;
+    Place({deadline, tick, next_sequence_number_++, std::move(value)});
+    size_++;
+  }
+
+  // Appends the values whose deadline is at or before |now| to |expired|,
+  // ordered by deadline. Values with equal deadlines keep insertion order.
+  void PopExpired(double now, std::vector<T>* expired) {
+    Advance(ToTick(now));
+    auto first_expired = std::stable_partition(
+        ready_.begin(), ready_.end(),
+        [now](const Entry& entry) { return entry.deadline > now; });
+    std::sort(first_expired, ready_.end(),
+                     [](const Entry& a, const Entry& b) {
+                       return a.deadline < b.deadline ||
+                              (a.deadline == b.deadline &&
+                               a.sequence_number < b.sequence_number);
+                     });
+    for (auto it = first_expired; it != ready_.end(); ++it) {
+      expired->push_back(std::move(it->value));
+    }
+    size_ -= ready_.end() - first_expired;
+    ready_.erase(first_expired, ready_.end());
+  }
+
+  // Returns a time at or before the earliest deadline, suitable for waiting.
+  // Must not be called on an empty wheel.
+  double NextDeadlineLowerBound() const {
+    DCHECK(!empty());
+    if (!ready_.empty()) {
+      double deadline = std::numeric_limits<double>::infinity();
+      for (const Entry& entry : ready_) {
+        deadline = std::min(deadline, entry.deadline);
+      }
+      return deadline;
+    }
+    uint64_t tick = std::numeric_limits<uint64_t>::max();
+    for (int level = 0; level < kLevels; level++) {
+      if (occupied_[level] == 0) continue;
+      const int shift = level * kSlotBits;
+      const uint64_t index = (current_tick_ >> shift) & kSlotMask;
+      uint64_t rotated = base::bits::RotateRight64(occupied_[level], index);
+      // Above level 0, the current slot is cascaded when |current_tick_| is
+      // at its start. Once past the start it only holds entries for the next
+      // rotation.
+      const bool at_slot_start =
+          (current_tick_ & ((uint64_t{1} << shift) - 1)) == 0;
+      uint64_t distance;
+      if (at_slot_start) {
+        distance = base::bits::CountTrailingZeros64(rotated);
+      } else if (rotated & ~uint64_t{1}) {
+        distance = base::bits::CountTrailingZeros64(rotated & ~uint64_t{1});
+      } else {
+        distance = kSlots;
+      }
+      tick = std::min(tick, ((current_tick_ >> shift) + distance) << shift);
+    }
+    return static_cast<double>(tick) / kTicksPerSecond;
+  }
+
+  void Clear() {
+    for (int level = 0; level < kLevels; level++) {
+      for (std::vector<Entry>& slot : slots_[level]) slot.clear();
+      occupied_[level] = 0;
+    }
+    ready_.clear();
+    wheel_size_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  static constexpr int kLevels = 4;
+  static constexpr int kSlotBits = 6;
+  static constexpr uint64_t kSlots = uint64_t{1} << kSlotBits;
+  static constexpr uint64_t kSlotMask = kSlots - 1;
+  static constexpr uint64_t kMaxDelta = uint64_t{1} << (kLevels * kSlotBits);
+  static constexpr double kTicksPerSecond = 1000;
+
+  struct Entry {
+    double deadline;
+    uint64_t tick;
+    uint64_t sequence_number;
+    T value;
+  };
+
+  static uint64_t ToTick(double seconds) {
+    return static_cast<uint64_t>(
+        std::max(0.0, std::floor(seconds * kTicksPerSecond)));
+  }
+
+  void Place(Entry entry) {
+    if (entry.tick < current_tick_) {
+      ready_.push_back(std::move(entry));
+      return;
+    }
+    // Entries beyond the last level are parked at its far end and placed
+    // again when it is cascaded.
+    uint64_t tick = std::min(entry.tick, current_tick_ + kMaxDelta - 1);
+    uint64_t delta = tick - current_tick_;
+    int level = 0;
+    while (delta >= (kSlots << (level * kSlotBits))) level++;
+    DCHECK_LT(level, kLevels);
+    uint64_t index = (tick >> (level * kSlotBits)) & kSlotMask;
+    slots_[level][index].push_back(std::move(entry));
+    occupied_[level] |= uint64_t{1} << index;
+    wheel_size_++;
+  }
+
+  std::vector<Entry> TakeSlot(int level, uint64_t index) {
+    std::vector<Entry> entries;
+    entries.swap(slots_[level][index]);
+    occupied_[level] &= ~(uint64_t{1} << index);
+    wheel_size_ -= entries.size();
+    return entries;
+  }
+
+  // Moves the entries of the higher-level slots starting at |current_tick_|
+  // down. Must be called when |current_tick_| is at a level 0 rotation start.
+  void Cascade() {
+    for (int level = 1; level < kLevels; level++) {
+      uint64_t index = (current_tick_ >> (level * kSlotBits)) & kSlotMask;
+      for (Entry& entry : TakeSlot(level, index)) Place(std::move(entry));
+      if (index != 0) break;
+    }
+  }
+
+  // Moves all entries with a tick up to and including |now_tick| to |ready_|.
+  void Advance(uint64_t now_tick) {
+    while (current_tick_ <= now_tick) {
+      if (wheel_size_ == 0) {
+        current_tick_ = now_tick + 1;
+        return;
+      }
+      uint64_t index = current_tick_ & kSlotMask;
+      if (index == 0) Cascade();
+      if ((occupied_[0] >> index) == 0) {
+        // Nothing left in this rotation of level 0.
+        current_tick_ =
+            std::min((current_tick_ | kSlotMask) + 1, now_tick + 1);
+        continue;
+      }
+      for (Entry& entry : TakeSlot(0, index)) {
+        ready_.push_back(std::move(entry));
+      }
+      current_tick_++;
+    }
+  }
+
+  std::vector<Entry> slots_[kLevels][kSlots];
+  uint64_t occupied_[kLevels] = {};
+  // Entries whose tick has passed but whose deadline may not have.
+  std::vector<Entry> ready_;
+  // The first tick not moved to |ready_| yet.
+  uint64_t current_tick_ = 0;
+  // Number of entries in |slots_|.
+  size_t wheel_size_ = 0;
+  // Number of entries in |slots_| and |ready_|.
+  size_t size_ = 0;
+  uint64_t next_sequence_number_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_TIMER_WHEEL_H_
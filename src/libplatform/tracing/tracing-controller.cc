@@ -70,7 +70,12 @@ const int g_num_builtin_categories = 3;
 v8::base::AtomicWord g_category_index = g_num_builtin_categories;
 #endif  // !defined(V8_USE_PERFETTO)
 
-TracingController::TracingController() { mutex_.reset(new base::Mutex()); }
+TracingController::TracingController() {
+  mutex_.reset(new base::Mutex());
+#if !defined(V8_USE_PERFETTO)
+  trace_buffer_mutex_.reset(new base::SharedMutex());
+#endif  // !defined(V8_USE_PERFETTO)
+}
 
 TracingController::~TracingController() {
   StopTracing();
@@ -141,7 +146,7 @@ uint64_t TracingController::AddTraceEventWithTimestamp(
     TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
     if (trace_object) {
       {
-        base::MutexGuard lock(mutex_.get());
+        base::SharedMutexGuard<base::kShared> lock(trace_buffer_mutex_.get());
         trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
                                  bind_id, num_args, arg_names, arg_types,
                                  arg_values, arg_convertables, flags, timestamp,
@@ -256,7 +261,7 @@ void TracingController::StopTracing() {
 #else
 
   {
-    base::MutexGuard lock(mutex_.get());
+    base::SharedMutexGuard<base::kExclusive> lock(trace_buffer_mutex_.get());
     DCHECK(trace_buffer_);
     trace_buffer_->Flush();
   }
@@ -277,6 +277,10 @@ namespace internal {
 #define STATS_COUNTER_LIST_2(SC)                                               \
   /* Amount of (JS) compiled code. */                                          \
   SC(total_compiled_code_size, V8.TotalCompiledCodeSize)                       \
+  /* Size of deoptimization translations, and the size saved by sharing */     \
+  /* identical ones between deoptimization points. */                          \
+  SC(deopt_translation_size, V8.DeoptTranslationSize)                          \
+  SC(deopt_translation_size_saved, V8.DeoptTranslationSizeSaved)               \
   SC(gc_compactor_caused_by_request, V8.GCCompactorCausedByRequest)            \
   SC(gc_compactor_caused_by_promoted_data, V8.GCCompactorCausedByPromotedData) \
   SC(gc_compactor_caused_by_oldspace_exhaustion,                               \
@@ -288,6 +292,8 @@ namespace internal {
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
+  SC(regexp_results_cache_hits, V8.RegExpResultsCacheHits)                     \
+  SC(regexp_results_cache_misses, V8.RegExpResultsCacheMisses)                 \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
   SC(sub_string_runtime, V8.SubStringRuntime)                                  \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
@@ -319,7 +325,8 @@ namespace internal {
   SC(wasm_reloc_size, V8.WasmRelocBytes)                             \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions) \
   SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)        \
-  SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)
+  SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)  \
+  SC(wasm_eliminated_bounds_checks, V8.WasmEliminatedBoundsChecks)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
@@ -38,7 +38,11 @@ void RuntimeCallTimer::Resume(base::TimeTicks now) {
 }
 
 RuntimeCallTimer* RuntimeCallTimer::Stop() {
-  if (!IsStarted()) return parent();
+  if (!IsStarted()) {
+    // Timers aren't started in sampling mode, but calls are still counted.
+    counter_->Increment();
+    return parent();
+  }
   base::TimeTicks now = RuntimeCallTimer::Now();
   Pause(now);
   counter_->Increment();
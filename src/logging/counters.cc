@@ -422,6 +422,8 @@ void RuntimeCallCounter::Add(RuntimeCallCounter* other) {
 }
 
 void RuntimeCallTimer::Snapshot() {
+  // There's no time to commit in sampling mode.
+  if (!IsStarted()) return;
   base::TimeTicks now = Now();
   // Pause only / topmost timer in the timer stack.
   Pause(now);
@@ -521,6 +523,11 @@ void RuntimeCallStats::Leave(RuntimeCallTimer* timer) {
   current_counter_.SetValue(cur_timer ? cur_timer->counter() : nullptr);
 }
 
+void RuntimeCallStats::AddSample(base::TimeDelta interval) {
+  RuntimeCallCounter* counter = current_counter();
+  if (counter != nullptr) counter->Add(interval);
+}
+
 void RuntimeCallStats::Add(RuntimeCallStats* other) {
   for (int i = 0; i < kNumberOfCounters; i++) {
     GetCounter(i)->Add(other->GetCounter(i));
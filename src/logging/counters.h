@@ -716,6 +716,7 @@ class RuntimeCallTimer final {
   V(ArrayBuffer_Detach)                                    \
   V(ArrayBuffer_New)                                       \
   V(ArrayBuffer_NewBackingStore)                           \
+  V(ArrayBuffer_NewGrowableBackingStore)                   \
   V(ArrayBuffer_BackingStore_Reallocate)                   \
   V(Array_CloneElementAt)                                  \
   V(Array_New)                                             \
@@ -778,6 +779,7 @@ class RuntimeCallTimer final {
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
   V(Object_Get)                                            \
+  V(Object_GetMultiple)                                    \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
@@ -797,6 +799,7 @@ class RuntimeCallTimer final {
   V(Object_Set)                                            \
   V(Object_SetAccessor)                                    \
   V(Object_SetIntegrityLevel)                              \
+  V(Object_SetMultiple)                                    \
   V(Object_SetPrivate)                                     \
   V(Object_SetPrototype)                                   \
   V(ObjectTemplate_New)                                    \
@@ -812,9 +815,11 @@ class RuntimeCallTimer final {
   V(Object_ToUint32)                                       \
   V(Persistent_New)                                        \
   V(Private_New)                                           \
+  V(Promise_CallAsync)                                     \
   V(Promise_Catch)                                         \
   V(Promise_Chain)                                         \
   V(Promise_HasRejectHandler)                              \
+  V(Promise_OnSettled)                                     \
   V(Promise_Resolver_New)                                  \
   V(Promise_Resolver_Reject)                               \
   V(Promise_Resolver_Resolve)                              \
@@ -845,6 +850,7 @@ class RuntimeCallTimer final {
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
   V(String_NewFromUtf8Literal)                             \
+  V(String_NewSubString)                                   \
   V(StringObject_New)                                      \
   V(StringObject_StringValue)                              \
   V(String_Write)                                          \
@@ -1142,6 +1148,11 @@ class RuntimeCallStats final {
   V8_EXPORT_PRIVATE void CorrectCurrentCounterId(
       RuntimeCallCounterId counter_id, CounterMode mode = kExact);
 
+  // Attribute |interval| to the own time of the innermost active counter.
+  // Used in sampling mode, where timers don't measure time themselves. Called
+  // by the CPU profiler's sampler while the owning thread is interrupted.
+  V8_EXPORT_PRIVATE void AddSample(base::TimeDelta interval);
+
   V8_EXPORT_PRIVATE void Reset();
   // Add all entries from another stats object.
   void Add(RuntimeCallStats* other);
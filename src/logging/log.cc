@@ -8,6 +8,7 @@
 #include <cstdarg>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/base/platform/mutex.h"
@@ -1854,55 +1855,64 @@ static void AddFunctionAndCode(SharedFunctionInfo sfi, AbstractCode code_object,
   }
 }
 
-static int EnumerateCompiledFunctions(Heap* heap,
-                                      Handle<SharedFunctionInfo>* sfis,
-                                      Handle<AbstractCode>* code_objects) {
-  HeapObjectIterator iterator(heap);
-  DisallowHeapAllocation no_gc;
-  int compiled_funcs_count = 0;
-
-  // Iterate the heap to find JSFunctions and record their optimized code.
-  for (HeapObject obj = iterator.Next(); !obj.is_null();
-       obj = iterator.Next()) {
-    if (obj.IsSharedFunctionInfo()) {
-      SharedFunctionInfo sfi = SharedFunctionInfo::cast(obj);
-      if (sfi.is_compiled() && !sfi.IsInterpreted()) {
-        AddFunctionAndCode(sfi, AbstractCode::cast(sfi.abstract_code()), sfis,
-                           code_objects, compiled_funcs_count);
-        ++compiled_funcs_count;
-      }
-    } else if (obj.IsJSFunction()) {
-      // Given that we no longer iterate over all optimized JSFunctions, we need
-      // to take care of this here.
-      JSFunction function = JSFunction::cast(obj);
-      // TODO(jarin) This leaves out deoptimized code that might still be on the
-      // stack. Also note that we will not log optimized code objects that are
-      // only on a type feedback vector. We should make this mroe precise.
-      if (function.HasAttachedOptimizedCode() &&
-          Script::cast(function.shared().script()).HasValidSource()) {
-        AddFunctionAndCode(function.shared(),
-                           AbstractCode::cast(function.code()), sfis,
-                           code_objects, compiled_funcs_count);
-        ++compiled_funcs_count;
-      }
+// Calls |callback| with the function and its code if |obj| is a compiled
+// function that has to be logged when found on the heap.
+template <typename Callback>
+static void VisitCompiledFunction(HeapObject obj, Callback callback) {
+  if (obj.IsSharedFunctionInfo()) {
+    SharedFunctionInfo sfi = SharedFunctionInfo::cast(obj);
+    if (sfi.is_compiled() && !sfi.IsInterpreted()) {
+      callback(sfi, AbstractCode::cast(sfi.abstract_code()));
+    }
+  } else if (obj.IsJSFunction()) {
+    // Given that we no longer iterate over all optimized JSFunctions, we need
+    // to take care of this here.
+    JSFunction function = JSFunction::cast(obj);
+    // TODO(jarin) This leaves out deoptimized code that might still be on the
+    // stack. Also note that we will not log optimized code objects that are
+    // only on a type feedback vector. We should make this mroe precise.
+    if (function.HasAttachedOptimizedCode() &&
+        Script::cast(function.shared().script()).HasValidSource()) {
+      callback(function.shared(), AbstractCode::cast(function.code()));
     }
   }
+}
 
-  Script::Iterator script_iterator(heap->isolate());
+// Calls |callback| with the compiled functions of all scripts with source.
+template <typename Callback>
+static void VisitCompiledScriptFunctions(Isolate* isolate, Callback callback) {
+  Script::Iterator script_iterator(isolate);
   for (Script script = script_iterator.Next(); !script.is_null();
        script = script_iterator.Next()) {
     if (!script.HasValidSource()) continue;
 
-    SharedFunctionInfo::ScriptIterator sfi_iterator(heap->isolate(), script);
+    SharedFunctionInfo::ScriptIterator sfi_iterator(isolate, script);
     for (SharedFunctionInfo sfi = sfi_iterator.Next(); !sfi.is_null();
          sfi = sfi_iterator.Next()) {
       if (sfi.is_compiled()) {
-        AddFunctionAndCode(sfi, AbstractCode::cast(sfi.abstract_code()), sfis,
-                           code_objects, compiled_funcs_count);
-        ++compiled_funcs_count;
+        callback(sfi, AbstractCode::cast(sfi.abstract_code()));
       }
     }
   }
+}
+
+static int EnumerateCompiledFunctions(Heap* heap,
+                                      Handle<SharedFunctionInfo>* sfis,
+                                      Handle<AbstractCode>* code_objects) {
+  HeapObjectIterator iterator(heap);
+  DisallowHeapAllocation no_gc;
+  int compiled_funcs_count = 0;
+  auto add_function_and_code = [&](SharedFunctionInfo sfi, AbstractCode code) {
+    AddFunctionAndCode(sfi, code, sfis, code_objects, compiled_funcs_count);
+    ++compiled_funcs_count;
+  };
+
+  // Iterate the heap to find JSFunctions and record their optimized code.
+  for (HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    VisitCompiledFunction(obj, add_function_and_code);
+  }
+  VisitCompiledScriptFunctions(heap->isolate(), add_function_and_code);
 
   return compiled_funcs_count;
 }
@@ -2239,17 +2249,7 @@ void ExistingCodeLogger::LogCompiledFunctions() {
   // During iteration, there can be heap allocation due to
   // GetScriptLineNumber call.
   for (int i = 0; i < compiled_funcs_count; ++i) {
-    SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate_, sfis[i]);
-    if (sfis[i]->function_data(kAcquireLoad).IsInterpreterData()) {
-      LogExistingFunction(
-          sfis[i],
-          Handle<AbstractCode>(
-              AbstractCode::cast(sfis[i]->InterpreterTrampoline()), isolate_),
-          CodeEventListener::INTERPRETED_FUNCTION_TAG);
-    }
-    if (code_objects[i].is_identical_to(BUILTIN_CODE(isolate_, CompileLazy)))
-      continue;
-    LogExistingFunction(sfis[i], code_objects[i]);
+    LogCompiledFunction(sfis[i], code_objects[i]);
   }
 
   const int wasm_module_objects_count =
@@ -2262,6 +2262,20 @@ void ExistingCodeLogger::LogCompiledFunctions() {
   }
 }
 
+void ExistingCodeLogger::LogCompiledFunction(Handle<SharedFunctionInfo> shared,
+                                             Handle<AbstractCode> code) {
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate_, shared);
+  if (shared->function_data(kAcquireLoad).IsInterpreterData()) {
+    LogExistingFunction(
+        shared,
+        Handle<AbstractCode>(
+            AbstractCode::cast(shared->InterpreterTrampoline()), isolate_),
+        CodeEventListener::INTERPRETED_FUNCTION_TAG);
+  }
+  if (code.is_identical_to(BUILTIN_CODE(isolate_, CompileLazy))) return;
+  LogExistingFunction(shared, code);
+}
+
 void ExistingCodeLogger::LogExistingFunction(
     Handle<SharedFunctionInfo> shared, Handle<AbstractCode> code,
     CodeEventListener::LogEventsAndTags tag) {
@@ -2304,6 +2318,97 @@ void ExistingCodeLogger::LogExistingFunction(
   }
 }
 
+IncrementalCodeLogger::IncrementalCodeLogger(Isolate* isolate,
+                                             CodeEventListener* listener,
+                                             bool log_code_objects)
+    : isolate_(isolate),
+      listener_(listener),
+      existing_code_logger_(isolate, listener) {
+  DCHECK_NOT_NULL(listener);
+  HandleScope scope(isolate_);
+  std::vector<Handle<Object>> objects;
+  {
+    // A single walk collects everything the eager LogCodeObjects(),
+    // LogCompiledFunctions() and LogAccessorCallbacks() would log.
+    HeapObjectIterator iterator(isolate_->heap());
+    DisallowHeapAllocation no_gc;
+    Object undefined = ReadOnlyRoots(isolate_).undefined_value();
+    auto add_function_and_code = [&](SharedFunctionInfo sfi,
+                                     AbstractCode code) {
+      objects.push_back(handle(sfi, isolate_));
+      objects.push_back(handle(code, isolate_));
+    };
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if ((log_code_objects && obj.IsCode()) || obj.IsAccessorInfo() ||
+          obj.IsWasmModuleObject()) {
+        objects.push_back(handle(undefined, isolate_));
+        objects.push_back(handle(obj, isolate_));
+        continue;
+      }
+      VisitCompiledFunction(obj, add_function_and_code);
+    }
+    VisitCompiledScriptFunctions(isolate_, add_function_and_code);
+  }
+
+  length_ = static_cast<int>(objects.size());
+  if (length_ == 0) return;
+  Handle<FixedArray> array = isolate_->factory()->NewFixedArray(length_);
+  for (int i = 0; i < length_; i++) array->set(i, *objects[i]);
+  objects_ = isolate_->global_handles()->Create(*array);
+}
+
+IncrementalCodeLogger::~IncrementalCodeLogger() { ReleaseObjects(); }
+
+void IncrementalCodeLogger::ReleaseObjects() {
+  if (objects_.is_null()) return;
+  GlobalHandles::Destroy(objects_.location());
+  objects_ = Handle<FixedArray>();
+}
+
+bool IncrementalCodeLogger::LogSlice(base::TimeDelta budget) {
+  base::ElapsedTimer timer;
+  timer.Start();
+  while (!done() && !timer.HasExpired(budget)) {
+    HandleScope scope(isolate_);
+    Log(objects_->get(next_), objects_->get(next_ + 1));
+    next_ += 2;
+  }
+  if (!done()) return false;
+  ReleaseObjects();
+  return true;
+}
+
+void IncrementalCodeLogger::Log(Object first, Object second) {
+  if (first.IsSharedFunctionInfo()) {
+    existing_code_logger_.LogCompiledFunction(
+        handle(SharedFunctionInfo::cast(first), isolate_),
+        handle(AbstractCode::cast(second), isolate_));
+  } else if (second.IsCode()) {
+    existing_code_logger_.LogCodeObject(second);
+  } else if (second.IsWasmModuleObject()) {
+    WasmModuleObject::cast(second).native_module()->LogWasmCodes(isolate_);
+  } else {
+    AccessorInfo ai = AccessorInfo::cast(second);
+    if (!ai.name().IsName()) return;
+    Handle<Name> name(Name::cast(ai.name()), isolate_);
+    Address getter_entry = v8::ToCData<Address>(ai.getter());
+    if (getter_entry != 0) {
+#if USES_FUNCTION_DESCRIPTORS
+      getter_entry = *FUNCTION_ENTRYPOINT_ADDRESS(getter_entry);
+#endif
+      listener_->GetterCallbackEvent(name, getter_entry);
+    }
+    Address setter_entry = v8::ToCData<Address>(ai.setter());
+    if (setter_entry != 0) {
+#if USES_FUNCTION_DESCRIPTORS
+      setter_entry = *FUNCTION_ENTRYPOINT_ADDRESS(setter_entry);
+#endif
+      listener_->SetterCallbackEvent(name, setter_entry);
+    }
+  }
+}
+
 #undef CALL_CODE_EVENT_HANDLER
 
 }  // namespace internal
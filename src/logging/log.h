@@ -98,12 +98,46 @@ class ExistingCodeLogger {
                            CodeEventListener::LogEventsAndTags tag =
                                CodeEventListener::LAZY_COMPILE_TAG);
   void LogCodeObject(Object object);
+  // Logs a function found by LogCompiledFunctions(), including its
+  // interpreter trampoline copy if it has one.
+  void LogCompiledFunction(Handle<SharedFunctionInfo> shared,
+                           Handle<AbstractCode> code);
 
  private:
   Isolate* isolate_;
   CodeEventListener* listener_;
 };
 
+// Logs the code that existed before |listener| was added a slice at a time,
+// so that a profiler can start without blocking for the whole heap. The heap
+// is walked once on construction; creating the code events, which needs
+// source positions and line ends for every compiled function, is spread over
+// LogSlice() calls. The collected objects are kept alive until logged.
+class IncrementalCodeLogger {
+ public:
+  IncrementalCodeLogger(Isolate* isolate, CodeEventListener* listener,
+                        bool log_code_objects);
+  ~IncrementalCodeLogger();
+
+  // Logs existing code until |budget| has elapsed. Returns true once all of
+  // it has been logged.
+  bool LogSlice(base::TimeDelta budget);
+  bool done() const { return next_ == length_; }
+
+ private:
+  void Log(Object first, Object second);
+  void ReleaseObjects();
+
+  Isolate* const isolate_;
+  CodeEventListener* const listener_;
+  ExistingCodeLogger existing_code_logger_;
+  // Pairs of (SharedFunctionInfo, AbstractCode) for compiled functions and
+  // (undefined, object) for code objects, accessors and wasm modules.
+  Handle<FixedArray> objects_;
+  int next_ = 0;
+  int length_ = 0;
+};
+
 enum class LogSeparator;
 
 class Logger : public CodeEventListener {
@@ -0,0 +1,35 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_NUMBERS_RYU_DTOA_H_
+#define V8_NUMBERS_RYU_DTOA_H_
+
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Provides the shortest decimal representation of v that reads back as v.
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// Unlike FastDtoa this always succeeds. There will be *length digits inside
+// the buffer followed by a null terminator. The result satisfies
+//     v == (double) (buffer * 10^(point - length)),
+// the digits in the buffer are the shortest representation possible, and of
+// those the one closest to v. Ties are broken towards an even last digit.
+// The buffer must be large enough to hold the result.
+V8_EXPORT_PRIVATE void RyuDtoa(double v, Vector<char> buffer, int* length,
+                               int* decimal_point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_NUMBERS_RYU_DTOA_H_
@@ -160,6 +160,19 @@ BackingStore::~BackingStore() {
     return;
   }
 
+  if (is_growable_) {
+    DCHECK(free_on_destruct_);
+    DCHECK(!custom_deleter_);
+    TRACE_BS("BSg:free  bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
+             buffer_start_, byte_length(), byte_capacity_);
+    // Growable backing stores are always allocated through the page
+    // allocator, and reserve exactly their capacity.
+    CHECK(FreePages(GetPlatformPageAllocator(), buffer_start_, byte_capacity_));
+    BackingStore::ReleaseReservation(byte_capacity_);
+    Clear();
+    return;
+  }
+
   if (is_wasm_memory_) {
     DCHECK(free_on_destruct_);
     DCHECK(!custom_deleter_);
@@ -267,6 +280,71 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   return std::unique_ptr<BackingStore>(result);
 }
 
+std::unique_ptr<BackingStore> BackingStore::AllocateGrowable(
+    size_t byte_length, size_t max_byte_length) {
+  DCHECK_LE(byte_length, max_byte_length);
+  v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+  size_t page_size = page_allocator->AllocatePageSize();
+  // Cannot reserve 0 pages on some OSes.
+  size_t byte_capacity =
+      RoundUp(std::max(max_byte_length, size_t{1}), page_size);
+  if (byte_capacity < max_byte_length) return {};
+
+  TRACE_BS("BSg:try   %zu bytes, %zu max\n", byte_length, max_byte_length);
+  if (!BackingStore::ReserveAddressSpace(byte_capacity)) return {};
+
+  void* buffer_start = AllocatePages(page_allocator, nullptr, byte_capacity,
+                                     page_size, PageAllocator::kNoAccess);
+  if (buffer_start == nullptr) {
+    BackingStore::ReleaseReservation(byte_capacity);
+    return {};
+  }
+  size_t committed_length = RoundUp(byte_length, page_size);
+  if (committed_length > 0 &&
+      !SetPermissions(page_allocator, buffer_start, committed_length,
+                      PageAllocator::kReadWrite)) {
+    CHECK(FreePages(page_allocator, buffer_start, byte_capacity));
+    BackingStore::ReleaseReservation(byte_capacity);
+    return {};
+  }
+
+  auto result = new BackingStore(buffer_start,            // start
+                                 byte_length,             // length
+                                 byte_capacity,           // capacity
+                                 SharedFlag::kNotShared,  // shared
+                                 false,                   // is_wasm_memory
+                                 true,                    // free_on_destruct
+                                 false,                   // has_guard_regions
+                                 false,                   // custom_deleter
+                                 false);                  // empty_deleter
+  result->is_growable_ = true;
+
+  TRACE_BS("BSg:alloc bs=%p mem=%p (length=%zu, capacity=%zu)\n", result,
+           result->buffer_start(), byte_length, byte_capacity);
+  return std::unique_ptr<BackingStore>(result);
+}
+
+bool BackingStore::GrowInPlace(size_t new_byte_length) {
+  DCHECK(is_growable_);
+  size_t old_length = byte_length();
+  if (new_byte_length < old_length || new_byte_length > byte_capacity_) {
+    return false;
+  }
+  // Newly committed pages are zero-filled by the OS.
+  v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+  size_t committed_length =
+      RoundUp(new_byte_length, page_allocator->AllocatePageSize());
+  if (committed_length > 0 &&
+      !SetPermissions(page_allocator, buffer_start_, committed_length,
+                      PageAllocator::kReadWrite)) {
+    return false;
+  }
+  byte_length_.store(new_byte_length, std::memory_order_relaxed);
+  TRACE_BS("BSg:grow  bs=%p mem=%p (length=%zu -> %zu)\n", this, buffer_start_,
+           old_length, new_byte_length);
+  return true;
+}
+
 // Trying to allocate 4 GiB on a 32-bit platform is guaranteed to fail.
 // We don't lower the official max_mem_pages() limit because that would be
 // observable upon instantiation; this way the effective limit on 32-bit
@@ -621,8 +699,8 @@ std::unique_ptr<BackingStore> BackingStore::EmptyBackingStore(
 }
 
 bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
-  CHECK(!is_wasm_memory_ && !custom_deleter_ && !globally_registered_ &&
-        free_on_destruct_);
+  CHECK(!is_wasm_memory_ && !is_growable_ && !custom_deleter_ &&
+        !globally_registered_ && free_on_destruct_);
   auto allocator = get_v8_api_array_buffer_allocator();
   CHECK_EQ(isolate->array_buffer_allocator(), allocator);
   CHECK_EQ(byte_length_, byte_capacity_);
@@ -54,6 +54,12 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
                                                           size_t maximum_pages,
                                                           SharedFlag shared);
 
+  // Allocate a backing store that reserves {max_byte_length} bytes of address
+  // space up front and only commits the pages in use, so that it can grow in
+  // place without moving. Always uses the page allocator.
+  static std::unique_ptr<BackingStore> AllocateGrowable(size_t byte_length,
+                                                        size_t max_byte_length);
+
   // Create a backing store that wraps existing allocated memory.
   // If {free_on_destruct} is {true}, the memory will be freed using the
   // ArrayBufferAllocator::Free() callback when this backing store is
@@ -83,12 +89,19 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   bool is_wasm_memory() const { return is_wasm_memory_; }
   bool has_guard_regions() const { return has_guard_regions_; }
   bool free_on_destruct() const { return free_on_destruct_; }
+  bool is_growable() const { return is_growable_; }
 
   // Attempt to grow this backing store in place.
   base::Optional<size_t> GrowWasmMemoryInPlace(Isolate* isolate,
                                                size_t delta_pages,
                                                size_t max_pages);
 
+  // Grow a backing store created by {AllocateGrowable()} to {new_byte_length}
+  // by committing more of its reservation. Returns false if the new length is
+  // smaller than the current one, exceeds the capacity, or the pages cannot
+  // be committed.
+  bool GrowInPlace(size_t new_byte_length);
+
   // Wrapper around ArrayBuffer::Allocator::Reallocate.
   bool Reallocate(Isolate* isolate, size_t new_byte_length);
 
@@ -156,7 +169,8 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
         has_guard_regions_(has_guard_regions),
         globally_registered_(false),
         custom_deleter_(custom_deleter),
-        empty_deleter_(empty_deleter) {}
+        empty_deleter_(empty_deleter),
+        is_growable_(false) {}
   BackingStore(const BackingStore&) = delete;
   BackingStore& operator=(const BackingStore&) = delete;
   void SetAllocatorFromIsolate(Isolate* isolate);
@@ -202,6 +216,7 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   bool globally_registered_ : 1;
   bool custom_deleter_ : 1;
   bool empty_deleter_ : 1;
+  bool is_growable_ : 1;
 
   // Accessors for type-specific data.
   v8::ArrayBuffer::Allocator* get_v8_api_array_buffer_allocator();
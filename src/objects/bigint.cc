@@ -19,6 +19,9 @@
 
 #include "src/objects/bigint.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/execution/isolate-inl.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-write-barrier-inl.h"
@@ -139,6 +142,8 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
 
   static int AbsoluteCompare(BigIntBase x, BigIntBase y);
 
+  static void AbsoluteMultiplyLarge(BigIntBase x, BigIntBase y,
+                                    MutableBigInt result);
   static void MultiplyAccumulate(Handle<BigIntBase> multiplicand,
                                  digit_t multiplier,
                                  Handle<MutableBigInt> accumulator,
@@ -155,6 +160,11 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
                                Handle<BigIntBase> divisor,
                                Handle<MutableBigInt>* quotient,
                                Handle<MutableBigInt>* remainder);
+  static void AbsoluteDivBurnikelZiegler(Isolate* isolate,
+                                         Handle<BigIntBase> dividend,
+                                         Handle<BigIntBase> divisor,
+                                         Handle<MutableBigInt>* quotient,
+                                         Handle<MutableBigInt>* remainder);
   static bool ProductGreaterThan(digit_t factor1, digit_t factor2, digit_t high,
                                  digit_t low);
   digit_t InplaceAdd(Handle<BigIntBase> summand, int start_index);
@@ -203,6 +213,7 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
   static inline digit_t digit_div(digit_t high, digit_t low, digit_t divisor,
                                   digit_t* remainder);
   static digit_t digit_pow(digit_t base, digit_t exponent);
+  static std::vector<digit_t> CopyDigits(BigIntBase x);
   static inline bool digit_ismax(digit_t x) {
     return static_cast<digit_t>(~x) == 0;
   }
@@ -256,6 +267,408 @@ MaybeHandle<T> ThrowBigIntTooBig(Isolate* isolate) {
   THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kBigIntTooBig), T);
 }
 
+namespace {
+
+using digit_t = uintptr_t;
+constexpr int kDigitBits = kSystemPointerSize * kBitsPerByte;
+
+// Operand sizes (in digits) from which on the subquadratic algorithms below
+// beat the classic ones.
+constexpr int kKaratsubaThreshold = 34;
+constexpr int kBurnikelZieglerThreshold = 57;
+constexpr int kToStringDivideAndConquerThreshold = 64;
+
+// The helpers below work on raw little-endian digit arrays outside the heap,
+// so that the recursive algorithms can operate on slices of their inputs
+// without allocating intermediate BigInts.
+
+int NormalizedLength(const digit_t* x, int length) {
+  while (length > 0 && x[length - 1] == 0) length--;
+  return length;
+}
+
+int CompareDigits(const digit_t* x, const digit_t* y, int length) {
+  for (int i = length - 1; i >= 0; i--) {
+    if (x[i] != y[i]) return x[i] > y[i] ? 1 : -1;
+  }
+  return 0;
+}
+
+// z := x + y, where {x_length} >= {y_length}. Returns the carry.
+// {z} must have room for {x_length} digits and may alias {x}.
+digit_t AddDigits(digit_t* z, const digit_t* x, int x_length,
+                  const digit_t* y, int y_length) {
+  DCHECK_GE(x_length, y_length);
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < y_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = MutableBigInt::digit_add(x[i], y[i], &new_carry);
+    z[i] = MutableBigInt::digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  for (; i < x_length; i++) {
+    digit_t new_carry = 0;
+    z[i] = MutableBigInt::digit_add(x[i], carry, &new_carry);
+    carry = new_carry;
+  }
+  return carry;
+}
+
+// z := x - y, where {x_length} >= {y_length}. Returns the borrow.
+// {z} must have room for {x_length} digits and may alias {x}.
+digit_t SubtractDigits(digit_t* z, const digit_t* x, int x_length,
+                       const digit_t* y, int y_length) {
+  DCHECK_GE(x_length, y_length);
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < y_length; i++) {
+    digit_t new_borrow = 0;
+    digit_t difference = MutableBigInt::digit_sub(x[i], y[i], &new_borrow);
+    z[i] = MutableBigInt::digit_sub(difference, borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  for (; i < x_length; i++) {
+    digit_t new_borrow = 0;
+    z[i] = MutableBigInt::digit_sub(x[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  return borrow;
+}
+
+// z += x, where the sum is known to fit into {z_length} digits.
+void AddInto(digit_t* z, int z_length, const digit_t* x, int x_length) {
+  DCHECK_LE(x_length, z_length);
+  digit_t carry = AddDigits(z, z, x_length, x, x_length);
+  for (int i = x_length; carry != 0; i++) {
+    DCHECK_LT(i, z_length);
+    digit_t new_carry = 0;
+    z[i] = MutableBigInt::digit_add(z[i], carry, &new_carry);
+    carry = new_carry;
+  }
+}
+
+// z -= x, where the difference is known to be non-negative.
+void SubtractFrom(digit_t* z, int z_length, const digit_t* x, int x_length) {
+  DCHECK_LE(x_length, z_length);
+  digit_t borrow = SubtractDigits(z, z, x_length, x, x_length);
+  for (int i = x_length; borrow != 0; i++) {
+    DCHECK_LT(i, z_length);
+    digit_t new_borrow = 0;
+    z[i] = MutableBigInt::digit_sub(z[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+}
+
+// z := x << shift, for 0 <= {shift} < kDigitBits. {z} must have room for
+// {x_length} + 1 digits and may alias {x}.
+void LeftShiftDigits(digit_t* z, const digit_t* x, int x_length, int shift) {
+  DCHECK_LT(shift, kDigitBits);
+  if (shift == 0) {
+    std::copy(x, x + x_length, z);
+    z[x_length] = 0;
+    return;
+  }
+  digit_t carry = 0;
+  for (int i = 0; i < x_length; i++) {
+    digit_t d = x[i];
+    z[i] = (d << shift) | carry;
+    carry = d >> (kDigitBits - shift);
+  }
+  z[x_length] = carry;
+}
+
+// x >>= shift, for 0 <= {shift} < kDigitBits.
+void RightShiftDigitsInPlace(digit_t* x, int x_length, int shift) {
+  DCHECK_LT(shift, kDigitBits);
+  if (shift == 0) return;
+  for (int i = 0; i < x_length - 1; i++) {
+    x[i] = (x[i] >> shift) | (x[i + 1] << (kDigitBits - shift));
+  }
+  if (x_length > 0) x[x_length - 1] >>= shift;
+}
+
+// z := x * y. {z} must have room for {x_length} + {y_length} digits and
+// must not alias either input.
+void MultiplySchoolbook(digit_t* z, const digit_t* x, int x_length,
+                        const digit_t* y, int y_length) {
+  std::fill(z, z + x_length + y_length, 0);
+  for (int i = 0; i < x_length; i++) {
+    digit_t multiplier = x[i];
+    if (multiplier == 0) continue;
+    digit_t carry = 0;
+    for (int j = 0; j < y_length; j++) {
+      // x[i] * y[j] + z[i + j] + carry always fits into two digits.
+      digit_t high;
+      digit_t low = MutableBigInt::digit_mul(multiplier, y[j], &high);
+      digit_t new_carry = 0;
+      low = MutableBigInt::digit_add(low, z[i + j], &new_carry);
+      low = MutableBigInt::digit_add(low, carry, &new_carry);
+      z[i + j] = low;
+      carry = high + new_carry;
+    }
+    z[i + y_length] = carry;
+  }
+}
+
+// z := x * y for two {n}-digit factors, using Karatsuba's algorithm:
+//   x * y = x1*y1 * B^2k + ((x0+x1)*(y0+y1) - x0*y0 - x1*y1) * B^k + x0*y0
+// {z} must have room for 2 * {n} digits and must not alias either input.
+void MultiplyKaratsuba(digit_t* z, const digit_t* x, const digit_t* y, int n) {
+  if (n < kKaratsubaThreshold) return MultiplySchoolbook(z, x, n, y, n);
+  int k = n / 2;
+  int h = n - k;
+  MultiplyKaratsuba(z, x, y, k);
+  MultiplyKaratsuba(z + 2 * k, x + k, y + k, h);
+  std::vector<digit_t> scratch(4 * (h + 1));
+  digit_t* x_sum = scratch.data();
+  digit_t* y_sum = x_sum + (h + 1);
+  digit_t* middle = y_sum + (h + 1);
+  x_sum[h] = AddDigits(x_sum, x + k, h, x, k);
+  y_sum[h] = AddDigits(y_sum, y + k, h, y, k);
+  MultiplyKaratsuba(middle, x_sum, y_sum, h + 1);
+  SubtractFrom(middle, 2 * (h + 1), z, 2 * k);
+  SubtractFrom(middle, 2 * (h + 1), z + 2 * k, 2 * h);
+  AddInto(z + k, 2 * n - k, middle, NormalizedLength(middle, 2 * (h + 1)));
+}
+
+// z := x * y for arbitrary factor lengths. {z} must have room for
+// {x_length} + {y_length} digits and must not alias either input.
+void MultiplyDigits(digit_t* z, const digit_t* x, int x_length,
+                    const digit_t* y, int y_length) {
+  if (x_length < y_length) {
+    std::swap(x, y);
+    std::swap(x_length, y_length);
+  }
+  if (y_length < kKaratsubaThreshold) {
+    return MultiplySchoolbook(z, x, x_length, y, y_length);
+  }
+  if (x_length == y_length) return MultiplyKaratsuba(z, x, y, x_length);
+  // Split the longer factor into chunks of the shorter factor's length.
+  std::fill(z, z + x_length + y_length, 0);
+  std::vector<digit_t> chunk_product(2 * y_length);
+  for (int i = 0; i < x_length; i += y_length) {
+    int chunk_length = std::min(y_length, x_length - i);
+    MultiplyDigits(chunk_product.data(), x + i, chunk_length, y, y_length);
+    AddInto(z + i, x_length + y_length - i, chunk_product.data(),
+            chunk_length + y_length);
+  }
+}
+
+// q := a / b, r := a % b, for a divisor {b} whose most significant bit is
+// set. {q} (if given) must have room for {a_length} - {b_length} + 1 digits,
+// {r} (if given) for {b_length} digits.
+// See Knuth, Volume 2, section 4.3.1, Algorithm D.
+void DivideSchoolbook(digit_t* q, digit_t* r, const digit_t* a, int a_length,
+                      const digit_t* b, int b_length) {
+  DCHECK_GE(a_length, b_length);
+  DCHECK_NE(b[b_length - 1] >> (kDigitBits - 1), 0);
+  int n = b_length;
+  int m = a_length - n;
+  if (n == 1) {
+    digit_t remainder = 0;
+    for (int i = a_length - 1; i >= 0; i--) {
+      digit_t digit = MutableBigInt::digit_div(remainder, a[i], b[0],
+                                               &remainder);
+      if (q != nullptr) q[i] = digit;
+    }
+    if (r != nullptr) r[0] = remainder;
+    return;
+  }
+  std::vector<digit_t> u(a_length + 1);
+  std::copy(a, a + a_length, u.begin());
+  std::vector<digit_t> qhatv(n + 1);
+  digit_t vn1 = b[n - 1];
+  digit_t vn2 = b[n - 2];
+  for (int j = m; j >= 0; j--) {
+    digit_t qhat = std::numeric_limits<digit_t>::max();
+    digit_t ujn = u[j + n];
+    if (ujn != vn1) {
+      digit_t rhat = 0;
+      qhat = MutableBigInt::digit_div(ujn, u[j + n - 1], vn1, &rhat);
+      digit_t ujn2 = u[j + n - 2];
+      while (MutableBigInt::ProductGreaterThan(qhat, vn2, rhat, ujn2)) {
+        qhat--;
+        digit_t prev_rhat = rhat;
+        rhat += vn1;
+        if (rhat < prev_rhat) break;
+      }
+    }
+    digit_t carry = 0;
+    for (int i = 0; i < n; i++) {
+      digit_t high;
+      digit_t low = MutableBigInt::digit_mul(b[i], qhat, &high);
+      digit_t new_carry = 0;
+      qhatv[i] = MutableBigInt::digit_add(low, carry, &new_carry);
+      carry = high + new_carry;
+    }
+    qhatv[n] = carry;
+    if (SubtractDigits(&u[j], &u[j], n + 1, qhatv.data(), n + 1) != 0) {
+      u[j + n] += AddDigits(&u[j], &u[j], n, b, n);
+      qhat--;
+    }
+    if (q != nullptr) q[j] = qhat;
+  }
+  if (r != nullptr) std::copy(u.begin(), u.begin() + n, r);
+}
+
+void DivideBurnikelZiegler3n2n(digit_t* q, digit_t* r, const digit_t* a,
+                               const digit_t* b, int n);
+
+// q := a / b, r := a % b, where {a} has 2 * {n} digits, {b} has {n} digits
+// and its most significant bit set, and a < b * B^n, so that the quotient
+// fits into {n} digits. {q} and {r} get {n} digits each.
+// See Burnikel and Ziegler, "Fast Recursive Division", 1998.
+void DivideBurnikelZiegler2n1n(digit_t* q, digit_t* r, const digit_t* a,
+                               const digit_t* b, int n) {
+  if (n % 2 != 0 || n < kBurnikelZieglerThreshold) {
+    std::vector<digit_t> quotient(n + 1);
+    DivideSchoolbook(quotient.data(), r, a, 2 * n, b, n);
+    DCHECK_EQ(quotient[n], 0);
+    std::copy(quotient.begin(), quotient.begin() + n, q);
+    return;
+  }
+  int half = n / 2;
+  // Divide the upper three quarters of {a}, then the remainder combined
+  // with the lowest quarter.
+  std::vector<digit_t> next(3 * half);
+  DivideBurnikelZiegler3n2n(q + half, next.data() + half, a + half, b, half);
+  std::copy(a, a + half, next.begin());
+  DivideBurnikelZiegler3n2n(q, r, next.data(), b, half);
+}
+
+// q := a / b, r := a % b, where {a} has 3 * {n} digits, {b} has 2 * {n}
+// digits and its most significant bit set, and a < b * B^n. {q} gets {n}
+// digits, {r} gets 2 * {n} digits.
+void DivideBurnikelZiegler3n2n(digit_t* q, digit_t* r, const digit_t* a,
+                               const digit_t* b, int n) {
+  const digit_t* a1 = a + 2 * n;
+  const digit_t* b1 = b + n;
+  const digit_t* b2 = b;
+  // {remainder} holds [r1 a3] and later the final remainder; it needs one
+  // extra digit because r1 can exceed n digits when a1 == b1.
+  std::vector<digit_t> remainder(2 * n + 1);
+  digit_t* r1 = remainder.data() + n;
+  if (CompareDigits(a1, b1, n) < 0) {
+    DivideBurnikelZiegler2n1n(q, r1, a + n, b1, n);
+  } else {
+    // a < b * B^n implies a1 == b1, so q is at most B^n - 1, and
+    // r1 = [a1 a2] - [b1 0] + b1 = a2 + b1.
+    DCHECK_EQ(CompareDigits(a1, b1, n), 0);
+    std::fill(q, q + n, std::numeric_limits<digit_t>::max());
+    r1[n] = AddDigits(r1, a + n, n, b1, n);
+  }
+  std::copy(a, a + n, remainder.begin());
+  std::vector<digit_t> d(2 * n);
+  MultiplyDigits(d.data(), q, n, b2, n);
+  // The estimated quotient is at most two too large; correct it while the
+  // remainder is negative.
+  if (SubtractDigits(remainder.data(), remainder.data(), 2 * n + 1, d.data(),
+                     2 * n) != 0) {
+    do {
+      digit_t borrow = 1;
+      for (int i = 0; borrow != 0; i++) {
+        DCHECK_LT(i, n);
+        digit_t new_borrow = 0;
+        q[i] = MutableBigInt::digit_sub(q[i], borrow, &new_borrow);
+        borrow = new_borrow;
+      }
+    } while (AddDigits(remainder.data(), remainder.data(), 2 * n + 1, b,
+                       2 * n) == 0);
+  }
+  DCHECK_EQ(remainder[2 * n], 0);
+  std::copy(remainder.begin(), remainder.begin() + 2 * n, r);
+}
+
+// q := a / b, r := a % b, using Burnikel-Ziegler division on blocks of the
+// (normalized and padded) divisor's size. {q} must have room for
+// {a_length} - {b_length} + 1 digits, {r} for {b_length} digits.
+void DivideBurnikelZiegler(digit_t* q, digit_t* r, const digit_t* a,
+                           int a_length, const digit_t* b, int b_length) {
+  // Choose a block size n = j * 2^k >= b_length with j below the threshold,
+  // so that the recursion bottoms out in the schoolbook algorithm.
+  int m = 1;
+  while (m * kBurnikelZieglerThreshold <= b_length) m *= 2;
+  int j = (b_length + m - 1) / m;
+  int n = j * m;
+  // Shift both operands so that the divisor has exactly n digits and its
+  // most significant bit set.
+  int digit_shift = n - b_length;
+  int bit_shift = base::bits::CountLeadingZeros(b[b_length - 1]);
+  std::vector<digit_t> divisor(n + 1);
+  LeftShiftDigits(divisor.data() + digit_shift, b, b_length, bit_shift);
+  DCHECK_EQ(divisor[n], 0);
+  // Split the shifted dividend into t blocks of n digits, such that the
+  // most significant block is smaller than B^n / 2 <= divisor.
+  int shifted_length = a_length + digit_shift + 1;
+  std::vector<digit_t> shifted(shifted_length);
+  LeftShiftDigits(shifted.data() + digit_shift, a, a_length, bit_shift);
+  shifted_length = NormalizedLength(shifted.data(), shifted_length);
+  int64_t bit_length =
+      static_cast<int64_t>(shifted_length) * kDigitBits -
+      base::bits::CountLeadingZeros(shifted[shifted_length - 1]);
+  int64_t block_bits = static_cast<int64_t>(n) * kDigitBits;
+  int t = std::max(2, static_cast<int>((bit_length + block_bits) / block_bits));
+  shifted.resize(static_cast<size_t>(t) * n, 0);
+
+  std::vector<digit_t> quotient(static_cast<size_t>(t - 1) * n);
+  std::vector<digit_t> z(2 * n);
+  std::copy(shifted.begin() + (t - 2) * n, shifted.begin() + t * n, z.begin());
+  std::vector<digit_t> remainder(n);
+  for (int i = t - 2; i >= 0; i--) {
+    DivideBurnikelZiegler2n1n(&quotient[i * n], remainder.data(), z.data(),
+                              divisor.data(), n);
+    if (i > 0) {
+      std::copy(shifted.begin() + (i - 1) * n, shifted.begin() + i * n,
+                z.begin());
+      std::copy(remainder.begin(), remainder.end(), z.begin() + n);
+    }
+  }
+  if (q != nullptr) {
+    int q_length = a_length - b_length + 1;
+    DCHECK_LE(NormalizedLength(quotient.data(), (t - 1) * n), q_length);
+    std::fill(q, q + q_length, 0);
+    std::copy(quotient.begin(),
+              quotient.begin() + std::min(q_length, (t - 1) * n), q);
+  }
+  if (r != nullptr) {
+    RightShiftDigitsInPlace(remainder.data() + digit_shift, b_length,
+                            bit_shift);
+    std::copy(remainder.begin() + digit_shift, remainder.end(), r);
+  }
+}
+
+// q := a / b, r := a % b for a divisor without leading zero digits. {q} (if
+// given) must have room for {a_length} - {b_length} + 1 digits, {r} (if
+// given) for {b_length} digits.
+void DivideDigits(digit_t* q, digit_t* r, const digit_t* a, int a_length,
+                  const digit_t* b, int b_length) {
+  DCHECK_GE(a_length, b_length);
+  DCHECK_NE(b[b_length - 1], 0);
+  if (b_length >= kBurnikelZieglerThreshold &&
+      a_length - b_length >= kBurnikelZieglerThreshold) {
+    return DivideBurnikelZiegler(q, r, a, a_length, b, b_length);
+  }
+  int shift = base::bits::CountLeadingZeros(b[b_length - 1]);
+  std::vector<digit_t> divisor(b_length + 1);
+  LeftShiftDigits(divisor.data(), b, b_length, shift);
+  std::vector<digit_t> dividend(a_length + 1);
+  LeftShiftDigits(dividend.data(), a, a_length, shift);
+  // The shifted dividend has one more digit, so the schoolbook quotient has
+  // one more (zero) digit too.
+  int q_length = a_length - b_length + 1;
+  std::vector<digit_t> quotient(q == nullptr ? 0 : q_length + 1);
+  DivideSchoolbook(q == nullptr ? nullptr : quotient.data(), r,
+                   dividend.data(), a_length + 1, divisor.data(), b_length);
+  if (q != nullptr) {
+    DCHECK_EQ(quotient[q_length], 0);
+    std::copy(quotient.begin(), quotient.begin() + q_length, q);
+  }
+  if (r != nullptr) RightShiftDigitsInPlace(r, b_length, shift);
+}
+
+}  // namespace
+
 template <typename LocalIsolate>
 MaybeHandle<MutableBigInt> MutableBigInt::New(LocalIsolate* isolate, int length,
                                               AllocationType allocation) {
@@ -525,6 +938,12 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
   if (!MutableBigInt::New(isolate, result_length).ToHandle(&result)) {
     return MaybeHandle<BigInt>();
   }
+  if (x->length() >= kKaratsubaThreshold &&
+      y->length() >= kKaratsubaThreshold) {
+    MutableBigInt::AbsoluteMultiplyLarge(*x, *y, *result);
+    result->set_sign(x->sign() != y->sign());
+    return MutableBigInt::MakeImmutable(result);
+  }
   result->InitializeDigits(result_length);
   uintptr_t work_estimate = 0;
   for (int i = 0; i < x->length(); i++) {
@@ -1454,6 +1873,21 @@ int MutableBigInt::AbsoluteCompare(BigIntBase x, BigIntBase y) {
   return x.digit(i) > y.digit(i) ? 1 : -1;
 }
 
+// Multiplies {x} with {y} and stores the absolute value of the result in
+// {result}, which must have room for both lengths combined. Balanced parts are
+// multiplied with Karatsuba's algorithm.
+void MutableBigInt::AbsoluteMultiplyLarge(BigIntBase x, BigIntBase y,
+                                          MutableBigInt result) {
+  DisallowHeapAllocation no_gc;
+  std::vector<digit_t> x_digits = CopyDigits(x);
+  std::vector<digit_t> y_digits = CopyDigits(y);
+  std::vector<digit_t> product(x.length() + y.length());
+  MultiplyDigits(product.data(), x_digits.data(), x.length(), y_digits.data(),
+                 y.length());
+  DCHECK_EQ(result.length(), static_cast<int>(product.size()));
+  for (int i = 0; i < result.length(); i++) result.set_digit(i, product[i]);
+}
+
 // Multiplies {multiplicand} with {multiplier} and adds the result to
 // {accumulator}, starting at {accumulator_index} for the least-significant
 // digit.
@@ -1588,6 +2022,12 @@ bool MutableBigInt::AbsoluteDivLarge(Isolate* isolate,
   int n = divisor->length();
   int m = dividend->length() - n;
 
+  if (n >= kBurnikelZieglerThreshold && m >= kBurnikelZieglerThreshold) {
+    AbsoluteDivBurnikelZiegler(isolate, dividend, divisor, quotient,
+                               remainder);
+    return true;
+  }
+
   // The quotient to be computed.
   Handle<MutableBigInt> q;
   if (quotient != nullptr) q = New(isolate, m + 1).ToHandleChecked();
@@ -1687,6 +2127,32 @@ bool MutableBigInt::AbsoluteDivLarge(Isolate* isolate,
   return true;
 }
 
+// Same contract as AbsoluteDivLarge, for large divisors and quotients.
+// See Burnikel and Ziegler, "Fast Recursive Division", 1998.
+void MutableBigInt::AbsoluteDivBurnikelZiegler(
+    Isolate* isolate, Handle<BigIntBase> dividend, Handle<BigIntBase> divisor,
+    Handle<MutableBigInt>* quotient, Handle<MutableBigInt>* remainder) {
+  int n = divisor->length();
+  int m = dividend->length() - n;
+  std::vector<digit_t> q(quotient != nullptr ? m + 1 : 0);
+  std::vector<digit_t> r(remainder != nullptr ? n : 0);
+  {
+    std::vector<digit_t> a = CopyDigits(*dividend);
+    std::vector<digit_t> b = CopyDigits(*divisor);
+    DivideBurnikelZiegler(quotient != nullptr ? q.data() : nullptr,
+                          remainder != nullptr ? r.data() : nullptr, a.data(),
+                          m + n, b.data(), n);
+  }
+  if (quotient != nullptr) {
+    *quotient = New(isolate, m + 1).ToHandleChecked();  // Caller will trim.
+    for (int i = 0; i <= m; i++) (*quotient)->set_digit(i, q[i]);
+  }
+  if (remainder != nullptr) {
+    *remainder = New(isolate, n).ToHandleChecked();
+    for (int i = 0; i < n; i++) (*remainder)->set_digit(i, r[i]);
+  }
+}
+
 // Returns whether (factor1 * factor2) > (high << kDigitBits) + low.
 bool MutableBigInt::ProductGreaterThan(digit_t factor1, digit_t factor2,
                                        digit_t high, digit_t low) {
@@ -2060,6 +2526,113 @@ MaybeHandle<BigInt> BigInt::FromSerializedDigits(
 
 static const char kConversionChars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
 
+namespace {
+
+// Writes exactly {chars} characters (a multiple of {chunk_chars}) for {x},
+// least significant first and zero-padded, by repeatedly dividing by
+// {chunk_divisor} = radix^chunk_chars.
+void ToStringClassic(uint8_t* out, int chars, const digit_t* x, int x_length,
+                     int radix, digit_t chunk_divisor, int chunk_chars) {
+  std::vector<digit_t> rest(x, x + x_length);
+  int length = NormalizedLength(rest.data(), x_length);
+  for (int pos = 0; pos < chars;) {
+    digit_t chunk = 0;
+    for (int i = length - 1; i >= 0; i--) {
+      rest[i] = MutableBigInt::digit_div(chunk, rest[i], chunk_divisor, &chunk);
+    }
+    length = NormalizedLength(rest.data(), length);
+    for (int i = 0; i < chunk_chars; i++) {
+      out[pos++] = kConversionChars[chunk % radix];
+      chunk /= radix;
+    }
+  }
+  DCHECK_EQ(length, 0);
+}
+
+// Writes exactly chunk_chars << (level + 1) characters for {x}, which must be
+// smaller than powers[level + 1] = powers[level]^2, least significant first
+// and zero-padded. Splits {x} at powers[level] and converts both halves
+// recursively.
+void ToStringRecursive(uint8_t* out, const digit_t* x, int x_length, int level,
+                       const std::vector<std::vector<digit_t>>& powers,
+                       int radix, digit_t chunk_divisor, int chunk_chars) {
+  int chars = chunk_chars << (level + 1);
+  x_length = NormalizedLength(x, x_length);
+  if (level < 0 || x_length < kToStringDivideAndConquerThreshold) {
+    return ToStringClassic(out, chars, x, x_length, radix, chunk_divisor,
+                           chunk_chars);
+  }
+  const std::vector<digit_t>& divisor = powers[level];
+  int divisor_length = static_cast<int>(divisor.size());
+  int half_chars = chunk_chars << level;
+  if (x_length < divisor_length) {
+    ToStringRecursive(out, x, x_length, level - 1, powers, radix,
+                      chunk_divisor, chunk_chars);
+    std::fill(out + half_chars, out + chars, '0');
+    return;
+  }
+  std::vector<digit_t> quotient(x_length - divisor_length + 1);
+  std::vector<digit_t> remainder(divisor_length);
+  DivideDigits(quotient.data(), remainder.data(), x, x_length, divisor.data(),
+               divisor_length);
+  ToStringRecursive(out, remainder.data(), divisor_length, level - 1, powers,
+                    radix, chunk_divisor, chunk_chars);
+  ToStringRecursive(out + half_chars, quotient.data(),
+                    static_cast<int>(quotient.size()), level - 1, powers,
+                    radix, chunk_divisor, chunk_chars);
+}
+
+// Converts {x} to characters in the given {radix}, least significant first.
+// The result may contain leading zeros (at its end).
+std::vector<uint8_t> ToStringDivideAndConquer(const digit_t* x, int x_length,
+                                              int radix,
+                                              digit_t chunk_divisor,
+                                              int chunk_chars) {
+  // powers[i] = chunk_divisor^(2^i), up to about half of {x}'s length.
+  std::vector<std::vector<digit_t>> powers;
+  powers.push_back({chunk_divisor});
+  while (2 * powers.back().size() <= static_cast<size_t>(x_length)) {
+    const std::vector<digit_t>& last = powers.back();
+    int length = static_cast<int>(last.size());
+    std::vector<digit_t> square(2 * length);
+    MultiplyDigits(square.data(), last.data(), length, last.data(), length);
+    square.resize(NormalizedLength(square.data(), 2 * length));
+    powers.push_back(std::move(square));
+  }
+  int top = static_cast<int>(powers.size()) - 1;
+  const std::vector<digit_t>& divisor = powers[top];
+  int divisor_length = static_cast<int>(divisor.size());
+  int block_chars = chunk_chars << top;
+
+  // {x} can be up to (roughly) the fourth power of the largest power, so
+  // peel off blocks of {block_chars} characters from the bottom first.
+  std::vector<uint8_t> result;
+  std::vector<digit_t> rest(x, x + x_length);
+  int rest_length = NormalizedLength(rest.data(), x_length);
+  std::vector<digit_t> remainder(divisor_length);
+  while (rest_length > divisor_length ||
+         (rest_length == divisor_length &&
+          CompareDigits(rest.data(), divisor.data(), divisor_length) >= 0)) {
+    std::vector<digit_t> quotient(rest_length - divisor_length + 1);
+    DivideDigits(quotient.data(), remainder.data(), rest.data(), rest_length,
+                 divisor.data(), divisor_length);
+    size_t pos = result.size();
+    result.resize(pos + block_chars);
+    ToStringRecursive(&result[pos], remainder.data(), divisor_length, top - 1,
+                      powers, radix, chunk_divisor, chunk_chars);
+    rest_length = NormalizedLength(quotient.data(),
+                                   static_cast<int>(quotient.size()));
+    rest = std::move(quotient);
+  }
+  size_t pos = result.size();
+  result.resize(pos + block_chars);
+  ToStringRecursive(&result[pos], rest.data(), rest_length, top - 1, powers,
+                    radix, chunk_divisor, chunk_chars);
+  return result;
+}
+
+}  // namespace
+
 MaybeHandle<String> MutableBigInt::ToStringBasePowerOfTwo(
     Isolate* isolate, Handle<BigIntBase> x, int radix,
     ShouldThrow should_throw) {
@@ -2180,9 +2753,29 @@ MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
   // left-shifting it if the length estimate was too large.
   int pos = 0;
 
-  digit_t last_digit;
+  digit_t last_digit = 0;
+  bool has_last_digit = true;
   if (length == 1) {
     last_digit = x->digit(0);
+  } else if (length >= kToStringDivideAndConquerThreshold) {
+    // Large BigInts are split recursively at powers of the radix, which
+    // together with subquadratic division beats peeling off one chunk at a
+    // time.
+    int chunk_chars =
+        kDigitBits * kBitsPerCharTableMultiplier / max_bits_per_char;
+    digit_t chunk_divisor = digit_pow(radix, chunk_chars);
+    std::vector<uint8_t> reversed;
+    {
+      std::vector<digit_t> digits = CopyDigits(*x);
+      reversed = ToStringDivideAndConquer(digits.data(), length, radix,
+                                          chunk_divisor, chunk_chars);
+    }
+    while (reversed.size() > 1 && reversed.back() == '0') reversed.pop_back();
+    DCHECK_LE(reversed.size(), chars_required);
+    DisallowHeapAllocation no_gc;
+    std::copy(reversed.begin(), reversed.end(), result->GetChars(no_gc));
+    pos = static_cast<int>(reversed.size());
+    has_last_digit = false;
   } else {
     int chunk_chars =
         kDigitBits * kBitsPerCharTableMultiplier / max_bits_per_char;
@@ -2241,10 +2834,12 @@ MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
   }
   DisallowHeapAllocation no_gc;
   uint8_t* chars = result->GetChars(no_gc);
-  do {
-    chars[pos++] = kConversionChars[last_digit % radix];
-    last_digit /= radix;
-  } while (last_digit > 0);
+  if (has_last_digit) {
+    do {
+      chars[pos++] = kConversionChars[last_digit % radix];
+      last_digit /= radix;
+    } while (last_digit > 0);
+  }
   DCHECK_GE(pos, 1);
   DCHECK(pos <= static_cast<int>(chars_required));
   // Remove leading zeroes.
@@ -2721,6 +3316,12 @@ BigInt::digit_t MutableBigInt::digit_pow(digit_t base, digit_t exponent) {
 
 #undef HAVE_TWODIGIT_T
 
+std::vector<BigInt::digit_t> MutableBigInt::CopyDigits(BigIntBase x) {
+  std::vector<digit_t> digits(x.length());
+  for (int i = 0; i < x.length(); i++) digits[i] = x.digit(i);
+  return digits;
+}
+
 void MutableBigInt::set_64_bits(uint64_t bits) {
   STATIC_ASSERT(kDigitBits == 64 || kDigitBits == 32);
   if (kDigitBits == 64) {
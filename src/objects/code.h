@@ -857,7 +857,8 @@ class DeoptimizationData : public FixedArray {
   static const int kBytecodeOffsetRawOffset = 0;
   static const int kTranslationIndexOffset = 1;
   static const int kPcOffset = 2;
-  static const int kDeoptEntrySize = 3;
+  static const int kDeoptReasonRawOffset = 3;
+  static const int kDeoptEntrySize = 4;
 
 // Simple element accessors.
 #define DECL_ELEMENT_ACCESSORS(name, type) \
@@ -885,6 +886,7 @@ class DeoptimizationData : public FixedArray {
   DECL_ENTRY_ACCESSORS(BytecodeOffsetRaw, Smi)
   DECL_ENTRY_ACCESSORS(TranslationIndex, Smi)
   DECL_ENTRY_ACCESSORS(Pc, Smi)
+  DECL_ENTRY_ACCESSORS(DeoptReasonRaw, Smi)
 
 #undef DECL_ENTRY_ACCESSORS
 
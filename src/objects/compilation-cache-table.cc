@@ -424,6 +424,27 @@ void CompilationCacheTable::Age() {
   }
 }
 
+bool CompilationCacheTable::RemoveOldestScript() {
+  DisallowHeapAllocation no_allocation;
+  int oldest_index = -1;
+  int oldest_age = -1;
+  for (InternalIndex entry : IterateEntries()) {
+    const int entry_index = EntryToIndex(entry);
+    if (!get(entry_index).IsFixedArray()) continue;
+    SharedFunctionInfo info = SharedFunctionInfo::cast(get(entry_index + 1));
+    // Scripts whose bytecode has been flushed are older than all others.
+    int age = info.IsInterpreted() ? info.GetBytecodeArray().bytecode_age()
+                                   : BytecodeArray::kAfterLastBytecodeAge;
+    if (age > oldest_age) {
+      oldest_index = entry_index;
+      oldest_age = age;
+    }
+  }
+  if (oldest_index < 0) return false;
+  RemoveEntry(oldest_index);
+  return true;
+}
+
 void CompilationCacheTable::Remove(Object value) {
   DisallowHeapAllocation no_allocation;
   for (InternalIndex entry : IterateEntries()) {
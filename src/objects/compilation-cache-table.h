@@ -129,6 +129,9 @@ class CompilationCacheTable
 
   void Remove(Object value);
   void Age();
+  // Removes the script whose bytecode is the oldest, i.e. the one that has
+  // gone the longest without being run. Returns false if there is none.
+  bool RemoveOldestScript();
 
   DECL_CAST(CompilationCacheTable)
 
@@ -5,6 +5,9 @@
 #ifndef V8_OBJECTS_DICTIONARY_INL_H_
 #define V8_OBJECTS_DICTIONARY_INL_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "src/execution/isolate-utils-inl.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/dictionary.h"
@@ -12,6 +15,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/oddball.h"
 #include "src/objects/property-cell-inl.h"
+#include "src/objects/slots-atomic-inl.h"
 
 // Has to be the last include (doesn't have include guards):
 #include "src/objects/object-macros.h"
@@ -327,6 +331,49 @@ void GlobalDictionaryShape::DetailsAtPut(Dictionary dict, InternalIndex entry,
   cell.set_property_details(value);
 }
 
+template <typename Dictionary>
+void SortByEnumerationIndex(Dictionary dict, FixedArray indices, int length) {
+  DisallowHeapAllocation no_gc;
+  auto enum_index_at = [&](int i) {
+    return dict.DetailsAt(InternalIndex(Smi::ToInt(indices.get(i))))
+        .dictionary_index();
+  };
+  bool sorted = true;
+  int min_enum_index = kMaxInt;
+  int max_enum_index = 0;
+  for (int i = 0; i < length; i++) {
+    int enum_index = enum_index_at(i);
+    if (enum_index < max_enum_index) sorted = false;
+    min_enum_index = std::min(min_enum_index, enum_index);
+    max_enum_index = std::max(max_enum_index, enum_index);
+  }
+  if (sorted) return;
+
+  // Enumeration indices are unique and only get sparse through deletions, so
+  // unless many properties were deleted every index has a bucket of its own.
+  size_t range = static_cast<size_t>(max_enum_index - min_enum_index) + 1;
+  if (range <= 2 * static_cast<size_t>(length)) {
+    std::vector<int> by_enum_index(range, -1);
+    for (int i = 0; i < length; i++) {
+      DCHECK_EQ(-1, by_enum_index[enum_index_at(i) - min_enum_index]);
+      by_enum_index[enum_index_at(i) - min_enum_index] =
+          Smi::ToInt(indices.get(i));
+    }
+    int pos = 0;
+    for (int entry : by_enum_index) {
+      if (entry != -1) indices.set(pos++, Smi::FromInt(entry));
+    }
+    DCHECK_EQ(length, pos);
+    return;
+  }
+
+  EnumIndexComparator<Dictionary> cmp(dict);
+  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
+  // store operations that are safe for concurrent marking.
+  AtomicSlot start(indices.GetFirstElementAddress());
+  std::sort(start, start + length, cmp);
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -367,6 +367,14 @@ struct EnumIndexComparator {
   Dictionary dict;
 };
 
+// Sorts the first |length| entries of |indices|, which hold entry indices of
+// |dict| as Smis, into enumeration order. Already ordered input is detected
+// in a linear scan, and indices that are dense in the enumeration index space
+// are placed directly instead of being sorted.
+template <typename Dictionary>
+inline void SortByEnumerationIndex(Dictionary dict, FixedArray indices,
+                                   int length);
+
 }  // namespace internal
 }  // namespace v8
 
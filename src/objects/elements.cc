@@ -825,11 +825,9 @@ class ElementsAccessorBase : public InternalElementsAccessor {
             object, from_elements, from_kind, capacity);
         JSObject::SetMapAndElements(object, to_map, elements);
       }
-      if (FLAG_trace_elements_transitions) {
-        JSObject::PrintElementsTransition(stdout, object, from_kind,
-                                          from_elements, to_kind,
-                                          handle(object->elements(), isolate));
-      }
+      JSObject::RecordElementsTransition(object, from_kind, from_elements,
+                                         to_kind,
+                                         handle(object->elements(), isolate));
     }
   }
 
@@ -868,10 +866,8 @@ class ElementsAccessorBase : public InternalElementsAccessor {
     // Transition through the allocation site as well if present.
     JSObject::UpdateAllocationSite(object, to_kind);
 
-    if (FLAG_trace_elements_transitions) {
-      JSObject::PrintElementsTransition(stdout, object, from_kind, old_elements,
-                                        to_kind, elements);
-    }
+    JSObject::RecordElementsTransition(object, from_kind, old_elements,
+                                       to_kind, elements);
   }
 
   void TransitionElementsKind(Handle<JSObject> object, Handle<Map> map) final {
@@ -3400,17 +3396,65 @@ class TypedElementsAccessor
              type == kExternalUint8ClampedArray);
   }
 
+  // Number of elements checked at once by the conversion fast paths below.
+  static const size_t kConversionBlockSize = 32;
+
   template <ElementsKind SourceKind, typename SourceElementType>
   static void CopyBetweenBackingStores(SourceElementType* source_data_ptr,
                                        ElementType* dest_data_ptr,
                                        size_t length) {
     DisallowHeapAllocation no_gc;
-    for (size_t i = 0; i < length; i++) {
+    using SourceAccessor = TypedElementsAccessor<SourceKind, SourceElementType>;
+    size_t i = 0;
+    // Conversions from floating point are only simple for values in range of
+    // the destination. Check a block of elements at once, so that the
+    // conversion loop itself has no branches and can be vectorized, and fall
+    // back to the generic conversion for the block otherwise.
+    const bool float_to_int32 =
+        (SourceKind == FLOAT32_ELEMENTS || SourceKind == FLOAT64_ELEMENTS) &&
+        (Kind == INT8_ELEMENTS || Kind == UINT8_ELEMENTS ||
+         Kind == INT16_ELEMENTS || Kind == UINT16_ELEMENTS ||
+         Kind == INT32_ELEMENTS || Kind == UINT32_ELEMENTS);
+    const bool float64_to_float32 =
+        SourceKind == FLOAT64_ELEMENTS && Kind == FLOAT32_ELEMENTS;
+    if (float_to_int32 || float64_to_float32) {
+      const double max = float_to_int32
+                             ? kMaxInt
+                             : std::numeric_limits<float>::max();
+      const double min = float_to_int32 ? kMinInt : -max;
+      for (; i + kConversionBlockSize <= length; i += kConversionBlockSize) {
+        bool in_range = true;
+        for (size_t j = i; j < i + kConversionBlockSize; j++) {
+          double value =
+              static_cast<double>(SourceAccessor::GetImpl(source_data_ptr, j));
+          in_range &= (value >= min && value <= max) ||
+                      (float64_to_float32 && value != value);
+        }
+        if (in_range) {
+          for (size_t j = i; j < i + kConversionBlockSize; j++) {
+            double value = static_cast<double>(
+                SourceAccessor::GetImpl(source_data_ptr, j));
+            // In range, ToInt32 truncates towards zero and the float32
+            // conversion is the plain IEEE rounding.
+            ElementType dest_elem =
+                float_to_int32
+                    ? static_cast<ElementType>(static_cast<int32_t>(value))
+                    : static_cast<ElementType>(value);
+            SetImpl(dest_data_ptr, j, dest_elem);
+          }
+        } else {
+          for (size_t j = i; j < i + kConversionBlockSize; j++) {
+            SetImpl(dest_data_ptr, j,
+                    FromScalar(SourceAccessor::GetImpl(source_data_ptr, j)));
+          }
+        }
+      }
+    }
+    for (; i < length; i++) {
       // We use scalar accessors to avoid boxing/unboxing, so there are no
       // allocations.
       SourceElementType source_elem =
-          TypedElementsAccessor<SourceKind, SourceElementType>::GetImpl(
-              source_data_ptr, i);
+          SourceAccessor::GetImpl(source_data_ptr, i);
       ElementType dest_elem = FromScalar(source_elem);
       SetImpl(dest_data_ptr, i, dest_elem);
     }
@@ -3737,8 +3781,10 @@ Handle<Object> TypedElementsAccessor<FLOAT64_ELEMENTS, double>::ToHandle(
 template <>
 uint8_t TypedElementsAccessor<UINT8_CLAMPED_ELEMENTS, uint8_t>::FromScalar(
     int value) {
-  if (value < 0x00) return 0x00;
-  if (value > 0xFF) return 0xFF;
+  // The clamping conversions use selects rather than early returns, so that
+  // the loops in CopyBetweenBackingStores can be vectorized.
+  value = value < 0x00 ? 0x00 : value;
+  value = value > 0xFF ? 0xFF : value;
   return static_cast<uint8_t>(value);
 }
 
@@ -3748,8 +3794,7 @@ uint8_t TypedElementsAccessor<UINT8_CLAMPED_ELEMENTS, uint8_t>::FromScalar(
     uint32_t value) {
   // We need this special case for Uint32 -> Uint8Clamped, because the highest
   // Uint32 values will be negative as an int, clamping to 0, rather than 255.
-  if (value > 0xFF) return 0xFF;
-  return static_cast<uint8_t>(value);
+  return static_cast<uint8_t>(value > 0xFF ? 0xFF : value);
 }
 
 // static
@@ -3757,9 +3802,12 @@ template <>
 uint8_t TypedElementsAccessor<UINT8_CLAMPED_ELEMENTS, uint8_t>::FromScalar(
     double value) {
   // Handle NaNs and less than zero values which clamp to zero.
-  if (!(value > 0)) return 0;
-  if (value > 0xFF) return 0xFF;
-  return static_cast<uint8_t>(lrint(value));
+  double clamped = value > 0 ? value : 0;
+  clamped = clamped < 0xFF ? clamped : 0xFF;
+  // Adding and subtracting 2^52 rounds to the nearest integer with ties to
+  // even, like lrint in the default rounding mode, but without a call.
+  const double kRoundingBias = 4503599627370496.0;
+  return static_cast<uint8_t>((clamped + kRoundingBias) - kRoundingBias);
 }
 
 // static
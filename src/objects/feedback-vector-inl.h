@@ -135,6 +135,22 @@ OptimizationTier FeedbackVector::optimization_tier() const {
   return tier;
 }
 
+int FeedbackVector::midtier_deopt_count() const {
+  return MidtierDeoptCountBits::decode(flags());
+}
+
+int FeedbackVector::deopt_count() const {
+  return DeoptCountBits::decode(flags());
+}
+
+DeoptimizeReason FeedbackVector::last_deopt_reason() const {
+  return static_cast<DeoptimizeReason>(LastDeoptReasonBits::decode(flags()));
+}
+
+int FeedbackVector::repeated_deopt_count() const {
+  return RepeatedDeoptCountBits::decode(flags());
+}
+
 bool FeedbackVector::has_optimized_code() const {
   return !optimized_code().is_null();
 }
@@ -422,6 +422,33 @@ void FeedbackVector::ClearOptimizationTier() {
   set_flags(state);
 }
 
+void FeedbackVector::SaturatingIncrementMidtierDeoptCount() {
+  int32_t state = flags();
+  int count = MidtierDeoptCountBits::decode(state);
+  if (count < MidtierDeoptCountBits::kMax) {
+    state = MidtierDeoptCountBits::update(state, count + 1);
+    set_flags(state);
+  }
+}
+
+void FeedbackVector::RecordDeopt(DeoptimizeReason reason) {
+  STATIC_ASSERT(kDeoptimizeReasonCount <= LastDeoptReasonBits::kMax + 1);
+  int32_t state = flags();
+  int count = DeoptCountBits::decode(state);
+  int repeated = RepeatedDeoptCountBits::decode(state);
+  bool same_reason = count > 0 && last_deopt_reason() == reason;
+  if (!same_reason) {
+    repeated = 0;
+  } else if (repeated < RepeatedDeoptCountBits::kMax) {
+    repeated++;
+  }
+  if (count < DeoptCountBits::kMax) count++;
+  state = DeoptCountBits::update(state, count);
+  state = LastDeoptReasonBits::update(state, static_cast<int>(reason));
+  state = RepeatedDeoptCountBits::update(state, repeated);
+  set_flags(state);
+}
+
 void FeedbackVector::InitializeOptimizationState() {
   int32_t state = 0;
   state = OptimizationMarkerBits::update(
@@ -11,6 +11,7 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/map.h"
 #include "src/objects/maybe-object.h"
@@ -226,6 +227,17 @@ class FeedbackVector
   void ClearOptimizationTier();
   void InitializeOptimizationState();
 
+  // Counts deopts that invalidated the mid-tier code of the function.
+  inline int midtier_deopt_count() const;
+  void SaturatingIncrementMidtierDeoptCount();
+
+  // Tracks eager and soft deopts that invalidated optimized code of the
+  // function, so that deopt loops can be detected.
+  inline int deopt_count() const;
+  inline DeoptimizeReason last_deopt_reason() const;
+  inline int repeated_deopt_count() const;
+  void RecordDeopt(DeoptimizeReason reason);
+
   // Clears the optimization marker in the feedback vector.
   void ClearOptimizationMarker();
 
@@ -116,6 +116,10 @@ class JSArray : public JSObject {
   // Max. number of elements being copied in Array builtins.
   static const int kMaxCopyElements = 100;
 
+  // Min. number of elements for which cloning a fast array shares its
+  // backing store copy-on-write instead of copying it.
+  static const int kMinCopyOnWriteCloneLength = 256;
+
   // This constant is somewhat arbitrary. Any large enough value would work.
   static const uint32_t kMaxFastArrayLength = 32 * 1024 * 1024;
 
@@ -152,6 +152,12 @@ CodeKind JSFunction::NextTier() const {
     return CodeKind::TURBOFAN;
   } else if (V8_UNLIKELY(FLAG_turboprop)) {
     DCHECK(ActiveTierIsIgnition());
+    // Functions that keep deoptimizing their mid-tier code would otherwise
+    // bounce between Ignition and Turboprop, so they go to TurboFan directly.
+    if (FLAG_turboprop_as_midtier && has_feedback_vector() &&
+        feedback_vector().midtier_deopt_count() >= FLAG_max_midtier_deopts) {
+      return CodeKind::TURBOFAN;
+    }
     return CodeKind::TURBOPROP;
   }
   return CodeKind::TURBOFAN;
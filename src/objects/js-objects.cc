@@ -2594,6 +2594,23 @@ void JSObject::PrintElementsTransition(FILE* file, Handle<JSObject> object,
   }
 }
 
+void JSObject::RecordElementsTransition(Handle<JSObject> object,
+                                        ElementsKind from_kind,
+                                        Handle<FixedArrayBase> from_elements,
+                                        ElementsKind to_kind,
+                                        Handle<FixedArrayBase> to_elements) {
+  if (from_kind == to_kind) return;
+  Isolate* isolate = object->GetIsolate();
+  isolate->counters()->elements_transitions()->Increment();
+  if (FLAG_trace_elements_transitions) {
+    PrintElementsTransition(stdout, object, from_kind, from_elements, to_kind,
+                            to_elements);
+  }
+  if (FLAG_trace_elements_transition_stats) {
+    isolate->CountElementsTransition(from_kind, to_kind);
+  }
+}
+
 void JSObject::PrintInstanceMigration(FILE* file, Map original_map,
                                       Map new_map) {
   if (new_map.is_dictionary_map()) {
@@ -3411,6 +3428,67 @@ void JSObject::NormalizeProperties(Isolate* isolate, Handle<JSObject> object,
                          expected_additional_properties);
 }
 
+namespace {
+
+// Looks for a map in the transition tree of the constructor's initial map that
+// describes the properties of the dictionary mode {object} in their iteration
+// order. Objects that went through dictionary mode can then share their map
+// with objects that got the same properties added directly, instead of each
+// getting a fresh map outside of any transition tree. Only existing
+// transitions are taken, and only if the field representations and field
+// types already cover the property values.
+MaybeHandle<Map> FindCanonicalFastMap(Isolate* isolate,
+                                      Handle<JSObject> object,
+                                      Handle<NameDictionary> dictionary,
+                                      Handle<FixedArray> iteration_order) {
+  DisallowHeapAllocation no_gc;
+  Map old_map = object->map();
+  if (old_map.is_prototype_map()) return MaybeHandle<Map>();
+  Object constructor = old_map.GetConstructor();
+  if (!constructor.IsJSFunction()) return MaybeHandle<Map>();
+  JSFunction function = JSFunction::cast(constructor);
+  if (!function.has_initial_map()) return MaybeHandle<Map>();
+  Map map = function.initial_map();
+  if (map.instance_type() != old_map.instance_type() ||
+      map.instance_size() != old_map.instance_size() ||
+      map.GetInObjectProperties() != old_map.GetInObjectProperties() ||
+      map.prototype() != old_map.prototype() ||
+      map.elements_kind() != old_map.elements_kind() ||
+      map.bit_field() != old_map.bit_field() ||
+      map.is_extensible() != old_map.is_extensible() ||
+      map.is_dictionary_map() || map.is_deprecated() ||
+      map.NumberOfOwnDescriptors() != 0 ||
+      map.IsInobjectSlackTrackingInProgress()) {
+    return MaybeHandle<Map>();
+  }
+
+  for (int i = 0; i < dictionary->NumberOfElements(); i++) {
+    InternalIndex index(Smi::ToInt(iteration_order->get(i)));
+    PropertyDetails details = dictionary->DetailsAt(index);
+    if (details.kind() != kData) return MaybeHandle<Map>();
+    Map target = TransitionsAccessor(isolate, map, &no_gc)
+                     .SearchTransition(dictionary->NameAt(index), kData,
+                                       details.attributes());
+    if (target.is_null() || target.is_deprecated()) return MaybeHandle<Map>();
+    InternalIndex descriptor = target.LastAdded();
+    DescriptorArray descriptors = target.instance_descriptors(kRelaxedLoad);
+    PropertyDetails target_details = descriptors.GetDetails(descriptor);
+    if (target_details.location() != kField) return MaybeHandle<Map>();
+    // Double fields would need fresh boxes, leave those to the generic path.
+    Representation representation = target_details.representation();
+    Object value = dictionary->ValueAt(index);
+    if (representation.IsDouble() ||
+        !value.FitsRepresentation(representation) ||
+        !descriptors.GetFieldType(descriptor).NowContains(value)) {
+      return MaybeHandle<Map>();
+    }
+    map = target;
+  }
+  return handle(map, isolate);
+}
+
+}  // namespace
+
 void JSObject::MigrateSlowToFast(Handle<JSObject> object,
                                  int unused_property_fields,
                                  const char* reason) {
@@ -3473,6 +3551,49 @@ void JSObject::MigrateSlowToFast(Handle<JSObject> object,
 
   int inobject_props = old_map->GetInObjectProperties();
 
+  Handle<Map> canonical_map;
+  if (FLAG_canonical_slow_to_fast_maps && !V8_DICT_MODE_PROTOTYPES_BOOL &&
+      FindCanonicalFastMap(isolate, object, dictionary, iteration_order)
+          .ToHandle(&canonical_map)) {
+    DCHECK_EQ(number_of_fields, canonical_map->NumberOfFields());
+    int number_of_allocated_fields = number_of_fields - inobject_props;
+    if (number_of_allocated_fields > 0) {
+      number_of_allocated_fields += canonical_map->UnusedPropertyFields();
+    } else {
+      number_of_allocated_fields = 0;
+    }
+    Handle<PropertyArray> fields =
+        factory->NewPropertyArray(number_of_allocated_fields);
+
+    NotifyMapChange(old_map, canonical_map, isolate);
+
+    DisallowHeapAllocation no_gc;
+    DescriptorArray descriptors =
+        canonical_map->instance_descriptors(kRelaxedLoad);
+    for (int i = 0; i < number_of_elements; i++) {
+      InternalIndex index(Smi::ToInt(iteration_order->get(i)));
+      InternalIndex descriptor(i);
+      DCHECK_EQ(dictionary->NameAt(index), descriptors.GetKey(descriptor));
+      int field_index = descriptors.GetDetails(descriptor).field_index();
+      Object value = dictionary->ValueAt(index);
+      if (field_index < inobject_props) {
+        object->InObjectPropertyAtPut(field_index, value,
+                                      UPDATE_WRITE_BARRIER);
+      } else {
+        fields->set(field_index - inobject_props, value);
+      }
+    }
+
+    if (FLAG_trace_maps) {
+      LOG(isolate, MapEvent("SlowToFast", old_map, canonical_map, reason));
+    }
+    // Transform the object.
+    object->synchronized_set_map(*canonical_map);
+    object->SetProperties(*fields);
+    DCHECK(object->HasFastProperties());
+    return;
+  }
+
   // Allocate new map.
   Handle<Map> new_map = Map::CopyDropDescriptors(isolate, old_map);
   // We should not only set this bit if we need to. We should not retain the
@@ -4910,10 +5031,8 @@ void JSObject::TransitionElementsKind(Handle<JSObject> object,
     // only requires a map change.
     Handle<Map> new_map = GetElementsTransitionMap(object, to_kind);
     JSObject::MigrateToMap(isolate, object, new_map);
-    if (FLAG_trace_elements_transitions) {
-      Handle<FixedArrayBase> elms(object->elements(), isolate);
-      PrintElementsTransition(stdout, object, from_kind, elms, to_kind, elms);
-    }
+    Handle<FixedArrayBase> elms(object->elements(), isolate);
+    RecordElementsTransition(object, from_kind, elms, to_kind, elms);
   } else {
     DCHECK((IsSmiElementsKind(from_kind) && IsDoubleElementsKind(to_kind)) ||
            (IsDoubleElementsKind(from_kind) && IsObjectElementsKind(to_kind)));
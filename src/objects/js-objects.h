@@ -704,6 +704,14 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
                                       ElementsKind to_kind,
                                       Handle<FixedArrayBase> to_elements);
 
+  // Updates the elements transition counter and, if enabled, traces the
+  // transition and records it for --trace-elements-transition-stats.
+  static void RecordElementsTransition(Handle<JSObject> object,
+                                       ElementsKind from_kind,
+                                       Handle<FixedArrayBase> from_elements,
+                                       ElementsKind to_kind,
+                                       Handle<FixedArrayBase> to_elements);
+
   void PrintInstanceMigration(FILE* file, Map original_map, Map new_map);
 
 #ifdef DEBUG
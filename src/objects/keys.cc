@@ -10,6 +10,7 @@
 #include "src/handles/handles-inl.h"
 #include "src/heap/factory.h"
 #include "src/objects/api-callbacks.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/elements-inl.h"
 #include "src/objects/field-index-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -876,11 +877,7 @@ void CopyEnumKeysTo(Isolate* isolate, Handle<Dictionary> dictionary,
   DisallowHeapAllocation no_gc;
   Dictionary raw_dictionary = *dictionary;
   FixedArray raw_storage = *storage;
-  EnumIndexComparator<Dictionary> cmp(raw_dictionary);
-  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-  // store operations that are safe for concurrent marking.
-  AtomicSlot start(storage->GetFirstElementAddress());
-  std::sort(start, start + length, cmp);
+  SortByEnumerationIndex(raw_dictionary, raw_storage, length);
   for (int i = 0; i < length; i++) {
     InternalIndex index(Smi::ToInt(raw_storage.get(i)));
     raw_storage.set(i, raw_dictionary.NameAt(index));
@@ -957,12 +954,7 @@ ExceptionStatus CollectKeysFromDictionary(Handle<Dictionary> dictionary,
     if (!Dictionary::kIsOrderedDictionaryType) {
       // Sorting only needed if it's an unordered dictionary,
       // otherwise we traversed elements in insertion order
-
-      EnumIndexComparator<Dictionary> cmp(*dictionary);
-      // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-      // store operations that are safe for concurrent marking.
-      AtomicSlot start(array->GetFirstElementAddress());
-      std::sort(start, start + array_size, cmp);
+      SortByEnumerationIndex(*dictionary, *array, array_size);
     }
   }
 
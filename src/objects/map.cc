@@ -726,6 +726,9 @@ void Map::UpdateFieldType(Isolate* isolate, InternalIndex descriptor,
       Descriptor d = Descriptor::DataField(
           name, descriptors.GetFieldIndex(descriptor), details.attributes(),
           new_constness, new_representation, new_wrapped_type);
+      // The compiler may be reading this descriptor from a background thread.
+      base::SharedMutexGuard<base::kExclusive> mutex_guard(
+          isolate->map_updater_access());
       descriptors.Replace(descriptor, &d);
     }
   }
@@ -53,6 +53,7 @@
 #include "src/objects/code-inl.h"
 #include "src/objects/compilation-cache-table-inl.h"
 #include "src/objects/debug-objects-inl.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/field-index-inl.h"
@@ -6071,11 +6072,7 @@ Handle<FixedArray> BaseNameDictionary<Derived, Shape>::IterationIndices(
       DCHECK_EQ(array_size, dictionary->NumberOfElements());
     }
 
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    AtomicSlot start(array->GetFirstElementAddress());
-    std::sort(start, start + array_size, cmp);
+    SortByEnumerationIndex(raw_dictionary, *array, array_size);
   }
   return FixedArray::ShrinkOrEmpty(isolate, array, array_size);
 }
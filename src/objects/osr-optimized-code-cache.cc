@@ -105,6 +105,15 @@ Code OSROptimizedCodeCache::GetOptimizedCode(Handle<SharedFunctionInfo> shared,
   return code;
 }
 
+bool OSROptimizedCodeCache::HasOptimizedCode(SharedFunctionInfo shared) {
+  DisallowHeapAllocation no_gc;
+  for (int index = 0; index < length(); index += kEntryLength) {
+    if (GetSFIFromEntry(index) != shared) continue;
+    if (!GetCodeFromEntry(index).is_null()) return true;
+  }
+  return false;
+}
+
 void OSROptimizedCodeCache::EvictMarkedCode(Isolate* isolate) {
   // This is called from DeoptimizeMarkedCodeForContext that uses raw pointers
   // and hence the DisallowHeapAllocation scope here.
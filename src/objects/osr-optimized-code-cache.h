@@ -45,6 +45,10 @@ class V8_EXPORT OSROptimizedCodeCache : public WeakFixedArray {
   Code GetOptimizedCode(Handle<SharedFunctionInfo> shared, BailoutId osr_offset,
                         Isolate* isolate);
 
+  // Returns true if the cache holds code for any loop of the shared function
+  // |shared|.
+  bool HasOptimizedCode(SharedFunctionInfo shared);
+
   // Remove all code objects marked for deoptimization from OSR code cache.
   void EvictMarkedCode(Isolate* isolate);
 
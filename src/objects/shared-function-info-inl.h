@@ -194,6 +194,13 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_optimized_at_least_once,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, may_have_cached_code,
                     SharedFunctionInfo::MayHaveCachedCodeBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
+                    has_optimization_hint_from_code_cache,
+                    SharedFunctionInfo::HasOptimizationHintFromCodeCacheBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_flushed_bytecode,
+                    SharedFunctionInfo::HasFlushedBytecodeBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -505,7 +512,8 @@ void SharedFunctionInfo::set_bytecode_array(BytecodeArray bytecode) {
   set_function_data(bytecode, kReleaseStore);
 }
 
-bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode) {
+bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode,
+                                             int old_bytecode_age) {
   if (mode == BytecodeFlushMode::kDoNotFlushBytecode) return false;
 
   // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
@@ -523,7 +531,7 @@ bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode) {
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
-  return bytecode.IsOld();
+  return bytecode.bytecode_age() >= old_bytecode_age;
 }
 
 Code SharedFunctionInfo::InterpreterTrampoline() const {
@@ -422,6 +422,15 @@ class SharedFunctionInfo : public HeapObject {
   // hence the 'may'.
   DECL_BOOLEAN_ACCESSORS(may_have_cached_code)
 
+  // True if this SFI was deserialized from a code cache that was created
+  // after the function had been optimized. The runtime profiler then
+  // optimizes it with fewer ticks; the hint is dropped once that happened.
+  DECL_BOOLEAN_ACCESSORS(has_optimization_hint_from_code_cache)
+
+  // True if the bytecode of this SFI has been flushed since it was last
+  // compiled.
+  DECL_BOOLEAN_ACCESSORS(has_flushed_bytecode)
+
   // Returns the cached Code object for this SFI if it exists, an empty handle
   // otherwise.
   MaybeHandle<Code> TryGetCachedCode(Isolate* isolate);
@@ -541,7 +550,8 @@ class SharedFunctionInfo : public HeapObject {
   // Returns true if the function has old bytecode that could be flushed. This
   // function shouldn't access any flags as it is used by concurrent marker.
   // Hence it takes the mode as an argument.
-  inline bool ShouldFlushBytecode(BytecodeFlushMode mode);
+  inline bool ShouldFlushBytecode(BytecodeFlushMode mode,
+                                  int old_bytecode_age);
 
   enum Inlineability {
     kIsInlineable,
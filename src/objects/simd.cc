@@ -0,0 +1,449 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/simd.h"
+
+#include <cmath>
+#include <type_traits>
+
+#include "src/base/bits.h"
+#include "src/codegen/cpu-features.h"
+#include "src/objects/heap-number-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/smi-inl.h"
+
+#if V8_HOST_ARCH_X64
+#include <immintrin.h>
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr intptr_t kNotFound = -1;
+
+// AVX2 code is compiled with a per-function target attribute and only run
+// after checking CpuFeatures, so that the rest of V8 can be built for the
+// SSE2 baseline.
+#if V8_HOST_ARCH_X64 && V8_TARGET_ARCH_X64 && \
+    (defined(__clang__) || defined(__GNUC__))
+#define V8_ARRAY_SEARCH_AVX2 1
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+template <typename T>
+intptr_t ScalarSearch(const T* array, uintptr_t array_len, uintptr_t index,
+                      T search_element) {
+  for (; index < array_len; ++index) {
+    if (array[index] == search_element) return index;
+  }
+  return kNotFound;
+}
+
+intptr_t ScalarSearchNaN(const double* array, uintptr_t array_len,
+                         uintptr_t index) {
+  for (; index < array_len; ++index) {
+    if (std::isnan(array[index])) return index;
+  }
+  return kNotFound;
+}
+
+#if V8_HOST_ARCH_X64
+
+// SSE2 is part of the x64 baseline, so these need no feature check.
+
+intptr_t SearchSSE2(const uint32_t* array, uintptr_t array_len,
+                    uintptr_t index, uint32_t search_element) {
+  const __m128i target = _mm_set1_epi32(search_element);
+  for (; index + 4 <= array_len; index += 4) {
+    __m128i elements =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(array + index));
+    int mask = _mm_movemask_ps(
+        _mm_castsi128_ps(_mm_cmpeq_epi32(elements, target)));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t SearchSSE2(const uint64_t* array, uintptr_t array_len,
+                    uintptr_t index, uint64_t search_element) {
+  const __m128i target = _mm_set1_epi64x(search_element);
+  for (; index + 2 <= array_len; index += 2) {
+    __m128i elements =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(array + index));
+    // SSE2 has no 64-bit integer comparison; combine the results for the
+    // two halves of each element instead.
+    __m128i equal32 = _mm_cmpeq_epi32(elements, target);
+    __m128i equal64 = _mm_and_si128(
+        equal32, _mm_shuffle_epi32(equal32, _MM_SHUFFLE(2, 3, 0, 1)));
+    int mask = _mm_movemask_pd(_mm_castsi128_pd(equal64));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t SearchSSE2(const double* array, uintptr_t array_len, uintptr_t index,
+                    double search_element) {
+  const __m128d target = _mm_set1_pd(search_element);
+  for (; index + 2 <= array_len; index += 2) {
+    __m128d elements = _mm_loadu_pd(array + index);
+    int mask = _mm_movemask_pd(_mm_cmpeq_pd(elements, target));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t SearchNaNSSE2(const double* array, uintptr_t array_len,
+                       uintptr_t index) {
+  for (; index + 2 <= array_len; index += 2) {
+    __m128d elements = _mm_loadu_pd(array + index);
+    int mask = _mm_movemask_pd(_mm_cmpunord_pd(elements, elements));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return ScalarSearchNaN(array, array_len, index);
+}
+
+#ifdef V8_ARRAY_SEARCH_AVX2
+
+TARGET_AVX2 intptr_t SearchAVX2(const uint32_t* array, uintptr_t array_len,
+                                uintptr_t index, uint32_t search_element) {
+  const __m256i target = _mm256_set1_epi32(search_element);
+  for (; index + 8 <= array_len; index += 8) {
+    __m256i elements =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(array + index));
+    int mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(elements, target)));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return SearchSSE2(array, array_len, index, search_element);
+}
+
+TARGET_AVX2 intptr_t SearchAVX2(const uint64_t* array, uintptr_t array_len,
+                                uintptr_t index, uint64_t search_element) {
+  const __m256i target = _mm256_set1_epi64x(search_element);
+  for (; index + 4 <= array_len; index += 4) {
+    __m256i elements =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(array + index));
+    int mask = _mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(elements, target)));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return SearchSSE2(array, array_len, index, search_element);
+}
+
+TARGET_AVX2 intptr_t SearchAVX2(const double* array, uintptr_t array_len,
+                                uintptr_t index, double search_element) {
+  const __m256d target = _mm256_set1_pd(search_element);
+  for (; index + 4 <= array_len; index += 4) {
+    __m256d elements = _mm256_loadu_pd(array + index);
+    int mask =
+        _mm256_movemask_pd(_mm256_cmp_pd(elements, target, _CMP_EQ_OQ));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return SearchSSE2(array, array_len, index, search_element);
+}
+
+TARGET_AVX2 intptr_t SearchNaNAVX2(const double* array, uintptr_t array_len,
+                                   uintptr_t index) {
+  for (; index + 4 <= array_len; index += 4) {
+    __m256d elements = _mm256_loadu_pd(array + index);
+    int mask =
+        _mm256_movemask_pd(_mm256_cmp_pd(elements, elements, _CMP_UNORD_Q));
+    if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+  }
+  return SearchNaNSSE2(array, array_len, index);
+}
+
+#endif  // V8_ARRAY_SEARCH_AVX2
+
+template <typename T>
+intptr_t Search(const T* array, uintptr_t array_len, uintptr_t index,
+                T search_element) {
+#ifdef V8_ARRAY_SEARCH_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    return SearchAVX2(array, array_len, index, search_element);
+  }
+#endif
+  return SearchSSE2(array, array_len, index, search_element);
+}
+
+intptr_t SearchNaN(const double* array, uintptr_t array_len, uintptr_t index) {
+#ifdef V8_ARRAY_SEARCH_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    return SearchNaNAVX2(array, array_len, index);
+  }
+#endif
+  return SearchNaNSSE2(array, array_len, index);
+}
+
+#elif V8_HOST_ARCH_ARM64
+
+// NEON is part of the arm64 baseline. On a match, the matching lane is
+// found by rescanning the vector's elements.
+
+intptr_t Search(const uint32_t* array, uintptr_t array_len, uintptr_t index,
+                uint32_t search_element) {
+  const uint32x4_t target = vdupq_n_u32(search_element);
+  for (; index + 4 <= array_len; index += 4) {
+    uint32x4_t equal = vceqq_u32(vld1q_u32(array + index), target);
+    if (vmaxvq_u32(equal) != 0) {
+      return ScalarSearch(array, index + 4, index, search_element);
+    }
+  }
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t Search(const uint64_t* array, uintptr_t array_len, uintptr_t index,
+                uint64_t search_element) {
+  const uint64x2_t target = vdupq_n_u64(search_element);
+  for (; index + 2 <= array_len; index += 2) {
+    uint64x2_t equal = vceqq_u64(vld1q_u64(array + index), target);
+    if (vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0) {
+      return ScalarSearch(array, index + 2, index, search_element);
+    }
+  }
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t Search(const double* array, uintptr_t array_len, uintptr_t index,
+                double search_element) {
+  const float64x2_t target = vdupq_n_f64(search_element);
+  for (; index + 2 <= array_len; index += 2) {
+    uint64x2_t equal = vceqq_f64(vld1q_f64(array + index), target);
+    if (vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0) {
+      return ScalarSearch(array, index + 2, index, search_element);
+    }
+  }
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t SearchNaN(const double* array, uintptr_t array_len, uintptr_t index) {
+  for (; index + 2 <= array_len; index += 2) {
+    float64x2_t elements = vld1q_f64(array + index);
+    // Only NaNs compare unequal to themselves.
+    uint32x4_t not_nan =
+        vreinterpretq_u32_u64(vceqq_f64(elements, elements));
+    if (vminvq_u32(not_nan) == 0) {
+      return ScalarSearchNaN(array, index + 2, index);
+    }
+  }
+  return ScalarSearchNaN(array, array_len, index);
+}
+
+#else
+
+template <typename T>
+intptr_t Search(const T* array, uintptr_t array_len, uintptr_t index,
+                T search_element) {
+  return ScalarSearch(array, array_len, index, search_element);
+}
+
+intptr_t SearchNaN(const double* array, uintptr_t array_len, uintptr_t index) {
+  return ScalarSearchNaN(array, array_len, index);
+}
+
+#endif
+
+}  // namespace
+
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address array_start,
+                                         uintptr_t array_len,
+                                         uintptr_t from_index,
+                                         Address search_element) {
+  // Compressed tagged values of Smis are their lower half.
+  const Tagged_t search = static_cast<Tagged_t>(search_element);
+  using Word = std::conditional<kTaggedSize == kInt32Size, uint32_t,
+                                uint64_t>::type;
+  STATIC_ASSERT(sizeof(Word) == kTaggedSize);
+  return Search(reinterpret_cast<const Word*>(array_start), array_len,
+                from_index, static_cast<Word>(search));
+}
+
+intptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
+                                    uintptr_t from_index,
+                                    Address search_element) {
+  Object search(search_element);
+  const double search_num = search.IsSmi()
+                                ? Smi::ToInt(search)
+                                : HeapNumber::cast(search).value();
+  const double* array = reinterpret_cast<const double*>(array_start);
+  if (std::isnan(search_num)) {
+    return SearchNaN(array, array_len, from_index);
+  }
+  return Search(array, array_len, from_index, search_num);
+}
+
+namespace {
+
+template <typename Char>
+int ScalarSearchFirstAndLast(const Char* subject, int index, int end,
+                             Char first, Char last, int last_offset) {
+  for (; index <= end; ++index) {
+    if (subject[index] == first && subject[index + last_offset] == last) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+#if V8_HOST_ARCH_X64
+
+template <typename Char>
+inline __m128i Splat128(Char c) {
+  return sizeof(Char) == 1 ? _mm_set1_epi8(static_cast<int8_t>(c))
+                           : _mm_set1_epi16(static_cast<int16_t>(c));
+}
+
+template <typename Char>
+inline __m128i CompareEqual128(__m128i a, __m128i b) {
+  return sizeof(Char) == 1 ? _mm_cmpeq_epi8(a, b) : _mm_cmpeq_epi16(a, b);
+}
+
+// Compares a vector of candidate first characters and the corresponding
+// vector of last characters at once. The byte mask of the combined result
+// has sizeof(Char) bits set per matching candidate.
+template <typename Char>
+int SearchFirstAndLastSSE2(const Char* subject, int index, int end,
+                           Char first, Char last, int last_offset) {
+  constexpr int kLanes = sizeof(__m128i) / sizeof(Char);
+  const __m128i first_vector = Splat128(first);
+  const __m128i last_vector = Splat128(last);
+  for (; index + kLanes - 1 <= end; index += kLanes) {
+    __m128i firsts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + index));
+    __m128i lasts = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + index + last_offset));
+    int mask = _mm_movemask_epi8(
+        _mm_and_si128(CompareEqual128<Char>(firsts, first_vector),
+                      CompareEqual128<Char>(lasts, last_vector)));
+    if (mask != 0) {
+      return index + static_cast<int>(base::bits::CountTrailingZeros32(mask) /
+                                      sizeof(Char));
+    }
+  }
+  return ScalarSearchFirstAndLast(subject, index, end, first, last,
+                                  last_offset);
+}
+
+#ifdef V8_ARRAY_SEARCH_AVX2
+
+template <typename Char>
+TARGET_AVX2 inline __m256i Splat256(Char c) {
+  return sizeof(Char) == 1 ? _mm256_set1_epi8(static_cast<int8_t>(c))
+                           : _mm256_set1_epi16(static_cast<int16_t>(c));
+}
+
+template <typename Char>
+TARGET_AVX2 inline __m256i CompareEqual256(__m256i a, __m256i b) {
+  return sizeof(Char) == 1 ? _mm256_cmpeq_epi8(a, b)
+                           : _mm256_cmpeq_epi16(a, b);
+}
+
+template <typename Char>
+TARGET_AVX2 int SearchFirstAndLastAVX2(const Char* subject, int index,
+                                       int end, Char first, Char last,
+                                       int last_offset) {
+  constexpr int kLanes = sizeof(__m256i) / sizeof(Char);
+  const __m256i first_vector = Splat256(first);
+  const __m256i last_vector = Splat256(last);
+  for (; index + kLanes - 1 <= end; index += kLanes) {
+    __m256i firsts =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(subject + index));
+    __m256i lasts = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(subject + index + last_offset));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_and_si256(CompareEqual256<Char>(firsts, first_vector),
+                         CompareEqual256<Char>(lasts, last_vector))));
+    if (mask != 0) {
+      return index + static_cast<int>(base::bits::CountTrailingZeros32(mask) /
+                                      sizeof(Char));
+    }
+  }
+  return SearchFirstAndLastSSE2(subject, index, end, first, last,
+                                last_offset);
+}
+
+#endif  // V8_ARRAY_SEARCH_AVX2
+
+template <typename Char>
+int SearchFirstAndLast(const Char* subject, int index, int end, Char first,
+                       Char last, int last_offset) {
+#ifdef V8_ARRAY_SEARCH_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    return SearchFirstAndLastAVX2(subject, index, end, first, last,
+                                  last_offset);
+  }
+#endif
+  return SearchFirstAndLastSSE2(subject, index, end, first, last,
+                                last_offset);
+}
+
+#elif V8_HOST_ARCH_ARM64
+
+int SearchFirstAndLast(const uint8_t* subject, int index, int end,
+                       uint8_t first, uint8_t last, int last_offset) {
+  const uint8x16_t first_vector = vdupq_n_u8(first);
+  const uint8x16_t last_vector = vdupq_n_u8(last);
+  for (; index + 15 <= end; index += 16) {
+    uint8x16_t matches =
+        vandq_u8(vceqq_u8(vld1q_u8(subject + index), first_vector),
+                 vceqq_u8(vld1q_u8(subject + index + last_offset),
+                          last_vector));
+    if (vmaxvq_u8(matches) != 0) break;
+  }
+  // The scalar search finds the match within the current vector, if any.
+  return ScalarSearchFirstAndLast(subject, index, end, first, last,
+                                  last_offset);
+}
+
+int SearchFirstAndLast(const uc16* subject, int index, int end, uc16 first,
+                       uc16 last, int last_offset) {
+  const uint16x8_t first_vector = vdupq_n_u16(first);
+  const uint16x8_t last_vector = vdupq_n_u16(last);
+  for (; index + 7 <= end; index += 8) {
+    uint16x8_t matches =
+        vandq_u16(vceqq_u16(vld1q_u16(subject + index), first_vector),
+                  vceqq_u16(vld1q_u16(subject + index + last_offset),
+                            last_vector));
+    if (vmaxvq_u16(matches) != 0) break;
+  }
+  return ScalarSearchFirstAndLast(subject, index, end, first, last,
+                                  last_offset);
+}
+
+#else
+
+template <typename Char>
+int SearchFirstAndLast(const Char* subject, int index, int end, Char first,
+                       Char last, int last_offset) {
+  return ScalarSearchFirstAndLast(subject, index, end, first, last,
+                                  last_offset);
+}
+
+#endif
+
+}  // namespace
+
+int SearchFirstAndLastCharacter(const uint8_t* subject, int start_index,
+                                int end_index, uint8_t first, uint8_t last,
+                                int last_offset) {
+  return SearchFirstAndLast(subject, start_index, end_index, first, last,
+                            last_offset);
+}
+
+int SearchFirstAndLastCharacter(const uc16* subject, int start_index,
+                                int end_index, uc16 first, uc16 last,
+                                int last_offset) {
+  return SearchFirstAndLast(subject, start_index, end_index, first, last,
+                            last_offset);
+}
+
+#undef TARGET_AVX2
+#undef V8_ARRAY_SEARCH_AVX2
+
+}  // namespace internal
+}  // namespace v8
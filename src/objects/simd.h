@@ -0,0 +1,59 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_SIMD_H_
+#define V8_OBJECTS_SIMD_H_
+
+#include <cstdint>
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized searches for Array.prototype.indexOf and
+// Array.prototype.includes, called from the CSA builtins. Both return the
+// index of the first matching element in [from_index, array_len), or -1 if
+// there is none.
+
+// Compares the tagged elements starting at {array_start} to
+// {search_element} by identity. This is only a valid implementation of
+// indexOf/includes where identity implies equality, e.g. when searching for
+// a Smi in an array with Smi elements.
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address array_start,
+                                         uintptr_t array_len,
+                                         uintptr_t from_index,
+                                         Address search_element);
+
+// Compares the unboxed double elements starting at {array_start} to the
+// number {search_element}, which must be a Smi or a HeapNumber. A NaN
+// {search_element} matches NaN elements, as required by includes; callers
+// implementing indexOf have to handle NaN themselves.
+intptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
+                                    uintptr_t from_index,
+                                    Address search_element);
+
+// Vectorized candidate search for StringSearch. Returns the smallest index i
+// in [start_index, end_index] with subject[i] == first and
+// subject[i + last_offset] == last, or -1 if there is none. The subject must
+// be readable up to end_index + last_offset.
+int SearchFirstAndLastCharacter(const uint8_t* subject, int start_index,
+                                int end_index, uint8_t first, uint8_t last,
+                                int last_offset);
+int SearchFirstAndLastCharacter(const uc16* subject, int start_index,
+                                int end_index, uc16 first, uc16 last,
+                                int last_offset);
+
+// Whether SearchFirstAndLastCharacter is faster than a scalar loop on this
+// architecture.
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
+constexpr bool kHasVectorizedStringSearch = true;
+#else
+constexpr bool kHasVectorizedStringSearch = false;
+#endif
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_SIMD_H_
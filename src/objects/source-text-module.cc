@@ -72,10 +72,31 @@ class Module::ResolveSet
 
   Zone* zone() const { return zone_; }
 
+  // Prepares for resolving another name, keeping the allocated name sets.
+  void Reset() {
+    for (auto& entry : *this) entry.second->clear();
+  }
+
  private:
   Zone* zone_;
 };
 
+namespace {
+
+bool HasStarExports(Isolate* isolate, SourceTextModuleInfo info) {
+  FixedArray special_exports = info.special_exports();
+  for (int i = 0, n = special_exports.length(); i < n; ++i) {
+    if (SourceTextModuleInfoEntry::cast(special_exports.get(i))
+            .export_name()
+            .IsUndefined(isolate)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 SharedFunctionInfo SourceTextModule::GetSharedFunctionInfo() const {
   DisallowHeapAllocation no_alloc;
   switch (status()) {
@@ -176,6 +197,13 @@ MaybeHandle<Cell> SourceTextModule::ResolveExport(
     // Already resolved (e.g. because it's a local export).
     return Handle<Cell>::cast(object);
   }
+  if (object->IsTheHole(isolate) && !HasStarExports(isolate, module->info())) {
+    // Unresolvable without recursing, so there is no cycle to check for. This
+    // is the common case for leaf modules reached through star exports.
+    return SourceTextModule::ResolveExportUsingStarExports(
+        isolate, module, module_specifier, export_name, loc, must_resolve,
+        resolve_set);
+  }
 
   // Check for cycle before recursing.
   {
@@ -462,14 +490,16 @@ bool SourceTextModule::FinishInstantiate(
   Handle<Script> script(module->script(), isolate);
   Handle<SourceTextModuleInfo> module_info(module->info(), isolate);
 
-  // Resolve imports.
+  // Resolve imports. Each resolution starts with an empty resolve set, but the
+  // set's storage is shared.
+  ResolveSet resolve_set(zone);
   Handle<FixedArray> regular_imports(module_info->regular_imports(), isolate);
   for (int i = 0, n = regular_imports->length(); i < n; ++i) {
     Handle<SourceTextModuleInfoEntry> entry(
         SourceTextModuleInfoEntry::cast(regular_imports->get(i)), isolate);
     Handle<String> name(String::cast(entry->import_name()), isolate);
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(zone);
+    resolve_set.Reset();
     Handle<Cell> cell;
     if (!ResolveImport(isolate, module, name, entry->module_request(), loc,
                        true, &resolve_set)
@@ -487,7 +517,7 @@ bool SourceTextModule::FinishInstantiate(
     Handle<Object> name(entry->export_name(), isolate);
     if (name->IsUndefined(isolate)) continue;  // Star export.
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(zone);
+    resolve_set.Reset();
     if (ResolveExport(isolate, module, Handle<String>(),
                       Handle<String>::cast(name), loc, true, &resolve_set)
             .is_null()) {
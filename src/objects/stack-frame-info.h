@@ -94,13 +94,12 @@ class StackTraceFrame
   TQ_OBJECT_CONSTRUCTORS(StackTraceFrame)
 };
 
-// Small helper that retrieves the FrameArray from a stack-trace
-// consisting of a FixedArray of StackTraceFrame objects.
-// This helper is only temporary until all FrameArray use-sites have
-// been converted to use StackTraceFrame and StackFrameInfo objects.
+// Small helper that wraps each frame of a FrameArray in a StackTraceFrame.
+// Error stack traces are kept as raw FrameArrays and only converted when
+// they are formatted.
 V8_EXPORT_PRIVATE
-Handle<FrameArray> GetFrameArrayFromStackTrace(Isolate* isolate,
-                                               Handle<FixedArray> stack_trace);
+Handle<FixedArray> GetStackTraceFramesFromFrameArray(
+    Isolate* isolate, Handle<FrameArray> frame_array);
 
 class IncrementalStringBuilder;
 void SerializeStackTraceFrame(Isolate* isolate, Handle<StackTraceFrame> frame,
@@ -18,7 +18,7 @@ namespace internal {
 template <typename Char>
 static inline bool CompareRawStringContents(const Char* const a,
                                             const Char* const b, int length) {
-  return CompareChars(a, b, length) == 0;
+  return CompareCharsEqual(a, b, length);
 }
 
 template <typename Chars1, typename Chars2>
@@ -285,10 +285,10 @@ class SequentialStringKey final : public StringTableKey {
     DisallowHeapAllocation no_gc;
     if (s.IsOneByteRepresentation()) {
       const uint8_t* chars = s.GetChars<uint8_t>(no_gc);
-      return CompareChars(chars, chars_.begin(), chars_.length()) == 0;
+      return CompareCharsEqual(chars, chars_.begin(), chars_.length());
     }
     const uint16_t* chars = s.GetChars<uint16_t>(no_gc);
-    return CompareChars(chars, chars_.begin(), chars_.length()) == 0;
+    return CompareCharsEqual(chars, chars_.begin(), chars_.length());
   }
 
   Handle<String> AsHandle(Isolate* isolate) {
@@ -354,11 +354,11 @@ class SeqSubStringKey final : public StringTableKey {
     DisallowHeapAllocation no_gc;
     if (string.IsOneByteRepresentation()) {
       const uint8_t* data = string.GetChars<uint8_t>(no_gc);
-      return CompareChars(string_->GetChars(no_gc) + from_, data, length()) ==
-             0;
+      return CompareCharsEqual(string_->GetChars(no_gc) + from_, data,
+                               length());
     }
     const uint16_t* data = string.GetChars<uint16_t>(no_gc);
-    return CompareChars(string_->GetChars(no_gc) + from_, data, length()) == 0;
+    return CompareCharsEqual(string_->GetChars(no_gc) + from_, data, length());
   }
 
   template <typename LocalIsolate>
@@ -106,6 +106,33 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
+  // Atomically replaces the empty element at {index} with {entry}. Fails if
+  // another thread has written to that entry in the meantime.
+  bool TrySetEmpty(InternalIndex index, String entry) {
+    Tagged_t empty = static_cast<Tagged_t>(empty_element().ptr());
+    Tagged_t old_value = AsAtomicTagged::Release_CompareAndSwap(
+        &elements_[index.as_uint32()], empty,
+        static_cast<Tagged_t>(entry.ptr()));
+    return old_value == empty;
+  }
+
+  // Reserves room for one more element while other threads may be doing the
+  // same. Fails if the table first has to be resized.
+  bool TryReserveElement() {
+    int nof = number_of_elements_.load(std::memory_order_relaxed);
+    do {
+      if (!StringTableHasSufficientCapacityToAdd(
+              capacity(), nof, number_of_deleted_elements(), 1)) {
+        return false;
+      }
+    } while (!number_of_elements_.compare_exchange_weak(
+        nof, nof + 1, std::memory_order_relaxed));
+    return true;
+  }
+  void CancelReservation() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
   void ElementAdded() {
     DCHECK_LT(number_of_elements_ + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
@@ -132,7 +159,9 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
   int number_of_deleted_elements() const { return number_of_deleted_elements_; }
 
   template <typename StringTableKey>
@@ -146,6 +175,13 @@ class StringTable::Data {
                                           StringTableKey* key,
                                           uint32_t hash) const;
 
+  // Returns the entry matching {key}, or inserts {new_string} into the first
+  // empty entry on its probe sequence. Requires a prior TryReserveElement.
+  template <typename StringTableKey>
+  String FindEntryOrInsertConcurrently(IsolateRoot isolate,
+                                       StringTableKey* key, uint32_t hash,
+                                       String new_string);
+
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
@@ -175,7 +211,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
+  // Atomic so that concurrent inserters can reserve room for their elements.
+  std::atomic<int> number_of_elements_;
   int number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
@@ -241,7 +278,8 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
     InternalIndex insertion_index = new_data->FindInsertionEntry(isolate, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -311,6 +349,34 @@ InternalIndex StringTable::Data::FindEntryOrInsertionEntry(
   }
 }
 
+template <typename StringTableKey>
+String StringTable::Data::FindEntryOrInsertConcurrently(IsolateRoot isolate,
+                                                        StringTableKey* key,
+                                                        uint32_t hash,
+                                                        String new_string) {
+  uint32_t count = 1;
+  // The reservation guarantees that the probe sequence reaches an empty entry.
+  DCHECK_LE(number_of_elements(), capacity_);
+  for (InternalIndex entry = FirstProbe(hash, capacity_);;
+       entry = NextProbe(entry, count++, capacity_)) {
+    Object element = Get(isolate, entry);
+    if (element == empty_element()) {
+      if (TrySetEmpty(entry, new_string)) return new_string;
+      // Another thread won the race for this entry. It may have inserted the
+      // same string, so check the entry again.
+      element = Get(isolate, entry);
+      DCHECK(element != empty_element());
+    }
+    // Deleted entries are only reused with exclusive access to the table.
+    if (element == deleted_element()) continue;
+    String string = String::cast(element);
+    if (KeyIsMatch(key, string)) {
+      CancelReservation();
+      return string;
+    }
+  }
+}
+
 void StringTable::Data::IterateElements(RootVisitor* visitor) {
   OffHeapObjectSlot first_slot = slot(InternalIndex(0));
   OffHeapObjectSlot end_slot = slot(InternalIndex(capacity_));
@@ -341,7 +407,7 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->number_of_elements();
   }
 }
@@ -454,6 +520,12 @@ Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
   // and on a miss we take the lock and try to write the entry, with a second
   // read lookup in case the non-locked read missed a write.
   //
+  // Writes that only fill an empty entry don't exclude each other: they take
+  // the lock shared and compare-and-swap the string into the entry, so that
+  // concurrent inserters racing for the same entry see each other's strings.
+  // The lock is only taken exclusively to resize the table or to reuse deleted
+  // entries, which happens when a shared write fails to reserve room.
+  //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
   // re-allocation of the string table on resize. So, we optimistically allocate
@@ -486,7 +558,21 @@ Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
     if (new_string.is_null()) new_string = key->AsHandle(isolate);
 
     {
-      base::MutexGuard table_write_guard(&write_mutex_);
+      base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+
+      // The table can't be resized while the lock is held, so the load can
+      // be relaxed.
+      Data* data = data_.load(std::memory_order_relaxed);
+      if (data->TryReserveElement()) {
+        return handle(data->FindEntryOrInsertConcurrently(
+                          isolate, key, key->hash(), *new_string),
+                      isolate);
+      }
+    }
+
+    {
+      base::SharedMutexGuard<base::kExclusive> table_write_guard(
+          &write_mutex_);
 
       Data* data = EnsureCapacity(isolate, 1);
 
@@ -539,8 +625,7 @@ template Handle<String> StringTable::LookupKey(Isolate* isolate,
 
 StringTable::Data* StringTable::EnsureCapacity(IsolateRoot isolate,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
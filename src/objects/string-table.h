@@ -93,8 +93,9 @@ class V8_EXPORT_PRIVATE StringTable {
 
   std::atomic<Data*> data_;
   // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // NumberOfElements) are allowed to lock it while staying const. Writes that
+  // only fill empty entries hold it shared, resizes hold it exclusively.
+  mutable base::SharedMutex write_mutex_;
 #ifdef DEBUG
   Isolate* isolate_;
 #endif
@@ -1314,10 +1314,10 @@ bool String::HasOneBytePrefix(Vector<const char> str) {
   DisallowHeapAllocation no_gc;
   FlatContent content = GetFlatContent(no_gc);
   if (content.IsOneByte()) {
-    return CompareChars(content.ToOneByteVector().begin(), str.begin(), slen) ==
-           0;
+    return CompareCharsEqual(content.ToOneByteVector().begin(), str.begin(),
+                             slen);
   }
-  return CompareChars(content.ToUC16Vector().begin(), str.begin(), slen) == 0;
+  return CompareCharsEqual(content.ToUC16Vector().begin(), str.begin(), slen);
 }
 
 bool String::IsOneByteEqualTo(Vector<const uint8_t> str) {
@@ -1326,10 +1326,10 @@ bool String::IsOneByteEqualTo(Vector<const uint8_t> str) {
   DisallowHeapAllocation no_gc;
   FlatContent content = GetFlatContent(no_gc);
   if (content.IsOneByte()) {
-    return CompareChars(content.ToOneByteVector().begin(), str.begin(), slen) ==
-           0;
+    return CompareCharsEqual(content.ToOneByteVector().begin(), str.begin(),
+                             slen);
   }
-  return CompareChars(content.ToUC16Vector().begin(), str.begin(), slen) == 0;
+  return CompareCharsEqual(content.ToUC16Vector().begin(), str.begin(), slen);
 }
 
 bool String::IsTwoByteEqualTo(Vector<const uc16> str) {
@@ -1338,10 +1338,10 @@ bool String::IsTwoByteEqualTo(Vector<const uc16> str) {
   DisallowHeapAllocation no_gc;
   FlatContent content = GetFlatContent(no_gc);
   if (content.IsOneByte()) {
-    return CompareChars(content.ToOneByteVector().begin(), str.begin(), slen) ==
-           0;
+    return CompareCharsEqual(content.ToOneByteVector().begin(), str.begin(),
+                             slen);
   }
-  return CompareChars(content.ToUC16Vector().begin(), str.begin(), slen) == 0;
+  return CompareCharsEqual(content.ToUC16Vector().begin(), str.begin(), slen);
 }
 
 namespace {
@@ -1351,7 +1351,23 @@ uint32_t HashString(String string, size_t start, int length, uint64_t seed) {
   DisallowHeapAllocation no_gc;
 
   if (length > String::kMaxHashCalcLength) {
-    return StringHasher::GetTrivialHash(length);
+    const int kSample = StringHasher::kLongStringSampleLength;
+    int middle = StringHasher::LongStringMiddleSampleStart(length);
+    if (string.IsConsString()) {
+      // Only the samples are needed, so avoid flattening the whole string.
+      DCHECK_EQ(0, start);
+      DCHECK(!string.IsFlat());
+      Char samples[3 * kSample];
+      String::WriteToFlat(string, samples, 0, kSample);
+      String::WriteToFlat(string, samples + kSample, middle, middle + kSample);
+      String::WriteToFlat(string, samples + 2 * kSample, length - kSample,
+                          length);
+      return StringHasher::HashLongString<Char>(
+          samples, samples + kSample, samples + 2 * kSample, length, seed);
+    }
+    const Char* chars = string.GetChars<Char>(no_gc) + start;
+    return StringHasher::HashLongString<Char>(
+        chars, chars + middle, chars + length - kSample, length, seed);
   }
 
   std::unique_ptr<Char[]> buffer;
@@ -710,6 +710,10 @@ class SlicedString : public TorqueGeneratedSlicedString<SlicedString, String> {
   // Minimum length for a sliced string.
   static const int kMinLength = 13;
 
+  // Minimum length of a concatenation result that turns its left hand side
+  // into a string builder, see Runtime_StringAdd.
+  static const int kBuilderMinLength = 4096;
+
   class BodyDescriptor;
 
   DECL_VERIFIER(SlicedString)
@@ -0,0 +1,211 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Building blocks for hash tables that follow the SwissTable design: each slot
+// has a one byte control entry, holding either a special marker or 7 bits of
+// the hash of the key in the slot. Lookups first compare a whole group of
+// control bytes against the hash (16 at a time with SSE2, 8 at a time in the
+// portable version) and only look at the keys of the matching slots.
+
+#ifndef V8_OBJECTS_SWISS_HASH_TABLE_HELPERS_H_
+#define V8_OBJECTS_SWISS_HASH_TABLE_HELPERS_H_
+
+#include <cstdint>
+#include <type_traits>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/memory.h"
+
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && \
+     (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))
+#define V8_SWISS_TABLE_HAVE_SSE2_HOST 1
+#include <emmintrin.h>
+#else
+#define V8_SWISS_TABLE_HAVE_SSE2_HOST 0
+#endif
+
+namespace v8 {
+namespace internal {
+namespace swiss_table {
+
+// Control bytes. Full slots store the H2 part of the hash of their key, i.e. a
+// value in [0, 127]. All special values have the most significant bit set.
+using ctrl_t = int8_t;
+using h2_t = uint8_t;
+
+enum Ctrl : ctrl_t {
+  kEmpty = -128,   // 0b10000000
+  kDeleted = -2,   // 0b11111110
+  kSentinel = -1,  // 0b11111111
+};
+static_assert(kEmpty & kDeleted & kSentinel & 0x80,
+              "Special markers need to have the MSB to make checking for "
+              "them efficient");
+static_assert(kEmpty < kSentinel && kDeleted < kSentinel,
+              "kEmpty and kDeleted must be smaller than kSentinel to make "
+              "MatchEmptyOrDeleted efficient");
+
+inline bool IsEmpty(ctrl_t c) { return c == kEmpty; }
+inline bool IsFull(ctrl_t c) { return c >= 0; }
+inline bool IsDeleted(ctrl_t c) { return c == kDeleted; }
+inline bool IsEmptyOrDeleted(ctrl_t c) { return c < kSentinel; }
+
+// The hash is split into H1, which selects the group to start probing at, and
+// H2, which is stored in the control byte of a full slot.
+constexpr int kH2Bits = 7;
+inline uint32_t H1(uint32_t hash) { return hash >> kH2Bits; }
+inline h2_t H2(uint32_t hash) { return hash & ((1 << kH2Bits) - 1); }
+
+// An abstraction over a bitmask. It provides an easy way to iterate over the
+// indices of the set bits. {Shift} is the log-size of the bits used per index,
+// which is 0 for the SSE2 version and 3 for the portable version.
+template <class T, int SignificantBits, int Shift = 0>
+class BitMask {
+  static_assert(std::is_unsigned<T>::value, "");
+  static_assert(Shift == 0 || Shift == 3, "");
+
+ public:
+  explicit BitMask(T mask) : mask_(mask) {}
+
+  BitMask& operator++() {
+    // Clear the least significant bit that is set.
+    mask_ &= (mask_ - 1);
+    return *this;
+  }
+  explicit operator bool() const { return mask_ != 0; }
+  int operator*() const { return LowestBitSet(); }
+
+  int LowestBitSet() const {
+    DCHECK_NE(mask_, 0);
+    return base::bits::CountTrailingZeros(mask_) >> Shift;
+  }
+
+  BitMask begin() const { return *this; }
+  BitMask end() const { return BitMask(0); }
+
+ private:
+  friend bool operator==(const BitMask& a, const BitMask& b) {
+    return a.mask_ == b.mask_;
+  }
+  friend bool operator!=(const BitMask& a, const BitMask& b) {
+    return a.mask_ != b.mask_;
+  }
+
+  T mask_;
+};
+
+#if V8_SWISS_TABLE_HAVE_SSE2_HOST
+struct GroupSse2Impl {
+  static constexpr int kWidth = 16;
+
+  explicit GroupSse2Impl(const ctrl_t* pos) {
+    ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+  }
+
+  // Returns a bitmask representing the positions of slots that match {hash}.
+  BitMask<uint32_t, kWidth> Match(h2_t hash) const {
+    auto match = _mm_set1_epi8(hash);
+    return BitMask<uint32_t, kWidth>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(match, ctrl)));
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint32_t, kWidth> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  // Returns a bitmask representing the positions of empty or deleted slots.
+  BitMask<uint32_t, kWidth> MatchEmptyOrDeleted() const {
+    auto special = _mm_set1_epi8(kSentinel);
+    return BitMask<uint32_t, kWidth>(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(special, ctrl)));
+  }
+
+  __m128i ctrl;
+};
+#endif  // V8_SWISS_TABLE_HAVE_SSE2_HOST
+
+// Processes 8 control bytes at a time using bit tricks on a 64-bit word.
+struct GroupPortableImpl {
+  static constexpr int kWidth = 8;
+
+  explicit GroupPortableImpl(const ctrl_t* pos)
+      : ctrl(base::ReadLittleEndianValue<uint64_t>(
+            reinterpret_cast<base::Address>(pos))) {}
+
+  // Returns a bitmask representing the positions of slots that match {hash}.
+  // This may report false positives: a slot that holds {hash} ^ 1 directly
+  // after a real match is reported as well. That is fine since callers
+  // compare the keys of all matching slots anyway, and it never reports false
+  // negatives. For the technique, see
+  // http://graphics.stanford.edu/~seander/bithacks.html#ValueInWord
+  BitMask<uint64_t, kWidth, 3> Match(h2_t hash) const {
+    constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+    constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+    auto x = ctrl ^ (kLsbs * hash);
+    return BitMask<uint64_t, kWidth, 3>((x - kLsbs) & ~x & kMsbs);
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmpty() const {
+    constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+    return BitMask<uint64_t, kWidth, 3>((ctrl & (~ctrl << 6)) & kMsbs);
+  }
+
+  // Returns a bitmask representing the positions of empty or deleted slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmptyOrDeleted() const {
+    constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+    return BitMask<uint64_t, kWidth, 3>((ctrl & (~ctrl << 7)) & kMsbs);
+  }
+
+  uint64_t ctrl;
+};
+
+#if V8_SWISS_TABLE_HAVE_SSE2_HOST
+using Group = GroupSse2Impl;
+#else
+using Group = GroupPortableImpl;
+#endif
+
+// Triangular probing over groups of {GroupSize} slots. The probe sequence
+// starts at H1(hash) and visits every group exactly once if the capacity is a
+// power of two and a multiple of {GroupSize}. The i-th probe starts at
+//
+//   (H1(hash) + GroupSize * (i + i^2) / 2) & mask
+template <int GroupSize>
+class ProbeSequence {
+ public:
+  ProbeSequence(uint32_t hash, uint32_t mask) {
+    DCHECK(base::bits::IsPowerOfTwo(mask + 1));
+    mask_ = mask;
+    offset_ = H1(hash) & mask_;
+  }
+
+  // Offset of the first slot of the current group.
+  uint32_t offset() const { return offset_; }
+  // Offset of the {i}-th slot of the current group.
+  uint32_t offset(int i) const { return (offset_ + i) & mask_; }
+
+  void next() {
+    index_ += GroupSize;
+    offset_ += index_;
+    offset_ &= mask_;
+  }
+
+  // Number of slots probed before the current group.
+  uint32_t index() const { return index_; }
+
+ private:
+  uint32_t mask_;
+  uint32_t offset_;
+  uint32_t index_ = 0;
+};
+
+}  // namespace swiss_table
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_SWISS_HASH_TABLE_HELPERS_H_
@@ -40,6 +40,7 @@ namespace internal {
 // Version 12: regexp and string objects share normal string encoding
 // Version 13: host objects have an explicit tag (rather than handling all
 //             unknown tags)
+// Version 14: plain objects can reference a shared list of property names
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -48,7 +49,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 13;
+static const uint32_t kLatestVersion = 14;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -98,6 +99,11 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object whose properties are named by a shape. shapeID:uint32_t, for
+  // the first use of a shape followed by numProperties:uint32_t and the
+  // property names as strings. Then one value per property name, or kTheHole
+  // where the object no longer has the property.
+  kShapedJSObject = 'h',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -236,7 +242,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+                                 ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -574,6 +581,22 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   return Nothing<bool>();
 }
 
+// Objects that only have enumerable data fields with string names are written
+// with a shape, so that the property names of all objects with the same map
+// are written only once.
+static bool CanWriteWithShape(Map map) {
+  if (map.NumberOfOwnDescriptors() == 0) return false;
+  DescriptorArray descriptors = map.instance_descriptors(kRelaxedLoad);
+  for (InternalIndex i : map.IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (!descriptors.GetKey(i).IsString() || details.IsDontEnum() ||
+        details.location() != kField || details.kind() != kData) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   DCHECK(!object->map().IsCustomElementsReceiverMap());
   const bool can_serialize_fast =
@@ -581,6 +604,7 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   Handle<Map> map(object->map(), isolate_);
+  if (CanWriteWithShape(*map)) return WriteShapedJSObject(object);
   WriteTag(SerializationTag::kBeginJSObject);
 
   // Write out fast properties as long as they are only data properties and the
@@ -623,6 +647,51 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteShapedJSObject(Handle<JSObject> object) {
+  Handle<Map> map(object->map(), isolate_);
+  WriteTag(SerializationTag::kShapedJSObject);
+  auto find_result = shape_map_.FindOrInsert(map);
+  if (find_result.already_exists) {
+    WriteVarint(*find_result.entry);
+  } else {
+    uint32_t shape_id = next_shape_id_++;
+    *find_result.entry = shape_id;
+    WriteVarint(shape_id);
+    WriteVarint<uint32_t>(map->NumberOfOwnDescriptors());
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      WriteString(handle(
+          String::cast(map->instance_descriptors(kRelaxedLoad).GetKey(i)),
+          isolate_));
+    }
+  }
+
+  // Like WriteJSObject, read the fields directly as long as the map doesn't
+  // change while the values are serialized.
+  bool map_changed = false;
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    Handle<Object> value;
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
+    if (V8_LIKELY(!map_changed)) {
+      PropertyDetails details =
+          map->instance_descriptors(kRelaxedLoad).GetDetails(i);
+      FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+      value = JSObject::FastPropertyAt(object, details.representation(),
+                                       field_index);
+    } else {
+      Handle<Name> key(map->instance_descriptors(kRelaxedLoad).GetKey(i),
+                       isolate_);
+      LookupIterator it(isolate_, object, key, LookupIterator::OWN);
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
+      if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
+    }
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -871,6 +940,20 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     ThrowDataCloneError(MessageTemplate::kDataCloneErrorDetachedArrayBuffer);
     return Nothing<bool>();
   }
+  if (delegate_ && array_buffer->is_detachable()) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    uint32_t transfer_id;
+    Maybe<bool> transferred = delegate_->GetArrayBufferTransferId(
+        v8_isolate, Utils::ToLocal(array_buffer), &transfer_id);
+    RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+    if (transferred.FromJust()) {
+      // The contents are passed along with the serialized data, only the ID
+      // is written like for buffers marked with TransferArrayBuffer.
+      WriteTag(SerializationTag::kArrayBufferTransfer);
+      WriteVarint(transfer_id);
+      return ThrowIfOutOfMemory();
+    }
+  }
   double byte_length = array_buffer->byte_length();
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
@@ -1078,10 +1161,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.begin() + data.length()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(shapes_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1292,6 +1378,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kShapedJSObject:
+      return ReadShapedJSObject();
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1382,6 +1470,9 @@ MaybeHandle<String> ValueDeserializer::ReadOneByteString() {
       !ReadRawBytes(byte_length).To(&bytes)) {
     return MaybeHandle<String>();
   }
+  if (byte_length <= kMaxInternalizedStringLength) {
+    return isolate_->factory()->InternalizeString(bytes);
+  }
   return isolate_->factory()->NewStringFromOneByte(bytes);
 }
 
@@ -2130,6 +2221,166 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<FixedArray> shape;
+  if (!ReadShape().ToHandle(&shape)) return MaybeHandle<JSObject>();
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  // Missing properties are left as empty handles.
+  int num_properties = shape->length() - kShapeFirstKeyIndex;
+  std::vector<Handle<Object>> values(num_properties);
+  bool has_holes = false;
+  for (int i = 0; i < num_properties; i++) {
+    SerializationTag tag;
+    if (!PeekTag().To(&tag)) return MaybeHandle<JSObject>();
+    if (tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      has_holes = true;
+      continue;
+    }
+    if (!ReadObject().ToHandle(&values[i])) return MaybeHandle<JSObject>();
+  }
+
+  // Objects with the same shape usually end up with the same map, so use the
+  // map of the previous object with this shape if the values fit it.
+  if (!has_holes && shape->get(kShapeMapIndex).IsMap()) {
+    Handle<Map> cached_map(Map::cast(shape->get(kShapeMapIndex)), isolate_);
+    if (ValuesFitMap(cached_map, values)) {
+      CommitProperties(object, cached_map, values);
+      return scope.CloseAndEscape(object);
+    }
+  }
+
+  if (!SetShapedProperties(object, shape, values)) {
+    return MaybeHandle<JSObject>();
+  }
+  Map map = object->map();
+  if (!has_holes && !map.is_dictionary_map() &&
+      map.NumberOfOwnDescriptors() == num_properties) {
+    shape->set(kShapeMapIndex, map);
+  }
+  return scope.CloseAndEscape(object);
+}
+
+MaybeHandle<FixedArray> ValueDeserializer::ReadShape() {
+  uint32_t shape_id;
+  if (!ReadVarint<uint32_t>().To(&shape_id)) return MaybeHandle<FixedArray>();
+  if (shape_id < num_shapes_) {
+    return handle(FixedArray::cast(shapes_->get(shape_id)), isolate_);
+  }
+  // Shapes are numbered in the order of their first use.
+  uint32_t num_keys;
+  if (shape_id != num_shapes_ || !ReadVarint<uint32_t>().To(&num_keys) ||
+      num_keys > static_cast<size_t>(end_ - position_) ||
+      num_keys > kMaxNumberOfDescriptors) {
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> shape = isolate_->factory()->NewFixedArray(
+      kShapeFirstKeyIndex + static_cast<int>(num_keys));
+  for (int i = 0; i < static_cast<int>(num_keys); i++) {
+    Handle<String> key;
+    if (!ReadString().ToHandle(&key)) return MaybeHandle<FixedArray>();
+    shape->set(kShapeFirstKeyIndex + i,
+               *isolate_->factory()->InternalizeString(key));
+  }
+  Handle<FixedArray> new_shapes =
+      FixedArray::SetAndGrow(isolate_, shapes_, shape_id, shape);
+  if (!new_shapes.is_identical_to(shapes_)) {
+    GlobalHandles::Destroy(shapes_.location());
+    shapes_ = isolate_->global_handles()->Create(*new_shapes);
+  }
+  num_shapes_++;
+  return shape;
+}
+
+bool ValueDeserializer::ValuesFitMap(
+    Handle<Map> map, const std::vector<Handle<Object>>& values) {
+  if (map->is_deprecated()) return false;
+  DCHECK_EQ(map->NumberOfOwnDescriptors(), values.size());
+  DescriptorArray descriptors = map->instance_descriptors(kRelaxedLoad);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors.GetDetails(i);
+    Handle<Object> value = values[i.raw_value()];
+    if (details.location() != kField ||
+        !value->FitsRepresentation(details.representation()) ||
+        (details.representation().IsHeapObject() &&
+         !descriptors.GetFieldType(i).NowContains(value))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ValueDeserializer::SetShapedProperties(
+    Handle<JSObject> object, Handle<FixedArray> shape,
+    const std::vector<Handle<Object>>& values) {
+  // Follow map transitions like ReadJSObjectProperties, but with the keys
+  // taken from the shape.
+  bool transitioning = true;
+  Handle<Map> map(object->map(), isolate_);
+  std::vector<Handle<Object>> properties;
+  properties.reserve(values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    Handle<Object> value = values[i];
+    if (value.is_null()) continue;
+    Handle<String> key(String::cast(shape->get(
+                           kShapeFirstKeyIndex + static_cast<int>(i))),
+                       isolate_);
+    if (transitioning) {
+      Handle<Map> target;
+      TransitionsAccessor transitions(isolate_, map);
+      Handle<String> expected_key = transitions.ExpectedTransitionKey();
+      if (!expected_key.is_null() && *expected_key == *key) {
+        target = transitions.ExpectedTransitionTarget();
+      } else {
+        transitioning = TransitionsAccessor(isolate_, map)
+                            .FindTransitionToField(key)
+                            .ToHandle(&target);
+      }
+      if (transitioning) {
+        InternalIndex descriptor(properties.size());
+        PropertyDetails details =
+            target->instance_descriptors(kRelaxedLoad).GetDetails(descriptor);
+        Representation expected_representation = details.representation();
+        if (value->FitsRepresentation(expected_representation)) {
+          if (expected_representation.IsHeapObject() &&
+              !target->instance_descriptors(kRelaxedLoad)
+                   .GetFieldType(descriptor)
+                   .NowContains(value)) {
+            Handle<FieldType> value_type =
+                value->OptimalType(isolate_, expected_representation);
+            Map::GeneralizeField(isolate_, target, descriptor,
+                                 details.constness(), expected_representation,
+                                 value_type);
+          }
+          properties.push_back(value);
+          map = target;
+          continue;
+        }
+        transitioning = false;
+      }
+      CommitProperties(object, map, properties);
+    }
+
+    LookupIterator::Key lookup_key(isolate_, key);
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, value, NONE)
+            .is_null()) {
+      return false;
+    }
+  }
+  if (transitioning) CommitProperties(object, map, properties);
+  return true;
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !id_map_->get(id).IsTheHole(isolate_);
@@ -118,6 +118,8 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteShapedJSObject(Handle<JSObject> object)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(JSDate date);
   Maybe<bool> WriteJSPrimitiveWrapper(Handle<JSPrimitiveWrapper> value)
@@ -170,6 +172,10 @@ class ValueSerializer {
 
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
+
+  // Maps of the objects written with a shape, to their shape ID.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
 };
 
 /*
@@ -259,6 +265,7 @@ class ValueDeserializer {
   MaybeHandle<String> ReadOneByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -286,6 +293,21 @@ class ValueDeserializer {
                                          SerializationTag end_tag,
                                          bool can_use_transitions);
 
+  // Shapes are fixed arrays holding the map to use for objects read with the
+  // shape (or undefined), followed by the internalized property names.
+  static constexpr int kShapeMapIndex = 0;
+  static constexpr int kShapeFirstKeyIndex = 1;
+  MaybeHandle<FixedArray> ReadShape() V8_WARN_UNUSED_RESULT;
+  bool ValuesFitMap(Handle<Map> map,
+                    const std::vector<Handle<Object>>& values);
+  bool SetShapedProperties(Handle<JSObject> object, Handle<FixedArray> shape,
+                           const std::vector<Handle<Object>>& values)
+      V8_WARN_UNUSED_RESULT;
+
+  // One-byte strings up to this length are internalized, so that names and
+  // enum-like values repeated throughout the data are held only once.
+  static constexpr uint32_t kMaxInternalizedStringLength = 32;
+
   // Manipulating the map from IDs to reified objects.
   bool HasObjectWithID(uint32_t id);
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
@@ -301,6 +323,8 @@ class ValueDeserializer {
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  Handle<FixedArray> shapes_;
+  uint32_t num_shapes_ = 0;
 };
 
 }  // namespace internal
@@ -34,6 +34,17 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of ASCII code units.
+  V8_INLINE void AddAsciiChars(const uint16_t* code_units, int length) {
+    DCHECK(is_one_byte());
+    while (position_ + length > backing_store_.length()) ExpandBuffer();
+    for (int i = 0; i < length; i++) {
+      DCHECK_LE(code_units[i], unibrow::Utf8::kMaxOneByteChar);
+      backing_store_[position_ + i] = static_cast<byte>(code_units[i]);
+    }
+    position_ += length;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(Vector<const char> keyword) const {
@@ -0,0 +1,237 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/preparse-data-cache.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/utils/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The cache starts with a header of uint32 fields, followed by one entry per
+// function:
+//   function literal id, start position, end position, PreparseData
+// where a PreparseData is written as
+//   data length, children length, data bytes, children PreparseData.
+#ifdef DEBUG
+// The byte data of debug builds has extra markers.
+constexpr uint32_t kMagicNumber = 0xC0DE0DE2;
+#else
+constexpr uint32_t kMagicNumber = 0xC0DE0DE1;
+#endif
+constexpr int kMagicNumberOffset = 0;
+constexpr int kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
+constexpr int kSourceHashOffset = kVersionHashOffset + kUInt32Size;
+constexpr int kEntryCountOffset = kSourceHashOffset + kUInt32Size;
+constexpr int kHeaderSize = kEntryCountOffset + kUInt32Size;
+
+// Deeper nesting than this can't have been produced by the parser.
+constexpr int kMaxDepth = 1024;
+
+class CacheWriter {
+ public:
+  void WriteUint32(uint32_t value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    data_.insert(data_.end(), bytes, bytes + kUInt32Size);
+  }
+
+  void WritePreparseData(PreparseData data) {
+    WriteUint32(data.data_length());
+    WriteUint32(data.children_length());
+    for (int i = 0; i < data.data_length(); i++) data_.push_back(data.get(i));
+    for (int i = 0; i < data.children_length(); i++) {
+      WritePreparseData(data.get_child(i));
+    }
+  }
+
+  void PatchUint32(int offset, uint32_t value) {
+    memcpy(&data_[offset], &value, kUInt32Size);
+  }
+
+  std::vector<uint8_t>& data() { return data_; }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+class CacheReader {
+ public:
+  CacheReader(const uint8_t* data, int length)
+      : data_(data), length_(length), position_(0) {}
+
+  int position() const { return position_; }
+  void set_position(int position) { position_ = position; }
+
+  bool ReadUint32(uint32_t* value) {
+    if (length_ - position_ < kUInt32Size) return false;
+    memcpy(value, data_ + position_, kUInt32Size);
+    position_ += kUInt32Size;
+    return true;
+  }
+
+  bool ReadInt(int* value) {
+    uint32_t raw;
+    if (!ReadUint32(&raw) || raw > static_cast<uint32_t>(kMaxInt)) {
+      return false;
+    }
+    *value = static_cast<int>(raw);
+    return true;
+  }
+
+  // Checks that a PreparseData can be read at the current position and
+  // skips it.
+  bool SkipPreparseData(int depth) {
+    int data_length, children_length;
+    if (depth > kMaxDepth || !ReadInt(&data_length) ||
+        !ReadInt(&children_length) || length_ - position_ < data_length) {
+      return false;
+    }
+    position_ += data_length;
+    for (int i = 0; i < children_length; i++) {
+      if (!SkipPreparseData(depth + 1)) return false;
+    }
+    return true;
+  }
+
+  // Reads a PreparseData that SkipPreparseData has accepted before.
+  Handle<PreparseData> ReadPreparseData(Isolate* isolate) {
+    int data_length, children_length;
+    CHECK(ReadInt(&data_length));
+    CHECK(ReadInt(&children_length));
+    Handle<PreparseData> result =
+        isolate->factory()->NewPreparseData(data_length, children_length);
+    result->copy_in(0, data_ + position_, data_length);
+    position_ += data_length;
+    for (int i = 0; i < children_length; i++) {
+      Handle<PreparseData> child = ReadPreparseData(isolate);
+      result->set_child(i, *child);
+    }
+    return result;
+  }
+
+ private:
+  const uint8_t* data_;
+  int length_;
+  int position_;
+};
+
+uint32_t SourceHash(Script script) {
+  return SerializedCodeData::SourceHash(
+      handle(String::cast(script.source()), script.GetIsolate()),
+      script.origin_options());
+}
+
+}  // namespace
+
+// static
+ScriptCompiler::CachedData* PreparseDataCache::Serialize(
+    Isolate* isolate, Handle<Script> script) {
+  DisallowGarbageCollection no_gc;
+  CacheWriter writer;
+  writer.WriteUint32(kMagicNumber);
+  writer.WriteUint32(Version::Hash());
+  writer.WriteUint32(SourceHash(*script));
+  writer.WriteUint32(0);
+
+  uint32_t entry_count = 0;
+  SharedFunctionInfo::ScriptIterator it(isolate, *script);
+  for (SharedFunctionInfo shared = it.Next(); !shared.is_null();
+       shared = it.Next()) {
+    if (!shared.HasUncompiledDataWithPreparseData()) continue;
+    UncompiledDataWithPreparseData uncompiled =
+        shared.uncompiled_data_with_preparse_data();
+    writer.WriteUint32(shared.function_literal_id());
+    writer.WriteUint32(uncompiled.start_position());
+    writer.WriteUint32(uncompiled.end_position());
+    writer.WritePreparseData(uncompiled.preparse_data());
+    entry_count++;
+  }
+  writer.PatchUint32(kEntryCountOffset, entry_count);
+
+  std::vector<uint8_t>& data = writer.data();
+  uint8_t* buffer = NewArray<uint8_t>(data.size());
+  std::copy(data.begin(), data.end(), buffer);
+  return new ScriptCompiler::CachedData(
+      buffer, static_cast<int>(data.size()),
+      ScriptCompiler::CachedData::BufferOwned);
+}
+
+// static
+bool PreparseDataCache::Deserialize(Isolate* isolate, Handle<Script> script,
+                                    ScriptCompiler::CachedData* cached_data) {
+  CacheReader reader(cached_data->data, cached_data->length);
+  uint32_t magic_number, version_hash, source_hash, entry_count;
+  if (!reader.ReadUint32(&magic_number) ||
+      !reader.ReadUint32(&version_hash) || !reader.ReadUint32(&source_hash) ||
+      !reader.ReadUint32(&entry_count) || magic_number != kMagicNumber ||
+      version_hash != Version::Hash() ||
+      source_hash != SourceHash(*script)) {
+    cached_data->rejected = true;
+    return false;
+  }
+  DCHECK_EQ(kHeaderSize, reader.position());
+
+  // Check all entries before touching any function, and remember where the
+  // PreparseData of each function starts.
+  struct Entry {
+    int start_position;
+    int end_position;
+    int data_offset;
+  };
+  std::unordered_map<int, Entry> entries;
+  for (uint32_t i = 0; i < entry_count; i++) {
+    int function_literal_id;
+    Entry entry;
+    if (!reader.ReadInt(&function_literal_id) ||
+        !reader.ReadInt(&entry.start_position) ||
+        !reader.ReadInt(&entry.end_position)) {
+      cached_data->rejected = true;
+      return false;
+    }
+    entry.data_offset = reader.position();
+    if (!reader.SkipPreparseData(0)) {
+      cached_data->rejected = true;
+      return false;
+    }
+    entries[function_literal_id] = entry;
+  }
+
+  SharedFunctionInfo::ScriptIterator it(isolate, *script);
+  for (SharedFunctionInfo raw_shared = it.Next(); !raw_shared.is_null();
+       raw_shared = it.Next()) {
+    if (!raw_shared.HasUncompiledDataWithoutPreparseData()) continue;
+    auto entry = entries.find(raw_shared.function_literal_id());
+    if (entry == entries.end()) continue;
+    UncompiledData uncompiled = raw_shared.uncompiled_data();
+    if (uncompiled.start_position() != entry->second.start_position ||
+        uncompiled.end_position() != entry->second.end_position) {
+      continue;
+    }
+
+    HandleScope scope(isolate);
+    Handle<SharedFunctionInfo> shared(raw_shared, isolate);
+    Handle<String> inferred_name(uncompiled.inferred_name(), isolate);
+    reader.set_position(entry->second.data_offset);
+    Handle<PreparseData> preparse_data = reader.ReadPreparseData(isolate);
+    Handle<UncompiledData> with_preparse_data =
+        isolate->factory()->NewUncompiledDataWithPreparseData(
+            inferred_name, entry->second.start_position,
+            entry->second.end_position, preparse_data);
+    shared->set_uncompiled_data(*with_preparse_data);
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
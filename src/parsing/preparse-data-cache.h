@@ -0,0 +1,41 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PREPARSE_DATA_CACHE_H_
+#define V8_PARSING_PREPARSE_DATA_CACHE_H_
+
+#include "include/v8.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Script;
+
+// Persists the PreparseData of the lazy functions of a script independently
+// of the code cache. The data only depends on the source and the V8 version,
+// not on the flags, so it can still be used when a code cache is rejected.
+// Lazy functions that get their PreparseData back skip preparsing their
+// inner functions when they are compiled.
+class PreparseDataCache : public AllStatic {
+ public:
+  // Returns the PreparseData of the functions of {script} that haven't been
+  // compiled yet. The returned CachedData is owned by the caller.
+  V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
+      Isolate* isolate, Handle<Script> script);
+
+  // Gives the functions of {script} that have no PreparseData the data
+  // recorded for them in {cached_data}. Returns false and rejects
+  // {cached_data} if it wasn't produced for the same source and version.
+  V8_EXPORT_PRIVATE static bool Deserialize(
+      Isolate* isolate, Handle<Script> script,
+      ScriptCompiler::CachedData* cached_data);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PREPARSE_DATA_CACHE_H_
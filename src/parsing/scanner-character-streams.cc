@@ -518,6 +518,17 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences, which are one char per byte and need no
+    // decoding to be skipped.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t max_length = Min(static_cast<size_t>(end - cursor),
+                              position - chars);
+      int ascii_length = NonAsciiStart(
+          cursor, static_cast<int>(Min(max_length, size_t{kMaxInt})));
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -591,6 +602,18 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   }
 
   const uint16_t* max_buffer_end = buffer_start_ + kBufferSize;
+  // Copy a leading ascii sequence without decoding its first char, unless a
+  // char split over the previous chunk is still incomplete.
+  if (state == unibrow::Utf8::State::kAccept) {
+    int max_length = static_cast<int>(
+        Min(static_cast<size_t>(end - cursor),
+            static_cast<size_t>(max_buffer_end - output_cursor)));
+    int ascii_length = NonAsciiStart(cursor, max_length);
+    CopyChars(output_cursor, cursor, ascii_length);
+    cursor += ascii_length;
+    output_cursor += ascii_length;
+  }
+
   while (cursor < end && output_cursor + 1 < max_buffer_end) {
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
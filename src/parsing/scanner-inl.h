@@ -6,6 +6,7 @@
 #define V8_PARSING_SCANNER_INL_H_
 
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -273,23 +274,37 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
+      AdvanceUntilFound([this, &scan_flags](const uint16_t* start,
+                                            const uint16_t* end) {
+        const uint16_t* cursor = start;
+        while (true) {
+          // Take the whole run of ASCII identifier characters at once. They
+          // only contribute kCannotBeKeyword to the flags.
+          const uint16_t* run_end =
+              scanner_simd::FindNonAsciiIdentifierPart(cursor, end);
+          if (CanBeKeyword(scan_flags)) {
+            for (const uint16_t* p = cursor; p != run_end; p++) {
+              scan_flags |= character_scan_flags[*p];
+            }
+          }
+          next().literal_chars.AddAsciiChars(
+              cursor, static_cast<int>(run_end - cursor));
+          cursor = run_end;
+          if (cursor == end) return end;
+
+          uc32 c0 = *cursor;
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            // A non-ascii character means we need to drop through to the
+            // slow path.
+            scan_flags |=
+                static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+            return cursor;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          scan_flags |= char_flags;
+          if (TerminatesLiteral(char_flags)) return cursor;
           AddLiteralChar(static_cast<char>(c0));
-          return false;
+          cursor++;
         }
       });
 
@@ -328,7 +343,12 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
-    Advance();
+    // Skip runs of spaces and tabs, like indentation, at once.
+    if (c0_ == ' ' || c0_ == '\t') {
+      AdvanceUntilFound(scanner_simd::FindNonBlank);
+    } else {
+      Advance();
+    }
   }
 
   // Return whether or not we skipped any characters.
@@ -0,0 +1,145 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches over the buffered code units of a Utf16CharacterStream that look
+// at eight code units at a time when SSE2 is available. They are meant to be
+// passed to Utf16CharacterStream::AdvanceUntilFound.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "src/base/bits.h"
+#include "src/base/macros.h"
+#include "src/strings/char-predicates-inl.h"
+
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && \
+     (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))
+#define V8_SCANNER_HAVE_SSE2 1
+#include <emmintrin.h>
+#else
+#define V8_SCANNER_HAVE_SSE2 0
+#endif
+
+namespace v8 {
+namespace internal {
+namespace scanner_simd {
+
+#if V8_SCANNER_HAVE_SSE2
+constexpr int kCodeUnitsPerBlock = 8;
+
+V8_INLINE __m128i LoadBlock(const uint16_t* start) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+}
+
+// Returns the code units of {block} in [lo, hi] as 0xFFFF, and other code
+// units as 0. SSE2 has no unsigned 16-bit comparison, but x <= k exactly if
+// the saturating difference x - k is zero.
+V8_INLINE __m128i InRange(__m128i block, uint16_t lo, uint16_t hi) {
+  __m128i offset = _mm_sub_epi16(block, _mm_set1_epi16(lo));
+  __m128i above = _mm_subs_epu16(offset, _mm_set1_epi16(hi - lo));
+  return _mm_cmpeq_epi16(above, _mm_setzero_si128());
+}
+
+V8_INLINE __m128i Equal(__m128i block, uint16_t c) {
+  return _mm_cmpeq_epi16(block, _mm_set1_epi16(c));
+}
+
+// Returns the index of the first code unit that is set in {matches}, or -1 if
+// there is none.
+V8_INLINE int FirstMatch(__m128i matches) {
+  int mask = _mm_movemask_epi8(matches);
+  if (mask == 0) return -1;
+  return base::bits::CountTrailingZeros(static_cast<uint32_t>(mask)) >> 1;
+}
+
+// Returns the index of the first code unit that is not set in {matches}, or -1
+// if all of them are.
+V8_INLINE int FirstMismatch(__m128i matches) {
+  int mask = ~_mm_movemask_epi8(matches) & 0xFFFF;
+  if (mask == 0) return -1;
+  return base::bits::CountTrailingZeros(static_cast<uint32_t>(mask)) >> 1;
+}
+#endif  // V8_SCANNER_HAVE_SSE2
+
+// Returns the first code unit in [start, end) that is one of {kChars}, or
+// {end}.
+template <uint16_t... kChars>
+V8_INLINE const uint16_t* FindFirstOf(const uint16_t* start,
+                                      const uint16_t* end) {
+#if V8_SCANNER_HAVE_SSE2
+  for (; end - start >= kCodeUnitsPerBlock; start += kCodeUnitsPerBlock) {
+    __m128i block = LoadBlock(start);
+    __m128i matches = _mm_setzero_si128();
+    for (uint16_t c : {kChars...}) {
+      matches = _mm_or_si128(matches, Equal(block, c));
+    }
+    int index = FirstMatch(matches);
+    if (index >= 0) return start + index;
+  }
+#endif
+  for (; start != end; start++) {
+    for (uint16_t c : {kChars...}) {
+      if (*start == c) return start;
+    }
+  }
+  return end;
+}
+
+// Returns the first line terminator in [start, end), or {end}.
+V8_INLINE const uint16_t* FindLineTerminator(const uint16_t* start,
+                                             const uint16_t* end) {
+  return FindFirstOf<'\n', '\r', 0x2028, 0x2029>(start, end);
+}
+
+// Returns the first code unit in [start, end) that is neither a space nor a
+// tab, or {end}.
+V8_INLINE const uint16_t* FindNonBlank(const uint16_t* start,
+                                       const uint16_t* end) {
+#if V8_SCANNER_HAVE_SSE2
+  for (; end - start >= kCodeUnitsPerBlock; start += kCodeUnitsPerBlock) {
+    __m128i block = LoadBlock(start);
+    int index = FirstMismatch(
+        _mm_or_si128(Equal(block, ' '), Equal(block, '\t')));
+    if (index >= 0) return start + index;
+  }
+#endif
+  for (; start != end; start++) {
+    if (*start != ' ' && *start != '\t') return start;
+  }
+  return end;
+}
+
+// Returns the first code unit in [start, end) that is not an ASCII letter,
+// digit, '$' or '_', or {end}.
+V8_INLINE const uint16_t* FindNonAsciiIdentifierPart(const uint16_t* start,
+                                                     const uint16_t* end) {
+#if V8_SCANNER_HAVE_SSE2
+  for (; end - start >= kCodeUnitsPerBlock; start += kCodeUnitsPerBlock) {
+    __m128i block = LoadBlock(start);
+    // Setting bit 5 maps upper case letters to lower case ones, and no other
+    // code units to lower case letters.
+    __m128i lower = _mm_or_si128(block, _mm_set1_epi16(0x20));
+    __m128i matches = _mm_or_si128(InRange(lower, 'a', 'z'),
+                                   InRange(block, '0', '9'));
+    matches = _mm_or_si128(matches, Equal(block, '_'));
+    matches = _mm_or_si128(matches, Equal(block, '$'));
+    int index = FirstMismatch(matches);
+    if (index >= 0) return start + index;
+  }
+#endif
+  for (; start != end; start++) {
+    if (!IsAsciiIdentifier(*start)) return start;
+  }
+  return end;
+}
+
+}  // namespace scanner_simd
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
@@ -93,6 +93,27 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but hands all of the buffered code units to {find} at
+  // once, which returns a pointer to the first code unit in the given range
+  // that meets its requirement, or the end of the range.
+  template <typename FindFunction>
+  V8_INLINE uc32 AdvanceUntilFound(FindFunction find) {
+    while (true) {
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked()) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -529,6 +550,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FindFunction>
+  V8_INLINE void AdvanceUntilFound(FindFunction find) {
+    c0_ = source_->AdvanceUntilFound(find);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -0,0 +1,268 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/call-stack-table.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/bits.h"
+#include "src/base/functional.h"
+#include "src/profiler/profile-generator.h"
+#include "src/profiler/tick-sample.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Frame storage is sized for stacks of this depth on average.
+const size_t kAverageStackDepth = 32;
+
+// Appends protocol buffer wire format to a byte string.
+class ProtoWriter {
+ public:
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+      buffer_.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    buffer_.push_back(static_cast<char>(value));
+  }
+  void WriteVarintField(int field, uint64_t value) {
+    WriteVarint(static_cast<uint64_t>(field) << 3);
+    WriteVarint(value);
+  }
+  void WriteBytesField(int field, const std::string& bytes) {
+    WriteVarint((static_cast<uint64_t>(field) << 3) | 2);
+    WriteVarint(bytes.size());
+    buffer_.append(bytes);
+  }
+  void WritePackedField(int field, const std::vector<uint64_t>& values) {
+    ProtoWriter packed;
+    for (uint64_t value : values) packed.WriteVarint(value);
+    WriteBytesField(field, packed.buffer());
+  }
+
+  const std::string& buffer() const { return buffer_; }
+
+ private:
+  std::string buffer_;
+};
+
+// Field numbers from pprof's profile.proto.
+enum ProfileField {
+  kProfileSampleType = 1,
+  kProfileSample = 2,
+  kProfileLocation = 4,
+  kProfileFunction = 5,
+  kProfileStringTable = 6,
+  kProfileTimeNanos = 9,
+  kProfileDurationNanos = 10,
+  kProfilePeriodType = 11,
+  kProfilePeriod = 12,
+  kProfileComment = 13
+};
+
+class ProfileBuilder {
+ public:
+  ProfileBuilder() { StringId(""); }
+
+  uint64_t StringId(const char* string) {
+    auto it = string_ids_.find(string);
+    if (it != string_ids_.end()) return it->second;
+    uint64_t id = string_ids_.size();
+    string_ids_.emplace(string, id);
+    profile_.WriteBytesField(kProfileStringTable, string);
+    return id;
+  }
+
+  void WriteValueType(int field, const char* type, const char* unit) {
+    ProtoWriter value_type;
+    value_type.WriteVarintField(1, StringId(type));
+    value_type.WriteVarintField(2, StringId(unit));
+    profile_.WriteBytesField(field, value_type.buffer());
+  }
+
+  // Every code entry gets one function and one location, sharing the id.
+  uint64_t LocationId(CodeEntry* entry) {
+    auto it = location_ids_.find(entry);
+    if (it != location_ids_.end()) return it->second;
+    uint64_t id = location_ids_.size() + 1;
+    location_ids_.emplace(entry, id);
+    int line = std::max(entry->line_number(), 0);
+
+    ProtoWriter function;
+    function.WriteVarintField(1, id);
+    function.WriteVarintField(2, StringId(entry->name()));
+    function.WriteVarintField(3, StringId(entry->name()));
+    function.WriteVarintField(4, StringId(entry->resource_name()));
+    function.WriteVarintField(5, line);
+    profile_.WriteBytesField(kProfileFunction, function.buffer());
+
+    ProtoWriter location_line;
+    location_line.WriteVarintField(1, id);
+    location_line.WriteVarintField(2, line);
+    ProtoWriter location;
+    location.WriteVarintField(1, id);
+    location.WriteBytesField(4, location_line.buffer());
+    profile_.WriteBytesField(kProfileLocation, location.buffer());
+    return id;
+  }
+
+  ProtoWriter* profile() { return &profile_; }
+
+ private:
+  ProtoWriter profile_;
+  std::unordered_map<std::string, uint64_t> string_ids_;
+  std::unordered_map<CodeEntry*, uint64_t> location_ids_;
+};
+
+}  // namespace
+
+CallStackTable::CallStackTable(size_t max_stacks)
+    : max_stacks_(max_stacks),
+      max_frames_(max_stacks * kAverageStackDepth),
+      slots_mask_(base::bits::RoundUpToPowerOfTwo64(2 * max_stacks) - 1),
+      slots_(new Slot[slots_mask_ + 1]()),
+      frames_(new CodeEntry*[max_frames_]),
+      start_time_(base::Time::Now()),
+      start_ticks_(base::TimeTicks::HighResolutionNow()) {
+  DCHECK_LT(0, max_stacks);
+}
+
+CallStackTable::~CallStackTable() = default;
+
+CallStackTable::Slot* CallStackTable::Lookup(size_t hash,
+                                             CodeEntry* const* frames,
+                                             int length) {
+  for (size_t i = hash & slots_mask_;; i = (i + 1) & slots_mask_) {
+    Slot* slot = &slots_[i];
+    if (slot->length == 0) return slot;
+    if (slot->hash == hash && slot->length == length &&
+        memcmp(&frames_[slot->first_frame], frames,
+               length * sizeof(*frames)) == 0) {
+      return slot;
+    }
+  }
+}
+
+void CallStackTable::AddStack(CodeEntry* const* frames, int length,
+                              base::TimeDelta sampling_interval) {
+  DCHECK_LT(0, length);
+  size_t hash = 0;
+  for (int i = 0; i < length; i++) {
+    hash = base::hash_combine(hash, reinterpret_cast<uintptr_t>(frames[i]));
+  }
+
+  base::MutexGuard guard(&mutex_);
+  sampling_interval_ = sampling_interval;
+  Slot* slot = Lookup(hash, frames, length);
+  if (slot->length == 0) {
+    // The table is at most half full, so probing always ends at a free slot.
+    if (stack_count_ == max_stacks_ ||
+        max_frames_ - frame_count_ < static_cast<size_t>(length)) {
+      dropped_samples_++;
+      return;
+    }
+    std::copy(frames, frames + length, &frames_[frame_count_]);
+    *slot = {hash, frame_count_, length, 0, 0};
+    frame_count_ += length;
+    stack_count_++;
+  }
+  slot->count++;
+  slot->total_us += sampling_interval.InMicroseconds();
+}
+
+void CallStackTable::SerializeAndReset(v8::OutputStream* stream) {
+  // Copy the stacks out so the profiler thread isn't blocked on the stream.
+  std::vector<Slot> stacks;
+  std::vector<CodeEntry*> frames;
+  size_t dropped_samples;
+  base::TimeDelta sampling_interval;
+  base::Time start_time;
+  base::TimeTicks start_ticks;
+  base::TimeTicks now = base::TimeTicks::HighResolutionNow();
+  {
+    base::MutexGuard guard(&mutex_);
+    stacks.reserve(stack_count_);
+    for (size_t i = 0; i <= slots_mask_; i++) {
+      if (slots_[i].length != 0) stacks.push_back(slots_[i]);
+    }
+    frames.assign(&frames_[0], &frames_[frame_count_]);
+    dropped_samples = dropped_samples_;
+    sampling_interval = sampling_interval_;
+    start_time = start_time_;
+    start_ticks = start_ticks_;
+
+    std::fill(&slots_[0], &slots_[slots_mask_ + 1], Slot());
+    stack_count_ = 0;
+    frame_count_ = 0;
+    dropped_samples_ = 0;
+    start_time_ = base::Time::Now();
+    start_ticks_ = now;
+  }
+
+  ProfileBuilder builder;
+  ProtoWriter* profile = builder.profile();
+  builder.WriteValueType(kProfileSampleType, "samples", "count");
+  builder.WriteValueType(kProfileSampleType, "cpu", "nanoseconds");
+  for (const Slot& stack : stacks) {
+    std::vector<uint64_t> location_ids;
+    location_ids.reserve(stack.length);
+    for (int i = 0; i < stack.length; i++) {
+      location_ids.push_back(
+          builder.LocationId(frames[stack.first_frame + i]));
+    }
+    ProtoWriter sample;
+    sample.WritePackedField(1, location_ids);
+    sample.WritePackedField(
+        2, {stack.count, static_cast<uint64_t>(stack.total_us) * 1000});
+    profile->WriteBytesField(kProfileSample, sample.buffer());
+  }
+  profile->WriteVarintField(
+      kProfileTimeNanos, static_cast<uint64_t>(start_time.ToJsTime() * 1e6));
+  profile->WriteVarintField(kProfileDurationNanos,
+                            (now - start_ticks).InNanoseconds());
+  builder.WriteValueType(kProfilePeriodType, "cpu", "nanoseconds");
+  profile->WriteVarintField(kProfilePeriod, sampling_interval.InNanoseconds());
+  if (dropped_samples > 0) {
+    std::string comment =
+        "dropped samples: " + std::to_string(dropped_samples);
+    profile->WriteVarintField(kProfileComment,
+                              builder.StringId(comment.c_str()));
+  }
+
+  const std::string& bytes = profile->buffer();
+  int chunk_size = stream->GetChunkSize();
+  DCHECK_LT(0, chunk_size);
+  std::vector<char> chunk(chunk_size);
+  for (size_t pos = 0; pos < bytes.size(); pos += chunk_size) {
+    int length =
+        static_cast<int>(std::min<size_t>(chunk_size, bytes.size() - pos));
+    std::copy(bytes.begin() + pos, bytes.begin() + pos + length,
+              chunk.begin());
+    if (stream->WriteAsciiChunk(chunk.data(), length) ==
+        v8::OutputStream::kAbort) {
+      return;
+    }
+  }
+  stream->EndOfStream();
+}
+
+size_t CallStackTable::stack_count() const {
+  base::MutexGuard guard(&mutex_);
+  return stack_count_;
+}
+
+size_t CallStackTable::dropped_samples() const {
+  base::MutexGuard guard(&mutex_);
+  return dropped_samples_;
+}
+
+}  // namespace internal
+}  // namespace v8
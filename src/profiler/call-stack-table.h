@@ -0,0 +1,73 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_CALL_STACK_TABLE_H_
+#define V8_PROFILER_CALL_STACK_TABLE_H_
+
+#include <memory>
+
+#include "include/v8-profiler.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace internal {
+
+class CodeEntry;
+
+// Aggregates symbolized call stacks by identity into a table of fixed
+// capacity, for continuous profiling without building a CpuProfile. Both
+// the stacks and their frames live in storage allocated up front, so adding
+// a sample never allocates; samples whose stack doesn't fit are only counted.
+class V8_EXPORT_PRIVATE CallStackTable {
+ public:
+  // Room for |max_stacks| distinct stacks of TickSample-sized depth.
+  explicit CallStackTable(size_t max_stacks);
+  ~CallStackTable();
+
+  // Called on the profiler thread. |frames| lists the leaf first.
+  void AddStack(CodeEntry* const* frames, int length,
+                base::TimeDelta sampling_interval);
+
+  // Writes the samples aggregated since construction or the last call as a
+  // pprof profile (profile.proto, uncompressed) and empties the table.
+  void SerializeAndReset(v8::OutputStream* stream);
+
+  size_t stack_count() const;
+  size_t dropped_samples() const;
+
+ private:
+  struct Slot {
+    size_t hash;
+    size_t first_frame;
+    int length;  // 0 for free slots.
+    uint64_t count;
+    int64_t total_us;
+  };
+
+  Slot* Lookup(size_t hash, CodeEntry* const* frames, int length);
+
+  const size_t max_stacks_;
+  const size_t max_frames_;
+  const size_t slots_mask_;
+  std::unique_ptr<Slot[]> slots_;
+  std::unique_ptr<CodeEntry*[]> frames_;
+
+  // Guards the fields below and the contents of |slots_| and |frames_|.
+  mutable base::Mutex mutex_;
+  size_t stack_count_ = 0;
+  size_t frame_count_ = 0;
+  size_t dropped_samples_ = 0;
+  base::TimeDelta sampling_interval_;
+  base::Time start_time_;
+  base::TimeTicks start_ticks_;
+
+  DISALLOW_COPY_AND_ASSIGN(CallStackTable);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_CALL_STACK_TABLE_H_
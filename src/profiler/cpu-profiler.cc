@@ -10,12 +10,14 @@
 #include "src/base/lazy-instance.h"
 #include "src/base/template-utils.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/libsampler/sampler.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/profiler/call-stack-table.h"
 #include "src/profiler/cpu-profiler-inl.h"
 #include "src/profiler/profiler-stats.h"
 #include "src/profiler/symbolizer.h"
@@ -42,6 +44,10 @@ class CpuSampler : public sampler::Sampler {
           ProfilerStats::Reason::kIsolateNotLocked);
       return;
     }
+    if (V8_UNLIKELY(FLAG_runtime_call_stats_sampling)) {
+      isolate->counters()->runtime_call_stats()->AddSample(
+          processor_->period());
+    }
     TickSample* sample = processor_->StartTickSample();
     if (sample == nullptr) {
       ProfilerStats::Instance()->AddReason(
@@ -72,6 +78,9 @@ ProfilingScope::ProfilingScope(Isolate* isolate, ProfilerListener* listener)
   isolate_->set_num_cpu_profilers(profiler_count);
   isolate_->set_is_profiling(true);
   isolate_->wasm_engine()->EnableCodeLogging(isolate_);
+  if (FLAG_lazy_optimized_source_positions) {
+    Deoptimizer::DeoptimizeCodeWithoutSourcePositions(isolate_);
+  }
 
   Logger* logger = isolate_->logger();
   logger->AddCodeEventListener(listener_);
@@ -79,6 +88,11 @@ ProfilingScope::ProfilingScope(Isolate* isolate, ProfilerListener* listener)
   // callbacks on the heap.
   DCHECK(isolate_->heap()->HasBeenSetUp());
 
+  if (FLAG_cpu_profiler_incremental_logging) {
+    existing_code_logger_ = std::make_unique<IncrementalCodeLogger>(
+        isolate_, listener_, !FLAG_prof_browser_mode);
+    return;
+  }
   if (!FLAG_prof_browser_mode) {
     logger->LogCodeObjects();
   }
@@ -96,6 +110,13 @@ ProfilingScope::~ProfilingScope() {
   if (profiler_count == 0) isolate_->set_is_profiling(false);
 }
 
+bool ProfilingScope::LogExistingCode(base::TimeDelta budget) {
+  if (!existing_code_logger_) return true;
+  if (!existing_code_logger_->LogSlice(budget)) return false;
+  existing_code_logger_.reset();
+  return true;
+}
+
 ProfilerEventsProcessor::ProfilerEventsProcessor(
     Isolate* isolate, Symbolizer* symbolizer,
     ProfilerCodeObserver* code_observer)
@@ -166,6 +187,16 @@ void ProfilerEventsProcessor::AddSample(TickSample sample) {
   ticks_from_vm_buffer_.Enqueue(record);
 }
 
+void ProfilerEventsProcessor::DeferTicksUntilExistingCodeLogged() {
+  existing_code_pending_.store(true, std::memory_order_release);
+}
+
+void ProfilerEventsProcessor::ExistingCodeLogged() {
+  existing_code_last_event_id_.store(last_code_event_id_,
+                                     std::memory_order_relaxed);
+  existing_code_pending_.store(false, std::memory_order_release);
+}
+
 void ProfilerEventsProcessor::StopSynchronously() {
   bool expected = true;
   if (!running_.compare_exchange_strong(expected, false,
@@ -213,6 +244,17 @@ void ProfilerEventsProcessor::CodeEventHandler(
 
 void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
     const TickSampleEventRecord* record) {
+  {
+    base::MutexGuard guard(&call_stack_table_mutex_);
+    if (call_stack_table_) {
+      CodeEntry* frames[TickSample::kMaxFramesCount + 1];
+      int length = symbolizer_->SymbolizeStack(record->sample, frames);
+      call_stack_table_->AddStack(frames, length,
+                                  record->sample.sampling_interval);
+      // Skip the allocating symbolization if no profile wants the sample.
+      if (!profiles_->HasCurrentProfiles()) return;
+    }
+  }
   Symbolizer::SymbolizedSample symbolized =
       symbolizer_->SymbolizeTickSample(record->sample);
   profiles_->AddPathToCurrentProfiles(
@@ -227,7 +269,7 @@ SamplingEventsProcessor::ProcessOneSample() {
       (record1.order == last_processed_code_event_id_)) {
     TickSampleEventRecord record;
     ticks_from_vm_buffer_.Dequeue(&record);
-    SymbolizeAndAddToProfiles(&record);
+    ProcessTick(&record);
     return OneSampleProcessed;
   }
 
@@ -239,11 +281,40 @@ SamplingEventsProcessor::ProcessOneSample() {
   if (record->order != last_processed_code_event_id_) {
     return FoundSampleForNextCodeEvent;
   }
-  SymbolizeAndAddToProfiles(record);
+  ProcessTick(record);
   ticks_buffer_.Remove();
   return OneSampleProcessed;
 }
 
+void SamplingEventsProcessor::ProcessTick(
+    const TickSampleEventRecord* record) {
+  if (!deferred_ticks_.empty() &&
+      !existing_code_pending_.load(std::memory_order_acquire) &&
+      last_processed_code_event_id_ >=
+          existing_code_last_event_id_.load(std::memory_order_relaxed)) {
+    FlushDeferredTicks();
+  }
+  // Once ticks are held back, later ones queue up behind them so that
+  // samples reach the profiles in order.
+  if (deferred_ticks_.empty() &&
+      !existing_code_pending_.load(std::memory_order_acquire)) {
+    SymbolizeAndAddToProfiles(record);
+    return;
+  }
+  if (deferred_ticks_.size() == kMaxDeferredTicks) {
+    SymbolizeAndAddToProfiles(&deferred_ticks_.front());
+    deferred_ticks_.pop_front();
+  }
+  deferred_ticks_.push_back(*record);
+}
+
+void SamplingEventsProcessor::FlushDeferredTicks() {
+  for (const TickSampleEventRecord& record : deferred_ticks_) {
+    SymbolizeAndAddToProfiles(&record);
+  }
+  deferred_ticks_.clear();
+}
+
 void SamplingEventsProcessor::Run() {
   base::MutexGuard guard(&running_mutex_);
   while (running_.load(std::memory_order_relaxed)) {
@@ -302,6 +373,12 @@ void SamplingEventsProcessor::Run() {
       result = ProcessOneSample();
     } while (result == OneSampleProcessed);
   } while (ProcessCodeEvent());
+  FlushDeferredTicks();
+}
+
+void SamplingEventsProcessor::SetCallStackTable(CallStackTable* table) {
+  base::MutexGuard guard(&call_stack_table_mutex_);
+  call_stack_table_ = table;
 }
 
 void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
@@ -393,6 +470,8 @@ CpuProfile* CpuProfiler::GetProfile(int index) {
 
 void CpuProfiler::DeleteAllProfiles() {
   if (is_profiling_) StopProcessor();
+  // The table refers to code entries that are about to be cleared.
+  call_stack_table_.reset();
   ResetProfiles();
 }
 
@@ -433,6 +512,14 @@ class CpuProfilersManager {
     }
   }
 
+  void CallLogExistingCodeSlice(Isolate* isolate) {
+    base::MutexGuard lock(&mutex_);
+    auto range = profilers_.equal_range(isolate);
+    for (auto it = range.first; it != range.second; ++it) {
+      it->second->LogExistingCodeSlice();
+    }
+  }
+
  private:
   std::unordered_multimap<Isolate*, CpuProfiler*> profilers_;
   base::Mutex mutex_;
@@ -440,6 +527,15 @@ class CpuProfilersManager {
 
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(CpuProfilersManager, GetProfilersManager)
 
+// Interrupts can't be cancelled, so they find the profilers through the
+// manager rather than holding on to one.
+void LogExistingCodeInterrupt(v8::Isolate* isolate, void* data) {
+  GetProfilersManager()->CallLogExistingCodeSlice(
+      reinterpret_cast<Isolate*>(isolate));
+}
+
+const int kExistingCodeSliceMs = 2;
+
 }  // namespace
 
 CpuProfiler::CpuProfiler(Isolate* isolate, CpuProfilingNamingMode naming_mode,
@@ -504,6 +600,9 @@ void CpuProfiler::EnableLogging() {
   }
   profiling_scope_.reset(
       new ProfilingScope(isolate_, profiler_listener_.get()));
+  if (!profiling_scope_->existing_code_logged()) {
+    isolate_->RequestInterrupt(&LogExistingCodeInterrupt, nullptr);
+  }
 }
 
 void CpuProfiler::DisableLogging() {
@@ -513,7 +612,26 @@ void CpuProfiler::DisableLogging() {
   profiling_scope_.reset();
 }
 
+void CpuProfiler::LogExistingCodeSlice() {
+  if (!profiling_scope_ || profiling_scope_->existing_code_logged()) return;
+  if (!profiling_scope_->LogExistingCode(
+          base::TimeDelta::FromMilliseconds(kExistingCodeSliceMs))) {
+    isolate_->RequestInterrupt(&LogExistingCodeInterrupt, nullptr);
+    return;
+  }
+  if (processor_) processor_->ExistingCodeLogged();
+}
+
+void CpuProfiler::FinishLoggingExistingCode() {
+  if (!profiling_scope_ || profiling_scope_->existing_code_logged()) return;
+  profiling_scope_->LogExistingCode(base::TimeDelta::Max());
+  if (processor_) processor_->ExistingCodeLogged();
+}
+
 base::TimeDelta CpuProfiler::ComputeSamplingInterval() const {
+  // Profile intervals are multiples of the base interval, so continuous
+  // profiling at the base interval serves all of them.
+  if (call_stack_table_) return base_sampling_interval_;
   return profiles_->GetCommonSamplingInterval();
 }
 
@@ -575,6 +693,10 @@ void CpuProfiler::StartProcessorIfNotStarted() {
   processor_.reset(new SamplingEventsProcessor(
       isolate_, symbolizer_.get(), &code_observer_, profiles_.get(),
       sampling_interval, use_precise_sampling_));
+  processor_->SetCallStackTable(call_stack_table_.get());
+  if (!profiling_scope_->existing_code_logged()) {
+    processor_->DeferTicksUntilExistingCodeLogged();
+  }
   is_profiling_ = true;
 
   // Enable stack sampling.
@@ -584,6 +706,7 @@ void CpuProfiler::StartProcessorIfNotStarted() {
 
 CpuProfile* CpuProfiler::StopProfiling(const char* title) {
   if (!is_profiling_) return nullptr;
+  FinishLoggingExistingCode();
   StopProcessorIfLastProfile(title);
   CpuProfile* result = profiles_->StopProfiling(title);
   AdjustSamplingInterval();
@@ -596,10 +719,39 @@ CpuProfile* CpuProfiler::StopProfiling(String title) {
 
 void CpuProfiler::StopProcessorIfLastProfile(const char* title) {
   if (!profiles_->IsLastProfile(title)) return;
+  if (call_stack_table_) return;
   StopProcessor();
 }
 
+CpuProfilingStatus CpuProfiler::StartContinuousProfiling(size_t max_stacks) {
+  if (call_stack_table_) return CpuProfilingStatus::kAlreadyStarted;
+  TRACE_EVENT0("v8", "CpuProfiler::StartContinuousProfiling");
+  call_stack_table_ = std::make_unique<CallStackTable>(max_stacks);
+  if (processor_) processor_->SetCallStackTable(call_stack_table_.get());
+  AdjustSamplingInterval();
+  StartProcessorIfNotStarted();
+  return CpuProfilingStatus::kStarted;
+}
+
+void CpuProfiler::SerializeContinuousProfile(v8::OutputStream* stream) {
+  if (!call_stack_table_) return;
+  call_stack_table_->SerializeAndReset(stream);
+}
+
+void CpuProfiler::StopContinuousProfiling() {
+  if (!call_stack_table_) return;
+  if (!profiles_->HasCurrentProfiles()) {
+    StopProcessor();
+  } else {
+    processor_->SetCallStackTable(nullptr);
+  }
+  call_stack_table_.reset();
+  AdjustSamplingInterval();
+  if (!is_profiling_ && profiles_->profiles()->empty()) ResetProfiles();
+}
+
 void CpuProfiler::StopProcessor() {
+  FinishLoggingExistingCode();
   is_profiling_ = false;
   processor_->StopSynchronously();
   processor_.reset();
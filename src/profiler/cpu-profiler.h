@@ -6,6 +6,7 @@
 #define V8_PROFILER_CPU_PROFILER_H_
 
 #include <atomic>
+#include <deque>
 #include <memory>
 
 #include "src/base/platform/condition-variable.h"
@@ -26,6 +27,7 @@ namespace internal {
 class CodeEntry;
 class CodeMap;
 class CpuProfilesCollection;
+class IncrementalCodeLogger;
 class Isolate;
 class Symbolizer;
 
@@ -134,11 +136,19 @@ class ProfilingScope {
   ProfilingScope(Isolate* isolate, ProfilerListener* listener);
   ~ProfilingScope();
 
+  // With --cpu-profiler-incremental-logging, the code that predates the scope
+  // is logged to the listener by these calls rather than up front. Returns
+  // true once all of it has been logged.
+  bool LogExistingCode(base::TimeDelta budget);
+  bool existing_code_logged() const { return !existing_code_logger_; }
+
  private:
   Isolate* const isolate_;
   ProfilerListener* const listener_;
+  std::unique_ptr<IncrementalCodeLogger> existing_code_logger_;
 };
 
+class CallStackTable;
 class ProfilerCodeObserver;
 
 // This class implements both the profile events processor thread and
@@ -163,6 +173,13 @@ class V8_EXPORT_PRIVATE ProfilerEventsProcessor : public base::Thread,
   void AddSample(TickSample sample);
 
   virtual void SetSamplingInterval(base::TimeDelta) {}
+  virtual void SetCallStackTable(CallStackTable* table) {}
+
+  // While the code that predates the profiler is logged incrementally, ticks
+  // are held back so they aren't symbolized against a partial code map.
+  // Called on the VM thread, before starting and once logging is done.
+  void DeferTicksUntilExistingCodeLogged();
+  void ExistingCodeLogged();
 
  protected:
   ProfilerEventsProcessor(Isolate* isolate, Symbolizer* symbolizer,
@@ -187,6 +204,9 @@ class V8_EXPORT_PRIVATE ProfilerEventsProcessor : public base::Thread,
   LockedQueue<TickSampleEventRecord> ticks_from_vm_buffer_;
   std::atomic<unsigned> last_code_event_id_;
   unsigned last_processed_code_event_id_;
+  std::atomic_bool existing_code_pending_{false};
+  // The last code event enqueued while logging the existing code.
+  std::atomic<unsigned> existing_code_last_event_id_{0};
   Isolate* isolate_;
 };
 
@@ -207,6 +227,8 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   void Run() override;
 
   void SetSamplingInterval(base::TimeDelta period) override;
+  // Samples are also aggregated into |table| while it is set.
+  void SetCallStackTable(CallStackTable* table) override;
 
   // Tick sample events are filled directly in the buffer of the circular
   // queue (because the structure is of fixed width, but usually not all
@@ -222,6 +244,8 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
 
  private:
   SampleProcessingResult ProcessOneSample() override;
+  void ProcessTick(const TickSampleEventRecord* record);
+  void FlushDeferredTicks();
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
 
   static const size_t kTickSampleBufferSize = 512 * KB;
@@ -229,8 +253,14 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
       kTickSampleBufferSize / sizeof(TickSampleEventRecord);
   SamplingCircularQueue<TickSampleEventRecord,
                         kTickSampleQueueLength> ticks_buffer_;
+  // Ticks held back by DeferTicksUntilExistingCodeLogged(), in order. Past
+  // this many, the oldest are symbolized with what has been logged so far.
+  static const size_t kMaxDeferredTicks = 2048;
+  std::deque<TickSampleEventRecord> deferred_ticks_;
   std::unique_ptr<sampler::Sampler> sampler_;
   CpuProfilesCollection* profiles_;
+  base::Mutex call_stack_table_mutex_;
+  CallStackTable* call_stack_table_ = nullptr;
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
                                      // low sampling intervals on Windows.
@@ -321,6 +351,14 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String title);
+
+  // Continuous profiling aggregates samples by call stack into a table of
+  // |max_stacks| entries, independently of the profiles above.
+  StartProfilingStatus StartContinuousProfiling(size_t max_stacks);
+  void SerializeContinuousProfile(v8::OutputStream* stream);
+  void StopContinuousProfiling();
+  bool is_profiling_continuously() const { return !!call_stack_table_; }
+
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
   void DeleteAllProfiles();
@@ -328,6 +366,11 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   bool is_profiling() const { return is_profiling_; }
 
+  // Logs a slice of the code that predates the profiler, with
+  // --cpu-profiler-incremental-logging. Called from an interrupt, which is
+  // requested again until all of it has been logged.
+  void LogExistingCodeSlice();
+
   Symbolizer* symbolizer() const { return symbolizer_.get(); }
   ProfilerEventsProcessor* processor() const { return processor_.get(); }
   Isolate* isolate() const { return isolate_; }
@@ -345,6 +388,9 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   void EnableLogging();
   void DisableLogging();
+  // Logs the rest of the existing code synchronously, so that held back
+  // ticks can be symbolized before a profile is returned.
+  void FinishLoggingExistingCode();
 
   // Computes a sampling interval sufficient to accomodate attached profiles.
   base::TimeDelta ComputeSamplingInterval() const;
@@ -364,6 +410,7 @@ class V8_EXPORT_PRIVATE CpuProfiler {
   std::unique_ptr<ProfilerEventsProcessor> processor_;
   std::unique_ptr<ProfilerListener> profiler_listener_;
   std::unique_ptr<ProfilingScope> profiling_scope_;
+  std::unique_ptr<CallStackTable> call_stack_table_;
   ProfilerCodeObserver code_observer_;
   bool is_profiling_;
 
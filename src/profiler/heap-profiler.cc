@@ -102,6 +102,34 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeSnapshotToStream(
+    v8::OutputStream* stream, v8::ActivityControl* control,
+    v8::HeapProfiler::ObjectNameResolver* resolver,
+    bool treat_global_objects_as_roots) {
+  is_taking_snapshot_ = true;
+  bool result;
+  {
+    // The snapshot only lives for the duration of the traversal; its edges
+    // are never materialized.
+    HeapSnapshot snapshot(this, treat_global_objects_as_roots);
+    HeapSnapshotBinarySerializer serializer(stream);
+    snapshot.set_stream_serializer(&serializer);
+    serializer.WriteHeader();
+    HeapSnapshotGenerator generator(&snapshot, control, resolver, heap());
+    result = generator.GenerateSnapshot();
+    if (result) serializer.WriteNodesAndFinalize(&snapshot);
+    result = result && !serializer.aborted();
+  }
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+  is_taking_snapshot_ = false;
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  return result;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
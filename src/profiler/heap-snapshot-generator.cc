@@ -4,8 +4,11 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
 #include "src/codegen/assembler-inl.h"
@@ -14,6 +17,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -83,6 +87,11 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type,
                                   const char* name,
                                   HeapEntry* entry) {
   ++children_count_;
+  if (HeapSnapshotBinarySerializer* serializer =
+          snapshot_->stream_serializer()) {
+    serializer->WriteNamedEdge(type, this, name, entry);
+    return;
+  }
   snapshot_->edges().emplace_back(type, name, this, entry);
 }
 
@@ -90,6 +99,11 @@ void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type,
                                     int index,
                                     HeapEntry* entry) {
   ++children_count_;
+  if (HeapSnapshotBinarySerializer* serializer =
+          snapshot_->stream_serializer()) {
+    serializer->WriteIndexedEdge(type, this, index, entry);
+    return;
+  }
   snapshot_->edges().emplace_back(type, index, this, entry);
 }
 
@@ -698,13 +712,17 @@ int V8HeapExplorer::EstimateObjectsCount() {
 
 class IndexedReferencesExtractor : public ObjectVisitor {
  public:
-  IndexedReferencesExtractor(V8HeapExplorer* generator, HeapObject parent_obj,
-                             HeapEntry* parent)
+  IndexedReferencesExtractor(
+      V8HeapExplorer* generator, HeapObject parent_obj, HeapEntry* parent,
+      std::vector<bool>* visited_fields,
+      std::vector<V8HeapExplorer::HiddenReference>* references)
       : generator_(generator),
         parent_obj_(parent_obj),
         parent_start_(parent_obj_.RawMaybeWeakField(0)),
         parent_end_(parent_obj_.RawMaybeWeakField(parent_obj_.Size())),
         parent_(parent),
+        visited_fields_(visited_fields),
+        references_(references),
         next_index_(0) {}
   void VisitPointers(HeapObject host, ObjectSlot start,
                      ObjectSlot end) override {
@@ -718,8 +736,8 @@ class IndexedReferencesExtractor : public ObjectVisitor {
     CHECK_LE(end, parent_end_);
     for (MaybeObjectSlot p = start; p < end; ++p) {
       int field_index = static_cast<int>(p - parent_start_);
-      if (generator_->visited_fields_[field_index]) {
-        generator_->visited_fields_[field_index] = false;
+      if ((*visited_fields_)[field_index]) {
+        (*visited_fields_)[field_index] = false;
         continue;
       }
       HeapObject heap_object;
@@ -745,7 +763,8 @@ class IndexedReferencesExtractor : public ObjectVisitor {
     // skipped references, so passing -1 * kTaggedSize for objects embedded
     // into code is fine.
     generator_->SetHiddenReference(parent_obj_, parent_, next_index_++,
-                                   heap_object, field_index * kTaggedSize);
+                                   heap_object, field_index * kTaggedSize,
+                                   references_);
   }
 
   V8HeapExplorer* generator_;
@@ -753,6 +772,8 @@ class IndexedReferencesExtractor : public ObjectVisitor {
   MaybeObjectSlot parent_start_;
   MaybeObjectSlot parent_end_;
   HeapEntry* parent_;
+  std::vector<bool>* visited_fields_;
+  std::vector<V8HeapExplorer::HiddenReference>* references_;
   int next_index_;
 };
 
@@ -1534,12 +1555,15 @@ bool V8HeapExplorer::IterateAndExtractReferences(
     }
 
     HeapEntry* entry = GetEntry(obj);
+    size_t visited_begin = visited_field_indices_.size();
     ExtractReferences(entry, obj);
     SetInternalReference(entry, "map", obj.map(), HeapObject::kMapOffset);
-    // Extract unvisited fields as hidden references and restore tags
-    // of visited fields.
-    IndexedReferencesExtractor refs_extractor(this, obj, entry);
-    obj.Iterate(&refs_extractor);
+    // Unvisited fields are extracted as hidden references once all objects
+    // have entries, see ExtractPendingHiddenReferences().
+    pending_objects_.push_back({obj, entry, visited_begin});
+    for (size_t i = visited_begin; i < visited_field_indices_.size(); ++i) {
+      visited_fields_[visited_field_indices_[i]] = false;
+    }
 
     // Ensure visited_fields_ doesn't leak to the next object.
     for (size_t i = 0; i < max_pointer; ++i) {
@@ -1552,10 +1576,123 @@ bool V8HeapExplorer::IterateAndExtractReferences(
     if (!progress_->ProgressReport(false)) interrupted = true;
   }
 
+  if (!interrupted) interrupted = !ExtractPendingHiddenReferences();
+  std::vector<PendingObject>().swap(pending_objects_);
+  std::vector<int>().swap(visited_field_indices_);
+
   generator_ = nullptr;
   return interrupted ? false : progress_->ProgressReport(true);
 }
 
+// Scans the fields of pending objects on worker threads. Entries are only
+// looked up, never added, so the entries map can be shared without locking
+// while the main thread waits in Join().
+class HiddenReferencesJob final : public JobTask {
+ public:
+  HiddenReferencesJob(
+      V8HeapExplorer* explorer,
+      std::vector<V8HeapExplorer::HiddenReferencesChunk>* chunks,
+      size_t max_threads)
+      : explorer_(explorer), chunks_(chunks), max_threads_(max_threads) {}
+
+  void Run(JobDelegate* delegate) override {
+    std::vector<bool> visited_fields;
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) break;
+      explorer_->ExtractHiddenReferences(&(*chunks_)[index], &visited_fields);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t num_chunks = chunks_->size();
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    size_t remaining = num_chunks - std::min(next, num_chunks);
+    return std::min(max_threads_, worker_count + remaining);
+  }
+
+ private:
+  V8HeapExplorer* const explorer_;
+  std::vector<V8HeapExplorer::HiddenReferencesChunk>* const chunks_;
+  const size_t max_threads_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+bool V8HeapExplorer::ExtractPendingHiddenReferences() {
+  // Objects are handed out in chunks, and the references of a batch of
+  // chunks are merged before the next batch starts so that the buffered
+  // references stay bounded.
+  const size_t kChunkSize = 4096;
+  const size_t kChunksPerBatch = 64;
+  size_t num_threads =
+      FLAG_heap_snapshot_parallel
+          ? V8::GetCurrentPlatform()->NumberOfWorkerThreads()
+          : 0;
+  std::vector<bool> visited_fields;
+  size_t count = pending_objects_.size();
+  for (size_t batch_begin = 0; batch_begin < count;
+       batch_begin += kChunkSize * kChunksPerBatch) {
+    size_t batch_end =
+        std::min(count, batch_begin + kChunkSize * kChunksPerBatch);
+    std::vector<HiddenReferencesChunk> chunks;
+    for (size_t begin = batch_begin; begin < batch_end; begin += kChunkSize) {
+      chunks.push_back({begin, std::min(batch_end, begin + kChunkSize), {}});
+    }
+    if (num_threads > 0 && chunks.size() > 1) {
+      std::unique_ptr<JobHandle> job = V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserBlocking,
+          std::make_unique<HiddenReferencesJob>(this, &chunks,
+                                                num_threads + 1));
+      job->Join();
+    } else {
+      for (HiddenReferencesChunk& chunk : chunks) {
+        ExtractHiddenReferences(&chunk, &visited_fields);
+      }
+    }
+    // Merging in chunk order keeps the edges of each entry in field order.
+    for (const HiddenReferencesChunk& chunk : chunks) {
+      for (const HiddenReference& reference : chunk.references) {
+        HeapEntry* child_entry = reference.to != nullptr
+                                     ? reference.to
+                                     : GetEntry(reference.to_object);
+        reference.from->SetIndexedReference(HeapGraphEdge::kHidden,
+                                            reference.index, child_entry);
+      }
+    }
+    if (!progress_->ProgressReport(false)) return false;
+  }
+  return true;
+}
+
+void V8HeapExplorer::ExtractHiddenReferences(
+    HiddenReferencesChunk* chunk, std::vector<bool>* visited_fields) {
+  for (size_t i = chunk->begin; i < chunk->end; ++i) {
+    const PendingObject& pending = pending_objects_[i];
+    HeapObject obj = pending.object;
+    size_t visited_end = i + 1 < pending_objects_.size()
+                             ? pending_objects_[i + 1].visited_begin
+                             : visited_field_indices_.size();
+    size_t max_pointer = obj.Size() / kTaggedSize;
+    if (max_pointer > visited_fields->size()) {
+      std::vector<bool>().swap(*visited_fields);
+      visited_fields->resize(max_pointer, false);
+    }
+    for (size_t j = pending.visited_begin; j < visited_end; ++j) {
+      (*visited_fields)[visited_field_indices_[j]] = true;
+    }
+    // Extract unvisited fields as hidden references and restore tags
+    // of visited fields.
+    IndexedReferencesExtractor refs_extractor(this, obj, pending.entry,
+                                              visited_fields,
+                                              &chunk->references);
+    obj.Iterate(&refs_extractor);
+    // Don't let fields the body descriptor skipped leak to the next object.
+    for (size_t j = pending.visited_begin; j < visited_end; ++j) {
+      (*visited_fields)[visited_field_indices_[j]] = false;
+    }
+  }
+}
+
 bool V8HeapExplorer::IsEssentialObject(Object object) {
   ReadOnlyRoots roots(heap_);
   return object.IsHeapObject() && !object.IsOddball() &&
@@ -1600,6 +1737,7 @@ void V8HeapExplorer::MarkVisitedField(int offset) {
   int index = offset / kTaggedSize;
   DCHECK(!visited_fields_[index]);
   visited_fields_[index] = true;
+  visited_field_indices_.push_back(index);
 }
 
 void V8HeapExplorer::SetNativeBindReference(HeapEntry* parent_entry,
@@ -1642,16 +1780,18 @@ void V8HeapExplorer::SetInternalReference(HeapEntry* parent_entry, int index,
   MarkVisitedField(field_offset);
 }
 
-void V8HeapExplorer::SetHiddenReference(HeapObject parent_obj,
-                                        HeapEntry* parent_entry, int index,
-                                        Object child_obj, int field_offset) {
-  DCHECK_EQ(parent_entry, GetEntry(parent_obj));
-  HeapEntry* child_entry = GetEntry(child_obj);
-  if (child_entry != nullptr && IsEssentialObject(child_obj) &&
-      IsEssentialHiddenReference(parent_obj, field_offset)) {
-    parent_entry->SetIndexedReference(HeapGraphEdge::kHidden, index,
-                                      child_entry);
+void V8HeapExplorer::SetHiddenReference(
+    HeapObject parent_obj, HeapEntry* parent_entry, int index,
+    HeapObject child_obj, int field_offset,
+    std::vector<HiddenReference>* references) {
+  if (!IsEssentialObject(child_obj) ||
+      !IsEssentialHiddenReference(parent_obj, field_offset)) {
+    return;
   }
+  // This may run on a worker thread, so look the entry up without adding it.
+  HeapEntry* child_entry =
+      generator_->FindEntry(reinterpret_cast<void*>(child_obj.ptr()));
+  references->push_back({parent_entry, child_entry, child_obj, index});
 }
 
 void V8HeapExplorer::SetWeakReference(HeapEntry* parent_entry,
@@ -2115,7 +2255,9 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  // Streamed edges were written out as they were found, so there is nothing
+  // to group by parent.
+  if (snapshot_->stream_serializer() == nullptr) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -2128,6 +2270,8 @@ void HeapSnapshotGenerator::ProgressStep() {
 }
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
+  HeapSnapshotBinarySerializer* serializer = snapshot_->stream_serializer();
+  if (serializer != nullptr && serializer->aborted()) return false;
   const int kProgressReportGranularity = 10000;
   if (control_ != nullptr &&
       (force || progress_counter_ % kProgressReportGranularity == 0)) {
@@ -2205,6 +2349,19 @@ class OutputStreamWriter {
     }
   }
   void AddNumber(unsigned n) { AddNumberImpl<unsigned>(n, "%u"); }
+  void AddByte(uint8_t b) {
+    DCHECK(chunk_pos_ < chunk_size_);
+    chunk_[chunk_pos_++] = static_cast<char>(b);
+    MaybeWriteChunk();
+  }
+  // Unsigned LEB128.
+  void AddVarint(uint64_t n) {
+    while (n >= 0x80) {
+      AddByte(static_cast<uint8_t>(n | 0x80));
+      n >>= 7;
+    }
+    AddByte(static_cast<uint8_t>(n));
+  }
   void Finalize() {
     if (aborted_) return;
     DCHECK(chunk_pos_ < chunk_size_);
@@ -2758,5 +2915,115 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+HeapSnapshotBinarySerializer::HeapSnapshotBinarySerializer(
+    v8::OutputStream* stream)
+    : writer_(new OutputStreamWriter(stream)) {}
+
+HeapSnapshotBinarySerializer::~HeapSnapshotBinarySerializer() = default;
+
+bool HeapSnapshotBinarySerializer::aborted() const {
+  return writer_->aborted();
+}
+
+void HeapSnapshotBinarySerializer::Serialize(HeapSnapshot* snapshot) {
+  DCHECK(snapshot->is_complete());
+  WriteHeader();
+  for (const HeapGraphEdge* edge : snapshot->children()) {
+    bool indexed = edge->type() == HeapGraphEdge::kElement ||
+                   edge->type() == HeapGraphEdge::kHidden;
+    if (indexed) {
+      WriteIndexedEdge(edge->type(), edge->from(), edge->index(), edge->to());
+    } else {
+      WriteNamedEdge(edge->type(), edge->from(), edge->name(), edge->to());
+    }
+    if (writer_->aborted()) return;
+  }
+  WriteNodesAndFinalize(snapshot);
+}
+
+void HeapSnapshotBinarySerializer::WriteHeader() {
+  writer_->AddString("V8HS");
+  writer_->AddVarint(1);  // Format version.
+}
+
+void HeapSnapshotBinarySerializer::WriteNamedEdge(HeapGraphEdge::Type type,
+                                                  const HeapEntry* from,
+                                                  const char* name,
+                                                  const HeapEntry* to) {
+  if (writer_->aborted()) return;
+  WriteEdge(type, from->index(), GetStringId(name), to->index());
+}
+
+void HeapSnapshotBinarySerializer::WriteIndexedEdge(HeapGraphEdge::Type type,
+                                                    const HeapEntry* from,
+                                                    int index,
+                                                    const HeapEntry* to) {
+  if (writer_->aborted()) return;
+  WriteEdge(type, from->index(), static_cast<uint32_t>(index), to->index());
+}
+
+void HeapSnapshotBinarySerializer::WriteEdge(HeapGraphEdge::Type type,
+                                             int from, uint32_t name_or_index,
+                                             int to) {
+  writer_->AddByte(kEdgeRecord);
+  writer_->AddVarint(type);
+  writer_->AddVarint(from);
+  writer_->AddVarint(to);
+  writer_->AddVarint(name_or_index);
+  ++edge_count_;
+}
+
+void HeapSnapshotBinarySerializer::WriteNodesAndFinalize(
+    HeapSnapshot* snapshot) {
+  if (writer_->aborted()) return;
+  for (const HeapEntry& entry : snapshot->entries()) {
+    WriteNode(&entry);
+    if (writer_->aborted()) return;
+  }
+  for (const SourceLocation& location : snapshot->locations()) {
+    WriteLocation(location);
+    if (writer_->aborted()) return;
+  }
+  writer_->AddByte(kEndRecord);
+  writer_->AddVarint(snapshot->entries().size());
+  writer_->AddVarint(edge_count_);
+  writer_->Finalize();
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  auto it = strings_.find(s);
+  if (it != strings_.end()) return it->second;
+  uint32_t id = static_cast<uint32_t>(strings_.size());
+  strings_.emplace(s, id);
+  size_t length = strlen(s);
+  DCHECK_GE(kMaxInt, length);
+  writer_->AddByte(kStringRecord);
+  writer_->AddVarint(id);
+  writer_->AddVarint(length);
+  writer_->AddSubstring(s, static_cast<int>(length));
+  return id;
+}
+
+void HeapSnapshotBinarySerializer::WriteNode(const HeapEntry* entry) {
+  uint32_t name_id = GetStringId(entry->name());
+  writer_->AddByte(kNodeRecord);
+  writer_->AddVarint(entry->index());
+  writer_->AddVarint(entry->type());
+  writer_->AddVarint(name_id);
+  writer_->AddVarint(entry->id());
+  writer_->AddVarint(entry->self_size());
+  writer_->AddVarint(entry->trace_node_id());
+  writer_->AddVarint(entry->detachedness());
+}
+
+void HeapSnapshotBinarySerializer::WriteLocation(
+    const SourceLocation& location) {
+  writer_->AddByte(kLocationRecord);
+  writer_->AddVarint(location.entry_index);
+  writer_->AddVarint(location.scriptId);
+  writer_->AddVarint(location.line);
+  writer_->AddVarint(location.col);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -30,6 +30,7 @@ class AllocationTraceNode;
 class HeapEntry;
 class HeapProfiler;
 class HeapSnapshot;
+class HeapSnapshotBinarySerializer;
 class HeapSnapshotGenerator;
 class JSArrayBuffer;
 class JSCollection;
@@ -207,6 +208,14 @@ class HeapSnapshot {
     return max_snapshot_js_object_id_;
   }
   bool is_complete() const { return !children_.empty(); }
+  // When set, edges are handed to the serializer as they are discovered
+  // instead of being recorded in |edges_|.
+  HeapSnapshotBinarySerializer* stream_serializer() const {
+    return stream_serializer_;
+  }
+  void set_stream_serializer(HeapSnapshotBinarySerializer* serializer) {
+    stream_serializer_ = serializer;
+  }
   bool treat_global_objects_as_roots() const {
     return treat_global_objects_as_roots_;
   }
@@ -241,6 +250,7 @@ class HeapSnapshot {
   std::unordered_map<SnapshotObjectId, HeapEntry*> entries_by_id_cache_;
   std::vector<SourceLocation> locations_;
   SnapshotObjectId max_snapshot_js_object_id_ = -1;
+  HeapSnapshotBinarySerializer* stream_serializer_ = nullptr;
   bool treat_global_objects_as_roots_;
 
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshot);
@@ -353,7 +363,32 @@ class V8_EXPORT_PRIVATE V8HeapExplorer : public HeapEntriesAllocator {
   static String GetConstructorName(JSObject object);
 
  private:
+  // An object whose unvisited fields still have to be reported as hidden
+  // references. Its visited fields are
+  // visited_field_indices_[visited_begin, next object's visited_begin).
+  struct PendingObject {
+    HeapObject object;
+    HeapEntry* entry;
+    size_t visited_begin;
+  };
+  // A hidden reference found off the main thread. |to| is null if the child
+  // had no entry yet; the main thread adds it when merging.
+  struct HiddenReference {
+    HeapEntry* from;
+    HeapEntry* to;
+    HeapObject to_object;
+    int index;
+  };
+  struct HiddenReferencesChunk {
+    size_t begin;
+    size_t end;
+    std::vector<HiddenReference> references;
+  };
+
   void MarkVisitedField(int offset);
+  bool ExtractPendingHiddenReferences();
+  void ExtractHiddenReferences(HiddenReferencesChunk* chunk,
+                               std::vector<bool>* visited_fields);
 
   HeapEntry* AddEntry(HeapObject object);
   HeapEntry* AddEntry(HeapObject object, HeapEntry::Type type,
@@ -419,7 +454,8 @@ class V8_EXPORT_PRIVATE V8HeapExplorer : public HeapEntriesAllocator {
   void SetInternalReference(HeapEntry* parent_entry, int index, Object child,
                             int field_offset = -1);
   void SetHiddenReference(HeapObject parent_obj, HeapEntry* parent_entry,
-                          int index, Object child, int field_offset);
+                          int index, HeapObject child, int field_offset,
+                          std::vector<HiddenReference>* references);
   void SetWeakReference(HeapEntry* parent_entry, const char* reference_name,
                         Object child_obj, int field_offset);
   void SetWeakReference(HeapEntry* parent_entry, int index, Object child_obj,
@@ -459,7 +495,10 @@ class V8_EXPORT_PRIVATE V8HeapExplorer : public HeapEntriesAllocator {
   v8::HeapProfiler::ObjectNameResolver* global_object_name_resolver_;
 
   std::vector<bool> visited_fields_;
+  std::vector<int> visited_field_indices_;
+  std::vector<PendingObject> pending_objects_;
 
+  friend class HiddenReferencesJob;
   friend class IndexedReferencesExtractor;
   friend class RootsReferencesExtractor;
 
@@ -595,6 +634,53 @@ class HeapSnapshotJSONSerializer {
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshotJSONSerializer);
 };
 
+// Writes snapshots in the v8::HeapSnapshot::kBinary format. Records refer to
+// nodes by index and to strings emitted earlier in the stream, so nothing has
+// to be buffered beyond the output chunk: while a snapshot is being generated
+// with this serializer installed as its stream serializer, edges go straight
+// to the stream, and nodes follow once the traversal is done.
+class HeapSnapshotBinarySerializer {
+ public:
+  explicit HeapSnapshotBinarySerializer(v8::OutputStream* stream);
+  ~HeapSnapshotBinarySerializer();
+
+  // Serializes a complete snapshot.
+  void Serialize(HeapSnapshot* snapshot);
+
+  // Incremental interface used for streaming snapshots.
+  void WriteHeader();
+  void WriteNamedEdge(HeapGraphEdge::Type type, const HeapEntry* from,
+                      const char* name, const HeapEntry* to);
+  void WriteIndexedEdge(HeapGraphEdge::Type type, const HeapEntry* from,
+                        int index, const HeapEntry* to);
+  // Writes nodes and locations of |snapshot| and ends the stream.
+  void WriteNodesAndFinalize(HeapSnapshot* snapshot);
+  bool aborted() const;
+
+ private:
+  enum RecordTag : uint8_t {
+    kEndRecord = 0,
+    kStringRecord = 1,
+    kNodeRecord = 2,
+    kEdgeRecord = 3,
+    kLocationRecord = 4
+  };
+
+  // Returns the id of |s|, writing a string record first if it is new.
+  // Names come interned from StringsStorage, so strings are keyed by address.
+  uint32_t GetStringId(const char* s);
+  void WriteEdge(HeapGraphEdge::Type type, int from, uint32_t name_or_index,
+                 int to);
+  void WriteNode(const HeapEntry* entry);
+  void WriteLocation(const SourceLocation& location);
+
+  std::unique_ptr<OutputStreamWriter> writer_;
+  std::unordered_map<const char*, uint32_t> strings_;
+  uint32_t edge_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotBinarySerializer);
+};
+
 
 }  // namespace internal
 }  // namespace v8
@@ -804,6 +804,13 @@ int64_t GreatestCommonDivisor(int64_t a, int64_t b) {
 
 }  // namespace
 
+bool CpuProfilesCollection::HasCurrentProfiles() {
+  current_profiles_semaphore_.Wait();
+  bool result = !current_profiles_.empty();
+  current_profiles_semaphore_.Signal();
+  return result;
+}
+
 base::TimeDelta CpuProfilesCollection::GetCommonSamplingInterval() const {
   DCHECK(profiler_);
 
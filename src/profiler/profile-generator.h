@@ -455,6 +455,7 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   }
   const char* GetName(Name name) { return resource_names_.GetName(name); }
   bool IsLastProfile(const char* title);
+  bool HasCurrentProfiles();
   void RemoveProfile(CpuProfile* profile);
 
   // Finds a common sampling interval dividing each CpuProfile's interval,
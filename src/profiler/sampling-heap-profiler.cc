@@ -85,8 +85,8 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
+  auto sample = std::make_unique<Sample>(size, node, loc, this,
+                                         next_sample_id(), CurrentContextId());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
   samples_.emplace(sample.get(), std::move(sample));
@@ -128,10 +128,37 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
   return parent->AddChildNode(id, std::move(new_child));
 }
 
+SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
+    AllocationNode* parent, SharedFunctionInfo shared) {
+  if (!shared.script().IsScript()) {
+    return FindOrAddChildNode(parent, names()->GetName(shared.DebugName()),
+                              v8::UnboundScript::kNoScriptId,
+                              shared.StartPosition());
+  }
+  // Functions with a script are identified by their position, so the name
+  // is only looked up when a node is created for them.
+  int script_id = Script::cast(shared.script()).id();
+  int start_position = shared.StartPosition();
+  AllocationNode::FunctionId id =
+      AllocationNode::function_id(script_id, start_position, nullptr);
+  AllocationNode* child = parent->FindChildNode(id);
+  if (child) return child;
+  auto new_child = std::make_unique<AllocationNode>(
+      parent, names()->GetName(shared.DebugName()), script_id, start_position,
+      next_node_id());
+  return parent->AddChildNode(id, std::move(new_child));
+}
+
+int SamplingHeapProfiler::CurrentContextId() const {
+  if (isolate_->context().is_null()) return 0;
+  Object id = isolate_->context().native_context().debug_context_id();
+  return id.IsSmi() ? Smi::ToInt(id) : 0;
+}
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   AllocationNode* node = &profile_root_;
 
-  std::vector<SharedFunctionInfo> stack;
+  stack_.clear();
   JavaScriptFrameIterator it(isolate_);
   int frames_captured = 0;
   bool found_arguments_marker_frames = false;
@@ -144,7 +171,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
     // sensitive moment belong to the formerly optimized frame anyway.
     if (frame->unchecked_function().IsJSFunction()) {
       SharedFunctionInfo shared = frame->function().shared();
-      stack.push_back(shared);
+      stack_.push_back(shared);
       frames_captured++;
     } else {
       found_arguments_marker_frames = true;
@@ -188,15 +215,8 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
 
   // We need to process the stack in reverse order as the top of the stack is
   // the first element in the list.
-  for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-    SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetName(shared.DebugName());
-    int script_id = v8::UnboundScript::kNoScriptId;
-    if (shared.script().IsScript()) {
-      Script script = Script::cast(shared.script());
-      script_id = script.id();
-    }
-    node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
+  for (auto it = stack_.rbegin(); it != stack_.rend(); ++it) {
+    node = FindOrAddChildNode(node, *it);
   }
 
   if (found_arguments_marker_frames) {
@@ -287,7 +307,7 @@ SamplingHeapProfiler::BuildSamples() const {
     const Sample* sample = it.second.get();
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id, sample->context_id});
   }
   return samples;
 }
@@ -101,17 +101,20 @@ class SamplingHeapProfiler {
 
   struct Sample {
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
+           SamplingHeapProfiler* profiler_, uint64_t sample_id,
+           int context_id)
         : size(size_),
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          context_id(context_id) {}
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    const int context_id;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -163,6 +166,9 @@ class SamplingHeapProfiler {
 
   AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
                                      int script_id, int start_position);
+  AllocationNode* FindOrAddChildNode(AllocationNode* parent,
+                                     SharedFunctionInfo shared);
+  int CurrentContextId() const;
   static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
 
   uint32_t next_node_id() { return ++last_node_id_; }
@@ -190,6 +196,8 @@ class SamplingHeapProfiler {
   StringsStorage* const names_;
   AllocationNode profile_root_;
   std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Scratch space for AddStack(), which runs on every sample.
+  std::vector<SharedFunctionInfo> stack_;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
@@ -186,5 +186,28 @@ Symbolizer::SymbolizedSample Symbolizer::SymbolizeTickSample(
   return SymbolizedSample{stack_trace, src_line};
 }
 
+int Symbolizer::SymbolizeStack(const TickSample& sample, CodeEntry** frames) {
+  int length = 0;
+  if (sample.pc != nullptr) {
+    CodeEntry* pc_entry;
+    if (sample.has_external_callback && sample.state == EXTERNAL) {
+      pc_entry =
+          FindEntry(reinterpret_cast<Address>(sample.external_callback_entry));
+    } else {
+      pc_entry = FindEntry(reinterpret_cast<Address>(sample.pc));
+      if (!pc_entry && !sample.has_external_callback) {
+        pc_entry = FindEntry(reinterpret_cast<Address>(sample.tos));
+      }
+    }
+    if (pc_entry) frames[length++] = pc_entry;
+    for (unsigned i = 0; i < sample.frames_count; ++i) {
+      CodeEntry* entry = FindEntry(reinterpret_cast<Address>(sample.stack[i]));
+      if (entry) frames[length++] = entry;
+    }
+  }
+  if (length == 0) frames[length++] = EntryForVMState(sample.state);
+  return length;
+}
+
 }  // namespace internal
 }  // namespace v8
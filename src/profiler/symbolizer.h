@@ -27,6 +27,11 @@ class V8_EXPORT_PRIVATE Symbolizer {
   // code/function names.
   SymbolizedSample SymbolizeTickSample(const TickSample& sample);
 
+  // Like SymbolizeTickSample, but without inlined frames and line numbers and
+  // without allocating. |frames| needs room for TickSample::kMaxFramesCount
+  // + 1 entries. Returns the number of frames, leaf first.
+  int SymbolizeStack(const TickSample& sample, CodeEntry** frames);
+
   CodeMap* code_map() { return code_map_; }
 
  private:
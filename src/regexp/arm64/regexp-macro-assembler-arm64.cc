@@ -709,6 +709,74 @@ bool RegExpMacroAssemblerARM64::CheckSpecialCharacterClass(uc16 type,
   }
 }
 
+bool RegExpMacroAssemblerARM64::SkipUntilCharacterAfterAnd(uc16 c,
+                                                           uc16 and_with,
+                                                           int cp_offset) {
+  DCHECK_LE(0, cp_offset);
+  DCHECK_EQ(c, c & and_with);
+  // Compare 16 bytes at a time with NEON. The last few characters before the
+  // end of the input are looked at one at a time to avoid reading past the end
+  // of the string.
+  if (mode_ == LATIN1) {
+    if (c > String::kMaxOneByteCharCode) return false;
+    and_with &= String::kMaxOneByteCharCode;
+  }
+  Label vector_loop, scalar_loop, done;
+  // w10 holds the offset of the character to look at, relative to input_end.
+  __ Add(w10, current_input_offset(), cp_offset * char_size());
+  __ Mov(w11, c);
+  __ Mov(w12, and_with);
+  if (mode_ == LATIN1) {
+    __ Dup(v0.V16B(), w11);
+    __ Dup(v1.V16B(), w12);
+  } else {
+    __ Dup(v0.V8H(), w11);
+    __ Dup(v1.V8H(), w12);
+  }
+
+  __ Bind(&vector_loop);
+  __ Cmp(w10, -kQRegSize);
+  __ B(gt, &scalar_loop);
+  __ Add(x13, input_end(), Operand(w10, SXTW));
+  __ Ld1(v2.V16B(), MemOperand(x13));
+  __ And(v2.V16B(), v2.V16B(), v1.V16B());
+  if (mode_ == LATIN1) {
+    __ Cmeq(v2.V16B(), v2.V16B(), v0.V16B());
+  } else {
+    __ Cmeq(v2.V8H(), v2.V8H(), v0.V8H());
+  }
+  // Narrow the comparison result to four bits per byte, so that it fits into a
+  // general purpose register.
+  __ Shrn(v2.V8B(), v2.V8H(), 4);
+  __ Fmov(x13, v2.D());
+  __ Add(w10, w10, kQRegSize);
+  __ Cbz(x13, &vector_loop);
+  // The number of trailing zero bits divided by four is the byte offset of the
+  // first match in the vector.
+  __ Rbit(x13, x13);
+  __ Clz(x13, x13);
+  __ Add(w10, w10, Operand(w13, LSR, 2));
+  __ Sub(w10, w10, kQRegSize);
+  __ B(&done);
+
+  __ Bind(&scalar_loop);
+  __ Tbz(w10, kWSignBit, &done);
+  if (mode_ == LATIN1) {
+    __ Ldrb(w11, MemOperand(input_end(), w10, SXTW));
+  } else {
+    __ Ldrh(w11, MemOperand(input_end(), w10, SXTW));
+  }
+  __ And(w11, w11, and_with);
+  __ Cmp(w11, c);
+  __ B(eq, &done);
+  __ Add(w10, w10, char_size());
+  __ B(&scalar_loop);
+
+  __ Bind(&done);
+  __ Sub(current_input_offset(), w10, cp_offset * char_size());
+  return true;
+}
+
 
 void RegExpMacroAssemblerARM64::Fail() {
   __ Mov(w0, FAILURE);
@@ -65,6 +65,8 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
   virtual bool CheckSpecialCharacterClass(uc16 type,
                                           Label* on_no_match);
+  virtual bool SkipUntilCharacterAfterAnd(uc16 c, uc16 and_with,
+                                          int cp_offset);
   virtual void BindJumpTarget(Label* label = nullptr);
   virtual void Fail();
   virtual Handle<HeapObject> GetCode(Handle<String> source);
@@ -32,6 +32,17 @@ std::ostream& operator<<(std::ostream& os, const RegExpInstruction& inst) {
       os << "]";
       break;
     }
+    case RegExpInstruction::CHECK_RANGE_AT: {
+      os << "CHECK_RANGE_AT " << std::dec << inst.offset << " [";
+      PrintAsciiOrHex(os, inst.payload.check_range.min);
+      os << ", ";
+      PrintAsciiOrHex(os, inst.payload.check_range.max);
+      os << "]";
+      break;
+    }
+    case RegExpInstruction::CHECK_OUT_OF_BOUNDS_AT:
+      os << "CHECK_OUT_OF_BOUNDS_AT " << std::dec << inst.offset;
+      break;
     case RegExpInstruction::ASSERTION:
       os << "ASSERTION ";
       switch (inst.payload.assertion_type) {
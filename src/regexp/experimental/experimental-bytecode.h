@@ -36,6 +36,16 @@
 //   contained in a non-empty closed interval [min, max] specified in the
 //   instruction payload.  Abort this thread if false, otherwise advance the
 //   input position by 1 and continue with the next instruction.
+// - CHECK_RANGE_AT: Check whether the input position obtained by adding the
+//   offset specified in the instruction to the current input position is
+//   within the input, and whether the character at that position is contained
+//   in the closed interval [min, max] specified in the payload.  Abort this
+//   thread if false, otherwise continue with the next instruction without
+//   changing the input position.
+// - CHECK_OUT_OF_BOUNDS_AT: Check whether the input position obtained by adding
+//   the offset specified in the instruction to the current input position is
+//   outside of the input.  Abort this thread if false, otherwise continue with
+//   the next instruction.
 // - ACCEPT: Stop this thread and signify the end of a match at the current
 //   input position.
 // - FORK: If executed by a thread t, spawn a new thread t0 whose register
@@ -88,12 +98,15 @@ namespace v8 {
 namespace internal {
 
 // Bytecode format.
-// Currently very simple fixed-size: The opcode is encoded in the first 4
-// bytes, the payload takes another 4 bytes.
+// Currently very simple fixed-size: The opcode is encoded in the first 2
+// bytes, followed by 2 bytes for the input offset of CHECK_RANGE_AT and
+// CHECK_OUT_OF_BOUNDS_AT.  The payload takes another 4 bytes.
 struct RegExpInstruction {
-  enum Opcode : int32_t {
+  enum Opcode : int16_t {
     ACCEPT,
     ASSERTION,
+    CHECK_OUT_OF_BOUNDS_AT,
+    CHECK_RANGE_AT,
     CLEAR_REGISTER,
     CONSUME_RANGE,
     FORK,
@@ -123,6 +136,21 @@ struct RegExpInstruction {
     return ConsumeRange(0xFFFF, 0x0000);
   }
 
+  static RegExpInstruction CheckRangeAt(int16_t offset, uc16 min, uc16 max) {
+    RegExpInstruction result;
+    result.opcode = CHECK_RANGE_AT;
+    result.offset = offset;
+    result.payload.check_range = Uc16Range{min, max};
+    return result;
+  }
+
+  static RegExpInstruction CheckOutOfBoundsAt(int16_t offset) {
+    RegExpInstruction result;
+    result.opcode = CHECK_OUT_OF_BOUNDS_AT;
+    result.offset = offset;
+    return result;
+  }
+
   static RegExpInstruction Fork(int32_t alt_index) {
     RegExpInstruction result;
     result.opcode = FORK;
@@ -165,9 +193,14 @@ struct RegExpInstruction {
   }
 
   Opcode opcode;
+  // The input position inspected by CHECK_RANGE_AT and CHECK_OUT_OF_BOUNDS_AT,
+  // relative to the current input position.  Unused by other instructions.
+  int16_t offset = 0;
   union {
     // Payload of CONSUME_RANGE:
     Uc16Range consume_range;
+    // Payload of CHECK_RANGE_AT:
+    Uc16Range check_range;
     // Payload of FORK and JMP, the next/forked program counter (pc):
     int32_t pc;
     // Payload of SET_REGISTER_TO_CP and CLEAR_REGISTER:
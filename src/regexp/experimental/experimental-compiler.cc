@@ -4,7 +4,9 @@
 
 #include "src/regexp/experimental/experimental-compiler.h"
 
+#include "src/base/bounds.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/strings/unicode.h"
 #include "src/zone/zone-list-inl.h"
 
 namespace v8 {
@@ -12,10 +14,104 @@ namespace internal {
 
 namespace {
 
-// TODO(mbid, v8:10765): Currently the experimental engine doesn't support
-// UTF-16, but this shouldn't be too hard to implement.
+// Without the unicode flag, the input is matched code unit by code unit, so
+// character classes only need to be compiled up to the largest code unit.
 constexpr uc32 kMaxSupportedCodepoint = 0xFFFFu;
 
+constexpr uc16 kLeadSurrogateMin = 0xD800;
+constexpr uc16 kLeadSurrogateMax = 0xDBFF;
+constexpr uc16 kTrailSurrogateMin = 0xDC00;
+constexpr uc16 kTrailSurrogateMax = 0xDFFF;
+constexpr uc32 kNonBmpMin = 0x10000;
+
+// The maximal number of code units a lookaround body can match.  See
+// `FixedLookaroundLength`.
+constexpr int kMaxLookaroundLength = 16;
+
+bool IsUnicode(JSRegExp::Flags flags) {
+  return (flags & JSRegExp::kUnicode) != 0;
+}
+
+// Lookarounds are supported if their body matches a fixed number of code
+// units, each drawn from a set of (in unicode mode: non-surrogate) BMP
+// characters.  Such a lookaround is compiled into checks of the input at fixed
+// offsets from the current position, so it doesn't need an automaton of its
+// own.  Returns the number of code units matched by `tree`, or -1 if `tree` is
+// not of this form.
+int FixedLookaroundLength(RegExpTree* tree) {
+  if (tree->IsEmpty()) return 0;
+  if (tree->IsAtom()) {
+    RegExpAtom* atom = tree->AsAtom();
+    if (IsUnicode(atom->flags())) {
+      for (uc16 c : atom->data()) {
+        if (unibrow::Utf16::IsLeadSurrogate(c) ||
+            unibrow::Utf16::IsTrailSurrogate(c)) {
+          return -1;
+        }
+      }
+    }
+    return atom->length();
+  }
+  if (tree->IsCharacterClass()) {
+    RegExpCharacterClass* cc = tree->AsCharacterClass();
+    if (!IsUnicode(cc->flags())) return 1;
+    // In unicode mode, the class must not contain surrogates or astral
+    // codepoints, which rules out negated classes.
+    if (cc->is_negated()) return -1;
+    switch (cc->standard_type()) {
+      case 0:
+        break;
+      case 'd':
+      case 's':
+      case 'w':
+        return 1;
+      default:
+        return -1;
+    }
+    for (const CharacterRange& range : *cc->ranges(nullptr)) {
+      if (range.to() > kMaxSupportedCodepoint) return -1;
+      if (range.from() <= kTrailSurrogateMax &&
+          range.to() >= kLeadSurrogateMin) {
+        return -1;
+      }
+    }
+    return 1;
+  }
+  int length = 0;
+  auto add = [&](RegExpTree* child, int repetitions) {
+    int child_length = FixedLookaroundLength(child);
+    if (length < 0 || child_length < 0) {
+      length = -1;
+    } else if (repetitions > kMaxLookaroundLength ||
+               child_length * repetitions > kMaxLookaroundLength - length) {
+      length = -1;
+    } else {
+      length += child_length * repetitions;
+    }
+  };
+  if (tree->IsText()) {
+    for (TextElement& el : *tree->AsText()->elements()) add(el.tree(), 1);
+    return length;
+  }
+  if (tree->IsAlternative()) {
+    for (RegExpTree* child : *tree->AsAlternative()->nodes()) add(child, 1);
+    return length;
+  }
+  if (tree->IsGroup()) {
+    add(tree->AsGroup()->body(), 1);
+    return length;
+  }
+  if (tree->IsQuantifier()) {
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() != quantifier->max()) return -1;
+    add(quantifier->body(), quantifier->min());
+    return length;
+  }
+  // Disjunctions, captures, assertions, nested lookarounds and back
+  // references.
+  return -1;
+}
+
 class CanBeHandledVisitor final : private RegExpVisitor {
   // Visitor to implement `ExperimentalRegExp::CanBeHandled`.
  public:
@@ -35,7 +131,7 @@ class CanBeHandledVisitor final : private RegExpVisitor {
     // future.
     static constexpr JSRegExp::Flags kAllowedFlags =
         JSRegExp::kGlobal | JSRegExp::kSticky | JSRegExp::kMultiline |
-        JSRegExp::kDotAll | JSRegExp::kLinear;
+        JSRegExp::kDotAll | JSRegExp::kLinear | JSRegExp::kUnicode;
     // We support Unicode iff kUnicode is among the supported flags.
     STATIC_ASSERT(ExperimentalRegExp::kSupportsUnicode ==
                   ((kAllowedFlags & JSRegExp::kUnicode) != 0));
@@ -151,9 +247,13 @@ class CanBeHandledVisitor final : private RegExpVisitor {
   }
 
   void* VisitLookaround(RegExpLookaround* node, void*) override {
-    // TODO(mbid, v8:10765): This will be hard to support, but not impossible I
-    // think.  See product automata.
-    result_ = false;
+    // TODO(mbid, v8:10765): General lookarounds will be hard to support, but
+    // not impossible I think.  See product automata.
+    if (FixedLookaroundLength(node->body()) < 0) {
+      result_ = false;
+      return nullptr;
+    }
+    node->body()->Accept(this, nullptr);
     return nullptr;
   }
 
@@ -237,6 +337,22 @@ class BytecodeAssembler {
     code_.Add(RegExpInstruction::ConsumeAnyChar(), zone_);
   }
 
+  void CheckRangeAt(int offset, uc16 from, uc16 to) {
+    DCHECK(base::IsInRange(offset, std::numeric_limits<int16_t>::min(),
+                           std::numeric_limits<int16_t>::max()));
+    code_.Add(RegExpInstruction::CheckRangeAt(static_cast<int16_t>(offset),
+                                              from, to),
+              zone_);
+  }
+
+  void CheckOutOfBoundsAt(int offset) {
+    DCHECK(base::IsInRange(offset, std::numeric_limits<int16_t>::min(),
+                           std::numeric_limits<int16_t>::max()));
+    code_.Add(
+        RegExpInstruction::CheckOutOfBoundsAt(static_cast<int16_t>(offset)),
+        zone_);
+  }
+
   void Fork(Label& target) {
     LabelledInstrImpl(RegExpInstruction::Opcode::FORK, target);
   }
@@ -303,11 +419,22 @@ class CompileVisitor : private RegExpVisitor {
     if ((flags & JSRegExp::kSticky) == 0 && !tree->IsAnchoredAtStart()) {
       // The match is not anchored, i.e. may start at any input position, so we
       // emit a preamble corresponding to /.*?/.  This skips an arbitrary
-      // prefix in the input non-greedily.
-      compiler.CompileNonGreedyStar(
-          [&]() { compiler.assembler_.ConsumeAnyChar(); });
+      // prefix in the input non-greedily.  In unicode mode the prefix consists
+      // of whole codepoints, so that matches never start in the middle of a
+      // surrogate pair.
+      compiler.CompileNonGreedyStar([&]() {
+        if (IsUnicode(flags)) {
+          compiler.CompileUnicodeRanges(
+              CharacterRange::List(zone, CharacterRange::Everything()));
+        } else {
+          compiler.assembler_.ConsumeAnyChar();
+        }
+      });
     }
 
+    // The interpreter relies on the match starting at the first
+    // SET_REGISTER_TO_CP instruction for register 0, see
+    // `NfaInterpreter::ComputeFirstCharFilter`.
     compiler.assembler_.SetRegisterToCp(0);
     tree->Accept(&compiler, nullptr);
     compiler.assembler_.SetRegisterToCp(1);
@@ -400,6 +527,11 @@ class CompileVisitor : private RegExpVisitor {
       ranges = negated;
     }
 
+    if (IsUnicode(node->flags())) {
+      CompileUnicodeRanges(ranges);
+      return nullptr;
+    }
+
     CompileDisjunction(ranges->length(), [&](int i) {
       // We don't support utf16 for now, so only ranges that can be specified
       // by (complements of) ranges with uc16 bounds.
@@ -418,6 +550,125 @@ class CompileVisitor : private RegExpVisitor {
     return nullptr;
   }
 
+  // Appends the intersections of the canonical `ranges` with [from, to] to
+  // `out`.
+  void AddIntersections(ZoneList<CharacterRange>* ranges, uc32 from, uc32 to,
+                        ZoneList<CharacterRange>* out) {
+    for (const CharacterRange& range : *ranges) {
+      uc32 intersection_from = std::max(range.from(), from);
+      uc32 intersection_to = std::min(range.to(), to);
+      if (intersection_from <= intersection_to) {
+        out->Add(CharacterRange::Range(intersection_from, intersection_to),
+                 zone_);
+      }
+    }
+  }
+
+  // Emit bytecode consuming the surrogate pair of a codepoint in the astral
+  // range [from, to].
+  void CompileSurrogatePairRange(uc32 from, uc32 to) {
+    DCHECK_LE(kNonBmpMin, from);
+    DCHECK_LE(from, to);
+    DCHECK_LE(to, String::kMaxCodePoint);
+
+    uc16 from_lead = unibrow::Utf16::LeadSurrogate(from);
+    uc16 from_trail = unibrow::Utf16::TrailSurrogate(from);
+    uc16 to_lead = unibrow::Utf16::LeadSurrogate(to);
+    uc16 to_trail = unibrow::Utf16::TrailSurrogate(to);
+
+    if (from_lead == to_lead) {
+      assembler_.ConsumeRange(from_lead, from_lead);
+      assembler_.ConsumeRange(from_trail, to_trail);
+      return;
+    }
+
+    // Otherwise the range is split into up to three alternatives: The partial
+    // range of trail surrogates following `from_lead`, the full range of trail
+    // surrogates following the leads in between, and the partial range of
+    // trail surrogates following `to_lead`.
+    struct SurrogatePairRange {
+      uc16 lead_min, lead_max, trail_min, trail_max;
+    };
+    SurrogatePairRange pairs[3];
+    int pair_num = 0;
+
+    int middle_lead_min = from_lead + 1;
+    int middle_lead_max = to_lead - 1;
+    if (from_trail == kTrailSurrogateMin) {
+      middle_lead_min = from_lead;
+    } else {
+      pairs[pair_num++] = {from_lead, from_lead, from_trail,
+                           kTrailSurrogateMax};
+    }
+    const bool partial_last = to_trail != kTrailSurrogateMax;
+    if (!partial_last) middle_lead_max = to_lead;
+    if (middle_lead_min <= middle_lead_max) {
+      pairs[pair_num++] = {static_cast<uc16>(middle_lead_min),
+                           static_cast<uc16>(middle_lead_max),
+                           kTrailSurrogateMin, kTrailSurrogateMax};
+    }
+    if (partial_last) {
+      pairs[pair_num++] = {to_lead, to_lead, kTrailSurrogateMin, to_trail};
+    }
+
+    CompileDisjunction(pair_num, [&](int i) {
+      assembler_.ConsumeRange(pairs[i].lead_min, pairs[i].lead_max);
+      assembler_.ConsumeRange(pairs[i].trail_min, pairs[i].trail_max);
+    });
+  }
+
+  // Emit bytecode consuming a single codepoint in the canonical `ranges` in
+  // unicode mode.  Codepoints outside of the BMP are consumed as surrogate
+  // pairs.  A lead surrogate only matches on its own if it is not followed by
+  // a trail surrogate.  Since threads only ever start at codepoint boundaries
+  // and consume whole codepoints, a trail surrogate at the current position
+  // is never part of a surrogate pair, so it doesn't need such a check.
+  void CompileUnicodeRanges(ZoneList<CharacterRange>* ranges) {
+    ZoneList<CharacterRange> single_units(2, zone_);
+    AddIntersections(ranges, 0, kLeadSurrogateMin - 1, &single_units);
+    AddIntersections(ranges, kTrailSurrogateMin, kMaxSupportedCodepoint,
+                     &single_units);
+    ZoneList<CharacterRange> leads(1, zone_);
+    AddIntersections(ranges, kLeadSurrogateMin, kLeadSurrogateMax, &leads);
+    ZoneList<CharacterRange> astral(1, zone_);
+    AddIntersections(ranges, kNonBmpMin, String::kMaxCodePoint, &astral);
+
+    // The alternatives are mutually exclusive, so their order doesn't matter.
+    const int lead_alt_num = leads.is_empty() ? 0 : 1;
+    const int alt_num = single_units.length() + lead_alt_num + astral.length();
+    CompileDisjunction(alt_num, [&](int i) {
+      if (i < single_units.length()) {
+        assembler_.ConsumeRange(static_cast<uc16>(single_units[i].from()),
+                                static_cast<uc16>(single_units[i].to()));
+        return;
+      }
+      i -= single_units.length();
+      if (i < lead_alt_num) {
+        CompileDisjunction(leads.length(), [&](int j) {
+          assembler_.ConsumeRange(static_cast<uc16>(leads[j].from()),
+                                  static_cast<uc16>(leads[j].to()));
+        });
+        // The next code unit must not be a trail surrogate.
+        CompileDisjunction(3, [&](int j) {
+          switch (j) {
+            case 0:
+              assembler_.CheckRangeAt(0, 0x0000, kLeadSurrogateMax);
+              break;
+            case 1:
+              assembler_.CheckRangeAt(0, kTrailSurrogateMax + 1, 0xFFFF);
+              break;
+            case 2:
+              assembler_.CheckOutOfBoundsAt(0);
+              break;
+          }
+        });
+        return;
+      }
+      i -= lead_alt_num;
+      CompileSurrogatePairRange(astral[i].from(), astral[i].to());
+    });
+  }
+
   void* VisitAtom(RegExpAtom* node, void*) override {
     for (uc16 c : node->data()) {
       assembler_.ConsumeRange(c, c);
@@ -601,9 +852,113 @@ class CompileVisitor : private RegExpVisitor {
     return nullptr;
   }
 
+  // Restricts the canonical `ranges` to the BMP.
+  static void ClampToBmp(ZoneList<CharacterRange>* ranges) {
+    while (!ranges->is_empty() &&
+           ranges->last().from() > kMaxSupportedCodepoint) {
+      ranges->RemoveLast();
+    }
+    if (!ranges->is_empty() && ranges->last().to() > kMaxSupportedCodepoint) {
+      ranges->last().set_to(kMaxSupportedCodepoint);
+    }
+  }
+
+  // Appends the sets of code units matched by the lookaround body `tree` to
+  // `units`, one canonical list of BMP ranges per code unit.  `tree` must
+  // satisfy `FixedLookaroundLength(tree) >= 0`.
+  void CollectLookaroundUnits(RegExpTree* tree,
+                              ZoneList<ZoneList<CharacterRange>*>* units) {
+    if (tree->IsAtom()) {
+      for (uc16 c : tree->AsAtom()->data()) {
+        units->Add(CharacterRange::List(zone_, CharacterRange::Singleton(c)),
+                   zone_);
+      }
+    } else if (tree->IsCharacterClass()) {
+      RegExpCharacterClass* cc = tree->AsCharacterClass();
+      ZoneList<CharacterRange>* ranges = cc->ranges(zone_);
+      CharacterRange::Canonicalize(ranges);
+      if (cc->is_negated()) {
+        ZoneList<CharacterRange>* negated =
+            zone_->New<ZoneList<CharacterRange>>(ranges->length() + 1, zone_);
+        CharacterRange::Negate(ranges, negated, zone_);
+        ranges = negated;
+      } else {
+        // Don't clamp the ranges shared with the tree.
+        ranges = zone_->New<ZoneList<CharacterRange>>(*ranges, zone_);
+      }
+      ClampToBmp(ranges);
+      units->Add(ranges, zone_);
+    } else if (tree->IsText()) {
+      for (TextElement& el : *tree->AsText()->elements()) {
+        CollectLookaroundUnits(el.tree(), units);
+      }
+    } else if (tree->IsAlternative()) {
+      for (RegExpTree* child : *tree->AsAlternative()->nodes()) {
+        CollectLookaroundUnits(child, units);
+      }
+    } else if (tree->IsGroup()) {
+      CollectLookaroundUnits(tree->AsGroup()->body(), units);
+    } else if (tree->IsQuantifier()) {
+      RegExpQuantifier* quantifier = tree->AsQuantifier();
+      DCHECK_EQ(quantifier->min(), quantifier->max());
+      for (int i = 0; i != quantifier->min(); ++i) {
+        CollectLookaroundUnits(quantifier->body(), units);
+      }
+    } else {
+      DCHECK(tree->IsEmpty());
+    }
+  }
+
+  // Emit bytecode checking that the code unit at `offset` relative to the
+  // current position is contained in the canonical BMP `ranges`.
+  void CompileCheckRangesAt(int offset, ZoneList<CharacterRange>* ranges) {
+    CompileDisjunction(ranges->length(), [&](int i) {
+      assembler_.CheckRangeAt(offset, static_cast<uc16>((*ranges)[i].from()),
+                              static_cast<uc16>((*ranges)[i].to()));
+    });
+  }
+
   void* VisitLookaround(RegExpLookaround* node, void*) override {
-    // TODO(mbid,v8:10765): Support this case.
-    UNREACHABLE();
+    // Only lookarounds matching a fixed number of code units are supported,
+    // see `FixedLookaroundLength`.  These are compiled into checks of the
+    // input at fixed offsets from the current position.
+    DCHECK_GE(FixedLookaroundLength(node->body()), 0);
+    ZoneList<ZoneList<CharacterRange>*> units(4, zone_);
+    CollectLookaroundUnits(node->body(), &units);
+    const int length = units.length();
+    DCHECK_LE(length, kMaxLookaroundLength);
+
+    // The offset of the first code unit of the body.
+    const int first_offset =
+        node->type() == RegExpLookaround::LOOKAHEAD ? 0 : -length;
+
+    if (node->is_positive()) {
+      for (int i = 0; i != length; ++i) {
+        CompileCheckRangesAt(first_offset + i, units[i]);
+      }
+      return nullptr;
+    }
+
+    // A negative lookaround succeeds iff the body would extend beyond the
+    // input or one of its code units doesn't match.
+    if (length == 0) {
+      assembler_.Fail();
+      return nullptr;
+    }
+    const int farthest_offset =
+        node->type() == RegExpLookaround::LOOKAHEAD ? length - 1 : -length;
+    CompileDisjunction(length + 1, [&](int i) {
+      if (i == length) {
+        assembler_.CheckOutOfBoundsAt(farthest_offset);
+        return;
+      }
+      ZoneList<CharacterRange>* complement =
+          zone_->New<ZoneList<CharacterRange>>(units[i]->length() + 1, zone_);
+      CharacterRange::Negate(units[i], complement, zone_);
+      ClampToBmp(complement);
+      CompileCheckRangesAt(first_offset + i, complement);
+    });
+    return nullptr;
   }
 
   void* VisitBackReference(RegExpBackReference* node, void*) override {
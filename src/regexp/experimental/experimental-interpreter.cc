@@ -5,11 +5,13 @@
 #include "src/regexp/experimental/experimental-interpreter.h"
 
 #include "src/base/optional.h"
+#include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone-list-inl.h"
 
 namespace v8 {
@@ -134,10 +136,12 @@ class NfaInterpreter {
   // ACCEPTing thread with highest priority.
  public:
   NfaInterpreter(Isolate* isolate, RegExp::CallOrigin call_origin,
-                 ByteArray bytecode, int register_count_per_match, String input,
+                 ByteArray bytecode, JSRegExp::Flags flags,
+                 int register_count_per_match, String input,
                  int32_t input_index, Zone* zone)
       : isolate_(isolate),
         call_origin_(call_origin),
+        unicode_((flags & JSRegExp::kUnicode) != 0),
         bytecode_object_(bytecode),
         bytecode_(ToInstructionVector(bytecode, no_gc_)),
         register_count_per_match_(register_count_per_match),
@@ -149,13 +153,37 @@ class NfaInterpreter {
         active_threads_(0, zone),
         blocked_threads_(0, zone),
         register_array_allocator_(zone),
+        first_char_ranges_(0, zone),
         best_match_registers_(base::nullopt),
+        dfa_states_(zone),
+        dfa_state_ids_(zone),
+        dfa_char_class_bounds_(zone),
+        dfa_starts_(zone),
+        dfa_next_starts_(zone),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
     DCHECK_LE(input_index_, input_.length());
 
+    // In unicode mode, a match can't start in the middle of a surrogate pair.
+    // Like Irregexp, we step back to the lead surrogate in this case.
+    if (unicode_ && input_index_ > 0 && input_index_ < input_.length() &&
+        unibrow::Utf16::IsSurrogatePair(input_[input_index_ - 1],
+                                        input_[input_index_])) {
+      --input_index_;
+    }
+
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+
+    ComputeFirstCharFilter();
+
+    use_dfa_ = FLAG_experimental_regexp_engine_lazy_dfa && IsDfaCompatible();
+    if (use_dfa_) {
+      ComputeDfaCharClasses();
+      dfa_pc_last_step_ = Vector<int>(zone->NewArray<int>(bytecode_.length()),
+                                      bytecode_.length());
+      std::fill(dfa_pc_last_step_.begin(), dfa_pc_last_step_.end(), 0);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -191,13 +219,15 @@ class NfaInterpreter {
         break;
       } else {
         // Zero-length match, more input.  We don't want to report more matches
-        // here endlessly, so we advance by 1.
-        SetInputIndex(match_end + 1);
-
-        // TODO(mbid,v8:10765): If we're in unicode mode, we have to advance to
-        // the next codepoint, not to the next code unit. See also
-        // `RegExpUtils::AdvanceStringIndex`.
-        STATIC_ASSERT(!ExperimentalRegExp::kSupportsUnicode);
+        // here endlessly, so we advance by 1, or to the next codepoint in
+        // unicode mode.  See also `RegExpUtils::AdvanceStringIndex`.
+        int next_index = match_end + 1;
+        if (unicode_ && next_index < input_.length() &&
+            unibrow::Utf16::IsSurrogatePair(input_[match_end],
+                                            input_[next_index])) {
+          ++next_index;
+        }
+        SetInputIndex(next_index);
       }
     }
 
@@ -294,6 +324,20 @@ class NfaInterpreter {
   // execution could finish regularly (with or without a match) and an error
   // code due to interrupt otherwise.
   int FindNextMatch() {
+    if (use_dfa_) {
+      const int search_start = input_index_;
+      int err_code;
+      if (FindNextMatchDfa(&err_code)) return err_code;
+      // The DFA exceeded its memory budget.  Redo the search with the NFA,
+      // which has linear runtime regardless of the number of DFA states the
+      // input would visit.
+      use_dfa_ = false;
+      SetInputIndex(search_start);
+    }
+    return FindNextMatchNfa();
+  }
+
+  int FindNextMatchNfa() {
     DCHECK(active_threads_.is_empty());
     // TODO(mbid,v8:10765): Can we get around resetting `pc_last_input_index_`
     // here? As long as
@@ -334,14 +378,24 @@ class NfaInterpreter {
 
     // We stop if one of the following conditions hold:
     // - We have exhausted the entire input.
-    // - We have found a match at some point, and there are no remaining
-    //   threads with higher priority than the thread that produced the match.
-    //   Threads with low priority have been aborted earlier, and the remaining
-    //   threads are blocked here, so the latter simply means that
-    //   `blocked_threads_` is empty.
-    while (input_index_ != input_.length() &&
-           !(FoundMatch() && blocked_threads_.is_empty())) {
+    // - There are no blocked threads left.  If we have found a match at some
+    //   point, this means that there are no remaining threads with higher
+    //   priority than the thread that produced the match.  (Threads with low
+    //   priority have been aborted earlier, and the remaining threads are
+    //   blocked here.)  Otherwise no thread can produce a match anymore.
+    while (input_index_ != input_.length() && !blocked_threads_.is_empty()) {
       DCHECK(active_threads_.is_empty());
+
+      if (OnlyPreambleThreadsBlocked()) {
+        // No match is in progress, so we can skip input that can't begin a
+        // match instead of feeding it to the preamble character by character.
+        int next_match_start = NextPossibleMatchStart();
+        if (next_match_start != input_index_) {
+          RestartAt(next_match_start);
+          continue;
+        }
+      }
+
       uc16 input_char = input_[input_index_];
       ++input_index_;
 
@@ -362,7 +416,7 @@ class NfaInterpreter {
   }
 
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
-  // instruction, or its PC value was already processed.
+  // instruction, fails a check, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
   //   pushed on `blocked_threads_`.
   // - If `t` executes ACCEPT, set `best_match` according to `t.match_begin` and
@@ -386,6 +440,26 @@ class NfaInterpreter {
           }
           ++t.pc;
           break;
+        case RegExpInstruction::CHECK_RANGE_AT: {
+          int position = input_index_ + inst.offset;
+          RegExpInstruction::Uc16Range range = inst.payload.check_range;
+          if (position < 0 || position >= input_.length() ||
+              input_[position] < range.min || input_[position] > range.max) {
+            DestroyThread(t);
+            return;
+          }
+          ++t.pc;
+          break;
+        }
+        case RegExpInstruction::CHECK_OUT_OF_BOUNDS_AT: {
+          int position = input_index_ + inst.offset;
+          if (position >= 0 && position < input_.length()) {
+            DestroyThread(t);
+            return;
+          }
+          ++t.pc;
+          break;
+        }
         case RegExpInstruction::FORK: {
           InterpreterThread fork{inst.payload.pc,
                                  NewRegisterArrayUninitialized()};
@@ -459,6 +533,446 @@ class NfaInterpreter {
 
   bool FoundMatch() const { return best_match_registers_.has_value(); }
 
+  // The bytecode of an unanchored regexp begins with a preamble that skips an
+  // arbitrary prefix of the input, and the match itself starts at the first
+  // SET_REGISTER_TO_CP instruction for register 0.  If all paths from there
+  // consume a character before they can ACCEPT or inspect the input in any
+  // other way, then every match begins with a character in one of the ranges
+  // of these first CONSUME_RANGE instructions.  Computes these ranges into
+  // `first_char_ranges_` and sets `has_first_char_filter_` if they exist.
+  void ComputeFirstCharFilter() {
+    // Checking many ranges for every skipped character doesn't pay off.
+    static constexpr int kMaxFirstCharRanges = 4;
+
+    has_first_char_filter_ = false;
+    match_start_pc_ = 0;
+    while (match_start_pc_ != bytecode_.length() &&
+           !(bytecode_[match_start_pc_].opcode ==
+                 RegExpInstruction::SET_REGISTER_TO_CP &&
+             bytecode_[match_start_pc_].payload.register_index == 0)) {
+      ++match_start_pc_;
+    }
+    DCHECK_LT(match_start_pc_, bytecode_.length());
+    // Without a preamble there is no input we could skip.
+    if (match_start_pc_ == 0) return;
+
+    Vector<bool> visited(zone_->NewArray<bool>(bytecode_.length()),
+                         bytecode_.length());
+    std::fill(visited.begin(), visited.end(), false);
+    ZoneList<int> worklist(4, zone_);
+    worklist.Add(match_start_pc_, zone_);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      if (visited[pc]) continue;
+      visited[pc] = true;
+
+      const RegExpInstruction& inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          if (first_char_ranges_.length() == kMaxFirstCharRanges) {
+            first_char_ranges_.DropAndClear();
+            return;
+          }
+          first_char_ranges_.Add(inst.payload.consume_range, zone_);
+          break;
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone_);
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone_);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::ACCEPT:
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::CHECK_RANGE_AT:
+        case RegExpInstruction::CHECK_OUT_OF_BOUNDS_AT:
+          first_char_ranges_.DropAndClear();
+          return;
+      }
+    }
+    has_first_char_filter_ = true;
+  }
+
+  // Whether the only threads left are preamble threads waiting for input, so
+  // that no match is in progress.
+  bool OnlyPreambleThreadsBlocked() const {
+    if (!has_first_char_filter_ || FoundMatch()) return false;
+    // Preamble threads have the lowest priority, so we'll usually find a
+    // non-preamble thread at the beginning of `blocked_threads_` if there is
+    // one.
+    for (const InterpreterThread& t : blocked_threads_) {
+      if (t.pc >= match_start_pc_) return false;
+    }
+    return true;
+  }
+
+  // Returns the first input index not before `input_index_` where a match
+  // can begin according to `first_char_ranges_`, or the input length if there
+  // is none.
+  int NextPossibleMatchStart() const {
+    DCHECK(has_first_char_filter_);
+    int index = input_index_;
+    while (index != input_.length() && !IsFirstChar(input_[index])) ++index;
+    // In unicode mode, restart at the lead surrogate if `index` points to the
+    // trail of a surrogate pair.  The preamble consumes the pair then.
+    if (unicode_ && index > input_index_ && index != input_.length() &&
+        unibrow::Utf16::IsSurrogatePair(input_[index - 1], input_[index])) {
+      --index;
+    }
+    return index;
+  }
+
+  bool IsFirstChar(uc16 c) const {
+    for (const RegExpInstruction::Uc16Range& range : first_char_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  // Lazy DFA mode.
+  //
+  // Without captures, the only registers are the begin and end of the match.
+  // The end is the input position at which the best thread ACCEPTs, and
+  // threads differ only by the begin of their match.  If the bytecode doesn't
+  // inspect the input apart from CONSUME_RANGE, then the ordered list of pc
+  // values of the blocked threads after some input determines the list after
+  // the next character, which is what a DFA state is.  The begin registers are
+  // tracked separately: A transition records for every thread of the target
+  // state which thread of the source state it continues, or that it set the
+  // begin register during the transition.  See also the "tagged DFA" of
+  // Laurikari.
+  //
+  // States and transitions are built lazily while matching and live in
+  // `zone_` until the end of the execution.  If they need more memory than
+  // `kDfaMemoryBudget`, we fall back to the NFA.
+
+  static constexpr size_t kDfaMemoryBudget = 256 * KB;
+  // The origin of a thread that wrote the current position to the begin
+  // register during a transition.
+  static constexpr int kDfaOriginHere = -1;
+  static constexpr int kDfaNoAccept = -2;
+
+  struct DfaTransition {
+    int target_state;
+    // For every thread of the target state, the index of the thread in the
+    // source state it continues, or `kDfaOriginHere`.
+    Vector<int> origins;
+    // The origin of the thread that executed ACCEPT during the transition, or
+    // `kDfaNoAccept`.  At most one thread ACCEPTs during a transition, because
+    // all threads of lower priority are discarded then.
+    int accept_origin;
+  };
+
+  struct DfaState {
+    // The pc values of the blocked threads, from high to low priority.
+    Vector<int> pcs;
+    // Whether all threads are preamble threads, see `ComputeFirstCharFilter`.
+    bool only_preamble_threads;
+    // Indexed by character class, nullptr if not computed yet.
+    DfaTransition** transitions;
+  };
+
+  struct DfaThread {
+    int pc;
+    int origin;
+  };
+
+  // Whether the bytecode can be executed in DFA mode, i.e. there are no
+  // captures and no instructions that look at the input without consuming it.
+  bool IsDfaCompatible() const {
+    if (register_count_per_match_ != 2) return false;
+    for (const RegExpInstruction& inst : bytecode_) {
+      switch (inst.opcode) {
+        case RegExpInstruction::ACCEPT:
+        case RegExpInstruction::CONSUME_RANGE:
+        case RegExpInstruction::FORK:
+        case RegExpInstruction::JMP:
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+          DCHECK_LT(inst.payload.register_index, 2);
+          break;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::CHECK_OUT_OF_BOUNDS_AT:
+        case RegExpInstruction::CHECK_RANGE_AT:
+        case RegExpInstruction::CLEAR_REGISTER:
+          return false;
+      }
+    }
+    return true;
+  }
+
+  // Partitions the characters into classes that no CONSUME_RANGE instruction
+  // distinguishes.  DFA transitions are computed per class instead of per
+  // character.
+  void ComputeDfaCharClasses() {
+    dfa_char_class_bounds_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (range.min > range.max) continue;
+      dfa_char_class_bounds_.push_back(range.min);
+      if (range.max != 0xFFFF) dfa_char_class_bounds_.push_back(range.max + 1);
+    }
+    std::sort(dfa_char_class_bounds_.begin(), dfa_char_class_bounds_.end());
+    dfa_char_class_bounds_.erase(std::unique(dfa_char_class_bounds_.begin(),
+                                             dfa_char_class_bounds_.end()),
+                                 dfa_char_class_bounds_.end());
+
+    int char_class = 0;
+    for (int c = 0; c != kDfaLatin1ClassTableSize; ++c) {
+      while (char_class + 1 !=
+                 static_cast<int>(dfa_char_class_bounds_.size()) &&
+             dfa_char_class_bounds_[char_class + 1] <= c) {
+        ++char_class;
+      }
+      dfa_latin1_char_classes_[c] = char_class;
+    }
+  }
+
+  int DfaCharClass(uc16 c) const {
+    if (c < kDfaLatin1ClassTableSize) return dfa_latin1_char_classes_[c];
+    auto it = std::upper_bound(dfa_char_class_bounds_.begin(),
+                               dfa_char_class_bounds_.end(), c);
+    return static_cast<int>(it - dfa_char_class_bounds_.begin()) - 1;
+  }
+
+  int DfaCharClassCount() const {
+    return static_cast<int>(dfa_char_class_bounds_.size());
+  }
+
+  // Runs the `active` threads (sorted from low to high priority) until they
+  // block or ACCEPT, in the same order as `RunActiveThreads` would, and
+  // returns the resulting transition.  Returns nullptr if we're out of DFA
+  // memory.
+  DfaTransition* RunDfaThreads(ZoneList<DfaThread>* active) {
+    ++dfa_step_;
+    ZoneList<int> blocked_pcs(4, zone_);
+    ZoneList<int> origins(4, zone_);
+    int accept_origin = kDfaNoAccept;
+
+    while (!active->is_empty()) {
+      DfaThread t = active->RemoveLast();
+      bool running = true;
+      while (running) {
+        if (dfa_pc_last_step_[t.pc] == dfa_step_) break;
+        dfa_pc_last_step_[t.pc] = dfa_step_;
+
+        const RegExpInstruction& inst = bytecode_[t.pc];
+        switch (inst.opcode) {
+          case RegExpInstruction::CONSUME_RANGE:
+            blocked_pcs.Add(t.pc, zone_);
+            origins.Add(t.origin, zone_);
+            running = false;
+            break;
+          case RegExpInstruction::FORK:
+            active->Add(DfaThread{inst.payload.pc, t.origin}, zone_);
+            ++t.pc;
+            break;
+          case RegExpInstruction::JMP:
+            t.pc = inst.payload.pc;
+            break;
+          case RegExpInstruction::SET_REGISTER_TO_CP:
+            if (inst.payload.register_index == 0) t.origin = kDfaOriginHere;
+            ++t.pc;
+            break;
+          case RegExpInstruction::ACCEPT:
+            accept_origin = t.origin;
+            active->Clear();
+            running = false;
+            break;
+          default:
+            UNREACHABLE();
+        }
+      }
+    }
+
+    int target_state = FindOrAddDfaState(blocked_pcs);
+    if (target_state < 0) return nullptr;
+
+    size_t size = sizeof(DfaTransition) + origins.length() * sizeof(int);
+    if (!ReserveDfaMemory(size)) return nullptr;
+    DfaTransition* transition = zone_->New<DfaTransition>();
+    transition->target_state = target_state;
+    transition->origins = Vector<int>(zone_->NewArray<int>(origins.length()),
+                                      origins.length());
+    std::copy(origins.begin(), origins.end(), transition->origins.begin());
+    transition->accept_origin = accept_origin;
+    return transition;
+  }
+
+  // Returns the id of the state with the given blocked pc values, or -1 if
+  // we're out of DFA memory.
+  int FindOrAddDfaState(const ZoneList<int>& pcs) {
+    ZoneVector<int> key(pcs.begin(), pcs.end(), zone_);
+    auto it = dfa_state_ids_.find(key);
+    if (it != dfa_state_ids_.end()) return it->second;
+
+    const int char_class_count = DfaCharClassCount();
+    // Count the pcs twice, for the state and for the key in
+    // `dfa_state_ids_`.
+    size_t size = sizeof(DfaState) + 2 * pcs.length() * sizeof(int) +
+                  char_class_count * sizeof(DfaTransition*);
+    if (!ReserveDfaMemory(size)) return -1;
+
+    DfaState state;
+    state.pcs = Vector<int>(zone_->NewArray<int>(pcs.length()), pcs.length());
+    std::copy(pcs.begin(), pcs.end(), state.pcs.begin());
+    state.only_preamble_threads = true;
+    for (int pc : pcs) {
+      if (pc >= match_start_pc_) state.only_preamble_threads = false;
+    }
+    state.transitions = zone_->NewArray<DfaTransition*>(char_class_count);
+    std::fill(state.transitions, state.transitions + char_class_count,
+              nullptr);
+
+    const int id = static_cast<int>(dfa_states_.size());
+    dfa_states_.push_back(state);
+    dfa_state_ids_.emplace(std::move(key), id);
+    return id;
+  }
+
+  bool ReserveDfaMemory(size_t size) {
+    if (dfa_memory_used_ + size > kDfaMemoryBudget) return false;
+    dfa_memory_used_ += size;
+    return true;
+  }
+
+  // The transition from the single initial thread at pc 0.
+  DfaTransition* GetDfaInitialTransition() {
+    if (dfa_initial_transition_ == nullptr) {
+      ZoneList<DfaThread> active(1, zone_);
+      active.Add(DfaThread{0, 0}, zone_);
+      dfa_initial_transition_ = RunDfaThreads(&active);
+    }
+    return dfa_initial_transition_;
+  }
+
+  DfaTransition* GetDfaTransition(int state_id, int char_class) {
+    DfaTransition* transition = dfa_states_[state_id].transitions[char_class];
+    if (transition != nullptr) return transition;
+
+    // Feed a representative of `char_class` to the blocked threads.  Like in
+    // `FlushBlockedThreads`, they are activated in reverse order.
+    const uc16 c = dfa_char_class_bounds_[char_class];
+    Vector<int> pcs = dfa_states_[state_id].pcs;
+    ZoneList<DfaThread> active(pcs.length(), zone_);
+    for (int i = pcs.length() - 1; i >= 0; --i) {
+      RegExpInstruction::Uc16Range range =
+          bytecode_[pcs[i]].payload.consume_range;
+      if (c >= range.min && c <= range.max) {
+        active.Add(DfaThread{pcs[i] + 1, i}, zone_);
+      }
+    }
+    // Don't store a reference into `dfa_states_` across `RunDfaThreads`,
+    // which can add states.
+    transition = RunDfaThreads(&active);
+    dfa_states_[state_id].transitions[char_class] = transition;
+    return transition;
+  }
+
+  // Applies `transition` to `dfa_starts_`, the begin registers of the current
+  // threads, after the input up to `input_index_` has been consumed.
+  // Updates `match_begin` and `match_end` if a thread ACCEPTed.
+  void ApplyDfaTransition(const DfaTransition* transition, int* match_begin,
+                          int* match_end) {
+    auto begin_of = [&](int origin) {
+      return origin == kDfaOriginHere ? input_index_ : dfa_starts_[origin];
+    };
+    if (transition->accept_origin != kDfaNoAccept) {
+      *match_begin = begin_of(transition->accept_origin);
+      *match_end = input_index_;
+      DCHECK_GE(*match_begin, 0);
+    }
+    dfa_next_starts_.resize(transition->origins.length());
+    for (int i = 0; i != transition->origins.length(); ++i) {
+      dfa_next_starts_[i] = begin_of(transition->origins[i]);
+    }
+    std::swap(dfa_starts_, dfa_next_starts_);
+  }
+
+  // The DFA equivalent of `FindNextMatchNfa`.  Returns false if the DFA ran
+  // out of memory, in which case the search must be redone with the NFA.
+  // Otherwise `err_code` is set as `FindNextMatchNfa` would return it.
+  bool FindNextMatchDfa(int* err_code) {
+    DCHECK(active_threads_.is_empty());
+    DCHECK(blocked_threads_.is_empty());
+    if (best_match_registers_.has_value()) {
+      FreeRegisterArray(best_match_registers_->begin());
+      best_match_registers_ = base::nullopt;
+    }
+
+    int match_begin = -1;
+    int match_end = -1;
+
+    DfaTransition* initial = GetDfaInitialTransition();
+    if (initial == nullptr) return false;
+    // The initial thread has an undefined begin register.
+    dfa_starts_.assign(1, kUndefinedRegisterValue);
+    ApplyDfaTransition(initial, &match_begin, &match_end);
+    int state_id = initial->target_state;
+
+    while (input_index_ != input_.length() &&
+           !dfa_states_[state_id].pcs.empty()) {
+      if (has_first_char_filter_ && match_end < 0 &&
+          dfa_states_[state_id].only_preamble_threads) {
+        // As in the NFA, skip input that can't begin a match.
+        int next_match_start = NextPossibleMatchStart();
+        if (next_match_start != input_index_) {
+          SetInputIndex(next_match_start);
+          dfa_starts_.assign(1, kUndefinedRegisterValue);
+          ApplyDfaTransition(initial, &match_begin, &match_end);
+          state_id = initial->target_state;
+          continue;
+        }
+      }
+
+      uc16 input_char = input_[input_index_];
+      ++input_index_;
+
+      static constexpr int kTicksBetweenInterruptHandling = 64;
+      if (input_index_ % kTicksBetweenInterruptHandling == 0) {
+        *err_code = HandleInterrupts();
+        if (*err_code != RegExp::kInternalRegExpSuccess) return true;
+      }
+
+      DfaTransition* transition =
+          GetDfaTransition(state_id, DfaCharClass(input_char));
+      if (transition == nullptr) return false;
+      ApplyDfaTransition(transition, &match_begin, &match_end);
+      state_id = transition->target_state;
+    }
+
+    if (match_end >= 0) {
+      Vector<int> registers(NewRegisterArrayUninitialized(),
+                            register_count_per_match_);
+      registers[0] = match_begin;
+      registers[1] = match_end;
+      best_match_registers_ = registers;
+    }
+    *err_code = RegExp::kInternalRegExpSuccess;
+    return true;
+  }
+
+  // Discards all blocked (i.e. preamble) threads and continues the search at
+  // `new_input_index` with a fresh initial thread.
+  void RestartAt(int new_input_index) {
+    DCHECK(active_threads_.is_empty());
+    DCHECK_GT(new_input_index, input_index_);
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.DropAndClear();
+
+    SetInputIndex(new_input_index);
+    active_threads_.Add(
+        InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
+    RunActiveThreads();
+  }
+
   Vector<int> GetRegisterArray(InterpreterThread t) {
     return Vector<int>(t.register_array_begin, register_count_per_match_);
   }
@@ -511,6 +1025,10 @@ class NfaInterpreter {
 
   const RegExp::CallOrigin call_origin_;
 
+  // Whether the regexp has the unicode flag, in which case matches must
+  // start and end at codepoint boundaries.
+  const bool unicode_;
+
   const DisallowHeapAllocation no_gc_;
 
   ByteArray bytecode_object_;
@@ -542,12 +1060,34 @@ class NfaInterpreter {
   // for reuse if possible.
   RecyclingZoneAllocator<int> register_array_allocator_;
 
+  // See `ComputeFirstCharFilter`.
+  int match_start_pc_;
+  bool has_first_char_filter_;
+  ZoneList<RegExpInstruction::Uc16Range> first_char_ranges_;
+
   // The register array of the best match found so far during the current
   // search.  If several threads ACCEPTed, then this will be the register array
   // of the accepting thread with highest priority.  Should be deallocated with
   // `register_array_allocator_`.
   base::Optional<Vector<int>> best_match_registers_;
 
+  // Lazy DFA mode, see `FindNextMatchDfa`.
+  static constexpr int kDfaLatin1ClassTableSize = 256;
+  bool use_dfa_;
+  ZoneVector<DfaState> dfa_states_;
+  ZoneMap<ZoneVector<int>, int> dfa_state_ids_;
+  DfaTransition* dfa_initial_transition_ = nullptr;
+  // The smallest characters of the character classes, in ascending order.
+  ZoneVector<uc16> dfa_char_class_bounds_;
+  int dfa_latin1_char_classes_[kDfaLatin1ClassTableSize];
+  size_t dfa_memory_used_ = 0;
+  // The begin registers of the threads of the current DFA state.
+  ZoneVector<int> dfa_starts_;
+  ZoneVector<int> dfa_next_starts_;
+  // Like `pc_last_input_index_`, but counting calls of `RunDfaThreads`.
+  Vector<int> dfa_pc_last_step_;
+  int dfa_step_ = 0;
+
   Zone* zone_;
 };
 
@@ -555,19 +1095,20 @@ class NfaInterpreter {
 
 int ExperimentalRegExpInterpreter::FindMatches(
     Isolate* isolate, RegExp::CallOrigin call_origin, ByteArray bytecode,
-    int register_count_per_match, String input, int start_index,
-    int32_t* output_registers, int output_register_count, Zone* zone) {
+    JSRegExp::Flags flags, int register_count_per_match, String input,
+    int start_index, int32_t* output_registers, int output_register_count,
+    Zone* zone) {
   DCHECK(input.IsFlat());
   DisallowHeapAllocation no_gc;
 
   if (input.GetFlatContent(no_gc).IsOneByte()) {
-    NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode,
+    NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode, flags,
                                         register_count_per_match, input,
                                         start_index, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   } else {
     DCHECK(input.GetFlatContent(no_gc).IsTwoByte());
-    NfaInterpreter<uc16> interpreter(isolate, call_origin, bytecode,
+    NfaInterpreter<uc16> interpreter(isolate, call_origin, bytecode, flags,
                                      register_count_per_match, input,
                                      start_index, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
@@ -23,11 +23,12 @@ class ExperimentalRegExpInterpreter final : public AllStatic {
   // `max_match_num` matches in `input`, starting at `start_index`.  Returns
   // the actual number of matches found.  The boundaries of matching subranges
   // are written to `matches_out`.  Provided in variants for one-byte and
-  // two-byte strings.
+  // two-byte strings.  `flags` must be the flags `bytecode` was compiled with.
   static int FindMatches(Isolate* isolate, RegExp::CallOrigin call_origin,
-                         ByteArray bytecode, int capture_count, String input,
-                         int start_index, int32_t* output_registers,
-                         int output_register_count, Zone* zone);
+                         ByteArray bytecode, JSRegExp::Flags flags,
+                         int capture_count, String input, int start_index,
+                         int32_t* output_registers, int output_register_count,
+                         Zone* zone);
 };
 
 }  // namespace internal
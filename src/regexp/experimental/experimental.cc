@@ -141,9 +141,9 @@ Vector<RegExpInstruction> AsInstructionSequence(ByteArray raw_bytes) {
 namespace {
 
 int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
-                    ByteArray bytecode, String subject, int capture_count,
-                    int32_t* output_registers, int32_t output_register_count,
-                    int32_t subject_index) {
+                    ByteArray bytecode, JSRegExp::Flags flags, String subject,
+                    int capture_count, int32_t* output_registers,
+                    int32_t output_register_count, int32_t subject_index) {
   DisallowHeapAllocation no_gc;
 
   int register_count_per_match =
@@ -154,8 +154,9 @@ int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
     DCHECK(subject.IsFlat());
     Zone zone(isolate->allocator(), ZONE_NAME);
     result = ExperimentalRegExpInterpreter::FindMatches(
-        isolate, call_origin, bytecode, register_count_per_match, subject,
-        subject_index, output_registers, output_register_count, &zone);
+        isolate, call_origin, bytecode, flags, register_count_per_match,
+        subject, subject_index, output_registers, output_register_count,
+        &zone);
   } while (result == RegExp::kInternalRegExpRetry &&
            call_origin == RegExp::kFromRuntime);
   return result;
@@ -181,8 +182,8 @@ int32_t ExperimentalRegExp::ExecRaw(Isolate* isolate,
   ByteArray bytecode =
       ByteArray::cast(regexp.DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex));
 
-  return ExecRawImpl(isolate, call_origin, bytecode, subject,
-                     regexp.CaptureCount(), output_registers,
+  return ExecRawImpl(isolate, call_origin, bytecode, regexp.GetFlags(),
+                     subject, regexp.CaptureCount(), output_registers,
                      output_register_count, subject_index);
 }
 
@@ -275,8 +276,8 @@ int32_t ExperimentalRegExp::OneshotExecRaw(Isolate* isolate,
 
   DisallowHeapAllocation no_gc;
   return ExecRawImpl(isolate, RegExp::kFromRuntime,
-                     *compilation_result->bytecode, *subject,
-                     regexp->CaptureCount(), output_registers,
+                     *compilation_result->bytecode, regexp->GetFlags(),
+                     *subject, regexp->CaptureCount(), output_registers,
                      output_register_count, subject_index);
 }
 
@@ -55,7 +55,7 @@ class ExperimentalRegExp final : public AllStatic {
                                 int32_t output_register_count,
                                 int32_t subject_index);
 
-  static constexpr bool kSupportsUnicode = false;
+  static constexpr bool kSupportsUnicode = true;
 };
 
 }  // namespace internal
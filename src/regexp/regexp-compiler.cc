@@ -2832,10 +2832,42 @@ int BoyerMooreLookahead::GetSkipTable(int min_lookahead, int max_lookahead,
   return skip;
 }
 
+// Every match has the character of a position that only allows one character
+// at that position, so advancing until its first occurrence never skips a
+// match. Backends that compare many characters at once do that faster than
+// the skip loops below, as long as the character is not too frequent.
+bool BoyerMooreLookahead::EmitScanForCharacter(RegExpMacroAssembler* masm) {
+  const int kSize = RegExpMacroAssembler::kTableSize;
+  const int kMaxScanFrequency = kSize / 4;
+
+  int best_position = -1;
+  int best_character = 0;
+  int best_frequency = 0;
+  for (int i = 0; i < length_; i++) {
+    if (Count(i) != 1) continue;
+    int character = BitsetFirstSetBit(bitmaps_->at(i)->raw_bitset());
+    DCHECK_NE(character, -1);
+    int frequency = compiler_->frequency_collator()->Frequency(character);
+    if (frequency > kMaxScanFrequency) continue;
+    if (best_position == -1 || frequency < best_frequency) {
+      best_position = i;
+      best_character = character;
+      best_frequency = frequency;
+    }
+  }
+  if (best_position == -1) return false;
+
+  uc16 mask = max_char_ > kSize ? RegExpMacroAssembler::kTableMask
+                                : String::kMaxUtf16CodeUnit;
+  return masm->SkipUntilCharacterAfterAnd(best_character, mask, best_position);
+}
+
 // See comment above on the implementation of GetSkipTable.
 void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   const int kSize = RegExpMacroAssembler::kTableSize;
 
+  if (EmitScanForCharacter(masm)) return;
+
   int min_lookahead = 0;
   int max_lookahead = 0;
 
@@ -233,6 +233,7 @@ class BoyerMooreLookahead : public ZoneObject {
   int GetSkipTable(int min_lookahead, int max_lookahead,
                    Handle<ByteArray> boolean_skip_table);
   bool FindWorthwhileInterval(int* from, int* to);
+  bool EmitScanForCharacter(RegExpMacroAssembler* masm);
   int FindBestInterval(int max_number_of_chars, int old_biggest_points,
                        int* from, int* to);
 };
@@ -380,6 +380,16 @@ bool RegExpMacroAssemblerTracer::CheckSpecialCharacterClass(
   return supported;
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacterAfterAnd(uc16 c,
+                                                            uc16 and_with,
+                                                            int cp_offset) {
+  bool supported =
+      assembler_->SkipUntilCharacterAfterAnd(c, and_with, cp_offset);
+  PrintF(" SkipUntilCharacterAfterAnd(c=0x%04x, mask=0x%04x, offset=%d): %s;\n",
+         c, and_with, cp_offset, supported ? "true" : "false");
+  return supported;
+}
+
 
 void RegExpMacroAssemblerTracer::IfRegisterLT(int register_index,
                                               int comparand, Label* if_lt) {
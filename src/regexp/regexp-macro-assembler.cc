@@ -134,6 +134,11 @@ bool RegExpMacroAssembler::CheckSpecialCharacterClass(uc16 type,
   return false;
 }
 
+bool RegExpMacroAssembler::SkipUntilCharacterAfterAnd(uc16 c, uc16 and_with,
+                                                      int cp_offset) {
+  return false;
+}
+
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
                                                        Zone* zone)
     : RegExpMacroAssembler(isolate, zone) {}
@@ -123,6 +123,13 @@ class RegExpMacroAssembler {
   // not have custom support.
   // May clobber the current loaded character.
   virtual bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match);
+  // Advances the current position until the character at {cp_offset} from it,
+  // and'ed with {and_with}, equals {c}, or until that character would be past
+  // the end of the input. Returns false if there is no custom support for this
+  // scan, in which case nothing is emitted.
+  // May clobber the current loaded character.
+  virtual bool SkipUntilCharacterAfterAnd(uc16 c, uc16 and_with,
+                                          int cp_offset);
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
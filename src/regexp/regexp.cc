@@ -4,6 +4,7 @@
 
 #include "src/regexp/regexp.h"
 
+#include "src/base/bits.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/heap/heap-inl.h"
@@ -1107,6 +1108,39 @@ int32_t* RegExpGlobalCache::LastSuccessfulMatch() {
   return &register_array_[index];
 }
 
+int RegExpResultsCache::MaxCacheLength() {
+  if (FLAG_optimize_for_size) return kRegExpResultsCacheSize;
+  uint32_t entries = base::bits::RoundUpToPowerOfTwo32(
+      static_cast<uint32_t>(std::max(FLAG_regexp_results_cache_size, 1)));
+  return std::max(kRegExpResultsCacheSize,
+                  static_cast<int>(entries) * kArrayEntriesPerCacheEntry);
+}
+
+int RegExpResultsCache::SetIndex(FixedArray cache, String key_string) {
+  int sets = cache.length() / (kArrayEntriesPerCacheEntry * kAssociativity);
+  DCHECK(base::bits::IsPowerOfTwo(sets));
+  return (key_string.Hash() & (sets - 1)) * kArrayEntriesPerCacheEntry *
+         kAssociativity;
+}
+
+void RegExpResultsCache::MoveToFront(FixedArray cache, int set_index,
+                                     int way) {
+  int index = set_index + way * kArrayEntriesPerCacheEntry;
+  Object string = cache.get(index + kStringOffset);
+  Object pattern = cache.get(index + kPatternOffset);
+  Object array = cache.get(index + kArrayOffset);
+  Object last_match = cache.get(index + kLastMatchOffset);
+  for (; index > set_index; index -= kArrayEntriesPerCacheEntry) {
+    for (int i = 0; i < kArrayEntriesPerCacheEntry; i++) {
+      cache.set(index + i, cache.get(index - kArrayEntriesPerCacheEntry + i));
+    }
+  }
+  cache.set(set_index + kStringOffset, string);
+  cache.set(set_index + kPatternOffset, pattern);
+  cache.set(set_index + kArrayOffset, array);
+  cache.set(set_index + kLastMatchOffset, last_match);
+}
+
 Object RegExpResultsCache::Lookup(Heap* heap, String key_string,
                                   Object key_pattern,
                                   FixedArray* last_match_cache,
@@ -1123,21 +1157,27 @@ Object RegExpResultsCache::Lookup(Heap* heap, String key_string,
     cache = heap->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string.Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache.get(index + kStringOffset) != key_string ||
-      cache.get(index + kPatternOffset) != key_pattern) {
-    index =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache.get(index + kStringOffset) != key_string ||
-        cache.get(index + kPatternOffset) != key_pattern) {
-      return Smi::zero();
-    }
+  Counters* counters = heap->isolate()->counters();
+  // The caches are dropped by GCs that reduce memory.
+  if (cache.length() == 0) {
+    counters->regexp_results_cache_misses()->Increment();
+    return Smi::zero();
   }
 
-  *last_match_cache = FixedArray::cast(cache.get(index + kLastMatchOffset));
-  return cache.get(index + kArrayOffset);
+  int set_index = SetIndex(cache, key_string);
+  for (int way = 0; way < kAssociativity; way++) {
+    int index = set_index + way * kArrayEntriesPerCacheEntry;
+    if (cache.get(index + kStringOffset) == key_string &&
+        cache.get(index + kPatternOffset) == key_pattern) {
+      if (way != 0) MoveToFront(cache, set_index, way);
+      counters->regexp_results_cache_hits()->Increment();
+      *last_match_cache =
+          FixedArray::cast(cache.get(set_index + kLastMatchOffset));
+      return cache.get(set_index + kArrayOffset);
+    }
+  }
+  counters->regexp_results_cache_misses()->Increment();
+  return Smi::zero();
 }
 
 void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
@@ -1158,33 +1198,36 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
     cache = factory->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) == Smi::zero()) {
-    cache->set(index + kStringOffset, *key_string);
-    cache->set(index + kPatternOffset, *key_pattern);
-    cache->set(index + kArrayOffset, *value_array);
-    cache->set(index + kLastMatchOffset, *last_match_cache);
-  } else {
-    uint32_t index2 =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index2 + kStringOffset) == Smi::zero()) {
-      cache->set(index2 + kStringOffset, *key_string);
-      cache->set(index2 + kPatternOffset, *key_pattern);
-      cache->set(index2 + kArrayOffset, *value_array);
-      cache->set(index2 + kLastMatchOffset, *last_match_cache);
+  // Start out small again after the cache has been dropped, and grow to the
+  // full size once an entry would have to be evicted.
+  int new_length = 0;
+  if (cache->length() == 0) {
+    new_length = kRegExpResultsCacheSize;
+  } else if (cache->length() < MaxCacheLength()) {
+    int last_index = SetIndex(*cache, *key_string) +
+                     (kAssociativity - 1) * kArrayEntriesPerCacheEntry;
+    if (cache->get(last_index + kStringOffset).IsString()) {
+      new_length = MaxCacheLength();
+    }
+  }
+  if (new_length != 0) {
+    cache = factory->NewFixedArray(new_length, AllocationType::kOld);
+    if (type == STRING_SPLIT_SUBSTRINGS) {
+      isolate->heap()->set_string_split_cache(*cache);
     } else {
-      cache->set(index2 + kStringOffset, Smi::zero());
-      cache->set(index2 + kPatternOffset, Smi::zero());
-      cache->set(index2 + kArrayOffset, Smi::zero());
-      cache->set(index2 + kLastMatchOffset, Smi::zero());
-      cache->set(index + kStringOffset, *key_string);
-      cache->set(index + kPatternOffset, *key_pattern);
-      cache->set(index + kArrayOffset, *value_array);
-      cache->set(index + kLastMatchOffset, *last_match_cache);
+      isolate->heap()->set_regexp_multiple_cache(*cache);
     }
   }
+
+  // Evict the least recently used entry of the set and insert the new entry
+  // as the most recently used one.
+  int set_index = SetIndex(*cache, *key_string);
+  MoveToFront(*cache, set_index, kAssociativity - 1);
+  cache->set(set_index + kStringOffset, *key_string);
+  cache->set(set_index + kPatternOffset, *key_pattern);
+  cache->set(set_index + kArrayOffset, *value_array);
+  cache->set(set_index + kLastMatchOffset, *last_match_cache);
+
   // If the array is a reasonably short list of substrings, convert it into a
   // list of internalized strings.
   if (type == STRING_SPLIT_SUBSTRINGS && value_array->length() < 100) {
@@ -1200,7 +1243,7 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
 }
 
 void RegExpResultsCache::Clear(FixedArray cache) {
-  for (int i = 0; i < kRegExpResultsCacheSize; i++) {
+  for (int i = 0; i < cache.length(); i++) {
     cache.set(i, Smi::zero());
   }
 }
@@ -195,6 +195,9 @@ class RegExpResultsCache final : public AllStatic {
                     Handle<FixedArray> last_match_cache, ResultsCacheType type);
   static void Clear(FixedArray cache);
 
+  // Initial length of each cache. A cache grows to the number of entries
+  // given by --regexp-results-cache-size on the first eviction, and goes back
+  // to this length after a GC that reduces memory.
   static constexpr int kRegExpResultsCacheSize = 0x100;
 
  private:
@@ -203,6 +206,15 @@ class RegExpResultsCache final : public AllStatic {
   static constexpr int kArrayOffset = 2;
   static constexpr int kLastMatchOffset = 3;
   static constexpr int kArrayEntriesPerCacheEntry = 4;
+  // Entries are kept in sets of this many entries, ordered from the most to
+  // the least recently used one.
+  static constexpr int kAssociativity = 4;
+  STATIC_ASSERT(kRegExpResultsCacheSize % (kArrayEntriesPerCacheEntry *
+                                           kAssociativity) == 0);
+
+  static int MaxCacheLength();
+  static int SetIndex(FixedArray cache, String key_string);
+  static void MoveToFront(FixedArray cache, int set_index, int way);
 };
 
 }  // namespace internal
@@ -668,6 +668,69 @@ bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
   }
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(uc16 c,
+                                                         uc16 and_with,
+                                                         int cp_offset) {
+  DCHECK_LE(0, cp_offset);
+  DCHECK_EQ(c, c & and_with);
+  // SSE2 is part of the x64 baseline, so this scans 16 bytes at a time on all
+  // CPUs. The last few characters before the end of the input are looked at
+  // one at a time to avoid reading past the end of the string.
+  static constexpr int kVectorSize = 16;
+  uint32_t replicate = 0x00010001;
+  if (mode_ == LATIN1) {
+    if (c > String::kMaxOneByteCharCode) return false;
+    and_with &= String::kMaxOneByteCharCode;
+    replicate = 0x01010101;
+  }
+  Label vector_loop, scalar_loop, done;
+  // rax holds the offset of the character to look at, relative to rsi.
+  __ leaq(rax, Operand(rdi, cp_offset * char_size()));
+  __ movl(rbx, Immediate(static_cast<int32_t>(c * replicate)));
+  __ movd(xmm0, rbx);
+  __ pshufd(xmm0, xmm0, 0);
+  __ movl(rbx, Immediate(static_cast<int32_t>(and_with * replicate)));
+  __ movd(xmm1, rbx);
+  __ pshufd(xmm1, xmm1, 0);
+
+  __ bind(&vector_loop);
+  __ cmpq(rax, Immediate(-kVectorSize));
+  __ j(greater, &scalar_loop);
+  __ movdqu(xmm2, Operand(rsi, rax, times_1, 0));
+  __ pand(xmm2, xmm1);
+  if (mode_ == LATIN1) {
+    __ pcmpeqb(xmm2, xmm0);
+  } else {
+    __ pcmpeqw(xmm2, xmm0);
+  }
+  __ pmovmskb(rbx, xmm2);
+  __ addq(rax, Immediate(kVectorSize));
+  __ testl(rbx, rbx);
+  __ j(zero, &vector_loop);
+  // The lowest set bit is the byte offset of the first match in the vector.
+  __ bsfl(rbx, rbx);
+  __ leaq(rax, Operand(rax, rbx, times_1, -kVectorSize));
+  __ jmp(&done);
+
+  __ bind(&scalar_loop);
+  __ testq(rax, rax);
+  __ j(not_sign, &done);
+  if (mode_ == LATIN1) {
+    __ movzxbl(rbx, Operand(rsi, rax, times_1, 0));
+  } else {
+    __ movzxwl(rbx, Operand(rsi, rax, times_1, 0));
+  }
+  __ andl(rbx, Immediate(and_with));
+  __ cmpl(rbx, Immediate(c));
+  __ j(equal, &done);
+  __ addq(rax, Immediate(char_size()));
+  __ jmp(&scalar_loop);
+
+  __ bind(&done);
+  __ leaq(rdi, Operand(rax, -cp_offset * char_size()));
+  return true;
+}
+
 
 void RegExpMacroAssemblerX64::Fail() {
   STATIC_ASSERT(FAILURE == 0);  // Return value for failure is zero.
@@ -235,8 +235,6 @@ class Symbol;
   V(PropertyCell, string_iterator_protector, StringIteratorProtector)          \
   /* Caches */                                                                 \
   V(FixedArray, single_character_string_cache, SingleCharacterStringCache)     \
-  V(FixedArray, string_split_cache, StringSplitCache)                          \
-  V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
   /* Indirection lists for isolate-independent builtins */                     \
   V(FixedArray, builtins_constants_table, BuiltinsConstantsTable)              \
   /* Internal SharedFunctionInfos */                                           \
@@ -266,6 +264,19 @@ class Symbol;
     PromiseAllSettledRejectElementSharedFun)                                   \
   V(SharedFunctionInfo, promise_any_reject_element_shared_fun,                 \
     PromiseAnyRejectElementSharedFun)                                          \
+  V(SharedFunctionInfo, promise_all_resolve_element_indexed_shared_fun,        \
+    PromiseAllResolveElementIndexedSharedFun)                                  \
+  V(SharedFunctionInfo, promise_all_reject_element_indexed_shared_fun,         \
+    PromiseAllRejectElementIndexedSharedFun)                                   \
+  V(SharedFunctionInfo,                                                        \
+    promise_all_settled_resolve_element_indexed_shared_fun,                    \
+    PromiseAllSettledResolveElementIndexedSharedFun)                           \
+  V(SharedFunctionInfo, promise_all_settled_reject_element_indexed_shared_fun, \
+    PromiseAllSettledRejectElementIndexedSharedFun)                            \
+  V(SharedFunctionInfo, promise_any_resolve_element_indexed_shared_fun,        \
+    PromiseAnyResolveElementIndexedSharedFun)                                  \
+  V(SharedFunctionInfo, promise_any_reject_element_indexed_shared_fun,         \
+    PromiseAnyRejectElementIndexedSharedFun)                                   \
   V(SharedFunctionInfo, promise_capability_default_reject_shared_fun,          \
     PromiseCapabilityDefaultRejectSharedFun)                                   \
   V(SharedFunctionInfo, promise_capability_default_resolve_shared_fun,         \
@@ -286,6 +297,8 @@ class Symbol;
 #define STRONG_MUTABLE_MOVABLE_ROOT_LIST(V)                                \
   /* Caches */                                                             \
   V(FixedArray, number_string_cache, NumberStringCache)                    \
+  V(FixedArray, string_split_cache, StringSplitCache)                      \
+  V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                \
   /* Lists and dictionaries */                                             \
   V(NameDictionary, public_symbol_table, PublicSymbolTable)                \
   V(NameDictionary, api_symbol_table, ApiSymbolTable)                      \
@@ -302,6 +315,8 @@ class Symbol;
   V(TemplateList, message_listeners, MessageListeners)                     \
   /* Support for async stack traces */                                     \
   V(HeapObject, current_microtask, CurrentMicrotask)                       \
+  /* Last result of a long string concatenation */                         \
+  V(HeapObject, string_builder_tail, StringBuilderTail)                    \
   /* KeepDuringJob set for JS WeakRefs */                                  \
   V(HeapObject, weak_refs_keep_during_job, WeakRefsKeepDuringJob)          \
   V(HeapObject, interpreter_entry_trampoline_for_profiling,                \
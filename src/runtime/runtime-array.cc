@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -9,6 +13,7 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/logging/counters.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/allocation-site-inl.h"
@@ -213,6 +218,112 @@ RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
       isolate, Object::ArraySpeciesConstructor(isolate, original_array));
 }
 
+namespace {
+
+enum class NumericComparator { kNone, kAscending, kDescending };
+
+// Recognizes comparators of the form (a, b) => a - b and (a, b) => b - a by
+// their bytecode, which is exactly "Ldar <rhs>; Sub <lhs>, [slot]; Return".
+// Their result only depends on the numeric order of the arguments, so they
+// can be replaced by a native comparison when all elements are numbers.
+NumericComparator ClassifySortComparator(Isolate* isolate,
+                                         Handle<JSFunction> comparefn) {
+  SharedFunctionInfo shared = comparefn->shared();
+  if (!shared.HasBytecodeArray() || shared.HasBreakInfo()) {
+    return NumericComparator::kNone;
+  }
+  Handle<BytecodeArray> bytecode(shared.GetBytecodeArray(), isolate);
+  if (bytecode->parameter_count() != 3) return NumericComparator::kNone;
+
+  interpreter::BytecodeArrayIterator it(bytecode);
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return NumericComparator::kNone;
+  }
+  interpreter::Register rhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kSub) {
+    return NumericComparator::kNone;
+  }
+  interpreter::Register lhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return NumericComparator::kNone;
+  }
+  if (!lhs.is_parameter() || !rhs.is_parameter()) {
+    return NumericComparator::kNone;
+  }
+
+  // Parameter index 0 is the receiver, so a and b are at indices 1 and 2.
+  int lhs_index = lhs.ToParameterIndex(bytecode->parameter_count());
+  int rhs_index = rhs.ToParameterIndex(bytecode->parameter_count());
+  if (lhs_index == 1 && rhs_index == 2) return NumericComparator::kAscending;
+  if (lhs_index == 2 && rhs_index == 1) return NumericComparator::kDescending;
+  return NumericComparator::kNone;
+}
+
+template <typename T>
+void SortNumbers(std::vector<T>* values, NumericComparator comparator) {
+  // The sort has to be stable to match TimSort, since -0 and 0 compare equal
+  // but are distinguishable.
+  if (comparator == NumericComparator::kAscending) {
+    std::stable_sort(values->begin(), values->end(),
+                     [](T a, T b) { return a < b; });
+  } else {
+    std::stable_sort(values->begin(), values->end(),
+                     [](T a, T b) { return b < a; });
+  }
+}
+
+}  // namespace
+
+// Sorts a packed Smi or double array in place if {comparefn} is one of the
+// numeric comparators recognized above. Returns false without touching the
+// array if the fast path does not apply.
+RUNTIME_FUNCTION(Runtime_ArraySortNumericFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, comparefn, 1);
+  ReadOnlyRoots roots(isolate);
+
+  ElementsKind kind = array->GetElementsKind();
+  if (kind != PACKED_SMI_ELEMENTS && kind != PACKED_DOUBLE_ELEMENTS) {
+    return roots.false_value();
+  }
+  NumericComparator comparator = ClassifySortComparator(isolate, comparefn);
+  if (comparator == NumericComparator::kNone) return roots.false_value();
+
+  uint32_t length;
+  if (!array->length().ToArrayLength(&length)) return roots.false_value();
+
+  if (kind == PACKED_SMI_ELEMENTS) {
+    JSObject::EnsureWritableFastElements(array);
+    FixedArray elements = FixedArray::cast(array->elements());
+    std::vector<int> values(length);
+    for (uint32_t i = 0; i < length; i++) {
+      values[i] = Smi::ToInt(elements.get(i));
+    }
+    SortNumbers(&values, comparator);
+    for (uint32_t i = 0; i < length; i++) {
+      elements.set(i, Smi::FromInt(values[i]));
+    }
+  } else {
+    FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
+    std::vector<double> values(length);
+    for (uint32_t i = 0; i < length; i++) {
+      values[i] = elements.get_scalar(i);
+      // a - b is NaN for NaN elements, which makes the order implementation
+      // defined; leave that to the generic TimSort.
+      if (std::isnan(values[i])) return roots.false_value();
+    }
+    SortNumbers(&values, comparator);
+    for (uint32_t i = 0; i < length; i++) {
+      elements.set(i, values[i]);
+    }
+  }
+  return roots.true_value();
+}
+
 // ES7 22.1.3.11 Array.prototype.includes
 RUNTIME_FUNCTION(Runtime_ArrayIncludes_Slow) {
   HandleScope shs(isolate);
@@ -206,6 +206,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   Handle<Code> optimized_code = deoptimizer->compiled_code();
   DeoptimizeKind type = deoptimizer->deopt_kind();
   bool should_reuse_code = deoptimizer->should_reuse_code();
+  DeoptimizeReason deopt_reason = deoptimizer->deopt_reason();
 
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
@@ -227,6 +228,14 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
 
   // Invalidate the underlying optimized code on eager and soft deopts.
   if (type == DeoptimizeKind::kEager || type == DeoptimizeKind::kSoft) {
+    if (function->has_feedback_vector()) {
+      function->feedback_vector().RecordDeopt(deopt_reason);
+    }
+    if (FLAG_turboprop_as_midtier &&
+        optimized_code->kind() == CodeKind::TURBOPROP &&
+        function->has_feedback_vector()) {
+      function->feedback_vector().SaturatingIncrementMidtierDeoptCount();
+    }
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
   }
 
@@ -349,22 +358,28 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
         DCHECK(!function->IsInOptimizationQueue());
         function->ClearOptimizationMarker();
       }
-      // TODO(mythria): Once we have OSR code cache we may not need to mark
-      // the function for non-concurrent compilation. We could arm the loops
-      // early so the second execution uses the already compiled OSR code and
-      // the optimization occurs concurrently off main thread.
       if (!function->HasAvailableOptimizedCode() &&
           function->feedback_vector().invocation_count() > 1) {
-        // If we're not already optimized, set to optimize non-concurrently on
-        // the next call, otherwise we'd run unoptimized once more and
-        // potentially compile for OSR again.
+        // If we're not already optimized, mark the function for optimization
+        // on the next call. The OSR code is cached and the runtime profiler
+        // arms the loops of functions with cached OSR code early, so with
+        // concurrent recompilation the next executions can run the OSR code
+        // while the function is optimized off the main thread.
+        ConcurrencyMode mode = isolate->concurrent_recompilation_enabled()
+                                   ? ConcurrencyMode::kConcurrent
+                                   : ConcurrencyMode::kNotConcurrent;
         if (FLAG_trace_osr) {
           CodeTracer::Scope scope(isolate->GetCodeTracer());
           PrintF(scope.file(), "[OSR - Re-marking ");
           function->PrintName(scope.file());
-          PrintF(scope.file(), " for non-concurrent optimization]\n");
+          PrintF(scope.file(), " for %s optimization]\n",
+                 mode == ConcurrencyMode::kConcurrent ? "concurrent"
+                                                      : "non-concurrent");
         }
-        function->SetOptimizationMarker(OptimizationMarker::kCompileOptimized);
+        function->SetOptimizationMarker(
+            mode == ConcurrencyMode::kConcurrent
+                ? OptimizationMarker::kCompileOptimizedConcurrent
+                : OptimizationMarker::kCompileOptimized);
       }
       return *result;
     }
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/execution/arguments-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/logging/counters.h"
@@ -233,12 +235,100 @@ RUNTIME_FUNCTION(Runtime_StringSubstring) {
   return *isolate->factory()->NewSubString(string, start, end);
 }
 
+namespace {
+
+// Concatenation chains like `s += x` in a loop are turned into a string
+// builder: a sequential string with spare capacity at the end, of which a
+// SlicedString is the actual result. As long as the left hand side of the
+// next long concatenation is that result (which the heap remembers as the
+// string builder tail), the characters of the right hand side are copied
+// into the spare capacity in place, which the StringAdd builtin does without
+// calling into the runtime. Other slices of the backing store only ever see
+// their own prefix, which never changes. This avoids both the ConsString per
+// concatenation and flattening the resulting rope later.
+MaybeHandle<String> StringBuilderAppend(Isolate* isolate, Handle<String> left,
+                                        Handle<String> right) {
+  DCHECK(FLAG_string_slices);
+  int left_length = left->length();
+  int right_length = right->length();
+  int length = left_length + right_length;
+  DCHECK_LE(length, String::kMaxLength);
+
+  Handle<SeqString> buffer;
+  if (left->IsSlicedString()) {
+    SlicedString sliced = SlicedString::cast(*left);
+    String parent = sliced.parent();
+    if (sliced.offset() == 0 && parent.IsSeqString() &&
+        parent.length() >= length &&
+        (parent.IsSeqTwoByteString() || right->IsOneByteRepresentation())) {
+      // There's enough spare capacity with a suitable encoding.
+      buffer = handle(SeqString::cast(parent), isolate);
+    }
+  }
+  if (buffer.is_null()) {
+    // Start a new backing store, leaving room for as many characters again.
+    int capacity = std::min(String::kMaxLength, 2 * length);
+    if (left->IsOneByteRepresentation() && right->IsOneByteRepresentation()) {
+      Handle<SeqOneByteString> one_byte_buffer;
+      ASSIGN_RETURN_ON_EXCEPTION(
+          isolate, one_byte_buffer,
+          isolate->factory()->NewRawOneByteString(capacity), String);
+      DisallowHeapAllocation no_gc;
+      String::WriteToFlat(*left, one_byte_buffer->GetChars(no_gc), 0,
+                          left_length);
+      buffer = one_byte_buffer;
+    } else {
+      Handle<SeqTwoByteString> two_byte_buffer;
+      ASSIGN_RETURN_ON_EXCEPTION(
+          isolate, two_byte_buffer,
+          isolate->factory()->NewRawTwoByteString(capacity), String);
+      DisallowHeapAllocation no_gc;
+      String::WriteToFlat(*left, two_byte_buffer->GetChars(no_gc), 0,
+                          left_length);
+      buffer = two_byte_buffer;
+    }
+  }
+
+  {
+    DisallowHeapAllocation no_gc;
+    if (buffer->IsSeqOneByteString()) {
+      String::WriteToFlat(
+          *right,
+          SeqOneByteString::cast(*buffer).GetChars(no_gc) + left_length, 0,
+          right_length);
+    } else {
+      String::WriteToFlat(
+          *right,
+          SeqTwoByteString::cast(*buffer).GetChars(no_gc) + left_length, 0,
+          right_length);
+    }
+  }
+
+  // Only a backing store of String::kMaxLength can end up without spare
+  // capacity, and that can't be appended to anyway.
+  if (buffer->length() == length) return buffer;
+  Handle<String> result =
+      isolate->factory()->NewProperSubString(buffer, 0, length);
+  DCHECK(result->IsSlicedString());
+  isolate->heap()->SetStringBuilderTail(*result);
+  return result;
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_StringAdd) {
   HandleScope scope(isolate);
   DCHECK_EQ(2, args.length());
   CONVERT_ARG_HANDLE_CHECKED(String, str1, 0);
   CONVERT_ARG_HANDLE_CHECKED(String, str2, 1);
   isolate->counters()->string_add_runtime()->Increment();
+  if (FLAG_string_slices && *str1 == isolate->heap()->string_builder_tail() &&
+      str2->length() > 0 &&
+      str1->length() <= String::kMaxLength - str2->length() &&
+      str1->length() + str2->length() >= SlicedString::kBuilderMinLength) {
+    RETURN_RESULT_OR_FAILURE(isolate,
+                             StringBuilderAppend(isolate, str1, str2));
+  }
   RETURN_RESULT_OR_FAILURE(isolate,
                            isolate->factory()->NewConsString(str1, str2));
 }
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <array>
+#include <cstring>
+#include <vector>
+
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
@@ -74,6 +78,96 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Typed arrays of at least this many elements are sorted with a radix sort
+// instead of std::sort when no comparator is given.
+constexpr size_t kRadixSortThreshold = 1024;
+
+// Maps element values to unsigned keys whose natural order is the order of
+// TypedArray.prototype.sort without a comparator.
+template <typename T>
+struct SortKey {
+  using Key = typename std::make_unsigned<T>::type;
+  static Key Get(T value) {
+    Key key = static_cast<Key>(value);
+    if (std::is_signed<T>::value) {
+      // Flip the sign bit so that negative values come first.
+      key ^= static_cast<Key>(Key{1} << (kBitsPerByte * sizeof(Key) - 1));
+    }
+    return key;
+  }
+};
+
+template <typename T, typename K>
+struct FloatSortKey {
+  using Key = K;
+  static Key Get(T value) {
+    // NaNs go last, regardless of their sign and payload.
+    if (std::isnan(value)) return std::numeric_limits<Key>::max();
+    // Flip all bits of negative values (so that larger magnitudes come
+    // first), and only the sign bit of positive ones. This orders -0 before
+    // +0.
+    constexpr Key kSignBit = Key{1} << (kBitsPerByte * sizeof(Key) - 1);
+    Key bits = bit_cast<Key>(value);
+    return (bits & kSignBit) ? ~bits : (bits | kSignBit);
+  }
+};
+
+template <>
+struct SortKey<float> : FloatSortKey<float, uint32_t> {};
+template <>
+struct SortKey<double> : FloatSortKey<double, uint64_t> {};
+
+// Stable LSD radix sort over the bytes of SortKey<T>. {data} and {scratch}
+// hold {length} elements each; the result ends up in {data}.
+template <typename T>
+void RadixSort(T* data, T* scratch, size_t length) {
+  using Key = typename SortKey<T>::Key;
+  constexpr int kPasses = sizeof(Key);
+  constexpr int kBuckets = 1 << kBitsPerByte;
+  // Compute the histograms of all passes in a single sweep.
+  std::vector<std::array<size_t, kBuckets>> counts(kPasses);
+  for (size_t i = 0; i < length; i++) {
+    Key key = SortKey<T>::Get(data[i]);
+    for (int pass = 0; pass < kPasses; pass++) {
+      counts[pass][(key >> (pass * kBitsPerByte)) & (kBuckets - 1)]++;
+    }
+  }
+  T* from = data;
+  T* to = scratch;
+  for (int pass = 0; pass < kPasses; pass++) {
+    int shift = pass * kBitsPerByte;
+    std::array<size_t, kBuckets>& count = counts[pass];
+    // Skip passes in which all keys share the same byte.
+    if (count[(SortKey<T>::Get(from[0]) >> shift) & (kBuckets - 1)] ==
+        length) {
+      continue;
+    }
+    size_t offset = 0;
+    for (int bucket = 0; bucket < kBuckets; bucket++) {
+      size_t bucket_count = count[bucket];
+      count[bucket] = offset;
+      offset += bucket_count;
+    }
+    for (size_t i = 0; i < length; i++) {
+      Key key = SortKey<T>::Get(from[i]);
+      to[count[(key >> shift) & (kBuckets - 1)]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
+// Radix sorts the (possibly unaligned) elements at {data} through aligned
+// off-heap buffers.
+template <typename T>
+void RadixSortTypedArrayData(void* data, size_t length) {
+  std::vector<T> values(length);
+  std::vector<T> scratch(length);
+  std::memcpy(values.data(), data, length * sizeof(T));
+  RadixSort(values.data(), scratch.data(), length);
+  std::memcpy(data, values.data(), length * sizeof(T));
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -118,8 +212,10 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
+    if (length >= kRadixSortThreshold) {                                   \
+      RadixSortTypedArrayData<ctype>(data, length);                        \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
+               kExternal##Type##Array == kExternalFloat32Array) {          \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
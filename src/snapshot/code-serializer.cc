@@ -24,7 +24,11 @@ namespace v8 {
 namespace internal {
 
 ScriptData::ScriptData(const byte* data, int length)
-    : owns_data_(false), rejected_(false), data_(data), length_(length) {
+    : owns_data_(false),
+      rejected_(false),
+      sanity_checked_(false),
+      data_(data),
+      length_(length) {
   if (!IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment)) {
     byte* copy = NewArray<byte>(length);
     DCHECK(IsAligned(reinterpret_cast<intptr_t>(copy), kPointerAlignment));
@@ -353,6 +357,17 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
                                              log_code_creation);
 #endif  // V8_TARGET_ARCH_ARM
 
+  if (FLAG_code_cache_optimization_hints) {
+    Handle<Script> script(Script::cast(result->script()), isolate);
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info.has_optimized_at_least_once()) {
+        info.set_has_optimization_hint_from_code_cache(true);
+      }
+    }
+  }
+
   bool needs_source_positions = isolate->NeedsSourcePositionsForProfiling();
 
   if (log_code_creation || FLAG_log_function_events) {
@@ -434,16 +449,21 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     uint32_t expected_source_hash) const {
+  SanityCheckResult result = SanityCheckWithoutSource();
+  if (result != CHECK_SUCCESS) return result;
+  return SanityCheckJustSource(expected_source_hash);
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutSource() const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
-  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t c = GetHeaderValue(kChecksumOffset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
   uint32_t max_payload_length = this->size_ - kHeaderSize;
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
@@ -451,6 +471,14 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
   return CHECK_SUCCESS;
 }
 
+SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheckJustSource(
+    uint32_t expected_source_hash) const {
+  DCHECK_GE(this->size_, kHeaderSize);
+  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
+  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
+  return CHECK_SUCCESS;
+}
+
 uint32_t SerializedCodeData::SourceHash(Handle<String> source,
                                         ScriptOriginOptions origin_options) {
   const uint32_t source_length = source->length();
@@ -488,7 +516,9 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     SanityCheckResult* rejection_result) {
   DisallowGarbageCollection no_gc;
   SerializedCodeData scd(cached_data);
-  *rejection_result = scd.SanityCheck(expected_source_hash);
+  *rejection_result = cached_data->sanity_checked()
+                          ? scd.SanityCheckJustSource(expected_source_hash)
+                          : scd.SanityCheck(expected_source_hash);
   if (*rejection_result != CHECK_SUCCESS) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
@@ -496,5 +526,24 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+BackgroundDeserializeTask::BackgroundDeserializeTask(const byte* data,
+                                                     int length)
+    : data_(data), length_(length) {}
+
+void BackgroundDeserializeTask::Run() {
+  // ScriptData takes care of pointer-aligning the data.
+  script_data_.reset(new ScriptData(data_, length_));
+  SerializedCodeData scd(script_data_.get());
+  // A cache that fails the check is checked again on the main thread, which
+  // also records why it was rejected.
+  if (scd.SanityCheckWithoutSource() == SerializedCodeData::CHECK_SUCCESS) {
+    script_data_->MarkSanityChecked();
+  }
+}
+
+ScriptData* BackgroundDeserializeTask::ReleaseScriptData() {
+  return script_data_.release();
+}
+
 }  // namespace internal
 }  // namespace v8
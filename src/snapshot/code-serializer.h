@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <memory>
+
 #include "src/base/macros.h"
 #include "src/snapshot/serializer.h"
 #include "src/snapshot/snapshot-data.h"
@@ -27,6 +29,12 @@ class V8_EXPORT_PRIVATE ScriptData {
 
   void Reject() { rejected_ = true; }
 
+  // Whether everything but the source hash has been checked already, by a
+  // BackgroundDeserializeTask.
+  bool sanity_checked() const { return sanity_checked_; }
+
+  void MarkSanityChecked() { sanity_checked_ = true; }
+
   void AcquireDataOwnership() {
     DCHECK(!owns_data_);
     owns_data_ = true;
@@ -40,6 +48,7 @@ class V8_EXPORT_PRIVATE ScriptData {
  private:
   bool owns_data_ : 1;
   bool rejected_ : 1;
+  bool sanity_checked_ : 1;
   const byte* data_;
   int length_;
 };
@@ -132,6 +141,36 @@ class SerializedCodeData : public SerializedData {
   }
 
   SanityCheckResult SanityCheck(uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckWithoutSource() const;
+  SanityCheckResult SanityCheckJustSource(uint32_t expected_source_hash) const;
+
+  friend class BackgroundDeserializeTask;
+};
+
+// Checks a code cache on a background thread. This covers everything but the
+// source hash, including the checksum over the whole payload, so that
+// CodeSerializer::Deserialize only has to deserialize the cache on the main
+// thread. The deserializer itself can't run off-thread yet.
+class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
+ public:
+  BackgroundDeserializeTask(const byte* data, int length);
+  BackgroundDeserializeTask(const BackgroundDeserializeTask&) = delete;
+  BackgroundDeserializeTask& operator=(const BackgroundDeserializeTask&) =
+      delete;
+
+  void Run();
+
+  // Returns the ScriptData to consume, which is marked as sanity checked if
+  // the check passed, or nullptr if Run() hasn't been called. Ownership is
+  // passed to the caller.
+  ScriptData* ReleaseScriptData();
+
+  const byte* data() const { return data_; }
+
+ private:
+  const byte* data_;
+  int length_;
+  std::unique_ptr<ScriptData> script_data_;
 };
 
 }  // namespace internal
@@ -4,6 +4,10 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/objects/objects-inl.h"
@@ -25,7 +29,9 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (!PcIsOffHeap(isolate, address)) return Code();
 
   EmbeddedData d = EmbeddedData::FromBlob();
-  if (address < d.InstructionStartOfBuiltin(0)) return Code();
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinAtPosition(0))) {
+    return Code();
+  }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
@@ -34,15 +40,16 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   int l = 0, r = Builtins::builtin_count;
   while (l < r) {
     const int mid = (l + r) / 2;
-    Address start = d.InstructionStartOfBuiltin(mid);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(mid);
+    const int builtin = d.BuiltinAtPosition(mid);
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
     if (address < start) {
       r = mid;
     } else if (address >= end) {
       l = mid + 1;
     } else {
-      return isolate->builtins()->builtin(mid);
+      return isolate->builtins()->builtin(builtin);
     }
   }
 
@@ -198,6 +205,25 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns the builtin indices in the order their code is laid out. With
+// --reorder-builtins, builtins entered more often in the profile come first to
+// pack the hot code into fewer pages and cache lines. Bytecode handlers always
+// stay at the end in index order, since the range of handler code is checked
+// with InstructionStartOfBytecodeHandlers().
+std::vector<uint32_t> ComputeBuiltinOrder(Builtins* builtins) {
+  std::vector<uint32_t> order(Builtins::builtin_count);
+  std::iota(order.begin(), order.end(), 0);
+  if (FLAG_reorder_builtins) {
+    std::stable_sort(order.begin(),
+                     order.begin() + Builtins::kFirstBytecodeHandler,
+                     [builtins](uint32_t a, uint32_t b) {
+                       return builtins->profiled_entry_count(a) >
+                              builtins->profiled_entry_count(b);
+                     });
+  }
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -206,12 +232,13 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
   // Store instruction stream lengths and offsets.
   std::vector<struct LayoutDescription> layout_descriptions(kTableSize);
+  std::vector<uint32_t> builtin_order = ComputeBuiltinOrder(builtins);
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_code_size = 0;
   uint32_t raw_data_size = 0;
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (uint32_t i : builtin_order) {
     Code code = builtins->builtin(i);
 
     // Sanity-check that the given builtin is isolate-independent and does not
@@ -273,6 +300,12 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   std::memcpy(blob_data + LayoutDescriptionTableOffset(),
               layout_descriptions.data(), LayoutDescriptionTableSize());
 
+  // .. and the code section order.
+  DCHECK_EQ(BuiltinOrderTableSize(),
+            sizeof(builtin_order[0]) * builtin_order.size());
+  std::memcpy(blob_data + BuiltinOrderTableOffset(), builtin_order.data(),
+              BuiltinOrderTableSize());
+
   // .. and the variable-size data section.
   uint8_t* const raw_metadata_start = blob_data + RawMetadataOffset();
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
@@ -70,6 +70,14 @@ class EmbeddedData final {
   Address InstructionStartOfBuiltin(int i) const;
   uint32_t InstructionSizeOfBuiltin(int i) const;
 
+  // Builtins are not necessarily laid out in builtin index order (see
+  // --reorder-builtins). Returns the index of the builtin at the given
+  // position in the code section.
+  int BuiltinAtPosition(int position) const {
+    DCHECK(Builtins::IsBuiltinId(position));
+    return static_cast<int>(BuiltinOrder()[position]);
+  }
+
   Address InstructionStartOfBytecodeHandlers() const;
   Address InstructionEndOfBytecodeHandlers() const;
 
@@ -135,11 +143,13 @@ class EmbeddedData final {
   // [2] hash of embedded-blob-relevant heap objects
   // [3] layout description of instruction stream 0
   // ... layout descriptions
+  // [y] index of the first builtin in the code section
+  // ... builtin indices in code section order
   // [x] metadata section of builtin 0
   // ... metadata sections
   //
   // code:
-  // [0] instruction section of builtin 0
+  // [0] instruction section of the first builtin
   // ... instruction sections
 
   static constexpr uint32_t kTableSize = Builtins::builtin_count;
@@ -159,9 +169,15 @@ class EmbeddedData final {
   static constexpr uint32_t LayoutDescriptionTableSize() {
     return sizeof(struct LayoutDescription) * kTableSize;
   }
-  static constexpr uint32_t FixedDataSize() {
+  static constexpr uint32_t BuiltinOrderTableOffset() {
     return LayoutDescriptionTableOffset() + LayoutDescriptionTableSize();
   }
+  static constexpr uint32_t BuiltinOrderTableSize() {
+    return kUInt32Size * kTableSize;
+  }
+  static constexpr uint32_t FixedDataSize() {
+    return BuiltinOrderTableOffset() + BuiltinOrderTableSize();
+  }
   // The variable-size data section starts here.
   static constexpr uint32_t RawMetadataOffset() { return FixedDataSize(); }
 
@@ -184,6 +200,10 @@ class EmbeddedData final {
     return reinterpret_cast<const struct LayoutDescription*>(
         data_ + LayoutDescriptionTableOffset());
   }
+  const uint32_t* BuiltinOrder() const {
+    return reinterpret_cast<const uint32_t*>(data_ +
+                                             BuiltinOrderTableOffset());
+  }
   const uint8_t* RawMetadata() const { return data_ + RawMetadataOffset(); }
 
   static constexpr int PadAndAlignCode(int size) {
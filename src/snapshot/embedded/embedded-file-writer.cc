@@ -159,7 +159,7 @@ void EmbeddedFileWriter::WriteCodeSection(PlatformEmbeddedFileWriterBase* w,
 
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
   for (int i = 0; i < i::Builtins::builtin_count; i++) {
-    WriteBuiltin(w, blob, i);
+    WriteBuiltin(w, blob, blob->BuiltinAtPosition(i));
   }
   w->Newline();
 }
@@ -111,17 +111,19 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   {
     STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
     Address prev_builtin_end_offset = 0;
-    for (int i = 0; i < Builtins::builtin_count; i++) {
+    for (int position = 0; position < Builtins::builtin_count; position++) {
+      // PDATA entries must be sorted by address.
+      const int builtin = blob->BuiltinAtPosition(position);
       // Some builtins are leaf functions from the point of view of Win64 stack
       // walking: they do not move the stack pointer and do not require a PDATA
       // entry because the return address can be retrieved from [rsp].
-      if (unwind_infos[i].is_leaf_function()) continue;
+      if (unwind_infos[builtin].is_leaf_function()) continue;
 
-      uint64_t builtin_start_offset = blob->InstructionStartOfBuiltin(i) -
+      uint64_t builtin_start_offset = blob->InstructionStartOfBuiltin(builtin) -
                                       reinterpret_cast<Address>(blob->code());
-      uint32_t builtin_size = blob->InstructionSizeOfBuiltin(i);
+      uint32_t builtin_size = blob->InstructionSizeOfBuiltin(builtin);
 
-      const std::vector<int>& xdata_desc = unwind_infos[i].fp_offsets();
+      const std::vector<int>& xdata_desc = unwind_infos[builtin].fp_offsets();
       if (xdata_desc.empty()) {
         // Some builtins do not have any "push rbp - mov rbp, rsp" instructions
         // to start a stack frame. We still emit a PDATA entry as if they had,
@@ -194,16 +196,18 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   std::vector<win64_unwindinfo::FrameOffsets> fp_adjustments;
 
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (int i = 0; i < Builtins::builtin_count; i++) {
-    if (unwind_infos[i].is_leaf_function()) continue;
+  for (int position = 0; position < Builtins::builtin_count; position++) {
+    // PDATA entries must be sorted by address.
+    const int builtin = blob->BuiltinAtPosition(position);
+    if (unwind_infos[builtin].is_leaf_function()) continue;
 
-    uint64_t builtin_start_offset = blob->InstructionStartOfBuiltin(i) -
+    uint64_t builtin_start_offset = blob->InstructionStartOfBuiltin(builtin) -
                                     reinterpret_cast<Address>(blob->code());
-    uint32_t builtin_size = blob->InstructionSizeOfBuiltin(i);
+    uint32_t builtin_size = blob->InstructionSizeOfBuiltin(builtin);
 
-    const std::vector<int>& xdata_desc = unwind_infos[i].fp_offsets();
+    const std::vector<int>& xdata_desc = unwind_infos[builtin].fp_offsets();
     const std::vector<win64_unwindinfo::FrameOffsets>& xdata_fp_adjustments =
-        unwind_infos[i].fp_adjustments();
+        unwind_infos[builtin].fp_adjustments();
     DCHECK_EQ(xdata_desc.size(), xdata_fp_adjustments.size());
 
     for (size_t j = 0; j < xdata_desc.size(); j++) {
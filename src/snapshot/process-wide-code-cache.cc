@@ -0,0 +1,144 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/process-wide-code-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/flags/flags.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessWideCodeCache,
+                                GetProcessWideCodeCache)
+}  // namespace
+
+// static
+ProcessWideCodeCache* ProcessWideCodeCache::Get() {
+  return GetProcessWideCodeCache();
+}
+
+// static
+ProcessWideCodeCache::Key ProcessWideCodeCache::MakeKey(
+    Isolate* isolate, Handle<String> source, MaybeHandle<Object> maybe_name,
+    int line_offset, int column_offset, ScriptOriginOptions origin_options) {
+  Key key;
+  key.line_offset = line_offset;
+  key.column_offset = column_offset;
+  key.origin_flags = origin_options.Flags();
+  Handle<Object> name;
+  if (maybe_name.ToHandle(&name) && name->IsString()) {
+    key.name = String::cast(*name).ToCString().get();
+  }
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  key.is_one_byte = content.IsOneByte();
+  if (key.is_one_byte) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.source.assign(chars.begin(), chars.end());
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(chars.begin());
+    key.source.assign(bytes, bytes + chars.length() * sizeof(uc16));
+  }
+  return key;
+}
+
+// static
+size_t ProcessWideCodeCache::Hash(const Key& key) {
+  return base::hash_combine(
+      base::hash_range(key.source.begin(), key.source.end()), key.line_offset,
+      key.column_offset, key.origin_flags);
+}
+
+std::shared_ptr<ProcessWideCodeCache::Entry> ProcessWideCodeCache::Find(
+    size_t hash, const Key& key) const {
+  auto range = entries_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second->key == key) return it->second;
+  }
+  return nullptr;
+}
+
+MaybeHandle<SharedFunctionInfo> ProcessWideCodeCache::Lookup(
+    Isolate* isolate, Handle<String> source, MaybeHandle<Object> maybe_name,
+    int line_offset, int column_offset, ScriptOriginOptions origin_options) {
+  source = String::Flatten(isolate, source);
+  Key key = MakeKey(isolate, source, maybe_name, line_offset, column_offset,
+                    origin_options);
+  size_t hash = Hash(key);
+  std::shared_ptr<Entry> entry;
+  {
+    base::MutexGuard guard(&mutex_);
+    entry = Find(hash, key);
+  }
+  if (!entry) return MaybeHandle<SharedFunctionInfo>();
+
+  // The entry is kept alive by {entry} even if the cache is cleared
+  // concurrently.
+  ScriptData script_data(entry->data.data(),
+                         static_cast<int>(entry->data.size()));
+  Handle<SharedFunctionInfo> result;
+  if (!CodeSerializer::Deserialize(isolate, &script_data, source,
+                                   origin_options)
+           .ToHandle(&result) ||
+      !result->is_compiled()) {
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  return result;
+}
+
+void ProcessWideCodeCache::Put(Isolate* isolate, Handle<String> source,
+                               MaybeHandle<Object> maybe_name, int line_offset,
+                               int column_offset,
+                               ScriptOriginOptions origin_options,
+                               Handle<SharedFunctionInfo> sfi) {
+  source = String::Flatten(isolate, source);
+  const size_t max_size =
+      static_cast<size_t>(FLAG_process_wide_code_cache_size) * KB;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (size_in_bytes_ >= max_size) return;
+  }
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(sfi));
+  if (!cached_data) return;
+
+  auto entry = std::make_shared<Entry>();
+  entry->key = MakeKey(isolate, source, maybe_name, line_offset, column_offset,
+                       origin_options);
+  entry->data.assign(cached_data->data,
+                     cached_data->data + cached_data->length);
+  size_t entry_size = entry->key.source.size() + entry->data.size();
+  size_t hash = Hash(entry->key);
+
+  base::MutexGuard guard(&mutex_);
+  if (size_in_bytes_ + entry_size > max_size) return;
+  // Another isolate may have added the same script in the meantime.
+  if (Find(hash, entry->key)) return;
+  entries_.emplace(hash, std::move(entry));
+  size_in_bytes_ += entry_size;
+}
+
+size_t ProcessWideCodeCache::size_in_bytes() const {
+  base::MutexGuard guard(&mutex_);
+  return size_in_bytes_;
+}
+
+void ProcessWideCodeCache::Clear() {
+  base::MutexGuard guard(&mutex_);
+  entries_.clear();
+  size_in_bytes_ = 0;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,91 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_PROCESS_WIDE_CODE_CACHE_H_
+#define V8_SNAPSHOT_PROCESS_WIDE_CODE_CACHE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+class String;
+
+// A code cache shared by all isolates of the process. Top-level scripts are
+// serialized with the CodeSerializer after their first compilation, and other
+// isolates compiling the same script deserialize the cached data instead of
+// parsing and compiling the source again.
+//
+// Entries are keyed by the full source text and the script origin, so a hit
+// always produces the same script as a fresh compile would.
+class V8_EXPORT_PRIVATE ProcessWideCodeCache final {
+ public:
+  static ProcessWideCodeCache* Get();
+
+  ProcessWideCodeCache() = default;
+  ProcessWideCodeCache(const ProcessWideCodeCache&) = delete;
+  ProcessWideCodeCache& operator=(const ProcessWideCodeCache&) = delete;
+
+  MaybeHandle<SharedFunctionInfo> Lookup(Isolate* isolate,
+                                         Handle<String> source,
+                                         MaybeHandle<Object> maybe_name,
+                                         int line_offset, int column_offset,
+                                         ScriptOriginOptions origin_options);
+
+  // Serializes |sfi| and adds it to the cache, unless an entry for the same
+  // script already exists or the cache is full.
+  void Put(Isolate* isolate, Handle<String> source,
+           MaybeHandle<Object> maybe_name, int line_offset, int column_offset,
+           ScriptOriginOptions origin_options, Handle<SharedFunctionInfo> sfi);
+
+  size_t size_in_bytes() const;
+  void Clear();
+
+ private:
+  struct Key {
+    bool is_one_byte;
+    std::vector<uint8_t> source;
+    std::string name;
+    int line_offset;
+    int column_offset;
+    int origin_flags;
+
+    bool operator==(const Key& other) const {
+      return is_one_byte == other.is_one_byte && source == other.source &&
+             name == other.name && line_offset == other.line_offset &&
+             column_offset == other.column_offset &&
+             origin_flags == other.origin_flags;
+    }
+  };
+
+  struct Entry {
+    Key key;
+    std::vector<uint8_t> data;
+  };
+
+  static Key MakeKey(Isolate* isolate, Handle<String> source,
+                     MaybeHandle<Object> maybe_name, int line_offset,
+                     int column_offset, ScriptOriginOptions origin_options);
+  // String hashes are seeded per isolate, so the cache uses its own hash.
+  static size_t Hash(const Key& key);
+  std::shared_ptr<Entry> Find(size_t hash, const Key& key) const;
+
+  mutable base::Mutex mutex_;
+  std::unordered_multimap<size_t, std::shared_ptr<Entry>> entries_;
+  size_t size_in_bytes_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_PROCESS_WIDE_CODE_CACHE_H_
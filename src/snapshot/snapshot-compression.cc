@@ -4,7 +4,14 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +19,72 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// The payload is compressed in independent chunks of this size, so they can
+// be decompressed in parallel.
+const uint32_t kChunkSize = 256 * KB;
+
+// Layout of compressed data:
+//   uint32_t uncompressed size
+//   uint32_t number of chunks
+//   uint32_t compressed size of each chunk
+//   compressed chunks, back to back
+const uint32_t kUncompressedSizeOffset = 0;
+const uint32_t kChunkCountOffset = kUncompressedSizeOffset + kUInt32Size;
+const uint32_t kChunkSizesOffset = kChunkCountOffset + kUInt32Size;
+
+uint32_t ReadUInt32(const byte* data, uint32_t offset) {
+  uint32_t value;
+  MemCopy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+void WriteUInt32(byte* data, uint32_t offset, uint32_t value) {
+  MemCopy(data + offset, &value, sizeof(value));
+}
+
+struct DecompressionChunk {
+  const Bytef* input;
+  uLong input_size;
+  Bytef* output;
+  uLongf output_size;
+};
+
+void DecompressChunk(const DecompressionChunk& chunk) {
+  uLongf output_size = chunk.output_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(zlib_internal::ZRAW, chunk.output,
+                                           &output_size, chunk.input,
+                                           chunk.input_size),
+           Z_OK);
+  CHECK_EQ(chunk.output_size, output_size);
 }
 
+class DecompressionJob final : public JobTask {
+ public:
+  explicit DecompressionJob(const std::vector<DecompressionChunk>* chunks)
+      : chunks_(chunks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) break;
+      DecompressChunk(chunks_->at(index));
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next, chunks_->size());
+  }
+
+ private:
+  const std::vector<DecompressionChunk>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,34 +92,43 @@ SnapshotData SnapshotCompression::Compress(
   if (FLAG_profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  Vector<const byte> payload = uncompressed_data->RawData();
+  uint32_t payload_length = static_cast<uint32_t>(payload.size());
+  uint32_t chunk_count = (payload_length + kChunkSize - 1) / kChunkSize;
+  uint32_t header_size = kChunkSizesOffset + chunk_count * kUInt32Size;
 
   // Allocating >= the final amount we will need.
+  uLongf max_compressed_size = 0;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    max_compressed_size +=
+        compressBound(std::min(kChunkSize, payload_length - i * kChunkSize));
+  }
   snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+      static_cast<uint32_t>(header_size + max_compressed_size));
 
   byte* compressed_data = const_cast<byte*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(zlib_internal::CompressHelper(
-               zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-               &compressed_data_size,
-               bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-               input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-           Z_OK);
+  WriteUInt32(compressed_data, kUncompressedSizeOffset, payload_length);
+  WriteUInt32(compressed_data, kChunkCountOffset, chunk_count);
+
+  uint32_t compressed_size = header_size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uLong input_size = std::min(kChunkSize, payload_length - i * kChunkSize);
+    uLongf chunk_compressed_size = compressBound(input_size);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_size,
+                 &chunk_compressed_size,
+                 bit_cast<const Bytef*>(payload.begin() + i * kChunkSize),
+                 input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUInt32(compressed_data, kChunkSizesOffset + i * kUInt32Size,
+                static_cast<uint32_t>(chunk_compressed_size));
+    compressed_size += static_cast<uint32_t>(chunk_compressed_size);
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(compressed_size);
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -67,23 +143,35 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef = bit_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
-
+  const byte* input = compressed_data.begin();
+  uint32_t uncompressed_payload_length =
+      ReadUInt32(input, kUncompressedSizeOffset);
+  uint32_t chunk_count = ReadUInt32(input, kChunkCountOffset);
   snapshot_data.AllocateData(uncompressed_payload_length);
+  Bytef* output = bit_cast<Bytef*>(snapshot_data.RawData().begin());
+
+  std::vector<DecompressionChunk> chunks(chunk_count);
+  uint32_t input_offset = kChunkSizesOffset + chunk_count * kUInt32Size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uint32_t input_size =
+        ReadUInt32(input, kChunkSizesOffset + i * kUInt32Size);
+    CHECK_LE(input_offset + input_size, compressed_data.size());
+    chunks[i] = {bit_cast<const Bytef*>(input + input_offset), input_size,
+                 output + i * kChunkSize,
+                 std::min(kChunkSize,
+                          uncompressed_payload_length - i * kChunkSize)};
+    input_offset += input_size;
+  }
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  if (chunk_count > 1 && FLAG_concurrent_snapshot_decompression) {
+    // The calling thread joins in, so this doesn't wait for a free worker.
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<DecompressionJob>(&chunks))
+        ->Join();
+  } else {
+    for (const DecompressionChunk& chunk : chunks) DecompressChunk(chunk);
+  }
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -6,6 +6,7 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
@@ -105,6 +106,25 @@ class SnapshotImpl : public AllStatic {
   }
 };
 
+// The blob whose checksum was last verified. Embedders usually create all
+// their isolates from the same blob, which then only has to be checksummed
+// once per process.
+base::LazyMutex verified_blob_mutex = LAZY_MUTEX_INITIALIZER;
+const char* verified_blob_data = nullptr;
+int verified_blob_size = 0;
+
+bool VerifyChecksumOnce(const v8::StartupData* blob) {
+  base::MutexGuard guard(verified_blob_mutex.Pointer());
+  if (blob->data == verified_blob_data &&
+      blob->raw_size == verified_blob_size) {
+    return true;
+  }
+  if (!Snapshot::VerifyChecksum(blob)) return false;
+  verified_blob_data = blob->data;
+  verified_blob_size = blob->raw_size;
+  return true;
+}
+
 }  // namespace
 
 SnapshotData MaybeDecompress(const Vector<const byte>& snapshot_data) {
@@ -151,7 +171,7 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   SnapshotImpl::CheckVersion(blob);
-  CHECK(VerifyChecksum(blob));
+  if (FLAG_verify_snapshot_checksum) CHECK(VerifyChecksumOnce(blob));
   Vector<const byte> startup_data = SnapshotImpl::ExtractStartupData(blob);
   Vector<const byte> read_only_data = SnapshotImpl::ExtractReadOnlyData(blob);
 
@@ -113,10 +113,26 @@ class ReplacementStringBuilder {
   bool is_one_byte_;
 };
 
+// Receives the finished parts of an IncrementalStringBuilder in order. Parts
+// may be arbitrary strings and are only valid for the duration of the call.
+class IncrementalStringBuilderSink {
+ public:
+  virtual ~IncrementalStringBuilderSink() = default;
+  virtual void WritePart(Handle<String> part) = 0;
+};
+
 class IncrementalStringBuilder {
  public:
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // When a sink is set, finished parts are handed to it instead of being
+  // accumulated, so the result is never materialized as a whole and Finish()
+  // returns the empty string. Must be set before anything is appended.
+  void set_sink(IncrementalStringBuilderSink* sink) {
+    DCHECK_EQ(0, Length());
+    sink_ = sink;
+  }
+
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -299,6 +315,7 @@ class IncrementalStringBuilder {
   int current_index_;
   Handle<String> accumulator_;
   Handle<String> current_part_;
+  IncrementalStringBuilderSink* sink_ = nullptr;
 };
 
 template <typename SrcChar, typename DestChar>
@@ -246,6 +246,11 @@ int IncrementalStringBuilder::Length() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (sink_ != nullptr) {
+    // Nothing is accumulated, so the string length limit does not apply.
+    if (new_part->length() > 0) sink_->WritePart(new_part);
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
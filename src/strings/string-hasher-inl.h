@@ -33,15 +33,33 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash | (kZeroHash & mask);
 }
 
-uint32_t StringHasher::GetTrivialHash(int length) {
+int StringHasher::LongStringMiddleSampleStart(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
-  // The hash of a large string is simply computed from the length.
-  // Ensure that the max length is small enough to be shifted without losing
-  // information.
-  STATIC_ASSERT(base::bits::CountLeadingZeros32(String::kMaxLength) >=
-                String::kHashShift);
-  uint32_t hash = static_cast<uint32_t>(length);
-  return (hash << String::kHashShift) | String::kIsNotIntegerIndexMask;
+  return (length - kLongStringSampleLength) / 2;
+}
+
+template <typename char_t>
+uint32_t StringHasher::HashLongString(const char_t* first, const char_t* middle,
+                                      const char_t* last, int length,
+                                      uint64_t seed) {
+  STATIC_ASSERT(String::kMaxHashCalcLength >= 3 * kLongStringSampleLength);
+  using uchar = typename std::make_unsigned<char_t>::type;
+  DCHECK_GT(length, String::kMaxHashCalcLength);
+  // Long strings can't be integer indices, so only the regular hash is
+  // needed. Mixing in the length keeps strings that only differ outside of
+  // the samples apart when their lengths differ.
+  uint32_t running_hash = static_cast<uint32_t>(seed);
+  running_hash = AddCharacterCore(running_hash, length & 0xFFFF);
+  running_hash = AddCharacterCore(running_hash, length >> 16);
+  const char_t* samples[] = {first, middle, last};
+  for (const char_t* sample : samples) {
+    const uchar* chars = reinterpret_cast<const uchar*>(sample);
+    for (int i = 0; i < kLongStringSampleLength; i++) {
+      running_hash = AddCharacterCore(running_hash, chars[i]);
+    }
+  }
+  return (GetHashCore(running_hash) << String::kHashShift) |
+         String::kIsNotIntegerIndexMask;
 }
 
 template <typename char_t>
@@ -105,7 +123,9 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
     // No "else" here: if the first character was a decimal digit, we might
     // still have to take this branch.
     if (length > String::kMaxHashCalcLength) {
-      return GetTrivialHash(length);
+      return HashLongString(
+          chars_raw, chars_raw + LongStringMiddleSampleStart(length),
+          chars_raw + length - kLongStringSampleLength, length, seed);
     }
   }
 
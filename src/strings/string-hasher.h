@@ -34,7 +34,16 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
-  static inline uint32_t GetTrivialHash(int length);
+  // Strings longer than String::kMaxHashCalcLength are hashed from their
+  // length and three samples of kLongStringSampleLength characters each,
+  // taken from the start, the middle and the end of the string.
+  static const int kLongStringSampleLength = 64;
+  static inline int LongStringMiddleSampleStart(int length);
+  template <typename char_t>
+  static inline uint32_t HashLongString(const char_t* first,
+                                        const char_t* middle,
+                                        const char_t* last, int length,
+                                        uint64_t seed);
 };
 
 // Useful for std containers that require something ()'able.
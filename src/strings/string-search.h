@@ -6,6 +6,7 @@
 #define V8_STRINGS_STRING_SEARCH_H_
 
 #include "src/execution/isolate.h"
+#include "src/objects/simd.h"
 #include "src/utils/vector.h"
 
 namespace v8 {
@@ -110,6 +111,10 @@ class StringSearch : private StringSearchBase {
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            Vector<const SubjectChar> subject, int start_index);
 
+  static int FirstAndLastCharacterSearch(
+      StringSearch<PatternChar, SubjectChar>* search,
+      Vector<const SubjectChar> subject, int start_index);
+
   static int BoyerMooreHorspoolSearch(
       StringSearch<PatternChar, SubjectChar>* search,
       Vector<const SubjectChar> subject, int start_index);
@@ -222,6 +227,21 @@ inline int FindFirstCharacter(Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Finds the next position at or after {index} where both the first and the
+// last character of {pattern} match. Checking two characters at once rules
+// out most of the candidates a search for the first character alone finds.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(Vector<const PatternChar> pattern,
+                                     Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_GT(pattern.length(), 1);
+  const int last_offset = pattern.length() - 1;
+  return SearchFirstAndLastCharacter(
+      subject.begin(), index, subject.length() - pattern.length(),
+      static_cast<SubjectChar>(pattern[0]),
+      static_cast<SubjectChar>(pattern[last_offset]), last_offset);
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -269,7 +289,9 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = kHasVectorizedStringSearch
+            ? FindFirstAndLastCharacter(pattern, subject, i)
+            : FindFirstCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
@@ -494,6 +516,11 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
     Vector<const SubjectChar> subject, int index) {
   Vector<const PatternChar> pattern = search->pattern_;
   int pattern_length = pattern.length();
+  if (kHasVectorizedStringSearch) {
+    search->strategy_ = &FirstAndLastCharacterSearch;
+    return FirstAndLastCharacterSearch(search, subject, index);
+  }
+
   // Badness is a count of how much work we have done.  When we have
   // done enough work we decide it's probably worth switching to a better
   // algorithm.
@@ -527,6 +554,39 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   return -1;
 }
 
+//---------------------------------------------------------------------
+// Vectorized first and last character search with bailout to BMH.
+//---------------------------------------------------------------------
+
+// Compares the first and the last character of the pattern against many
+// subject positions at once and only verifies the remaining characters at
+// positions where both match. Like InitialSearch, upgrades to
+// BoyerMooreHorspool if too many candidates turn out not to match.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::FirstAndLastCharacterSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    Vector<const SubjectChar> subject, int index) {
+  Vector<const PatternChar> pattern = search->pattern_;
+  int pattern_length = pattern.length();
+  int badness = -10 - (pattern_length << 2);
+
+  for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
+    i = FindFirstAndLastCharacter(pattern, subject, i);
+    if (i == -1) return -1;
+    DCHECK_LE(i, n);
+    int j = 1;
+    while (j < pattern_length - 1 && pattern[j] == subject[i + j]) j++;
+    if (j == pattern_length - 1) return i;
+    badness += j;
+    if (badness > 0) {
+      search->PopulateBoyerMooreHorspoolTable();
+      search->strategy_ = &BoyerMooreHorspoolSearch;
+      return BoyerMooreHorspoolSearch(search, subject, i + 1);
+    }
+  }
+  return -1;
+}
+
 // Perform a a single stand-alone search.
 // If searching multiple times for the same pattern, a search
 // object should be constructed once and the Search function then called
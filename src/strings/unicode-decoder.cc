@@ -10,6 +10,22 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Returns the length of the run of ASCII characters at |cursor| that can be
+// handled in bulk, which may be shorter than the actual run. Text outside of
+// ASCII often still has long ASCII runs, e.g. markup or whitespace.
+int AsciiRunLength(const uint8_t* cursor, const uint8_t* end,
+                   unibrow::Utf8::State state) {
+  if (state != unibrow::Utf8::State::kAccept ||
+      *cursor > unibrow::Utf8::kMaxOneByteChar) {
+    return 0;
+  }
+  return NonAsciiStart(cursor, static_cast<int>(end - cursor));
+}
+
+}  // namespace
+
 Utf8Decoder::Utf8Decoder(const Vector<const uint8_t>& chars)
     : encoding_(Encoding::kAscii),
       non_ascii_start_(NonAsciiStart(chars.begin(), chars.length())),
@@ -24,6 +40,12 @@ Utf8Decoder::Utf8Decoder(const Vector<const uint8_t>& chars)
   unibrow::Utf8::State state = unibrow::Utf8::State::kAccept;
 
   while (cursor < end) {
+    int ascii_length = AsciiRunLength(cursor, end, state);
+    if (ascii_length > 0) {
+      cursor += ascii_length;
+      utf16_length_ += ascii_length;
+      continue;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -55,6 +77,13 @@ void Utf8Decoder::Decode(Char* out, const Vector<const uint8_t>& data) {
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
+    int ascii_length = AsciiRunLength(cursor, end, state);
+    if (ascii_length > 0) {
+      CopyChars(out, cursor, ascii_length);
+      cursor += ascii_length;
+      out += ascii_length;
+      continue;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
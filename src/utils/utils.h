@@ -332,16 +332,40 @@ class SetOncePointer {
   T* pointer_ = nullptr;
 };
 
+// Returns the number of leading chars that are equal in |lhs| and |rhs|,
+// rounded down to a multiple of kCompareCharsBlockSize. Blocks are compared
+// without early exits so that the compiler can vectorize the inner loop, which
+// it can't do for a plain loop returning at the first difference.
+constexpr size_t kCompareCharsBlockSize = 16;
+
+template <typename lchar, typename rchar>
+inline size_t SkipEqualCharBlocks(const lchar* lhs, const rchar* rhs,
+                                  size_t chars) {
+  size_t i = 0;
+  for (; i + kCompareCharsBlockSize <= chars; i += kCompareCharsBlockSize) {
+    uint32_t diff = 0;
+    for (size_t j = 0; j < kCompareCharsBlockSize; ++j) {
+      diff |= static_cast<uint32_t>(lhs[i + j]) ^
+              static_cast<uint32_t>(rhs[i + j]);
+    }
+    if (diff != 0) break;
+  }
+  return i;
+}
+
 // Compare 8bit/16bit chars to 8bit/16bit chars.
 template <typename lchar, typename rchar>
 inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
                                 size_t chars) {
-  const lchar* limit = lhs + chars;
   if (sizeof(*lhs) == sizeof(char) && sizeof(*rhs) == sizeof(char)) {
     // memcmp compares byte-by-byte, yielding wrong results for two-byte
     // strings on little-endian systems.
     return memcmp(lhs, rhs, chars);
   }
+  size_t skipped = SkipEqualCharBlocks(lhs, rhs, chars);
+  lhs += skipped;
+  rhs += skipped;
+  const lchar* limit = lhs + (chars - skipped);
   while (lhs < limit) {
     int r = static_cast<int>(*lhs) - static_cast<int>(*rhs);
     if (r != 0) return r;
@@ -376,6 +400,33 @@ inline int CompareChars(const lchar* lhs, const rchar* rhs, size_t chars) {
   }
 }
 
+// Compare 8bit/16bit chars to 8bit/16bit chars for equality only.
+template <typename lchar, typename rchar>
+inline bool CompareCharsEqualUnsigned(const lchar* lhs, const rchar* rhs,
+                                      size_t chars) {
+  STATIC_ASSERT(std::is_unsigned<lchar>::value);
+  STATIC_ASSERT(std::is_unsigned<rchar>::value);
+  if (sizeof(*lhs) == sizeof(*rhs)) {
+    // memcmp compares byte-by-byte, but for equality it doesn't matter in
+    // which order the bytes of a char are compared.
+    return memcmp(lhs, rhs, chars * sizeof(*lhs)) == 0;
+  }
+  size_t skipped = SkipEqualCharBlocks(lhs, rhs, chars);
+  for (size_t i = skipped; i < chars; ++i) {
+    if (lhs[i] != rhs[i]) return false;
+  }
+  return true;
+}
+
+template <typename lchar, typename rchar>
+inline bool CompareCharsEqual(const lchar* lhs, const rchar* rhs,
+                              size_t chars) {
+  using ulchar = typename std::make_unsigned<lchar>::type;
+  using urchar = typename std::make_unsigned<rchar>::type;
+  return CompareCharsEqualUnsigned(reinterpret_cast<const ulchar*>(lhs),
+                                   reinterpret_cast<const urchar*>(rhs), chars);
+}
+
 // Calculate 10^exponent.
 inline int TenToThe(int exponent) {
   DCHECK_LE(exponent, 9);
@@ -478,6 +478,60 @@ inline Register CalculateActualAddress(LiftoffAssembler* lasm,
 
 enum class Binop { kAdd, kSub, kAnd, kOr, kXor, kExchange };
 
+// Emits a single LSE instruction for the read-modify-write. LSE has no atomic
+// subtract or and, so those add the negated value and clear the inverted one.
+inline void AtomicBinopLse(LiftoffAssembler* lasm, Register actual_addr,
+                           Register value, Register result_reg, Register temp,
+                           StoreType type, Binop op) {
+  if (op == Binop::kSub) {
+    __ Neg(temp, value.X());
+    value = temp;
+  } else if (op == Binop::kAnd) {
+    __ Mvn(temp, value.X());
+    value = temp;
+  }
+
+#define LSE_BINOP(instr)                                   \
+  switch (type.value()) {                                  \
+    case StoreType::kI64Store8:                            \
+    case StoreType::kI32Store8:                            \
+      __ instr##b(value.W(), result_reg.W(), actual_addr); \
+      break;                                               \
+    case StoreType::kI64Store16:                           \
+    case StoreType::kI32Store16:                           \
+      __ instr##h(value.W(), result_reg.W(), actual_addr); \
+      break;                                               \
+    case StoreType::kI64Store32:                           \
+    case StoreType::kI32Store:                             \
+      __ instr(value.W(), result_reg.W(), actual_addr);    \
+      break;                                               \
+    case StoreType::kI64Store:                             \
+      __ instr(value.X(), result_reg.X(), actual_addr);    \
+      break;                                               \
+    default:                                               \
+      UNREACHABLE();                                       \
+  }
+  switch (op) {
+    case Binop::kAdd:
+    case Binop::kSub:
+      LSE_BINOP(ldaddal)
+      break;
+    case Binop::kAnd:
+      LSE_BINOP(ldclral)
+      break;
+    case Binop::kOr:
+      LSE_BINOP(ldsetal)
+      break;
+    case Binop::kXor:
+      LSE_BINOP(ldeoral)
+      break;
+    case Binop::kExchange:
+      LSE_BINOP(swpal)
+      break;
+  }
+#undef LSE_BINOP
+}
+
 inline void AtomicBinop(LiftoffAssembler* lasm, Register dst_addr,
                         Register offset_reg, uint32_t offset_imm,
                         LiftoffRegister value, LiftoffRegister result,
@@ -502,6 +556,14 @@ inline void AtomicBinop(LiftoffAssembler* lasm, Register dst_addr,
   // the same register.
   Register temp = temps.AcquireX();
 
+  if (CpuFeatures::IsSupported(LSE)) {
+    AtomicBinopLse(lasm, actual_addr, value.gp(), result_reg, temp, type, op);
+    if (result_reg != result.gp()) {
+      __ mov(result.gp(), result_reg);
+    }
+    return;
+  }
+
   Label retry;
   __ Bind(&retry);
   switch (type.value()) {
@@ -689,6 +751,37 @@ void LiftoffAssembler::AtomicCompareExchange(
   Register actual_addr = liftoff::CalculateActualAddress(
       this, dst_addr, offset_reg, offset_imm, temps.AcquireX());
 
+  if (CpuFeatures::IsSupported(LSE)) {
+    // The compare only looks at the low bits of {expected}.
+    switch (type.value()) {
+      case StoreType::kI64Store8:
+      case StoreType::kI32Store8:
+        mov(result_reg.W(), expected.gp().W());
+        casalb(result_reg.W(), new_value.gp().W(), actual_addr);
+        break;
+      case StoreType::kI64Store16:
+      case StoreType::kI32Store16:
+        mov(result_reg.W(), expected.gp().W());
+        casalh(result_reg.W(), new_value.gp().W(), actual_addr);
+        break;
+      case StoreType::kI64Store32:
+      case StoreType::kI32Store:
+        mov(result_reg.W(), expected.gp().W());
+        casal(result_reg.W(), new_value.gp().W(), actual_addr);
+        break;
+      case StoreType::kI64Store:
+        mov(result_reg.X(), expected.gp().X());
+        casal(result_reg.X(), new_value.gp().X(), actual_addr);
+        break;
+      default:
+        UNREACHABLE();
+    }
+    if (result_reg != result.gp()) {
+      mov(result.gp(), result_reg);
+    }
+    return;
+  }
+
   Register store_result = temps.AcquireW();
 
   Label retry;
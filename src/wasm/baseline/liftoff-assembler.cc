@@ -683,6 +683,26 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsForLoop(const BitVector* assigned) {
+  constexpr unsigned kMaxKeptGpRegs = kGpCacheRegList.GetNumRegsSet() / 2;
+  constexpr unsigned kMaxKeptFpRegs = kFpCacheRegList.GetNumRegsSet() / 2;
+  LiftoffRegList kept_regs;
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState* slot = &cache_state_.stack_state[i];
+    if (slot->is_reg() && assigned != nullptr &&
+        assigned->Contains(static_cast<int>(i))) {
+      LiftoffRegList regs = kept_regs;
+      regs.set(slot->reg());
+      if ((regs & kGpCacheRegList).GetNumRegsSet() <= kMaxKeptGpRegs &&
+          (regs & kFpCacheRegList).GetNumRegsSet() <= kMaxKeptFpRegs) {
+        kept_regs = regs;
+        continue;
+      }
+    }
+    Spill(slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
@@ -24,6 +24,7 @@ namespace v8 {
 namespace internal {
 
 // Forward declarations.
+class BitVector;
 namespace compiler {
 class CallDescriptor;
 }  // namespace compiler
@@ -390,6 +391,10 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spill locals before entering a loop, but keep the locals in {assigned}
+  // (i.e. locals which are written in the loop) in their registers, as long as
+  // they occupy at most half of the cache registers.
+  void SpillLocalsForLoop(const BitVector* assigned);
   void SpillAllRegisters();
 
   // Clear any uses of {reg} in both the cache and in {possible_uses}.
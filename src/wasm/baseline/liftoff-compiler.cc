@@ -858,10 +858,17 @@ class LiftoffCompiler {
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // into registers at branches. Locals which are written in the loop are
+    // loop-carried; with --liftoff-loop-registers we keep (some of) them in
+    // registers, so they do not have to be reloaded in every iteration.
+    if (FLAG_liftoff_loop_registers && !for_debugging_) {
+      // The '+ 1' leaves room for the bit which tracks calls and memory.grow.
+      BitVector* assigned = WasmDecoder<validate>::AnalyzeLoopAssignment(
+          decoder, decoder->pc(), __ num_locals() + 1, decoder->zone());
+      __ SpillLocalsForLoop(assigned);
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
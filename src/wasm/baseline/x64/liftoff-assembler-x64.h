@@ -2297,13 +2297,23 @@ void LiftoffAssembler::LoadTransform(LiftoffRegister dst, Register src_addr,
   } else {
     DCHECK_EQ(LoadTransformationKind::kSplat, transform);
     if (memtype == MachineType::Int8()) {
-      Pinsrb(dst.fp(), dst.fp(), src_op, 0);
-      Pxor(kScratchDoubleReg, kScratchDoubleReg);
-      Pshufb(dst.fp(), kScratchDoubleReg);
+      if (CpuFeatures::IsSupported(AVX2)) {
+        CpuFeatureScope avx2_scope(this, AVX2);
+        vpbroadcastb(dst.fp(), src_op);
+      } else {
+        Pinsrb(dst.fp(), dst.fp(), src_op, 0);
+        Pxor(kScratchDoubleReg, kScratchDoubleReg);
+        Pshufb(dst.fp(), kScratchDoubleReg);
+      }
     } else if (memtype == MachineType::Int16()) {
-      Pinsrw(dst.fp(), dst.fp(), src_op, 0);
-      Pshuflw(dst.fp(), dst.fp(), uint8_t{0});
-      Punpcklqdq(dst.fp(), dst.fp());
+      if (CpuFeatures::IsSupported(AVX2)) {
+        CpuFeatureScope avx2_scope(this, AVX2);
+        vpbroadcastw(dst.fp(), src_op);
+      } else {
+        Pinsrw(dst.fp(), dst.fp(), src_op, 0);
+        Pshuflw(dst.fp(), dst.fp(), uint8_t{0});
+        Punpcklqdq(dst.fp(), dst.fp());
+      }
     } else if (memtype == MachineType::Int32()) {
       if (CpuFeatures::IsSupported(AVX)) {
         CpuFeatureScope avx_scope(this, AVX);
@@ -2371,6 +2381,11 @@ void LiftoffAssembler::emit_i8x16_swizzle(LiftoffRegister dst,
 void LiftoffAssembler::emit_i8x16_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Movd(dst.fp(), src.gp());
+  if (CpuFeatures::IsSupported(AVX2)) {
+    CpuFeatureScope avx2_scope(this, AVX2);
+    vpbroadcastb(dst.fp(), dst.fp());
+    return;
+  }
   Pxor(kScratchDoubleReg, kScratchDoubleReg);
   Pshufb(dst.fp(), kScratchDoubleReg);
 }
@@ -2378,6 +2393,11 @@ void LiftoffAssembler::emit_i8x16_splat(LiftoffRegister dst,
 void LiftoffAssembler::emit_i16x8_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Movd(dst.fp(), src.gp());
+  if (CpuFeatures::IsSupported(AVX2)) {
+    CpuFeatureScope avx2_scope(this, AVX2);
+    vpbroadcastw(dst.fp(), dst.fp());
+    return;
+  }
   Pshuflw(dst.fp(), dst.fp(), static_cast<uint8_t>(0));
   Pshufd(dst.fp(), dst.fp(), static_cast<uint8_t>(0));
 }
@@ -2385,6 +2405,11 @@ void LiftoffAssembler::emit_i16x8_splat(LiftoffRegister dst,
 void LiftoffAssembler::emit_i32x4_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Movd(dst.fp(), src.gp());
+  if (CpuFeatures::IsSupported(AVX2)) {
+    CpuFeatureScope avx2_scope(this, AVX2);
+    vpbroadcastd(dst.fp(), dst.fp());
+    return;
+  }
   Pshufd(dst.fp(), dst.fp(), static_cast<uint8_t>(0));
 }
 
@@ -858,22 +858,32 @@ const WasmCompilationHint* GetCompilationHint(const WasmModule* module,
 CompileStrategy GetCompileStrategy(const WasmModule* module,
                                    const WasmFeatures& enabled_features,
                                    uint32_t func_index, bool lazy_module) {
-  if (lazy_module) return CompileStrategy::kLazy;
-  if (!enabled_features.has_compilation_hints()) {
-    return CompileStrategy::kDefault;
-  }
-  auto* hint = GetCompilationHint(module, func_index);
-  if (hint == nullptr) return CompileStrategy::kDefault;
-  switch (hint->strategy) {
-    case WasmCompilationHintStrategy::kLazy:
-      return CompileStrategy::kLazy;
-    case WasmCompilationHintStrategy::kEager:
-      return CompileStrategy::kEager;
-    case WasmCompilationHintStrategy::kLazyBaselineEagerTopTier:
+  // An explicit per-function hint takes precedence over the strategy of the
+  // module, so hot functions can be compiled eagerly in lazy modules.
+  if (enabled_features.has_compilation_hints()) {
+    auto* hint = GetCompilationHint(module, func_index);
+    if (hint != nullptr) {
+      switch (hint->strategy) {
+        case WasmCompilationHintStrategy::kLazy:
+          return CompileStrategy::kLazy;
+        case WasmCompilationHintStrategy::kEager:
+          return CompileStrategy::kEager;
+        case WasmCompilationHintStrategy::kLazyBaselineEagerTopTier:
+          return CompileStrategy::kLazyBaselineEagerTopTier;
+        case WasmCompilationHintStrategy::kDefault:
+          break;
+      }
+    }
+  }
+  if (lazy_module) {
+    // Lazy asm.js modules can still be compiled in the background, with calls
+    // compiling on the main thread until the background code is published.
+    if (FLAG_asm_wasm_background_compilation && is_asmjs_module(module)) {
       return CompileStrategy::kLazyBaselineEagerTopTier;
-    case WasmCompilationHintStrategy::kDefault:
-      return CompileStrategy::kDefault;
+    }
+    return CompileStrategy::kLazy;
   }
+  return CompileStrategy::kDefault;
 }
 
 struct ExecutionTierPair {
@@ -889,6 +899,15 @@ ExecutionTierPair GetRequestedExecutionTiers(
   result.baseline_tier = WasmCompilationUnit::GetBaselineExecutionTier(module);
   switch (compile_mode) {
     case CompileMode::kRegular:
+      // Without tier-up there is only one tier, which a hint can still pick.
+      if (enabled_features.has_compilation_hints()) {
+        const WasmCompilationHint* hint =
+            GetCompilationHint(module, func_index);
+        if (hint != nullptr) {
+          result.baseline_tier = ApplyHintToExecutionTier(hint->baseline_tier,
+                                                          result.baseline_tier);
+        }
+      }
       result.top_tier = result.baseline_tier;
       return result;
 
@@ -959,8 +978,8 @@ class CompilationUnitBuilder {
     // unit is added even if the baseline tier is the same.
 #ifdef DEBUG
     auto* module = native_module_->module();
-    DCHECK_EQ(kWasmOrigin, module->origin);
-    const bool lazy_module = false;
+    const bool lazy_module = is_asmjs_module(module);
+    DCHECK_IMPLIES(!lazy_module, kWasmOrigin == module->origin);
     DCHECK_EQ(CompileStrategy::kLazyBaselineEagerTopTier,
               GetCompileStrategy(module, native_module_->enabled_features(),
                                  func_index, lazy_module));
@@ -1086,6 +1105,13 @@ bool CompileLazy(Isolate* isolate, NativeModule* native_module,
   DCHECK(!native_module->lazy_compile_frozen());
   NativeModuleModificationScope native_module_modification_scope(native_module);
 
+  // Functions of a lazily deserialized module are copied from the cached code
+  // instead, if it contains code for them.
+  if (LazilyDeserializeFunction(isolate, native_module, func_index)) {
+    TRACE_LAZY("Deserialized wasm-function#%d.\n", func_index);
+    return true;
+  }
+
   TRACE_LAZY("Compiling wasm-function#%d.\n", func_index);
 
   CompilationStateImpl* compilation_state =
@@ -1142,6 +1168,11 @@ bool CompileLazy(Isolate* isolate, NativeModule* native_module,
 
 void TriggerTierUp(Isolate* isolate, NativeModule* native_module,
                    int func_index) {
+  // Calls that were already executing Liftoff code can still reach this after
+  // the TurboFan code got published; do not queue the function again.
+  if (native_module->HasCodeWithTier(func_index, ExecutionTier::kTurbofan)) {
+    return;
+  }
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
@@ -1717,6 +1748,116 @@ void AsyncCompileJob::Abort() {
   isolate_->wasm_engine()->RemoveCompileJob(this);
 }
 
+namespace {
+
+// Validates lazily compiled functions on background threads while the module
+// is still streaming in (see {--wasm-background-lazy-validation}). Shared
+// between the {AsyncStreamingProcessor} and its job, which can outlive it.
+class StreamingLazyValidation {
+ public:
+  using FunctionBodies = std::vector<std::pair<int, Vector<const uint8_t>>>;
+
+  StreamingLazyValidation(std::shared_ptr<const WasmModule> module,
+                          std::shared_ptr<WireBytesStorage> wire_bytes_storage,
+                          std::shared_ptr<Counters> counters,
+                          AccountingAllocator* allocator,
+                          WasmFeatures enabled_features)
+      : module_(std::move(module)),
+        wire_bytes_storage_(std::move(wire_bytes_storage)),
+        counters_(std::move(counters)),
+        allocator_(allocator),
+        enabled_features_(enabled_features) {}
+
+  void AddBatch(FunctionBodies batch) {
+    DCHECK(!batch.empty());
+    base::MutexGuard guard(&mutex_);
+    batches_.push(std::move(batch));
+    num_pending_batches_.store(batches_.size(), std::memory_order_relaxed);
+  }
+
+  // Validates the next batch of functions. Returns false if there is none.
+  bool ValidateNextBatch() {
+    FunctionBodies batch;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (batches_.empty()) return false;
+      batch = std::move(batches_.front());
+      batches_.pop();
+      num_pending_batches_.store(batches_.size(), std::memory_order_relaxed);
+      // Batches are in function order; nothing after an invalid function
+      // can change the reported error.
+      if (batch.front().first > error_func_index_) return true;
+    }
+    for (auto& function : batch) {
+      // The function bodies point into the code section buffer, which is kept
+      // alive by {wire_bytes_storage_}.
+      DecodeResult result =
+          ValidateSingleFunction(module_.get(), function.first, function.second,
+                                 counters_.get(), allocator_, enabled_features_);
+      if (result.failed()) {
+        base::MutexGuard guard(&mutex_);
+        if (function.first < error_func_index_) {
+          error_func_index_ = function.first;
+          error_ = std::move(result).error();
+        }
+        break;
+      }
+    }
+    return true;
+  }
+
+  size_t NumPendingBatches() const {
+    return num_pending_batches_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the error of the invalid function with the lowest index, like
+  // sequential validation would report it, or an empty error. Only final
+  // after all batches were validated.
+  WasmError error() {
+    base::MutexGuard guard(&mutex_);
+    return error_;
+  }
+
+ private:
+  const std::shared_ptr<const WasmModule> module_;
+  const std::shared_ptr<WireBytesStorage> wire_bytes_storage_;
+  const std::shared_ptr<Counters> counters_;
+  AccountingAllocator* const allocator_;
+  const WasmFeatures enabled_features_;
+
+  base::Mutex mutex_;
+  std::queue<FunctionBodies> batches_;
+  std::atomic<size_t> num_pending_batches_{0};
+  int error_func_index_ = kMaxInt;
+  WasmError error_;
+};
+
+class LazyValidationJob final : public JobTask {
+ public:
+  explicit LazyValidationJob(
+      std::shared_ptr<StreamingLazyValidation> validation)
+      : validation_(std::move(validation)) {}
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0("v8.wasm", "wasm.ValidateFunctionsInBackground");
+    while (validation_->ValidateNextBatch()) {
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t flag_limit =
+        static_cast<size_t>(std::max(1, FLAG_wasm_num_compilation_tasks));
+    return std::min(flag_limit,
+                    worker_count + validation_->NumPendingBatches());
+  }
+
+ private:
+  const std::shared_ptr<StreamingLazyValidation> validation_;
+};
+
+}  // namespace
+
 class AsyncStreamingProcessor final : public StreamingProcessor {
  public:
   explicit AsyncStreamingProcessor(AsyncCompileJob* job,
@@ -1755,6 +1896,10 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void CommitCompilationUnits();
 
+  // Hands the lazily compiled functions received since the last call to the
+  // background validation job.
+  void ScheduleLazyValidation();
+
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   WasmEngine* wasm_engine_;
@@ -1765,6 +1910,11 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   std::shared_ptr<Counters> async_counters_;
   AccountingAllocator* allocator_;
 
+  // Only set with {--wasm-background-lazy-validation}.
+  std::shared_ptr<StreamingLazyValidation> lazy_validation_;
+  StreamingLazyValidation::FunctionBodies pending_lazy_validation_;
+  std::unique_ptr<JobHandle> lazy_validation_job_;
+
   // Running hash of the wire bytes up to code section size, but excluding the
   // code section itself. Used by the {NativeModuleCache} to detect potential
   // duplicate modules.
@@ -2368,6 +2518,9 @@ AsyncStreamingProcessor::AsyncStreamingProcessor(
       allocator_(allocator) {}
 
 AsyncStreamingProcessor::~AsyncStreamingProcessor() {
+  if (lazy_validation_job_ && lazy_validation_job_->IsValid()) {
+    lazy_validation_job_->Cancel();
+  }
   if (job_->native_module_ && job_->native_module_->wire_bytes().empty()) {
     // Clean up the temporary cache entry.
     job_->isolate_->wasm_engine()->StreamingCompilationFailed(prefix_hash_);
@@ -2480,6 +2633,11 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
   }
 
   decoder_.set_code_section(offset, static_cast<uint32_t>(code_section_length));
+  if (FLAG_wasm_background_lazy_validation) {
+    lazy_validation_ = std::make_shared<StreamingLazyValidation>(
+        decoder_.shared_module(), wire_bytes_storage, async_counters_,
+        wasm_engine_->allocator(), job_->enabled_features_);
+  }
 
   prefix_hash_ = base::hash_combine(prefix_hash_,
                                     static_cast<uint32_t>(code_section_length));
@@ -2545,7 +2703,10 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(Vector<const uint8_t> bytes,
       !FLAG_wasm_lazy_validation &&
       (strategy == CompileStrategy::kLazy ||
        strategy == CompileStrategy::kLazyBaselineEagerTopTier);
-  if (validate_lazily_compiled_function) {
+  if (validate_lazily_compiled_function && lazy_validation_) {
+    // Validated in the background, see {ScheduleLazyValidation}.
+    pending_lazy_validation_.emplace_back(static_cast<int>(func_index), bytes);
+  } else if (validate_lazily_compiled_function) {
     // The native module does not own the wire bytes until {SetWireBytes} is
     // called in {OnFinishedStream}. Validation must use {bytes} parameter.
     DecodeResult result =
@@ -2585,15 +2746,41 @@ void AsyncStreamingProcessor::CommitCompilationUnits() {
   compilation_unit_builder_->Commit();
 }
 
+void AsyncStreamingProcessor::ScheduleLazyValidation() {
+  DCHECK(lazy_validation_);
+  if (pending_lazy_validation_.empty()) return;
+  lazy_validation_->AddBatch(std::move(pending_lazy_validation_));
+  pending_lazy_validation_.clear();
+  if (lazy_validation_job_) {
+    lazy_validation_job_->NotifyConcurrencyIncrease();
+    return;
+  }
+  lazy_validation_job_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<LazyValidationJob>(lazy_validation_));
+}
+
 void AsyncStreamingProcessor::OnFinishedChunk() {
   TRACE_STREAMING("FinishChunk...\n");
   if (compilation_unit_builder_) CommitCompilationUnits();
+  // Validate the functions of this chunk while the next one is downloading.
+  if (lazy_validation_) ScheduleLazyValidation();
 }
 
 // Finish the processing of the stream.
 void AsyncStreamingProcessor::OnFinishedStream(OwnedVector<uint8_t> bytes) {
   TRACE_STREAMING("Finish stream...\n");
   DCHECK_EQ(NativeModuleCache::PrefixHash(bytes.as_vector()), prefix_hash_);
+  if (lazy_validation_) {
+    ScheduleLazyValidation();
+    // Contribute to the remaining validation and wait for the workers.
+    if (lazy_validation_job_) lazy_validation_job_->Join();
+    WasmError error = lazy_validation_->error();
+    if (error.has_error()) {
+      FinishAsyncCompileJobWithError(error);
+      return;
+    }
+  }
   ModuleResult result = decoder_.FinishDecoding(false);
   if (result.failed()) {
     FinishAsyncCompileJobWithError(result.error());
@@ -2783,8 +2970,12 @@ void CompilationStateImpl::InitializeCompilationProgress(
         RequiredTopTierField::update(function_progress, required_top_tier);
     compilation_progress_.push_back(function_progress);
   }
-  DCHECK_IMPLIES(lazy_module, outstanding_baseline_units_ == 0);
-  DCHECK_IMPLIES(lazy_module, outstanding_top_tier_functions_ == 0);
+  // Hints can request eager compilation of single functions in lazy modules.
+  DCHECK_IMPLIES(lazy_module && !enabled_features.has_compilation_hints(),
+                 outstanding_baseline_units_ == 0);
+  DCHECK_IMPLIES(lazy_module && !enabled_features.has_compilation_hints() &&
+                     !FLAG_asm_wasm_background_compilation,
+                 outstanding_top_tier_functions_ == 0);
   DCHECK_LE(0, outstanding_baseline_units_);
   DCHECK_LE(outstanding_baseline_units_, outstanding_top_tier_functions_);
   outstanding_baseline_units_ += num_import_wrappers;
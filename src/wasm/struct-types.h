@@ -5,6 +5,7 @@
 #ifndef V8_WASM_STRUCT_TYPES_H_
 #define V8_WASM_STRUCT_TYPES_H_
 
+#include "src/base/bits.h"
 #include "src/base/iterator.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
@@ -58,24 +59,26 @@ class StructType : public ZoneObject {
 
   uint32_t field_offset(uint32_t index) const {
     DCHECK_LT(index, field_count());
-    if (index == 0) return 0;
-    return field_offsets_[index - 1];
-  }
-  uint32_t total_fields_size() const {
-    return field_count() == 0 ? 0 : field_offsets_[field_count() - 1];
+    return field_offsets_[index];
   }
+  uint32_t total_fields_size() const { return total_fields_size_; }
 
+  // Fields are laid out by decreasing size, which packs them without any
+  // padding since all sizes are powers of two. Fields of equal size keep
+  // their declaration order.
   void InitializeOffsets() {
-    if (field_count() == 0) return;
-    uint32_t offset = field(0).element_size_bytes();
-    for (uint32_t i = 1; i < field_count(); i++) {
-      uint32_t field_size = field(i).element_size_bytes();
-      offset = RoundUp(offset, field_size);
-      field_offsets_[i - 1] = offset;
-      offset += field_size;
+    uint32_t offset = 0;
+    for (uint32_t size = kMaxFieldSize; size > 0; size >>= 1) {
+      for (uint32_t i = 0; i < field_count(); i++) {
+        uint32_t field_size = field(i).element_size_bytes();
+        DCHECK(base::bits::IsPowerOfTwo(field_size));
+        DCHECK_LE(field_size, kMaxFieldSize);
+        if (field_size != size) continue;
+        field_offsets_[i] = offset;
+        offset += field_size;
+      }
     }
-    offset = RoundUp(offset, kTaggedSize);
-    field_offsets_[field_count() - 1] = offset;
+    total_fields_size_ = RoundUp(offset, kTaggedSize);
   }
 
   // For incrementally building StructTypes.
@@ -110,8 +113,11 @@ class StructType : public ZoneObject {
   };
 
  private:
+  static constexpr uint32_t kMaxFieldSize = kSimd128Size;
+
   const uint32_t field_count_;
   uint32_t* const field_offsets_;
+  uint32_t total_fields_size_ = 0;
   const ValueType* const reps_;
   const bool* const mutabilities_;
 };
@@ -6,6 +6,7 @@
 
 #include <iomanip>
 
+#include "src/base/bits.h"
 #include "src/base/build_config.h"
 #include "src/base/iterator.h"
 #include "src/base/macros.h"
@@ -33,6 +34,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 
 #if defined(V8_OS_WIN64)
 #include "src/diagnostics/unwinding-info-win64.h"
@@ -740,7 +742,8 @@ bool WasmCodeAllocator::SetExecutable(bool executable) {
   return true;
 }
 
-void WasmCodeAllocator::FreeCode(Vector<WasmCode* const> codes) {
+DisjointAllocationPool WasmCodeAllocator::FreeCode(
+    Vector<WasmCode* const> codes) {
   // Zap code area and collect freed code regions.
   DisjointAllocationPool freed_regions;
   size_t code_size = 0;
@@ -785,6 +788,58 @@ void WasmCodeAllocator::FreeCode(Vector<WasmCode* const> codes) {
       code_manager_->Decommit(split_range);
     }
   }
+  return regions_to_decommit;
+}
+
+void WasmCodeAllocator::ReuseDecommittedRegions(
+    const DisjointAllocationPool& regions) {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  size_t commit_page_size = allocator->CommitPageSize();
+  size_t reused_size = 0;
+  base::MutexGuard guard(&mutex_);
+  for (auto region : regions.regions()) {
+    DCHECK(IsAligned(region.begin(), commit_page_size));
+    DCHECK(IsAligned(region.size(), commit_page_size));
+    USE(commit_page_size);
+    // Take the region out of the freed and allocated space, and return it to
+    // the free space. Since it is page-aligned and fully decommitted,
+    // {AllocateForCodeInRegion} will commit it again when allocating in it.
+    base::AddressRegion freed =
+        freed_code_space_.AllocateInRegion(region.size(), region);
+    DCHECK_EQ(region, freed);
+    USE(freed);
+    base::AddressRegion allocated =
+        allocated_code_space_.AllocateInRegion(region.size(), region);
+    DCHECK_EQ(region, allocated);
+    USE(allocated);
+    free_code_space_.Merge(region);
+    reused_size += region.size();
+  }
+  reused_code_size_.fetch_add(reused_size, std::memory_order_relaxed);
+}
+
+WasmCodeAllocator::FragmentationStats WasmCodeAllocator::GetFragmentationStats()
+    const {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  size_t commit_page_size = allocator->CommitPageSize();
+  FragmentationStats stats;
+  base::MutexGuard guard(&mutex_);
+  for (auto region : freed_code_space_.regions()) {
+    // Full pages within freed regions are decommitted.
+    Address full_pages_start = RoundUp(region.begin(), commit_page_size);
+    Address full_pages_end = RoundDown(region.end(), commit_page_size);
+    size_t decommitted_size = full_pages_start < full_pages_end
+                                  ? full_pages_end - full_pages_start
+                                  : 0;
+    stats.freed_committed_size += region.size() - decommitted_size;
+    ++stats.num_freed_regions;
+  }
+  for (auto region : free_code_space_.regions()) {
+    stats.largest_free_region =
+        std::max(stats.largest_free_region, region.size());
+  }
+  stats.reused_code_size = reused_code_size_.load(std::memory_order_relaxed);
+  return stats;
 }
 
 size_t WasmCodeAllocator::GetNumCodeSpaces() const {
@@ -823,10 +878,14 @@ NativeModule::NativeModule(WasmEngine* engine, const WasmFeatures& enabled,
     num_liftoff_function_calls_ =
         std::make_unique<uint32_t[]>(module_->num_declared_functions);
 
-    // Start counter at 4 to avoid runtime calls for smaller numbers.
-    constexpr int kCounterStart = 4;
+    // Liftoff code calls into the runtime whenever the incremented counter
+    // is a power of two. Start the counter at the (rounded up) threshold, so
+    // that the first tier-up request happens after that many calls, and
+    // later ones (with higher priority) each time the count doubles.
+    const uint32_t counter_start = base::bits::RoundUpToPowerOfTwo32(
+        std::max(1u, std::min(FLAG_wasm_tiering_call_threshold, 1u << 30)));
     std::fill_n(num_liftoff_function_calls_.get(),
-                module_->num_declared_functions, kCounterStart);
+                module_->num_declared_functions, counter_start);
   }
   code_allocator_.Init(this);
 }
@@ -1174,7 +1233,7 @@ WasmCode* NativeModule::PublishCodeLocked(std::unique_ptr<WasmCode> code) {
   return result;
 }
 
-WasmCode* NativeModule::AddDeserializedCode(
+std::unique_ptr<WasmCode> NativeModule::AddDeserializedCode(
     int index, Vector<const byte> instructions, int stack_slots,
     int tagged_parameter_slots, int safepoint_table_offset,
     int handler_table_offset, int constant_pool_offset,
@@ -1195,9 +1254,16 @@ WasmCode* NativeModule::AddDeserializedCode(
       reloc_info, source_position_table, kind, tier, kNoDebugging}};
 
   // Note: we do not flush the i-cache here, since the code needs to be
-  // relocated anyway. The caller is responsible for flushing the i-cache later.
+  // relocated anyway. The caller is responsible for flushing the i-cache and
+  // publishing the code later.
 
-  return PublishCode(std::move(code));
+  return code;
+}
+
+void NativeModule::set_lazily_deserialized_code(
+    std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code) {
+  DCHECK_NULL(lazily_deserialized_code_);
+  lazily_deserialized_code_ = std::move(lazily_deserialized_code);
 }
 
 std::vector<WasmCode*> NativeModule::SnapshotCodeTable() const {
@@ -1972,7 +2038,7 @@ std::vector<int> NativeModule::FindFunctionsToRecompile(
 
 void NativeModule::FreeCode(Vector<WasmCode* const> codes) {
   // Free the code space.
-  code_allocator_.FreeCode(codes);
+  DisjointAllocationPool decommitted_regions = code_allocator_.FreeCode(codes);
 
   DebugInfo* debug_info = nullptr;
   {
@@ -1987,6 +2053,12 @@ void NativeModule::FreeCode(Vector<WasmCode* const> codes) {
   // Remove debug side tables for all removed code objects, after releasing our
   // lock. This is to avoid lock order inversion.
   if (debug_info) debug_info->RemoveDebugSideTables(codes);
+
+  // Only now that the {WasmCode} objects are gone, the freed pages can be
+  // handed out for new code.
+  if (FLAG_wasm_reuse_freed_code_space) {
+    code_allocator_.ReuseDecommittedRegions(decommitted_regions);
+  }
 }
 
 size_t NativeModule::GetNumberOfCodeSpacesForTesting() const {
@@ -37,6 +37,7 @@ class Isolate;
 namespace wasm {
 
 class DebugInfo;
+struct LazilyDeserializedCode;
 class NativeModule;
 class WasmCodeManager;
 struct WasmCompilationResult;
@@ -397,6 +398,19 @@ class WasmCodeAllocator {
     WasmCodeAllocator* allocator_ = nullptr;
   };
 
+  struct FragmentationStats {
+    // Freed code which is still committed because it shares pages with live
+    // code.
+    size_t freed_committed_size = 0;
+    // Number of disjoint regions of freed code.
+    size_t num_freed_regions = 0;
+    // Largest contiguous region available for new code.
+    size_t largest_free_region = 0;
+    // Accumulated size of decommitted pages that were made available for new
+    // code again.
+    size_t reused_code_size = 0;
+  };
+
   WasmCodeAllocator(WasmCodeManager*, VirtualMemory code_space,
                     std::shared_ptr<Counters> async_counters);
   ~WasmCodeAllocator();
@@ -428,7 +442,14 @@ class WasmCodeAllocator {
   V8_EXPORT_PRIVATE bool SetExecutable(bool executable);
 
   // Free memory pages of all given code objects. Used for wasm code GC.
-  void FreeCode(Vector<WasmCode* const>);
+  // Returns the (page-aligned) regions which got decommitted.
+  DisjointAllocationPool FreeCode(Vector<WasmCode* const>);
+
+  // Make regions returned by {FreeCode} available for new code again. Must
+  // only be called once no {WasmCode} object refers to them any more.
+  void ReuseDecommittedRegions(const DisjointAllocationPool&);
+
+  FragmentationStats GetFragmentationStats() const;
 
   // Retrieve the number of separately reserved code spaces.
   size_t GetNumCodeSpaces() const;
@@ -463,6 +484,7 @@ class WasmCodeAllocator {
   std::atomic<size_t> committed_code_space_{0};
   std::atomic<size_t> generated_code_size_{0};
   std::atomic<size_t> freed_code_size_{0};
+  std::atomic<size_t> reused_code_size_{0};
 
   bool is_executable_ = false;
 
@@ -493,7 +515,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
   WasmCode* PublishCode(std::unique_ptr<WasmCode>);
   std::vector<WasmCode*> PublishCode(Vector<std::unique_ptr<WasmCode>>);
 
-  WasmCode* AddDeserializedCode(
+  // Returns the new code without publishing it, since it still needs to be
+  // relocated by the caller.
+  std::unique_ptr<WasmCode> AddDeserializedCode(
       int index, Vector<const byte> instructions, int stack_slots,
       int tagged_parameter_slots, int safepoint_table_offset,
       int handler_table_offset, int constant_pool_offset,
@@ -596,6 +620,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
   size_t generated_code_size() const {
     return code_allocator_.generated_code_size();
   }
+  WasmCodeAllocator::FragmentationStats GetCodeFragmentationStats() const {
+    return code_allocator_.GetFragmentationStats();
+  }
   size_t liftoff_bailout_count() const { return liftoff_bailout_count_.load(); }
   size_t liftoff_code_size() const { return liftoff_code_size_.load(); }
   size_t turbofan_code_size() const { return turbofan_code_size_.load(); }
@@ -669,6 +696,15 @@ class V8_EXPORT_PRIVATE NativeModule final {
     return num_liftoff_function_calls_.get();
   }
 
+  // Serialized code of functions that are only deserialized on their first
+  // call (see {--wasm-lazy-deserialization}). Set once during deserialization,
+  // before the module is shared.
+  void set_lazily_deserialized_code(
+      std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code);
+  const LazilyDeserializedCode* lazily_deserialized_code() const {
+    return lazily_deserialized_code_.get();
+  }
+
  private:
   friend class WasmCode;
   friend class WasmCodeAllocator;
@@ -758,6 +794,8 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Array to handle number of function calls.
   std::unique_ptr<uint32_t[]> num_liftoff_function_calls_;
 
+  std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code_;
+
   // This mutex protects concurrent calls to {AddCode} and friends.
   mutable base::Mutex allocation_mutex_;
 
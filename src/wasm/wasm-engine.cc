@@ -158,6 +158,9 @@ class WeakScriptHandle {
 std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
     ModuleOrigin origin, Vector<const uint8_t> wire_bytes) {
   if (origin != kWasmOrigin) return nullptr;
+  // Declared before the lock, so that evicted modules die after it is
+  // released.
+  std::vector<std::shared_ptr<NativeModule>> evicted;
   base::MutexGuard lock(&mutex_);
   size_t prefix_hash = PrefixHash(wire_bytes);
   NativeModuleCache::Key key{prefix_hash, wire_bytes};
@@ -181,6 +184,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
     if (it->second.has_value()) {
       if (auto shared_native_module = it->second.value().lock()) {
         DCHECK_EQ(shared_native_module->wire_bytes(), wire_bytes);
+        Retain(shared_native_module, &evicted);
         return shared_native_module;
       }
     }
@@ -217,6 +221,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
   Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
   DCHECK(!wire_bytes.empty());
   size_t prefix_hash = PrefixHash(native_module->wire_bytes());
+  std::vector<std::shared_ptr<NativeModule>> evicted;
   base::MutexGuard lock(&mutex_);
   map_.erase(Key{prefix_hash, {}});
   const Key key{prefix_hash, wire_bytes};
@@ -226,6 +231,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
       auto conflicting_module = it->second.value().lock();
       if (conflicting_module != nullptr) {
         DCHECK_EQ(conflicting_module->wire_bytes(), wire_bytes);
+        Retain(conflicting_module, &evicted);
         return conflicting_module;
       }
     }
@@ -239,6 +245,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
         key, base::Optional<std::weak_ptr<NativeModule>>(native_module));
     USE(p);
     DCHECK(p.second);
+    Retain(native_module, &evicted);
   }
   cache_cv_.NotifyAll();
   return native_module;
@@ -254,6 +261,43 @@ void NativeModuleCache::Erase(NativeModule* native_module) {
   cache_cv_.NotifyAll();
 }
 
+void NativeModuleCache::ClearRetainedModules() {
+  std::list<std::shared_ptr<NativeModule>> retained;
+  {
+    base::MutexGuard lock(&mutex_);
+    retained.swap(retained_);
+  }
+  // {retained} dies here, outside of {mutex_}.
+}
+
+void NativeModuleCache::Retain(
+    std::shared_ptr<NativeModule> native_module,
+    std::vector<std::shared_ptr<NativeModule>>* evicted) {
+  mutex_.AssertHeld();
+  if (FLAG_wasm_native_module_cache_budget == 0) return;
+  auto it = std::find(retained_.begin(), retained_.end(), native_module);
+  if (it != retained_.end()) {
+    retained_.splice(retained_.begin(), retained_, it);
+  } else {
+    retained_.push_front(std::move(native_module));
+  }
+  // Code size changes as modules tier up, so recompute it every time. The
+  // list only holds a handful of modules.
+  const size_t budget = FLAG_wasm_native_module_cache_budget * MB;
+  size_t total_size = 0;
+  for (auto& module : retained_) {
+    total_size += module->committed_code_space() + module->wire_bytes().size();
+  }
+  while (total_size > budget && !retained_.empty()) {
+    std::shared_ptr<NativeModule>& victim = retained_.back();
+    size_t victim_size =
+        victim->committed_code_space() + victim->wire_bytes().size();
+    total_size -= std::min(total_size, victim_size);
+    evicted->emplace_back(std::move(victim));
+    retained_.pop_back();
+  }
+}
+
 // static
 size_t NativeModuleCache::WireBytesHash(Vector<const uint8_t> bytes) {
   return StringHasher::HashSequentialString(
@@ -395,6 +439,10 @@ WasmEngine::~WasmEngine() {
   gdb_server_.reset();
 #endif  // V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 
+  // Release the modules kept alive by the native module cache, so that they
+  // can die together with all others.
+  native_module_cache_.ClearRetainedModules();
+
   // Collect the live modules into a vector first, then cancel them while
   // releasing our lock. This will allow the background tasks to finish.
   std::vector<std::shared_ptr<NativeModule>> live_modules;
@@ -1301,6 +1349,17 @@ void WasmEngine::FreeDeadCodeLocked(const DeadCodeMap& dead_code) {
       info->dead_code.erase(code);
     }
     native_module->FreeCode(VectorOf(code_vec));
+    if (FLAG_trace_wasm_code_gc) {
+      WasmCodeAllocator::FragmentationStats stats =
+          native_module->GetCodeFragmentationStats();
+      TRACE_CODE_GC(
+          "Module %p: %zu freed region%s (%zu bytes still committed), largest "
+          "free region %zu bytes, %zu bytes reused.\n",
+          native_module, stats.num_freed_regions,
+          stats.num_freed_regions == 1 ? "" : "s",
+          stats.freed_committed_size, stats.largest_free_region,
+          stats.reused_code_size);
+    }
   }
 }
 
@@ -6,6 +6,7 @@
 #define V8_WASM_WASM_ENGINE_H_
 
 #include <algorithm>
+#include <list>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -102,6 +103,11 @@ class NativeModuleCache {
 
   bool empty() { return map_.empty(); }
 
+  // Drops all strong references kept alive by the memory budget. Must be
+  // called without holding the engine's mutex, since this may free native
+  // modules.
+  void ClearRetainedModules();
+
   static size_t WireBytesHash(Vector<const uint8_t> bytes);
 
   // Hash the wire bytes up to the code section header. Used as a heuristic to
@@ -124,6 +130,20 @@ class NativeModuleCache {
   // and will soon be cleaned up from the cache.
   std::map<Key, base::Optional<std::weak_ptr<NativeModule>>> map_;
 
+  // Moves {native_module} to the front of {retained_} and evicts the least
+  // recently used modules until the budget given by
+  // {FLAG_wasm_native_module_cache_budget} is met. Evicted modules are moved
+  // to {evicted} so that the caller can drop them after releasing {mutex_}
+  // ({FreeNativeModule} calls back into {Erase}).
+  void Retain(std::shared_ptr<NativeModule> native_module,
+              std::vector<std::shared_ptr<NativeModule>>* evicted);
+
+  // Strong references to the most recently used native modules, most recent
+  // first. They keep a module and its tiered-up code alive across isolate
+  // lifetimes, so that later isolates compiling the same bytes do not start
+  // again from Liftoff.
+  std::list<std::shared_ptr<NativeModule>> retained_;
+
   base::Mutex mutex_;
 
   // This condition variable is used to synchronize threads compiling the same
@@ -10,6 +10,7 @@
 #include "src/api/api-inl.h"
 #include "src/api/api-natives.h"
 #include "src/ast/ast.h"
+#include "src/builtins/accessors.h"
 #include "src/base/logging.h"
 #include "src/base/overflowing-math.h"
 #include "src/common/assert-scope.h"
@@ -2287,6 +2288,61 @@ void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
                         runtime_error, DONT_ENUM);
 }
 
+namespace {
+
+void WebAssemblyLazyGetter(v8::Local<v8::Name> property,
+                           const v8::PropertyCallbackInfo<v8::Value>& info) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(info.GetIsolate());
+  HandleScope scope(isolate);
+  Handle<JSGlobalObject> holder =
+      Handle<JSGlobalObject>::cast(Utils::OpenHandle(*info.Holder()));
+  {
+    SaveAndSwitchContext saved_context(isolate, holder->native_context());
+    WasmJs::EnsureInstalled(isolate);
+  }
+  Handle<Name> name = Utils::OpenHandle(*property);
+  info.GetReturnValue().Set(
+      Utils::ToLocal(JSReceiver::GetDataProperty(holder, name)));
+}
+
+}  // namespace
+
+// static
+void WasmJs::InstallLazily(Isolate* isolate) {
+  Handle<JSGlobalObject> global = isolate->global_object();
+  Handle<String> name = v8_str(isolate, "WebAssembly");
+  // The default setter reconfigures the accessor to a data property, after
+  // which EnsureInstalled no longer exposes the API on the global object.
+  Handle<AccessorInfo> info = Accessors::MakeAccessor(
+      isolate, name, &WebAssemblyLazyGetter, nullptr);
+  JSObject::SetAccessor(global, name, info, DONT_ENUM).Check();
+}
+
+// static
+void WasmJs::EnsureInstalled(Isolate* isolate) {
+  if (!isolate->native_context()->wasm_module_constructor().IsUndefined(
+          isolate)) {
+    return;
+  }
+  // Drop the lazy accessor installed by InstallLazily (if it is still there),
+  // so that Install can expose the real namespace object in its place.
+  Handle<JSGlobalObject> global = isolate->global_object();
+  Handle<String> name = v8_str(isolate, "WebAssembly");
+  LookupIterator it(isolate, global, name, global,
+                    LookupIterator::OWN_SKIP_INTERCEPTOR);
+  bool exposed_on_global_object = false;
+  if (it.state() == LookupIterator::ACCESSOR) {
+    Handle<Object> accessors = it.GetAccessors();
+    if (accessors->IsAccessorInfo() &&
+        v8::ToCData<Address>(AccessorInfo::cast(*accessors).getter()) ==
+            FUNCTION_ADDR(WebAssemblyLazyGetter)) {
+      JSReceiver::DeleteProperty(&it, LanguageMode::kSloppy).Check();
+      exposed_on_global_object = true;
+    }
+  }
+  Install(isolate, exposed_on_global_object);
+}
+
 namespace {
 void SetMapValue(Isolate* isolate, Handle<JSMap> map, Handle<Object> key,
                  Handle<Object> value) {
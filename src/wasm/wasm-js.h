@@ -22,6 +22,15 @@ class WasmJs {
   V8_EXPORT_PRIVATE static void Install(Isolate* isolate,
                                         bool exposed_on_global_object);
 
+  // Defers {Install} until the "WebAssembly" property of the current global
+  // object is first read, or until a wasm object is first created in the
+  // current native context (see {EnsureInstalled}).
+  static void InstallLazily(Isolate* isolate);
+
+  // Installs the JS API into the current native context unless that already
+  // happened, exposing it on the global object if {InstallLazily} was used.
+  V8_EXPORT_PRIVATE static void EnsureInstalled(Isolate* isolate);
+
   V8_EXPORT_PRIVATE static Handle<JSProxy> GetJSDebugProxy(WasmFrame* frame);
 };
 
@@ -280,9 +280,10 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   bool Write(Writer* writer);
 
  private:
-  size_t MeasureCode(const WasmCode*) const;
+  size_t MeasureCode(const WasmCode*, uint32_t declared_index) const;
   void WriteHeader(Writer*);
-  bool WriteCode(const WasmCode*, Writer*);
+  bool WriteCode(const WasmCode*, uint32_t declared_index, Writer*);
+  Vector<const byte> LazilyDeserializedEntry(uint32_t declared_index) const;
 
   const NativeModule* const native_module_;
   Vector<WasmCode* const> code_table_;
@@ -299,8 +300,22 @@ NativeModuleSerializer::NativeModuleSerializer(
   // the unique ones, i.e. the cache.
 }
 
-size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
-  if (code == nullptr) return sizeof(bool);
+// Functions of a lazily deserialized module that were never called still have
+// their serialized entry, which can be copied verbatim.
+Vector<const byte> NativeModuleSerializer::LazilyDeserializedEntry(
+    uint32_t declared_index) const {
+  const LazilyDeserializedCode* lazy_code =
+      native_module_->lazily_deserialized_code();
+  if (lazy_code == nullptr) return {};
+  return lazy_code->entry(declared_index);
+}
+
+size_t NativeModuleSerializer::MeasureCode(const WasmCode* code,
+                                           uint32_t declared_index) const {
+  if (code == nullptr) {
+    Vector<const byte> entry = LazilyDeserializedEntry(declared_index);
+    return entry.empty() ? sizeof(bool) : entry.size();
+  }
   DCHECK_EQ(WasmCode::kFunction, code->kind());
   if (FLAG_wasm_lazy_compilation && code->tier() != ExecutionTier::kTurbofan) {
     return sizeof(bool);
@@ -312,8 +327,8 @@ size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
 
 size_t NativeModuleSerializer::Measure() const {
   size_t size = kHeaderSize;
-  for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    size += MeasureCode(code_table_[i], i);
   }
   return size;
 }
@@ -326,9 +341,16 @@ void NativeModuleSerializer::WriteHeader(Writer* writer) {
   writer->Write(native_module_->num_imported_functions());
 }
 
-bool NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
-  DCHECK_IMPLIES(!FLAG_wasm_lazy_compilation, code != nullptr);
+bool NativeModuleSerializer::WriteCode(const WasmCode* code,
+                                       uint32_t declared_index,
+                                       Writer* writer) {
   if (code == nullptr) {
+    Vector<const byte> entry = LazilyDeserializedEntry(declared_index);
+    if (!entry.empty()) {
+      writer->WriteVector(entry);
+      return true;
+    }
+    DCHECK(FLAG_wasm_lazy_compilation);
     writer->Write(false);
     return true;
   }
@@ -438,8 +460,8 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 
   WriteHeader(writer);
 
-  for (WasmCode* code : code_table_) {
-    if (!WriteCode(code, writer)) return false;
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    if (!WriteCode(code_table_[i], i, writer)) return false;
   }
   return true;
 }
@@ -473,9 +495,14 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   bool Read(Reader* reader);
 
+  // Reads, relocates and publishes the code of one function. Returns nullptr
+  // if no code was serialized for it.
+  WasmCode* ReadCode(int fn_index, Reader* reader);
+
  private:
   bool ReadHeader(Reader* reader);
-  void ReadCode(int fn_index, Reader* reader);
+  bool ReadLazily(Reader* reader);
+  static bool SkipCode(Reader* reader);
 
   NativeModule* const native_module_;
   bool read_called_;
@@ -491,15 +518,58 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   read_called_ = true;
 
   if (!ReadHeader(reader)) return false;
+  if (FLAG_wasm_lazy_deserialization) return ReadLazily(reader);
   uint32_t total_fns = native_module_->num_functions();
   uint32_t first_wasm_fn = native_module_->num_imported_functions();
   WasmCodeRefScope wasm_code_ref_scope;
   for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
-    ReadCode(i, reader);
+    if (ReadCode(i, reader) == nullptr) {
+      DCHECK(FLAG_wasm_lazy_compilation ||
+             native_module_->enabled_features().has_compilation_hints());
+      native_module_->UseLazyStub(i);
+    }
   }
   return reader->current_size() == 0;
 }
 
+bool NativeModuleDeserializer::ReadLazily(Reader* reader) {
+  uint32_t total_fns = native_module_->num_functions();
+  uint32_t first_wasm_fn = native_module_->num_imported_functions();
+  auto lazy_code = std::make_unique<LazilyDeserializedCode>();
+  // Only index the entries here. Copying and relocating the code of each
+  // function is deferred to its first call (see {LazilyDeserializeFunction}).
+  const size_t start = reader->bytes_read();
+  lazy_code->data = OwnedVector<byte>::Of(reader->current_buffer());
+  lazy_code->offsets.reserve(total_fns - first_wasm_fn + 1);
+  for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+    lazy_code->offsets.push_back(reader->bytes_read() - start);
+    if (!SkipCode(reader)) return false;
+    native_module_->UseLazyStub(i);
+  }
+  lazy_code->offsets.push_back(reader->bytes_read() - start);
+  if (reader->current_size() != 0) return false;
+  native_module_->set_lazily_deserialized_code(std::move(lazy_code));
+  return true;
+}
+
+// static
+bool NativeModuleDeserializer::SkipCode(Reader* reader) {
+  if (reader->current_size() < sizeof(bool)) return false;
+  bool has_code = reader->Read<bool>();
+  if (!has_code) return true;
+  if (reader->current_size() < kCodeHeaderSize - sizeof(bool)) return false;
+  // Skip the offsets and slot counts preceding the sizes of the payload.
+  reader->Skip(7 * sizeof(int));
+  size_t payload_size = reader->Read<int>();   // code size
+  payload_size += reader->Read<int>();         // reloc size
+  payload_size += reader->Read<int>();         // source positions size
+  payload_size += reader->Read<int>();         // protected instructions size
+  reader->Skip(sizeof(WasmCode::Kind) + sizeof(ExecutionTier));
+  if (reader->current_size() < payload_size) return false;
+  reader->Skip(payload_size);
+  return true;
+}
+
 bool NativeModuleDeserializer::ReadHeader(Reader* reader) {
   size_t functions = reader->Read<uint32_t>();
   size_t imports = reader->Read<uint32_t>();
@@ -507,14 +577,9 @@ bool NativeModuleDeserializer::ReadHeader(Reader* reader) {
          imports == native_module_->num_imported_functions();
 }
 
-void NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
+WasmCode* NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
   bool has_code = reader->Read<bool>();
-  if (!has_code) {
-    DCHECK(FLAG_wasm_lazy_compilation ||
-           native_module_->enabled_features().has_compilation_hints());
-    native_module_->UseLazyStub(fn_index);
-    return;
-  }
+  if (!has_code) return nullptr;
   int constant_pool_offset = reader->Read<int>();
   int safepoint_table_offset = reader->Read<int>();
   int handler_table_offset = reader->Read<int>();
@@ -536,7 +601,7 @@ void NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
       reader->ReadVector<byte>(protected_instructions_size);
 
   CODE_SPACE_WRITE_SCOPE
-  WasmCode* code = native_module_->AddDeserializedCode(
+  std::unique_ptr<WasmCode> code = native_module_->AddDeserializedCode(
       fn_index, code_buffer, stack_slot_count, tagged_parameter_slots,
       safepoint_table_offset, handler_table_offset, constant_pool_offset,
       code_comment_offset, unpadded_binary_size, protected_instructions,
@@ -595,6 +660,26 @@ void NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
   // Finally, flush the icache for that code.
   FlushInstructionCache(code->instructions().begin(),
                         code->instructions().size());
+
+  // Only publish the code once it is relocated. With lazy deserialization,
+  // other threads can call the function as soon as it is published.
+  return native_module_->PublishCode(std::move(code));
+}
+
+bool LazilyDeserializeFunction(Isolate* isolate, NativeModule* native_module,
+                               int func_index) {
+  const LazilyDeserializedCode* lazy_code =
+      native_module->lazily_deserialized_code();
+  if (lazy_code == nullptr) return false;
+  Reader reader(lazy_code->entry(
+      declared_function_index(native_module->module(), func_index)));
+  NativeModuleDeserializer deserializer(native_module);
+  WasmCodeRefScope code_ref_scope;
+  WasmCode* code = deserializer.ReadCode(func_index, &reader);
+  if (code == nullptr) return false;
+  DCHECK_EQ(0, reader.current_size());
+  if (WasmCode::ShouldBeLogged(isolate)) code->LogCode(isolate);
+  return true;
 }
 
 bool IsSupportedVersion(Vector<const byte> header) {
@@ -54,6 +54,28 @@ V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate*, Vector<const byte> data, Vector<const byte> wire_bytes,
     Vector<const char> source_url);
 
+// With {--wasm-lazy-deserialization}, {DeserializeNativeModule} only installs
+// lazy stubs and keeps a copy of the serialized code. Each function is copied
+// into the code space and relocated on its first call instead.
+struct LazilyDeserializedCode {
+  // The serialized functions, without the headers.
+  OwnedVector<byte> data;
+  // Start offset of each declared function's entry in {data}, followed by the
+  // end offset of the last one.
+  std::vector<size_t> offsets;
+
+  Vector<const byte> entry(uint32_t declared_index) const {
+    DCHECK_LT(declared_index + 1, offsets.size());
+    return data.as_vector().SubVector(offsets[declared_index],
+                                      offsets[declared_index + 1]);
+  }
+};
+
+// Deserializes the code of function {func_index} of a lazily deserialized
+// module and publishes it. Returns false if the function has no serialized
+// code, in which case it has to be compiled.
+bool LazilyDeserializeFunction(Isolate*, NativeModule*, int func_index);
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
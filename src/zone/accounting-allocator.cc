@@ -6,9 +6,11 @@
 
 #include <memory>
 
+#include "include/v8.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -74,28 +76,31 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ClearPool(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
-    memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
-                           kZonePageSize, PageAllocator::kReadWrite);
-
-  } else {
-    memory = AllocWithRetry(bytes);
+    void* memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
+                                 kZonePageSize, PageAllocator::kReadWrite);
+    if (memory == nullptr) return nullptr;
+    UpdateMemoryUsage(bytes);
+    return new (memory) Segment(bytes);
   }
-  if (memory == nullptr) return nullptr;
 
-  size_t current =
-      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
-  size_t max = max_memory_usage_.load(std::memory_order_relaxed);
-  while (current > max && !max_memory_usage_.compare_exchange_weak(
-                              max, current, std::memory_order_relaxed)) {
-    // {max} was updated by {compare_exchange_weak}; retry.
+  const size_t bucket = PoolBucket(bytes);
+  if (bucket != kNotPooled) {
+    bytes = PoolBucketSize(bucket);
+    if (Segment* segment = GetSegmentFromPool(bucket)) {
+      UpdateMemoryUsage(bytes);
+      reused_segment_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+      return segment;
+    }
   }
+  void* memory = AllocWithRetry(bytes);
+  if (memory == nullptr) return nullptr;
+  UpdateMemoryUsage(bytes);
   DCHECK_LE(sizeof(Segment), bytes);
   return new (memory) Segment(bytes);
 }
@@ -105,11 +110,72 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
-  } else {
-    free(segment);
+    return;
+  }
+  if (AddSegmentToPool(segment)) return;
+  segment->ZapHeader();
+  free(segment);
+}
+
+void AccountingAllocator::MemoryPressureNotification(
+    MemoryPressureLevel level) {
+  if (level != MemoryPressureLevel::kNone) ClearPool();
+}
+
+void AccountingAllocator::UpdateMemoryUsage(size_t bytes) {
+  size_t current =
+      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  size_t max = max_memory_usage_.load(std::memory_order_relaxed);
+  while (current > max && !max_memory_usage_.compare_exchange_weak(
+                              max, current, std::memory_order_relaxed)) {
+    // {max} was updated by {compare_exchange_weak}; retry.
+  }
+}
+
+Segment* AccountingAllocator::GetSegmentFromPool(size_t bucket) {
+  DCHECK_LT(bucket, kNumberOfPoolBuckets);
+  base::MutexGuard guard(&pool_mutex_);
+  Segment* segment = pooled_segments_[bucket];
+  if (segment == nullptr) return nullptr;
+  pooled_segments_[bucket] = segment->next();
+  DCHECK_EQ(PoolBucketSize(bucket), segment->total_size());
+  current_pool_size_.fetch_sub(segment->total_size(),
+                               std::memory_order_relaxed);
+  segment->set_zone(nullptr);
+  segment->set_next(nullptr);
+  return segment;
+}
+
+bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
+  const size_t size = segment->total_size();
+  const size_t bucket = PoolBucket(size);
+  if (bucket == kNotPooled || PoolBucketSize(bucket) != size) return false;
+  base::MutexGuard guard(&pool_mutex_);
+  if (current_pool_size_.load(std::memory_order_relaxed) + size >
+      FLAG_zone_segment_pool_size) {
+    return false;
+  }
+  segment->set_zone(nullptr);
+  segment->set_next(pooled_segments_[bucket]);
+  pooled_segments_[bucket] = segment;
+  current_pool_size_.fetch_add(size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::ClearPool() {
+  base::MutexGuard guard(&pool_mutex_);
+  for (Segment*& head : pooled_segments_) {
+    while (head != nullptr) {
+      Segment* next = head->next();
+      current_pool_size_.fetch_sub(head->total_size(),
+                                   std::memory_order_relaxed);
+      head->ZapHeader();
+      free(head);
+      head = next;
+    }
   }
 }
 
@@ -9,10 +9,14 @@
 #include <memory>
 
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
 
+enum class MemoryPressureLevel;
+
 namespace base {
 class BoundedPageAllocator;
 }  // namespace base
@@ -43,6 +47,19 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Size of segments that are currently kept in the pool for reuse.
+  size_t GetCurrentPoolSize() const {
+    return current_pool_size_.load(std::memory_order_relaxed);
+  }
+
+  // Accumulated size of segments that were served from the pool.
+  size_t GetReusedSegmentBytes() const {
+    return reused_segment_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Releases pooled segments on moderate and critical memory pressure.
+  void MemoryPressureNotification(MemoryPressureLevel level);
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -64,9 +81,42 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments between kPooledSegmentGranularity and kMaxPooledSegmentSize bytes
+  // are allocated in multiples of kPooledSegmentGranularity and are recycled
+  // across zones. Zones start with 8 KB segments and grow them up to 32 KB, so
+  // the pool covers all regular segment sizes.
+  static constexpr size_t kPooledSegmentGranularity = 8 * KB;
+  static constexpr size_t kMaxPooledSegmentSize = 32 * KB;
+  static constexpr size_t kNumberOfPoolBuckets =
+      kMaxPooledSegmentSize / kPooledSegmentGranularity;
+  static constexpr size_t kNotPooled = kNumberOfPoolBuckets;
+
+  static size_t PoolBucket(size_t bytes) {
+    if (bytes < kPooledSegmentGranularity || bytes > kMaxPooledSegmentSize) {
+      return kNotPooled;
+    }
+    return (RoundUp(bytes, kPooledSegmentGranularity) /
+            kPooledSegmentGranularity) -
+           1;
+  }
+  static size_t PoolBucketSize(size_t bucket) {
+    return (bucket + 1) * kPooledSegmentGranularity;
+  }
+
+  void UpdateMemoryUsage(size_t bytes);
+
+  Segment* GetSegmentFromPool(size_t bucket);
+  bool AddSegmentToPool(Segment* segment);
+  void ClearPool();
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  base::Mutex pool_mutex_;
+  Segment* pooled_segments_[kNumberOfPoolBuckets] = {};
+  std::atomic<size_t> current_pool_size_{0};
+  std::atomic<size_t> reused_segment_bytes_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
@@ -0,0 +1,299 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/api/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+namespace {
+
+// Returns an ASCII string of |length| characters with a fixed content.
+std::string MakeAsciiString(size_t length) {
+  std::string result(length, 'a');
+  for (size_t i = 0; i < length; ++i) result[i] = 'a' + i % 26;
+  return result;
+}
+
+// Returns a UTF-8 string of |length| code points, alternating between one-
+// and two-byte encodings so that the result is a two-byte V8 string.
+std::string MakeUtf8String(size_t length) {
+  std::string result;
+  for (size_t i = 0; i < length; ++i) {
+    if (i % 2) {
+      result += "\xc3\xa9";  // U+00E9
+    } else {
+      result += static_cast<char>('a' + i % 26);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(ApiBenchmark, ObjectGet)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Object> object =
+      Run("({x: 1, y: 2, z: 3})")->ToObject(context).ToLocalChecked();
+  v8::Local<v8::String> key = String("y");
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(object->Get(context, key).ToLocalChecked());
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, ObjectGet);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, ObjectGetIndexed)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Object> object =
+      Run("[1, 2, 3, 4]")->ToObject(context).ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(object->Get(context, 2).ToLocalChecked());
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, ObjectGetIndexed);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, ObjectSet)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Object> object =
+      Run("({x: 1, y: 2, z: 3})")->ToObject(context).ToLocalChecked();
+  v8::Local<v8::String> key = String("y");
+  v8::Local<v8::Value> value = v8::Integer::New(isolate(), 42);
+  for (auto _ : st) {
+    USE(_);
+    object->Set(context, key, value).Check();
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, ObjectSet);
+
+// Calls a JS function with st.range(0) arguments.
+BENCHMARK_DEFINE_F(ApiBenchmark, FunctionCall)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Function> function =
+      Run("(function(a, b, c, d) { return a; })").As<v8::Function>();
+  const int argc = static_cast<int>(st.range(0));
+  std::vector<v8::Local<v8::Value>> argv(argc, v8::Integer::New(isolate(), 1));
+  v8::Local<v8::Value> receiver = v8::Undefined(isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(
+        function->Call(context, receiver, argc, argv.data())
+            .ToLocalChecked());
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, FunctionCall)->DenseRange(0, 4, 2);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, StringNewFromUtf8OneByte)
+(benchmark::State& st) {
+  const std::string input = MakeAsciiString(static_cast<size_t>(st.range(0)));
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope scope(isolate());
+    benchmark::DoNotOptimize(
+        v8::String::NewFromUtf8(isolate(), input.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(input.size()))
+            .ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * input.size());
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, StringNewFromUtf8OneByte)
+    ->RangeMultiplier(16)
+    ->Range(8, 1 << 15);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, StringNewFromUtf8TwoByte)
+(benchmark::State& st) {
+  const std::string input = MakeUtf8String(static_cast<size_t>(st.range(0)));
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope scope(isolate());
+    benchmark::DoNotOptimize(
+        v8::String::NewFromUtf8(isolate(), input.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(input.size()))
+            .ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * input.size());
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, StringNewFromUtf8TwoByte)
+    ->RangeMultiplier(16)
+    ->Range(8, 1 << 15);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, StringWriteUtf8)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  const std::string input = MakeUtf8String(static_cast<size_t>(st.range(0)));
+  v8::Local<v8::String> string =
+      v8::String::NewFromUtf8(isolate(), input.data(),
+                              v8::NewStringType::kNormal,
+                              static_cast<int>(input.size()))
+          .ToLocalChecked();
+  std::vector<char> buffer(string->Utf8Length(isolate()));
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(string->WriteUtf8(
+        isolate(), buffer.data(), static_cast<int>(buffer.size()), nullptr,
+        v8::String::NO_NULL_TERMINATION));
+  }
+  st.SetBytesProcessed(st.iterations() * buffer.size());
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, StringWriteUtf8)
+    ->RangeMultiplier(16)
+    ->Range(8, 1 << 15);
+
+// Opens a HandleScope and creates st.range(0) handles in it.
+BENCHMARK_DEFINE_F(ApiBenchmark, HandleScope)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Object> object = v8::Object::New(isolate());
+  const int handles = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    for (int i = 0; i < handles; ++i) {
+      benchmark::DoNotOptimize(v8::Local<v8::Object>::New(isolate(), object));
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, HandleScope)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(1024)
+    ->Arg(4096);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, EscapableHandleScope)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Object> object = v8::Object::New(isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope outer_scope(isolate());
+    v8::EscapableHandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(
+        inner_scope.Escape(v8::Local<v8::Object>::New(isolate(), object)));
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, EscapableHandleScope);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, ContextEnter)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> other = v8::Context::New(isolate());
+  for (auto _ : st) {
+    USE(_);
+    other->Enter();
+    other->Exit();
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, ContextEnter);
+
+namespace {
+
+const char kSerializedObjectSource[] =
+    "({id: 12345, name: 'benchmark', flags: [true, false, null],"
+    "  nested: {x: 1.5, y: -2, tags: ['a', 'b', 'c']}})";
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(ApiBenchmark, ValueSerializer)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Value> value = Run(kSerializedObjectSource);
+  size_t bytes = 0;
+  for (auto _ : st) {
+    USE(_);
+    v8::ValueSerializer serializer(isolate());
+    serializer.WriteHeader();
+    serializer.WriteValue(context, value).Check();
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    bytes += buffer.second;
+    free(buffer.first);
+  }
+  st.SetBytesProcessed(bytes);
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, ValueSerializer);
+
+BENCHMARK_DEFINE_F(ApiBenchmark, ValueDeserializer)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  std::pair<uint8_t*, size_t> buffer;
+  {
+    v8::ValueSerializer serializer(isolate());
+    serializer.WriteHeader();
+    serializer.WriteValue(context, Run(kSerializedObjectSource)).Check();
+    buffer = serializer.Release();
+  }
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    v8::ValueDeserializer deserializer(isolate(), buffer.first, buffer.second);
+    deserializer.ReadHeader(context).Check();
+    benchmark::DoNotOptimize(deserializer.ReadValue(context).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * buffer.second);
+  free(buffer.first);
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, ValueDeserializer);
+
+// Cost of a TryCatch around a call that doesn't throw.
+BENCHMARK_DEFINE_F(ApiBenchmark, TryCatch)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Function> function =
+      Run("(function() { return 1; })").As<v8::Function>();
+  v8::Local<v8::Value> receiver = v8::Undefined(isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    v8::TryCatch try_catch(isolate());
+    benchmark::DoNotOptimize(
+        function->Call(context, receiver, 0, nullptr).ToLocalChecked());
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, TryCatch);
+
+// Cost of catching an exception thrown by a called function.
+BENCHMARK_DEFINE_F(ApiBenchmark, TryCatchThrow)(benchmark::State& st) {
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Function> function =
+      Run("(function() { throw 1; })").As<v8::Function>();
+  v8::Local<v8::Value> receiver = v8::Undefined(isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope inner_scope(isolate());
+    v8::TryCatch try_catch(isolate());
+    benchmark::DoNotOptimize(function->Call(context, receiver, 0, nullptr));
+    benchmark::DoNotOptimize(try_catch.Exception());
+  }
+}
+
+BENCHMARK_REGISTER_F(ApiBenchmark, TryCatchThrow);
+
+}  // namespace benchmarking
+}  // namespace v8
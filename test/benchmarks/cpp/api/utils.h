@@ -0,0 +1,87 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_API_UTILS_H_
+#define TEST_BENCHMARK_CPP_API_UTILS_H_
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+
+// Initializes V8 once per process. Background tasks are disabled and the
+// seeds are fixed so that runs are comparable across builds and machines.
+inline void EnsureV8Initialized() {
+  static std::unique_ptr<v8::Platform> platform = [] {
+    v8::V8::SetFlagsFromString(
+        "--single-threaded --random-seed=1234 --hash-seed=1234");
+    auto platform = v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+    return platform;
+  }();
+  USE(platform);
+}
+
+// Provides an isolate with an entered context for the duration of a
+// benchmark run. Benchmarks allocate their handles in a HandleScope of their
+// own.
+class ApiBenchmark : public benchmark::Fixture {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    EnsureV8Initialized();
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    isolate_ = v8::Isolate::New(create_params);
+    isolate_->Enter();
+    v8::HandleScope scope(isolate_);
+    v8::Local<v8::Context> context = v8::Context::New(isolate_);
+    context->Enter();
+    context_.Reset(isolate_, context);
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    {
+      v8::HandleScope scope(isolate_);
+      context()->Exit();
+    }
+    context_.Reset();
+    isolate_->Exit();
+    isolate_->Dispose();
+    isolate_ = nullptr;
+  }
+
+  v8::Isolate* isolate() const { return isolate_; }
+  v8::Local<v8::Context> context() const {
+    return v8::Local<v8::Context>::New(isolate_, context_);
+  }
+
+  v8::Local<v8::Value> Run(const char* source) {
+    v8::Local<v8::Context> context = this->context();
+    return v8::Script::Compile(context, String(source))
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+  }
+
+  v8::Local<v8::String> String(const char* value) {
+    return v8::String::NewFromUtf8(isolate_, value).ToLocalChecked();
+  }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace benchmarking
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_API_UTILS_H_
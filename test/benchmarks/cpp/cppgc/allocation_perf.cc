@@ -2,8 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <memory>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/heap.h"
+#include "include/cppgc/platform.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap.h"
 #include "test/benchmarks/cpp/cppgc/utils.h"
@@ -44,6 +48,28 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+// cppgc heaps are bound to the thread that created them. Multi-threaded
+// embedders use one heap per mutator thread, which also gives each thread its
+// own linear allocation buffers. This measures how allocation throughput
+// scales with the number of such threads.
+void AllocateTinyOnThreadLocalHeap(benchmark::State& st) {
+  static std::shared_ptr<testing::TestPlatform> platform = [] {
+    auto platform = std::make_shared<testing::TestPlatform>();
+    cppgc::InitializeProcess(platform->GetPageAllocator());
+    return platform;
+  }();
+  std::unique_ptr<cppgc::Heap> heap = cppgc::Heap::Create(platform);
+  {
+    Heap::NoGCScope no_gc(*Heap::From(heap.get()));
+    for (auto _ : st) {
+      benchmark::DoNotOptimize(cppgc::MakeGarbageCollected<TinyObject>(
+          heap->GetAllocationHandle()));
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
+}
+BENCHMARK(AllocateTinyOnThreadLocalHeap)->ThreadRange(1, 8)->UseRealTime();
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
@@ -0,0 +1,88 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if defined(CPPGC_YOUNG_GENERATION)
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using MinorGC = testing::BenchmarkWithHeap;
+
+class Node final : public cppgc::GarbageCollected<Node> {
+ public:
+  void Trace(cppgc::Visitor* visitor) const { visitor->Trace(next); }
+
+  cppgc::Member<Node> next;
+};
+
+constexpr size_t kOldObjects = 100000;
+constexpr size_t kYoungObjectsPerCycle = 10000;
+
+// Builds a long-lived list and promotes it to the old generation.
+cppgc::Persistent<Node> AllocateOldList(cppgc::Heap& heap) {
+  cppgc::Persistent<Node> head =
+      cppgc::MakeGarbageCollected<Node>(heap.GetAllocationHandle());
+  Node* current = head.Get();
+  for (size_t i = 1; i < kOldObjects; ++i) {
+    current->next =
+        cppgc::MakeGarbageCollected<Node>(heap.GetAllocationHandle());
+    current = current->next.Get();
+  }
+  Heap::From(&heap)->CollectGarbage(Heap::Config::PreciseAtomicConfig());
+  return head;
+}
+
+void AllocateShortLivedObjects(cppgc::Heap& heap, Node* old) {
+  for (size_t i = 0; i < kYoungObjectsPerCycle; ++i) {
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<Node>(heap.GetAllocationHandle()));
+  }
+  // Keep one young object alive through the remembered set.
+  old->next = cppgc::MakeGarbageCollected<Node>(heap.GetAllocationHandle());
+}
+
+BENCHMARK_F(MinorGC, ShortLivedObjects)(benchmark::State& st) {
+  cppgc::Persistent<Node> old_list = AllocateOldList(heap());
+  for (auto _ : st) {
+    st.PauseTiming();
+    AllocateShortLivedObjects(heap(), old_list.Get());
+    st.ResumeTiming();
+    Heap::From(&heap())->CollectGarbage(
+        Heap::Config::MinorPreciseAtomicConfig());
+  }
+}
+
+BENCHMARK_F(MinorGC, ShortLivedObjectsWithMajorGC)(benchmark::State& st) {
+  cppgc::Persistent<Node> old_list = AllocateOldList(heap());
+  for (auto _ : st) {
+    st.PauseTiming();
+    AllocateShortLivedObjects(heap(), old_list.Get());
+    st.ResumeTiming();
+    Heap::From(&heap())->CollectGarbage(Heap::Config::PreciseAtomicConfig());
+  }
+}
+
+BENCHMARK_F(MinorGC, GenerationalBarrier)(benchmark::State& st) {
+  cppgc::Persistent<Node> old_list = AllocateOldList(heap());
+  Node* young = cppgc::MakeGarbageCollected<Node>(heap().GetAllocationHandle());
+  for (auto _ : st) {
+    old_list->next = young;
+  }
+  Heap::From(&heap())->CollectGarbage(Heap::Config::MinorPreciseAtomicConfig());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
+
+#endif  // defined(CPPGC_YOUNG_GENERATION)
@@ -0,0 +1,288 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <vector>
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/platform.h"
+#include "include/cppgc/visitor.h"
+#include "include/libplatform/libplatform.h"
+#include "include/v8-cppgc.h"
+#include "include/v8.h"
+#include "src/api/api-inl.h"
+#include "src/heap/cppgc-js/cpp-heap.h"
+#include "src/heap/cppgc/sweeper.h"
+#include "src/heap/heap.h"
+#include "src/heap/incremental-marking.h"
+#include "src/heap/mark-compact.h"
+#include "src/heap/safepoint.h"
+#include "src/objects/objects-inl.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+// Fan-out of the DOM-like tree.
+constexpr size_t kChildrenPerNode = 4;
+
+// Initializes V8 once per process. Benchmarks create a fresh isolate for each
+// run, the platform is kept alive until the process exits.
+void EnsureV8Initialized() {
+  static std::unique_ptr<v8::Platform> platform = [] {
+    auto platform = v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+    cppgc::InitializeProcess(platform->GetPageAllocator());
+    return platform;
+  }();
+  USE(platform);
+}
+
+// C++ side of a DOM node, e.g. an element. Children are referenced through
+// cppgc::Member, the JS wrapper through TracedReference.
+class Node final : public cppgc::GarbageCollected<Node> {
+ public:
+  void Trace(cppgc::Visitor* visitor) const {
+    visitor->Trace(first_child_);
+    visitor->Trace(next_sibling_);
+    visitor->Trace(wrapper_);
+  }
+
+  void AppendChild(Node* child) {
+    child->next_sibling_ = first_child_;
+    first_child_ = child;
+  }
+
+  void SetWrapper(v8::Isolate* isolate, v8::Local<v8::Object> wrapper) {
+    wrapper_.Reset(isolate, wrapper);
+  }
+
+ private:
+  cppgc::Member<Node> first_child_;
+  cppgc::Member<Node> next_sibling_;
+  v8::TracedReference<v8::Object> wrapper_;
+};
+
+class UnifiedHeapBenchmark : public benchmark::Fixture {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    EnsureV8Initialized();
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    v8_isolate_ = v8::Isolate::New(create_params);
+    v8_isolate_->Enter();
+    cpp_heap_ = std::make_unique<CppHeap>(
+        v8_isolate_, std::vector<std::unique_ptr<cppgc::CustomSpaceBase>>());
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    heap()->SetEmbedderHeapTracer(nullptr);
+    cpp_heap_.reset();
+    v8_isolate_->Exit();
+    v8_isolate_->Dispose();
+    v8_isolate_ = nullptr;
+  }
+
+  v8::Isolate* v8_isolate() const { return v8_isolate_; }
+  Heap* heap() const { return reinterpret_cast<Isolate*>(v8_isolate_)->heap(); }
+
+  void AttachCppHeap() { heap()->SetEmbedderHeapTracer(cpp_heap_.get()); }
+
+  // Builds a tree of |num_nodes| nodes. Each node consists of a JS wrapper
+  // (API object pointing to its C++ node), an expando object on the wrapper,
+  // and the C++ node. Returns the wrapper of the root node.
+  v8::Local<v8::Object> BuildUnifiedGraph(v8::Local<v8::Context> context,
+                                          size_t num_nodes) {
+    v8::EscapableHandleScope scope(v8_isolate_);
+    v8::Local<v8::ObjectTemplate> wrapper_template =
+        v8::ObjectTemplate::New(v8_isolate_);
+    wrapper_template->SetInternalFieldCount(2);
+    std::vector<Node*> nodes;
+    nodes.reserve(num_nodes);
+    v8::Local<v8::Object> root;
+    for (size_t i = 0; i < num_nodes; ++i) {
+      v8::HandleScope inner_scope(v8_isolate_);
+      Node* node =
+          cppgc::MakeGarbageCollected<Node>(cpp_heap_->object_allocator());
+      v8::Local<v8::Object> wrapper =
+          wrapper_template->NewInstance(context).ToLocalChecked();
+      wrapper->SetAlignedPointerInInternalField(0, node);
+      wrapper->SetAlignedPointerInInternalField(1, node);
+      AddExpando(context, wrapper);
+      node->SetWrapper(v8_isolate_, wrapper);
+      if (i == 0) {
+        root = scope.Escape(wrapper);
+      } else {
+        nodes[(i - 1) / kChildrenPerNode]->AppendChild(node);
+      }
+      nodes.push_back(node);
+    }
+    return root;
+  }
+
+  // Builds a tree of |num_nodes| plain JS objects with the same shape as the
+  // unified graph. Serves as a baseline for the embedder tracing overhead.
+  v8::Local<v8::Object> BuildJSGraph(v8::Local<v8::Context> context,
+                                     size_t num_nodes) {
+    v8::EscapableHandleScope scope(v8_isolate_);
+    v8::Local<v8::String> first_child_name = InternalizedString("firstChild");
+    v8::Local<v8::String> next_sibling_name =
+        InternalizedString("nextSibling");
+    v8::Local<v8::Array> nodes = v8::Array::New(v8_isolate_);
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+      v8::HandleScope inner_scope(v8_isolate_);
+      v8::Local<v8::Object> node = v8::Object::New(v8_isolate_);
+      AddExpando(context, node);
+      if (i > 0) {
+        v8::Local<v8::Object> parent =
+            nodes->Get(context, (i - 1) / kChildrenPerNode)
+                .ToLocalChecked()
+                .As<v8::Object>();
+        v8::Local<v8::Value> first_child =
+            parent->Get(context, first_child_name).ToLocalChecked();
+        node->Set(context, next_sibling_name, first_child).Check();
+        parent->Set(context, first_child_name, node).Check();
+      }
+      nodes->Set(context, i, node).Check();
+    }
+    return scope.Escape(
+        nodes->Get(context, 0).ToLocalChecked().As<v8::Object>());
+  }
+
+  void FullGC() {
+    heap()->SetEmbedderStackStateForNextFinalization(
+        EmbedderHeapTracer::EmbedderStackState::kNoHeapPointers);
+    heap()->CollectAllGarbage(Heap::kNoGCFlags,
+                              GarbageCollectionReason::kTesting);
+  }
+
+  // Completes sweeping on both heaps to avoid attributing it to marking.
+  void FinishSweeping() {
+    MarkCompactCollector* collector = heap()->mark_compact_collector();
+    if (collector->sweeping_in_progress()) {
+      SafepointScope scope(heap());
+      collector->EnsureSweepingCompleted();
+    }
+    cpp_heap_->sweeper().FinishIfRunning();
+  }
+
+ private:
+  void AddExpando(v8::Local<v8::Context> context,
+                  v8::Local<v8::Object> object) {
+    v8::Local<v8::Object> expando = v8::Object::New(v8_isolate_);
+    object->Set(context, InternalizedString("expando"), expando).Check();
+  }
+
+  v8::Local<v8::String> InternalizedString(const char* value) {
+    return v8::String::NewFromUtf8(v8_isolate_, value,
+                                   v8::NewStringType::kInternalized)
+        .ToLocalChecked();
+  }
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* v8_isolate_ = nullptr;
+  std::unique_ptr<CppHeap> cpp_heap_;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(UnifiedHeapBenchmark, FullMarking)
+(benchmark::State& st) {
+  AttachCppHeap();
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  const size_t num_nodes = static_cast<size_t>(st.range(0));
+  v8::Global<v8::Object> root(v8_isolate(),
+                              BuildUnifiedGraph(context, num_nodes));
+  FinishSweeping();
+  for (auto _ : st) {
+    USE(_);
+    FullGC();
+    st.PauseTiming();
+    FinishSweeping();
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * num_nodes);
+}
+
+BENCHMARK_REGISTER_F(UnifiedHeapBenchmark, FullMarking)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 16);
+
+// Same graph shape as FullMarking without any C++ objects. The difference to
+// FullMarking is the overhead of tracing through the embedder.
+BENCHMARK_DEFINE_F(UnifiedHeapBenchmark, FullMarkingJSOnly)
+(benchmark::State& st) {
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  const size_t num_nodes = static_cast<size_t>(st.range(0));
+  v8::Global<v8::Object> root(v8_isolate(), BuildJSGraph(context, num_nodes));
+  FinishSweeping();
+  for (auto _ : st) {
+    USE(_);
+    FullGC();
+    st.PauseTiming();
+    FinishSweeping();
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * num_nodes);
+}
+
+BENCHMARK_REGISTER_F(UnifiedHeapBenchmark, FullMarkingJSOnly)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 16);
+
+// Measures incremental marking steps that interleave V8 and embedder tracing.
+// Only the steps are timed, the finalizing atomic pause is excluded.
+BENCHMARK_DEFINE_F(UnifiedHeapBenchmark, IncrementalMarkingSteps)
+(benchmark::State& st) {
+  static constexpr double kStepSizeInMs = 1.0;
+  AttachCppHeap();
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  const size_t num_nodes = static_cast<size_t>(st.range(0));
+  v8::Global<v8::Object> root(v8_isolate(),
+                              BuildUnifiedGraph(context, num_nodes));
+  FinishSweeping();
+  IncrementalMarking* marking = heap()->incremental_marking();
+  size_t steps = 0;
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    heap()->StartIncrementalMarking(Heap::kNoGCFlags,
+                                    GarbageCollectionReason::kTesting);
+    st.ResumeTiming();
+    while (!marking->IsComplete()) {
+      marking->Step(kStepSizeInMs, IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+                    StepOrigin::kV8);
+      if (marking->IsReadyToOverApproximateWeakClosure()) {
+        SafepointScope safepoint_scope(heap());
+        marking->FinalizeIncrementally();
+      }
+      ++steps;
+    }
+    st.PauseTiming();
+    FullGC();
+    FinishSweeping();
+    st.ResumeTiming();
+  }
+  st.counters["steps"] = benchmark::Counter(static_cast<double>(steps),
+                                            benchmark::Counter::kIsRate);
+  st.SetItemsProcessed(st.iterations() * num_nodes);
+}
+
+BENCHMARK_REGISTER_F(UnifiedHeapBenchmark, IncrementalMarkingSteps)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 16);
+
+}  // namespace internal
+}  // namespace v8
@@ -386,7 +386,8 @@ class TestEnvironment : public HandleAndZoneScope {
   static constexpr int kDoubleConstantCount = 4;
 
   TestEnvironment()
-      : blocks_(1, NewBlock(main_zone(), RpoNumber::FromInt(0)), main_zone()),
+      : HandleAndZoneScope(kCompressInstructionZone),
+        blocks_(1, NewBlock(main_zone(), RpoNumber::FromInt(0)), main_zone()),
         instructions_(main_isolate(), main_zone(), &blocks_),
         rng_(CcTest::random_number_generator()),
         supported_reps_({MachineRepresentation::kTagged,
@@ -25,7 +25,7 @@ InstructionBlocks* CreateSingleBlock(Zone* zone) {
 class InstructionSchedulerTester {
  public:
   InstructionSchedulerTester()
-      : scope_(kCompressGraphZone),
+      : scope_(kCompressInstructionZone),
         blocks_(CreateSingleBlock(scope_.main_zone())),
         sequence_(scope_.main_isolate(), scope_.main_zone(), blocks_),
         scheduler_(scope_.main_zone(), &sequence_) {}
@@ -50,6 +50,18 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  void CheckOperandDefinition(Instruction* instr, Instruction* definition) {
+    ZoneDeque<InstructionScheduler::ScheduleGraphNode*>& definitions =
+        GetNode(instr)->operand_definitions();
+    CHECK_NE(std::find(definitions.begin(), definitions.end(),
+                       GetNode(definition)),
+             definitions.end());
+  }
+
+  void CheckUnscheduledUses(Instruction* instr, int uses) {
+    CHECK_EQ(uses, GetNode(instr)->unscheduled_uses());
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -107,6 +119,45 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(LiveValuesInBasicBlock) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  tester.StartBlock();
+  InstructionOperand def_output =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  Instruction* def_inst =
+      Instruction::New(zone, kArchNop, 1, &def_output, 0, nullptr, 0, nullptr);
+  tester.AddInstruction(def_inst);
+  InstructionOperand use_output =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1);
+  InstructionOperand use_input =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  Instruction* use_inst = Instruction::New(zone, kArchNop, 1, &use_output, 1,
+                                           &use_input, 0, nullptr);
+  tester.AddInstruction(use_inst);
+  InstructionOperand last_use_inputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0),
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1),
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1)};
+  Instruction* last_use_inst = Instruction::New(
+      zone, kArchNop, 0, nullptr, 3, last_use_inputs, 0, nullptr);
+  tester.AddInstruction(last_use_inst);
+  Instruction* ret_inst = Instruction::New(zone, kArchRet);
+  tester.AddTerminator(ret_inst);
+
+  // Check that uses are counted once per instruction.
+  tester.CheckUnscheduledUses(def_inst, 2);
+  tester.CheckUnscheduledUses(use_inst, 1);
+  tester.CheckUnscheduledUses(last_use_inst, 0);
+  tester.CheckOperandDefinition(use_inst, def_inst);
+  tester.CheckOperandDefinition(last_use_inst, def_inst);
+  tester.CheckOperandDefinition(last_use_inst, use_inst);
+
+  // Schedule block. This checks that no values are live at its end.
+  tester.EndBlock();
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -277,7 +277,7 @@ TEST(InstructionAddGapMove) {
 
 TEST(InstructionOperands) {
   v8::internal::AccountingAllocator allocator;
-  Zone zone(&allocator, ZONE_NAME);
+  Zone zone(&allocator, ZONE_NAME, kCompressInstructionZone);
 
   {
     TestInstr* i = TestInstr::New(&zone, 101);
@@ -15,7 +15,7 @@ namespace compiler {
 class TestCode : public HandleAndZoneScope {
  public:
   TestCode()
-      : HandleAndZoneScope(),
+      : HandleAndZoneScope(kCompressInstructionZone),
         blocks_(main_zone()),
         sequence_(main_isolate(), main_zone(), &blocks_),
         rpo_number_(RpoNumber::FromInt(0)),
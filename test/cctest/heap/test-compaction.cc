@@ -491,6 +491,66 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+HEAP_TEST(CompactionUpdatesSplitLargeObjectSlotSets) {
+  if (FLAG_never_compact) return;
+  // Test that the slots of a large array, whose slot sets are updated by
+  // several items in parallel, point to the evacuated and promoted objects.
+  ManualGCScope manual_gc_scope;
+  FLAG_manual_evacuation_candidates_selection = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  {
+    HandleScope scope1(isolate);
+
+    heap::SealCurrentObjects(heap);
+
+    CHECK(heap->old_space()->Expand());
+    auto compaction_page_handles = heap::CreatePadding(
+        heap,
+        static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+        AllocationType::kOld);
+    Page* to_be_evacuated_page =
+        Page::FromHeapObject(*compaction_page_handles.front());
+    to_be_evacuated_page->SetFlag(
+        MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+    CheckAllObjectsOnPage(compaction_page_handles, to_be_evacuated_page);
+
+    // The slot set of the array spans several regular pages.
+    const int kLength = static_cast<int>(4 * Page::kPageSize / kTaggedSize);
+    Handle<FixedArray> array =
+        factory->NewFixedArray(kLength, AllocationType::kOld);
+    MemoryChunk* array_chunk = MemoryChunk::FromHeapObject(*array);
+    CHECK(array_chunk->IsLargePage());
+    CHECK_GT(array_chunk->buckets(), SlotSet::BucketsForSize(Page::kPageSize));
+    const size_t num_handles = compaction_page_handles.size();
+    for (int i = 0; i < kLength; i++) {
+      HandleScope scope2(isolate);
+      if (i % 2 == 0) {
+        array->set(i, *compaction_page_handles[i % num_handles]);
+      } else {
+        array->set(i, *factory->NewHeapNumber(i));
+      }
+    }
+
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+    for (int i = 0; i < kLength; i++) {
+      Object value = array->get(i);
+      CHECK(!Heap::InYoungGeneration(value));
+      if (i % 2 == 0) {
+        CHECK_EQ(*compaction_page_handles[i % num_handles], value);
+        CHECK_NE(to_be_evacuated_page,
+                 Page::FromHeapObject(HeapObject::cast(value)));
+      } else {
+        CHECK_EQ(i, HeapNumber::cast(value).value());
+      }
+    }
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
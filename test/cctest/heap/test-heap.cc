@@ -1142,6 +1142,69 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestAdaptiveBytecodeFlushing) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+#endif  // V8_LITE_MODE
+  // Optimizing for size makes the heap optimize for memory usage, so that
+  // bytecode gets old sooner.
+  i::FLAG_optimize_for_size = true;
+  i::FLAG_adaptive_bytecode_flushing = true;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+
+    Heap* heap = i_isolate->heap();
+    size_t flushed_functions = heap->flushed_functions();
+    size_t flushed_bytecode_size = heap->flushed_bytecode_size();
+    size_t recompiled_flushed_functions =
+        heap->recompiled_flushed_functions();
+
+    // The bytecode is flushed one GC sooner than without adaptive flushing.
+    for (int i = 0; i < 3; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!function->shared().is_compiled());
+    CHECK_LT(flushed_functions, heap->flushed_functions());
+    CHECK_LT(flushed_bytecode_size, heap->flushed_bytecode_size());
+
+    // Call foo to get it recompiled.
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK_EQ(recompiled_flushed_functions + 1,
+             heap->recompiled_flushed_functions());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -2558,6 +2621,48 @@ TEST(OptimizedPretenuringObjectArrayLiterals) {
   CHECK(CcTest::heap()->InOldSpace(*o));
 }
 
+TEST(EagerPretenuringObjectArrayLiterals) {
+  FLAG_allow_natives_syntax = true;
+  FLAG_expose_gc = true;
+  FLAG_eager_allocation_site_pretenuring = true;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer() || FLAG_always_opt) return;
+  if (FLAG_gc_global || FLAG_stress_compaction ||
+      FLAG_stress_incremental_marking) {
+    return;
+  }
+  v8::HandleScope scope(CcTest::isolate());
+
+  // The new space is not grown to its maximum capacity, the site is tenured
+  // after reaching the pretenuring ratio in two GCs.
+  i::ScopedVector<char> source(1024);
+  i::SNPrintF(source,
+              "var number_elements = %d;"
+              "var elements = new Array(number_elements);"
+              "function f() {"
+              "  for (var i = 0; i < number_elements; i++) {"
+              "    elements[i] = [{}, {}, {}];"
+              "  }"
+              "  return elements[number_elements - 1];"
+              "};"
+              "%%PrepareFunctionForOptimization(f);"
+              "f(); gc();"
+              "f(); gc();"
+              "f(); f();"
+              "%%OptimizeFunctionOnNextCall(f);"
+              "f();",
+              kPretenureCreationCount);
+
+  v8::Local<v8::Value> res = CompileRun(source.begin());
+
+  i::Handle<JSObject> o = Handle<JSObject>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Object>::Cast(res)));
+
+  CHECK(CcTest::heap()->InOldSpace(o->elements()));
+  CHECK(CcTest::heap()->InOldSpace(*o));
+}
+
+
 TEST(OptimizedPretenuringNestedInObjectProperties) {
   FLAG_allow_natives_syntax = true;
   FLAG_expose_gc = true;
@@ -3543,10 +3648,10 @@ void DetailedErrorStackTraceTest(const char* src,
   Isolate* isolate = CcTest::i_isolate();
   Handle<Name> key = isolate->factory()->stack_trace_symbol();
 
-  Handle<FixedArray> stack_trace(Handle<FixedArray>::cast(
+  Handle<FrameArray> stack_trace(Handle<FrameArray>::cast(
       Object::GetProperty(isolate, exception, key).ToHandleChecked()));
 
-  test(GetFrameArrayFromStackTrace(isolate, stack_trace));
+  test(stack_trace);
 }
 
 // * Test interpreted function error
@@ -6915,6 +7020,30 @@ TEST(Regress8014) {
   CHECK_LE(heap->ms_count(), ms_count + 10);
 }
 
+TEST(FlushOptimizedCodeOnMemoryPressure) {
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_flush_optimized_code_on_memory_pressure = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  Handle<JSFunction> foo = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("function foo(a) { return a + 1; };"
+                                        "%PrepareFunctionForOptimization(foo);"
+                                        "foo(1); foo(2);"
+                                        "%OptimizeFunctionOnNextCall(foo);"
+                                        "foo(3);"
+                                        "foo")));
+  CHECK(foo->HasAttachedOptimizedCode());
+
+  isolate->heap()->MemoryPressureNotification(MemoryPressureLevel::kCritical,
+                                              true);
+  CHECK(!foo->HasAttachedOptimizedCode());
+  CHECK_EQ(*BUILTIN_CODE(isolate, CompileLazy), foo->code());
+  ExpectInt32("foo(4)", 5);
+}
+
 TEST(Regress8617) {
   ManualGCScope manual_gc_scope;
   FLAG_manual_evacuation_candidates_selection = true;
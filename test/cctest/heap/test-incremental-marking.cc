@@ -118,6 +118,36 @@ TEST(IncrementalMarkingUsingTasks) {
   CHECK(marking->IsStopped());
 }
 
+TEST(FinalizeIncrementalMarkingIfFits) {
+  if (!i::FLAG_incremental_marking) return;
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  i::Heap* heap = CcTest::heap();
+  i::IncrementalMarking* marking = heap->incremental_marking();
+  CcTest::CollectAllGarbage();
+  CHECK(marking->IsStopped());
+
+  v8::GarbageCollectionCostEstimate estimate;
+  isolate->GetGarbageCollectionCostEstimate(&estimate);
+  CHECK_LE(0, estimate.scavenge_in_ms());
+  CHECK_EQ(0, estimate.incremental_marking_step_in_ms());
+  CHECK_EQ(0, estimate.marking_finalization_in_ms());
+  CHECK(!isolate->FinalizeIncrementalMarkingIfFits(1000));
+
+  i::heap::SimulateIncrementalMarking(heap, false);
+  CHECK(marking->IsMarking());
+  isolate->GetGarbageCollectionCostEstimate(&estimate);
+  CHECK_LT(0, estimate.incremental_marking_step_in_ms());
+  CHECK_LT(0, estimate.marking_finalization_in_ms());
+  // A zero budget never fits.
+  CHECK(!isolate->FinalizeIncrementalMarkingIfFits(0));
+  CHECK(marking->IsMarking());
+  CHECK(isolate->FinalizeIncrementalMarkingIfFits(
+      estimate.marking_finalization_in_ms()));
+  CHECK(marking->IsStopped());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
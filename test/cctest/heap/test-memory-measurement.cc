@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/memory-measurement-inl.h"
 #include "src/heap/memory-measurement.h"
 #include "test/cctest/cctest.h"
@@ -286,6 +287,67 @@ TEST(PartiallyInitializedContext) {
   isolate->RegisterDeserializerFinished();
 }
 
+namespace {
+struct ContextAllocationBudgetData {
+  int calls = 0;
+  v8::Global<v8::Context> context;
+  size_t allocated_bytes = 0;
+};
+
+void ContextAllocationBudgetCallback(v8::Local<v8::Context> context,
+                                     size_t allocated_bytes, void* data) {
+  ContextAllocationBudgetData* budget_data =
+      reinterpret_cast<ContextAllocationBudgetData*>(data);
+  budget_data->calls++;
+  budget_data->context.Reset(context->GetIsolate(), context);
+  budget_data->allocated_bytes = allocated_bytes;
+}
+}  // anonymous namespace
+
+TEST(ContextAllocationBudget) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> tracked = v8::Context::New(isolate);
+  v8::Local<v8::Context> untracked = v8::Context::New(isolate);
+  const size_t kBudget = 256 * KB;
+  const char* kAllocate =
+      "var a = [];"
+      "for (var i = 0; i < 100000; i++) a.push({x: i});";
+
+  ContextAllocationBudgetData data;
+  isolate->SetContextAllocationBudgetCallback(ContextAllocationBudgetCallback,
+                                              &data);
+  isolate->SetContextAllocationBudget(tracked, kBudget);
+
+  {
+    v8::Context::Scope context_scope(untracked);
+    CompileRun(kAllocate);
+  }
+  CHECK_EQ(0, data.calls);
+
+  {
+    v8::Context::Scope context_scope(tracked);
+    CompileRun(kAllocate);
+  }
+  CHECK_EQ(1, data.calls);
+  CHECK(data.context.Get(isolate) == tracked);
+  CHECK_LT(kBudget, data.allocated_bytes);
+
+  // The callback is invoked once per budget.
+  {
+    v8::Context::Scope context_scope(tracked);
+    CompileRun(kAllocate);
+  }
+  CHECK_EQ(1, data.calls);
+
+  // Removing the budget stops accounting.
+  isolate->SetContextAllocationBudget(tracked, 0);
+  CHECK_EQ(0, CcTest::heap()->context_allocation_tracker()->AllocatedBytes(
+                  *GetNativeContext(CcTest::i_isolate(), tracked)));
+  isolate->SetContextAllocationBudgetCallback(nullptr, nullptr);
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
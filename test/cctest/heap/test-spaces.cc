@@ -226,6 +226,37 @@ TEST(MemoryAllocator) {
   // OldSpace's destructor will tear down the space and free up all pages.
 }
 
+TEST(HugePagesKeepPooledChunksCommitted) {
+  FLAG_huge_pages = true;
+  FLAG_concurrent_sweeping = false;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MemoryAllocator* memory_allocator = heap->memory_allocator();
+  memory_allocator->unmapper()->EnsureUnmappingCompleted();
+  const size_t committed_before =
+      memory_allocator->unmapper()->CommittedBufferedMemory();
+
+  SemiSpace* semi_space = &heap->new_space()->from_space();
+  Page* page = memory_allocator->AllocatePage<MemoryAllocator::kPooled>(
+      MemoryChunkLayout::AllocatableMemoryInDataPage(), semi_space,
+      NOT_EXECUTABLE);
+  CHECK_NOT_NULL(page);
+  Address start = page->address();
+  memory_allocator->Free<MemoryAllocator::kPooledAndQueue>(page);
+  memory_allocator->unmapper()->FreeQueuedChunks();
+
+  // The pooled chunk was not uncommitted, so its memory does not have to be
+  // faulted in again when it is reused.
+  CHECK_EQ(committed_before + MemoryChunk::kPageSize,
+           memory_allocator->unmapper()->CommittedBufferedMemory());
+  page = memory_allocator->AllocatePage<MemoryAllocator::kPooled>(
+      MemoryChunkLayout::AllocatableMemoryInDataPage(), semi_space,
+      NOT_EXECUTABLE);
+  CHECK_EQ(start, page->address());
+  memory_allocator->Free<MemoryAllocator::kPooledAndQueue>(page);
+  memory_allocator->unmapper()->EnsureUnmappingCompleted();
+}
+
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
   size_t page_size = MemoryAllocator::GetCommitPageSize();
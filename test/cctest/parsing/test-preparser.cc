@@ -770,6 +770,51 @@ TEST(Regress753896) {
                            i::parsing::ReportStatisticsMode::kYes);
 }
 
+TEST(PreparseDataCache) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  v8::ScriptCompiler::Source source(v8_str(
+      "function lazy() { function inner() { return 42; } return inner(); }\n"
+      "lazy;"));
+  v8::Local<v8::UnboundScript> unbound_script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+          .ToLocalChecked();
+  v8::Local<v8::Value> v =
+      unbound_script->BindToCurrentContext()->Run(env.local()).ToLocalChecked();
+  i::Handle<i::JSFunction> f =
+      i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*v));
+  i::Handle<i::SharedFunctionInfo> shared(f->shared(), CcTest::i_isolate());
+  CHECK(shared->HasUncompiledDataWithPreparseData());
+
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+      v8::ScriptCompiler::CreatePreparseDataCache(unbound_script));
+
+  // Drop the preparse data, like bytecode flushing does, and get it back
+  // from the cache.
+  shared->ClearPreparseData();
+  CHECK(shared->HasUncompiledDataWithoutPreparseData());
+  CHECK(v8::ScriptCompiler::ConsumePreparseDataCache(unbound_script,
+                                                     cache.get()));
+  CHECK(!cache->rejected);
+  CHECK(shared->HasUncompiledDataWithPreparseData());
+  CHECK_EQ(42, CompileRun("lazy()")->Int32Value(env.local()).FromJust());
+
+  // The cache is rejected for other sources.
+  v8::ScriptCompiler::Source other_source(
+      v8_str("function other() { function inner() {} }"));
+  v8::Local<v8::UnboundScript> other_script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &other_source)
+          .ToLocalChecked();
+  v8::ScriptCompiler::CachedData other_cache(
+      cache->data, cache->length,
+      v8::ScriptCompiler::CachedData::BufferNotOwned);
+  CHECK(!v8::ScriptCompiler::ConsumePreparseDataCache(other_script,
+                                                      &other_cache));
+  CHECK(other_cache.rejected);
+}
+
 TEST(ProducingAndConsumingByteData) {
   i::Isolate* isolate = CcTest::i_isolate();
   i::HandleScope scope(isolate);
@@ -166,6 +166,31 @@ TEST(Utf8StreamAsciiOnly) {
   } while (c != v8::internal::Utf16CharacterStream::kEndOfInput);
 }
 
+TEST(Utf8StreamAsciiSeek) {
+  // Ascii runs are copied and skipped without decoding. Mix them with
+  // multi-byte chars, including one split over a chunk boundary.
+  const char* chunks[] = {"abcdefgh\xc3\xa4ijklmnop\xe2", "\x82\xacqrstuvwx",
+                          ""};
+  const uint16_t expected[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h',
+                               0xe4, 'i', 'j', 'k', 'l', 'm', 'n', 'o',
+                               'p', 0x20ac, 'q', 'r', 's', 't', 'u', 'v',
+                               'w', 'x'};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+  for (size_t i = 0; i < arraysize(expected); i++) {
+    CHECK_EQ(expected[i], stream->Advance());
+  }
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, stream->Advance());
+
+  for (size_t i = arraysize(expected); i-- > 0;) {
+    stream->Seek(i);
+    CHECK_EQ(expected[i], stream->Advance());
+  }
+}
+
 TEST(Utf8StreamMaxNonSurrogateCharCode) {
   const char* chunks[] = {"\uffff\uffff", ""};
   ChunkSource chunk_source(chunks);
@@ -11,6 +11,7 @@
 #include "src/objects/smi.h"
 #include "test/cctest/compiler/code-assembler-tester.h"
 #include "test/cctest/compiler/function-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -26,18 +27,20 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,12 +82,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache->SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -126,6 +129,8 @@ TEST(TryProbeStubCache) {
 
   StubCache stub_cache(isolate);
   stub_cache.Clear();
+  const int primary_table_size = stub_cache.primary_table_size();
+  const int secondary_table_size = stub_cache.secondary_table_size();
 
   {
     auto receiver = m.Parameter<Object>(1);
@@ -166,21 +171,21 @@ TEST(TryProbeStubCache) {
   Factory* factory = isolate->factory();
 
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  for (int i = 0; i < primary_table_size / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) % primary_table_size);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) % primary_table_size);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -196,7 +201,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < secondary_table_size / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -211,7 +216,7 @@ TEST(TryProbeStubCache) {
   DisallowHeapAllocation no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N = primary_table_size + secondary_table_size;
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -257,5 +262,23 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheTableSizesFromFlags) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  {
+    FlagScope<int> primary_bits(&FLAG_stub_cache_primary_table_bits, 13);
+    FlagScope<int> secondary_bits(&FLAG_stub_cache_secondary_table_bits, 6);
+    StubCache stub_cache(isolate);
+    CHECK_EQ(1 << 13, stub_cache.primary_table_size());
+    CHECK_EQ(1 << 6, stub_cache.secondary_table_size());
+  }
+  {
+    FlagScope<int> primary_bits(&FLAG_stub_cache_primary_table_bits, 30);
+    FlagScope<int> secondary_bits(&FLAG_stub_cache_secondary_table_bits, 0);
+    StubCache stub_cache(isolate);
+    CHECK_EQ(1 << StubCache::kMaxTableBits, stub_cache.primary_table_size());
+    CHECK_EQ(1 << StubCache::kMinTableBits, stub_cache.secondary_table_size());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
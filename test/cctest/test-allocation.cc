@@ -135,6 +135,35 @@ TEST(AccountingAllocatorCurrentAndMax) {
   CHECK(!platform.oom_callback_called);
 }
 
+TEST(AccountingAllocatorSegmentPool) {
+  AllocationPlatform platform;
+  v8::internal::AccountingAllocator allocator;
+  const bool support_compression = false;
+  static constexpr size_t kSegmentSize = 8 * v8::internal::KB + 1;
+  v8::internal::Segment* segment =
+      allocator.AllocateSegment(kSegmentSize, support_compression);
+  CHECK_NOT_NULL(segment);
+  // Pooled segments are rounded up to their size class.
+  const size_t total_size = segment->total_size();
+  CHECK_LE(kSegmentSize, total_size);
+  allocator.ReturnSegment(segment, support_compression);
+  CHECK_EQ(0, allocator.GetCurrentMemoryUsage());
+  CHECK_EQ(total_size, allocator.GetCurrentPoolSize());
+  // Any size of the same class is served from the pool.
+  v8::internal::Segment* reused =
+      allocator.AllocateSegment(total_size, support_compression);
+  CHECK_EQ(segment, reused);
+  CHECK_EQ(total_size, reused->total_size());
+  CHECK_EQ(total_size, allocator.GetReusedSegmentBytes());
+  CHECK_EQ(0, allocator.GetCurrentPoolSize());
+  CHECK_EQ(total_size, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(reused, support_compression);
+  // Memory pressure releases the pool.
+  allocator.MemoryPressureNotification(v8::MemoryPressureLevel::kModerate);
+  CHECK_EQ(0, allocator.GetCurrentPoolSize());
+  CHECK(!platform.oom_callback_called);
+}
+
 TEST(MallocedOperatorNewOOM) {
   AllocationPlatform platform;
   CHECK(!platform.oom_callback_called);
@@ -933,3 +933,57 @@ TEST(BackingStore_ReallocateShared) {
       v8::BackingStore::Reallocate(isolate, std::move(backing_store), 10);
   CHECK(new_backing_store->IsShared());
 }
+
+TEST(DefaultAllocatorPoolsLargeAllocations) {
+  i::FLAG_array_buffer_pool_size = 1;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  const size_t kLength = 64 * i::KB;
+  uint8_t* data = reinterpret_cast<uint8_t*>(allocator->Allocate(kLength));
+  CHECK_NOT_NULL(data);
+  for (size_t i = 0; i < kLength; i++) CHECK_EQ(0, data[i]);
+  memset(data, 0xAB, kLength);
+  allocator->Free(data, kLength);
+
+  // The freed pages are reused, but handed out zeroed again.
+  uint8_t* reused = reinterpret_cast<uint8_t*>(allocator->Allocate(kLength));
+  CHECK_EQ(data, reused);
+  for (size_t i = 0; i < kLength; i++) CHECK_EQ(0, reused[i]);
+
+  uint8_t* grown = reinterpret_cast<uint8_t*>(
+      allocator->Reallocate(reused, kLength, 2 * kLength));
+  CHECK_NOT_NULL(grown);
+  for (size_t i = 0; i < 2 * kLength; i++) CHECK_EQ(0, grown[i]);
+  allocator->Free(grown, 2 * kLength);
+  i::FLAG_array_buffer_pool_size = 0;
+}
+
+TEST(BackingStore_GrowInPlace) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  std::shared_ptr<v8::BackingStore> backing_store =
+      v8::ArrayBuffer::NewGrowableBackingStore(isolate, 10, 1 * i::MB);
+  CHECK(backing_store);
+  CHECK_EQ(10, backing_store->ByteLength());
+  uint8_t* data = reinterpret_cast<uint8_t*>(backing_store->Data());
+  for (uint8_t i = 0; i < 10; i++) data[i] = i;
+  Local<v8::ArrayBuffer> small = v8::ArrayBuffer::New(isolate, backing_store);
+
+  CHECK(!backing_store->GrowInPlace(5));
+  CHECK(!backing_store->GrowInPlace(2 * i::MB));
+  CHECK(backing_store->GrowInPlace(100000));
+  CHECK_EQ(100000, backing_store->ByteLength());
+  CHECK_EQ(data, backing_store->Data());
+  for (uint8_t i = 0; i < 10; i++) CHECK_EQ(i, data[i]);
+  for (size_t i = 10; i < 100000; i++) CHECK_EQ(0, data[i]);
+
+  Local<v8::ArrayBuffer> large = v8::ArrayBuffer::New(isolate, backing_store);
+  CHECK_EQ(10, small->ByteLength());
+  CHECK_EQ(100000, large->ByteLength());
+  CHECK_EQ(data, large->GetBackingStore()->Data());
+
+  std::unique_ptr<v8::BackingStore> fixed =
+      v8::ArrayBuffer::NewBackingStore(isolate, 10);
+  CHECK(!fixed->GrowInPlace(20));
+}
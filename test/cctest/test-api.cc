@@ -38,6 +38,7 @@
 #endif
 
 #include "include/v8-fast-api-calls.h"
+#include "include/v8-profiler.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
 #include "src/base/overflowing-math.h"
@@ -53,6 +54,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/local-allocator.h"
+#include "src/json/json-parallel-parser.h"
 #include "src/logging/metrics.h"
 #include "src/objects/feedback-vector-inl.h"
 #include "src/objects/feedback-vector.h"
@@ -413,6 +415,71 @@ THREADED_TEST(Access) {
 }
 
 
+THREADED_TEST(AccessMultiple) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> obj =
+      CompileRun(
+          "var o = {a: 1, b: 1.5, c: 'c'};"
+          "Object.defineProperty(o, 'ro', {value: 2, writable: false});"
+          "o.__proto__ = {inherited: 3, set setter(v) { this.d = v; }};"
+          "Object.defineProperty(o, 'getter', {get() { return this.a; }});"
+          "o")
+          .As<v8::Object>();
+  // Only internalized keys take the fast path, "c" takes the slow path.
+  auto name = [isolate](const char* value) -> Local<v8::Name> {
+    return v8::String::NewFromUtf8(isolate, value,
+                                   v8::NewStringType::kInternalized)
+        .ToLocalChecked();
+  };
+  Local<v8::Name> keys[] = {name("a"),         name("b"),
+                            v8_str("c"),       name("ro"),
+                            name("inherited"), name("getter"),
+                            name("missing"),   v8::Symbol::New(isolate)};
+  const size_t count = arraysize(keys);
+  Local<Value> values[arraysize(keys)];
+  CHECK(obj->GetMultiple(env.local(), keys, count, values).FromJust());
+  CHECK_EQ(1, values[0]->Int32Value(env.local()).FromJust());
+  CHECK_EQ(1.5, values[1]->NumberValue(env.local()).FromJust());
+  CHECK(v8_str("c")->Equals(env.local(), values[2]).FromJust());
+  CHECK_EQ(2, values[3]->Int32Value(env.local()).FromJust());
+  CHECK_EQ(3, values[4]->Int32Value(env.local()).FromJust());
+  CHECK_EQ(1, values[5]->Int32Value(env.local()).FromJust());
+  CHECK(values[6]->IsUndefined());
+  CHECK(values[7]->IsUndefined());
+
+  // Each property is set twice, so fields become mutable in between.
+  for (int i = 0; i < 2; i++) {
+    Local<v8::Name> set_keys[] = {name("a"), name("b"), name("ro"),
+                                  name("setter"), name("new")};
+    Local<Value> set_values[] = {v8_num(10 + i), v8_str("b"), v8_num(20),
+                                 v8_num(30 + i), v8_num(40 + i)};
+    CHECK(obj->SetMultiple(env.local(), set_keys, set_values,
+                           arraysize(set_keys))
+              .FromJust());
+    ExpectInt32("o.a", 10 + i);
+    ExpectString("o.b", "b");
+    ExpectInt32("o.ro", 2);
+    ExpectInt32("o.d", 30 + i);
+    ExpectFalse("o.hasOwnProperty('setter')");
+    ExpectInt32("o.new", 40 + i);
+  }
+
+  // Exceptions thrown by accessors are propagated.
+  v8::TryCatch try_catch(isolate);
+  CompileRun(
+      "Object.defineProperty(o, 'thrower', {"
+      "  get() { throw 1; }, set(v) { throw 2; }});");
+  Local<v8::Name> thrower[] = {name("a"), name("thrower")};
+  Local<Value> thrower_values[] = {v8_num(1), v8_num(2)};
+  CHECK(obj->GetMultiple(env.local(), thrower, 2, values).IsNothing());
+  CHECK(try_catch.HasCaught());
+  try_catch.Reset();
+  CHECK(obj->SetMultiple(env.local(), thrower, thrower_values, 2).IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 THREADED_TEST(AccessElement) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -865,6 +932,56 @@ TEST(ScavengeExternalOneByteString) {
 }
 
 
+TEST(NewSubStringOfExternalString) {
+  ManualGCScope manual_gc_scope;
+  v8::Isolate* isolate = CcTest::isolate();
+  LocalContext env;
+  v8::HandleScope scope(isolate);
+  int dispose_count = 0;
+  v8::Global<String> host;
+  {
+    v8::HandleScope inner_scope(isolate);
+    Local<String> request =
+        String::NewExternalOneByte(
+            isolate,
+            new TestOneByteResource(
+                i::StrDup("GET / HTTP/1.1\r\nHost: www.example.com\r\n"),
+                &dispose_count))
+            .ToLocalChecked();
+    Local<String> host_value =
+        String::NewSubString(isolate, request, 22, 15).ToLocalChecked();
+    CHECK(v8_str("www.example.com")->StringEquals(host_value));
+    CHECK(String::NewSubString(isolate, request, 0, 3)
+              .ToLocalChecked()
+              ->StringEquals(v8_str("GET")));
+    CHECK(String::NewSubString(isolate, request, 0, request->Length())
+              .ToLocalChecked()
+              ->StringEquals(request));
+    CHECK_EQ(0, String::NewSubString(isolate, request, 1, 0)
+                    .ToLocalChecked()
+                    ->Length());
+    CHECK(String::NewSubString(isolate, request, -1, 3).IsEmpty());
+    CHECK(String::NewSubString(isolate, request, 30, 100).IsEmpty());
+
+    // The substring shares the characters of the external string.
+    i::Handle<i::String> ihost = v8::Utils::OpenHandle(*host_value);
+    CHECK(ihost->IsSlicedString());
+    CHECK_EQ(*v8::Utils::OpenHandle(*request),
+             i::SlicedString::cast(*ihost).parent());
+    host.Reset(isolate, host_value);
+  }
+  // The substring keeps the external string alive.
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(0, dispose_count);
+  {
+    v8::HandleScope inner_scope(isolate);
+    CHECK(v8_str("www.example.com")->StringEquals(host.Get(isolate)));
+  }
+  host.Reset();
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(1, dispose_count);
+}
+
 class TestOneByteResourceWithDisposeControl : public TestOneByteResource {
  public:
   // Only used by non-threaded tests, so it can use static fields.
@@ -2084,6 +2201,35 @@ THREADED_TEST(ObjectTemplate) {
             ->BooleanValue(isolate));
 }
 
+THREADED_TEST(ObjectTemplateWithManyProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  Local<ObjectTemplate> templ = ObjectTemplate::New(isolate);
+  const int kNumProperties = 20;
+  for (int i = 0; i < kNumProperties; i++) {
+    i::EmbeddedVector<char, 16> name;
+    i::SNPrintF(name, "p%d", i);
+    templ->Set(isolate, name.begin(), v8_num(i));
+  }
+  Local<v8::Object> instance1 =
+      templ->NewInstance(env.local()).ToLocalChecked();
+  Local<v8::Object> instance2 =
+      templ->NewInstance(env.local()).ToLocalChecked();
+  i::Handle<i::JSObject> object1 =
+      i::Handle<i::JSObject>::cast(v8::Utils::OpenHandle(*instance1));
+  i::Handle<i::JSObject> object2 =
+      i::Handle<i::JSObject>::cast(v8::Utils::OpenHandle(*instance2));
+  CHECK(object1->HasFastProperties());
+  CHECK_EQ(object1->map(), object2->map());
+
+  CHECK(env->Global()->Set(env.local(), v8_str("o"), instance2).FromJust());
+  ExpectString("Object.keys(o).join()",
+               "p0,p1,p2,p3,p4,p5,p6,p7,p8,p9,p10,p11,p12,p13,p14,p15,p16,"
+               "p17,p18,p19");
+  ExpectInt32("o.p0 + o.p19", 19);
+}
+
 THREADED_TEST(IntegerValue) {
   LocalContext env;
   v8::Isolate* isolate = CcTest::isolate();
@@ -4725,6 +4871,43 @@ TEST(MessageHandler5) {
   isolate->RemoveMessageListeners(check_message_5b);
 }
 
+TEST(MessageAfterJavaScriptCatch) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // Rethrowing from a catch block reports the rethrow.
+  {
+    TryCatch try_catch(isolate);
+    CompileRun(
+        "function f() {\n"
+        "  try { throw new Error('a'); } catch (e) { g(); }\n"
+        "}\n"
+        "function g() {\n"
+        "  throw new Error('b');\n"
+        "}\n"
+        "f();");
+    CHECK(try_catch.HasCaught());
+    CHECK_EQ(5, try_catch.Message()->GetLineNumber(context.local()).FromJust());
+  }
+
+  // Exceptions passing through a finally block keep their message.
+  {
+    TryCatch try_catch(isolate);
+    CompileRun(
+        "function h() {\n"
+        "  try {\n"
+        "    throw new Error('c');\n"
+        "  } finally {\n"
+        "    try { throw 1; } catch (e) {}\n"
+        "  }\n"
+        "}\n"
+        "h();");
+    CHECK(try_catch.HasCaught());
+    CHECK_EQ(3, try_catch.Message()->GetLineNumber(context.local()).FromJust());
+  }
+}
+
 namespace {
 
 // Verifies that after throwing an exception the message object is set up in
@@ -16741,6 +16924,30 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+TEST(CpuTimeAccounting) {
+  if (!v8::base::ThreadTicks::IsSupported()) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CHECK_EQ(0, isolate->GetCpuTimeInMicroseconds(v8::StateTag::JS));
+  isolate->SetCpuTimeAccountingEnabled(true);
+  CompileRun(
+      "var sum = 0;"
+      "for (var i = 0; i < 5e6; i++) sum += i % 7;");
+  CcTest::CollectAllGarbage();
+  isolate->SetCpuTimeAccountingEnabled(false);
+
+  int64_t js_time = isolate->GetCpuTimeInMicroseconds(v8::StateTag::JS);
+  int64_t gc_time = isolate->GetCpuTimeInMicroseconds(v8::StateTag::GC);
+  CHECK_LT(0, js_time);
+  CHECK_LT(0, gc_time);
+
+  // Nothing is accounted while accounting is disabled.
+  CompileRun("for (var i = 0; i < 1e6; i++) sum += i % 7;");
+  CHECK_EQ(js_time, isolate->GetCpuTimeInMicroseconds(v8::StateTag::JS));
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -17536,6 +17743,28 @@ THREADED_TEST(FunctionGetScriptId) {
   CHECK_EQ(script->GetUnboundScript()->GetId(), bar->ScriptId());
 }
 
+TEST(FunctionGetDeoptimizationCount) {
+  if (i::FLAG_lite_mode || i::FLAG_always_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  CompileRun(
+      "function add(a, b) { return a + b; }"
+      "%PrepareFunctionForOptimization(add);"
+      "add(1, 2);"
+      "add(3, 4);");
+  v8::Local<v8::Function> add = v8::Local<v8::Function>::Cast(
+      env->Global()->Get(env.local(), v8_str("add")).ToLocalChecked());
+  CHECK_EQ(0, add->GetDeoptimizationCount());
+
+  // Passing strings invalidates the Smi speculation in the optimized code.
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(add);"
+      "add(5, 6);"
+      "add('a', 'b');");
+  CHECK_EQ(1, add->GetDeoptimizationCount());
+}
+
 
 THREADED_TEST(FunctionGetBoundFunction) {
   LocalContext env;
@@ -21131,6 +21360,52 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+TEST(JSONParseLargeArrayWithOptions) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // Large enough to be split up between worker threads.
+  Local<String> text = CompileRun(
+                           "var records = [];"
+                           "for (var i = 0; i < 40000; i++) {"
+                           "  records.push({id: i, name: 'rec\\\"\\u1234' + i,"
+                           "                tags: ['a', [], {}], score: i / 3,"
+                           "                ok: i % 2 == 0, 7: null});"
+                           "}"
+                           "JSON.stringify(records, null, ' ');")
+                           .As<String>();
+  CHECK_GT(text->Length(), i::JsonParallelParser::kMinParallelLength);
+  context->Global()->Set(context.local(), v8_str("text"), text).FromJust();
+
+  for (int max_worker_threads : {0, 1, 3}) {
+    v8::JSON::ParseOptions options;
+    options.max_worker_threads = max_worker_threads;
+    Local<Value> value =
+        v8::JSON::Parse(context.local(), text, options).ToLocalChecked();
+    context->Global()->Set(context.local(), v8_str("value"), value).FromJust();
+    ExpectTrue("JSON.stringify(value, null, ' ') === text");
+    ExpectTrue("Object.keys(value[5]).join() === '7,id,name,tags,score,ok'");
+  }
+
+  // Invalid input throws the same error as without the options.
+  Local<String> invalid =
+      CompileRun("text.slice(0, -1) + ',]'").As<String>();
+  v8::TryCatch try_catch(isolate);
+  v8::JSON::ParseOptions options;
+  CHECK(v8::JSON::Parse(context.local(), invalid, options).IsEmpty());
+  CHECK(try_catch.HasCaught());
+  context->Global()
+      ->Set(context.local(), v8_str("error"), try_catch.Exception())
+      .FromJust();
+  try_catch.Reset();
+  ExpectTrue(
+      "(() => {"
+      "  try { JSON.parse(text.slice(0, -1) + ',]'); } catch (e) {"
+      "    return e instanceof SyntaxError && e.message === error.message;"
+      "  }"
+      "})()");
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -21159,6 +21434,93 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class CollectingOutputStream : public v8::OutputStream {
+ public:
+  explicit CollectingOutputStream(int chunk_size, int abort_after = -1)
+      : chunk_size_(chunk_size), abort_after_(abort_after) {}
+
+  void EndOfStream() override { eos_signaled_++; }
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_GT(size, 0);
+    CHECK_LE(size, chunk_size_);
+    output_.append(data, size);
+    chunks_++;
+    return chunks_ == abort_after_ ? kAbort : kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunks() const { return chunks_; }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  const int chunk_size_;
+  const int abort_after_;
+  std::string output_;
+  int chunks_ = 0;
+  int eos_signaled_ = 0;
+};
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  const char* kSource =
+      "var obj = [];"
+      "for (var i = 0; i < 1000; i++) {"
+      "  obj.push({id: i, s: 'abc\\u00e9\\u4e2d\\ud83d\\ude00' + i});"
+      "}"
+      "obj";
+  Local<Value> obj = CompileRun(kSource);
+  Local<String> expected = CompileRun("JSON.stringify(obj, null, ' ')")
+                               ->ToString(context.local())
+                               .ToLocalChecked();
+  v8::String::Utf8Value expected_utf8(isolate, expected);
+
+  CollectingOutputStream stream(64);
+  CHECK(v8::JSON::Stringify(context.local(), obj, &stream, v8_str(" "))
+            .FromJust());
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK_LT(1, stream.chunks());
+  CHECK_EQ(std::string(*expected_utf8, expected_utf8.length()),
+           stream.output());
+
+  // Values without a JSON representation are written as "undefined", like
+  // their string results.
+  CollectingOutputStream undefined_stream(64);
+  CHECK(v8::JSON::Stringify(context.local(), v8::Undefined(isolate),
+                            &undefined_stream)
+            .FromJust());
+  CHECK_EQ(std::string("undefined"), undefined_stream.output());
+}
+
+THREADED_TEST(JSONStringifyToStreamAbort) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Value> obj = CompileRun("new Array(1000).fill('xyz')");
+  CollectingOutputStream stream(16, 2);
+  CHECK(!v8::JSON::Stringify(context.local(), obj, &stream).FromJust());
+  CHECK_EQ(2, stream.chunks());
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
+THREADED_TEST(JSONStringifyToStreamException) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+  Local<Value> obj = CompileRun("var o = {}; o.self = o; o");
+  CollectingOutputStream stream(16);
+  CHECK(v8::JSON::Stringify(context.local(), obj, &stream).IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -22178,6 +22540,31 @@ TEST(EscapableHandleScope) {
   }
 }
 
+TEST(HandleBlockRetention) {
+  i::FLAG_handle_block_retention = 2;
+  v8::Isolate* isolate = CcTest::isolate();
+  i::HandleScopeImplementer* impl =
+      reinterpret_cast<i::Isolate*>(isolate)->handle_scope_implementer();
+  HandleScope outer_scope(isolate);
+  Local<Value> value = v8::Undefined(isolate);
+  {
+    // Spans at least four blocks.
+    HandleScope inner_scope(isolate);
+    for (int i = 0; i < 4 * i::kHandleBlockSize; i++) {
+      Local<Value>::New(isolate, value);
+    }
+  }
+  CHECK_EQ(2, impl->spare_block_count());
+  {
+    HandleScope inner_scope(isolate);
+    for (int i = 0; i < i::kHandleBlockSize; i++) {
+      Local<Value>::New(isolate, value);
+    }
+    CHECK_LE(1, impl->spare_block_count());
+  }
+  CHECK_EQ(2, impl->spare_block_count());
+}
+
 
 static void SetterWhichExpectsThisAndHolderToDiffer(
     Local<String>, Local<Value>, const v8::PropertyCallbackInfo<void>& info) {
@@ -23039,6 +23426,116 @@ TEST(RejectedPromiseReFulfill) {
   CHECK_EQ(promise->Result(), value1);
 }
 
+namespace {
+
+struct PromiseSettledRecord {
+  int calls = 0;
+  v8::Promise::PromiseState state = v8::Promise::kPending;
+  v8::Global<v8::Value> result;
+};
+
+void RecordPromiseSettled(v8::Local<v8::Context> context,
+                          v8::Promise::PromiseState state,
+                          v8::Local<v8::Value> result, void* data) {
+  auto record = static_cast<PromiseSettledRecord*>(data);
+  record->calls++;
+  record->state = state;
+  record->result.Reset(context->GetIsolate(), result);
+}
+
+}  // namespace
+
+TEST(PromiseOnSettled) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  isolate->SetMicrotasksPolicy(v8::MicrotasksPolicy::kExplicit);
+  v8::HandleScope scope(isolate);
+
+  // Pending promises run the callback as part of their reactions.
+  PromiseSettledRecord pending;
+  v8::Local<v8::Promise::Resolver> resolver =
+      v8::Promise::Resolver::New(context.local()).ToLocalChecked();
+  CHECK(resolver->GetPromise()
+            ->OnSettled(context.local(), RecordPromiseSettled, &pending)
+            .FromJust());
+  CHECK(resolver->GetPromise()->HasHandler());
+  resolver->Resolve(context.local(), v8_num(42)).ToChecked();
+  CHECK_EQ(0, pending.calls);
+  isolate->PerformMicrotaskCheckpoint();
+  CHECK_EQ(1, pending.calls);
+  CHECK_EQ(v8::Promise::kFulfilled, pending.state);
+  CHECK(v8_num(42)->SameValue(pending.result.Get(isolate)));
+
+  // Rejections are reported with the reason.
+  PromiseSettledRecord rejected;
+  resolver = v8::Promise::Resolver::New(context.local()).ToLocalChecked();
+  CHECK(resolver->GetPromise()
+            ->OnSettled(context.local(), RecordPromiseSettled, &rejected)
+            .FromJust());
+  resolver->Reject(context.local(), v8_str("reason")).ToChecked();
+  isolate->PerformMicrotaskCheckpoint();
+  CHECK_EQ(1, rejected.calls);
+  CHECK_EQ(v8::Promise::kRejected, rejected.state);
+  CHECK(v8_str("reason")->SameValue(rejected.result.Get(isolate)));
+
+  // Settled promises call back right away.
+  PromiseSettledRecord settled;
+  v8::Local<v8::Promise> promise =
+      CompileRun("Promise.resolve('done')").As<v8::Promise>();
+  CHECK(promise->OnSettled(context.local(), RecordPromiseSettled, &settled)
+            .FromJust());
+  CHECK_EQ(1, settled.calls);
+  CHECK_EQ(v8::Promise::kFulfilled, settled.state);
+  CHECK(v8_str("done")->SameValue(settled.result.Get(isolate)));
+  isolate->PerformMicrotaskCheckpoint();
+  CHECK_EQ(1, settled.calls);
+}
+
+TEST(PromiseCallAsync) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  isolate->SetMicrotasksPolicy(v8::MicrotasksPolicy::kExplicit);
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var resolve;"
+      "async function f(x) { await new Promise(r => resolve = r); return x; }"
+      "function g(x) { return x + 1; }"
+      "function h() { throw 1; }");
+
+  PromiseSettledRecord async_record;
+  v8::Local<v8::Value> args[] = {v8_num(1)};
+  v8::Local<v8::Function> f = CompileRun("f").As<v8::Function>();
+  CHECK(v8::Promise::CallAsync(context.local(), f, v8::Undefined(isolate), 1,
+                               args, RecordPromiseSettled, &async_record)
+            .FromJust());
+  isolate->PerformMicrotaskCheckpoint();
+  CHECK_EQ(0, async_record.calls);
+  CompileRun("resolve()");
+  isolate->PerformMicrotaskCheckpoint();
+  CHECK_EQ(1, async_record.calls);
+  CHECK_EQ(v8::Promise::kFulfilled, async_record.state);
+  CHECK(v8_num(1)->SameValue(async_record.result.Get(isolate)));
+
+  // Non-promise results are passed on synchronously.
+  PromiseSettledRecord sync_record;
+  v8::Local<v8::Function> g = CompileRun("g").As<v8::Function>();
+  CHECK(v8::Promise::CallAsync(context.local(), g, v8::Undefined(isolate), 1,
+                               args, RecordPromiseSettled, &sync_record)
+            .FromJust());
+  CHECK_EQ(1, sync_record.calls);
+  CHECK(v8_num(2)->SameValue(sync_record.result.Get(isolate)));
+
+  // Exceptions are not turned into rejections.
+  PromiseSettledRecord throw_record;
+  v8::TryCatch try_catch(isolate);
+  v8::Local<v8::Function> h = CompileRun("h").As<v8::Function>();
+  CHECK(v8::Promise::CallAsync(context.local(), h, v8::Undefined(isolate), 0,
+                               nullptr, RecordPromiseSettled, &throw_record)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, throw_record.calls);
+}
+
 TEST(DisallowJavascriptExecutionScope) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -27722,6 +28219,38 @@ struct UnexpectedObjectChecker
   }
 };
 
+template <typename View>
+struct ApiBytesChecker : BasicApiChecker<const View&, ApiBytesChecker<View>> {
+  static void FastCallback(v8::ApiObject receiver, const View& argument,
+                           v8::FastApiCallbackOptions& options) {
+    v8::Object* receiver_obj = reinterpret_cast<v8::Object*>(&receiver);
+    ApiBytesChecker<View>* receiver_ptr =
+        GetInternalField<ApiBytesChecker<View>, kV8WrapperObjectIndex>(
+            receiver_obj);
+    receiver_ptr->result_ |= ApiCheckerResult::kFastCalled;
+    receiver_ptr->value_ = std::string(
+        reinterpret_cast<const char*>(argument.data), argument.length);
+  }
+
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.Holder());
+    ApiBytesChecker<View>* checker =
+        GetInternalField<ApiBytesChecker<View>, kV8WrapperObjectIndex>(
+            receiver_obj);
+    checker->result_ |= ApiCheckerResult::kSlowCalled;
+    if (info[0]->IsArrayBufferView()) {
+      v8::Local<v8::ArrayBufferView> view = info[0].As<v8::ArrayBufferView>();
+      std::string bytes(view->ByteLength(), '\0');
+      bytes.resize(view->CopyContents(&bytes[0], bytes.size()));
+      checker->value_ = bytes;
+    } else {
+      checker->value_ = *v8::String::Utf8Value(info.GetIsolate(), info[0]);
+    }
+  }
+
+  std::string value_;
+};
+
 template <typename Value, typename Impl>
 bool SetupTest(v8::Local<v8::Value> initial_value, LocalContext* env,
                BasicApiChecker<Value, Impl>* checker, const char* source_code,
@@ -27956,6 +28485,28 @@ void CallWithUnexpectedObjectType(v8::Local<v8::Value> receiver) {
   CHECK(checker.DidCallSlow());
 }
 
+template <typename View>
+void CallAndCheckBytes(const char* expected_value,
+                       ApiCheckerResultFlags expected_path,
+                       v8::Local<v8::Value> initial_value) {
+  LocalContext env;
+  ApiBytesChecker<View> checker;
+  SetupTest(initial_value, &env, &checker,
+            "function func(arg) { receiver.api_func(arg); }"
+            "%PrepareFunctionForOptimization(func);"
+            "func(value);");
+  checker.result_ = ApiCheckerResult::kNotCalled;
+
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(func);"
+      "func(value);");
+  CHECK_EQ(expected_path == ApiCheckerResult::kSlowCalled,
+           !checker.DidCallFast());
+  CHECK_EQ(expected_path == ApiCheckerResult::kFastCalled,
+           !checker.DidCallSlow());
+  CHECK_EQ(checker.value_, std::string(expected_value));
+}
+
 class TestCFunctionInfo : public v8::CFunctionInfo {
   const v8::CTypeInfo& ReturnInfo() const override {
     static v8::CTypeInfo return_info =
@@ -28454,6 +29005,43 @@ TEST(FastApiCalls) {
   CallWithUnexpectedObjectType(v8_str("str"));
   CallWithUnexpectedObjectType(CompileRun("new Proxy({}, {});"));
 
+  // Typed arrays and strings
+  CallAndCheckBytes<v8::FastApiUint8Array>(
+      "abc", ApiCheckerResult::kFastCalled,
+      CompileRun("new Uint8Array([97, 98, 99])"));
+  CallAndCheckBytes<v8::FastApiUint8Array>(
+      "bc", ApiCheckerResult::kFastCalled,
+      CompileRun("new Uint8Array([97, 98, 99]).subarray(1)"));
+  CallAndCheckBytes<v8::FastApiUint8Array>(
+      "", ApiCheckerResult::kFastCalled, CompileRun("new Uint8Array(0)"));
+  // Off-heap backing store.
+  CallAndCheckBytes<v8::FastApiUint8Array>(
+      "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx",
+      ApiCheckerResult::kFastCalled,
+      CompileRun("new Uint8Array(68).fill(120)"));
+  CallAndCheckBytes<v8::FastApiUint8Array>(
+      "abc", ApiCheckerResult::kSlowCalled,
+      CompileRun("new Int8Array([97, 98, 99])"));
+  CallAndCheckBytes<v8::FastApiUint8Array>(
+      "", ApiCheckerResult::kSlowCalled,
+      CompileRun("var a = new Uint8Array([97, 98, 99]);"
+                 "%ArrayBufferDetach(a.buffer);"
+                 "a"));
+  CallAndCheckBytes<v8::FastApiUint8Array>("42", ApiCheckerResult::kSlowCalled,
+                                           v8_num(42));
+  CallAndCheckBytes<v8::FastOneByteString>(
+      "some_string", ApiCheckerResult::kFastCalled, v8_str("some_string"));
+  CallAndCheckBytes<v8::FastOneByteString>("", ApiCheckerResult::kFastCalled,
+                                           v8_str(""));
+  CallAndCheckBytes<v8::FastOneByteString>(
+      "a long cons string", ApiCheckerResult::kSlowCalled,
+      CompileRun("'a long '.concat(String.fromCharCode(99), 'ons string')"));
+  CallAndCheckBytes<v8::FastOneByteString>(
+      "\xE2\x82\xAC", ApiCheckerResult::kSlowCalled,
+      CompileRun("String.fromCharCode(0x20AC)"));
+  CallAndCheckBytes<v8::FastOneByteString>("42", ApiCheckerResult::kSlowCalled,
+                                           v8_num(42));
+
   // TODO(mslekova): Add corner cases for 64-bit values.
   // TODO(mslekova): Add main cases for float and double.
   // TODO(mslekova): Restructure the tests so that the fast optimized calls
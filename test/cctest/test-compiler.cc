@@ -37,6 +37,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/diagnostics/disasm.h"
+#include "src/execution/tiering-profile.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
 #include "src/interpreter/interpreter.h"
@@ -1108,5 +1109,116 @@ TEST(ProfilerEnabledDuringBackgroundCompile) {
   cpu_profiler->StopProfiling(profile);
 }
 
+TEST(TieringProfileRoundTrip) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRunWithOrigin(
+      "function f() { return 1; }\n"
+      "function g() { return 2; }\n"
+      "f() + g();",
+      "tiering-profile-test.js", 0, 0);
+  SharedFunctionInfo f = JSFunction::cast(*GetGlobalProperty("f")).shared();
+  SharedFunctionInfo g = JSFunction::cast(*GetGlobalProperty("g")).shared();
+
+  TieringProfile recorded;
+  recorded.RecordOptimized(f);
+  recorded.RecordOptimized(f);
+  CHECK_EQ(1u, recorded.recorded_functions());
+  CHECK(!recorded.has_loaded_functions());
+  CHECK(!recorded.IsHot(f));
+
+  TieringProfile loaded;
+  loaded.ReadFromString("garbage\n" + recorded.WriteToString() +
+                        "1 2 other-script.js\n");
+  CHECK(loaded.has_loaded_functions());
+  CHECK(loaded.IsHot(f));
+  CHECK(!loaded.IsHot(g));
+}
+
+TEST(CompilationCacheLimitsAndStatistics) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    isolate->SetCompilationCacheLimits(2, false);
+
+    auto compile = [isolate](v8::Local<v8::Context> context,
+                             const char* source) {
+      v8::Context::Scope context_scope(context);
+      v8::Script::Compile(context, v8_str(isolate, source)).ToLocalChecked();
+    };
+    v8::CompilationCacheStatistics before;
+    isolate->GetCompilationCacheStatistics(&before);
+
+    v8::Local<v8::Context> context1 = v8::Context::New(isolate);
+    compile(context1, "1 + 1");
+    compile(context1, "2 + 2");
+
+    // The cache is shared by all contexts.
+    v8::Local<v8::Context> context2 = v8::Context::New(isolate);
+    compile(context2, "1 + 1");
+
+    v8::CompilationCacheStatistics after;
+    isolate->GetCompilationCacheStatistics(&after);
+    CHECK_EQ(2u, after.number_of_scripts());
+    CHECK_EQ(1u, after.script_hits() - before.script_hits());
+    CHECK_EQ(2u, after.script_misses() - before.script_misses());
+    CHECK_EQ(0u, after.script_evictions() - before.script_evictions());
+
+    // Adding a third script evicts one of the others.
+    compile(context2, "3 + 3");
+    isolate->GetCompilationCacheStatistics(&after);
+    CHECK_EQ(2u, after.number_of_scripts());
+    CHECK_EQ(1u, after.script_evictions() - before.script_evictions());
+
+    // Lowering the limit evicts scripts straight away.
+    isolate->SetCompilationCacheLimits(1);
+    isolate->GetCompilationCacheStatistics(&after);
+    CHECK_EQ(1u, after.number_of_scripts());
+    CHECK_EQ(2u, after.script_evictions() - before.script_evictions());
+  }
+  isolate->Dispose();
+}
+
+TEST(DedupeBytecodeMetadata) {
+  FLAG_always_opt = false;
+  FLAG_ignition_dedupe_bytecode_metadata = true;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::String> source = v8_str(
+      "function f(x) { return x + 'abc' + 1.5; }"
+      "function g(x) { return x + 'abc' + 1.5; }"
+      "function h(x) { return x + 'abc' + 2.5; }");
+  v8::ScriptCompiler::Source script_source(source);
+  v8::ScriptCompiler::Compile(env.local(), &script_source,
+                              v8::ScriptCompiler::kEagerCompile)
+      .ToLocalChecked()
+      ->Run(env.local())
+      .ToLocalChecked();
+
+  auto get_bytecode = [&env](const char* name) {
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*env->Global()->Get(env.local(), v8_str(name))
+                                   .ToLocalChecked()));
+    CHECK(function->shared().HasBytecodeArray());
+    return function->shared().GetBytecodeArray();
+  };
+  CHECK_EQ(get_bytecode("f").constant_pool(),
+           get_bytecode("g").constant_pool());
+  CHECK_NE(get_bytecode("f").constant_pool(),
+           get_bytecode("h").constant_pool());
+  CHECK(CompileRun("g(1)")->StrictEquals(v8_str("1abc1.5")));
+  CHECK(CompileRun("h(1)")->StrictEquals(v8_str("1abc2.5")));
+
+  v8::HeapCodeStatistics code_statistics;
+  CcTest::isolate()->GetHeapCodeAndMetadataStatistics(&code_statistics);
+  CHECK_LT(0u, code_statistics.bytecode_size());
+  CHECK_LT(code_statistics.bytecode_size(),
+           code_statistics.bytecode_and_metadata_size());
+}
+
 }  // namespace internal
 }  // namespace v8
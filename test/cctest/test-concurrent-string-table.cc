@@ -0,0 +1,98 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/platform/semaphore.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-factory-inl.h"
+#include "src/heap/local-heap.h"
+#include "src/objects/string-table.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr int kNumThreads = 4;
+constexpr int kNumStrings = 2000;
+
+std::string StringForIndex(int i) { return "concurrent-" + std::to_string(i); }
+
+class InternalizeStringsThread final : public v8::base::Thread {
+ public:
+  InternalizeStringsThread(Isolate* isolate, base::Semaphore* sema_started,
+                           base::Semaphore* sema_go)
+      : v8::base::Thread(base::Thread::Options("InternalizeStringsThread")),
+        isolate_(isolate),
+        sema_started_(sema_started),
+        sema_go_(sema_go) {}
+
+  void Run() override {
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(local_isolate.heap());
+    LocalHandleScope scope(local_isolate.heap());
+
+    sema_started_->Signal();
+    sema_go_->Wait();
+
+    for (int i = 0; i < kNumStrings; ++i) {
+      std::string string = StringForIndex(i);
+      Handle<String> internalized = local_isolate.factory()->InternalizeString(
+          Vector<const uint8_t>::cast(VectorOf(string.data(), string.size())));
+      CHECK(internalized->IsInternalizedString());
+      strings_.push_back(
+          local_isolate.heap()->NewPersistentHandle(internalized));
+    }
+    persistent_handles_ = local_isolate.heap()->DetachPersistentHandles();
+  }
+
+  Handle<String> string(int i) const { return strings_[i]; }
+
+ private:
+  Isolate* isolate_;
+  base::Semaphore* sema_started_;
+  base::Semaphore* sema_go_;
+  std::vector<Handle<String>> strings_;
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+};
+
+}  // namespace
+
+// Many threads internalizing the same strings at once must all end up with
+// the same internalized string, whether they won or lost the race to insert
+// it, and regardless of string table resizes in between.
+TEST(StringTable_ConcurrentInternalization) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope handle_scope(isolate);
+
+  base::Semaphore sema_started(0);
+  base::Semaphore sema_go(0);
+  std::vector<std::unique_ptr<InternalizeStringsThread>> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(std::make_unique<InternalizeStringsThread>(
+        isolate, &sema_started, &sema_go));
+    CHECK(threads.back()->Start());
+  }
+  for (int i = 0; i < kNumThreads; ++i) sema_started.Wait();
+  for (int i = 0; i < kNumThreads; ++i) sema_go.Signal();
+  for (auto& thread : threads) thread->Join();
+
+  for (int i = 0; i < kNumStrings; ++i) {
+    Handle<String> expected =
+        isolate->factory()->InternalizeUtf8String(StringForIndex(i).c_str());
+    for (auto& thread : threads) {
+      CHECK_EQ(*expected, *thread->string(i));
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
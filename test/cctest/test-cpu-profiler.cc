@@ -751,6 +751,37 @@ TEST(CollectCpuProfile) {
   profile->Delete();
 }
 
+TEST(CollectCpuProfileIncrementalLogging) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_cpu_profiler_incremental_logging = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  // Compile the functions before profiling, so that the profiler only learns
+  // about them from the incrementally logged existing code.
+  v8::Local<v8::Value> warmup_args[] = {v8::Integer::New(env->GetIsolate(), 1)};
+  function
+      ->Call(env.local(), env->Global(), arraysize(warmup_args), warmup_args)
+      .ToLocalChecked();
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 1000);
+
+  const v8::CpuProfileNode* root = profile->GetTopDownRoot();
+  const v8::CpuProfileNode* start_node = GetChild(env.local(), root, "start");
+  const v8::CpuProfileNode* foo_node = GetChild(env.local(), start_node, "foo");
+  const char* delay_branch[] = {"delay", "loop"};
+  CheckSimpleBranch(env.local(), foo_node, delay_branch,
+                    arraysize(delay_branch));
+
+  profile->Delete();
+}
+
 TEST(CollectCpuProfileCallerLineNumbers) {
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
@@ -3875,6 +3906,105 @@ UNINITIALIZED_TEST(DetailedSourcePositionAPI_Inlining) {
   isolate->Dispose();
 }
 
+TEST(LazyOptimizedSourcePositions) {
+  if (!i::FLAG_opt || i::FLAG_always_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_lazy_optimized_source_positions = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  i::Isolate* isolate = CcTest::i_isolate();
+  CHECK(!isolate->NeedsDetailedOptimizedCodeLineInfo());
+
+  i::Handle<i::JSFunction> function = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun(
+          "function fib(i) {"
+          "  if (i <= 1) return 1; "
+          "  return fib(i - 1) +"
+          "         fib(i - 2);"
+          "}"
+          "%PrepareFunctionForOptimization(fib);\n"
+          "fib(5);"
+          "%OptimizeFunctionOnNextCall(fib);"
+          "fib(5);"
+          "fib")));
+  CHECK(function->HasAttachedOptimizedCode());
+  CHECK_EQ(0, function->code().SourcePositionTable().length());
+
+  // Starting a profiler throws the code away, so that the function gets
+  // reoptimized with source positions.
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(env->GetIsolate());
+  profiler->StartProfiling(v8_str("my_profile"));
+  CHECK(!function->HasAttachedOptimizedCode());
+  CHECK(isolate->NeedsDetailedOptimizedCodeLineInfo());
+  CompileRun(
+      "%PrepareFunctionForOptimization(fib);\n"
+      "fib(5);"
+      "%OptimizeFunctionOnNextCall(fib);"
+      "fib(5);");
+  CHECK(function->HasAttachedOptimizedCode());
+  CHECK_LT(0, function->code().SourcePositionTable().length());
+  profiler->StopProfiling(v8_str("my_profile"));
+  profiler->Dispose();
+}
+
+namespace {
+
+class StringOutputStream : public v8::OutputStream {
+ public:
+  void EndOfStream() override { ++eos_signaled_; }
+  WriteResult WriteAsciiChunk(char* buffer, int chars_written) override {
+    data_.append(buffer, chars_written);
+    return kContinue;
+  }
+  const std::string& data() const { return data_; }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  std::string data_;
+  int eos_signaled_ = 0;
+};
+
+}  // namespace
+
+TEST(ContinuousProfiling) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 200)};
+
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(env->GetIsolate());
+  profiler->SetSamplingInterval(100);
+  profiler->StartContinuousProfiling(1024);
+  function->Call(env.local(), env->Global(), arraysize(args), args)
+      .ToLocalChecked();
+
+  // A regular profile can be taken while aggregating continuously.
+  profiler->StartProfiling(v8_str("my_profile"));
+  function->Call(env.local(), env->Global(), arraysize(args), args)
+      .ToLocalChecked();
+  v8::CpuProfile* profile = profiler->StopProfiling(v8_str("my_profile"));
+  CHECK_LT(0, profile->GetSamplesCount());
+  profile->Delete();
+
+  StringOutputStream stream;
+  profiler->SerializeContinuousProfile(&stream);
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK_NE(std::string::npos, stream.data().find("samples"));
+  CHECK_NE(std::string::npos, stream.data().find("loop"));
+
+  // Serializing empties the table.
+  StringOutputStream empty_stream;
+  profiler->SerializeContinuousProfile(&empty_stream);
+  CHECK_EQ(1, empty_stream.eos_signaled());
+  CHECK_EQ(std::string::npos, empty_stream.data().find("loop"));
+
+  profiler->StopContinuousProfiling();
+  profiler->Dispose();
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
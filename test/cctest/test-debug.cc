@@ -4425,6 +4425,104 @@ TEST(DebugCoverageWithScriptDataOutOfScope) {
   CHECK_EQ(26, function_data.EndOffset());
 }
 
+namespace {
+uint32_t GetBinaryCoverageCount(v8::Isolate* isolate, const char* name) {
+  v8::debug::Coverage coverage = v8::debug::Coverage::CollectPrecise(isolate);
+  uint32_t count = 0;
+  for (size_t i = 0; i < coverage.ScriptCount(); i++) {
+    v8::debug::Coverage::ScriptData script_data = coverage.GetScriptData(i);
+    for (size_t j = 0; j < script_data.FunctionCount(); j++) {
+      v8::debug::Coverage::FunctionData function_data =
+          script_data.GetFunctionData(j);
+      CHECK_LE(function_data.Count(), 1u);
+      for (size_t k = 0; k < function_data.BlockCount(); k++) {
+        CHECK_LE(function_data.GetBlockData(k).Count(), 1u);
+      }
+      v8::Local<v8::String> function_name;
+      if (!function_data.Name().ToLocal(&function_name)) continue;
+      v8::String::Utf8Value utf8_name(isolate, function_name);
+      if (strcmp(*utf8_name, name) == 0) count = function_data.Count();
+    }
+  }
+  return count;
+}
+}  // namespace
+
+TEST(DebugBlockBinaryCoverage) {
+  i::FLAG_always_opt = false;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::debug::Coverage::SelectMode(isolate,
+                                  v8::debug::CoverageMode::kBlockBinary);
+  CompileRun(
+      "function f(x) {\n"
+      "  if (x) return 1;\n"
+      "  return 2;\n"
+      "}\n"
+      "%PrepareFunctionForOptimization(f);\n"
+      "for (var i = 0; i < 10; i++) f(true);\n"
+      "%OptimizeFunctionOnNextCall(f);\n"
+      "f(true);");
+  CHECK_EQ(1u, GetBinaryCoverageCount(isolate, "f"));
+
+  // Blocks covered before the last collection count again once they run.
+  CompileRun("f(true);");
+  CHECK_EQ(1u, GetBinaryCoverageCount(isolate, "f"));
+  CompileRun("for (var i = 0; i < 10; i++) f(true);");
+  CHECK_EQ(1u, GetBinaryCoverageCount(isolate, "f"));
+}
+
+TEST(DebugInlineCacheStats) {
+  i::FLAG_always_opt = false;
+  i::FLAG_lazy_feedback_allocation = false;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "function mega(o) { return o.x; }\n"
+      "function mono(o) { return o.y; }\n"
+      "[{x: 1}, {x: 1, a: 1}, {x: 1, b: 1}, {x: 1, c: 1}, {x: 1, d: 1},\n"
+      " {x: 1, e: 1}].forEach(mega);\n"
+      "mono({y: 1});\n"
+      "mono({y: 2});");
+
+  v8::debug::InlineCacheStats stats =
+      v8::debug::InlineCacheStats::Collect(isolate, 1);
+  CHECK_EQ(1u, stats.ScriptCount());
+  v8::debug::InlineCacheStats::ScriptData script_data = stats.GetScriptData(0);
+  bool found_mega = false;
+  bool found_mono = false;
+  for (size_t i = 0; i < script_data.FunctionCount(); i++) {
+    v8::debug::InlineCacheStats::FunctionData function_data =
+        script_data.GetFunctionData(i);
+    v8::String::Utf8Value name(isolate,
+                               function_data.Name().ToLocalChecked());
+    const v8::debug::InlineCacheStats::Counts& counts =
+        function_data.GetCounts();
+    if (strcmp(*name, "mega") == 0) {
+      found_mega = true;
+      CHECK_EQ(1u, counts.megamorphic);
+      CHECK_EQ(0u, counts.monomorphic);
+      CHECK_EQ(0u, counts.polymorphic);
+    } else if (strcmp(*name, "mono") == 0) {
+      found_mono = true;
+      CHECK_EQ(1u, counts.monomorphic);
+      CHECK_EQ(0u, counts.megamorphic);
+    }
+  }
+  CHECK(found_mega);
+  CHECK(found_mono);
+
+  CHECK_EQ(1u, stats.MegamorphicSiteCount());
+  v8::debug::InlineCacheStats::Site site = stats.GetMegamorphicSite(0);
+  v8::String::Utf8Value name(
+      isolate, site.GetFunctionData().Name().ToLocalChecked());
+  CHECK_EQ(0, strcmp(*name, "mega"));
+  CHECK_EQ(0, strcmp(site.Kind(), "LoadProperty"));
+}
+
 TEST(BuiltinsExceptionPrediction) {
   v8::Isolate* isolate = CcTest::isolate();
   i::Isolate* iisolate = CcTest::i_isolate();
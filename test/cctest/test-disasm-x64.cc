@@ -843,6 +843,19 @@ TEST(DisasmX64) {
     }
   }
 
+  // AVX2 instruction
+  {
+    if (CpuFeatures::IsSupported(AVX2)) {
+      CpuFeatureScope scope(&assm, AVX2);
+      __ vpbroadcastb(xmm1, xmm2);
+      __ vpbroadcastb(xmm1, Operand(rbx, rcx, times_4, 10000));
+      __ vpbroadcastw(xmm1, xmm2);
+      __ vpbroadcastw(xmm1, Operand(rbx, rcx, times_4, 10000));
+      __ vpbroadcastd(xmm1, xmm2);
+      __ vpbroadcastd(xmm1, Operand(rbx, rcx, times_4, 10000));
+    }
+  }
+
   // FMA3 instruction
   {
     if (CpuFeatures::IsSupported(FMA3)) {
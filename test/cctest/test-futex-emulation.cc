@@ -0,0 +1,119 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/futex-emulation.h"
+
+#include <memory>
+#include <vector>
+
+#include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
+#include "src/objects/js-array-buffer-inl.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr int kNumWaiters = 32;
+
+// Runs Atomics.wait on element {index} of a SharedArrayBuffer, in its own
+// Isolate.
+class WaiterThread final : public v8::base::Thread {
+ public:
+  WaiterThread(std::shared_ptr<v8::BackingStore> backing_store, int index)
+      : Thread(Options("FutexWaiterThread")),
+        backing_store_(std::move(backing_store)),
+        index_(index) {}
+
+  void Run() override {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::SharedArrayBuffer> sab =
+          v8::SharedArrayBuffer::New(isolate, backing_store_);
+      context->Global()->Set(context, v8_str("sab"), sab).FromJust();
+      context->Global()
+          ->Set(context, v8_str("index"), v8::Integer::New(isolate, index_))
+          .FromJust();
+      v8::Local<v8::Value> result =
+          CompileRun("Atomics.wait(new Int32Array(sab), index, 0)");
+      woken_ = result->StrictEquals(v8_str("ok"));
+    }
+    isolate->Dispose();
+  }
+
+  bool woken() const { return woken_; }
+
+ private:
+  std::shared_ptr<v8::BackingStore> backing_store_;
+  const int index_;
+  bool woken_ = false;
+};
+
+int CountWaiters(Handle<JSArrayBuffer> buffer, int num_locations) {
+  int waiters = 0;
+  for (int i = 0; i < num_locations; ++i) {
+    waiters += Smi::ToInt(
+        FutexEmulation::NumWaitersForTesting(buffer, i * sizeof(int32_t)));
+  }
+  return waiters;
+}
+
+// Lets {kNumWaiters} threads wait on {num_locations} different locations, and
+// then wakes them location by location.
+void RunConcurrentWaiters(int num_locations) {
+  FLAG_harmony_sharedarraybuffer = true;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  std::shared_ptr<v8::BackingStore> backing_store =
+      v8::SharedArrayBuffer::NewBackingStore(isolate,
+                                             num_locations * sizeof(int32_t));
+  Handle<JSArrayBuffer> buffer = v8::Utils::OpenHandle(
+      *v8::SharedArrayBuffer::New(isolate, backing_store));
+
+  std::vector<std::unique_ptr<WaiterThread>> threads;
+  for (int i = 0; i < kNumWaiters; ++i) {
+    threads.push_back(
+        std::make_unique<WaiterThread>(backing_store, i % num_locations));
+    CHECK(threads.back()->Start());
+  }
+  while (CountWaiters(buffer, num_locations) != kNumWaiters) {
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  }
+
+  // Waking one location must not affect the waiters on any other location.
+  int remaining = kNumWaiters;
+  for (int i = 0; i < num_locations; ++i) {
+    Object woken = FutexEmulation::Wake(buffer, i * sizeof(int32_t),
+                                        FutexEmulation::kWakeAll);
+    remaining -= Smi::ToInt(woken);
+    CHECK_EQ(remaining, CountWaiters(buffer, num_locations));
+  }
+  CHECK_EQ(0, remaining);
+
+  for (auto& thread : threads) {
+    thread->Join();
+    CHECK(thread->woken());
+  }
+}
+
+}  // namespace
+
+TEST(FutexConcurrentWaitersOnDistinctLocations) {
+  RunConcurrentWaiters(kNumWaiters);
+}
+
+TEST(FutexConcurrentWaitersOnSharedLocations) { RunConcurrentWaiters(4); }
+
+}  // namespace internal
+}  // namespace v8
@@ -30,6 +30,8 @@
 #include <ctype.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "src/init/v8.h"
 
@@ -322,6 +324,47 @@ TEST(HeapSnapshotLocations) {
   CHECK_EQ(0, o_loc->col);
 }
 
+namespace {
+
+int CountHiddenEdges(const v8::HeapSnapshot* snapshot) {
+  int count = 0;
+  for (int i = 0; i < snapshot->GetNodesCount(); ++i) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    for (int j = 0; j < node->GetChildrenCount(); ++j) {
+      if (node->GetChild(j)->GetType() == v8::HeapGraphEdge::kHidden) ++count;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(HeapSnapshotParallelHiddenReferences) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  // Enough objects to be split across several chunks.
+  CompileRun(
+      "var list = [];\n"
+      "for (var i = 0; i < 50000; i++) list.push({ i: i, f() { return i; } });");
+
+  i::FLAG_heap_snapshot_parallel = true;
+  const v8::HeapSnapshot* parallel = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(parallel));
+  i::FLAG_heap_snapshot_parallel = false;
+  const v8::HeapSnapshot* sequential = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(sequential));
+
+  int parallel_hidden = CountHiddenEdges(parallel);
+  CHECK_GT(parallel_hidden, 0);
+  // Both snapshots see the same objects apart from a few allocated in
+  // between.
+  int delta = parallel_hidden - CountHiddenEdges(sequential);
+  CHECK_LT(std::abs(delta), parallel_hidden / 100);
+  CHECK(GetProperty(env->GetIsolate(), GetGlobalObject(parallel),
+                    v8::HeapGraphEdge::kProperty, "list"));
+}
+
 TEST(HeapSnapshotObjectSizes) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -1200,6 +1243,184 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+// Decodes the v8::HeapSnapshot::kBinary format.
+class BinarySnapshotReader {
+ public:
+  struct Node {
+    uint32_t type;
+    std::string name;
+    uint32_t id;
+  };
+  struct Edge {
+    uint32_t type;
+    uint32_t from;
+    uint32_t to;
+    uint32_t name_or_index;
+  };
+
+  explicit BinarySnapshotReader(i::Vector<char> data)
+      : data_(reinterpret_cast<const uint8_t*>(data.begin())),
+        end_(data_ + data.length()) {}
+
+  bool Read() {
+    if (end_ - data_ < 4 || memcmp(data_, "V8HS", 4) != 0) return false;
+    data_ += 4;
+    if (ReadVarint() != 1) return false;
+    while (data_ < end_) {
+      switch (*data_++) {
+        case 0: {
+          uint64_t node_count = ReadVarint();
+          uint64_t edge_count = ReadVarint();
+          return data_ == end_ && node_count == nodes_.size() &&
+                 edge_count == edges_.size();
+        }
+        case 1: {
+          uint64_t id = ReadVarint();
+          uint64_t length = ReadVarint();
+          if (id != strings_.size() || length > static_cast<uint64_t>(end_ - data_)) {
+            return false;
+          }
+          strings_.emplace_back(reinterpret_cast<const char*>(data_),
+                                static_cast<size_t>(length));
+          data_ += length;
+          break;
+        }
+        case 2: {
+          uint64_t index = ReadVarint();
+          Node node;
+          node.type = static_cast<uint32_t>(ReadVarint());
+          node.name = strings_.at(ReadVarint());
+          node.id = static_cast<uint32_t>(ReadVarint());
+          for (int i = 0; i < 3; i++) ReadVarint();
+          if (index >= nodes_.size()) nodes_.resize(index + 1);
+          nodes_[index] = node;
+          break;
+        }
+        case 3: {
+          Edge edge;
+          edge.type = static_cast<uint32_t>(ReadVarint());
+          edge.from = static_cast<uint32_t>(ReadVarint());
+          edge.to = static_cast<uint32_t>(ReadVarint());
+          edge.name_or_index = static_cast<uint32_t>(ReadVarint());
+          edges_.push_back(edge);
+          break;
+        }
+        case 4:
+          for (int i = 0; i < 4; i++) ReadVarint();
+          break;
+        default:
+          return false;
+      }
+    }
+    return false;
+  }
+
+  // Follows the named edge |name| of |type| from node |from|.
+  int GetChild(int from, v8::HeapGraphEdge::Type type, const char* name) {
+    for (const Edge& edge : edges_) {
+      if (edge.from == static_cast<uint32_t>(from) &&
+          edge.type == static_cast<uint32_t>(type) &&
+          strings_.at(edge.name_or_index) == name) {
+        return edge.to;
+      }
+    }
+    return -1;
+  }
+
+  const std::vector<Node>& nodes() const { return nodes_; }
+  const std::vector<Edge>& edges() const { return edges_; }
+
+ private:
+  uint64_t ReadVarint() {
+    uint64_t result = 0;
+    for (int shift = 0; data_ < end_; shift += 7) {
+      uint8_t b = *data_++;
+      result |= static_cast<uint64_t>(b & 0x7F) << shift;
+      if ((b & 0x80) == 0) break;
+    }
+    return result;
+  }
+
+  const uint8_t* data_;
+  const uint8_t* end_;
+  std::vector<std::string> strings_;
+  std::vector<Node> nodes_;
+  std::vector<Edge> edges_;
+};
+
+void CheckBinarySnapshot(BinarySnapshotReader* reader) {
+  CHECK(reader->Read());
+  // The root has shortcut edges to the global objects.
+  int b = -1;
+  for (const BinarySnapshotReader::Edge& edge : reader->edges()) {
+    if (edge.from != 0 ||
+        edge.type != static_cast<uint32_t>(v8::HeapGraphEdge::kShortcut)) {
+      continue;
+    }
+    b = reader->GetChild(edge.to, v8::HeapGraphEdge::kProperty, "b");
+    if (b >= 0) break;
+  }
+  CHECK_GE(b, 0);
+  int a = reader->GetChild(b, v8::HeapGraphEdge::kProperty, "x");
+  CHECK_GE(a, 0);
+  int s = reader->GetChild(a, v8::HeapGraphEdge::kProperty, "s");
+  CHECK_GE(s, 0);
+  CHECK_EQ(static_cast<uint32_t>(v8::HeapGraphNode::kString),
+           reader->nodes()[s].type);
+  CHECK_EQ(0, strcmp("binary snapshot string",
+                     reader->nodes()[s].name.c_str()));
+}
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "function B(x) { this.x = x; }\n"
+      "var a = new A('binary snapshot string');\n"
+      "var b = new B(a);");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+  BinarySnapshotReader reader(data);
+  CheckBinarySnapshot(&reader);
+  CHECK_EQ(snapshot->GetNodesCount(), static_cast<int>(reader.nodes().size()));
+}
+
+TEST(HeapSnapshotStreaming) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "function B(x) { this.x = x; }\n"
+      "var a = new A('binary snapshot string');\n"
+      "var b = new B(a);");
+
+  TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK_EQ(0, heap_profiler->GetSnapshotCount());
+  i::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+  BinarySnapshotReader reader(data);
+  CheckBinarySnapshot(&reader);
+
+  TestJSONStream aborting_stream(5);
+  CHECK(!heap_profiler->TakeHeapSnapshotToStream(&aborting_stream));
+  CHECK_EQ(0, aborting_stream.eos_signaled());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -3856,6 +4077,42 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerContextIds) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context1 = v8::Context::New(isolate);
+  v8::Local<v8::Context> context2 = v8::Context::New(isolate);
+  v8::debug::SetContextId(context1, 1);
+  v8::debug::SetContextId(context2, 2);
+  v8::HeapProfiler* heap_profiler = isolate->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+  {
+    v8::Context::Scope context_scope(context1);
+    for (int i = 0; i < 1024; ++i) v8::Object::New(isolate);
+  }
+  {
+    v8::Context::Scope context_scope(context2);
+    for (int i = 0; i < 2048; ++i) v8::Object::New(isolate);
+  }
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  size_t samples_per_context[3] = {0, 0, 0};
+  for (auto& sample : profile->GetSamples()) {
+    CHECK_LE(0, sample.context_id);
+    CHECK_GE(2, sample.context_id);
+    samples_per_context[sample.context_id]++;
+  }
+  CHECK_LT(0, samples_per_context[1]);
+  CHECK_LT(samples_per_context[1], samples_per_context[2]);
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
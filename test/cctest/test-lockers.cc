@@ -31,6 +31,7 @@
 
 #include "src/init/v8.h"
 
+#include "src/api/api.h"
 #include "src/base/platform/platform.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/execution/execution.h"
@@ -898,6 +899,50 @@ TEST(Regress1433) {
 }
 
 
+class HandleBlockHandoffThread : public JoinableThread {
+ public:
+  explicit HandleBlockHandoffThread(v8::Isolate* isolate)
+      : JoinableThread("HandleBlockHandoffThread"), isolate_(isolate) {}
+
+  void Run() override {
+    v8::Locker locker(isolate_);
+    v8::Isolate::Scope isolate_scope(isolate_);
+    i::HandleScopeImplementer* impl =
+        reinterpret_cast<i::Isolate*>(isolate_)->handle_scope_implementer();
+    // Blocks freed by the previous thread are still there.
+    CHECK_EQ(2, impl->spare_block_count());
+    v8::HandleScope handle_scope(isolate_);
+    for (int i = 0; i < 2 * i::kHandleBlockSize; i++) {
+      v8::Local<v8::Value>::New(isolate_, v8::Undefined(isolate_));
+    }
+    CHECK_EQ(0, impl->spare_block_count());
+  }
+
+ private:
+  v8::Isolate* isolate_;
+};
+
+// Handle blocks survive handing the isolate over between top-level Lockers.
+TEST(HandleBlocksSurviveLockerHandoff) {
+  i::FLAG_handle_block_retention = 2;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    for (int i = 0; i < 3 * i::kHandleBlockSize; i++) {
+      v8::Local<v8::Value>::New(isolate, v8::Undefined(isolate));
+    }
+  }
+  std::vector<JoinableThread*> threads;
+  threads.push_back(new HandleBlockHandoffThread(isolate));
+  StartJoinAndDeleteThreads(threads);
+  isolate->Dispose();
+}
+
+
 static const char* kSimpleExtensionSource =
   "(function Foo() {"
   "  return 4;"
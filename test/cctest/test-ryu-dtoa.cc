@@ -0,0 +1,92 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <cmath>
+
+#include "src/init/v8.h"
+
+#include "src/numbers/double.h"
+#include "src/numbers/ryu-dtoa.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace internal {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+static void CheckShortest(double v, const char* representation, int point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int decimal_point;
+  RyuDtoa(v, buffer, &length, &decimal_point);
+  CHECK_EQ(0, strcmp(representation, buffer.begin()));
+  CHECK_EQ(static_cast<int>(strlen(representation)), length);
+  CHECK_EQ(point, decimal_point);
+}
+
+TEST(RyuDtoaVariousDoubles) {
+  CheckShortest(5e-324, "5", -323);
+  CheckShortest(1.7976931348623157e308, "17976931348623157", 309);
+  CheckShortest(4294967272.0, "4294967272", 10);
+  CheckShortest(4.1855804968213567e298, "4185580496821357", 299);
+  CheckShortest(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckShortest(2147483648.0, "2147483648", 10);
+  CheckShortest(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckShortest(0.1, "1", 0);
+  CheckShortest(1e23, "1", 24);
+  CheckShortest(1e21, "1", 22);
+  CheckShortest(9007199254740992.0, "9007199254740992", 16);
+  CheckShortest(123456789012345680.0, "12345678901234568", 18);
+
+  uint64_t smallest_normal64 = 0x0010'0000'0000'0000;
+  CheckShortest(Double(smallest_normal64).value(), "22250738585072014", -307);
+
+  uint64_t largest_denormal64 = 0x000F'FFFF'FFFF'FFFF;
+  CheckShortest(Double(largest_denormal64).value(), "2225073858507201", -307);
+}
+
+TEST(RyuDtoaPowersOfTwo) {
+  // The lower boundary is closer for powers of two. Check that they all read
+  // back as the same double.
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  for (int e = -1074; e <= 1023; e++) {
+    double v = std::ldexp(1.0, e);
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    char number[kBufferSize];
+    snprintf(number, kBufferSize, "%se%d", buffer.begin(), point - length);
+    CHECK_EQ(v, strtod(number, nullptr));
+  }
+}
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    double v = current_test.v;
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace internal
+}  // namespace v8
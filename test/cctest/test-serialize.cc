@@ -29,6 +29,7 @@
 #include <sys/stat.h>
 
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
@@ -51,6 +52,7 @@
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
+#include "src/snapshot/process-wide-code-cache.h"
 #include "src/snapshot/read-only-deserializer.h"
 #include "src/snapshot/read-only-serializer.h"
 #include "src/snapshot/snapshot-compression.h"
@@ -405,6 +407,25 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   context_blob.Dispose();
 }
 
+TEST(SnapshotCompressionChunks) {
+  // Spans several compression chunks, the last one partially filled.
+  const uint32_t kSize = 3 * MB + 17;
+  std::vector<byte> payload(kSize);
+  for (uint32_t i = 0; i < kSize; i++) {
+    payload[i] = static_cast<byte>((i * 7) ^ (i >> 10));
+  }
+  Vector<const byte> payload_vector(payload.data(), payload.size());
+  SnapshotData original_snapshot_data(payload_vector);
+  SnapshotData compressed =
+      i::SnapshotCompression::Compress(&original_snapshot_data);
+  for (bool concurrent : {false, true}) {
+    FLAG_concurrent_snapshot_decompression = concurrent;
+    SnapshotData decompressed =
+        i::SnapshotCompression::Decompress(compressed.RawData());
+    CHECK_EQ(payload_vector, decompressed.RawData());
+  }
+}
+
 UNINITIALIZED_TEST(ContextSerializerContext) {
   DisableAlwaysOpt();
   Vector<const byte> startup_blob;
@@ -2387,6 +2408,98 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+TEST(ProcessWideCodeCacheIsolates) {
+  FLAG_process_wide_code_cache = true;
+  ProcessWideCodeCache::Get()->Clear();
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+
+  auto compile_and_run = [source](v8::Isolate* isolate, bool expect_hit) {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script;
+    if (expect_hit) {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate));
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    } else {
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    }
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  };
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  compile_and_run(isolate1, false);
+  isolate1->Dispose();
+  CHECK_LT(0u, ProcessWideCodeCache::Get()->size_in_bytes());
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  compile_and_run(isolate2, true);
+  isolate2->Dispose();
+
+  ProcessWideCodeCache::Get()->Clear();
+  FLAG_process_wide_code_cache = false;
+}
+
+TEST(CodeSerializerOptimizationHints) {
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_code_cache_optimization_hints = true;
+  const char* source =
+      "function f() { return 'abc'; };"
+      "function g() { return 'def'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + g()";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(v8_str(source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &script_source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate, Script::cast(toplevel->script()));
+    int hinted = 0;
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (!info.has_optimization_hint_from_code_cache()) continue;
+      CHECK(info.Name().IsOneByteEqualTo(CStrVector("f")));
+      hinted++;
+    }
+    CHECK_EQ(1, hinted);
+  }
+  isolate2->Dispose();
+  FLAG_code_cache_optimization_hints = false;
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* source =
       "function f() {"
@@ -2545,6 +2658,82 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+namespace {
+
+class ConsumeCodeCacheThread : public v8::base::Thread {
+ public:
+  explicit ConsumeCodeCacheThread(
+      v8::ScriptCompiler::ConsumeCodeCacheTask* task)
+      : Thread(Options("ConsumeCodeCacheThread")), task_(task) {}
+
+  void Run() override { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task_;
+};
+
+// Checks {cache} on a background thread and consumes it for {source} in a new
+// isolate. Returns whether the cache was accepted.
+bool ConsumeCacheInBackground(const char* source,
+                              v8::ScriptCompiler::CachedData* cache) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  bool accepted;
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+        v8::ScriptCompiler::StartConsumingCodeCache(isolate2, cache);
+    ConsumeCodeCacheThread thread(task);
+    CHECK(thread.Start());
+    thread.Join();
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(source_str, origin, cache, task);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &script_source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    accepted = !cache->rejected;
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  return accepted;
+}
+
+}  // namespace
+
+TEST(CodeSerializerConsumeCacheTask) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  CHECK(ConsumeCacheInBackground(source, CompileRunAndProduceCache(source)));
+}
+
+TEST(CodeSerializerConsumeCacheTaskBitFlip) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+  int arbitrary_spot = 237;
+  CHECK_LT(arbitrary_spot, cache->length);
+  const_cast<uint8_t*>(cache->data)[arbitrary_spot] ^= 0x40;
+  CHECK(!ConsumeCacheInBackground(source, cache));
+}
+
+TEST(CodeSerializerConsumeCacheTaskSourceMismatch) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  const char* other_source = "function g() { return 'abc'; }; g() + 'def' ";
+  CHECK(!ConsumeCacheInBackground(other_source,
+                                  CompileRunAndProduceCache(source)));
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   const char* source1 = "'use strict'; let x = 'X'";
   const char* source2 = "'use strict'; let y = 'Y'";
@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <string>
+
 #include "src/api/api-inl.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/execution/messages.h"
@@ -1880,6 +1882,29 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashLongStrings) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Factory* factory = CcTest::i_isolate()->factory();
+
+  const int kLength = String::kMaxHashCalcLength + 100;
+  std::string chars(kLength, 'a');
+  Handle<String> flat = factory->NewStringFromAsciiChecked(chars.c_str());
+  // Strings of equal length that differ in the last character.
+  chars[kLength - 1] = 'b';
+  Handle<String> other = factory->NewStringFromAsciiChecked(chars.c_str());
+  CHECK_NE(flat->Hash(), other->Hash());
+
+  // A cons string hashes like the equal flat string.
+  Handle<String> left =
+      factory->NewStringFromAsciiChecked(chars.substr(0, kLength / 3).c_str());
+  Handle<String> right =
+      factory->NewStringFromAsciiChecked(chars.substr(kLength / 3).c_str());
+  Handle<String> cons = factory->NewConsString(left, right).ToHandleChecked();
+  CHECK(cons->IsConsString());
+  CHECK_EQ(other->Hash(), cons->Hash());
+}
+
 TEST(StringEquals) {
   v8::V8::Initialize();
   v8::Isolate* isolate = CcTest::isolate();
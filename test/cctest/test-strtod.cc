@@ -475,6 +475,31 @@ TEST(RandomStrtod) {
   }
 }
 
+// Inputs with up to 19 digits take the Eisel-Lemire path.
+TEST(RandomStrtodUint64Digits) {
+  v8::base::RandomNumberGenerator rng;
+  char buffer[kBufferSize];
+  for (int length = 16; length <= 19; length++) {
+    for (int i = 0; i < 200; ++i) {
+      int pos = 0;
+      buffer[pos++] = rng.NextInt(9) + '1';
+      for (int j = 1; j < length; ++j) {
+        buffer[pos++] = rng.NextInt(10) + '0';
+      }
+      int exponent = DeterministicRandom() % (308 * 2 + 1) - 308 - length;
+      buffer[pos] = '\0';
+      Vector<const char> vector(buffer, pos);
+      double strtod_result = Strtod(vector, exponent);
+      CHECK(CheckDouble(vector, exponent, strtod_result));
+    }
+  }
+  // Exactly halfway between two doubles, rounds to even.
+  CHECK_EQ(9007199254740992.0, StrtodChar("9007199254740993", 0));
+  CHECK_EQ(9007199254740996.0, StrtodChar("9007199254740995", 0));
+  CHECK_EQ(1.7976931348623157e308, StrtodChar("17976931348623157", 292));
+  CHECK_EQ(2.2250738585072014e-308, StrtodChar("22250738585072014", -324));
+}
+
 }  // namespace test_strtod
 }  // namespace internal
 }  // namespace v8
@@ -360,6 +360,42 @@ TEST(WeakMapsWithChainedEntries) {
   CHECK_EQ(1, i_isolate->heap()->gc_count() - initial_gc_count);
 }
 
+TEST(WeakMapChainLinearEphemeronMarking) {
+  // Skip the fixpoint iteration to mark the chain with the linear algorithm.
+  FLAG_ephemeron_fixpoint_iterations = 0;
+  FLAG_incremental_marking = false;
+  ManualGCScope manual_gc_scope;
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = factory->NewJSWeakMap();
+  Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+
+  // Two chains key[0] -> key[1] -> ... -> key[kLength - 1], inserted in
+  // reverse order. Only the head of the first chain is kept alive.
+  const int kLength = 100;
+  Handle<Object> head;
+  for (int chain = 0; chain < 2; chain++) {
+    HandleScope inner_scope(isolate);
+    Handle<JSObject> value = factory->NewJSObjectFromMap(map);
+    for (int i = 0; i < kLength; i++) {
+      Handle<JSObject> key = factory->NewJSObjectFromMap(map);
+      int32_t hash = key->GetOrCreateHash(isolate).value();
+      JSWeakCollection::Set(weakmap, key, value, hash);
+      value = key;
+    }
+    if (chain == 0) head = isolate->global_handles()->Create(*value);
+  }
+  CHECK_EQ(2 * kLength,
+           EphemeronHashTable::cast(weakmap->table()).NumberOfElements());
+
+  CcTest::PreciseCollectAllGarbage();
+  CHECK_EQ(kLength,
+           EphemeronHashTable::cast(weakmap->table()).NumberOfElements());
+  GlobalHandles::Destroy(head.location());
+}
+
 }  // namespace test_weakmaps
 }  // namespace internal
 }  // namespace v8
@@ -511,6 +511,26 @@ TEST(WasmPackedStructS) {
   tester.CheckResult(kF1, static_cast<int16_t>(expected_output_1));
 }
 
+TEST(WasmStructFieldLayout) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  StructType::Builder builder(&zone, 5);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmF64, true);
+  builder.AddField(kWasmI16, true);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI32, true);
+  StructType* type = builder.Build();
+
+  // Larger fields come first, equally sized fields in declaration order.
+  CHECK_EQ(14u, type->field_offset(0));
+  CHECK_EQ(0u, type->field_offset(1));
+  CHECK_EQ(12u, type->field_offset(2));
+  CHECK_EQ(15u, type->field_offset(3));
+  CHECK_EQ(8u, type->field_offset(4));
+  CHECK_EQ(16u, type->total_fields_size());
+}
+
 TEST(WasmLetInstruction) {
   WasmGCTester tester;
   const byte type_index =
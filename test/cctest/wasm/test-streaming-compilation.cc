@@ -1367,6 +1367,62 @@ STREAM_TEST(TestProfilingMidStreaming) {
   cpu_profiler->Dispose();
 }
 
+// Test that an invalid lazily compiled function is detected by background
+// validation, and reported at the end of the stream.
+STREAM_TEST(TestErrorInLazyFunctionDetectedByBackgroundValidation) {
+  i::FlagScope<bool> lazy_compilation(&i::FLAG_wasm_lazy_compilation, true);
+  i::FlagScope<bool> background_validation(
+      &i::FLAG_wasm_background_lazy_validation, true);
+  for (bool valid : {true, false}) {
+    StreamTester tester(isolate);
+
+    uint8_t code[] = {
+        U32V_1(4),                  // body size
+        U32V_1(0),                  // locals count
+        kExprLocalGet, 0, kExprEnd  // body
+    };
+
+    uint8_t invalid_code[] = {
+        U32V_1(4),                  // body size
+        U32V_1(0),                  // locals count
+        kExprI64Const, 0, kExprEnd  // body
+    };
+
+    const uint8_t bytes[] = {
+        WASM_MODULE_HEADER,                 // module header
+        kTypeSectionCode,                   // section code
+        U32V_1(1 + SIZEOF_SIG_ENTRY_x_x),   // section size
+        U32V_1(1),                          // type count
+        SIG_ENTRY_x_x(kI32Code, kI32Code),  // signature entry
+        kFunctionSectionCode,               // section code
+        U32V_1(1 + 3),                      // section size
+        U32V_1(3),                          // functions count
+        0,                                  // signature index
+        0,                                  // signature index
+        0,                                  // signature index
+        kCodeSectionCode,                   // section code
+        U32V_1(1 + arraysize(code) * 3),    // section size
+        U32V_1(3),                          // functions count
+    };
+
+    tester.OnBytesReceived(bytes, arraysize(bytes));
+    tester.OnBytesReceived(code, arraysize(code));
+    tester.RunCompilerTasks();
+    if (valid) {
+      tester.OnBytesReceived(code, arraysize(code));
+    } else {
+      tester.OnBytesReceived(invalid_code, arraysize(invalid_code));
+    }
+    tester.RunCompilerTasks();
+    tester.OnBytesReceived(code, arraysize(code));
+    tester.FinishStream();
+    tester.RunCompilerTasks();
+
+    CHECK_EQ(valid, tester.IsPromiseFulfilled());
+    CHECK_EQ(!valid, tester.IsPromiseRejected());
+  }
+}
+
 #undef STREAM_TEST
 
 }  // namespace wasm
@@ -77,9 +77,13 @@ class WasmSerializationTest {
   }
 
   void DeserializeAndRun() {
-    ErrorThrower thrower(CcTest::i_isolate(), "");
     Handle<WasmModuleObject> module_object;
     CHECK(Deserialize().ToHandle(&module_object));
+    InstantiateAndRun(module_object);
+  }
+
+  void InstantiateAndRun(Handle<WasmModuleObject> module_object) {
+    ErrorThrower thrower(CcTest::i_isolate(), "");
     {
       DisallowHeapAllocation assume_no_gc;
       Vector<const byte> deserialized_module_wire_bytes =
@@ -329,6 +333,26 @@ UNINITIALIZED_TEST(CompiledWasmModulesTransfer) {
   from_isolate->Dispose();
 }
 
+TEST(DeserializeLazily) {
+  WasmSerializationTest test;
+  FlagScope<bool> lazy_deserialization(&FLAG_wasm_lazy_deserialization, true);
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    NativeModule* native_module = module_object->native_module();
+    CHECK_NOT_NULL(native_module->lazily_deserialized_code());
+    CHECK(!native_module->HasCode(0));
+
+    // The first call deserializes the function instead of compiling it.
+    test.InstantiateAndRun(module_object);
+    WasmCodeRefScope code_ref_scope;
+    CHECK(native_module->HasCode(0));
+    CHECK_EQ(ExecutionTier::kTurbofan, native_module->GetCode(0)->tier());
+  }
+  test.CollectGarbage();
+}
+
 TEST(TierDownAfterDeserialization) {
   WasmSerializationTest test;
 
@@ -13,6 +13,7 @@
 #include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -360,6 +361,35 @@ TEST(SharedEngineRunThreadedTierUp) {
   for (auto& thread : threads) thread.Join();
 }
 
+TEST(SharedEngineCacheRetainsTieredUpModule) {
+  FlagScope<size_t> budget(&FLAG_wasm_native_module_cache_budget, 16);
+  SharedEngine engine;
+  NativeModule* first_native_module;
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    SharedModule module = isolate.ExportInstance(instance);
+    WasmFeatures detected = WasmFeatures::None();
+    WasmCompilationUnit::CompileWasmFunction(
+        isolate.isolate(), module.get(), &detected,
+        &module->module()->functions[0], ExecutionTier::kTurbofan);
+    first_native_module = module.get();
+  }
+  // The first isolate is gone, but the cache kept its native module alive.
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    SharedModule module = isolate.ExportInstance(instance);
+    CHECK_EQ(first_native_module, module.get());
+    CHECK_EQ(ExecutionTier::kTurbofan, module->GetCode(0)->tier());
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+}
+
 }  // namespace test_wasm_shared_engine
 }  // namespace wasm
 }  // namespace internal
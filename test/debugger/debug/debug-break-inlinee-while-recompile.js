@@ -0,0 +1,44 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+// Flags: --no-always-opt
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+Debug = debug.Debug;
+
+var listened = 0;
+function listener(event, exec_state, event_data, data) {
+  if (event == Debug.DebugEvent.Break) listened++;
+}
+
+function inner(x) {
+  return x + 1;
+}
+
+function outer(x) {
+  return inner(x) * 2;
+}
+
+%PrepareFunctionForOptimization(outer);
+outer(1);
+outer(2);
+%OptimizeFunctionOnNextCall(outer, "concurrent");
+outer(3);  // Kick off concurrent recompilation, inlining inner.
+
+// Set a break point in the inlined function while the job is blocked.
+Debug.setListener(listener);
+Debug.setBreakPoint(inner, 1, 0);
+
+%UnblockConcurrentRecompilation();
+// The code inlining inner is discarded instead of installed.
+assertUnoptimized(outer, "sync");
+
+assertEquals(10, outer(4));
+assertEquals(1, listened);
+Debug.setListener(null);
@@ -0,0 +1,65 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString and friends cache the ICU objects for string locales. The
+// results must not depend on what else is in the cache, including after
+// entries have been evicted.
+
+const kLocales = [
+  "en-US", "de-DE", "fr-FR", "ar-EG", "hi-IN", "ja-JP", "zh-Hans-CN", "ru",
+  "th-TH-u-nu-thai", "fa", "tr", "en-US"
+];
+
+const number = 1234567.891;
+const bigint = 123456789012345678901234567890n;
+const date = new Date(Date.UTC(2020, 11, 31, 23, 59, 59));
+
+for (let round = 0; round < 3; round++) {
+  for (const locale of kLocales) {
+    assertEquals(new Intl.NumberFormat(locale).format(number),
+                 number.toLocaleString(locale));
+    assertEquals(new Intl.NumberFormat(locale).format(bigint),
+                 bigint.toLocaleString(locale));
+    assertEquals(new Intl.DateTimeFormat(locale).format(date),
+                 date.toLocaleDateString(locale));
+    assertEquals(
+        new Intl.DateTimeFormat(
+            locale, {hour: "numeric", minute: "numeric", second: "numeric"})
+            .format(date),
+        date.toLocaleTimeString(locale));
+    assertEquals(
+        new Intl.DateTimeFormat(locale, {
+          year: "numeric", month: "numeric", day: "numeric",
+          hour: "numeric", minute: "numeric", second: "numeric"
+        }).format(date),
+        date.toLocaleString(locale));
+    assertEquals(new Intl.Collator(locale).compare("a", "B"),
+                 "a".localeCompare("B", locale));
+  }
+  // Undefined locales use the default locale, not any of the above.
+  assertEquals(new Intl.NumberFormat().format(number),
+               number.toLocaleString());
+  assertEquals(new Intl.DateTimeFormat().format(date),
+               date.toLocaleDateString());
+}
+
+// Invalid locales keep throwing.
+for (let i = 0; i < 3; i++) {
+  assertThrows(() => number.toLocaleString(""), RangeError);
+  assertThrows(() => number.toLocaleString("not a locale"), RangeError);
+  assertThrows(() => date.toLocaleDateString(""), RangeError);
+  assertThrows(() => "a".localeCompare("b", ""), RangeError);
+}
+
+// Options are still observed.
+let getter_calls = 0;
+const options = {
+  get maximumFractionDigits() {
+    getter_calls++;
+    return 1;
+  }
+};
+assertEquals("1,234,567.9", number.toLocaleString("en-US", options));
+assertEquals("1,234,567.9", number.toLocaleString("en-US", options));
+assertEquals(2, getter_calls);
@@ -0,0 +1,25 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function benchy(fn, name) {
+  new BenchmarkSuite(name, [1], [
+    new Benchmark(name, true, false, 0, fn),
+  ]);
+}
+
+const LENGTH = 10000;
+
+const SMIS = [];
+const DOUBLES = [];
+for (let i = 0; i < LENGTH; ++i) {
+  SMIS.push(i);
+  DOUBLES.push(i + 0.5);
+}
+
+// Search for the last element so that the whole array is scanned.
+benchy(() => SMIS.indexOf(LENGTH - 1), 'Smi-indexOf');
+benchy(() => SMIS.includes(LENGTH - 1), 'Smi-includes');
+benchy(() => DOUBLES.indexOf(LENGTH - 0.5), 'Double-indexOf');
+benchy(() => DOUBLES.includes(LENGTH - 0.5), 'Double-includes');
+benchy(() => DOUBLES.includes(NaN), 'Double-includes-NaN');
@@ -0,0 +1,40 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Combinators', [1000], [
+  new Benchmark('PromiseAll', false, false, 0, PromiseAll, CombinatorsSetup),
+  new Benchmark('PromiseAllSettled', false, false, 0, PromiseAllSettled,
+                CombinatorsSetup),
+  new Benchmark('PromiseAny', false, false, 0, PromiseAny, CombinatorsSetup),
+]);
+
+const kPromiseCount = 10000;
+var resolvedPromises, rejectedPromises;
+
+function CombinatorsSetup() {
+  resolvedPromises = [];
+  rejectedPromises = [];
+  for (let i = 0; i < kPromiseCount; i++) {
+    resolvedPromises.push(Promise.resolve(i));
+    rejectedPromises.push(Promise.reject(i));
+  }
+  // Don't report the rejections as unhandled.
+  rejectedPromises.forEach(p => p.catch(() => {}));
+  %PerformMicrotaskCheckpoint();
+}
+
+function PromiseAll() {
+  Promise.all(resolvedPromises);
+  %PerformMicrotaskCheckpoint();
+}
+
+function PromiseAllSettled() {
+  Promise.allSettled(rejectedPromises);
+  %PerformMicrotaskCheckpoint();
+}
+
+function PromiseAny() {
+  Promise.any(rejectedPromises).catch(() => {});
+  %PerformMicrotaskCheckpoint();
+}
@@ -7,6 +7,7 @@ load('../base.js');
 load('baseline-babel-es2017.js');
 load('baseline-naive-promises.js');
 load('native.js');
+load('combinators.js');
 
 var success = true;
 
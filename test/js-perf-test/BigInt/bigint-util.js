@@ -8,6 +8,7 @@
 const TEST_ITERATIONS = 1000;
 const SLOW_TEST_ITERATIONS = 50;
 const BITS_CASES = [32, 64, 128, 256, 512, 1024, 2048, 4096, 8192];
+const LARGE_BITS_CASES = [4096, 16384, 65536];
 const RANDOM_BIGINTS_MAX_BITS = 64 * 100;
 
 
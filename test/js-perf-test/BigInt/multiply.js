@@ -0,0 +1,51 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+"use strict";
+
+load('bigint-util.js');
+
+let a = 0n;
+let b = 0n;
+
+// This dummy ensures that the feedback for benchmark.run() in the Measure
+// function from base.js is not monomorphic, thereby preventing the benchmarks
+// below from being inlined. This ensures consistent behavior and comparable
+// results.
+new BenchmarkSuite('Prevent-Inline-Dummy', [10000], [
+  new Benchmark('Prevent-Inline-Dummy', true, false, 0, () => {})
+]);
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`Multiply-${d}`, [1000], [
+    new Benchmark(`Multiply-${d}`, true, false, 0, TestMultiply,
+      () => SetUpTestMultiply(d, d))
+  ]);
+});
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`Multiply-Unbalanced-${d}`, [1000], [
+    new Benchmark(`Multiply-Unbalanced-${d}`, true, false, 0, TestMultiply,
+      () => SetUpTestMultiply(d, d / 4))
+  ]);
+});
+
+
+function SetUpTestMultiply(a_bits, b_bits) {
+  a = RandomBigIntWithBits(a_bits);
+  b = RandomBigIntWithBits(b_bits);
+}
+
+
+function TestMultiply() {
+  let product = 0n;
+
+  for (let i = 0; i < SLOW_TEST_ITERATIONS; ++i) {
+    product = a * b;
+  }
+
+  return product;
+}
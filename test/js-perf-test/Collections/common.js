@@ -4,6 +4,7 @@
 
 var N = 10;
 var LargeN = 1e4;
+var HugeN = 1e6;
 var keys;
 var keyValuePairs;
 
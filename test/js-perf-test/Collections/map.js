@@ -36,6 +36,16 @@ var MapObjectLargeBenchmark = new BenchmarkSuite('Map-Object-Set-Get-Large', [1e
                 MapSetupObjectBaseLarge, MapTearDown),
 ]);
 
+var MapSmiHugeBenchmark = new BenchmarkSuite('Map-Smi-Set-Get-Huge', [1e8], [
+  new Benchmark('Set-Get', false, false, 0, MapSetGetHuge,
+                MapSetupSmiBaseHuge, MapTearDown),
+]);
+
+var MapStringHugeBenchmark = new BenchmarkSuite('Map-String-Set-Get-Huge', [1e8], [
+  new Benchmark('Set-Get', false, false, 0, MapSetGetHuge,
+                MapSetupStringBaseHuge, MapTearDown),
+]);
+
 var MapIterationBenchmark = new BenchmarkSuite('Map-Iteration', [1000], [
   new Benchmark('ForEach', false, false, 0, MapForEach, MapSetupSmi, MapTearDown),
 ]);
@@ -83,6 +93,16 @@ function MapSetupObjectBaseLarge() {
   map = new Map;
 }
 
+function MapSetupSmiBaseHuge() {
+  SetupSmiKeys(2 * HugeN);
+  map = new Map;
+}
+
+function MapSetupStringBaseHuge() {
+  SetupStringKeys(2 * HugeN);
+  map = new Map;
+}
+
 function MapSetupObject() {
   MapSetupObjectBase();
   MapSetObject();
@@ -246,6 +266,22 @@ function MapSetGetObjectLarge() {
   }
 }
 
+function MapSetGetHuge() {
+  for (var i = 0; i < HugeN; i++) {
+    map.set(keys[i * 2], i);
+  }
+  for (var i = 0; i < HugeN; i++) {
+    if (map.get(keys[i * 2]) !== i) {
+      throw new Error();
+    }
+  }
+  for (var i = 0; i < HugeN; i++) {
+    if (map.get(keys[i * 2 + 1]) !== undefined) {
+      throw new Error();
+    }
+  }
+}
+
 function MapDeleteObject() {
   // This is run more than once per setup so we will end up deleting items
   // more than once. Therefore, we do not the return value of delete.
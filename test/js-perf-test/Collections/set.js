@@ -31,6 +31,11 @@ var SetDoubleBenchmark = new BenchmarkSuite('Set-Double', [1000], [
 ]);
 
 
+var SetSmiHugeBenchmark = new BenchmarkSuite('Set-Smi-Add-Has-Huge', [1e8], [
+  new Benchmark('Add-Has', false, false, 0, SetAddHasHuge,
+                SetSetupSmiBaseHuge, SetTearDown),
+]);
+
 var SetIterationBenchmark = new BenchmarkSuite('Set-Iteration', [1000], [
   new Benchmark('ForEach', false, false, 0, SetForEach, SetSetupSmi, SetTearDown),
 ]);
@@ -57,6 +62,12 @@ function SetSetupSmiBase() {
 }
 
 
+function SetSetupSmiBaseHuge() {
+  SetupSmiKeys(2 * HugeN);
+  set = new Set;
+}
+
+
 function SetSetupSmi() {
   SetSetupSmiBase();
   SetAddSmi();
@@ -116,6 +127,23 @@ function SetAddSmi() {
 }
 
 
+function SetAddHasHuge() {
+  for (var i = 0; i < HugeN; i++) {
+    set.add(keys[i * 2]);
+  }
+  for (var i = 0; i < HugeN; i++) {
+    if (!set.has(keys[i * 2])) {
+      throw new Error();
+    }
+  }
+  for (var i = 0; i < HugeN; i++) {
+    if (set.has(keys[i * 2 + 1])) {
+      throw new Error();
+    }
+  }
+}
+
+
 function SetHasSmi() {
   for (var i = 0; i < N; i++) {
     if (!set.has(keys[i])) {
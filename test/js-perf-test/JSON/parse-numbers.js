@@ -0,0 +1,53 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Payloads dominated by doubles as they come out of JSON.stringify, that is
+// mostly with 15 to 17 significant digits.
+function MakeNumbers() {
+  const numbers = [];
+  let seed = 1;
+  for (let i = 0; i < 1000; i++) {
+    seed = (seed * 16807) % 2147483647;
+    numbers.push(seed / 2147483647 * 360 - 180);
+  }
+  return numbers;
+}
+
+const kNumbers = MakeNumbers();
+const kNumberStrings = kNumbers.map(String);
+const kNumbersPayload = JSON.stringify(kNumbers.map((n, i) => {
+  return {id: i, lat: n / 2, lng: n, price: Math.round(n * 100) / 100};
+}));
+
+function ParseNumbers() {
+  return JSON.parse(kNumbersPayload);
+}
+
+function ParseFloatStrings() {
+  let sum = 0;
+  for (let i = 0; i < kNumberStrings.length; i++) {
+    sum += parseFloat(kNumberStrings[i]);
+  }
+  return sum;
+}
+
+function NumberFromStrings() {
+  let sum = 0;
+  for (let i = 0; i < kNumberStrings.length; i++) {
+    sum += Number(kNumberStrings[i]);
+  }
+  return sum;
+}
+
+new BenchmarkSuite('ParseNumbers', [1000], [
+  new Benchmark('ParseNumbers', false, false, 0, ParseNumbers),
+]);
+
+new BenchmarkSuite('ParseFloatStrings', [1000], [
+  new Benchmark('ParseFloatStrings', false, false, 0, ParseFloatStrings),
+]);
+
+new BenchmarkSuite('NumberFromStrings', [1000], [
+  new Benchmark('NumberFromStrings', false, false, 0, NumberFromStrings),
+]);
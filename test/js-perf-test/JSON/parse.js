@@ -0,0 +1,45 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Payloads dominated by long string values, which is where scanning string
+// contents matters most.
+function MakePayload(text) {
+  const items = [];
+  for (let i = 0; i < 1000; i++) {
+    items.push({id: i, name: `item-${i}`, description: text});
+  }
+  return JSON.stringify(items);
+}
+
+const kOneByteText = 'The quick brown fox jumps over the dog. '.repeat(20);
+const kTwoByteText = 'Der schnelle braune Fuchs — springt. '.repeat(20);
+const kEscapedText = 'line one\\nline two \\"quoted\\" '.repeat(20);
+
+const kOneBytePayload = MakePayload(kOneByteText);
+const kTwoBytePayload = MakePayload(kTwoByteText);
+const kEscapedPayload = MakePayload(kEscapedText);
+
+function ParseOneByte() {
+  return JSON.parse(kOneBytePayload);
+}
+
+function ParseTwoByte() {
+  return JSON.parse(kTwoBytePayload);
+}
+
+function ParseEscaped() {
+  return JSON.parse(kEscapedPayload);
+}
+
+new BenchmarkSuite('ParseOneByteStrings', [1000], [
+  new Benchmark('ParseOneByteStrings', false, false, 0, ParseOneByte),
+]);
+
+new BenchmarkSuite('ParseTwoByteStrings', [1000], [
+  new Benchmark('ParseTwoByteStrings', false, false, 0, ParseTwoByte),
+]);
+
+new BenchmarkSuite('ParseEscapedStrings', [1000], [
+  new Benchmark('ParseEscapedStrings', false, false, 0, ParseEscaped),
+]);
@@ -107,6 +107,12 @@ function CreateTestFunctionGen(fn) {
 
 var TestFunctions = {
   "Object.keys()": CreateTestFunctionGen(() => {return Object.keys(object)}),
+  "Object.values()": CreateTestFunctionGen(() => {
+    return Object.values(object)
+  }),
+  "Object.entries()": CreateTestFunctionGen(() => {
+    return Object.entries(object)
+  }),
   "for-in": CreateTestFunctionGen(() => {
     var count = 0;
     var result;
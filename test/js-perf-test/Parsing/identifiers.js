@@ -0,0 +1,24 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("LongIdentifiers", [1000], [
+  new Benchmark("LongIdentifiers", false, true, iterations, Run, LongIdentifiersSetup)
+]);
+
+new BenchmarkSuite("IndentedCode", [1000], [
+  new Benchmark("IndentedCode", false, true, iterations, Run, IndentedCodeSetup)
+]);
+
+function LongIdentifiersSetup() {
+  code = "var someRatherLongIdentifierName_0123456789$;\n".repeat(300);
+  %FlattenString(code);
+}
+
+function IndentedCodeSetup() {
+  code = "function f() {\n" +
+      "                if (x) {\n                  y = z;\n                }\n"
+          .repeat(200) +
+      "}";
+  %FlattenString(code);
+}
@@ -11,6 +11,7 @@ let code;
 load("comments.js");
 load("strings.js");
 load("arrowfunctions.js")
+load("identifiers.js");
 
 var success = true;
 
@@ -43,10 +43,27 @@ function Recursive() {
   StepOne(kInitialRecursionValue);
 }
 
+// Errors used for control flow: thrown, caught and never formatted.
+function Validate(value) {
+  if (typeof value !== "number") throw new TypeError("Not a number!");
+  return value;
+}
+function Throw() {
+  function Check(value) {
+    try {
+      return Validate(value);
+    } catch (e) {
+      return 0;
+    }
+  }
+  for (let i = 0; i < 10; ++i) Check("invalid");
+}
+
 createSuite('Simple-Capture-Error', 1000, Simple, () => {});
 createSuite('Custom-Capture-Error', 1000, Custom, () => {});
 
 createSuite('Inline-Capture-Error', 1000, Inline, () => {});
 createSuite('Recursive-Capture-Error', 1000, Recursive, () => {});
+createSuite('Throw-Capture-Error', 1000, Throw, () => {});
 
 })();
@@ -0,0 +1,26 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('SetFromDifferentTypeLarge', [1000], [
+  new Benchmark('SetFromDifferentTypeLarge', false, false, 0,
+                SetFromDifferentTypeLarge),
+]);
+
+const length = 4096;
+
+const uint8_clamped_array = new Uint8ClampedArray(length);
+const int16_array = new Int16Array(length);
+const float32_array = new Float32Array(length);
+const float64_array = new Float64Array(length);
+for (let i = 0; i < length; i++) {
+  float64_array[i] = Math.sin(i) * 300;
+}
+
+function SetFromDifferentTypeLarge() {
+  uint8_clamped_array.set(float64_array);
+  int16_array.set(float64_array);
+  float32_array.set(float64_array);
+  float32_array.set(int16_array);
+  float64_array.set(float32_array);
+}
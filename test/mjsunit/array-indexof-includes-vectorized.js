@@ -0,0 +1,75 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long searches on Smi and double arrays use vectorized implementations.
+// Check every position and start index around the vector widths.
+
+(function TestSmiElements() {
+  for (let length = 0; length < 70; ++length) {
+    const a = [];
+    for (let i = 0; i < length; ++i) a.push(i * 3);
+    assertTrue(%HasSmiElements(a));
+    for (let i = 0; i < length; ++i) {
+      assertEquals(i, a.indexOf(i * 3));
+      assertTrue(a.includes(i * 3));
+      assertEquals(i, a.indexOf(i * 3, i));
+      assertEquals(-1, a.indexOf(i * 3, i + 1));
+      assertEquals(i === length - 1 ? -1 : i + 1, a.indexOf((i + 1) * 3, i));
+    }
+    assertEquals(-1, a.indexOf(1));
+    assertFalse(a.includes(-1));
+    assertFalse(a.includes(undefined));
+    assertEquals(length === 0 ? -1 : 0, a.indexOf(-0));
+    assertEquals(length > 1 ? 1 : -1, a.indexOf(3.0));
+  }
+})();
+
+(function TestHoleySmiElements() {
+  const a = new Array(100);
+  a[80] = 7;
+  assertTrue(%HasSmiElements(a));
+  assertTrue(%HasHoleyElements(a));
+  assertEquals(80, a.indexOf(7));
+  assertEquals(-1, a.indexOf(8));
+  assertTrue(a.includes(7));
+  assertTrue(a.includes(undefined));
+})();
+
+(function TestDoubleElements() {
+  for (let length = 0; length < 70; ++length) {
+    const a = [0.5];
+    for (let i = 1; i < length; ++i) a.push(i + 0.5);
+    if (length === 0) a.pop();
+    assertTrue(%HasDoubleElements(a));
+    for (let i = 0; i < length; ++i) {
+      assertEquals(i, a.indexOf(i + 0.5));
+      assertTrue(a.includes(i + 0.5));
+      assertEquals(-1, a.indexOf(i + 0.5, i + 1));
+    }
+    assertEquals(-1, a.indexOf(1));
+    assertFalse(a.includes(NaN));
+    assertEquals(-1, a.indexOf(NaN));
+  }
+})();
+
+(function TestDoubleElementsSpecialValues() {
+  const a = [];
+  for (let i = 0; i < 64; ++i) a.push(i + 0.5);
+  a[40] = NaN;
+  a[50] = -0;
+  a[60] = 7;
+  assertTrue(%HasDoubleElements(a));
+  assertEquals(-1, a.indexOf(NaN));
+  assertTrue(a.includes(NaN));
+  assertFalse(a.includes(NaN, 41));
+  assertEquals(50, a.indexOf(0));
+  assertEquals(50, a.indexOf(-0));
+  assertTrue(a.includes(0));
+  assertEquals(60, a.indexOf(7));
+  assertEquals(60, a.indexOf(7.0, -10));
+  assertEquals(-1, a.indexOf('7'));
+  assertFalse(a.includes(undefined));
+})();
@@ -0,0 +1,93 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Sorting packed number arrays with (a, b) => a - b style comparators, which
+// take a native fast path.
+
+function Ascending(a, b) { return a - b; }
+function Descending(a, b) { return b - a; }
+
+let seed = 7;
+function Random(range) {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed % range;
+}
+
+function Check(array, comparefn) {
+  const expected = array.slice();
+  // Wrapping the comparator keeps the generic TimSort path.
+  expected.sort((a, b) => comparefn(a, b));
+  assertSame(array, array.sort(comparefn));
+  assertEquals(expected.length, array.length);
+  for (let i = 0; i < array.length; i++) {
+    assertSame(expected[i], array[i]);
+  }
+}
+
+for (const length of [2, 3, 10, 100, 1000]) {
+  const smis = [];
+  const doubles = [];
+  for (let i = 0; i < length; i++) {
+    smis.push(Random(length) - (length >> 1));
+    doubles.push((Random(length) - (length >> 1)) / 4);
+  }
+  Check(smis.slice(), Ascending);
+  Check(smis.slice(), Descending);
+  Check(smis.slice(), (x, y) => x - y);
+  Check(smis.slice(), (x, y) => y - x);
+  Check(doubles.slice(), Ascending);
+  Check(doubles.slice(), Descending);
+}
+
+// The sort is stable, so -0 and 0 keep their relative order.
+(function() {
+  const array = [0, -0, 1.5, -0, 0, -1.5];
+  array.sort(Ascending);
+  assertEquals([-1.5, 0, -0, -0, 0, 1.5], array);
+  assertSame(-0, array[2]);
+  assertSame(-0, array[3]);
+  array.sort(Descending);
+  assertEquals([1.5, 0, -0, -0, 0, -1.5], array);
+})();
+
+(function() {
+  const array = [Infinity, 2.5, -Infinity, Number.MAX_VALUE, -0.5];
+  array.sort(Ascending);
+  assertEquals([-Infinity, -0.5, 2.5, Number.MAX_VALUE, Infinity], array);
+})();
+
+// NaN elements fall back to the generic sort.
+(function() {
+  Check([3.5, NaN, 1.5, NaN, 2.5], Ascending);
+  Check([3.5, NaN, 1.5, NaN, 2.5], Descending);
+})();
+
+// Array literals share copy-on-write backing stores.
+(function() {
+  function Make() { return [5, 3, 1, 4, 2]; }
+  assertEquals([1, 2, 3, 4, 5], Make().sort(Ascending));
+  assertEquals([5, 3, 1, 4, 2], Make());
+  assertEquals([5, 4, 3, 2, 1], Make().sort(Descending));
+  assertEquals([5, 3, 1, 4, 2], Make());
+})();
+
+// Comparators that merely look similar still get called.
+(function() {
+  let calls = 0;
+  function Counting(a, b) { calls++; return a - b; }
+  assertEquals([1, 2, 3], [3, 1, 2].sort(Counting));
+  assertTrue(calls > 0);
+
+  assertEquals([3, 2, 1], [3, 1, 2].sort((a, b) => a - b - 2 * (a - b)));
+  assertEquals([1, 2, 3], [2, 3, 1].sort(function(a, b, c) { return a - b; }));
+  assertEquals([1, 2, 3], [3, 2, 1].sort((a, b) => a - a + b - b + a - b));
+})();
+
+// Other element kinds keep going through TimSort.
+(function() {
+  Check([3, 1, , 2], Ascending);
+  Check([3, "1", 2], Ascending);
+  Check([3, {valueOf() { return 1; }}, 2], Ascending);
+  Check([3.5, 1, 2, , 0.5], Descending);
+})();
@@ -0,0 +1,36 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --validate-asm --asm-wasm-background-compilation
+// Flags: --allow-natives-syntax
+
+function Module(stdlib, foreign, heap) {
+  "use asm";
+  var MEM32 = new stdlib.Int32Array(heap);
+  function store(i, v) {
+    i = i | 0;
+    v = v | 0;
+    MEM32[i >> 2] = v;
+  }
+  function load(i) {
+    i = i | 0;
+    return MEM32[i >> 2] | 0;
+  }
+  function sum(n) {
+    n = n | 0;
+    var i = 0;
+    var s = 0;
+    for (i = 0; (i | 0) < (n | 0); i = (i + 1) | 0) {
+      s = (s + (load(i << 2) | 0)) | 0;
+    }
+    return s | 0;
+  }
+  return {store: store, load: load, sum: sum};
+}
+
+var m = Module(this, {}, new ArrayBuffer(1 << 16));
+assertTrue(%IsAsmWasmCode(Module));
+for (var i = 0; i < 100; i++) m.store(i * 4, i);
+assertEquals(42, m.load(42 * 4));
+assertEquals(4950, m.sum(100));
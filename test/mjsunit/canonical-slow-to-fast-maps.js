@@ -0,0 +1,61 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --canonical-slow-to-fast-maps
+
+(function TestSharesExistingMap() {
+  const a = {};
+  a.x = 1;
+  a.z = 2;
+  a.y = 3;
+
+  const b = {};
+  b.x = 4;
+  b.y = 5;
+  b.z = 6;
+  delete b.y;
+  assertFalse(%HasFastProperties(b));
+  b.y = 7;
+  %ToFastProperties(b);
+  assertTrue(%HasFastProperties(b));
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals(4, b.x);
+  assertEquals(6, b.z);
+  assertEquals(7, b.y);
+  assertEquals(["x", "z", "y"], Object.keys(b));
+})();
+
+(function TestDifferentOrderGetsOwnMap() {
+  const a = {};
+  a.p = 1;
+  a.q = 2;
+
+  const b = {};
+  b.q = 3;
+  b.r = 4;
+  b.p = 5;
+  delete b.r;
+  assertFalse(%HasFastProperties(b));
+  %ToFastProperties(b);
+  assertTrue(%HasFastProperties(b));
+  assertFalse(%HaveSameMap(a, b));
+  assertEquals(["q", "p"], Object.keys(b));
+})();
+
+(function TestIncompatibleRepresentation() {
+  const a = {};
+  a.u = 1;
+  a.v = 2;
+
+  const b = {};
+  b.u = 1;
+  b.w = 2;
+  b.v = 0.5;
+  delete b.w;
+  assertFalse(%HasFastProperties(b));
+  %ToFastProperties(b);
+  assertTrue(%HasFastProperties(b));
+  assertEquals(1, b.u);
+  assertEquals(0.5, b.v);
+})();
@@ -480,3 +480,42 @@
   arr = Object.freeze([,1,2,'a',4,5]);
   test();
 })();
+
+// Large arrays share their backing store with the clone copy-on-write.
+(function() {
+  function make() {
+    const arr = [];
+    for (let i = 0; i < 1000; i++) arr.push(i);
+    return arr;
+  }
+
+  function store(a, i, v) {
+    a[i] = v;
+  }
+
+  %PrepareFunctionForOptimization(store);
+  store(make(), 0, 0);
+  store(make(), 0, 0);
+  %OptimizeFunctionOnNextCall(store);
+  store(make(), 0, 0);
+
+  const arr = make();
+  const clones = [arr.slice(), [...arr], Array.from(arr)];
+  store(arr, 1, 'a');
+  arr.push(1000);
+  clones[0][2] = 'b';
+  clones[1].pop();
+  clones[2].length = 10;
+  assertEquals('a', arr[1]);
+  assertEquals(2, arr[2]);
+  assertEquals(1001, arr.length);
+  assertEquals(1, clones[0][1]);
+  assertEquals('b', clones[0][2]);
+  assertEquals(1000, clones[0].length);
+  assertEquals(999, clones[1].length);
+  assertEquals(2, clones[1][2]);
+  assertEquals(10, clones[2].length);
+  assertEquals(999, clones[0][999]);
+  %HeapObjectVerify(arr);
+  for (const clone of clones) %HeapObjectVerify(clone);
+})();
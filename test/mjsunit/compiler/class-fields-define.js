@@ -0,0 +1,64 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Public fields are defined with CreateDataProperty, both on fresh instances
+// and on objects returned from a base class constructor.
+class Base {
+  constructor(o) { if (o !== undefined) return o; }
+}
+
+class C extends Base {
+  a = 1;
+  b = 2;
+  ['c'] = 3;
+  0 = 4;
+}
+
+function create(o) { return new C(o); }
+
+function test() {
+  var c = create();
+  assertEquals(['0', 'a', 'b', 'c'], Object.keys(c));
+  assertEquals({value: 2, writable: true, enumerable: true,
+                configurable: true},
+               Object.getOwnPropertyDescriptor(c, 'b'));
+
+  // Existing configurable properties are redefined, even accessors.
+  var o = {get a() { return 0; }, b: 0};
+  assertSame(o, create(o));
+  assertEquals(1, o.a);
+  assertEquals(2, o.b);
+
+  // Setters on the prototype chain are not called.
+  var proto = {set a(v) { throw new Error('setter called'); }};
+  var p = create(Object.create(proto));
+  assertTrue(p.hasOwnProperty('a'));
+
+  // Non-configurable and non-extensible receivers throw.
+  var frozen = Object.freeze({a: 0});
+  assertThrows(() => create(frozen), TypeError);
+  assertThrows(() => create(Object.preventExtensions({})), TypeError);
+  var nc = {};
+  Object.defineProperty(nc, 'b', {value: 0, writable: true});
+  assertThrows(() => create(nc), TypeError);
+
+  // Proxies see a defineProperty trap call.
+  var defined = [];
+  var proxy = new Proxy({}, {
+    defineProperty(target, name, desc) {
+      defined.push(name);
+      return Reflect.defineProperty(target, name, desc);
+    }
+  });
+  create(proxy);
+  assertEquals(['a', 'b', 'c', '0'], defined);
+}
+
+%PrepareFunctionForOptimization(create);
+test();
+test();
+%OptimizeFunctionOnNextCall(create);
+test();
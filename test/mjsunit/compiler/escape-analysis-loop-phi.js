@@ -0,0 +1,60 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// An object that reaches a loop phi on every path stays virtual.
+function sum(n) {
+  var o = {x: 1};
+  var p = o;
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    p = (i & 1) ? o : p;
+    result += p.x;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(10, sum(10));
+assertEquals(10, sum(10));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(10, sum(10));
+
+// The object is materialized when deoptimizing inside the loop.
+function deopt(n) {
+  var o = {x: 1};
+  var p = o;
+  for (var i = 0; i < n; i++) {
+    p = (i & 1) ? o : p;
+    if (i == 5) %_DeoptimizeNow();
+    p.x++;
+  }
+  return [o.x, p === o];
+}
+
+%PrepareFunctionForOptimization(deopt);
+assertEquals([11, true], deopt(10));
+assertEquals([11, true], deopt(10));
+%OptimizeFunctionOnNextCall(deopt);
+assertEquals([11, true], deopt(10));
+
+// Merging two different objects still lets them escape.
+function merge(n) {
+  var a = {x: 1};
+  var b = {x: 2};
+  var p = a;
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    p = (i & 1) ? a : b;
+    result += p.x;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(merge);
+assertEquals(15, merge(10));
+assertEquals(15, merge(10));
+%OptimizeFunctionOnNextCall(merge);
+assertEquals(15, merge(10));
@@ -0,0 +1,33 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function() {
+  function C() {}
+  C.prototype.m = function() { return 1; };
+  const receivers = [];
+  for (let i = 0; i < 10; i++) {
+    const o = new C();
+    o['p' + i] = i;
+    receivers.push(o);
+  }
+
+  function foo(o) { return o.m; }
+  %PrepareFunctionForOptimization(foo);
+  for (const o of receivers) foo(o);
+  for (const o of receivers) foo(o);
+  %OptimizeFunctionOnNextCall(foo);
+  for (const o of receivers) assertEquals(1, foo(o)());
+  assertOptimized(foo);
+
+  // Changing the prototype invalidates the cached handlers.
+  C.prototype.m = function() { return 2; };
+  for (const o of receivers) assertEquals(2, foo(o)());
+  Object.setPrototypeOf(C.prototype, { m() { return 3; } });
+  delete C.prototype.m;
+  for (const o of receivers) assertEquals(3, foo(o)());
+  assertEquals(undefined, foo({}));
+  assertThrows(() => foo(null), TypeError);
+})();
@@ -0,0 +1,65 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-variable
+
+// Induction variable with the increment on the left-hand side.
+(function() {
+  function f(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i = 1 + i) sum += i;
+    return sum;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(45, f(10));
+  assertEquals(45, f(10));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(45, f(10));
+  assertEquals(0, f(0));
+  assertEquals(0, f(NaN));
+})();
+
+// Non-integral loop bounds.
+(function() {
+  function f(n) {
+    let last = -1;
+    for (let i = 0; i < n; i++) last = i;
+    return last;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(10, f(10.5));
+  assertEquals(9, f(10));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(10, f(10.5));
+  assertEquals(9, f(10));
+  assertEquals(-1, f(-0.5));
+  assertEquals(-1, f(NaN));
+})();
+
+(function() {
+  function f(n) {
+    let last = 1;
+    for (let i = 0; i >= n; i--) last = i;
+    return last;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(-3, f(-3.5));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(-3, f(-3.5));
+  assertEquals(-3, f(-3));
+  assertEquals(1, f(0.5));
+})();
+
+// Bounds close to the int32 limits must keep the overflow behavior.
+(function() {
+  function f(start) {
+    let i = start;
+    for (; i < 2147483647.5; i = 1 + i) {}
+    return i;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2147483648, f(2147483640));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2147483648, f(2147483640));
+})();
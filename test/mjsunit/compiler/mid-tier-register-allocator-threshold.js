@@ -0,0 +1,21 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+// Flags: --turbo-mid-tier-regalloc-instruction-threshold=1
+
+function sum(a) {
+  let result = 0;
+  for (let i = 0; i < a.length; ++i) {
+    result += a[i] * (i & 1 ? -1 : 1);
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(-2, sum([1, 2, 3, 4]));
+assertEquals(-2, sum([1, 2, 3, 4]));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(-2, sum([1, 2, 3, 4]));
+assertEquals(2.5, sum([1.5, 2, 3, 0]));
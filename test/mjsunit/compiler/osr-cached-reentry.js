@@ -0,0 +1,25 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-recompilation
+
+// Executions after the first OSR may enter cached OSR code at any loop while
+// the function is optimized concurrently.
+function f(n) {
+  var x = 0;
+  for (var i = 0; i < n; i++) {
+    x += i;
+    if (i == 5) %OptimizeOsr();
+  }
+  for (var j = 0; j < n; j++) {
+    x -= j;
+  }
+  return x;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(0, f(100));
+for (var k = 0; k < 10; k++) {
+  assertEquals(0, f(1000));
+}
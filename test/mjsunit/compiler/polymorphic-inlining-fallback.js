@@ -0,0 +1,58 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --polymorphic-inlining-fallback
+// Flags: --max-inlined-call-polymorphism=2
+
+class A { f() { return 1; } }
+class B { f() { return 2; } }
+class C { f() { return 3; } }
+class D { f() { return 4; } }
+
+// Four targets, of which two are inlined and the others are called through
+// the generic fallback.
+var objects = [new A, new B, new C, new D];
+
+function call(o) {
+  return o.f();
+}
+
+function sum() {
+  var result = 0;
+  for (var o of objects) result += call(o);
+  return result;
+}
+
+%PrepareFunctionForOptimization(call);
+assertEquals(10, sum());
+assertEquals(10, sum());
+%OptimizeFunctionOnNextCall(call);
+assertEquals(10, sum());
+assertOptimized(call);
+
+// Throwing from a target that is reached through the fallback.
+class E { f() { throw 5; } }
+
+function callOrCatch(o) {
+  try {
+    return o.f();
+  } catch (e) {
+    return e;
+  }
+}
+
+var throwing = [new A, new B, new C, new E];
+
+function sumOrCatch() {
+  var result = 0;
+  for (var o of throwing) result += callOrCatch(o);
+  return result;
+}
+
+%PrepareFunctionForOptimization(callOrCatch);
+assertEquals(11, sumOrCatch());
+assertEquals(11, sumOrCatch());
+%OptimizeFunctionOnNextCall(callOrCatch);
+assertEquals(11, sumOrCatch());
+assertOptimized(callOrCatch);
@@ -0,0 +1,28 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-profiling-guided-layout
+
+function foo(x) {
+  if (x < 0) return -x;
+  return x + 1;
+}
+
+%PrepareFunctionForOptimization(foo);
+foo(1);
+foo(-1);
+%OptimizeFunctionOnNextCall(foo);
+foo(1);
+
+// Make the negative branch look cold to the next optimization.
+let sum = 0;
+for (let i = 0; i < 200000; i++) sum += foo(i);
+assertEquals(20000100000, sum);
+
+%DeoptimizeFunction(foo);
+%PrepareFunctionForOptimization(foo);
+foo(1);
+%OptimizeFunctionOnNextCall(foo);
+assertEquals(2, foo(1));
+assertEquals(3, foo(-3));
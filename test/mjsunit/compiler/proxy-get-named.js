@@ -0,0 +1,67 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function TestGetTrap() {
+  var log = [];
+  var handler = {
+    get(target, name, receiver) {
+      log.push(name);
+      return name === 'x' ? target.x * 2 : target[name];
+    }
+  };
+  var p = new Proxy({x: 21}, handler);
+  function foo(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(42, foo(p));
+  assertEquals(42, foo(p));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(42, foo(p));
+  assertEquals(['x', 'x', 'x'], log);
+  assertOptimized(foo);
+
+  // A plain object deoptimizes because of the map check.
+  assertEquals(1, foo({x: 1}));
+  assertUnoptimized(foo);
+})();
+
+(function TestWithoutTrap() {
+  var p = new Proxy({x: 1}, {});
+  function foo(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo(p));
+  assertEquals(1, foo(p));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(1, foo(p));
+  assertEquals(undefined, foo(new Proxy({}, {})));
+})();
+
+(function TestInvariantViolation() {
+  var target = {};
+  Object.defineProperty(target, 'x', {value: 1});
+  var p = new Proxy(target, {get() { return 2; }});
+  function foo(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(foo);
+  assertThrows(() => foo(p), TypeError);
+  assertThrows(() => foo(p), TypeError);
+  %OptimizeFunctionOnNextCall(foo);
+  assertThrows(() => foo(p), TypeError);
+})();
+
+(function TestRevoked() {
+  var r = Proxy.revocable({x: 1}, {});
+  function foo(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo(r.proxy));
+  assertEquals(1, foo(r.proxy));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(1, foo(r.proxy));
+  r.revoke();
+  assertThrows(() => foo(r.proxy), TypeError);
+})();
@@ -0,0 +1,29 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turboprop-as-midtier --max-midtier-deopts=1
+// Flags: --opt --no-always-opt
+
+function load(o) {
+  return o.x;
+}
+
+// Mid-tier code deoptimizes on the new map.
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load({x: 1}));
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertOptimized(load);
+assertEquals(2, load({y: 0, x: 2}));
+assertUnoptimized(load);
+
+// The function now skips the mid tier, and the optimized code handles both
+// maps.
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load({x: 1}));
+assertEquals(2, load({y: 0, x: 2}));
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertEquals(2, load({y: 0, x: 2}));
+assertOptimized(load);
@@ -0,0 +1,38 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+(function testStoreIntoPhiOfFoldedAllocations() {
+  function foo(c, v) {
+    const a = {x: v};
+    const b = c ? {y: 1} : {z: 2};
+    b.a = a;
+    return b;
+  }
+  %PrepareFunctionForOptimization(foo);
+  foo(true, {});
+  foo(false, {});
+  %OptimizeFunctionOnNextCall(foo);
+  const results = [];
+  for (let i = 0; i < 100; i++) results.push(foo(i % 2 == 0, {i}));
+  gc();
+  for (let i = 0; i < 100; i++) assertEquals(i, results[i].a.x.i);
+})();
+
+(function testSelfStore() {
+  function foo(o) {
+    o.self = o;
+    return o;
+  }
+  %PrepareFunctionForOptimization(foo);
+  foo({self: null});
+  %OptimizeFunctionOnNextCall(foo);
+  const old = foo({self: null});
+  gc();
+  gc();
+  const o = foo(old);
+  gc();
+  assertSame(o, o.self);
+})();
@@ -0,0 +1,35 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Loads from double fields return the exact value, whether or not it is
+// integral.
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+var points = [new Point(0.5, 1.5), new Point(1, 2), new Point(-0, NaN),
+              new Point(2 ** 31, -(2 ** 31)), new Point(Infinity, -1)];
+function getX(p) { return p.x; }
+function getY(p) { return p.y; }
+
+for (var i = 0; i < 3; i++) {
+  assertEquals(0.5, getX(points[0]));
+  assertEquals(1.5, getY(points[0]));
+  assertEquals(1, getX(points[1]));
+  assertEquals(2, getY(points[1]));
+  assertEquals(-Infinity, 1 / getX(points[2]));
+  assertTrue(isNaN(getY(points[2])));
+  assertEquals(2 ** 31, getX(points[3]));
+  assertEquals(-(2 ** 31), getY(points[3]));
+  assertEquals(Infinity, getX(points[4]));
+  assertEquals(-1, getY(points[4]));
+}
+
+// Loaded values don't alias the field's box.
+var p = points[0];
+var x = getX(p);
+p.x = 7.25;
+assertEquals(0.5, x);
+assertEquals(7.25, getX(p));
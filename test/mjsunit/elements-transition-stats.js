@@ -0,0 +1,19 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --trace-elements-transition-stats
+
+function make() { return [1, 2, 3]; }
+
+for (var i = 0; i < 3; i++) {
+  var a = make();
+  a[0] = 1.5;
+  a[1] = {};
+  a[10] = 0;
+  assertEquals(11, a.length);
+}
+
+var b = new Array(4);
+b[0] = 'x';
+assertEquals('x', b[0]);
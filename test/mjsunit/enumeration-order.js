@@ -103,3 +103,32 @@ var expected = ['23', '42',  // indexed from 'o'
 var actual = [];
 for (var p in o) actual.push(p);
 assertArrayEquals(expected, actual);
+
+// Dictionary mode objects enumerate in insertion order, whether their
+// enumeration indices are dense or left sparse by many deletions.
+function TestDictionaryOrder(count, keep) {
+  var d = {a: 0, b: 0};
+  delete d.a;  // Go to dictionary mode.
+  delete d.b;
+  var expected = [];
+  for (var i = count; i > 0; i--) d['k' + i] = i;
+  for (var i = count; i > 0; i--) {
+    if (i % keep == 0) {
+      expected.push('k' + i);
+    } else {
+      delete d['k' + i];
+    }
+  }
+  for (var i = 0; i < 5; i++) {
+    d['n' + i] = i;
+    expected.push('n' + i);
+  }
+  assertArrayEquals(expected, Object.keys(d));
+  assertArrayEquals(expected, Object.getOwnPropertyNames(d));
+  var actual = [];
+  for (var p in d) actual.push(p);
+  assertArrayEquals(expected, actual);
+}
+TestDictionaryOrder(100, 1);
+TestDictionaryOrder(100, 2);
+TestDictionaryOrder(100, 10);
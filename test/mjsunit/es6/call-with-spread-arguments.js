@@ -0,0 +1,79 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function collect() {
+  return Array.prototype.slice.call(arguments);
+}
+
+(function testStrictArguments() {
+  'use strict';
+  function f() { return collect(...arguments); }
+  assertEquals([], f());
+  assertEquals([1, 2, 3], f(1, 2, 3));
+  assertEquals([1.5, 'a', undefined], f(1.5, 'a', undefined));
+})();
+
+(function testSloppyArguments() {
+  function f() { return collect(...arguments); }
+  assertEquals([], f());
+  assertEquals([1, 2, 3], f(1, 2, 3));
+})();
+
+(function testConstruct() {
+  function C() { this.args = collect(...arguments); }
+  function f() { return new C(...arguments); }
+  assertEquals([1, 2], f(1, 2).args);
+})();
+
+(function testModifiedLength() {
+  function f() {
+    arguments.length = 1;
+    return collect(...arguments);
+  }
+  assertEquals([1], f(1, 2, 3));
+  function g() {
+    arguments.length = 4;
+    return collect(...arguments);
+  }
+  assertEquals([1, 2, undefined, undefined], g(1, 2));
+})();
+
+(function testDeletedElement() {
+  'use strict';
+  function f() {
+    delete arguments[1];
+    return collect(...arguments);
+  }
+  assertEquals([1, undefined, 3], f(1, 2, 3));
+})();
+
+(function testModifiedIterator() {
+  function f() {
+    arguments[Symbol.iterator] = function*() { yield 42; };
+    return collect(...arguments);
+  }
+  assertEquals([42], f(1, 2, 3));
+})();
+
+(function testOptimized() {
+  function f() { return collect(...arguments); }
+  %PrepareFunctionForOptimization(f);
+  assertEquals([1, 2], f(1, 2));
+  assertEquals([1, 2], f(1, 2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([1, 2], f(1, 2));
+})();
+
+// This must come last, it invalidates the no elements protector.
+(function testElementsOnPrototype() {
+  'use strict';
+  Object.prototype[1] = 'proto';
+  function f() {
+    delete arguments[1];
+    return collect(...arguments);
+  }
+  assertEquals([1, 'proto', 3], f(1, 2, 3));
+})();
@@ -285,3 +285,49 @@ assertSame(Object.assign(o, {}), o);
   }
 
 })();
+
+(function empty_target_takes_source_map() {
+  function make() {
+    let o = {};
+    o.a = 1;
+    o.b = 1.5;
+    for (let i = 0; i < 10; i++) o["p" + i] = i + 0.5;
+    o[Symbol.for("s")] = "symbol";
+    return o;
+  }
+  let source = make();
+  let target = {};
+  let result = Object.assign(target, source, {c: 3});
+  %HeapObjectVerify(result);
+  assertTrue(result === target);
+  assertTrue(%HaveSameMap(make(), Object.assign({}, source)));
+  assertEquals(Reflect.ownKeys(source).concat("c"), Reflect.ownKeys(result));
+  assertEquals("symbol", result[Symbol.for("s")]);
+
+  // Doubles are not shared with the source.
+  source.b += 1;
+  source.p9 += 1;
+  assertEquals(1.5, result.b);
+  assertEquals(9.5, result.p9);
+  result.b = 42.5;
+  assertEquals(2.5, source.b);
+
+  // Non-enumerable and read-only properties are not copied as they are.
+  let hidden = make();
+  Object.defineProperty(hidden, "hidden", {value: 1, enumerable: false});
+  result = Object.assign({}, hidden);
+  %HeapObjectVerify(result);
+  assertFalse(result.hasOwnProperty("hidden"));
+  let frozen = Object.freeze(make());
+  result = Object.assign({}, frozen);
+  %HeapObjectVerify(result);
+  checkDataProperty(result, "a", 1, true, true, true);
+
+  // The identity hash of the target is kept.
+  let map = new WeakMap();
+  target = {};
+  map.set(target, "value");
+  result = Object.assign(target, make());
+  %HeapObjectVerify(result);
+  assertEquals("value", map.get(result));
+})();
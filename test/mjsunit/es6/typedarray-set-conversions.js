@@ -0,0 +1,74 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Copying between typed arrays of different types converts in blocks of
+// elements, with a fast path for blocks that are entirely in range. Compare
+// against element-wise stores for all type pairs.
+
+const kTypes = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+
+const kSpecial = [
+  NaN, -0, Infinity, -Infinity, 0.5, 1.5, 2.5, 254.5, 255.5, -0.5, 2147483647,
+  2147483647.5, 2147483648, -2147483648, -2147483648.5, 4294967295,
+  4294967296, 1e20, -1e20, 3.4028235677973362e+38, 3.4028235677973366e+38,
+  1e-310
+];
+
+function MakeSource(Type, length, with_special) {
+  const source = new Type(length);
+  let seed = 7;
+  for (let i = 0; i < length; i++) {
+    seed = (seed * 16807) % 2147483647;
+    if (with_special && i % 37 === 5) {
+      source[i] = kSpecial[(i / 37 | 0) % kSpecial.length];
+    } else {
+      source[i] = (seed / 2147483647 - 0.5) * 600;
+    }
+  }
+  return source;
+}
+
+function Expected(Type, source, offset) {
+  const expected = new Type(source.length + offset);
+  for (let i = 0; i < source.length; i++) expected[i + offset] = source[i];
+  return expected;
+}
+
+function CheckEqual(expected, actual) {
+  assertEquals(expected.length, actual.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertSame(expected[i], actual[i], `index ${i}`);
+  }
+}
+
+for (const SourceType of kTypes) {
+  for (const DestType of kTypes) {
+    for (const with_special of [false, true]) {
+      for (const length of [0, 5, 32, 100]) {
+        const source = MakeSource(SourceType, length, with_special);
+
+        const set = new DestType(length + 3);
+        set.set(source, 3);
+        CheckEqual(Expected(DestType, source, 3), set);
+
+        CheckEqual(Expected(DestType, source, 0), new DestType(source));
+        CheckEqual(Expected(DestType, source, 0), DestType.from(source));
+      }
+    }
+  }
+}
+
+// Overlapping source and destination.
+(function() {
+  const buffer = new ArrayBuffer(800);
+  const source = new Float64Array(buffer, 0, 64);
+  for (let i = 0; i < 64; i++) source[i] = i * 1.25 - 20;
+  const copy = new Float64Array(source);
+  const dest = new Int16Array(buffer, 100, 64);
+  dest.set(source);
+  CheckEqual(Expected(Int16Array, copy, 0), dest);
+})();
@@ -149,3 +149,49 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Large arrays are sorted with a radix sort; compare against sorting with an
+// explicit comparator.
+function defaultCompare(a, b) {
+  if (a < b) return -1;
+  if (b < a) return 1;
+  if (a === 0 && b === 0) return Object.is(a, -0) ? (Object.is(b, -0) ? 0 : -1)
+                                                  : (Object.is(b, -0) ? 1 : 0);
+  if (a !== a) return b !== b ? 0 : 1;
+  if (b !== b) return -1;
+  return 0;
+}
+
+for (let constructor of typedArrayConstructors) {
+  let seed = 17;
+  const kLength = 5000;
+  let a = new constructor(kLength);
+  for (let i = 0; i < kLength; ++i) {
+    seed = (seed * 48271) % 2147483647;
+    a[i] = (seed % 2 ? -1 : 1) * seed / (seed % 7 + 1);
+  }
+  if (constructor === Float32Array || constructor === Float64Array) {
+    a[0] = NaN;
+    a[1] = -0;
+    a[2] = +0;
+    a[3] = -Infinity;
+    a[4] = Infinity;
+    a[5] = -NaN;
+  }
+  let expected = Array.from(a).sort(defaultCompare);
+  a.sort();
+  assertArrayLikeEquals(a, expected, constructor);
+}
+
+for (let constructor of [BigInt64Array, BigUint64Array]) {
+  const kLength = 5000;
+  let a = new constructor(kLength);
+  let x = 1n;
+  for (let i = 0; i < kLength; ++i) {
+    x = (x * 6364136223846793005n + 1442695040888963407n) % (2n ** 64n);
+    a[i] = x;
+  }
+  let expected = Array.from(a).sort(cmpfn);
+  a.sort();
+  assertArrayLikeEquals(a, expected, constructor);
+}
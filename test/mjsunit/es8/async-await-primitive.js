@@ -0,0 +1,48 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting values that are not objects takes one tick, like awaiting a
+// native promise, and yields the value.
+let log = [];
+
+async function f() {
+  log.push('f1');
+  log.push(await 1);
+  log.push(await 'x');
+  log.push(await undefined);
+  log.push(await Symbol.for('s'));
+  log.push(await 2n);
+}
+
+function run() {
+  log = [];
+  f();
+  Promise.resolve()
+      .then(() => log.push('p1'))
+      .then(() => log.push('p2'))
+      .then(() => log.push('p3'))
+      .then(() => log.push('p4'));
+  log.push('sync');
+  %PerformMicrotaskCheckpoint();
+  assertEquals(
+      ['f1', 'sync', 1, 'p1', 'x', 'p2', undefined, 'p3', Symbol.for('s'),
+       'p4', 2n],
+      log);
+}
+
+%PrepareFunctionForOptimization(f);
+run();
+run();
+%OptimizeFunctionOnNextCall(f);
+run();
+
+// Objects are still checked for a "then" method.
+let result;
+(async function() {
+  result = await {then(resolve) { resolve('then'); }};
+})();
+%PerformMicrotaskCheckpoint();
+assertEquals('then', result);
@@ -58,6 +58,37 @@ TestBasic();
 TestBasic(true);
 
 
+function TestFieldIndices(withWarmup) {
+  // Mix in-object, out-of-object and double fields.
+  function Make() {
+    var o = {a: 1, b: 1.5};
+    for (var i = 0; i < 8; i++) o["p" + i] = i + 0.5;
+    o.s = "str";
+    return o;
+  }
+  var o = Make();
+  if (withWarmup) {
+    for (const key in o) {}
+  }
+  var expected = Object.keys(o).map(key => [key, o[key]]);
+  assertEquals(expected, Object.entries(o));
+  assertEquals(expected, Object.entries(o));
+  assertEquals(expected.map(entry => entry[1]), Object.values(o));
+
+  // The returned numbers must not alias the object's fields.
+  var entries = Object.entries(o);
+  o.b += 1;
+  o.p7 += 1;
+  assertEquals(1.5, entries[1][1]);
+  assertEquals(7.5, entries[9][1]);
+  assertEquals(2.5, Object.entries(o)[1][1]);
+  assertEquals(8.5, Object.values(o)[9]);
+  %HeapObjectVerify(entries);
+}
+TestFieldIndices();
+TestFieldIndices(true);
+
+
 function TestToObject() {
   assertThrows(function() { Object.entries(); }, TypeError);
   assertThrows(function() { Object.entries(null); }, TypeError);
@@ -0,0 +1,44 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-sharedarraybuffer --harmony-atomics-waitasync
+
+load("test/mjsunit/harmony/atomics-waitasync-helpers.js");
+
+const script = `
+  const sab = new SharedArrayBuffer(16);
+  const i32a = new Int32Array(sab);
+
+  onmessage = function() {
+    // Waiters with timeouts in decreasing order time out in increasing order.
+    const order = [];
+    const promises = [];
+    for (let i = 0; i < 100; i++) {
+      const timeout = 100 - i;
+      const result = Atomics.waitAsync(i32a, 0, 0, timeout);
+      promises.push(result.value.then((value) => {
+        if (value != "timed-out") postMessage("unexpected " + value);
+        order.push(timeout);
+      }));
+    }
+    // A waiter without a timeout is only woken up by notify.
+    const result_notified = Atomics.waitAsync(i32a, 0, 0);
+    Promise.all(promises).then(() => {
+      let sorted = true;
+      for (let i = 1; i < order.length; i++) {
+        if (order[i - 1] > order[i]) sorted = false;
+      }
+      postMessage("sorted " + sorted);
+      postMessage("notify return value " + Atomics.notify(i32a, 0));
+    });
+    result_notified.value.then((value) => { postMessage("last " + value); });
+  }`;
+
+const expected_messages = [
+  "sorted true",
+  "notify return value 1",
+  "last ok"
+];
+
+runTestWithWorker(script, expected_messages);
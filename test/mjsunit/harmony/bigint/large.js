@@ -0,0 +1,68 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Operands big enough to take the Karatsuba multiplication, Burnikel-Ziegler
+// division and divide-and-conquer toString paths.
+
+let seed = 42;
+function RandomHex(chars) {
+  let s = "0x";
+  for (let i = 0; i < chars; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    // Mix in runs of zeros and ones, which stress carry propagation.
+    const mode = seed % 7;
+    if (mode === 0) s += "0";
+    else if (mode === 1) s += "f";
+    else s += "0123456789abcdef"[(seed >> 8) % 16];
+  }
+  return BigInt(s);
+}
+
+const kSizes = [500, 2000, 4000, 9000, 17000];
+
+for (const a_chars of kSizes) {
+  for (const b_chars of kSizes) {
+    const a = RandomHex(a_chars) | 1n;
+    const b = RandomHex(b_chars) | 1n;
+    const p = a * b;
+    assertEquals(p, b * a);
+    assertEquals(a, p / b);
+    assertEquals(b, p / a);
+    assertEquals(0n, p % a);
+    const c = b - 1n;
+    assertEquals(a, (p + c) / b);
+    assertEquals(c, (p + c) % b);
+    assertEquals(-a, (-p - c) / b);
+    assertEquals(-c, (-p - c) % b);
+  }
+}
+
+// (a + b)^2 == a^2 + 2ab + b^2 with both factors large.
+for (const size of kSizes) {
+  const a = RandomHex(size);
+  const b = RandomHex(size + 17);
+  assertEquals(a * a + 2n * a * b + b * b, (a + b) * (a + b));
+}
+
+for (const size of kSizes) {
+  const x = RandomHex(size);
+  assertEquals(x, BigInt(x.toString()));
+  assertEquals(-x, BigInt((-x).toString()));
+  assertEquals(x.toString(16), BigInt(x.toString(10)).toString(16));
+  for (const radix of [3, 7, 10, 36]) {
+    const s = x.toString(radix);
+    assertFalse(s.startsWith("0"));
+    // Re-parse by splitting off the lower half of the characters.
+    const k = Math.floor(s.length / 2);
+    let low = 0n;
+    for (const ch of s.slice(s.length - k)) {
+      low = low * BigInt(radix) + BigInt(parseInt(ch, radix));
+    }
+    assertEquals(x % BigInt(radix) ** BigInt(k), low);
+  }
+}
+
+// Powers of ten have exactly one non-zero character.
+assertEquals("1" + "0".repeat(6000), (10n ** 6000n).toString());
+assertEquals("9".repeat(6000), (10n ** 6000n - 1n).toString());
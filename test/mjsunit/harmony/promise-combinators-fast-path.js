@@ -0,0 +1,112 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-promise-any
+
+// Native promises passed to Promise.all, Promise.allSettled and Promise.any
+// share their element functions and carry the element index on the promise
+// reaction instead. Mix them with other values to cover both paths.
+
+function Settle(promise) {
+  let result;
+  promise.then(v => result = {value: v}, e => result = {error: e});
+  %PerformMicrotaskCheckpoint();
+  return result;
+}
+
+const kCount = 1000;
+
+function MakeInputs(kind) {
+  const pending = [];
+  const inputs = [];
+  for (let i = 0; i < kCount; i++) {
+    switch (i % 5) {
+      case 0: inputs.push(Promise.resolve(i)); break;
+      case 1: inputs.push(i); break;
+      case 2: inputs.push({then(resolve) { resolve(i); }}); break;
+      case 3: {
+        let resolve;
+        inputs.push(new Promise(r => resolve = r));
+        pending.push(() => resolve(i));
+        break;
+      }
+      case 4: inputs.push(kind === "reject" ? Promise.reject(i)
+                                            : Promise.resolve(i)); break;
+    }
+  }
+  // Resolve the pending ones in reverse order.
+  return {inputs, settle() { pending.reverse().forEach(f => f()); }};
+}
+
+(function TestAll() {
+  const {inputs, settle} = MakeInputs("resolve");
+  const promise = Promise.all(inputs);
+  settle();
+  const result = Settle(promise);
+  assertEquals(kCount, result.value.length);
+  for (let i = 0; i < kCount; i++) assertEquals(i, result.value[i]);
+})();
+
+(function TestAllRejects() {
+  const {inputs, settle} = MakeInputs("reject");
+  const promise = Promise.all(inputs);
+  settle();
+  assertEquals({error: 4}, Settle(promise));
+})();
+
+(function TestAllSameElement() {
+  const p = Promise.resolve("x");
+  const q = new Promise(() => {});
+  assertEquals({value: ["x", "x", "x"]}, Settle(Promise.all([p, p, p])));
+  assertEquals(undefined, Settle(Promise.all([p, q, p])));
+})();
+
+(function TestAllSettled() {
+  const {inputs, settle} = MakeInputs("reject");
+  const promise = Promise.allSettled(inputs);
+  settle();
+  const result = Settle(promise);
+  assertEquals(kCount, result.value.length);
+  for (let i = 0; i < kCount; i++) {
+    if (i % 5 === 4) {
+      assertEquals({status: "rejected", reason: i}, result.value[i]);
+    } else {
+      assertEquals({status: "fulfilled", value: i}, result.value[i]);
+    }
+  }
+})();
+
+(function TestAny() {
+  const rejected = [];
+  for (let i = 0; i < kCount; i++) rejected.push(Promise.reject(i));
+  const result = Settle(Promise.any(rejected));
+  assertInstanceof(result.error, AggregateError);
+  assertEquals(kCount, result.error.errors.length);
+  for (let i = 0; i < kCount; i++) assertEquals(i, result.error.errors[i]);
+
+  rejected[kCount >> 1] = Promise.resolve("first");
+  rejected.push(Promise.resolve("second"));
+  assertEquals({value: "first"}, Settle(Promise.any(rejected)));
+})();
+
+(function TestAnyMixed() {
+  const {inputs, settle} = MakeInputs("reject");
+  const promise = Promise.any(inputs.filter((_, i) => i % 5 === 4));
+  settle();
+  const result = Settle(promise);
+  assertEquals(kCount / 5, result.error.errors.length);
+  for (let i = 0; i < kCount / 5; i++) {
+    assertEquals(i * 5 + 4, result.error.errors[i]);
+  }
+})();
+
+// Resolving with the values array still looks up "then" on it.
+(function TestAllResolveWithThenable() {
+  Array.prototype.then = function(resolve) { resolve("then"); };
+  try {
+    assertEquals({value: "then"}, Settle(Promise.all([Promise.resolve(1)])));
+  } finally {
+    delete Array.prototype.then;
+  }
+})();
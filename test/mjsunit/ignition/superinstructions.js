@@ -0,0 +1,34 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-superinstructions --allow-natives-syntax
+
+var o = {a: {b: {c: 42}}};
+
+function load(o) {
+  return o.a.b.c;
+}
+
+%PrepareFunctionForOptimization(load);
+assertEquals(42, load(o));
+assertEquals(42, load(o));
+%OptimizeFunctionOnNextCall(load);
+assertEquals(42, load(o));
+
+// Deopts in the middle of the chain.
+var getter_calls = 0;
+var p = {a: {get b() { getter_calls++; return {c: 1}; }}};
+assertEquals(1, load(p));
+assertEquals(1, getter_calls);
+
+// Throwing loads report the right position.
+function throwing(o) {
+  return o.a.b.c;
+}
+assertThrows(() => throwing({a: {}}), TypeError);
+try {
+  throwing({a: {}});
+} catch (e) {
+  assertTrue(e.stack.includes("superinstructions.js:27"));
+}
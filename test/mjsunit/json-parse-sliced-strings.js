@@ -0,0 +1,35 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --json-slice-strings --expose-gc
+
+// Long strings without escapes share the characters of the source.
+var text = JSON.stringify({
+  short: "abc",
+  long: "a long string value",
+  escaped: "a long \"escaped\" string",
+  two_byte: "a long ሴ string value",
+  nested: [{deep: "another long string value"}],
+});
+var parsed = JSON.parse(text);
+assertEquals("abc", parsed.short);
+assertEquals("a long string value", parsed.long);
+assertEquals("a long \"escaped\" string", parsed.escaped);
+assertEquals("a long ሴ string value", parsed.two_byte);
+assertEquals("another long string value", parsed.nested[0].deep);
+
+// The strings stay valid when the source is gone.
+parsed = JSON.parse(" ".repeat(20) + '["' + "x".repeat(100) + '"]');
+gc();
+assertEquals("x".repeat(100), parsed[0]);
+
+// Sources that are slices themselves.
+var source = ('abcabcabcabcabc["possibly a sliced string"]' +
+              '[{"y":"another sliced string"}]').slice(15);
+assertEquals([{y: "another sliced string"}],
+             JSON.parse(source.slice(source.indexOf("]") + 1)));
+
+// Two-byte sources with one-byte values.
+assertEquals(["ሴ", "a one-byte string value"],
+             JSON.parse('["ሴ", "a one-byte string value"]'));
@@ -0,0 +1,36 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String contents are scanned a word at a time. Put terminators and escapes at
+// every offset relative to word boundaries.
+function Check(prefix, middle, suffix) {
+  for (let i = 0; i < 20; i++) {
+    const str = prefix.repeat(i) + middle + suffix.repeat(i);
+    assertEquals(str, JSON.parse(JSON.stringify(str)));
+    assertEquals([str, str], JSON.parse(JSON.stringify([str, str])));
+  }
+}
+
+Check('a', '', 'b');
+Check('ab', '"', 'cd');
+Check('abc', '\\', 'def');
+Check('a', '\n', 'b');
+Check('a', '\u0001', 'b');
+Check('a', 'ሴ', 'b');
+Check('ÿ', '"', 'é');
+Check('Ā', '"', 'ā');
+Check('中', '\\', '"');
+
+// Control characters are not allowed unescaped.
+for (let i = 0; i < 20; i++) {
+  assertThrows(() => JSON.parse('"' + 'a'.repeat(i) + '\u0001' + '"'),
+               SyntaxError);
+  assertThrows(() => JSON.parse('"' + 'Ā'.repeat(i) + '\u001f' + '"'),
+               SyntaxError);
+}
+
+// The result of scanning a two-byte source that only contains one-byte
+// characters is still correct.
+const two_byte = JSON.parse('["Ā", "' + 'x'.repeat(33) + '"]');
+assertEquals('x'.repeat(33), two_byte[1]);
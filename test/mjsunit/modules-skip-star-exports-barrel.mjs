@@ -0,0 +1,8 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+export * from "modules-skip-1.mjs";
+export * from "modules-skip-2.mjs";
+export * from "modules-skip-empty-import-aux.mjs";
+export const local = 3;
@@ -0,0 +1,18 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import {a, b, c, counter, local, zzz} from
+    "modules-skip-star-exports-barrel.mjs";
+import * as ns from "modules-skip-star-exports-barrel.mjs";
+
+assertEquals(1, a);
+assertEquals(1, b);
+assertEquals(1, c);
+assertEquals(0, counter);
+assertEquals(3, local);
+assertEquals(999, zzz);
+assertEquals(
+    ["a", "b", "c", "counter", "get_a", "incr", "local", "set_a", "zzz"],
+    Object.keys(ns));
+assertFalse("default" in ns);
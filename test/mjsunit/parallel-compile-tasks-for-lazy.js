@@ -0,0 +1,48 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-lazy --use-external-strings
+
+var outer_var = 42;
+
+function lazy_outer() {
+  return outer_var;
+}
+
+function lazy_with_inner(a) {
+  function inner(b) { return a + b; }
+  return inner(1);
+}
+
+var lazy_expression = function(a, ...rest) {
+  return a + rest.length;
+};
+
+function* lazy_generator() {
+  yield 1;
+  yield 2;
+}
+
+async function lazy_async() {
+  return 42;
+}
+
+class LazyClass {
+  constructor(x) { this.x = x; }
+  get value() { return this.x; }
+}
+
+function never_called() {
+  throw new Error("should not be called");
+}
+
+assertEquals(42, lazy_outer());
+assertEquals(43, lazy_with_inner(42));
+assertEquals(3, lazy_expression(1, 2, 3));
+var gen = lazy_generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+assertEquals(7, new LazyClass(7).value);
+lazy_async().then(v => assertEquals(42, v));
+assertEquals("function", typeof never_called);
@@ -0,0 +1,19 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --perf-prof --perf-prof-delete-file --allow-natives-syntax
+// Flags: --expose-gc --stress-compaction
+
+// Code moved by compaction is reported to the jitdump file.
+function foo(a) { return a + 1; }
+%PrepareFunctionForOptimization(foo);
+foo(1);
+foo(2);
+%OptimizeFunctionOnNextCall(foo);
+assertEquals(4, foo(3));
+assertTrue(/a+b/.test("aaab"));
+gc();
+gc();
+assertEquals(5, foo(4));
+assertTrue(/a+b/.test("aab"));
@@ -0,0 +1,59 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+// Regexps without capture groups run on the DFA.
+Test(new RegExp(""), "asdf", [""], 0);
+Test(/asdf1/, "123asdf1xyz", ["asdf1"], 0);
+Test(/asdf1/, "123asdf2xyz", null, 0);
+Test(/쁰d섊/, "123쁰d섊abc", ["쁰d섊"], 0);
+Test(/[a-c]+x|[b-d]+/, "zzbcbcd", ["bcbcd"], 0);
+
+// Priorities of disjunctions and quantifiers are preserved.
+Test(/abc|..|[a-c]{10,}/, "abcccccccccccccc", ["abc"], 0);
+Test(/a*?/, "aaa", [""], 0);
+Test(/a+?/, "aaa", ["a"], 0);
+Test(/a+?b/, "xaaab", ["aaab"], 0);
+Test(/(?:ab)*c/, "ababab c ababc", ["c"], 0);
+Test(/x(?:a|ab)(?:c|bcd)/, "xabcd", ["xabcd"], 0);
+
+// The leftmost match wins even if a later one would be longer.
+Test(/b+|a/, "xxabbbb", ["a"], 0);
+
+// Global and sticky regexps.
+Test(/[0-9]+/g, "a12b345", ["12"], 3);
+var r = /a|b/y;
+Test(r, "abc", ["a"], 1);
+Test(r, "abc", ["b"], 2);
+Test(r, "abc", null, 0);
+assertEquals(["aa", "aa", "a"], "aaaaa".match(/a{1,2}/g));
+assertEquals(["", "", "", ""], "abc".match(/x*/g));
+assertEquals("x-x-x", "aab-ab-b".replace(/a*b/g, "x"));
+
+// Subjects that skip input before the first possible match start.
+Test(/xyz/, "a".repeat(1000) + "xyz", ["xyz"], 0);
+Test(/[xy]z/, "a".repeat(1000) + "yz", ["yz"], 0);
+
+// Unicode regexps.
+Test(/💩+/u, "a💩💩b", ["💩💩"], 0);
+Test(/./u, "💩", ["💩"], 0);
+Test(/./gu, "💩a", ["💩"], 2);
+
+// Capture groups and assertions fall back to the NFA.
+Test(/(a+)b/, "xaab", ["aab", "aa"], 0);
+Test(/^a+$/, "aaa", ["aaa"], 0);
+Test(/a\b/, "ab a", ["a"], 0);
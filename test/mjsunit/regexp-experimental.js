@@ -96,3 +96,51 @@ Test(/x$/m, "x\na", ["x"], 0);
 
 // The dotall flag.
 Test(/asdf.xyz/s,  "asdf\nxyz", ["asdf\nxyz"], 0);
+
+// The unicode flag.
+Test(/💩/u, "a💩b", ["💩"], 0);
+Test(/./u, "💩f", ["💩"], 0);
+Test(/[💩]/u, "f💩", ["💩"], 0);
+Test(/[^a]/u, "a💩", ["💩"], 0);
+Test(/\W/u, "a💩", ["💩"], 0);
+Test(/[\u{1F4A9}-\u{1F4AB}]+/u, "a💩💪💫b", ["💩💪💫"], 0);
+Test(/[\u{10000}-\u{10FFFF}]/u, "a\u{FFFF}💩", ["💩"], 0);
+Test(/\uD83D/u, "💩\uD83Dx", ["\uD83D"], 0);
+Test(/\uDCA9/u, "💩", null, 0);
+Test(/\uDCA9/, "💩", ["\uDCA9"], 0);
+assertEquals(["", ""], "💩".match(/(?:)/gu));
+assertEquals(["", "", ""], "💩".match(/(?:)/g));
+// A match can't start in the middle of a surrogate pair.
+var r = /./gu;
+r.lastIndex = 1;
+Test(r, "💩💩", ["💩"], 2);
+r = /^./gu;
+r.lastIndex = 1;
+Test(r, "💩💩", ["💩"], 2);
+r = /./gu;
+r.lastIndex = 3;
+Test(r, "💩\uD801\uD802", ["\uD802"], 4);
+
+// Skipping input that can't begin a match.
+Test(/x[ab]/, "xcxxxb", ["xb"], 0);
+Test(/[xy]z|y/, "aaaaxayz", ["yz"], 0);
+Test(/\uDCA9/u, "aaa💩", null, 0);
+Test(/[\uDCA9\uD83D]/u, "aa💩\uDCA9", ["\uDCA9"], 0);
+assertEquals(["xb", "xa"], "aaxbaaaaxa".match(/x[ab]/g));
+
+// Lookarounds with bodies of fixed length.
+Test(/(?<=x)b./, "ab1xb2", ["b2"], 0);
+Test(/(?<!a)b./, "ab1xb2", ["b2"], 0);
+Test(/(?<!a)b/, "b", ["b"], 0);
+Test(/(?<=\d{2})x./, "1xa23xb", ["xb"], 0);
+Test(/(?<=[^a-c]z)x/, "azxbzx!zx", ["x"], 0);
+Test(/a(?=b)\w/, "acab", ["ab"], 0);
+Test(/a(?!b)\w/, "abac", ["ac"], 0);
+Test(/a(?!bc)/, "abc", null, 0);
+Test(/a(?!bc)./, "ab", ["ab"], 0);
+Test(/(?<=a)💩/u, "💩a💩", ["💩"], 0);
+Test(/(?<!a)b/u, "💩b", ["b"], 0);
+// Lookarounds of variable length or with captures aren't supported.
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(?<=a+)b/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(?=a|bc)b/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(?<=(a))b/));
@@ -32,6 +32,6 @@ assertArrayEquals([match], regexp.exec(subject));
 
 // If the experimental engine can't handle a regexp with an explicit backtrack
 // limit, we should abort and return null on excessive backtracking.
-regexp = %NewRegExpWithBacktrackLimit(regexp.source + "(?=a)", "", 100)
+regexp = %NewRegExpWithBacktrackLimit(regexp.source + "(?=a+)", "", 100)
 assertEquals(null, regexp.exec(subject));
 assertEquals(null, regexp.exec(subject));
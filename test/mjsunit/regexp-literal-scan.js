@@ -0,0 +1,40 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up
+
+// Regexps that start with a literal may scan ahead for one of its characters
+// instead of trying every position. Put the match at every offset around the
+// vector width and around the end of the subject.
+
+function TestAllOffsets(filler, literal) {
+  const re = new RegExp(literal + "(\\d+)");
+  for (let before = 0; before < 40; before++) {
+    for (let after = 0; after < 20; after++) {
+      const subject = filler.repeat(before) + literal + "42" +
+                      filler.repeat(after);
+      const m = re.exec(subject);
+      assertNotNull(m, subject);
+      assertEquals(before * filler.length, m.index);
+      assertEquals("42", m[1]);
+      assertNull(re.exec(filler.repeat(before + after) + literal));
+    }
+  }
+}
+
+TestAllOffsets("x", "ERROR: ");
+TestAllOffsets("-=", "ERROR: ");
+// Two-byte subjects.
+TestAllOffsets("ሴ", "ERROR: ");
+TestAllOffsets("x", "ሴRROR: ");
+
+// Characters that only differ in the high bit from a literal character must
+// not be mistaken for it.
+TestAllOffsets("\xc5RROR ", "ERROR: ");
+TestAllOffsets("ŅRROR ", "ERROR: ");
+TestAllOffsets("ͅ", "EŅ");
+
+// Global regexps scan again after each match.
+assertEquals(["ab1", "ab2", "ab3"],
+             ("ab1" + "x".repeat(33) + "ab2" + "ab3").match(/ab\d/g));
@@ -0,0 +1,36 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --regexp-results-cache-size=64
+
+// Only internalized subjects are cached, property names are internalized.
+var holder = {};
+for (var i = 0; i < 300; i++) holder["w" + i + " x y,z"] = i;
+var subjects = Object.keys(holder);
+
+function Check(subject, i) {
+  var words = subject.split(" ");
+  assertEquals(["w" + i, "x", "y,z"], words);
+  // Results are shared with the cache, so they must be copy-on-write.
+  words[0] = "changed";
+  words.push("more");
+  assertEquals("w" + i, subject.split(" ")[0]);
+  assertEquals(3, subject.split(" ").length);
+
+  var count = 0;
+  var replaced = subject.replace(/\w+/g, function() { return ++count; });
+  assertEquals("1 2 3,4", replaced);
+}
+
+// More subjects than cache entries, so entries are evicted and looked up
+// again in different orders.
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < subjects.length; i++) Check(subjects[i], i);
+  for (var i = subjects.length - 1; i >= 0; i--) Check(subjects[i], i);
+  for (var i = 0; i < subjects.length; i += 7) {
+    Check(subjects[i], i);
+    Check(subjects[0], 0);
+  }
+  gc();
+}
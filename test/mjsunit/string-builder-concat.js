@@ -0,0 +1,90 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long concatenation chains append to a string builder in place. Previously
+// returned prefixes must not observe later appends.
+
+function Build(parts) {
+  let s = "";
+  const prefixes = [];
+  for (let i = 0; i < parts.length; i++) {
+    s += parts[i];
+    if (i % 97 === 0) prefixes.push(s);
+  }
+  return [s, prefixes];
+}
+
+function Check(parts) {
+  const [s, prefixes] = Build(parts);
+  const expected = parts.join("");
+  assertEquals(expected.length, s.length);
+  assertEquals(expected, s);
+  for (const p of prefixes) {
+    assertEquals(expected.substring(0, p.length), p);
+  }
+}
+
+function Parts(n, two_byte_every) {
+  const parts = [];
+  for (let i = 0; i < n; i++) {
+    parts.push(i % two_byte_every === 0 ? "\u2603" + i : "abc" + i);
+  }
+  return parts;
+}
+
+%PrepareFunctionForOptimization(Build);
+Check(Parts(3000, 1e9));
+Check(Parts(3000, 500));
+Check(Parts(3000, 1));
+%OptimizeFunctionOnNextCall(Build);
+Check(Parts(3000, 1e9));
+Check(Parts(3000, 500));
+Check(Parts(3000, 1));
+
+// Reading characters while appending.
+(function() {
+  let s = "x".repeat(5000);
+  for (let i = 0; i < 1000; i++) {
+    s += String.fromCharCode(65 + i % 26);
+    assertEquals(65 + i % 26, s.charCodeAt(s.length - 1));
+    assertEquals(120, s.charCodeAt(0));
+  }
+  assertEquals(6000, s.length);
+})();
+
+// Appending to a prefix after the builder moved on.
+(function() {
+  let s = "y".repeat(5000);
+  s += "a";
+  const t = s;
+  s += "b";
+  const u = t + "c";
+  assertEquals("a", t[5000]);
+  assertEquals(5001, t.length);
+  assertEquals("ab", s.substring(5000));
+  assertEquals("ac", u.substring(5000));
+})();
+
+// Appending the builder to itself and to substrings of itself.
+(function() {
+  let s = "z".repeat(4000) + "0";
+  s += "1";
+  s += s;
+  assertEquals(8004, s.length);
+  assertEquals("01", s.substring(4000, 4002));
+  assertEquals("01", s.substring(8002));
+  s += s.substring(0, 3);
+  assertEquals("zzz", s.substring(8004));
+})();
+
+// Two-byte right hand sides switch to a two-byte backing store.
+(function() {
+  let s = "w".repeat(5000);
+  s += "a";
+  s += "\u00e9\u4e2d";
+  s += "b";
+  assertEquals("a\u00e9\u4e2db", s.substring(5000));
+})();
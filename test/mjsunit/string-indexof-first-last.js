@@ -0,0 +1,65 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String searches compare the first and the last character of the pattern
+// against many subject positions at once. Check matches at every position
+// and near misses against a simple reference implementation.
+
+function matchPositions(subject, pattern) {
+  const result = [];
+  for (let i = 0; i + pattern.length <= subject.length; ++i) {
+    if (subject.substring(i, i + pattern.length) === pattern) result.push(i);
+  }
+  return result;
+}
+
+function check(subject, pattern) {
+  const positions = matchPositions(subject, pattern);
+  for (let start = 0; start <= subject.length; start += 3) {
+    const expected = positions.find(p => p >= start);
+    assertEquals(expected === undefined ? -1 : expected,
+                 subject.indexOf(pattern, start), [subject, pattern, start]);
+  }
+  assertEquals(positions.length > 0, subject.includes(pattern));
+}
+
+function makeSubject(length, fill) {
+  let s = '';
+  for (let i = 0; i < length; ++i) s += fill[i % fill.length];
+  return s;
+}
+
+const kPatterns = ['ab', 'abc', 'abcdefgh', 'a-long-pattern-b', 'aሴb',
+                   'aሴሴሴሴሴሴb'];
+
+for (const fill of ['x', 'xa', 'axb', 'xሴ', 'aሴxb']) {
+  for (let length = 0; length < 80; length += 11) {
+    const base = makeSubject(length, fill);
+    for (const pattern of kPatterns) {
+      check(base, pattern);
+      for (let position = 0; position + pattern.length <= length;
+           position += 9) {
+        const subject = base.substring(0, position) + pattern +
+            base.substring(position + pattern.length);
+        check(subject, pattern);
+        // Matching first and last characters with a mismatch in between.
+        if (pattern.length > 2) {
+          const near_miss = pattern[0] + 'y'.repeat(pattern.length - 2) +
+              pattern[pattern.length - 1];
+          check(subject.substring(0, position) + near_miss +
+                subject.substring(position + pattern.length), pattern);
+        }
+      }
+    }
+  }
+}
+
+// Many candidates that fail late make the search upgrade to Boyer-Moore.
+(function TestBadCandidates() {
+  const pattern = 'a' + 'x'.repeat(30) + 'b';
+  const candidate = 'a' + 'x'.repeat(29) + 'yb';
+  const subject = candidate.repeat(200) + pattern + candidate;
+  assertEquals(candidate.length * 200, subject.indexOf(pattern));
+  assertEquals(-1, (candidate.repeat(200)).indexOf(pattern));
+})();
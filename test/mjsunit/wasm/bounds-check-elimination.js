@@ -0,0 +1,61 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-wasm-trap-handler
+// Flags: --wasm-bounds-check-elimination
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, undefined, false);
+// The first access checks the largest end offset, so the second one through
+// the same index does not need its own check.
+builder.addFunction('wide_then_narrow', kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 8,
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 0,
+      kExprI32Add])
+    .exportFunc();
+// The second access extends past the first one and must still be checked.
+builder.addFunction('narrow_then_wide', kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 0,
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 8,
+      kExprI32Add])
+    .exportFunc();
+// A memory.grow between the accesses must not let the first check be reused.
+builder.addFunction('grow_between', kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 0,
+      kExprI32Const, 0,
+      kExprMemoryGrow, kMemoryZero,
+      kExprDrop,
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 4,
+      kExprI32Add])
+    .exportFunc();
+
+const instance = builder.instantiate();
+for (let i = 0; i < builder.functions.length; ++i) {
+  %WasmTierUpFunction(instance, i);
+}
+const exports = instance.exports;
+const kMemSize = 0x10000;
+
+// Last valid index for an access ending at offset 8 + 4.
+assertEquals(0, exports.wide_then_narrow(kMemSize - 12));
+assertTraps(kTrapMemOutOfBounds, () => exports.wide_then_narrow(kMemSize - 11));
+assertTraps(kTrapMemOutOfBounds, () => exports.wide_then_narrow(kMemSize));
+
+assertEquals(0, exports.narrow_then_wide(kMemSize - 12));
+assertTraps(kTrapMemOutOfBounds, () => exports.narrow_then_wide(kMemSize - 11));
+assertTraps(kTrapMemOutOfBounds, () => exports.narrow_then_wide(kMemSize - 4));
+
+assertEquals(0, exports.grow_between(kMemSize - 8));
+assertTraps(kTrapMemOutOfBounds, () => exports.grow_between(kMemSize - 7));
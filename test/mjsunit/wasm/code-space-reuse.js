@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --liftoff --no-wasm-tier-up
+// Flags: --wasm-code-gc --stress-wasm-code-gc --wasm-reuse-freed-code-space
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Tiering up every function makes its Liftoff code dead. After code GC freed
+// it, the TurboFan code of later functions can be allocated in the freed
+// pages, and all functions must still compute the right results.
+const kNumFunctions = 16;
+const kNumAdds = 500;
+
+const builder = new WasmModuleBuilder();
+for (let i = 0; i < kNumFunctions; ++i) {
+  const body = [kExprLocalGet, 0];
+  for (let j = 0; j < kNumAdds; ++j) {
+    body.push(kExprI32Const, i, kExprI32Add);
+  }
+  builder.addFunction('f' + i, kSig_i_i).addBody(body).exportFunc();
+}
+const instance = builder.instantiate();
+
+function checkAll() {
+  for (let i = 0; i < kNumFunctions; ++i) {
+    assertEquals(7 + i * kNumAdds, instance.exports['f' + i](7));
+  }
+}
+
+checkAll();
+for (let i = 0; i < kNumFunctions; ++i) {
+  %WasmTierUpFunction(instance, i);
+  gc();
+  checkAll();
+}
@@ -0,0 +1,48 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file.
+
+// Flags: --experimental-wasm-compilation-hints --wasm-lazy-compilation
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testEagerHintInLazyModule() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addFunction('hot', kSig_i_i)
+         .addBody([kExprLocalGet, 0])
+         .setCompilationHint(kCompilationHintStrategyEager,
+                             kCompilationHintTierOptimized,
+                             kCompilationHintTierOptimized)
+         .exportFunc();
+  builder.addFunction('cold', kSig_i_i)
+         .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+         .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(42, instance.exports.hot(42));
+  assertEquals(43, instance.exports.cold(42));
+})();
+
+(function testLazyBaselineEagerTopTierHintInLazyModule() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addFunction('id', kSig_i_i)
+         .addBody([kExprLocalGet, 0])
+         .setCompilationHint(kCompilationHintStrategyLazyBaselineEagerTopTier,
+                             kCompilationHintTierBaseline,
+                             kCompilationHintTierOptimized)
+         .exportFunc();
+  assertEquals(42, builder.instantiate().exports.id(42));
+})();
+
+(function testDefaultHintInLazyModule() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addFunction('id', kSig_i_i)
+         .addBody([kExprLocalGet, 0])
+         .setCompilationHint(kCompilationHintStrategyDefault,
+                             kCompilationHintTierDefault,
+                             kCompilationHintTierDefault)
+         .exportFunc();
+  assertEquals(42, builder.instantiate().exports.id(42));
+})();
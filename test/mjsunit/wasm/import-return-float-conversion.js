@@ -0,0 +1,42 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Exercise the Smi, HeapNumber and generic conversion paths of the
+// wasm-to-JS wrapper for floating-point return values.
+let next_value;
+const builder = new WasmModuleBuilder();
+const f64_import = builder.addImport('m', 'f64', kSig_d_v);
+const f32_import = builder.addImport('m', 'f32', kSig_f_v);
+builder.addFunction('f64', kSig_d_v)
+    .addBody([kExprCallFunction, f64_import])
+    .exportFunc();
+builder.addFunction('f32', kSig_f_v)
+    .addBody([kExprCallFunction, f32_import])
+    .exportFunc();
+const instance = builder.instantiate(
+    {m: {f64: () => next_value, f32: () => next_value}});
+
+const cases = [
+  [0, 0],
+  [-7, -7],
+  [2147483647, 2147483647],
+  [1.5, 1.5],
+  [-0, -0],
+  [NaN, NaN],
+  [Infinity, Infinity],
+  ['2.25', 2.25],
+  [{valueOf: () => 3.5}, 3.5],
+  [undefined, NaN],
+  [null, 0],
+  [true, 1],
+];
+for (let i = 0; i < 3; ++i) {
+  for (const [value, expected] of cases) {
+    next_value = value;
+    assertEquals(expected, instance.exports.f64());
+    assertEquals(Math.fround(expected), instance.exports.f32());
+  }
+}
@@ -0,0 +1,35 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --wasm-lazy-js-api
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function TestDescriptorBeforeFirstUse() {
+  let desc = Object.getOwnPropertyDescriptor(globalThis, 'WebAssembly');
+  assertFalse(desc.enumerable);
+  assertTrue(desc.configurable);
+  assertTrue(desc.writable);
+  assertEquals('object', typeof desc.value);
+})();
+
+(function TestApiIsUsable() {
+  assertSame(WebAssembly, globalThis.WebAssembly);
+  assertEquals('[object WebAssembly]', String(WebAssembly));
+  let builder = new WasmModuleBuilder();
+  builder.addFunction('f', kSig_i_v).addBody([kExprI32Const, 42]).exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(42, instance.exports.f());
+  assertInstanceof(new WebAssembly.Module(builder.toBuffer()),
+                   WebAssembly.Module);
+})();
+
+(function TestOtherRealm() {
+  let realm = Realm.create();
+  Realm.eval(realm, 'WebAssembly = 1');
+  assertEquals(1, Realm.eval(realm, 'WebAssembly'));
+  let other = Realm.create();
+  assertEquals('object', Realm.eval(other, 'typeof WebAssembly'));
+  assertFalse(Realm.eval(other, 'WebAssembly') === WebAssembly);
+})();
@@ -0,0 +1,52 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --liftoff --no-wasm-tier-up --liftoff-loop-registers
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+const builder = new WasmModuleBuilder();
+const callee = builder.addFunction('callee', kSig_i_i)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add]);
+
+// Sums 0..n-1 in an i32, an i64 and an f64 local, and counts calls to
+// {callee} in a fourth local, with a nested loop touching some of them.
+builder.addFunction('loops', kSig_d_i)
+    .addLocals(kWasmI32, 2)   // i, sum
+    .addLocals(kWasmI64, 1)   // sum64
+    .addLocals(kWasmF64, 1)   // sumf
+    .addLocals(kWasmI32, 2)   // calls, j
+    .addBody([
+      kExprLoop, kWasmStmt,
+        // sum += i; sum64 += i; sumf += i;
+        kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 2,
+        kExprLocalGet, 3, kExprLocalGet, 1, kExprI64UConvertI32, kExprI64Add,
+        kExprLocalSet, 3,
+        kExprLocalGet, 4, kExprLocalGet, 1, kExprF64UConvertI32, kExprF64Add,
+        kExprLocalSet, 4,
+        // for (j = 0; j < 3; ++j) calls = callee(calls);
+        kExprI32Const, 0, kExprLocalSet, 6,
+        kExprLoop, kWasmStmt,
+          kExprLocalGet, 5, kExprCallFunction, callee.index, kExprLocalSet, 5,
+          kExprLocalGet, 6, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 6,
+          kExprI32Const, 3, kExprI32LtU,
+          kExprBrIf, 0,
+        kExprEnd,
+        // if (++i < n) continue;
+        kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+        kExprLocalGet, 0, kExprI32LtU,
+        kExprBrIf, 0,
+      kExprEnd,
+      // return sum + sum64 + sumf + calls;
+      kExprLocalGet, 2, kExprF64UConvertI32,
+      kExprLocalGet, 3, kExprF64UConvertI64, kExprF64Add,
+      kExprLocalGet, 4, kExprF64Add,
+      kExprLocalGet, 5, kExprF64UConvertI32, kExprF64Add])
+    .exportFunc();
+
+const instance = builder.instantiate();
+for (const n of [1, 2, 10, 1000]) {
+  const sum = n * (n - 1) / 2;
+  assertEquals(3 * sum + 3 * n, instance.exports.loops(n));
+}
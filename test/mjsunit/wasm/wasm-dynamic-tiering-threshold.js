@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
+// Flags: --wasm-tiering-call-threshold=16 --no-stress-opt
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// The threshold is rounded up to a power of two.
+const threshold = 16;
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('cold', kSig_i_v).addBody(wasmI32Const(0)).exportFunc();
+builder.addFunction('hot', kSig_i_v).addBody(wasmI32Const(1)).exportFunc();
+const instance = builder.instantiate();
+
+// --wasm-dynamic-tiering disables eager tier-up of all functions.
+for (let i = 0; i < threshold - 1; ++i) {
+  assertEquals(0, instance.exports.cold());
+  assertEquals(1, instance.exports.hot());
+}
+assertTrue(%IsLiftoffFunction(instance.exports.cold));
+assertTrue(%IsLiftoffFunction(instance.exports.hot));
+
+// Exhausting the budget queues the function for TurboFan.
+instance.exports.hot();
+while (%IsLiftoffFunction(instance.exports.hot)) {
+  // Busy waiting until the function is tiered up.
+}
+assertEquals(1, instance.exports.hot());
+assertTrue(%IsLiftoffFunction(instance.exports.cold));
@@ -3,7 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
-// Flags: --no-wasm-tier-up --no-stress-opt
+// Flags: --no-wasm-tier-up --wasm-tiering-call-threshold=4 --no-stress-opt
 
 load('test/mjsunit/wasm/wasm-module-builder.js');
 
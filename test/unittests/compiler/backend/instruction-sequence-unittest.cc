@@ -21,7 +21,8 @@ static std::array<int, kMaxNumAllocatable> kAllocatableCodes =
 }
 
 InstructionSequenceTest::InstructionSequenceTest()
-    : sequence_(nullptr),
+    : TestWithIsolateAndZone(kCompressInstructionZone),
+      sequence_(nullptr),
       num_general_registers_(Register::kNumRegisters),
       num_double_registers_(DoubleRegister::kNumRegisters),
       instruction_blocks_(zone()),
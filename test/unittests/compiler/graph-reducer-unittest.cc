@@ -9,11 +9,13 @@
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
 #include "src/compiler/operator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 
 using testing::_;
 using testing::DefaultValue;
 using testing::ElementsAre;
+using testing::NiceMock;
 using testing::Return;
 using testing::Sequence;
 using testing::StrictMock;
@@ -489,6 +491,30 @@ TEST_F(GraphReducerTest, NodeIsDeadAfterReplace) {
 }
 
 
+TEST_F(GraphReducerTest, RecycleKilledNodes) {
+  FLAG_SCOPE(turbo_recycle_dead_nodes);
+  NiceMock<MockReducer> r;
+  Node* node0 = graph()->NewNode(&kOpA0);
+  Node* node1 = graph()->NewNode(&kOpA1, node0);
+  Node* node2 = graph()->NewNode(&kOpA1, node0);
+  Node* end = graph()->NewNode(&kOpA2, node1, node2);
+  graph()->SetEnd(end);
+  EXPECT_CALL(r, Reduce(node1)).WillOnce(Return(Reducer::Replace(node2)));
+  ReduceGraph(&r);
+  EXPECT_TRUE(node1->IsDead());
+  EXPECT_EQ(1u, graph()->RecycledNodeCount());
+  EXPECT_THAT(end->inputs(), ElementsAre(node2, node2));
+
+  // The storage of {node1} is reused for the next node of the same shape.
+  Node* node3 = graph()->NewNode(&kOpA1, node2);
+  EXPECT_EQ(node1, node3);
+  EXPECT_FALSE(node3->IsDead());
+  EXPECT_EQ(graph()->NodeCount() - 1, node3->id());
+  EXPECT_THAT(node3->inputs(), ElementsAre(node2));
+  EXPECT_THAT(node2->uses(), UnorderedElementsAre(end, end, node3));
+}
+
+
 TEST_F(GraphReducerTest, ReduceOnceForEveryReducer) {
   StrictMock<MockReducer> r1, r2;
   Node* node0 = graph()->NewNode(&kOpA0);
@@ -389,6 +389,51 @@ TEST_F(LoadEliminationTest, LoadFieldOnTrueBranchOfDiamond) {
   EXPECT_EQ(load, r.replacement());
 }
 
+TEST_F(LoadEliminationTest, StoreFieldOnBothBranchesOfDiamond) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* check = Parameter(Type::Boolean(), 1);
+  Node* value1 = Parameter(Type::Any(), 2);
+  Node* value2 = Parameter(Type::Any(), 3);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+  FieldAccess const access = {kTaggedBase,         kTaggedSize,
+                              MaybeHandle<Name>(), MaybeHandle<Map>(),
+                              Type::Any(),         MachineType::AnyTagged(),
+                              kNoWriteBarrier};
+
+  StrictMock<MockAdvancedReducerEditor> editor;
+  LoadElimination load_elimination(&editor, jsgraph(), zone());
+
+  load_elimination.Reduce(graph()->start());
+
+  Node* branch = graph()->NewNode(common()->Branch(), check, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = graph()->NewNode(simplified()->StoreField(access), object,
+                                 value1, effect, if_true);
+  load_elimination.Reduce(etrue);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = graph()->NewNode(simplified()->StoreField(access), object,
+                                  value2, effect, if_false);
+  load_elimination.Reduce(efalse);
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* phi =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                       value1, value2, control);
+  NodeProperties::SetType(phi, Type::Any());
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+  load_elimination.Reduce(effect);
+
+  Node* load = graph()->NewNode(simplified()->LoadField(access), object, effect,
+                                control);
+  EXPECT_CALL(editor, ReplaceWithValue(load, phi, effect, _));
+  Reduction r = load_elimination.Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(phi, r.replacement());
+}
+
 TEST_F(LoadEliminationTest, LoadFieldWithTypeMismatch) {
   Node* object = Parameter(Type::Any(), 0);
   Node* value = Parameter(Type::Signed32(), 1);
@@ -509,6 +509,75 @@ TEST_F(LoopPeelingTest, TwoExitLoop) {
   EXPECT_THAT(r, IsReturn(p0, start(), merge));
 }
 
+TEST_F(LoopPeelingTest, SimpleLoopWithCounterPeelTwo) {
+  Node* p0 = Parameter(0);
+  While w = NewWhile(p0);
+  Counter c = NewCounter(&w, 0, 1);
+  Node* r = InsertReturn(c.exit_marker, start(), w.exit);
+
+  LoopTree* loop_tree = GetLoopTree();
+  LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+  LoopPeeler peeler(graph(), common(), loop_tree, zone(), source_positions(),
+                    node_origins());
+  EXPECT_TRUE(peeler.CanPeel(loop));
+  PeeledIteration* peeled = peeler.Peel(loop, 2);
+
+  Node* br1 = ExpectPeeled(w.branch, peeled);
+  Node* if_true1 = ExpectPeeled(w.if_true, peeled);
+  Node* if_false1 = ExpectPeeled(w.if_false, peeled);
+  Node* add1 = ExpectPeeled(c.add, peeled);
+
+  EXPECT_THAT(br1, IsBranch(p0, start()));
+  EXPECT_THAT(add1, IsInt32Add(c.base, c.inc));
+
+  Capture<Node*> br2;
+  EXPECT_THAT(w.loop, IsLoop(IsIfTrue(AllOf(CaptureEq(&br2),
+                                            IsBranch(p0, if_true1))),
+                             w.if_true));
+  EXPECT_THAT(c.phi, IsPhi(MachineRepresentation::kTagged,
+                           IsInt32Add(add1, c.inc), c.add, w.loop));
+  EXPECT_THAT(w.exit,
+              IsMerge(w.if_false, if_false1, IsIfFalse(br2.value())));
+  EXPECT_THAT(r, IsReturn(IsPhi(MachineRepresentation::kTagged, c.phi,
+                                c.base, add1, w.exit),
+                          start(), w.exit));
+}
+
+TEST_F(LoopPeelingTest, SmallTripCount) {
+  Node* p0 = Parameter(0);
+  While w = NewWhile(p0);
+  Counter c = NewCounter(&w, 0, 1);
+  InsertReturn(c.exit_marker, start(), w.exit);
+
+  {
+    // Unbounded loop.
+    LoopTree* loop_tree = GetLoopTree();
+    LoopPeeler peeler(graph(), common(), loop_tree, zone(), source_positions(),
+                      node_origins());
+    EXPECT_EQ(0, peeler.SmallTripCount(loop_tree->outer_loops()[0]));
+  }
+
+  // for (i = 0; i < 3; i++): the header runs 4 times.
+  w.branch->ReplaceInput(
+      0, graph()->NewNode(machine()->Int32LessThan(), c.phi, Int32Constant(3)));
+  {
+    LoopTree* loop_tree = GetLoopTree();
+    LoopPeeler peeler(graph(), common(), loop_tree, zone(), source_positions(),
+                      node_origins());
+    EXPECT_EQ(4, peeler.SmallTripCount(loop_tree->outer_loops()[0]));
+  }
+
+  // for (i = 0; i < 1000; i++) is too long to unroll.
+  w.branch->ReplaceInput(0, graph()->NewNode(machine()->Int32LessThan(), c.phi,
+                                             Int32Constant(1000)));
+  {
+    LoopTree* loop_tree = GetLoopTree();
+    LoopPeeler peeler(graph(), common(), loop_tree, zone(), source_positions(),
+                      node_origins());
+    EXPECT_EQ(0, peeler.SmallTripCount(loop_tree->outer_loops()[0]));
+  }
+}
+
 TEST_F(LoopPeelingTest, SimpleLoopWithUnmarkedExit) {
   Node* p0 = Parameter(0);
   Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
@@ -64,6 +64,32 @@ TEST_F(NodeTest, NewWithInputs) {
 }
 
 
+TEST_F(NodeTest, NewInPlace) {
+  Node* n0 = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
+  Node* n1 = Node::New(zone(), 1, &kOp1, 1, &n0, false);
+  EXPECT_EQ(0, n1->RecyclableCapacity());
+  n1->Kill();
+  EXPECT_EQ(Node::InlineCapacityFor(1, false), n1->RecyclableCapacity());
+  Node* n2 = Node::NewInPlace(zone(), n1, 2, &kOp1, 1, &n0, false);
+  EXPECT_EQ(n1, n2);
+  EXPECT_EQ(2U, n2->id());
+  EXPECT_EQ(0, n2->RecyclableCapacity());
+  EXPECT_THAT(n2->inputs(), ElementsAre(n0));
+  EXPECT_THAT(n0->uses(), ElementsAre(n2));
+}
+
+
+TEST_F(NodeTest, NewInPlaceRequiresInlineInputs) {
+  Node* n0 = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
+  Node* n1 = Node::New(zone(), 1, &kOp1, 1, &n0, false);
+  Node* n2 = Node::New(zone(), 2, &kOp2, 1, &n0, true);
+  for (int i = 0; i < 20; ++i) n2->AppendInput(zone(), n1);
+  n2->Kill();
+  EXPECT_EQ(0, n2->RecyclableCapacity());
+  EXPECT_EQ(0, Node::InlineCapacityFor(20, false));
+}
+
+
 TEST_F(NodeTest, InputIteratorEmpty) {
   Node* node = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
   EXPECT_EQ(node->inputs().begin(), node->inputs().end());
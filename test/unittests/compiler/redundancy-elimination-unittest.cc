@@ -110,6 +110,41 @@ TEST_F(RedundancyEliminationTest, CheckBounds) {
   }
 }
 
+// -----------------------------------------------------------------------------
+// CheckIf
+
+TEST_F(RedundancyEliminationTest, CheckIfOnBothBranchesOfDiamond) {
+  Node* condition = Parameter(0);
+  Node* branch_condition = Parameter(1);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+  const Operator* check_if =
+      simplified()->CheckIf(DeoptimizeReason::kOutOfBounds);
+
+  Node* branch =
+      graph()->NewNode(common()->Branch(), branch_condition, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = graph()->NewNode(check_if, condition, effect, if_true);
+  Reduction r1 = Reduce(etrue);
+  ASSERT_TRUE(r1.Changed());
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = graph()->NewNode(check_if, condition, effect, if_false);
+  Reduction r2 = Reduce(efalse);
+  ASSERT_TRUE(r2.Changed());
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+  Reduction r3 = Reduce(effect);
+  ASSERT_TRUE(r3.Changed());
+
+  Node* check = graph()->NewNode(check_if, condition, effect, control);
+  Reduction r4 = Reduce(check);
+  ASSERT_TRUE(r4.Changed());
+  EXPECT_NE(r4.replacement(), check);
+}
+
 // -----------------------------------------------------------------------------
 // CheckNumber
 
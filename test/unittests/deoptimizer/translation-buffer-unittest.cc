@@ -0,0 +1,49 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deoptimizer.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using TranslationBufferTest = TestWithZone;
+
+TEST_F(TranslationBufferTest, DeduplicateIdenticalRanges) {
+  TranslationBuffer buffer(zone());
+
+  buffer.Add(1);
+  buffer.Add(2);
+  EXPECT_EQ(0, buffer.Deduplicate(0));
+  const int first_end = buffer.CurrentIndex();
+
+  buffer.Add(1);
+  buffer.Add(3);
+  EXPECT_EQ(first_end, buffer.Deduplicate(first_end));
+  const int second_end = buffer.CurrentIndex();
+
+  buffer.Add(1);
+  buffer.Add(2);
+  EXPECT_EQ(0, buffer.Deduplicate(second_end));
+  EXPECT_EQ(second_end, buffer.CurrentIndex());
+  EXPECT_EQ(first_end, buffer.deduplicated_size());
+}
+
+TEST_F(TranslationBufferTest, DeduplicateKeepsPrefixes) {
+  TranslationBuffer buffer(zone());
+
+  buffer.Add(1);
+  buffer.Add(2);
+  EXPECT_EQ(0, buffer.Deduplicate(0));
+  const int first_end = buffer.CurrentIndex();
+
+  buffer.Add(1);
+  EXPECT_EQ(first_end, buffer.Deduplicate(first_end));
+  EXPECT_LT(first_end, buffer.CurrentIndex());
+  EXPECT_EQ(0, buffer.deduplicated_size());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/objects/foreign.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-objects-inl.h"
@@ -190,6 +191,62 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// Check that a bounded run stops at the given count, including microtasks
+// that are enqueued while running.
+TEST_P(MicrotaskQueueTest, RunMicrotasksWithLimit) {
+  int count = 0;
+  for (int i = 0; i < 3; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([this, &count] {
+      ++count;
+      microtask_queue()->EnqueueMicrotask(
+          *NewMicrotask([&count] { ++count; }));
+    }));
+  }
+  EXPECT_EQ(3, microtask_queue()->size());
+
+  EXPECT_EQ(2, microtask_queue()->RunMicrotasks(isolate(), 2));
+  EXPECT_EQ(2, count);
+  EXPECT_EQ(3, microtask_queue()->size());
+
+  EXPECT_EQ(4, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(6, count);
+  EXPECT_EQ(0, microtask_queue()->size());
+}
+
+TEST_P(MicrotaskQueueTest, PerformBoundedCheckpoint) {
+  int count = 0;
+  int completed_callback_count = 0;
+  auto completed_callback = [](v8::Isolate*, void* data) {
+    ++*static_cast<int*>(data);
+  };
+  microtask_queue()->AddMicrotasksCompletedCallback(completed_callback,
+                                                    &completed_callback_count);
+  for (int i = 0; i < 100; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([&count] { ++count; }));
+  }
+  double far_future =
+      V8::GetCurrentPlatform()->MonotonicallyIncreasingTime() + 1000;
+
+  EXPECT_FALSE(microtask_queue()->PerformBoundedCheckpoint(v8_isolate(), 40,
+                                                           far_future));
+  EXPECT_EQ(40, count);
+  EXPECT_EQ(0, completed_callback_count);
+
+  // An expired deadline still runs one batch.
+  EXPECT_FALSE(
+      microtask_queue()->PerformBoundedCheckpoint(v8_isolate(), 100, 0));
+  EXPECT_LT(40, count);
+  EXPECT_GT(100, count);
+  EXPECT_EQ(0, completed_callback_count);
+
+  EXPECT_TRUE(microtask_queue()->PerformBoundedCheckpoint(v8_isolate(), 100,
+                                                          far_future));
+  EXPECT_EQ(100, count);
+  EXPECT_EQ(1, completed_callback_count);
+  microtask_queue()->RemoveMicrotasksCompletedCallback(
+      completed_callback, &completed_callback_count);
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
@@ -3,10 +3,12 @@
 // found in the LICENSE file.
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <vector>
 
 #include "include/cppgc/allocation.h"
+#include "include/cppgc/macros.h"
 #include "include/cppgc/platform.h"
 #include "include/v8-platform.h"
 #include "src/heap/cppgc/globals.h"
@@ -28,6 +30,7 @@ namespace internal {
 namespace {
 
 size_t g_destructor_callcount;
+std::atomic<size_t> g_concurrent_destructor_callcount;
 
 template <size_t Size>
 class Finalizable : public GarbageCollected<Finalizable<Size>> {
@@ -61,11 +64,34 @@ class NonFinalizable : public GarbageCollected<NonFinalizable<Size>> {
 using NormalNonFinalizable = NonFinalizable<32>;
 using LargeNonFinalizable = NonFinalizable<kLargeObjectSizeThreshold * 2>;
 
+template <size_t Size>
+class ConcurrentlyFinalizable
+    : public GarbageCollected<ConcurrentlyFinalizable<Size>> {
+  CPPGC_USING_CONCURRENT_FINALIZER();
+
+ public:
+  ~ConcurrentlyFinalizable() {
+    g_concurrent_destructor_callcount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Trace(cppgc::Visitor*) const {}
+
+ private:
+  char array_[Size];
+};
+
+using NormalConcurrentlyFinalizable = ConcurrentlyFinalizable<32>;
+using LargeConcurrentlyFinalizable =
+    ConcurrentlyFinalizable<kLargeObjectSizeThreshold * 2>;
+
 }  // namespace
 
 class ConcurrentSweeperTest : public testing::TestWithHeap {
  public:
-  ConcurrentSweeperTest() { g_destructor_callcount = 0; }
+  ConcurrentSweeperTest() {
+    g_destructor_callcount = 0;
+    g_concurrent_destructor_callcount = 0;
+  }
 
   void StartSweeping() {
     Heap* heap = Heap::From(GetHeap());
@@ -280,6 +306,57 @@ TEST_F(ConcurrentSweeperTest, DeferredFinalizationOfLargePage) {
   CheckPageRemoved(page);
 }
 
+TEST_F(ConcurrentSweeperTest, ConcurrentFinalizationOfNormalPage) {
+  static constexpr size_t kNumberOfObjects = 10;
+  using GCedType = NormalConcurrentlyFinalizable;
+
+  std::vector<void*> objects;
+
+  BaseSpace* space = nullptr;
+  for (size_t i = 0; i < kNumberOfObjects; ++i) {
+    auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+    objects.push_back(object);
+    if (!space) space = BasePage::FromPayload(object)->space();
+  }
+  // Keep the page alive so that the swept objects end up in the free list.
+  auto* marked_object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+  HeapObjectHeader::FromPayload(marked_object).TryMarkAtomic();
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  // Check that the concurrent sweeper already executed all finalizers.
+  EXPECT_EQ(kNumberOfObjects, g_concurrent_destructor_callcount.load());
+  // Check that the objects have been turned into freelist entries without
+  // involving the mutator thread.
+  CheckFreeListEntries(objects);
+
+  FinishSweeping();
+
+  EXPECT_TRUE(FreeListContains(space, objects));
+  EXPECT_EQ(kNumberOfObjects, g_concurrent_destructor_callcount.load());
+}
+
+TEST_F(ConcurrentSweeperTest, ConcurrentFinalizationOfLargePage) {
+  using GCedType = LargeConcurrentlyFinalizable;
+
+  auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+  auto* page = BasePage::FromPayload(object);
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  // Check that the page was released without main-thread finalization.
+  EXPECT_EQ(1u, g_concurrent_destructor_callcount.load());
+  CheckPageRemoved(page);
+
+  FinishSweeping();
+}
+
 TEST_F(ConcurrentSweeperTest, IncrementalSweeping) {
   testing::TestPlatform::DisableBackgroundTasksScope disable_concurrent_sweeper(
       &GetPlatform());
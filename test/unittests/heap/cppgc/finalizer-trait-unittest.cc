@@ -6,6 +6,7 @@
 
 #include <type_traits>
 
+#include "include/cppgc/macros.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace cppgc {
@@ -83,6 +84,17 @@ void ExpectFinalizerIsInvoked(Type* object) {
   operator delete(object);
 }
 
+class TypeWithConcurrentFinalizer final : public InvokeCounter {
+  CPPGC_USING_CONCURRENT_FINALIZER();
+
+ public:
+  ~TypeWithConcurrentFinalizer() { Invoke(); }
+};
+
+class TypeWithoutDestructorAndConcurrentMarker final {
+  CPPGC_USING_CONCURRENT_FINALIZER();
+};
+
 }  // namespace
 
 TEST(FinalizerTrait, TypeWithoutDestructorHasNoFinalizer) {
@@ -116,5 +128,14 @@ TEST(FinalizerTrait, FinalizerForCustomFinalizationMethodInBase) {
   ExpectFinalizerIsInvoked(base);
 }
 
+TEST(FinalizerTrait, ConcurrentFinalizerRequiresMarker) {
+  EXPECT_FALSE(FinalizerTrait<TypeWithDestructor>::kConcurrentlyFinalizable);
+  EXPECT_TRUE(
+      FinalizerTrait<TypeWithConcurrentFinalizer>::kConcurrentlyFinalizable);
+  EXPECT_FALSE(FinalizerTrait<TypeWithoutDestructorAndConcurrentMarker>::
+                   kConcurrentlyFinalizable);
+  ExpectFinalizerIsInvoked(new TypeWithConcurrentFinalizer());
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -16,7 +16,9 @@ namespace internal {
 
 namespace {
 
-constexpr GCInfo GetEmptyGCInfo() { return {nullptr, nullptr, nullptr, false}; }
+constexpr GCInfo GetEmptyGCInfo() {
+  return {nullptr, nullptr, nullptr, false, false};
+}
 
 }  // namespace
 
@@ -190,6 +190,25 @@ TYPED_TEST(MinorGCTestForType, InterGenerationalPointerForDifferentPageTypes) {
       this, this->GetHeap());
 }
 
+TYPED_TEST(MinorGCTestForType, RememberedSlotClearedAfterBarrier) {
+  using Type = typename TestFixture::Type;
+
+  Persistent<Type> old =
+      MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  TestFixture::CollectMinor();
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(old.Get()).IsYoung());
+
+  const auto& set = Heap::From(this->GetHeap())->remembered_slots();
+  old->next = MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  EXPECT_EQ(1u, set.size());
+  // The recorded slot no longer points to a young object.
+  old->next = nullptr;
+
+  TestFixture::CollectMinor();
+  EXPECT_EQ(1u, TestFixture::DestructedObjects());
+  EXPECT_TRUE(set.empty());
+}
+
 TYPED_TEST(MinorGCTestForType, OmitGenerationalBarrierForOnStackObject) {
   using Type = typename TestFixture::Type;
 
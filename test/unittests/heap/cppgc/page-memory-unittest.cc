@@ -272,6 +272,33 @@ TEST(PageBackendTest, AllocateLarge) {
   backend.FreeLargePageMemory(writeable_base2);
 }
 
+TEST(LargePageMemoryPool, SizeClasses) {
+  EXPECT_EQ(0u, LargePageMemoryPool::SizeClass(kLargeObjectSizeThreshold));
+  EXPECT_EQ(0u, LargePageMemoryPool::SizeClass(kPageSize));
+  EXPECT_EQ(1u, LargePageMemoryPool::SizeClass(kPageSize + 1));
+  constexpr size_t kMaxPooledSize = LargePageMemoryPool::kMaxPooledSize;
+  EXPECT_EQ(LargePageMemoryPool::kNumSizeClasses - 1,
+            LargePageMemoryPool::SizeClass(kMaxPooledSize));
+  EXPECT_EQ(LargePageMemoryPool::kNotPooled,
+            LargePageMemoryPool::SizeClass(kMaxPooledSize + 1));
+}
+
+TEST(PageBackendTest, AllocateLargeUsesPool) {
+  v8::base::PageAllocator allocator;
+  PageBackend backend(&allocator);
+  constexpr size_t kSize = kLargeObjectSizeThreshold + 1;
+  Address writeable_base1 = backend.AllocateLargePageMemory(kSize);
+  EXPECT_NE(nullptr, writeable_base1);
+  backend.FreeLargePageMemory(writeable_base1);
+  // Pooled memory is not found by lookups.
+  EXPECT_EQ(nullptr, backend.Lookup(writeable_base1));
+  // A different size within the same size class reuses the region.
+  Address writeable_base2 = backend.AllocateLargePageMemory(kPageSize);
+  EXPECT_EQ(writeable_base1, writeable_base2);
+  EXPECT_EQ(writeable_base2, backend.Lookup(writeable_base2 + kPageSize - 1));
+  backend.FreeLargePageMemory(writeable_base2);
+}
+
 TEST(PageBackendTest, LookupNormal) {
   v8::base::PageAllocator allocator;
   PageBackend backend(&allocator);
@@ -47,6 +47,16 @@ TEST_F(StatsCollectorTest, EventPrevGCMarkedObjectSize) {
   EXPECT_EQ(1024u, event.marked_bytes);
 }
 
+TEST_F(StatsCollectorTest, EventMainThreadSweepingTime) {
+  stats.NotifyMarkingStarted();
+  stats.NotifyMarkingCompleted(kNoMarkedBytes);
+  stats.AddMainThreadSweepingTime(v8::base::TimeDelta::FromMilliseconds(2));
+  stats.AddMainThreadSweepingTime(v8::base::TimeDelta::FromMilliseconds(3));
+  auto event = stats.NotifySweepingCompleted();
+  EXPECT_EQ(v8::base::TimeDelta::FromMilliseconds(5),
+            event.main_thread_sweeping_time);
+}
+
 TEST_F(StatsCollectorTest, AllocationNoReportBelowAllocationThresholdBytes) {
   constexpr size_t kObjectSize = 17;
   EXPECT_LT(kObjectSize, StatsCollector::kAllocationThresholdBytes);
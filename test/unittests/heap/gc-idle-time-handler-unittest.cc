@@ -73,6 +73,45 @@ TEST(GCIdleTimeHandler, EstimateMarkingStepSizeOverflow2) {
 }
 
 
+TEST(GCIdleTimeHandler, EstimateFinalIncrementalMarkCompactTimeInitial) {
+  size_t size = 100 * MB;
+  double time =
+      GCIdleTimeHandler::EstimateFinalIncrementalMarkCompactTime(size, 0);
+  double speed = static_cast<double>(
+      GCIdleTimeHandler::kInitialConservativeFinalIncrementalMarkCompactSpeed);
+  EXPECT_EQ(size / speed, time);
+}
+
+
+TEST(GCIdleTimeHandler, EstimateFinalIncrementalMarkCompactTimeNonZero) {
+  size_t size = 100 * MB;
+  double speed = 1 * MB;
+  double time =
+      GCIdleTimeHandler::EstimateFinalIncrementalMarkCompactTime(size, speed);
+  EXPECT_EQ(size / speed, time);
+}
+
+
+TEST(GCIdleTimeHandler, EstimateFinalIncrementalMarkCompactTimeMax) {
+  size_t size = std::numeric_limits<size_t>::max();
+  double speed = 1;
+  double time =
+      GCIdleTimeHandler::EstimateFinalIncrementalMarkCompactTime(size, speed);
+  EXPECT_EQ(static_cast<double>(
+                GCIdleTimeHandler::kMaxFinalIncrementalMarkCompactTimeInMs),
+            time);
+}
+
+
+TEST(GCIdleTimeHandler, EstimateScavengeTime) {
+  size_t size = 1 * MB;
+  EXPECT_EQ(size / static_cast<double>(
+                       GCIdleTimeHandler::kInitialConservativeScavengeSpeed),
+            GCIdleTimeHandler::EstimateScavengeTime(size, 0));
+  EXPECT_EQ(4.0, GCIdleTimeHandler::EstimateScavengeTime(size, 256 * KB));
+}
+
+
 TEST_F(GCIdleTimeHandlerTest, ContextDisposeLowRate) {
   if (!handler()->Enabled()) return;
   GCIdleTimeHeapState heap_state = DefaultHeapState();
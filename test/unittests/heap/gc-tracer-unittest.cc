@@ -5,6 +5,7 @@
 #include <cmath>
 #include <limits>
 
+#include "include/v8-metrics.h"
 #include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -313,6 +314,41 @@ TEST_F(GCTracerTest, IncrementalMarkingSpeed) {
                        tracer->IncrementalMarkingSpeedInBytesPerMillisecond()));
 }
 
+TEST_F(GCTracerTest, ConcurrentMarkingSpeed) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  EXPECT_EQ(0, tracer->ConcurrentMarkingSpeedInBytesPerMillisecond());
+
+  // 1000000 bytes in 100ms of background marking.
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::MC_BACKGROUND_MARKING, 100);
+  tracer->AddConcurrentMarkingBytes(1000000);
+  tracer->Stop(MARK_COMPACTOR);
+  EXPECT_EQ(1000000u, tracer->current_.concurrent_marking_bytes);
+  EXPECT_EQ(1000000 / 100,
+            tracer->ConcurrentMarkingSpeedInBytesPerMillisecond());
+
+  // Cycles without concurrent marking do not affect the speed.
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->Stop(MARK_COMPACTOR);
+  EXPECT_EQ(1000000 / 100,
+            tracer->ConcurrentMarkingSpeedInBytesPerMillisecond());
+
+  // 3000000 bytes in 100ms of background marking.
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->current_.type = GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::MC_BACKGROUND_MARKING, 100);
+  tracer->AddConcurrentMarkingBytes(3000000);
+  tracer->Stop(MARK_COMPACTOR);
+  EXPECT_EQ(4000000 / 200,
+            tracer->ConcurrentMarkingSpeedInBytesPerMillisecond());
+}
+
 TEST_F(GCTracerTest, MutatorUtilization) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -559,5 +595,61 @@ TEST_F(GCTracerTest, RecordGCSumHistograms) {
   GcHistogram::CleanUp();
 }
 
+namespace {
+
+class GcMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionFullCycle& event,
+                          ContextId context_id) override {
+    full_cycles_.push_back(event);
+  }
+  void AddMainThreadEvent(
+      const v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalMark&
+          event,
+      ContextId context_id) override {
+    incremental_marks_.insert(incremental_marks_.end(), event.events.begin(),
+                              event.events.end());
+  }
+
+  std::vector<v8::metrics::GarbageCollectionFullCycle> full_cycles_;
+  std::vector<v8::metrics::GarbageCollectionFullMainThreadIncrementalMark>
+      incremental_marks_;
+};
+
+}  // namespace
+
+TEST_F(GCTracerTest, RecordMetrics) {
+  if (FLAG_stress_incremental_marking) return;
+  std::shared_ptr<GcMetricsRecorder> recorder =
+      std::make_shared<GcMetricsRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  tracer->AddIncrementalMarkingStep(3.0, 1024);
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->current_.type = GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 5);
+  tracer->AddScopeSample(GCTracer::Scope::MC_SWEEP, 7);
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::MC_BACKGROUND_MARKING, 2);
+  tracer->Stop(MARK_COMPACTOR);
+
+  ASSERT_EQ(1u, recorder->incremental_marks_.size());
+  EXPECT_EQ(3000, recorder->incremental_marks_[0].wall_clock_duration_in_us);
+  ASSERT_EQ(1u, recorder->full_cycles_.size());
+  const v8::metrics::GarbageCollectionFullCycle& event =
+      recorder->full_cycles_[0];
+  EXPECT_EQ(static_cast<int>(GarbageCollectionReason::kTesting),
+            event.reason);
+  EXPECT_EQ(5000, event.main_thread_atomic.mark_wall_clock_duration_in_us);
+  EXPECT_EQ(8000, event.main_thread.mark_wall_clock_duration_in_us);
+  EXPECT_EQ(10000, event.total.mark_wall_clock_duration_in_us);
+  EXPECT_EQ(7000, event.total.sweep_wall_clock_duration_in_us);
+  EXPECT_EQ(3000, event.main_thread_incremental_wall_clock_duration_in_us);
+  EXPECT_EQ(event.objects.bytes_before - event.objects.bytes_after,
+            event.objects.bytes_freed);
+}
+
 }  // namespace internal
 }  // namespace v8
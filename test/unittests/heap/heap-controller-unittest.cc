@@ -13,6 +13,7 @@
 #include "src/handles/handles.h"
 
 #include "src/heap/heap-controller.h"
+#include "src/heap/spaces.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -108,5 +109,28 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST(NewSpaceControllerTest, CalculateCapacity) {
+  const size_t kMin = 1 * MB;
+  const size_t kMax = 16 * MB;
+  // No allocation throughput recorded yet.
+  EXPECT_EQ(kMin, NewSpaceController::CalculateCapacity(0, 0, 100, kMin, kMax));
+  // A zero target interval favors memory.
+  EXPECT_EQ(kMin,
+            NewSpaceController::CalculateCapacity(100 * KB, 0, 0, kMin, kMax));
+  // 40 KB/ms for 100 ms.
+  EXPECT_EQ(
+      ::RoundUp(4000 * KB, Page::kPageSize),
+      NewSpaceController::CalculateCapacity(40 * KB, 10, 100, kMin, kMax));
+  // High survival ratios grow the new space further.
+  EXPECT_EQ(
+      ::RoundUp(6000 * KB, Page::kPageSize),
+      NewSpaceController::CalculateCapacity(40 * KB, 50, 100, kMin, kMax));
+  // The result is bounded by the maximum capacity.
+  EXPECT_EQ(kMax,
+            NewSpaceController::CalculateCapacity(1 * MB, 0, 100, kMin, kMax));
+  EXPECT_EQ(kMin,
+            NewSpaceController::CalculateCapacity(1 * KB, 0, 100, kMin, kMax));
+}
+
 }  // namespace internal
 }  // namespace v8
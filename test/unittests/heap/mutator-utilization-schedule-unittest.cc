@@ -0,0 +1,45 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/mutator-utilization-schedule.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(MutatorUtilizationSchedule, DisabledAllowsFullStep) {
+  MutatorUtilizationSchedule schedule;
+  schedule.Start(0, 0);
+  EXPECT_FALSE(schedule.IsEnabled());
+  schedule.AddStepTime(10, 10);
+  EXPECT_EQ(5, schedule.AllowedStepTimeInMs(10, 5));
+}
+
+TEST(MutatorUtilizationSchedule, CapsStepsPerWindow) {
+  MutatorUtilizationSchedule schedule;
+  // 25ms of marking per 100ms window.
+  schedule.Start(0.75, 0);
+  EXPECT_TRUE(schedule.IsEnabled());
+  EXPECT_EQ(5, schedule.AllowedStepTimeInMs(0, 5));
+  schedule.AddStepTime(5, 5);
+  EXPECT_EQ(5, schedule.AllowedStepTimeInMs(5, 5));
+  schedule.AddStepTime(30, 25);
+  EXPECT_EQ(0, schedule.AllowedStepTimeInMs(30, 5));
+  EXPECT_EQ(0, schedule.AllowedStepTimeInMs(99, 5));
+}
+
+TEST(MutatorUtilizationSchedule, NewWindowPaysBackOvershoot) {
+  MutatorUtilizationSchedule schedule;
+  schedule.Start(0.75, 0);
+  // A step of 30ms overshoots the 25ms budget by 5ms.
+  schedule.AddStepTime(30, 30);
+  EXPECT_EQ(0, schedule.AllowedStepTimeInMs(50, 5));
+  EXPECT_EQ(20, schedule.AllowedStepTimeInMs(100, 30));
+  // After several windows without marking the full budget is available again.
+  EXPECT_EQ(25, schedule.AllowedStepTimeInMs(500, 30));
+}
+
+}  // namespace internal
+}  // namespace v8
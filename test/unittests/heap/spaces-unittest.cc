@@ -152,6 +152,19 @@ TEST_F(SpacesTest, CodeRangeAddressReuse) {
   EXPECT_EQ(code_range6, code_range3);
 }
 
+TEST_F(SpacesTest, CodeRangeAddressNearEmbeddedBlob) {
+  CodeRangeAddressHint hint;
+  const Address blob_start = 0x7f0000000000;
+  // Without freed code ranges, the code range ends where the blob starts.
+  Address code_range1 = hint.GetAddressHint(100, blob_start);
+  EXPECT_EQ(code_range1, blob_start - 100);
+
+  // Freed code ranges are still preferred.
+  hint.NotifyFreedCodeRange(0x100000, 100);
+  Address code_range2 = hint.GetAddressHint(100, blob_start);
+  EXPECT_EQ(code_range2, 0x100000u);
+}
+
 // Tests that FreeListMany::SelectFreeListCategoryType returns what it should.
 TEST_F(SpacesTest, FreeListManySelectFreeListCategoryType) {
   FreeListMany free_list;
@@ -313,6 +313,29 @@ TEST(WorkListTest, MultipleSegmentsStolen) {
   EXPECT_TRUE(worklist.IsEmpty());
 }
 
+TEST(WorkListTest, ShareWorkIfGlobalPoolIsEmpty) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy;
+  // Nothing to share yet.
+  EXPECT_FALSE(worklist_view1.ShareWorkIfGlobalPoolIsEmpty());
+  EXPECT_TRUE(worklist_view1.Push(&dummy));
+  EXPECT_TRUE(worklist_view1.ShareWorkIfGlobalPoolIsEmpty());
+  EXPECT_EQ(1U, worklist.GlobalPoolSize());
+  EXPECT_TRUE(worklist_view1.IsLocalEmpty());
+  // The global pool is not empty anymore, so further work stays local.
+  EXPECT_TRUE(worklist_view1.Push(&dummy));
+  EXPECT_FALSE(worklist_view1.ShareWorkIfGlobalPoolIsEmpty());
+  EXPECT_EQ(1U, worklist.GlobalPoolSize());
+  SomeObject* retrieved = nullptr;
+  EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+  EXPECT_EQ(&dummy, retrieved);
+  EXPECT_TRUE(worklist_view1.Pop(&retrieved));
+  EXPECT_EQ(&dummy, retrieved);
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 TEST(WorkListTest, MergeGlobalPool) {
   TestWorklist worklist1;
   TestWorklist::View worklist_view1(&worklist1, 0);
@@ -57,6 +57,9 @@ class BytecodeArrayWriterUnittest : public TestWithIsolateAndZone {
   SourcePositionTableBuilder* source_position_table_builder() {
     return writer()->source_position_table_builder();
   }
+  void EnableSuperinstructions() {
+    writer()->emit_superinstructions_ = true;
+  }
 
  private:
   ConstantArrayBuilder constant_array_builder_;
@@ -293,6 +296,53 @@ TEST_F(BytecodeArrayWriterUnittest, ElideNoneffectfulBytecodes) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, Superinstructions) {
+  EnableSuperinstructions();
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0        */ B(LdaSmi), U8(1),
+      /*  2 55 E> */ B(StarLdaNamedProperty), R8(1), R8(1), U8(2), U8(3),
+      /*  7 60 S> */ B(Star), R8(2),
+      /*  9 65 E> */ B(LdaNamedProperty), R8(2), U8(4), U8(5),
+      /* 13        */ B(Return),
+      // clang-format on
+  };
+
+  static const PositionTableEntry expected_positions[] = {
+      {2, 55, false}, {7, 60, true}, {9, 65, false}};
+
+  Write(Bytecode::kLdaSmi, 1);
+  Write(Bytecode::kStar, R(1));
+  Write(Bytecode::kLdaNamedProperty, R(1), 2, 3, {55, false});
+  // Not fused as both bytecodes have source info.
+  Write(Bytecode::kStar, R(2), {60, true});
+  Write(Bytecode::kLdaNamedProperty, R(2), 4, 5, {65, false});
+  Write(Bytecode::kReturn);
+
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+
+  Handle<BytecodeArray> bytecode_array =
+      writer()->ToBytecodeArray(isolate(), 0, 0, factory()->empty_byte_array());
+  bytecode_array->set_source_position_table(
+      *writer()->ToSourcePositionTable(isolate()), kReleaseStore);
+  SourcePositionTableIterator source_iterator(
+      bytecode_array->SourcePositionTable());
+  for (size_t i = 0; i < arraysize(expected_positions); ++i) {
+    const PositionTableEntry& expected = expected_positions[i];
+    CHECK_EQ(source_iterator.code_offset(), expected.code_offset);
+    CHECK_EQ(source_iterator.source_position().ScriptOffset(),
+             expected.source_position);
+    CHECK_EQ(source_iterator.is_statement(), expected.is_statement);
+    source_iterator.Advance();
+  }
+  CHECK(source_iterator.done());
+}
+
 TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   static const uint8_t expected_bytes[] = {
       // clang-format off
@@ -6,6 +6,7 @@
 
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-register-optimizer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/interpreter/bytecode-utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -202,6 +203,58 @@ TEST_F(BytecodeRegisterOptimizerTest, RangeOfTemporariesMaterializedForInput) {
   CHECK_EQ(output()->at(1).output.index(), temp1.index());
 }
 
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceKeptAcrossJump) {
+  FLAG_SCOPE(ignition_reo_across_jumps);
+  Initialize(1, 1);
+  Register temp = NewTemporary();
+  optimizer()->PrepareForBytecode<Bytecode::kLdaSmi, AccumulatorUse::kWrite>();
+  optimizer()->DoStar(temp);
+  CHECK_EQ(write_count(), 0u);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue, AccumulatorUse::kRead>();
+  CHECK_EQ(write_count(), 1u);
+  CHECK_EQ(output()->at(0).bytecode, Bytecode::kStar);
+  CHECK_EQ(output()->at(0).output.index(), temp.index());
+  BytecodeLabel label;
+  optimizer()->RecordJumpState(&label);
+
+  // The accumulator holds the value of |temp| on both paths to the label.
+  optimizer()->MergeJumpState(&label);
+  optimizer()->DoLdar(temp);
+  optimizer()->PrepareForBytecode<Bytecode::kReturn, AccumulatorUse::kRead>();
+  CHECK_EQ(write_count(), 1u);
+  optimizer()->Flush();
+  CHECK_EQ(write_count(), 1u);
+  CHECK(optimizer()->EnsureAllRegistersAreFlushed());
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceDroppedAtMerge) {
+  FLAG_SCOPE(ignition_reo_across_jumps);
+  Initialize(1, 1);
+  Register temp0 = NewTemporary();
+  Register temp1 = NewTemporary();
+  optimizer()->PrepareForBytecode<Bytecode::kLdaSmi, AccumulatorUse::kWrite>();
+  optimizer()->DoStar(temp0);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue, AccumulatorUse::kRead>();
+  CHECK_EQ(write_count(), 1u);
+  BytecodeLabel label;
+  optimizer()->RecordJumpState(&label);
+
+  // The accumulator only holds the value of |temp1| when falling through.
+  optimizer()->PrepareForBytecode<Bytecode::kLdaSmi, AccumulatorUse::kWrite>();
+  optimizer()->DoStar(temp1);
+  optimizer()->MergeJumpState(&label);
+  CHECK_EQ(write_count(), 2u);
+  CHECK_EQ(output()->at(1).bytecode, Bytecode::kStar);
+  CHECK_EQ(output()->at(1).output.index(), temp1.index());
+  optimizer()->DoLdar(temp1);
+  optimizer()->PrepareForBytecode<Bytecode::kReturn, AccumulatorUse::kRead>();
+  CHECK_EQ(write_count(), 3u);
+  CHECK_EQ(output()->at(2).bytecode, Bytecode::kLdar);
+  CHECK_EQ(output()->at(2).input.index(), temp1.index());
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -114,6 +114,42 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   ASSERT_EQ(1, std::count(order.begin(), order.end(), 5));
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskPriority) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore blocked(0);
+  base::Semaphore unblock(0);
+  base::Semaphore done(0);
+
+  // Occupies the only worker until all other tasks are posted.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    blocked.Signal();
+    unblock.Wait();
+  }));
+  blocked.Wait();
+
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(1); }),
+                  TaskPriority::kBestEffort);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(2); }),
+                  TaskPriority::kUserVisible);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(3); }),
+                  TaskPriority::kUserBlocking);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(4); }),
+                  TaskPriority::kUserVisible);
+  runner.PostTask(std::make_unique<TestTask>([&] { done.Signal(); }),
+                  TaskPriority::kBestEffort);
+  unblock.Signal();
+  done.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(4UL, order.size());
+  ASSERT_EQ(3, order[0]);
+  ASSERT_EQ(2, order[1]);
+  ASSERT_EQ(4, order[2]);
+  ASSERT_EQ(1, order[3]);
+}
+
 class FakeClock {
  public:
   static double time() { return time_.load(); }
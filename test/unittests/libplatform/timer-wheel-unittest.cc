@@ -0,0 +1,91 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/timer-wheel.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+
+TEST(TimerWheelTest, Empty) {
+  TimerWheel<int> wheel;
+  EXPECT_TRUE(wheel.empty());
+  std::vector<int> expired;
+  wheel.PopExpired(100.0, &expired);
+  EXPECT_TRUE(expired.empty());
+}
+
+TEST(TimerWheelTest, ExpiresAtExactDeadline) {
+  TimerWheel<int> wheel;
+  wheel.Insert(10.0005, 1);
+  std::vector<int> expired;
+  wheel.PopExpired(10.0004, &expired);
+  EXPECT_TRUE(expired.empty());
+  EXPECT_LE(wheel.NextDeadlineLowerBound(), 10.0005);
+  EXPECT_GT(wheel.NextDeadlineLowerBound(), 10.0004);
+  wheel.PopExpired(10.0005, &expired);
+  EXPECT_EQ(std::vector<int>({1}), expired);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, ExpiresInDeadlineOrder) {
+  TimerWheel<int> wheel;
+  wheel.Insert(5.0, 3);
+  wheel.Insert(1.0, 1);
+  wheel.Insert(2.0, 2);
+  wheel.Insert(5.0, 4);
+  wheel.Insert(7.0, 5);
+  EXPECT_EQ(5u, wheel.size());
+  std::vector<int> expired;
+  wheel.PopExpired(6.0, &expired);
+  EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), expired);
+  EXPECT_EQ(1u, wheel.size());
+}
+
+TEST(TimerWheelTest, FarDeadlines) {
+  TimerWheel<int> wheel;
+  // Beyond the range of the last level.
+  wheel.Insert(100000.0, 3);
+  wheel.Insert(1000.0, 2);
+  wheel.Insert(1.0, 1);
+  std::vector<int> expired;
+  double now = 0.0;
+  while (!wheel.empty()) {
+    double next = wheel.NextDeadlineLowerBound();
+    EXPECT_GT(next, now);
+    now = next;
+    wheel.PopExpired(now, &expired);
+  }
+  EXPECT_EQ(std::vector<int>({1, 2, 3}), expired);
+  EXPECT_EQ(100000.0, now);
+}
+
+TEST(TimerWheelTest, InsertBeforeCurrentTime) {
+  TimerWheel<int> wheel;
+  std::vector<int> expired;
+  wheel.Insert(50.0, 2);
+  wheel.PopExpired(20.0, &expired);
+  EXPECT_TRUE(expired.empty());
+  wheel.Insert(10.0, 1);
+  EXPECT_EQ(10.0, wheel.NextDeadlineLowerBound());
+  wheel.PopExpired(50.0, &expired);
+  EXPECT_EQ(std::vector<int>({1, 2}), expired);
+}
+
+TEST(TimerWheelTest, Clear) {
+  TimerWheel<int> wheel;
+  wheel.Insert(1.0, 1);
+  wheel.Insert(1000.0, 2);
+  wheel.Clear();
+  EXPECT_TRUE(wheel.empty());
+  std::vector<int> expired;
+  wheel.PopExpired(2000.0, &expired);
+  EXPECT_TRUE(expired.empty());
+}
+
+}  // namespace platform
+}  // namespace v8
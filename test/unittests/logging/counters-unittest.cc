@@ -572,6 +572,32 @@ TEST_F(RuntimeCallStatsTest, NestedScopes) {
   EXPECT_EQ(100, counter3()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, Sampling) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    Sleep(100);
+    stats()->AddSample(base::TimeDelta::FromMicroseconds(100));
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+      Sleep(100);
+      stats()->AddSample(base::TimeDelta::FromMicroseconds(100));
+      stats()->AddSample(base::TimeDelta::FromMicroseconds(100));
+    }
+  }
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id2());
+  }
+  // Samples taken outside of any scope aren't attributed.
+  stats()->AddSample(base::TimeDelta::FromMicroseconds(100));
+  EXPECT_EQ(1, counter()->count());
+  EXPECT_EQ(2, counter2()->count());
+  EXPECT_EQ(100, counter()->time().InMicroseconds());
+  EXPECT_EQ(200, counter2()->time().InMicroseconds());
+}
+
 TEST_F(RuntimeCallStatsTest, BasicJavaScript) {
   RuntimeCallCounter* counter =
       stats()->GetCounter(RuntimeCallCounterId::kJS_Execution);
@@ -0,0 +1,92 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/swiss-hash-table-helpers.h"
+
+#include <set>
+#include <vector>
+
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using testing::ElementsAre;
+
+namespace v8 {
+namespace internal {
+namespace swiss_table {
+
+namespace {
+
+template <typename BitMaskT>
+std::vector<int> ToVector(BitMaskT mask) {
+  std::vector<int> result;
+  for (int i : mask) result.push_back(i);
+  return result;
+}
+
+}  // namespace
+
+TEST(SwissTableHelpersTest, ControlBytes) {
+  EXPECT_TRUE(IsEmpty(kEmpty));
+  EXPECT_TRUE(IsEmptyOrDeleted(kEmpty));
+  EXPECT_TRUE(IsDeleted(kDeleted));
+  EXPECT_TRUE(IsEmptyOrDeleted(kDeleted));
+  EXPECT_FALSE(IsEmptyOrDeleted(kSentinel));
+  EXPECT_FALSE(IsFull(kSentinel));
+  EXPECT_TRUE(IsFull(0));
+  EXPECT_TRUE(IsFull(127));
+  EXPECT_EQ(0x7f, H2(0xffffffff));
+  EXPECT_EQ(0x1ffffffu, H1(0xffffffff));
+}
+
+TEST(SwissTableHelpersTest, BitMask) {
+  EXPECT_THAT(ToVector(BitMask<uint32_t, 16>(0x8005)), ElementsAre(0, 2, 15));
+  EXPECT_THAT(ToVector(BitMask<uint64_t, 8, 3>(0x8000000000008080ULL)),
+              ElementsAre(0, 1, 7));
+  EXPECT_FALSE(BitMask<uint32_t, 16>(0));
+  EXPECT_EQ(3, BitMask<uint32_t, 16>(0x18).LowestBitSet());
+}
+
+TEST(SwissTableHelpersTest, PortableGroup) {
+  const ctrl_t ctrl[] = {kEmpty, 1, kDeleted, 3, 1, 5, kSentinel, 1};
+  GroupPortableImpl group(ctrl);
+  EXPECT_THAT(ToVector(group.Match(1)), ElementsAre(1, 4, 7));
+  EXPECT_THAT(ToVector(group.Match(5)), ElementsAre(5));
+  EXPECT_THAT(ToVector(group.Match(42)), ElementsAre());
+  EXPECT_THAT(ToVector(group.MatchEmpty()), ElementsAre(0));
+  EXPECT_THAT(ToVector(group.MatchEmptyOrDeleted()), ElementsAre(0, 2));
+}
+
+#if V8_SWISS_TABLE_HAVE_SSE2_HOST
+TEST(SwissTableHelpersTest, Sse2Group) {
+  const ctrl_t ctrl[] = {kEmpty, 1, kDeleted, 3, 1,  5,  kSentinel, 1,
+                         2,      1, kEmpty,   9, 10, 11, kDeleted,  1};
+  GroupSse2Impl group(ctrl);
+  EXPECT_THAT(ToVector(group.Match(1)), ElementsAre(1, 4, 7, 9, 15));
+  EXPECT_THAT(ToVector(group.Match(11)), ElementsAre(13));
+  EXPECT_THAT(ToVector(group.Match(42)), ElementsAre());
+  EXPECT_THAT(ToVector(group.MatchEmpty()), ElementsAre(0, 10));
+  EXPECT_THAT(ToVector(group.MatchEmptyOrDeleted()),
+              ElementsAre(0, 2, 10, 14));
+}
+#endif  // V8_SWISS_TABLE_HAVE_SSE2_HOST
+
+TEST(SwissTableHelpersTest, ProbeSequenceVisitsAllGroups) {
+  constexpr int kGroupSize = Group::kWidth;
+  constexpr uint32_t kCapacity = 128;
+  for (uint32_t hash : {0u, 1u, 0x12345678u, 0xffffffffu}) {
+    ProbeSequence<kGroupSize> seq(hash, kCapacity - 1);
+    std::set<uint32_t> offsets;
+    for (uint32_t i = 0; i < kCapacity / kGroupSize; ++i) {
+      EXPECT_EQ(i * kGroupSize, seq.index());
+      offsets.insert(seq.offset());
+      seq.next();
+    }
+    EXPECT_EQ(kCapacity / kGroupSize, offsets.size());
+  }
+}
+
+}  // namespace swiss_table
+}  // namespace internal
+}  // namespace v8
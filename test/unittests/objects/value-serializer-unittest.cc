@@ -569,6 +569,22 @@ TEST_F(ValueSerializerTest, RoundTripString) {
   EXPECT_EQ(kEmojiString, Utf8Value(value));
 }
 
+TEST_F(ValueSerializerTest, RoundTripShortStringsAreShared) {
+  // Short one-byte strings come out internalized, so repeated values share
+  // one string. Long ones are copied.
+  Local<Value> value = RoundTripTest("['debug', 'debug', 'x'.repeat(100)]");
+  ASSERT_TRUE(value->IsArray());
+  Local<Array> array = value.As<Array>();
+  auto element = [&](uint32_t index) {
+    return Utils::OpenHandle(
+        *array->Get(deserialization_context(), index).ToLocalChecked());
+  };
+  EXPECT_TRUE(element(0)->IsInternalizedString());
+  EXPECT_EQ(*element(0), *element(1));
+  EXPECT_FALSE(element(2)->IsInternalizedString());
+  ExpectScriptTrue("result[0] === 'debug' && result[2].length === 100");
+}
+
 TEST_F(ValueSerializerTest, DecodeString) {
   // Decoding the strings above from UTF-8.
   Local<Value> value = DecodeTest({0xFF, 0x09, 0x53, 0x00});
@@ -873,6 +889,65 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithSharedShape) {
+  // Objects with the same map share the list of property names, and should
+  // still get the same map when deserialized.
+  Local<Value> value = RoundTripTest(
+      "var a = [];"
+      "for (var i = 0; i < 10; i++) a.push({x: i, y: 'y' + i, z: {w: i}});"
+      "a;");
+  ExpectScriptTrue("result.length === 10");
+  ExpectScriptTrue("result.every((o, i) => o.x === i && o.y === 'y' + i)");
+  ExpectScriptTrue("result.every((o, i) => o.z.w === i)");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[9]).toString() === 'x,y,z'");
+
+  // Values that don't fit the field representation of the previous object
+  // must not be stored with its map.
+  value = RoundTripTest("[{a: 1, b: 2}, {a: 1.5, b: 'x'}, {a: {}, b: 3}]");
+  ExpectScriptTrue("result[0].a === 1 && result[0].b === 2");
+  ExpectScriptTrue("result[1].a === 1.5 && result[1].b === 'x'");
+  ExpectScriptTrue("typeof result[2].a === 'object' && result[2].b === 3");
+
+  // Objects with the same shape can refer to each other.
+  value = RoundTripTest(
+      "var p = {next: null, v: 1}; var q = {next: p, v: 2}; p.next = q; q;");
+  ExpectScriptTrue("result.next.next === result");
+  ExpectScriptTrue("result.v === 2 && result.next.v === 1");
+
+  // A property that is deleted while the object is serialized is left out.
+  value = RoundTripTest(
+      "var o = {x: 1, y: 2, z: 3};"
+      "o.x = { get a() { delete o.y; return 4; } };"
+      "[o, {x: 5, y: 6, z: 7}];");
+  ExpectScriptTrue("!('y' in result[0]) && result[0].z === 3");
+  ExpectScriptTrue("result[0].x.a === 4");
+  ExpectScriptTrue("result[1].x === 5 && result[1].y === 6");
+}
+
+TEST_F(ValueSerializerTest, DecodeObjectsWithSharedShape) {
+  // Two objects with shape 0 = ['a', 'b']; the second one has no 'a'.
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x41, 0x02, 0x68, 0x00, 0x02, 0x22, 0x01, 0x61,
+                  0x22, 0x01, 0x62, 0x49, 0x54, 0x49, 0x02, 0x68, 0x00, 0x2D,
+                  0x49, 0x04, 0x24, 0x00, 0x02});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].a === 42 && result[0].b === 1");
+  ExpectScriptTrue("!('a' in result[1]) && result[1].b === 2");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[0]).toString() === 'a,b'");
+}
+
+TEST_F(ValueSerializerTest, DecodeInvalidObjectShape) {
+  // The first use of a shape must introduce the next shape ID.
+  InvalidDecodeTest({0xFF, 0x0E, 0x68, 0x01, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+  // More property names than there is data.
+  InvalidDecodeTest({0xFF, 0x0E, 0x68, 0x00, 0x7F, 0x22, 0x01, 0x61});
+  // A property name that is not a string.
+  InvalidDecodeTest({0xFF, 0x0E, 0x68, 0x00, 0x01, 0x49, 0x02, 0x49, 0x02});
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -1793,6 +1868,95 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+// Transfers the backing stores of large ArrayBuffers through the delegate
+// instead of copying their contents.
+class ValueSerializerTestWithBackingStoreTransfer : public ValueSerializerTest {
+ protected:
+  static const size_t kMinTransferByteLength = 1024;
+
+  ValueSerializerTestWithBackingStoreTransfer() : serializer_delegate_(this) {}
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(
+        ValueSerializerTestWithBackingStoreTransfer* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<bool> GetArrayBufferTransferId(Isolate* isolate,
+                                         Local<ArrayBuffer> array_buffer,
+                                         uint32_t* transfer_id) override {
+      if (array_buffer->ByteLength() < kMinTransferByteLength) {
+        return Just(false);
+      }
+      *transfer_id = static_cast<uint32_t>(test_->backing_stores_.size());
+      test_->backing_stores_.push_back(array_buffer->GetBackingStore());
+      test_->transferred_buffers_.push_back(array_buffer);
+      return Just(true);
+    }
+
+   private:
+    ValueSerializerTestWithBackingStoreTransfer* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  void BeforeDecode(ValueDeserializer* deserializer) override {
+    for (Local<ArrayBuffer> array_buffer : transferred_buffers_) {
+      array_buffer->Detach();
+    }
+    for (size_t i = 0; i < backing_stores_.size(); i++) {
+      deserializer->TransferArrayBuffer(
+          static_cast<uint32_t>(i),
+          ArrayBuffer::New(isolate(), backing_stores_[i]));
+    }
+  }
+
+  SerializerDelegate serializer_delegate_;
+  std::vector<std::shared_ptr<BackingStore>> backing_stores_;
+  std::vector<Local<ArrayBuffer>> transferred_buffers_;
+};
+
+TEST_F(ValueSerializerTestWithBackingStoreTransfer, RoundTripLargeArrayBuffer) {
+  Local<Value> value = RoundTripTest(
+      "({small: new Uint8Array([1, 2, 3]).buffer,"
+      "  large: new Uint8Array(4096).fill(42).buffer})");
+  ASSERT_TRUE(value->IsObject());
+  ASSERT_EQ(1u, backing_stores_.size());
+  ExpectScriptTrue("new Uint8Array(result.small).toString() === '1,2,3'");
+  ExpectScriptTrue("result.large.byteLength === 4096");
+  ExpectScriptTrue("new Uint8Array(result.large).every(x => x === 42)");
+  // The contents have not been copied.
+  Local<Value> large;
+  {
+    Context::Scope scope(deserialization_context());
+    large = value.As<Object>()
+                ->Get(deserialization_context(), StringFromUtf8("large"))
+                .ToLocalChecked();
+  }
+  ASSERT_TRUE(large->IsArrayBuffer());
+  EXPECT_EQ(backing_stores_[0]->Data(),
+            large.As<ArrayBuffer>()->GetBackingStore()->Data());
+  EXPECT_EQ(0u, transferred_buffers_[0]->ByteLength());
+}
+
+TEST_F(ValueSerializerTestWithBackingStoreTransfer,
+       RoundTripTypedArrayOfLargeArrayBuffer) {
+  Local<Value> value = RoundTripTest(
+      "var buffer = new ArrayBuffer(2048);"
+      "new Uint8Array(buffer).fill(7);"
+      "({a: new Uint16Array(buffer, 16, 8), b: new Uint8Array(buffer, 4, 2)})");
+  ASSERT_TRUE(value->IsObject());
+  ASSERT_EQ(1u, backing_stores_.size());
+  ExpectScriptTrue("result.a.buffer === result.b.buffer");
+  ExpectScriptTrue("result.a.byteOffset === 16 && result.a.length === 8");
+  ExpectScriptTrue("result.b.byteOffset === 4 && result.b.length === 2");
+  ExpectScriptTrue("result.a.toString() === Array(8).fill(0x707).toString()");
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   // Check that the right type comes out the other side for every kind of typed
   // array.
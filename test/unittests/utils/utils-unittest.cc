@@ -201,5 +201,32 @@ TEST(UtilsTest, IsInBounds) {
 #undef OOB
 }
 
+TEST(UtilsTest, CompareCharsMixedWidths) {
+  // Long enough to cover whole blocks and a tail.
+  const size_t kLength = 3 * kCompareCharsBlockSize + 5;
+  uint8_t one_byte[kLength];
+  uint16_t two_byte[kLength];
+  for (size_t i = 0; i < kLength; i++) {
+    one_byte[i] = static_cast<uint8_t>('a' + i % 26);
+    two_byte[i] = one_byte[i];
+  }
+  EXPECT_TRUE(CompareCharsEqual(one_byte, two_byte, kLength));
+  EXPECT_EQ(0, CompareChars(one_byte, two_byte, kLength));
+  EXPECT_EQ(0, CompareChars(two_byte, two_byte, kLength));
+
+  const size_t kDifferences[] = {0, kCompareCharsBlockSize + 3, kLength - 1};
+  for (size_t i : kDifferences) {
+    two_byte[i] = 0x100 + one_byte[i];
+    EXPECT_FALSE(CompareCharsEqual(one_byte, two_byte, kLength));
+    EXPECT_FALSE(CompareCharsEqual(two_byte, one_byte, kLength));
+    EXPECT_LT(CompareChars(one_byte, two_byte, kLength), 0);
+    EXPECT_GT(CompareChars(two_byte, one_byte, kLength), 0);
+    // Only the prefix before the difference is compared.
+    EXPECT_TRUE(CompareCharsEqual(one_byte, two_byte, i));
+    EXPECT_EQ(0, CompareChars(two_byte, one_byte, i));
+    two_byte[i] = one_byte[i];
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
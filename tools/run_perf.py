@@ -28,6 +28,8 @@ The suite json format is expected to be:
   "results_processor": <optional python results processor script>,
   "units": <the unit specification for the performance dashboard>,
   "process_size": <flag - collect maximum memory used by the process>,
+  "perf_counters": [<perf event collected with perf stat, e.g.
+                     "instructions", "cache-misses" or "branch-misses">, ...],
   "tests": [
     {
       "name": <name of the trace>,
@@ -56,6 +58,10 @@ The results_regexp will be applied to the processed output.
 
 A suite without "tests" is considered a performance test itself.
 
+Each of a runnable's perf_counters is reported as an additional trace named
+after the event below the runnable, with "count" units. Collecting them
+requires Linux and the perf tool.
+
 Full example (suite with one runner):
 {
   "path": ["."],
@@ -141,6 +147,8 @@ SUPPORTED_ARCHS = ['arm',
 GENERIC_RESULTS_RE = re.compile(r'^RESULT ([^:]+): ([^=]+)= ([^ ]+) ([^ ]*)$')
 RESULT_STDDEV_RE = re.compile(r'^\{([^\}]+)\}$')
 RESULT_LIST_RE = re.compile(r'^\[([^\]]+)\]$')
+# Lines of perf stat's CSV output: <value>,<unit>,<event>[:<modifiers>],...
+PERF_COUNTER_RE = re.compile(r'^([0-9.]+),[^,]*,([^,:]+)[^,]*,', re.M)
 TOOLS_BASE = os.path.abspath(os.path.dirname(__file__))
 INFRA_FAILURE_RETCODE = 87
 MIN_RUNS_FOR_CONFIDENCE = 10
@@ -318,6 +326,7 @@ class DefaultSentinel(Node):
     self.flags = []
     self.test_flags = []
     self.process_size = False
+    self.perf_counters = []
     self.resources = []
     self.results_processor = None
     self.results_regexp = None
@@ -342,6 +351,7 @@ class GraphConfig(Node):
     assert isinstance(suite.get('flags', []), list)
     assert isinstance(suite.get('test_flags', []), list)
     assert isinstance(suite.get('resources', []), list)
+    assert isinstance(suite.get('perf_counters', []), list)
 
     # Accumulated values.
     self.path = parent.path[:] + suite.get('path', [])
@@ -366,6 +376,7 @@ class GraphConfig(Node):
     self.results_processor = suite.get(
         'results_processor', parent.results_processor)
     self.process_size = suite.get('process_size', parent.process_size)
+    self.perf_counters = suite.get('perf_counters', parent.perf_counters)
 
     # A regular expression for results. If the parent graph provides a
     # regexp and the current suite has none, a string place holder for the
@@ -469,6 +480,9 @@ class RunnableConfig(GraphConfig):
     if self.binary != 'd8' and '--prof' in extra_flags:
       logging.info('Profiler supported only on a benchmark run with d8')
 
+    if self.perf_counters:
+      cmd_prefix = ['perf', 'stat', '-x', ',',
+                    '-e', ','.join(self.perf_counters)] + cmd_prefix
     if self.process_size:
       cmd_prefix = ['/usr/bin/time', '--format=MaxMemory: %MKB'] + cmd_prefix
     if self.binary.endswith('.py'):
@@ -482,6 +496,24 @@ class RunnableConfig(GraphConfig):
         timeout=self.timeout or 60,
         handle_sigterm=True)
 
+  def ConsumePerfCounters(self, output, result_tracker):
+    """Extracts the hardware counters printed by perf stat from the output.
+
+    Args:
+      output: Output object from the test run.
+      result_tracker: Result tracker to be updated.
+    """
+    counters = dict((event, value) for value, event in
+                    PERF_COUNTER_RE.findall(output.stdout or ''))
+    for event in self.perf_counters:
+      if event not in counters:
+        result_tracker.AddError(
+            'Perf counter "%s" was not reported for test %s.' %
+            (event, self.name))
+        continue
+      result_tracker.AddTraceResult(
+          PerfCounterTrace(self, event), float(counters[event]), '')
+
   def ProcessOutput(self, output, result_tracker, count):
     """Processes test run output and updates result tracker.
 
@@ -498,6 +530,7 @@ class RunnableConfig(GraphConfig):
       result = trace.ConsumeOutput(output, result_tracker)
       if result:
         results_for_total.append(result)
+    self.ConsumePerfCounters(output, result_tracker)
 
     if self.total:
       # Produce total metric only when all traces have produced results.
@@ -522,6 +555,18 @@ class RunnableTraceConfig(TraceConfig, RunnableConfig):
   def ProcessOutput(self, output, result_tracker, count):
     result_tracker.AddRunnableDuration(self, output.duration)
     self.ConsumeOutput(output, result_tracker)
+    self.ConsumePerfCounters(output, result_tracker)
+
+
+class PerfCounterTrace(object):
+  """Represents a hardware counter collected for a runnable."""
+  def __init__(self, runnable, event):
+    self.graphs = runnable.graphs + [event]
+    self.units = 'count'
+
+  @property
+  def name(self):
+    return '/'.join(self.graphs)
 
 
 def MakeGraphConfig(suite, arch, parent):
@@ -709,8 +754,8 @@ class DesktopPlatform(Platform):
         logging.warning(
             'Profiler option currently supported on Linux and Mac OS.')
 
-    # /usr/bin/time outputs to stderr
-    if runnable.process_size:
+    # /usr/bin/time and perf stat output to stderr
+    if runnable.process_size or runnable.perf_counters:
       output.stdout += output.stderr
     return output
 
@@ -143,6 +143,7 @@ class PerfTest(unittest.TestCase):
     on_bots = kwargs.pop('on_bots', False)
     # Fake output for each test run.
     test_outputs = [Output(stdout=arg,
+                           stderr=kwargs.get('stderr'),
                            timed_out=kwargs.get('timed_out', False),
                            exit_code=kwargs.get('exit_code', 0),
                            duration=42)
@@ -245,6 +246,36 @@ class PerfTest(unittest.TestCase):
     self._VerifyMock(
         os.path.join('out', 'x64.release', 'd7'), '--flag', 'run.js')
 
+  def testPerfCounters(self):
+    test_input = dict(V8_JSON)
+    test_input['perf_counters'] = ['instructions', 'branch-misses']
+    self._WriteTestInput(test_input)
+    self._MockCommand(['.'], ['Richards: 1.234\nDeltaBlue: 10657567\n'],
+                      stderr='123456789,,instructions:u,1000,100.00,,\n'
+                             '4321,,branch-misses:u,1000,100.00,,\n')
+    self.assertEqual(0, self._CallMain())
+    traces = self._LoadResults()['traces']
+    self.assertIn({'graphs': ['test', 'instructions'], 'units': 'count',
+                   'results': [123456789.0], 'stddev': ''}, traces)
+    self.assertIn({'graphs': ['test', 'branch-misses'], 'units': 'count',
+                   'results': [4321.0], 'stddev': ''}, traces)
+    self.assertIn({'graphs': ['test', 'Richards'], 'units': 'score',
+                   'results': [1.234], 'stddev': ''}, traces)
+    self._VerifyErrors([])
+    self.assertEqual(
+        ['perf', 'stat', '-x', ',', '-e', 'instructions,branch-misses'],
+        command.Command.call_args[1]['cmd_prefix'])
+
+  def testPerfCountersMissing(self):
+    test_input = dict(V8_JSON)
+    test_input['perf_counters'] = ['cache-misses']
+    self._WriteTestInput(test_input)
+    self._MockCommand(['.'], ['Richards: 1.234\nDeltaBlue: 10657567\n'],
+                      stderr='<not supported>,,cache-misses,0,100.00,,\n')
+    self.assertEqual(1, self._CallMain())
+    self._VerifyErrors(
+        ['Perf counter "cache-misses" was not reported for test test.'])
+
   def testOneRunWithTestFlags(self):
     test_input = dict(V8_JSON)
     test_input['test_flags'] = ['2', 'test_name']
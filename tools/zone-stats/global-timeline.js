@@ -99,6 +99,8 @@ defineCustomElement('global-timeline', (templateText) =>
       { label: "Total allocated", type: "number" },
       { label: "Total used", type: "number" },
       { label: "Total freed", type: "number" },
+      { label: "Pooled segments", type: "number" },
+      { label: "Reused segments", type: "number" },
     ];
     const chart_data = [labels];
 
@@ -113,6 +115,8 @@ defineCustomElement('global-timeline', (templateText) =>
       data.push(zone_data.allocated / KB);
       data.push(zone_data.used / KB);
       data.push(zone_data.freed / KB);
+      data.push(zone_data.pooled / KB);
+      data.push(zone_data.reused / KB);
       chart_data.push(data);
     }
     return chart_data;
@@ -169,6 +169,9 @@ defineCustomElement('trace-file-reader', (templateText) =>
       allocated: entry_stats.allocated,
       used: entry_stats.used,
       freed: entry_stats.freed,
+      // Segment pool stats are not available in older traces.
+      pooled: entry_stats.pooled || 0,
+      reused: entry_stats.reused || 0,
       zones: zones
     };
     isolate_data.samples.set(time, sample);